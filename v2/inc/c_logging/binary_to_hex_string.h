@@ -0,0 +1,26 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef BINARY_TO_HEX_STRING_H
+#define BINARY_TO_HEX_STRING_H
+
+#ifdef __cplusplus
+#include <cstddef>
+#else
+#include <stddef.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Produces the lowercase hex representation of data (2 characters per byte, no separators).
+// The result is the length of the full representation, buffer is always zero terminated (if buffer_length is not 0)
+// and when the representation does not fit only the bytes that fit entirely are written (a byte is never cut in half)
+int binary_to_hex_string(const void* data, size_t data_length, char* buffer, size_t buffer_length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BINARY_TO_HEX_STRING_H */
@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef FLOATING_POINT_TO_STRING_H
+#define FLOATING_POINT_TO_STRING_H
+
+#ifdef __cplusplus
+#include <cstddef>
+#else
+#include <stddef.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// maximum number of characters produced for a double ("-1.2345678901234567e-308"), without the zero terminator
+#define FLOATING_POINT_TO_STRING_MAX_LENGTH 24
+
+// These produce a decimal string that reads back as the same value (Grisu2: the shortest one for most values, but not
+// for all) and follow the snprintf contract:
+// the result is the length of the full representation, buffer is always zero terminated (if buffer_length is not 0)
+// and the representation is truncated if it does not fit
+int floating_point_to_string_double(double value, char* buffer, size_t buffer_length);
+int floating_point_to_string_float(float value, char* buffer, size_t buffer_length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FLOATING_POINT_TO_STRING_H */
@@ -0,0 +1,44 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef IDENTIFIER_TO_STRING_H
+#define IDENTIFIER_TO_STRING_H
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// number of characters produced for a UUID ("01234567-89ab-cdef-0123-456789abcdef"), without the zero terminator
+#define UUID_TO_STRING_LENGTH 36
+
+// maximum number of characters produced for an IPv4 address ("255.255.255.255"), without the zero terminator
+#define IPV4_ADDRESS_TO_STRING_MAX_LENGTH 15
+
+// maximum number of characters produced for an IPv6 address ("ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff"), without the zero terminator
+#define IPV6_ADDRESS_TO_STRING_MAX_LENGTH 39
+
+// These follow the snprintf contract: the result is the length of the full representation,
+// buffer is always zero terminated (if buffer_length is not 0) and the representation is truncated if it does not fit
+
+// uuid is 16 bytes in RFC 4122 (network) byte order, the output is lowercase
+int uuid_to_string(const uint8_t* uuid, char* buffer, size_t buffer_length);
+
+// address is 4 bytes in network byte order, the output is dotted decimal
+int ipv4_address_to_string(const uint8_t* address, char* buffer, size_t buffer_length);
+
+// address is 16 bytes in network byte order, the output is the RFC 5952 text form
+int ipv6_address_to_string(const uint8_t* address, char* buffer, size_t buffer_length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* IDENTIFIER_TO_STRING_H */
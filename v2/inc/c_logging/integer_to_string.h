@@ -0,0 +1,45 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef INTEGER_TO_STRING_H
+#define INTEGER_TO_STRING_H
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// maximum number of characters produced for a 64 bit integer ("-9223372036854775808" or "18446744073709551615"), without the zero terminator
+#define INTEGER_TO_STRING_MAX_LENGTH 20
+
+uint32_t integer_to_string_uint64_digit_count(uint64_t value);
+uint32_t integer_to_string_uint32_digit_count(uint32_t value);
+
+// length of the decimal representation of value, including the - sign for negative values
+uint32_t integer_to_string_int64_length(int64_t value);
+
+// These write the decimal representation at buffer without a zero terminator and without checking for space,
+// they are meant for formatting many values in a batch once the total length has been computed with the functions above.
+// The result is the number of characters written (at most INTEGER_TO_STRING_MAX_LENGTH)
+uint32_t integer_to_string_write_uint64(uint64_t value, char* buffer);
+uint32_t integer_to_string_write_int64(int64_t value, char* buffer);
+
+// These follow the snprintf contract: the result is the length of the full decimal representation,
+// buffer is always zero terminated (if buffer_length is not 0) and the representation is truncated if it does not fit
+int integer_to_string_uint64(uint64_t value, char* buffer, size_t buffer_length);
+int integer_to_string_int64(int64_t value, char* buffer, size_t buffer_length);
+int integer_to_string_uint32(uint32_t value, char* buffer, size_t buffer_length);
+int integer_to_string_int32(int32_t value, char* buffer, size_t buffer_length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTEGER_TO_STRING_H */
@@ -6,10 +6,13 @@
 
 #ifdef __cplusplus
 #include <cinttypes>
+#include <cstddef>
 #include <cstdio>
 #include <cstdlib>
 #else
 #include <inttypes.h>
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <wchar.h>
 #include <stdlib.h>
@@ -19,7 +22,13 @@
 
 #include "c_logging/log_context_property_value_pair.h"
 #include "c_logging/log_context_property_basic_types.h"
+#include "c_logging/log_context_property_type_array.h"
 #include "c_logging/log_context_property_type_ascii_char_ptr.h"
+#include "c_logging/log_context_property_type_borrowed_ascii_char_ptr.h"
+#include "c_logging/log_context_property_type_binary.h"
+#include "c_logging/log_context_property_type_identifiers.h"
+#include "c_logging/log_context_property_type_enum.h"
+#include "c_logging/log_context_property_type_time.h"
 #include "c_logging/log_context_property_type_wchar_t_ptr.h"
 #include "c_logging/log_context_property_type_struct.h"
 #include "c_logging/log_internal_error.h"
@@ -31,6 +40,10 @@ extern "C" {
 #define LOG_MAX_STACK_DATA_SIZE                 4096
 #define LOG_MAX_STACK_PROPERTY_VALUE_PAIR_COUNT 64
 
+// number of bytes reserved up front in a dynamically allocated context for each property whose value size
+// is only known once the value is produced (strings, custom function properties)
+#define LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE    128
+
 typedef struct LOG_CONTEXT_TAG
 {
     uint8_t* values_data;
@@ -42,12 +55,26 @@ typedef struct LOG_CONTEXT_TAG
 
 typedef struct LOG_CONTEXT_TAG* LOG_CONTEXT_HANDLE;
 
+// state used by LOG_CONTEXT_CREATE and LOG_CONTEXT_LOCAL_DEFINE while producing the property values directly in the context data area
+typedef struct LOG_CONTEXT_FILL_STATE_TAG
+{
+    LOG_CONTEXT_HANDLE log_context;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pair;
+    uint8_t* data_pos;
+    uint8_t* data_end;
+    bool can_grow;
+    bool failed;
+} LOG_CONTEXT_FILL_STATE;
+
 uint32_t log_context_get_property_value_pair_count(LOG_CONTEXT_HANDLE log_context);
 const LOG_CONTEXT_PROPERTY_VALUE_PAIR* log_context_get_property_value_pairs(LOG_CONTEXT_HANDLE log_context);
 
 // These is an internal API and it is not meant to be called by the users of this module
 int internal_log_context_init_from_parent(LOG_CONTEXT_HANDLE dest_log_context, LOG_CONTEXT_HANDLE parent_log_context);
 uint32_t internal_log_context_get_values_data_length_or_zero(LOG_CONTEXT_HANDLE log_context);
+// type a value has once copied in a context that owns its data (borrowed types are promoted to the type owning the bytes)
+const LOG_CONTEXT_PROPERTY_TYPE_IF* internal_log_context_get_owning_property_type(const LOG_CONTEXT_PROPERTY_TYPE_IF* property_type);
+int internal_log_context_reserve(LOG_CONTEXT_FILL_STATE* fill_state, uint32_t needed_size);
 
 // macro set used to define a parameter in a function signature in order
 // to make sure that no properties with the same name are added in one context
@@ -62,6 +89,18 @@ uint32_t internal_log_context_get_values_data_length_or_zero(LOG_CONTEXT_HANDLE
 #define EXPAND_DEFINE_PROPERTY_AS_PARAMETER_LOG_CONTEXT_WSTRING_PROPERTY(property_name, ...) \
     , int property_name
 
+#define EXPAND_DEFINE_PROPERTY_AS_PARAMETER_LOG_CONTEXT_BORROWED_STRING_PROPERTY(property_name, value) \
+    , int property_name
+
+#define EXPAND_DEFINE_PROPERTY_AS_PARAMETER_LOG_CONTEXT_BINARY_PROPERTY(property_name, data, length) \
+    , int property_name
+
+#define EXPAND_DEFINE_PROPERTY_AS_PARAMETER_LOG_CONTEXT_BORROWED_BINARY_PROPERTY(property_name, data, length) \
+    , int property_name
+
+#define EXPAND_DEFINE_PROPERTY_AS_PARAMETER_LOG_CONTEXT_ARRAY_PROPERTY(element_type, property_name, values, count) \
+    , int property_name
+
 #define EXPAND_DEFINE_PROPERTY_AS_PARAMETER_LOG_CONTEXT_NAME(log_context_name) \
 
 #define EXPAND_DEFINE_PROPERTY_AS_PARAMETER_LOG_CONTEXT_PROPERTY(property_type, property_name, field_value) \
@@ -84,6 +123,14 @@ uint32_t internal_log_context_get_values_data_length_or_zero(LOG_CONTEXT_HANDLE
 
 #define EXPAND_DEFINE_CONTEXT_NAME_AS_PARAMETER_LOG_CONTEXT_WSTRING_PROPERTY(property_name, ...) \
 
+#define EXPAND_DEFINE_CONTEXT_NAME_AS_PARAMETER_LOG_CONTEXT_BORROWED_STRING_PROPERTY(property_name, value) \
+
+#define EXPAND_DEFINE_CONTEXT_NAME_AS_PARAMETER_LOG_CONTEXT_BINARY_PROPERTY(property_name, data, length) \
+
+#define EXPAND_DEFINE_CONTEXT_NAME_AS_PARAMETER_LOG_CONTEXT_BORROWED_BINARY_PROPERTY(property_name, data, length) \
+
+#define EXPAND_DEFINE_CONTEXT_NAME_AS_PARAMETER_LOG_CONTEXT_ARRAY_PROPERTY(element_type, property_name, values, count) \
+
 #define EXPAND_DEFINE_CONTEXT_NAME_AS_PARAMETER_LOG_CONTEXT_NAME(log_context_name) \
     , int log_context_is_used_multiple_times
 
@@ -106,49 +153,146 @@ uint32_t internal_log_context_get_values_data_length_or_zero(LOG_CONTEXT_HANDLE
 
 // SETUP_PROPERTY_PAIR
 
+// every property value is produced directly at fill_state.data_pos, so a value that fits in the space left is produced with one call
+// if a value does not fit, internal_log_context_reserve is called (which only succeeds for dynamically allocated contexts)
+// and the value is produced a second time in the reserved space
+// a value that cannot be stored only marks fill_state as failed, the error is reported once the whole context was filled
+// (LOG_CONTEXT_LOCAL_DEFINE calls log_internal_error_report, LOG_CONTEXT_CREATE returns NULL)
+
+#define INTERNAL_LOG_CONTEXT_ADD_PROPERTY_VALUE_PAIR(property_name, property_type_if, value_size) \
+    if ((value_size < 0) || (value_size > fill_state.data_end - fill_state.data_pos)) \
+    { \
+        fill_state.failed = true; \
+        fill_state.data_end = fill_state.data_pos; \
+    } \
+    else \
+    { \
+        fill_state.property_value_pair->value = fill_state.data_pos; \
+        fill_state.property_value_pair->name = MU_TOSTRING(property_name); \
+        fill_state.property_value_pair->type = property_type_if; \
+        fill_state.data_pos += value_size; \
+        fill_state.property_value_pair++; \
+    } \
+
 #define EXPAND_SETUP_PROPERTY_PAIR_LOG_MESSAGE(...) \
 
 #define EXPAND_SETUP_PROPERTY_PAIR_LOG_CONTEXT_STRING_PROPERTY(property_name, ...) \
-    /* Codes_SRS_LOG_CONTEXT_01_007: [ LOG_CONTEXT_STRING_PROPERTY shall expand to code allocating a property/value pair of type ascii_char_ptr and the name property_name. ]*/ \
-    property_value_pair->value = data_pos; \
-    property_value_pair->name = MU_TOSTRING(property_name); \
-    property_value_pair->type = &ascii_char_ptr##_log_context_property_type; \
     /* Codes_SRS_LOG_CONTEXT_01_008: [ LOG_CONTEXT_STRING_PROPERTY shall expand to code that stores as value a string that is constructed using printf-like formatting based on format and all the arguments in .... ]*/ \
-    data_pos += sprintf(property_value_pair->value, __VA_ARGS__) + 1; \
-    property_value_pair++; \
+    /* Codes_SRS_LOG_CONTEXT_01_031: [ LOG_CONTEXT_STRING_PROPERTY shall expand to code that formats the string directly in the space left in the context data area, by calling LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr), so that a string that fits is formatted with a single call. ]*/ \
+    fill_result = ascii_char_ptr_log_context_property_type_fill(fill_state.data_pos, (size_t)(fill_state.data_end - fill_state.data_pos), __VA_ARGS__); \
+    /* Codes_SRS_LOG_CONTEXT_01_032: [ If the formatted string does not fit in the space left, LOG_CONTEXT_STRING_PROPERTY shall expand to code that calls internal_log_context_reserve to make room for the string and formats the string again. ]*/ \
+    if ((fill_result > fill_state.data_end - fill_state.data_pos) && (internal_log_context_reserve(&fill_state, (uint32_t)fill_result) == 0)) \
+    { \
+        fill_result = ascii_char_ptr_log_context_property_type_fill(fill_state.data_pos, (size_t)(fill_state.data_end - fill_state.data_pos), __VA_ARGS__); \
+    } \
+    /* Codes_SRS_LOG_CONTEXT_01_007: [ LOG_CONTEXT_STRING_PROPERTY shall expand to code allocating a property/value pair of type ascii_char_ptr and the name property_name. ]*/ \
+    INTERNAL_LOG_CONTEXT_ADD_PROPERTY_VALUE_PAIR(property_name, &ascii_char_ptr##_log_context_property_type, fill_result) \
 
 #define EXPAND_SETUP_PROPERTY_PAIR_LOG_CONTEXT_WSTRING_PROPERTY(property_name, ...) \
-    /* Codes_SRS_LOG_CONTEXT_07_001: [ LOG_CONTEXT_WSTRING_PROPERTY shall expand to code allocating a property/value pair of type wchar_t_ptr and the name property_name. ]*/ \
-    property_value_pair->value = data_pos; \
-    property_value_pair->name = MU_TOSTRING(property_name); \
-    property_value_pair->type = &MU_C2A(wchar_t_ptr, _log_context_property_type); \
     /* Codes_SRS_LOG_CONTEXT_07_002: [ LOG_CONTEXT_WSTRING_PROPERTY shall expand to code that stores as value a wchar string that is constructed using wprintf-like formatting based on format and all the arguments in .... ]*/ \
-    data_pos += swprintf(property_value_pair->value, LOG_MAX_WCHAR_STRING_LENGTH, __VA_ARGS__)*sizeof(wchar_t) + sizeof(wchar_t); \
-    property_value_pair++; \
+    /* Codes_SRS_LOG_CONTEXT_07_003: [ LOG_CONTEXT_WSTRING_PROPERTY shall expand to code that formats the string directly in the space left in the context data area, by calling LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr). ]*/ \
+    fill_result = wchar_t_ptr_log_context_property_type_fill(fill_state.data_pos, (size_t)(fill_state.data_end - fill_state.data_pos), __VA_ARGS__); \
+    /* Codes_SRS_LOG_CONTEXT_07_004: [ If the formatted string does not fit in the space left, LOG_CONTEXT_WSTRING_PROPERTY shall expand to code that calls internal_log_context_reserve to make room for the string and formats the string again. ]*/ \
+    if ((fill_result > fill_state.data_end - fill_state.data_pos) && (internal_log_context_reserve(&fill_state, (uint32_t)fill_result) == 0)) \
+    { \
+        fill_result = wchar_t_ptr_log_context_property_type_fill(fill_state.data_pos, (size_t)(fill_state.data_end - fill_state.data_pos), __VA_ARGS__); \
+    } \
+    /* Codes_SRS_LOG_CONTEXT_07_001: [ LOG_CONTEXT_WSTRING_PROPERTY shall expand to code allocating a property/value pair of type wchar_t_ptr and the name property_name. ]*/ \
+    INTERNAL_LOG_CONTEXT_ADD_PROPERTY_VALUE_PAIR(property_name, &MU_C2A(wchar_t_ptr, _log_context_property_type), fill_result) \
+
+#define EXPAND_SETUP_PROPERTY_PAIR_LOG_CONTEXT_BORROWED_STRING_PROPERTY(property_name, value) \
+    /* Codes_SRS_LOG_CONTEXT_01_045: [ LOG_CONTEXT_BORROWED_STRING_PROPERTY shall expand to code allocating a property/value pair with the name property_name. ]*/ \
+    if (fill_state.can_grow) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_01_047: [ In a context created by LOG_CONTEXT_CREATE, LOG_CONTEXT_BORROWED_STRING_PROPERTY shall expand to code that copies the string in the context data area by calling LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) and stores a property/value pair of type ascii_char_ptr and the name property_name. ]*/ \
+        fill_result = borrowed_ascii_char_ptr_log_context_property_type_fill(fill_state.data_pos, (size_t)(fill_state.data_end - fill_state.data_pos), value); \
+        /* Codes_SRS_LOG_CONTEXT_01_048: [ If the string does not fit in the space left, LOG_CONTEXT_BORROWED_STRING_PROPERTY shall expand to code that calls internal_log_context_reserve to make room for the string and copies the string again. ]*/ \
+        if ((fill_result > fill_state.data_end - fill_state.data_pos) && (internal_log_context_reserve(&fill_state, (uint32_t)fill_result) == 0)) \
+        { \
+            fill_result = borrowed_ascii_char_ptr_log_context_property_type_fill(fill_state.data_pos, (size_t)(fill_state.data_end - fill_state.data_pos), value); \
+        } \
+        INTERNAL_LOG_CONTEXT_ADD_PROPERTY_VALUE_PAIR(property_name, &ascii_char_ptr_log_context_property_type, fill_result) \
+    } \
+    else \
+    { \
+        fill_result = -1; \
+        if ((fill_state.data_end - fill_state.data_pos >= (ptrdiff_t)sizeof(BORROWED_ASCII_CHAR_PTR)) || (internal_log_context_reserve(&fill_state, sizeof(BORROWED_ASCII_CHAR_PTR)) == 0)) \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_01_046: [ In a context defined by LOG_CONTEXT_LOCAL_DEFINE, LOG_CONTEXT_BORROWED_STRING_PROPERTY shall expand to code that stores a value of type borrowed_ascii_char_ptr holding only the pointer value and the length of the string, by calling LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr), without copying the string. ]*/ \
+            fill_result = (borrowed_ascii_char_ptr_log_context_property_type_init((void*)fill_state.data_pos, value) == 0) ? (int)sizeof(BORROWED_ASCII_CHAR_PTR) : -1; \
+        } \
+        INTERNAL_LOG_CONTEXT_ADD_PROPERTY_VALUE_PAIR(property_name, &borrowed_ascii_char_ptr_log_context_property_type, fill_result) \
+    } \
+
+#define EXPAND_SETUP_PROPERTY_PAIR_LOG_CONTEXT_BINARY_PROPERTY(property_name, data, length) \
+    /* Codes_SRS_LOG_CONTEXT_01_050: [ LOG_CONTEXT_BINARY_PROPERTY shall expand to code that copies the length bytes at data in the context data area by calling LOG_CONTEXT_PROPERTY_TYPE_FILL(binary). ]*/ \
+    fill_result = binary_log_context_property_type_fill(fill_state.data_pos, (size_t)(fill_state.data_end - fill_state.data_pos), data, length); \
+    if ((fill_result > fill_state.data_end - fill_state.data_pos) && (internal_log_context_reserve(&fill_state, (uint32_t)fill_result) == 0)) \
+    { \
+        fill_result = binary_log_context_property_type_fill(fill_state.data_pos, (size_t)(fill_state.data_end - fill_state.data_pos), data, length); \
+    } \
+    /* Codes_SRS_LOG_CONTEXT_01_049: [ LOG_CONTEXT_BINARY_PROPERTY shall expand to code allocating a property/value pair of type binary and the name property_name. ]*/ \
+    INTERNAL_LOG_CONTEXT_ADD_PROPERTY_VALUE_PAIR(property_name, &binary_log_context_property_type, fill_result) \
+
+#define EXPAND_SETUP_PROPERTY_PAIR_LOG_CONTEXT_BORROWED_BINARY_PROPERTY(property_name, data, length) \
+    /* Codes_SRS_LOG_CONTEXT_01_051: [ LOG_CONTEXT_BORROWED_BINARY_PROPERTY shall expand to code allocating a property/value pair with the name property_name. ]*/ \
+    if (fill_state.can_grow) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_01_053: [ In a context created by LOG_CONTEXT_CREATE, LOG_CONTEXT_BORROWED_BINARY_PROPERTY shall expand to code that copies the bytes in the context data area by calling LOG_CONTEXT_PROPERTY_TYPE_FILL(binary) and stores a property/value pair of type binary and the name property_name. ]*/ \
+        fill_result = binary_log_context_property_type_fill(fill_state.data_pos, (size_t)(fill_state.data_end - fill_state.data_pos), data, length); \
+        /* Codes_SRS_LOG_CONTEXT_01_054: [ If the bytes do not fit in the space left, LOG_CONTEXT_BORROWED_BINARY_PROPERTY shall expand to code that calls internal_log_context_reserve to make room for the bytes and copies the bytes again. ]*/ \
+        if ((fill_result > fill_state.data_end - fill_state.data_pos) && (internal_log_context_reserve(&fill_state, (uint32_t)fill_result) == 0)) \
+        { \
+            fill_result = binary_log_context_property_type_fill(fill_state.data_pos, (size_t)(fill_state.data_end - fill_state.data_pos), data, length); \
+        } \
+        INTERNAL_LOG_CONTEXT_ADD_PROPERTY_VALUE_PAIR(property_name, &binary_log_context_property_type, fill_result) \
+    } \
+    else \
+    { \
+        fill_result = -1; \
+        if ((fill_state.data_end - fill_state.data_pos >= (ptrdiff_t)sizeof(BORROWED_BINARY)) || (internal_log_context_reserve(&fill_state, sizeof(BORROWED_BINARY)) == 0)) \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_01_052: [ In a context defined by LOG_CONTEXT_LOCAL_DEFINE, LOG_CONTEXT_BORROWED_BINARY_PROPERTY shall expand to code that stores a value of type borrowed_binary holding only the pointer data and length, by calling LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary), without copying the bytes. ]*/ \
+            fill_result = (borrowed_binary_log_context_property_type_init((void*)fill_state.data_pos, data, length) == 0) ? (int)sizeof(BORROWED_BINARY) : -1; \
+        } \
+        INTERNAL_LOG_CONTEXT_ADD_PROPERTY_VALUE_PAIR(property_name, &borrowed_binary_log_context_property_type, fill_result) \
+    } \
+
+#define EXPAND_SETUP_PROPERTY_PAIR_LOG_CONTEXT_ARRAY_PROPERTY(element_type, property_name, values, count) \
+    /* Codes_SRS_LOG_CONTEXT_01_056: [ LOG_CONTEXT_ARRAY_PROPERTY shall expand to code that copies the count and the count values at values in the context data area by calling LOG_CONTEXT_PROPERTY_TYPE_FILL({element_type}_array). ]*/ \
+    fill_result = element_type##_array_log_context_property_type_fill(fill_state.data_pos, (size_t)(fill_state.data_end - fill_state.data_pos), values, count); \
+    if ((fill_result > fill_state.data_end - fill_state.data_pos) && (internal_log_context_reserve(&fill_state, (uint32_t)fill_result) == 0)) \
+    { \
+        fill_result = element_type##_array_log_context_property_type_fill(fill_state.data_pos, (size_t)(fill_state.data_end - fill_state.data_pos), values, count); \
+    } \
+    /* Codes_SRS_LOG_CONTEXT_01_055: [ LOG_CONTEXT_ARRAY_PROPERTY shall expand to code allocating a property/value pair of type {element_type}_array and the name property_name. ]*/ \
+    INTERNAL_LOG_CONTEXT_ADD_PROPERTY_VALUE_PAIR(property_name, &element_type##_array_log_context_property_type, fill_result) \
 
 #define EXPAND_SETUP_PROPERTY_PAIR_LOG_CONTEXT_NAME(log_context_name) \
     /* Codes_SRS_LOG_CONTEXT_01_012: [ The name of the struct property shall be the context name specified by using LOG_CONTEXT_NAME (if specified). ]*/ \
     /* Codes_SRS_LOG_CONTEXT_01_017: [ The name of the struct property shall be the context name specified by using LOG_CONTEXT_NAME (if specified). ]*/ \
-    first_property_value_pair->name = MU_TOSTRING(log_context_name); \
+    fill_state.log_context->property_value_pairs_ptr[0].name = MU_TOSTRING(log_context_name); \
 
 #define EXPAND_SETUP_PROPERTY_PAIR_LOG_CONTEXT_PROPERTY(property_type, property_name, field_value) \
+    if ((fill_state.data_end - fill_state.data_pos >= (ptrdiff_t)sizeof(property_type)) || (internal_log_context_reserve(&fill_state, sizeof(property_type)) == 0)) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_01_005: [ LOG_CONTEXT_PROPERTY shall expand to code copying the value property_value to be the value of the property/value pair. ]*/ \
+        (void)property_type##_log_context_property_type_init((void*)fill_state.data_pos, field_value); \
+    } \
     /* Codes_SRS_LOG_CONTEXT_01_004: [ LOG_CONTEXT_PROPERTY shall expand to code allocating a property/value pair entry with the type property_type and the name property_name. ]*/ \
-    property_value_pair->value = data_pos; \
-    property_value_pair->name = MU_TOSTRING(property_name); \
-    property_value_pair->type = &property_type##_log_context_property_type; \
-    /* Codes_SRS_LOG_CONTEXT_01_005: [ LOG_CONTEXT_PROPERTY shall expand to code copying the value property_value to be the value of the property/value pair. ]*/ \
-    (void)property_type##_log_context_property_type_init((void*)data_pos, field_value); \
-    data_pos += sizeof(property_type); \
-    property_value_pair++; \
+    INTERNAL_LOG_CONTEXT_ADD_PROPERTY_VALUE_PAIR(property_name, &property_type##_log_context_property_type, (int)sizeof(property_type)) \
 
 #define EXPAND_SETUP_PROPERTY_PAIR_LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION(property_type, property_name, value_function, ...) \
-    /* Codes_SRS_LOG_CONTEXT_01_027: [ LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code allocating a property/value pair entry with the type property_type and the name property_name. ]*/ \
-    property_value_pair->value = data_pos; \
-    property_value_pair->name = MU_TOSTRING(property_name); \
-    property_value_pair->type = &property_type##_log_context_property_type; \
     /* Codes_SRS_LOG_CONTEXT_01_029: [ LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code filling the property value by calling value_function. ]*/ \
-    data_pos += value_function((void*)data_pos, __VA_ARGS__); \
-    property_value_pair++; \
+    /* Codes_SRS_LOG_CONTEXT_01_028: [ LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code that calls value_function passing to it the space left in the context data area and its size, so that a value that fits is produced with a single call. ] */ \
+    fill_result = value_function((void*)fill_state.data_pos, (size_t)(fill_state.data_end - fill_state.data_pos), __VA_ARGS__); \
+    /* Codes_SRS_LOG_CONTEXT_01_033: [ If value_function indicates that it needs more memory than the space left, LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code that calls internal_log_context_reserve to make room for the value and calls value_function again. ] */ \
+    if ((fill_result > fill_state.data_end - fill_state.data_pos) && (internal_log_context_reserve(&fill_state, (uint32_t)fill_result) == 0)) \
+    { \
+        fill_result = value_function((void*)fill_state.data_pos, (size_t)(fill_state.data_end - fill_state.data_pos), __VA_ARGS__); \
+    } \
+    /* Codes_SRS_LOG_CONTEXT_01_027: [ LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code allocating a property/value pair entry with the type property_type and the name property_name. ]*/ \
+    INTERNAL_LOG_CONTEXT_ADD_PROPERTY_VALUE_PAIR(property_name, &property_type##_log_context_property_type, fill_result) \
 
 #define SETUP_PROPERTY_PAIR(field_desc) \
     MU_C2(EXPAND_SETUP_PROPERTY_PAIR_, field_desc)
@@ -163,6 +307,18 @@ uint32_t internal_log_context_get_values_data_length_or_zero(LOG_CONTEXT_HANDLE
 #define EXPAND_COUNT_PROPERTY_LOG_CONTEXT_WSTRING_PROPERTY(property_name, ...) \
     + 1
 
+#define EXPAND_COUNT_PROPERTY_LOG_CONTEXT_BORROWED_STRING_PROPERTY(property_name, value) \
+    + 1
+
+#define EXPAND_COUNT_PROPERTY_LOG_CONTEXT_BINARY_PROPERTY(property_name, data, length) \
+    + 1
+
+#define EXPAND_COUNT_PROPERTY_LOG_CONTEXT_BORROWED_BINARY_PROPERTY(property_name, data, length) \
+    + 1
+
+#define EXPAND_COUNT_PROPERTY_LOG_CONTEXT_ARRAY_PROPERTY(element_type, property_name, values, count) \
+    + 1
+
 #define EXPAND_COUNT_PROPERTY_LOG_CONTEXT_NAME(log_context_name) \
 
 #define EXPAND_COUNT_PROPERTY_LOG_CONTEXT_PROPERTY(property_type, property_name, field_value) \
@@ -176,14 +332,25 @@ uint32_t internal_log_context_get_values_data_length_or_zero(LOG_CONTEXT_HANDLE
 
 // COUNT_DATA_BYTES
 
+// counts the bytes needed by the properties whose size is known before producing the value
+
 #define EXPAND_COUNT_DATA_BYTES_LOG_MESSAGE(...) \
 
-// ... here is expected to be (format, ...) for a printf invocation
 #define EXPAND_COUNT_DATA_BYTES_LOG_CONTEXT_STRING_PROPERTY(property_name, ...) \
-    + ascii_char_ptr_log_context_property_type_get_init_data_size(__VA_ARGS__)
 
 #define EXPAND_COUNT_DATA_BYTES_LOG_CONTEXT_WSTRING_PROPERTY(property_name, ...) \
-    + wchar_t_ptr_log_context_property_type_get_init_data_size(__VA_ARGS__)
+
+#define EXPAND_COUNT_DATA_BYTES_LOG_CONTEXT_BORROWED_STRING_PROPERTY(property_name, value) \
+    + borrowed_ascii_char_ptr_log_context_property_type_get_init_data_size()
+
+#define EXPAND_COUNT_DATA_BYTES_LOG_CONTEXT_BINARY_PROPERTY(property_name, data, length) \
+    + binary_log_context_property_type_get_init_data_size(length)
+
+#define EXPAND_COUNT_DATA_BYTES_LOG_CONTEXT_BORROWED_BINARY_PROPERTY(property_name, data, length) \
+    + borrowed_binary_log_context_property_type_get_init_data_size()
+
+#define EXPAND_COUNT_DATA_BYTES_LOG_CONTEXT_ARRAY_PROPERTY(element_type, property_name, values, count) \
+    + element_type##_array_log_context_property_type_get_init_data_size(count)
 
 #define EXPAND_COUNT_DATA_BYTES_LOG_CONTEXT_NAME(log_context_name) \
 
@@ -191,12 +358,43 @@ uint32_t internal_log_context_get_values_data_length_or_zero(LOG_CONTEXT_HANDLE
     + property_type##_log_context_property_type_get_init_data_size()
 
 #define EXPAND_COUNT_DATA_BYTES_LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION(property_type, property_name, value_function, ...) \
-    /* Codes_SRS_LOG_CONTEXT_01_028: [ LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code that calls value_function with NULL in order to determine how much memory shall be reserved for the property. ] */ \
-    + value_function(NULL, __VA_ARGS__)
 
 #define COUNT_DATA_BYTES(field_desc) \
     MU_C2(EXPAND_COUNT_DATA_BYTES_, field_desc)
 
+// COUNT_SLACK_BYTES
+
+// counts the bytes reserved up front for the properties whose size is only known once the value is produced
+
+#define EXPAND_COUNT_SLACK_BYTES_LOG_MESSAGE(...) \
+
+#define EXPAND_COUNT_SLACK_BYTES_LOG_CONTEXT_STRING_PROPERTY(property_name, ...) \
+    + LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE
+
+// wchar_t strings get room for as many characters as the other strings
+#define EXPAND_COUNT_SLACK_BYTES_LOG_CONTEXT_WSTRING_PROPERTY(property_name, ...) \
+    + (uint32_t)(LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE * sizeof(wchar_t))
+
+#define EXPAND_COUNT_SLACK_BYTES_LOG_CONTEXT_BORROWED_STRING_PROPERTY(property_name, value) \
+    + LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE
+
+#define EXPAND_COUNT_SLACK_BYTES_LOG_CONTEXT_BINARY_PROPERTY(property_name, data, length) \
+
+#define EXPAND_COUNT_SLACK_BYTES_LOG_CONTEXT_BORROWED_BINARY_PROPERTY(property_name, data, length) \
+    + LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE
+
+#define EXPAND_COUNT_SLACK_BYTES_LOG_CONTEXT_ARRAY_PROPERTY(element_type, property_name, values, count) \
+
+#define EXPAND_COUNT_SLACK_BYTES_LOG_CONTEXT_NAME(log_context_name) \
+
+#define EXPAND_COUNT_SLACK_BYTES_LOG_CONTEXT_PROPERTY(property_type, property_name, field_value) \
+
+#define EXPAND_COUNT_SLACK_BYTES_LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION(property_type, property_name, value_function, ...) \
+    + LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE
+
+#define COUNT_SLACK_BYTES(field_desc) \
+    MU_C2(EXPAND_COUNT_SLACK_BYTES_, field_desc)
+
 // Macro that can be used to create a context on the stack
 // We allocate on the stack enough space for a max payload for the context.
 #define LOG_CONTEXT_LOCAL_DEFINE(destination_context, parent_context, ...) \
@@ -228,47 +426,86 @@ uint32_t internal_log_context_get_values_data_length_or_zero(LOG_CONTEXT_HANDLE
         } \
         else \
         { \
+            LOG_CONTEXT_FILL_STATE fill_state; \
+            int fill_result; \
+            (void)fill_result; \
             /* Codes_SRS_LOG_CONTEXT_01_018: [ If parent_context is non-NULL, the created context shall copy all the property/value pairs of parent_context. ]*/ \
             internal_log_context_init_from_parent(&destination_context, parent_context); \
-            LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pair = destination_context.property_value_pairs_ptr + log_context_get_property_value_pair_count(parent_context) + 1; \
-            LOG_CONTEXT_PROPERTY_VALUE_PAIR* first_property_value_pair = destination_context.property_value_pairs_ptr; \
-            (void)property_value_pair; \
-            uint8_t* data_pos = destination_context.values_data; \
-            *data_pos = (uint8_t)((parent_context != NULL ? 1 : 0) MU_IF(MU_COUNT_ARG(__VA_ARGS__), MU_FOR_EACH_1(COUNT_PROPERTY, __VA_ARGS__),)); \
+            fill_state.log_context = &destination_context; \
+            fill_state.property_value_pair = destination_context.property_value_pairs_ptr + log_context_get_property_value_pair_count(parent_context) + 1; \
+            fill_state.data_pos = destination_context.values_data; \
+            fill_state.data_end = destination_context.values_data + LOG_MAX_STACK_DATA_SIZE; \
+            fill_state.can_grow = false; \
+            fill_state.failed = false; \
+            *fill_state.data_pos = (uint8_t)((parent_context != NULL ? 1 : 0) MU_IF(MU_COUNT_ARG(__VA_ARGS__), MU_FOR_EACH_1(COUNT_PROPERTY, __VA_ARGS__),)); \
             /* Codes_SRS_LOG_CONTEXT_01_015: [ LOG_CONTEXT_LOCAL_DEFINE shall store one property/value pair that with a property type of struct with as many fields as the total number of properties passed to LOG_CONTEXT_LOCAL_DEFINE in the ... arguments. ]*/ \
-            first_property_value_pair->value = data_pos; \
-            first_property_value_pair->name = ""; \
-            first_property_value_pair->type = &struct_log_context_property_type; \
-            data_pos += 1 + internal_log_context_get_values_data_length_or_zero(parent_context); \
+            destination_context.property_value_pairs_ptr[0].value = fill_state.data_pos; \
+            destination_context.property_value_pairs_ptr[0].name = ""; \
+            destination_context.property_value_pairs_ptr[0].type = &struct_log_context_property_type; \
+            fill_state.data_pos += 1 + internal_log_context_get_values_data_length_or_zero(parent_context); \
             /* Codes_SRS_LOG_CONTEXT_01_016: [ LOG_CONTEXT_LOCAL_DEFINE shall store the property types and values specified by using LOG_CONTEXT_PROPERTY in the context. ]*/ \
             MU_IF(MU_COUNT_ARG(__VA_ARGS__), MU_FOR_EACH_1(SETUP_PROPERTY_PAIR, __VA_ARGS__),) \
+            if (fill_state.failed) \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_01_025: [ If the memory size needed for all properties to be stored in the context exceeds LOG_MAX_STACK_DATA_SIZE, an error shall be reported by calling log_internal_error_report and no properties shall be stored in the context. ]*/ \
+                destination_context.property_value_pair_count = 0; \
+                destination_context.values_data_length = 0; \
+                log_internal_error_report(); \
+            } \
+            else \
+            { \
+                destination_context.values_data_length = (uint32_t)(fill_state.data_pos - destination_context.values_data); \
+            } \
         } \
     } \
 
-LOG_CONTEXT_HANDLE log_context_create(LOG_CONTEXT_HANDLE parent_context, uint32_t properties_count, uint32_t data_size);
+// data_size is the size of the struct field count and of the values added on top of parent_context, the bytes needed to copy the pairs of parent_context are added to it
+// parent_data_length (optional) receives the number of bytes taken by the copy of the pairs of parent_context, right after the struct field count
+LOG_CONTEXT_HANDLE log_context_create(LOG_CONTEXT_HANDLE parent_context, uint32_t properties_count, uint32_t data_size, uint32_t* parent_data_length);
 void log_context_destroy(LOG_CONTEXT_HANDLE log_context);
 
 // macro that can be used to create a dynamically allocated context
 #define LOG_CONTEXT_CREATE(destination_context, parent_context, ...) \
     { \
-        destination_context = log_context_create(parent_context, log_context_get_property_value_pair_count(parent_context) + 1 /* 1 extra property entry for struct entry with the context name and property count */ MU_IF(MU_COUNT_ARG(__VA_ARGS__), MU_FOR_EACH_1(COUNT_PROPERTY, __VA_ARGS__),), internal_log_context_get_values_data_length_or_zero(parent_context) + 1 /* 1 byte for the number of fields in the struct */ MU_IF(MU_COUNT_ARG(__VA_ARGS__), MU_FOR_EACH_1(COUNT_DATA_BYTES, __VA_ARGS__),)); \
+        /* Codes_SRS_LOG_CONTEXT_01_034: [ LOG_CONTEXT_CREATE shall reserve LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE bytes for each property whose value size is only known once the value is produced. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_07_005: [ LOG_CONTEXT_CREATE shall reserve LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE * sizeof(wchar_t) bytes for each LOG_CONTEXT_WSTRING_PROPERTY. ]*/ \
+        uint32_t log_context_create_parent_data_length; \
+        destination_context = log_context_create(parent_context, log_context_get_property_value_pair_count(parent_context) + 1 /* 1 extra property entry for struct entry with the context name and property count */ MU_IF(MU_COUNT_ARG(__VA_ARGS__), MU_FOR_EACH_1(COUNT_PROPERTY, __VA_ARGS__),), 1 /* 1 byte for the number of fields in the struct */ MU_IF(MU_COUNT_ARG(__VA_ARGS__), MU_FOR_EACH_1(COUNT_DATA_BYTES, __VA_ARGS__) MU_FOR_EACH_1(COUNT_SLACK_BYTES, __VA_ARGS__),), &log_context_create_parent_data_length); \
         MU_IF(MU_COUNT_ARG(__VA_ARGS__), LOG_CONTEXT_CHECK_VARIABLE_ARGS(__VA_ARGS__),) \
         if (destination_context != NULL) \
         { \
-            /* Codes_SRS_LOG_CONTEXT_01_003: [ LOG_CONTEXT_CREATE shall store the property types and values specified by using LOG_CONTEXT_PROPERTY in the context. ]*/ \
-            LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pair = destination_context->property_value_pairs_ptr + log_context_get_property_value_pair_count(parent_context) + 1; \
-            LOG_CONTEXT_PROPERTY_VALUE_PAIR* first_property_value_pair = destination_context->property_value_pairs_ptr; \
-            (void)property_value_pair; \
-            uint8_t* data_pos = destination_context->values_data; \
-            *data_pos = (uint8_t)((parent_context != NULL ? 1 : 0) MU_IF(MU_COUNT_ARG(__VA_ARGS__), MU_FOR_EACH_1(COUNT_PROPERTY, __VA_ARGS__),)); \
+            LOG_CONTEXT_FILL_STATE fill_state; \
+            int fill_result; \
+            (void)fill_result; \
+            fill_state.log_context = destination_context; \
+            fill_state.property_value_pair = destination_context->property_value_pairs_ptr + log_context_get_property_value_pair_count(parent_context) + 1; \
+            fill_state.data_pos = destination_context->values_data; \
+            fill_state.data_end = destination_context->values_data + destination_context->values_data_length; \
+            fill_state.can_grow = true; \
+            fill_state.failed = false; \
+            *fill_state.data_pos = (uint8_t)((parent_context != NULL ? 1 : 0) MU_IF(MU_COUNT_ARG(__VA_ARGS__), MU_FOR_EACH_1(COUNT_PROPERTY, __VA_ARGS__),)); \
             /* Codes_SRS_LOG_CONTEXT_01_013: [ LOG_CONTEXT_CREATE shall store one property/value pair that with a property type of struct with as many fields as the total number of properties passed to LOG_CONTEXT_CREATE. ]*/ \
-            first_property_value_pair->value = data_pos; \
+            destination_context->property_value_pairs_ptr[0].value = fill_state.data_pos; \
             /* Codes_SRS_LOG_CONTEXT_01_009: [ LOG_CONTEXT_NAME shall be optional. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_01_010: [** If LOG_CONTEXT_NAME is not used the name for the context shall be empty string. ]*/ \
-            first_property_value_pair->name = ""; \
-            first_property_value_pair->type = &struct_log_context_property_type; \
-            data_pos += 1 + internal_log_context_get_values_data_length_or_zero(parent_context); \
+            destination_context->property_value_pairs_ptr[0].name = ""; \
+            destination_context->property_value_pairs_ptr[0].type = &struct_log_context_property_type; \
+            fill_state.data_pos += 1 + log_context_create_parent_data_length; \
+            /* Codes_SRS_LOG_CONTEXT_01_003: [ LOG_CONTEXT_CREATE shall store the property types and values specified by using LOG_CONTEXT_PROPERTY in the context. ]*/ \
             MU_IF(MU_COUNT_ARG(__VA_ARGS__), MU_FOR_EACH_1(SETUP_PROPERTY_PAIR, __VA_ARGS__),) \
+            /* the context might have been reallocated in order to make room for values */ \
+            destination_context = fill_state.log_context; \
+            if (fill_state.failed) \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_01_002: [ If any error occurs, LOG_CONTEXT_CREATE shall fail and return NULL. ]*/ \
+                log_context_destroy(destination_context); \
+                destination_context = NULL; \
+            } \
+            else \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_01_035: [ LOG_CONTEXT_CREATE shall set the values data length of the context to the number of bytes actually used by the property values. ]*/ \
+                destination_context->values_data_length = (uint32_t)(fill_state.data_pos - destination_context->values_data); \
+            } \
         } \
     } \
 
@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef LOG_CONTEXT_AMBIENT_H
+#define LOG_CONTEXT_AMBIENT_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context.h"
+#include "c_logging/log_context_property_value_pair.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// maximum number of contexts that can be pushed at the same time on the ambient context stack of a thread
+#define LOG_CONTEXT_AMBIENT_MAX_DEPTH               16
+
+// maximum number of property/value pairs of the view that merges the ambient context with the context passed to the logger
+#define LOG_CONTEXT_AMBIENT_MAX_MERGED_PAIR_COUNT   (2 * LOG_MAX_STACK_PROPERTY_VALUE_PAIR_COUNT + 1)
+
+int log_context_ambient_push(LOG_CONTEXT_HANDLE log_context);
+void log_context_ambient_pop(LOG_CONTEXT_HANDLE log_context);
+LOG_CONTEXT_HANDLE log_context_ambient_get(void);
+
+// These is an internal API and it is not meant to be called by the users of this module
+// merged_property_value_pairs must have room for internal_log_context_ambient_get_merged_pair_count(log_context) pairs
+uint32_t internal_log_context_ambient_get_merged_pair_count(LOG_CONTEXT_HANDLE log_context);
+LOG_CONTEXT_HANDLE internal_log_context_ambient_merge(LOG_CONTEXT_HANDLE log_context, LOG_CONTEXT* merged_log_context, LOG_CONTEXT_PROPERTY_VALUE_PAIR* merged_property_value_pairs);
+
+// Makes log_context the ambient context of the current thread until LOG_CONTEXT_AMBIENT_POP(scope_name) and declares scope_name, which holds the pushed context (NULL if the push failed).
+// log_context is evaluated once. The pop is an explicit statement: every path out of the scope has to go through it (single exit),
+// otherwise the stack of the thread keeps the context after it went out of scope and later log calls on the thread use it.
+#define LOG_CONTEXT_AMBIENT_PUSH(scope_name, log_context) \
+    /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_015: [ LOG_CONTEXT_AMBIENT_PUSH shall evaluate log_context once, store it in a LOG_CONTEXT_HANDLE variable named scope_name and call log_context_ambient_push with it. ]*/ \
+    LOG_CONTEXT_HANDLE scope_name = (log_context); \
+    if (log_context_ambient_push(scope_name) != 0) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_016: [ If log_context_ambient_push fails, LOG_CONTEXT_AMBIENT_PUSH shall set scope_name to NULL. ]*/ \
+        scope_name = NULL; \
+    } \
+
+#define LOG_CONTEXT_AMBIENT_POP(scope_name) \
+    do \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_017: [ If scope_name is not NULL, LOG_CONTEXT_AMBIENT_POP shall call log_context_ambient_pop with scope_name and set scope_name to NULL. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_020: [ If scope_name is NULL, LOG_CONTEXT_AMBIENT_POP shall not call log_context_ambient_pop. ]*/ \
+        if ((scope_name) != NULL) \
+        { \
+            log_context_ambient_pop(scope_name); \
+            (scope_name) = NULL; \
+        } \
+    } while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_CONTEXT_AMBIENT_H */
@@ -0,0 +1,53 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef LOG_CONTEXT_BUILDER_H
+#define LOG_CONTEXT_BUILDER_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdbool.h>
+#include <stdint.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context.h"
+#include "c_logging/log_context_property_type_if.h"
+#include "c_logging/log_context_property_basic_types.h"
+#include "c_logging/log_context_property_bool_type.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct LOG_CONTEXT_BUILDER_TAG* LOG_CONTEXT_BUILDER_HANDLE;
+
+// produces the name of the builder function that appends a property of type type_name, for example log_context_builder_add_int32_t
+#define LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name) \
+    MU_C2(log_context_builder_add_, type_name)
+
+#define LOG_CONTEXT_BUILDER_SUPPORTED_TYPES \
+    SUPPORTED_BASIC_TYPES, \
+    bool
+
+#define DECLARE_LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name) \
+    int LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name)(LOG_CONTEXT_BUILDER_HANDLE log_context_builder, const char* property_name, type_name value); \
+
+LOG_CONTEXT_BUILDER_HANDLE log_context_builder_create(void);
+void log_context_builder_destroy(LOG_CONTEXT_BUILDER_HANDLE log_context_builder);
+
+void log_context_builder_reset(LOG_CONTEXT_BUILDER_HANDLE log_context_builder);
+int log_context_builder_set_name(LOG_CONTEXT_BUILDER_HANDLE log_context_builder, const char* log_context_name);
+int log_context_builder_add_property(LOG_CONTEXT_BUILDER_HANDLE log_context_builder, const char* property_name, const LOG_CONTEXT_PROPERTY_TYPE_IF* property_type, const void* property_value, uint32_t property_value_size);
+int log_context_builder_add_string_property(LOG_CONTEXT_BUILDER_HANDLE log_context_builder, const char* property_name, const char* format, ...);
+MU_FOR_EACH_1(DECLARE_LOG_CONTEXT_BUILDER_ADD_PROPERTY, LOG_CONTEXT_BUILDER_SUPPORTED_TYPES)
+
+LOG_CONTEXT_HANDLE log_context_builder_freeze(LOG_CONTEXT_BUILDER_HANDLE log_context_builder, LOG_CONTEXT_HANDLE parent_context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_CONTEXT_BUILDER_H */
@@ -24,7 +24,9 @@
     int16_t, \
     uint16_t, \
     int8_t, \
-    uint8_t
+    uint8_t, \
+    float, \
+    double
 
 #define DECLARE_BASIC_TYPE(type_name) \
     int LOG_CONTEXT_PROPERTY_TYPE_INIT(type_name)(void* dst_value, type_name src_value); \
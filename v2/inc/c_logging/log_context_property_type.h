@@ -17,8 +17,28 @@
     LOG_CONTEXT_PROPERTY_TYPE_uint16_t, \
     LOG_CONTEXT_PROPERTY_TYPE_int8_t, \
     LOG_CONTEXT_PROPERTY_TYPE_uint8_t, \
+    LOG_CONTEXT_PROPERTY_TYPE_float, \
+    LOG_CONTEXT_PROPERTY_TYPE_double, \
     LOG_CONTEXT_PROPERTY_TYPE_struct, \
-    LOG_CONTEXT_PROPERTY_TYPE_wchar_t_ptr \
+    LOG_CONTEXT_PROPERTY_TYPE_wchar_t_ptr, \
+    LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr, \
+    LOG_CONTEXT_PROPERTY_TYPE_binary, \
+    LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary, \
+    LOG_CONTEXT_PROPERTY_TYPE_log_uuid_t, \
+    LOG_CONTEXT_PROPERTY_TYPE_log_ipv4_address_t, \
+    LOG_CONTEXT_PROPERTY_TYPE_log_ipv6_address_t, \
+    LOG_CONTEXT_PROPERTY_TYPE_log_socket_address_t, \
+    LOG_CONTEXT_PROPERTY_TYPE_enum, \
+    LOG_CONTEXT_PROPERTY_TYPE_log_timestamp_t, \
+    LOG_CONTEXT_PROPERTY_TYPE_log_duration_t, \
+    LOG_CONTEXT_PROPERTY_TYPE_int64_t_array, \
+    LOG_CONTEXT_PROPERTY_TYPE_uint64_t_array, \
+    LOG_CONTEXT_PROPERTY_TYPE_int32_t_array, \
+    LOG_CONTEXT_PROPERTY_TYPE_uint32_t_array, \
+    LOG_CONTEXT_PROPERTY_TYPE_int16_t_array, \
+    LOG_CONTEXT_PROPERTY_TYPE_uint16_t_array, \
+    LOG_CONTEXT_PROPERTY_TYPE_int8_t_array, \
+    LOG_CONTEXT_PROPERTY_TYPE_uint8_t_array \
 
 MU_DEFINE_ENUM(LOG_CONTEXT_PROPERTY_TYPE, LOG_CONTEXT_PROPERTY_TYPE_VALUES)
 
@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef LOG_CONTEXT_PROPERTY_TYPE_ARRAY_H
+#define LOG_CONTEXT_PROPERTY_TYPE_ARRAY_H
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context_property_type_if.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Array types, one per integer type, used with LOG_CONTEXT_ARRAY_PROPERTY:
+// LOG_CONTEXT_ARRAY_PROPERTY(uint32_t, shard_ids, shard_ids, shard_count)
+//
+// The property type of an array of int32_t is int32_t_array (LOG_CONTEXT_PROPERTY_TYPE_int32_t_array), and so on.
+// Text sinks render the values as [1,2,3], binary sinks (ETW) emit a counted array of the element type.
+
+#define SUPPORTED_ARRAY_ELEMENT_TYPES \
+    int64_t, \
+    uint64_t, \
+    int32_t, \
+    uint32_t, \
+    int16_t, \
+    uint16_t, \
+    int8_t, \
+    uint8_t
+
+// the number of values is stored on 16 bits, which is also the limit of an ETW variable count array
+#define LOG_CONTEXT_ARRAY_MAX_COUNT UINT16_MAX
+
+// the value of an array property is the count as a uint16_t followed by the values (not aligned, read them with memcpy)
+
+#define DECLARE_ARRAY_TYPE(element_type) \
+    int LOG_CONTEXT_PROPERTY_TYPE_INIT(element_type##_array)(void* dst_value, const element_type* values, size_t count); \
+    int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(element_type##_array)(size_t count); \
+    int LOG_CONTEXT_PROPERTY_TYPE_FILL(element_type##_array)(void* dst_value, size_t dst_size, const element_type* values, size_t count); \
+    extern const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(element_type##_array); \
+
+MU_FOR_EACH_1(DECLARE_ARRAY_TYPE, SUPPORTED_ARRAY_ELEMENT_TYPES)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_CONTEXT_PROPERTY_TYPE_ARRAY_H */
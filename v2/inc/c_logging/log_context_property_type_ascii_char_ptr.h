@@ -12,6 +12,7 @@ extern "C" {
 
 int LOG_CONTEXT_PROPERTY_TYPE_INIT(ascii_char_ptr)(void* dst_value, const char* format, ...);
 int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(ascii_char_ptr)(const char* format, ...);
+int LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr)(void* dst_value, size_t dst_size, const char* format, ...);
 
 extern const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr);
 
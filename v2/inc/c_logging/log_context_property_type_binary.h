@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef LOG_CONTEXT_PROPERTY_TYPE_BINARY_H
+#define LOG_CONTEXT_PROPERTY_TYPE_BINARY_H
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#endif
+
+#include "c_logging/log_context_property_type_if.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// the length of a binary value is stored on 16 bits, which is also the limit of an ETW binary field
+#define LOG_CONTEXT_BINARY_MAX_LENGTH UINT16_MAX
+
+// the value of a binary property is the length as a uint16_t followed by the bytes (not aligned, read the length with memcpy)
+
+// the value of a borrowed_binary property: the bytes are not copied in the context, they have to outlive every context that borrows them
+typedef struct BORROWED_BINARY_TAG
+{
+    const void* data;
+    uint16_t length;
+} BORROWED_BINARY;
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(void* dst_value, const void* data, size_t length);
+int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(binary)(size_t length);
+int LOG_CONTEXT_PROPERTY_TYPE_FILL(binary)(void* dst_value, size_t dst_size, const void* data, size_t length);
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary)(void* dst_value, const void* data, size_t length);
+int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(borrowed_binary)(void);
+
+extern const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary);
+extern const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_CONTEXT_PROPERTY_TYPE_BINARY_H */
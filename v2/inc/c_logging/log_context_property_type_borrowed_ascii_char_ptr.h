@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_H
+#define LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_H
+
+#ifdef __cplusplus
+#include <cstddef>
+#else
+#include <stddef.h>
+#endif
+
+#include "c_logging/log_context_property_type_if.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// the value of a borrowed_ascii_char_ptr property: the string itself is not copied in the context,
+// it has to outlive every context that borrows it (string literals, interned names, static state names)
+typedef struct BORROWED_ASCII_CHAR_PTR_TAG
+{
+    const char* value;
+    size_t length;
+} BORROWED_ASCII_CHAR_PTR;
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr)(void* dst_value, const char* value);
+int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(borrowed_ascii_char_ptr)(void);
+
+// copies the string as an ascii_char_ptr value, used when the property is promoted to a dynamically allocated context
+int LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr)(void* dst_value, size_t dst_size, const char* value);
+
+extern const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_H */
@@ -0,0 +1,97 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef LOG_CONTEXT_PROPERTY_TYPE_ENUM_H
+#define LOG_CONTEXT_PROPERTY_TYPE_ENUM_H
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Enum property types, one per enum defined with MU_DEFINE_ENUM (or MU_DEFINE_ENUM_WITHOUT_INVALID):
+//
+// next to MU_DEFINE_ENUM (in a header):
+//     LOG_CONTEXT_PROPERTY_ENUM_TYPE_DECLARE(MY_STATE)
+// next to MU_DEFINE_ENUM_STRINGS (in one .c file):
+//     LOG_CONTEXT_PROPERTY_ENUM_TYPE_DEFINE(MY_STATE)
+// and then:
+//     LOG_CONTEXT_PROPERTY(MY_STATE, state, my_state)
+//
+// The value is stored as an int32_t. The enum strings are reached through the property type (no per property pointer)
+// and are looked up only when the property is rendered as text ("MY_STATE_RUNNING (1)", as PRI_MU_ENUM/MU_ENUM_VALUE).
+// Binary sinks see LOG_CONTEXT_PROPERTY_TYPE_enum and emit the integer. Code that only has the property type (and not
+// the enum definition) gets the string of a value with enum_value_to_string of the interface.
+
+int log_context_property_type_enum_to_string(const void* property_value, LOG_CONTEXT_PROPERTY_TYPE_ENUM_VALUE_TO_STRING value_to_string, char* buffer, size_t buffer_length);
+int log_context_property_type_enum_init(void* dst_value, int32_t value);
+int log_context_property_type_enum_copy(void* dst_value, const void* src_value);
+void log_context_property_type_enum_free(void* value);
+LOG_CONTEXT_PROPERTY_TYPE log_context_property_type_enum_get_type(void);
+int log_context_property_type_enum_get_size(const void* property_value);
+int log_context_property_type_enum_serialize(const void* property_value, void* buffer, size_t buffer_size);
+int log_context_property_type_enum_deserialize(void* dst_value, size_t dst_size, const void* buffer, size_t buffer_size);
+
+#define LOG_CONTEXT_PROPERTY_ENUM_TYPE_DECLARE(enum_type) \
+    int LOG_CONTEXT_PROPERTY_TYPE_INIT(enum_type)(void* dst_value, enum_type value); \
+    int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(enum_type)(void); \
+    extern const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(enum_type); \
+
+#define LOG_CONTEXT_PROPERTY_ENUM_TYPE_DEFINE(enum_type) \
+    LOG_CONTEXT_PROPERTY_ENUM_TYPE_DECLARE(enum_type) \
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_001: [ LOG_CONTEXT_PROPERTY_ENUM_TYPE_DEFINE shall not compile if the size of enum_type is not the size of an int32_t. ]*/ \
+    typedef char MU_C2(enum_type, _log_context_property_type_must_be_32_bits)[(sizeof(enum_type) == sizeof(int32_t)) ? 1 : -1]; \
+    static const char* MU_C2(enum_type, _log_context_property_type_value_to_string)(int32_t value) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_002: [ The enum strings shall be obtained by calling MU_ENUM_TO_STRING with enum_type and the stored value. ]*/ \
+        return MU_ENUM_TO_STRING(enum_type, (enum_type)value); \
+    } \
+    static int MU_C2(enum_type, _log_context_property_type_to_string)(const void* property_value, char* buffer, size_t buffer_length) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(enum_type).to_string shall call log_context_property_type_enum_to_string with the enum strings of enum_type and return its result. ]*/ \
+        return log_context_property_type_enum_to_string(property_value, MU_C2(enum_type, _log_context_property_type_value_to_string), buffer, buffer_length); \
+    } \
+    int LOG_CONTEXT_PROPERTY_TYPE_INIT(enum_type)(void* dst_value, enum_type value) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_004: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(enum_type) shall call log_context_property_type_enum_init with dst_value and value and return its result. ]*/ \
+        return log_context_property_type_enum_init(dst_value, (int32_t)value); \
+    } \
+    int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(enum_type)(void) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_005: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(enum_type) shall return sizeof(int32_t). ]*/ \
+        return (int)sizeof(int32_t); \
+    } \
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_006: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(enum_type) shall use log_context_property_type_enum_copy, log_context_property_type_enum_free and log_context_property_type_enum_get_type as copy, free and get_type. ]*/ \
+    const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(enum_type) = \
+    { \
+        .to_string = MU_C2(enum_type, _log_context_property_type_to_string), \
+        .copy = log_context_property_type_enum_copy, \
+        .free = log_context_property_type_enum_free, \
+        .get_type = log_context_property_type_enum_get_type, \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_036: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(enum_type) shall use log_context_property_type_enum_get_size, log_context_property_type_enum_serialize and log_context_property_type_enum_deserialize as get_size, serialize and deserialize. ]*/ \
+        .get_size = log_context_property_type_enum_get_size, \
+        .serialize = log_context_property_type_enum_serialize, \
+        .deserialize = log_context_property_type_enum_deserialize, \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_007: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(enum_type).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_enum. ]*/ \
+        .type_tag = LOG_CONTEXT_PROPERTY_TYPE_enum, \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_037: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(enum_type).enum_value_to_string shall return the enum string of enum_type for a value. ]*/ \
+        .enum_value_to_string = MU_C2(enum_type, _log_context_property_type_value_to_string) \
+    }; \
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_CONTEXT_PROPERTY_TYPE_ENUM_H */
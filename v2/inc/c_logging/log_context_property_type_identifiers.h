@@ -0,0 +1,79 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_H
+#define LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#endif
+
+#include "c_logging/log_context_property_type_if.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Fixed size identifier types, used with LOG_CONTEXT_PROPERTY:
+// LOG_CONTEXT_PROPERTY(log_uuid_t, activity_id, uuid_bytes)
+// LOG_CONTEXT_PROPERTY(log_ipv4_address_t, peer_ip, &sin.sin_addr)
+// LOG_CONTEXT_PROPERTY(log_ipv6_address_t, peer_ip, &sin6.sin6_addr)
+// LOG_CONTEXT_PROPERTY(log_socket_address_t, peer, &peer_sockaddr)
+
+// the UUID is passed in RFC 4122 byte order and stored in the GUID memory layout (the first 3 fields little endian),
+// so that it can be handed to ETW as a GUID field as is
+typedef struct LOG_UUID_TAG
+{
+    uint8_t bytes[16];
+} log_uuid_t;
+
+// network byte order
+typedef struct LOG_IPV4_ADDRESS_TAG
+{
+    uint8_t bytes[4];
+} log_ipv4_address_t;
+
+// network byte order
+typedef struct LOG_IPV6_ADDRESS_TAG
+{
+    uint8_t bytes[16];
+} log_ipv6_address_t;
+
+// size of the largest supported socket address (sockaddr_in6)
+#define LOG_SOCKET_ADDRESS_MAX_LENGTH 28
+
+// maximum number of characters produced for a socket address ("[ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff%4294967295]:65535"), without the zero terminator
+#define LOG_SOCKET_ADDRESS_TO_STRING_MAX_LENGTH 58
+
+// a copy of a sockaddr_in or sockaddr_in6, preceded by its size (the layout of an ETW binary field)
+// length is 0 if the address family is not supported
+typedef struct LOG_SOCKET_ADDRESS_TAG
+{
+    uint16_t length;
+    uint8_t bytes[LOG_SOCKET_ADDRESS_MAX_LENGTH];
+} log_socket_address_t;
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t)(void* dst_value, const void* uuid);
+int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(log_uuid_t)(void);
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv4_address_t)(void* dst_value, const void* address);
+int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(log_ipv4_address_t)(void);
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv6_address_t)(void* dst_value, const void* address);
+int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(log_ipv6_address_t)(void);
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t)(void* dst_value, const void* socket_address);
+int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(log_socket_address_t)(void);
+
+extern const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_uuid_t);
+extern const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv4_address_t);
+extern const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv6_address_t);
+extern const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_H */
@@ -5,8 +5,10 @@
 #define LOG_CONTEXT_PROPERTY_TYPE_IF_H
 
 #ifdef __cplusplus
+#include <cstdint>
 #include <cstdlib>
 #else
+#include <stdint.h>
 #include <stdlib.h>
 #endif
 
@@ -16,6 +18,10 @@ typedef int (*LOG_CONTEXT_PROPERTY_TYPE_TO_STRING)(const void* property_value, c
 typedef int (*LOG_CONTEXT_PROPERTY_TYPE_COPY)(void* dst_value, const void* src_value);
 typedef void (*LOG_CONTEXT_PROPERTY_TYPE_FREE)(void* value);
 typedef LOG_CONTEXT_PROPERTY_TYPE (*LOG_CONTEXT_PROPERTY_TYPE_GET_TYPE)(void);
+typedef int (*LOG_CONTEXT_PROPERTY_TYPE_GET_SIZE)(const void* property_value);
+typedef int (*LOG_CONTEXT_PROPERTY_TYPE_SERIALIZE)(const void* property_value, void* buffer, size_t buffer_size);
+typedef int (*LOG_CONTEXT_PROPERTY_TYPE_DESERIALIZE)(void* dst_value, size_t dst_size, const void* buffer, size_t buffer_size);
+typedef const char* (*LOG_CONTEXT_PROPERTY_TYPE_ENUM_VALUE_TO_STRING)(int32_t value);
 
 typedef struct LOG_CONTEXT_PROPERTY_TYPE_IF_TAG
 {
@@ -23,6 +29,15 @@ typedef struct LOG_CONTEXT_PROPERTY_TYPE_IF_TAG
     LOG_CONTEXT_PROPERTY_TYPE_COPY copy;
     LOG_CONTEXT_PROPERTY_TYPE_FREE free;
     LOG_CONTEXT_PROPERTY_TYPE_GET_TYPE get_type;
+    // size of the value as stored in a context (what copy writes)
+    LOG_CONTEXT_PROPERTY_TYPE_GET_SIZE get_size;
+    // self contained binary form of a value, for binary sinks and context snapshots
+    LOG_CONTEXT_PROPERTY_TYPE_SERIALIZE serialize;
+    LOG_CONTEXT_PROPERTY_TYPE_DESERIALIZE deserialize;
+    // same value as returned by get_type, stored as data so that renderers and encoders can switch on it without an indirect call
+    LOG_CONTEXT_PROPERTY_TYPE type_tag;
+    // enum string of a value, for code that only has the interface (decoders of serialized values); NULL for types other than enum types
+    LOG_CONTEXT_PROPERTY_TYPE_ENUM_VALUE_TO_STRING enum_value_to_string;
 } LOG_CONTEXT_PROPERTY_TYPE_IF;
 
 // a convenient macro for obtaining a certain type concrete implementation
@@ -39,4 +54,8 @@ typedef struct LOG_CONTEXT_PROPERTY_TYPE_IF_TAG
 #define LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(type_name) \
     MU_C2(type_name, _log_context_property_type_get_init_data_size)
 
+/* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IF_01_004: [ LOG_CONTEXT_PROPERTY_TYPE_FILL(type_name) shall produce the token {type_name}_log_context_property_type_fill. ]*/
+#define LOG_CONTEXT_PROPERTY_TYPE_FILL(type_name) \
+    MU_C2(type_name, _log_context_property_type_fill)
+
 #endif /* LOG_CONTEXT_PROPERTY_TYPE_IF_H */
@@ -0,0 +1,46 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef LOG_CONTEXT_PROPERTY_TYPE_TIME_H
+#define LOG_CONTEXT_PROPERTY_TYPE_TIME_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#include <ctime>
+#else
+#include <stdint.h>
+#include <time.h>
+#endif
+
+#include "c_logging/log_context_property_type_if.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Time types, used with LOG_CONTEXT_PROPERTY:
+// LOG_CONTEXT_PROPERTY(log_timestamp_t, deadline, log_timestamp_from_timespec(&deadline_ts))
+// LOG_CONTEXT_PROPERTY(log_duration_t, elapsed, end_ns - start_ns)
+
+// nanoseconds since 1970-01-01T00:00:00Z, rendered as ISO 8601 UTC ("2026-10-18T20:00:46.123456789Z")
+typedef int64_t log_timestamp_t;
+
+// nanoseconds, rendered in the largest unit that applies ("12.345ms", "1h02m03.456s")
+typedef int64_t log_duration_t;
+
+log_timestamp_t log_timestamp_from_timespec(const struct timespec* ts);
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(log_timestamp_t)(void* dst_value, log_timestamp_t value);
+int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(log_timestamp_t)(void);
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(log_duration_t)(void* dst_value, log_duration_t value);
+int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(log_duration_t)(void);
+
+extern const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_timestamp_t);
+extern const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_duration_t);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_CONTEXT_PROPERTY_TYPE_TIME_H */
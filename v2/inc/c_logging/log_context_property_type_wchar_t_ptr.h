@@ -11,10 +11,12 @@
 extern "C" {
 #endif
 
+// the longest wchar_t string (in wchar_t, including the null terminator) that a wchar_t_ptr property value can be formatted to
 #define LOG_MAX_WCHAR_STRING_LENGTH 4096
 
     int LOG_CONTEXT_PROPERTY_TYPE_INIT(wchar_t_ptr)(void* dst_value, size_t count, const wchar_t* format, ...);
     int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr)(const wchar_t* format, ...);
+    int LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr)(void* dst_value, size_t dst_size, const wchar_t* format, ...);
 
     extern const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr);
 
@@ -6,6 +6,7 @@
 
 #include "c_logging/log_context_property_type_if.h"
 
+// log_context_get_property_value_pairs hands out the stored array of pairs, so a pair keeps full pointers (see log_context_requirements.md)
 typedef struct LOG_CONTEXT_PROPERTY_VALUE_PAIR_TAG
 {
     const char* name;
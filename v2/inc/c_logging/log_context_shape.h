@@ -0,0 +1,137 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef LOG_CONTEXT_SHAPE_H
+#define LOG_CONTEXT_SHAPE_H
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+#else
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context.h"
+#include "c_logging/log_context_property_value_pair.h"
+#include "c_logging/log_context_property_type_if.h"
+#include "c_logging/log_context_property_type_struct.h"
+#include "c_logging/log_context_property_basic_types.h"
+#include "c_logging/log_context_property_bool_type.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A shape is the precomputed layout of a context whose property names and types never change (only the values do).
+// Names, types, value offsets and the struct header are computed once by LOG_CONTEXT_SHAPE_DEFINE, instantiating the shape
+// only copies the pairs template and writes the values.
+typedef struct LOG_CONTEXT_SHAPE_TAG
+{
+    uint32_t property_value_pair_count;
+    uint32_t values_data_length;
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs;
+    const uint32_t* value_offsets;
+} LOG_CONTEXT_SHAPE;
+
+// These is an internal API and it is not meant to be called by the users of this module
+void internal_log_context_shape_init(LOG_CONTEXT_HANDLE log_context, LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs, void* values_data, const LOG_CONTEXT_SHAPE* log_context_shape);
+
+LOG_CONTEXT_HANDLE log_context_shape_create(const LOG_CONTEXT_SHAPE* log_context_shape, const void* values_data);
+
+#define LOG_CONTEXT_SHAPE_VALUES(shape_name) \
+    MU_C2(LOG_CONTEXT_SHAPE_VALUES_, shape_name)
+
+#define LOG_CONTEXT_SHAPE_PAIR_COUNT(shape_name) \
+    MU_C2(LOG_CONTEXT_SHAPE_PAIR_COUNT_, shape_name)
+
+#define LOG_CONTEXT_SHAPE(shape_name) \
+    MU_C2(log_context_shape_, shape_name)
+
+// only property types with a fixed size can be part of a shape
+#define EXPAND_SHAPE_VALUES_FIELD_LOG_CONTEXT_SHAPE_PROPERTY(property_type, property_name) \
+    property_type property_name;
+
+#define SHAPE_VALUES_FIELD(field_desc) \
+    MU_C2(EXPAND_SHAPE_VALUES_FIELD_, field_desc)
+
+#define EXPAND_SHAPE_PAIR_LOG_CONTEXT_SHAPE_PROPERTY(property_type, property_name) \
+    , { MU_TOSTRING(property_name), NULL, &property_type##_log_context_property_type }
+
+#define SHAPE_PAIR(field_desc) \
+    MU_C2(EXPAND_SHAPE_PAIR_, field_desc)
+
+#define EXPAND_SHAPE_OFFSET_OF_LOG_CONTEXT_SHAPE_PROPERTY(property_type, property_name) \
+    property_name
+
+#define SHAPE_OFFSET_OF(shape_name, field_desc) \
+    , (uint32_t)offsetof(LOG_CONTEXT_SHAPE_VALUES(shape_name), MU_C2(EXPAND_SHAPE_OFFSET_OF_, field_desc))
+
+#define EXPAND_COUNT_SHAPE_PROPERTY_LOG_CONTEXT_SHAPE_PROPERTY(property_type, property_name) \
+    + 1
+
+#define COUNT_SHAPE_PROPERTY(field_desc) \
+    MU_C2(EXPAND_COUNT_SHAPE_PROPERTY_, field_desc)
+
+// Defines a shape at file scope. The name of the context struct property is shape_name.
+#define LOG_CONTEXT_SHAPE_DEFINE(shape_name, ...) \
+    /* Codes_SRS_LOG_CONTEXT_SHAPE_01_001: [ LOG_CONTEXT_SHAPE_DEFINE shall define a structure holding the struct field count followed by one field for each property specified with LOG_CONTEXT_SHAPE_PROPERTY. ]*/ \
+    /* Codes_SRS_LOG_CONTEXT_SHAPE_01_002: [ If 2 properties have the same property_name a compiler error shall be emitted. ]*/ \
+    typedef struct MU_C3(LOG_CONTEXT_SHAPE_VALUES_, shape_name, _TAG) \
+    { \
+        uint8_t field_count; \
+        MU_FOR_EACH_1(SHAPE_VALUES_FIELD, __VA_ARGS__) \
+    } LOG_CONTEXT_SHAPE_VALUES(shape_name); \
+    enum { LOG_CONTEXT_SHAPE_PAIR_COUNT(shape_name) = 1 MU_FOR_EACH_1(COUNT_SHAPE_PROPERTY, __VA_ARGS__) }; \
+    /* Codes_SRS_LOG_CONTEXT_SHAPE_01_003: [ LOG_CONTEXT_SHAPE_DEFINE shall define a constant template of property/value pairs: one struct property named shape_name followed by one pair with the name and type of each property. ]*/ \
+    static const LOG_CONTEXT_PROPERTY_VALUE_PAIR MU_C2(log_context_shape_pairs_, shape_name)[] = \
+    { \
+        { MU_TOSTRING(shape_name), NULL, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct) } \
+        MU_FOR_EACH_1(SHAPE_PAIR, __VA_ARGS__) \
+    }; \
+    /* Codes_SRS_LOG_CONTEXT_SHAPE_01_004: [ LOG_CONTEXT_SHAPE_DEFINE shall define a constant array with the offset of each value in the values structure. ]*/ \
+    static const uint32_t MU_C2(log_context_shape_value_offsets_, shape_name)[] = \
+    { \
+        (uint32_t)offsetof(LOG_CONTEXT_SHAPE_VALUES(shape_name), field_count) \
+        MU_FOR_EACH_1_KEEP_1(SHAPE_OFFSET_OF, shape_name, __VA_ARGS__) \
+    }; \
+    static const LOG_CONTEXT_SHAPE LOG_CONTEXT_SHAPE(shape_name) = \
+    { \
+        LOG_CONTEXT_SHAPE_PAIR_COUNT(shape_name), \
+        sizeof(LOG_CONTEXT_SHAPE_VALUES(shape_name)), \
+        MU_C2(log_context_shape_pairs_, shape_name), \
+        MU_C2(log_context_shape_value_offsets_, shape_name) \
+    }; \
+
+#define LOG_CONTEXT_SHAPE_CHECK_VALUE_COUNT(shape_name, ...) \
+    /* Codes_SRS_LOG_CONTEXT_SHAPE_01_005: [ If the number of values is different than the number of properties of the shape a compiler error shall be emitted. ]*/ \
+    (void)sizeof(char[((MU_COUNT_ARG(__VA_ARGS__) + 1) == LOG_CONTEXT_SHAPE_PAIR_COUNT(shape_name)) ? 1 : -1]); \
+
+// Instantiates a shape as a context on the stack, the values are given in the order of the shape properties
+#define LOG_CONTEXT_SHAPE_LOCAL_DEFINE(destination_context, shape_name, ...) \
+    MU_SUPPRESS_WARNING(4815) /* warning C4815: zero-sized array in stack object will have no elements (unless the object is an aggregate that has been aggregate initialized) */ \
+    LOG_CONTEXT destination_context; \
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR MU_C2(property_values_pair_, destination_context)[LOG_CONTEXT_SHAPE_PAIR_COUNT(shape_name)]; \
+    /* Codes_SRS_LOG_CONTEXT_SHAPE_01_006: [ LOG_CONTEXT_SHAPE_LOCAL_DEFINE shall write the struct field count and the values in ... in a values structure on the stack. ]*/ \
+    LOG_CONTEXT_SHAPE_VALUES(shape_name) MU_C2(shape_values_, destination_context) = { (uint8_t)(LOG_CONTEXT_SHAPE_PAIR_COUNT(shape_name) - 1), __VA_ARGS__ }; \
+    LOG_CONTEXT_SHAPE_CHECK_VALUE_COUNT(shape_name, __VA_ARGS__) \
+    /* Codes_SRS_LOG_CONTEXT_SHAPE_01_007: [ LOG_CONTEXT_SHAPE_LOCAL_DEFINE shall initialize the context by calling internal_log_context_shape_init. ]*/ \
+    internal_log_context_shape_init(&destination_context, MU_C2(property_values_pair_, destination_context), &MU_C2(shape_values_, destination_context), &LOG_CONTEXT_SHAPE(shape_name)); \
+
+// Instantiates a shape as a dynamically allocated context (to be destroyed with LOG_CONTEXT_DESTROY)
+#define LOG_CONTEXT_SHAPE_CREATE(destination_context, shape_name, ...) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_SHAPE_01_008: [ LOG_CONTEXT_SHAPE_CREATE shall write the struct field count and the values in ... in a values structure and call log_context_shape_create. ]*/ \
+        LOG_CONTEXT_SHAPE_VALUES(shape_name) shape_values = { (uint8_t)(LOG_CONTEXT_SHAPE_PAIR_COUNT(shape_name) - 1), __VA_ARGS__ }; \
+        LOG_CONTEXT_SHAPE_CHECK_VALUE_COUNT(shape_name, __VA_ARGS__) \
+        destination_context = log_context_shape_create(&LOG_CONTEXT_SHAPE(shape_name), &shape_values); \
+    } \
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_CONTEXT_SHAPE_H */
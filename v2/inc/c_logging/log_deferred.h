@@ -0,0 +1,137 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef LOG_DEFERRED_H
+#define LOG_DEFERRED_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdbool.h>
+#include <stdint.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_level.h"
+#include "c_logging/logger.h"
+
+// Deferred logging: LOGGER_LOG_DEFERRED copies the level and the raw argument values of the call in a buffer owned by the
+// calling thread and returns, the message is formatted and handed to the sinks when log_deferred_flush is called
+// (typically periodically from a thread of the application).
+// The types of the arguments are classified at compile time, so no formatting happens on the logging thread.
+
+#define LOG_DEFERRED_THREAD_BUFFER_SIZE (64 * 1024) // bytes of records each logging thread can hold between flushes
+#define LOG_DEFERRED_MAX_RECORD_SIZE 1024 // strings are truncated so that one record fits
+#define LOG_DEFERRED_MAX_ARG_COUNT 16
+
+#define LOG_DEFERRED_ARG_TYPE_VALUES \
+    LOG_DEFERRED_ARG_TYPE_INT, \
+    LOG_DEFERRED_ARG_TYPE_UNSIGNED_INT, \
+    LOG_DEFERRED_ARG_TYPE_LONG, \
+    LOG_DEFERRED_ARG_TYPE_UNSIGNED_LONG, \
+    LOG_DEFERRED_ARG_TYPE_LONG_LONG, \
+    LOG_DEFERRED_ARG_TYPE_UNSIGNED_LONG_LONG, \
+    LOG_DEFERRED_ARG_TYPE_DOUBLE, \
+    LOG_DEFERRED_ARG_TYPE_LONG_DOUBLE, \
+    LOG_DEFERRED_ARG_TYPE_STRING, \
+    LOG_DEFERRED_ARG_TYPE_POINTER
+
+MU_DEFINE_ENUM_WITHOUT_INVALID(LOG_DEFERRED_ARG_TYPE, LOG_DEFERRED_ARG_TYPE_VALUES);
+
+#define LOG_DEFERRED_SITE_STATE_VALUES \
+    LOG_DEFERRED_SITE_STATE_NOT_CHECKED, \
+    LOG_DEFERRED_SITE_STATE_CHECKING, \
+    LOG_DEFERRED_SITE_STATE_DEFERRED, \
+    LOG_DEFERRED_SITE_STATE_IMMEDIATE
+
+MU_DEFINE_ENUM_WITHOUT_INVALID(LOG_DEFERRED_SITE_STATE, LOG_DEFERRED_SITE_STATE_VALUES);
+
+// One per LOGGER_LOG_DEFERRED call site, the records refer to it instead of carrying the format, file and function
+typedef struct LOG_DEFERRED_SITE_TAG
+{
+    const char* format;
+    const char* file;
+    const char* func;
+    int line;
+    uint32_t arg_count;
+    const uint8_t* arg_types; // LOG_DEFERRED_ARG_TYPE of each argument, as classified at compile time
+    volatile long state; // LOG_DEFERRED_SITE_STATE, the format is checked on the first call
+    uint8_t arg_kinds[LOG_DEFERRED_MAX_ARG_COUNT]; // how each argument is stored (a char* printed with %p is a pointer, not a string)
+} LOG_DEFERRED_SITE;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    bool log_deferred_site_is_deferred(LOG_DEFERRED_SITE* site);
+    void log_deferred_log(LOG_DEFERRED_SITE* site, LOG_LEVEL log_level, ...);
+    int log_deferred_flush(void);
+    uint32_t log_deferred_get_dropped_count(void);
+    // buffers are reused by new threads once their thread exited and their records were flushed
+    uint32_t log_deferred_get_thread_buffer_count(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+// _Generic is C11: C++ and C compilers in an older mode (MSVC without /std:c11 does not define __STDC_VERSION__) format the message right away
+#if defined(__cplusplus) || !defined(__STDC_VERSION__) || (__STDC_VERSION__ < 201112L)
+
+/* Codes_SRS_LOG_DEFERRED_01_031: [ If the compiler does not support _Generic (C++, or C before C11), LOGGER_LOG_DEFERRED shall be LOGGER_LOG without a context. ]*/
+// the format is passed on with the arguments, so that LOGGER_LOG sees them as separate macro arguments
+#define LOGGER_LOG_DEFERRED(log_level, ...) \
+    LOGGER_LOG(log_level, NULL, __VA_ARGS__)
+
+#else
+
+// char, short and _Bool are promoted to int and float to double when passed through ...
+#define LOG_DEFERRED_ARG_TYPE_OF(arg) \
+    _Generic((arg), \
+        _Bool: LOG_DEFERRED_ARG_TYPE_INT, \
+        char: LOG_DEFERRED_ARG_TYPE_INT, \
+        signed char: LOG_DEFERRED_ARG_TYPE_INT, \
+        unsigned char: LOG_DEFERRED_ARG_TYPE_INT, \
+        short: LOG_DEFERRED_ARG_TYPE_INT, \
+        unsigned short: LOG_DEFERRED_ARG_TYPE_INT, \
+        int: LOG_DEFERRED_ARG_TYPE_INT, \
+        unsigned int: LOG_DEFERRED_ARG_TYPE_UNSIGNED_INT, \
+        long: LOG_DEFERRED_ARG_TYPE_LONG, \
+        unsigned long: LOG_DEFERRED_ARG_TYPE_UNSIGNED_LONG, \
+        long long: LOG_DEFERRED_ARG_TYPE_LONG_LONG, \
+        unsigned long long: LOG_DEFERRED_ARG_TYPE_UNSIGNED_LONG_LONG, \
+        float: LOG_DEFERRED_ARG_TYPE_DOUBLE, \
+        double: LOG_DEFERRED_ARG_TYPE_DOUBLE, \
+        long double: LOG_DEFERRED_ARG_TYPE_LONG_DOUBLE, \
+        char*: LOG_DEFERRED_ARG_TYPE_STRING, \
+        const char*: LOG_DEFERRED_ARG_TYPE_STRING, \
+        default: LOG_DEFERRED_ARG_TYPE_POINTER)
+
+#define LOG_DEFERRED_ARG_TYPE_ENTRY(arg) \
+    , LOG_DEFERRED_ARG_TYPE_OF(arg)
+
+// format has to be a string literal. The first entry of the argument types array is a placeholder so that the array is never empty.
+// The arguments are evaluated once, either by the deferred path or (when the format cannot be deferred) by LOGGER_LOG.
+#define LOGGER_LOG_DEFERRED(log_level, format, ...) \
+    do \
+    { \
+        /* Codes_SRS_LOG_DEFERRED_01_001: [ LOGGER_LOG_DEFERRED shall generate code that verifies at compile time that format and ... are suitable to be passed as arguments to printf. ]*/ \
+        LOGGER_FORMATTING_SYNTAX_CHECK(format, __VA_ARGS__); \
+        /* Codes_SRS_LOG_DEFERRED_01_002: [ LOGGER_LOG_DEFERRED shall define a static call site with format, file, function, line, the number of arguments and the type of each argument obtained at compile time with _Generic. ]*/ \
+        static const uint8_t log_deferred_arg_types[] = { 0 MU_FOR_EACH_1(LOG_DEFERRED_ARG_TYPE_ENTRY, __VA_ARGS__) }; \
+        static LOG_DEFERRED_SITE log_deferred_site = { format, __FILE__, __FUNCTION__, __LINE__, MU_COUNT_ARG(__VA_ARGS__), &log_deferred_arg_types[1] }; \
+        if (log_deferred_site_is_deferred(&log_deferred_site)) \
+        { \
+            /* Codes_SRS_LOG_DEFERRED_01_003: [ If log_deferred_site_is_deferred returns true, LOGGER_LOG_DEFERRED shall call log_deferred_log with the call site, log_level and the arguments. ]*/ \
+            log_deferred_log(&log_deferred_site, log_level MU_IFCOMMALOGIC(MU_COUNT_ARG(__VA_ARGS__)) __VA_ARGS__); \
+        } \
+        else \
+        { \
+            /* Codes_SRS_LOG_DEFERRED_01_004: [ Otherwise LOGGER_LOG_DEFERRED shall log the message right away by calling logger_log. ]*/ \
+            logger_log(log_level, NULL, __FILE__, __FUNCTION__, __LINE__, format MU_IFCOMMALOGIC(MU_COUNT_ARG(__VA_ARGS__)) __VA_ARGS__); \
+        } \
+    } while (0)
+
+#endif
+
+#endif /* LOG_DEFERRED_H */
@@ -6,8 +6,10 @@
 
 #ifndef __cplusplus
 #include <errno.h>
+#include <stddef.h>
 #else
 #include <cerrno>
+#include <cstddef>
 #endif
 
 #include "c_logging/log_context.h"
@@ -16,7 +18,7 @@
 extern "C" {
 #endif
 
-int log_errno_fill_property(void* buffer, int dummy);
+int log_errno_fill_property(void* buffer, size_t buffer_size, int dummy);
 
 #define LOG_ERRNO() \
     /* Codes_SRS_LOG_ERRNO_WIN32_01_001: [ LOG_ERRNO shall expand to a LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION with name errno_value, type ascii_char_ptr and value function call being log_errno_fill_property. ] */ \
@@ -5,8 +5,10 @@
 #define LOG_HRESULT_H
 
 #ifndef __cplusplus
+#include <stddef.h>
 #include <stdint.h>
 #else
+#include <cstddef>
 #include <cstdint>
 #endif
 
@@ -18,7 +20,7 @@
 extern "C" {
 #endif
 
-int log_hresult_fill_property(void* buffer, HRESULT hresult);
+int log_hresult_fill_property(void* buffer, size_t buffer_size, HRESULT hresult);
 
 /* Codes_SRS_LOG_HRESULT_01_012: [ LOG_HRESULT shall expand to a LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION with name hresult, type ascii_char_ptr and value function call being log_hresult_fill_property(hresult). ] */
 #define LOG_HRESULT(the_hresult) \
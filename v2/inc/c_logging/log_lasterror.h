@@ -5,8 +5,10 @@
 #define LOG_LASTERROR_H
 
 #ifndef __cplusplus
+#include <stddef.h>
 #include <stdint.h>
 #else
+#include <cstddef>
 #include <cstdint>
 #endif
 
@@ -18,7 +20,7 @@
 extern "C" {
 #endif
 
-int log_lasterror_fill_property(void* buffer, int dummy);
+int log_lasterror_fill_property(void* buffer, size_t buffer_size, int dummy);
 
 /* Codes_SRS_LOG_LASTERROR_01_001: [ LOG_LASTERROR shall expand to a LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION with name LastError, type ascii_char_ptr and value function call being log_lasterror_fill_property. ] */
 #define LOG_LASTERROR() \
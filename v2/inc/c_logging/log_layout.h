@@ -0,0 +1,85 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef LOG_LAYOUT_H
+#define LOG_LAYOUT_H
+
+#ifdef __cplusplus
+#include <cstdarg>
+#include <cstddef>
+#include <cstdint>
+#else
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context.h"
+#include "c_logging/log_level.h"
+
+// A layout describes the text of a log line with a pattern, for example "%L %T %f:%l %m %c".
+// The pattern is parsed once by log_layout_compile into a list of ops, formatting a line only runs the ops
+// (nothing is parsed and fields that are not in the pattern are not computed).
+//
+// %L  level name (LOG_LEVEL_ERROR)
+// %v  short level (C, E, W, I, V)
+// %T  UTC time in ISO 8601 with microseconds, as in the built-in lines of the sinks (2026-10-18T20:00:46.123456Z)
+// %t  UTC time in ISO 8601 with nanoseconds (2026-10-18T20:00:46.123456789Z)
+// %F  file as given to the logger
+// %f  file name without the directories
+// %l  line
+// %M  function
+// %m  formatted message
+// %c  context properties (nothing when the line has no context)
+// %%  %
+
+#define LOG_LAYOUT_MAX_OP_COUNT 32
+#define LOG_LAYOUT_MAX_LITERAL_LENGTH 128 // total number of literal characters in a pattern
+
+#define LOG_LAYOUT_OP_TYPE_VALUES \
+    LOG_LAYOUT_OP_TYPE_LITERAL, \
+    LOG_LAYOUT_OP_TYPE_LEVEL, \
+    LOG_LAYOUT_OP_TYPE_SHORT_LEVEL, \
+    LOG_LAYOUT_OP_TYPE_TIME, \
+    LOG_LAYOUT_OP_TYPE_PRECISE_TIME, \
+    LOG_LAYOUT_OP_TYPE_FILE, \
+    LOG_LAYOUT_OP_TYPE_FILE_NAME, \
+    LOG_LAYOUT_OP_TYPE_LINE, \
+    LOG_LAYOUT_OP_TYPE_FUNC, \
+    LOG_LAYOUT_OP_TYPE_MESSAGE, \
+    LOG_LAYOUT_OP_TYPE_CONTEXT
+
+MU_DEFINE_ENUM_WITHOUT_INVALID(LOG_LAYOUT_OP_TYPE, LOG_LAYOUT_OP_TYPE_VALUES);
+
+typedef struct LOG_LAYOUT_OP_TAG
+{
+    uint8_t type; // LOG_LAYOUT_OP_TYPE
+    uint8_t literal_length;
+    uint8_t literal_offset; // in literals
+} LOG_LAYOUT_OP;
+
+typedef struct LOG_LAYOUT_TAG
+{
+    uint32_t op_count;
+    LOG_LAYOUT_OP ops[LOG_LAYOUT_MAX_OP_COUNT];
+    char literals[LOG_LAYOUT_MAX_LITERAL_LENGTH];
+} LOG_LAYOUT;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    int log_layout_compile(LOG_LAYOUT* layout, const char* pattern);
+
+    // Runs the ops of layout and writes the line to buffer, following the snprintf contract except that the result is the
+    // number of characters written (at most buffer_size - 1), so that the caller can append to the line.
+    int log_layout_format(const LOG_LAYOUT* layout, char* buffer, size_t buffer_size, LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context, const char* file, const char* func, int line, const char* message_format, va_list args);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_LAYOUT_H */
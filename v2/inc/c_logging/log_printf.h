@@ -0,0 +1,38 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef LOG_PRINTF_H
+#define LOG_PRINTF_H
+
+#ifdef __cplusplus
+#include <cstdarg>
+#include <cstddef>
+#else
+#include <stdarg.h>
+#include <stddef.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// printf compatible formatter used by the sinks for the user message, it allocates nothing.
+// %d %i %u %o %x %X %c %s %p %n and %% (with all flags, width, precision and length modifiers) are formatted in-house,
+// the other conversions (floating point, wide characters, positional arguments) are handed to the C library.
+// Extensions: %m is the text for the current errno value and %#m its name (as in glibc) on all platforms.
+// These follow the vsnprintf contract: the result is the length of the full output, buffer is always zero terminated
+// (if buffer_size is not 0) and the output is truncated if it does not fit.
+int log_vsnprintf(char* buffer, size_t buffer_size, const char* format, va_list args);
+int log_snprintf(char* buffer, size_t buffer_size, const char* format, ...);
+
+// Same as log_vsnprintf, but the parsed format (literal text and conversion specs) is cached by format pointer
+// and reused on the next calls. The cache keeps a copy of the format text and only reuses a plan if the text at format
+// is unchanged, so any format gives the right output, but only formats that never change (the string literal of a
+// LOGGER_LOG call site, which is what the sinks get) benefit from the cache.
+int log_vsnprintf_cached(char* buffer, size_t buffer_size, const char* format, va_list args);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_PRINTF_H */
@@ -4,16 +4,70 @@
 #ifndef LOG_SINK_CALLBACK_H
 #define LOG_SINK_CALLBACK_H
 
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#endif
+
+#include "c_logging/log_context_property_value_pair.h"
+#include "c_logging/log_level.h"
 #include "c_logging/log_sink_if.h"
 
+// how many subscribers can be subscribed at the same time
+#define LOG_SINK_CALLBACK_MAX_SUBSCRIBERS 8
+
+// the level mask of a subscriber has one bit per LOG_LEVEL it wants
+#define LOG_SINK_CALLBACK_LEVEL_MASK(log_level) (UINT32_C(1) << (log_level))
+#define LOG_SINK_CALLBACK_LEVEL_MASK_ALL ((UINT32_C(1) << (LOG_LEVEL_VERBOSE + 1)) - 1)
+
+typedef struct LOG_SINK_CALLBACK_RECORD_MESSAGE_TAG LOG_SINK_CALLBACK_RECORD_MESSAGE;
+
+// A log event with its fields, valid only during the call to the record callback.
+// The message is only formatted if the callback asks for it with log_sink_callback_record_get_message.
+typedef struct LOG_SINK_CALLBACK_RECORD_TAG
+{
+    LOG_LEVEL log_level;
+    int64_t time; // nanoseconds since 1970-01-01T00:00:00Z, LOG_TIMESTAMP_INVALID if the clock could not be read
+    const char* file;
+    const char* func;
+    int line;
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs; // NULL if the event has no context
+    size_t property_value_pair_count;
+    LOG_SINK_CALLBACK_RECORD_MESSAGE* message;
+} LOG_SINK_CALLBACK_RECORD;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
     typedef void (*LOG_SINK_CALLBACK_LOG)(void* context, LOG_LEVEL log_level, const char* message);
     int log_sink_callback_set_callback(LOG_SINK_CALLBACK_LOG log_callback, void* context);
+    // the default callback, it drops the lines (set it back to only use the record callback, the lines are then not built)
+    void log_sink_callback_noop_callback(void* context, LOG_LEVEL log_level, const char* message);
+
+    typedef void (*LOG_SINK_CALLBACK_LOG_RECORD)(void* context, const LOG_SINK_CALLBACK_RECORD* record);
+    // NULL removes the record callback
+    void log_sink_callback_set_record_callback(LOG_SINK_CALLBACK_LOG_RECORD log_record_callback, void* context);
+    // formats the message of record on the first call (NULL if formatting fails)
+    const char* log_sink_callback_record_get_message(const LOG_SINK_CALLBACK_RECORD* record);
+
+    // the maximum level only applies to the callbacks above (set them before logging, they are not synchronized)
     void log_sink_callback_set_max_level(LOG_LEVEL log_level);
 
+    // Subscribers get the events whose level has its bit in their level mask, next to the callbacks above. Either callback can
+    // be NULL. The line is built once for all the subscribers and the message of the record is formatted at most once.
+    // Subscribing, unsubscribing and changing a level mask can be done from any thread while logging, without taking a lock.
+    // log_sink_callback_unsubscribe waits for the calls in progress, so the context can be freed once it returns (it must not
+    // be called from the callbacks of the same subscription).
+    int log_sink_callback_subscribe(LOG_SINK_CALLBACK_LOG log_callback, LOG_SINK_CALLBACK_LOG_RECORD log_record_callback, void* context, uint32_t level_mask, uint32_t* subscription_id);
+    int log_sink_callback_unsubscribe(uint32_t subscription_id);
+    int log_sink_callback_set_subscriber_level_mask(uint32_t subscription_id, uint32_t level_mask);
+    // pattern is a log_layout pattern (for example "%v %t %f:%l %m%c"), NULL goes back to the built-in line format
+    int log_sink_callback_set_layout(const char* pattern);
+
     extern const LOG_SINK_IF log_sink_callback;
 
 #ifdef __cplusplus
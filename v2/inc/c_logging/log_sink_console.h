@@ -4,12 +4,45 @@
 #ifndef LOG_SINK_CONSOLE_H
 #define LOG_SINK_CONSOLE_H
 
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdint.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
 #include "c_logging/log_sink_if.h"
 
+// PRINTF prints each line with one printf call (the default).
+// DIRECT writes each line with write (_write on Windows) instead of going through stdio. The colors are only written when
+// stdout is a terminal, in which case each line is written as soon as it is logged. Otherwise the lines are collected and
+// written together, when LOG_SINK_CONSOLE_BATCH_SIZE is reached, at the first line logged LOG_SINK_CONSOLE_BATCH_TIME_NS after
+// the first collected line, for LOG_LEVEL_ERROR and LOG_LEVEL_CRITICAL lines, by log_sink_console_flush, by deinit and at exit.
+// There is no timer: LOG_SINK_CONSOLE_BATCH_TIME_NS is only checked when a line is logged, so lines collected before an idle
+// period stay in memory until one of the above happens (call log_sink_console_flush periodically to bound that).
+// A line is never split across writes.
+#define LOG_SINK_CONSOLE_OUTPUT_VALUES \
+    LOG_SINK_CONSOLE_OUTPUT_PRINTF, \
+    LOG_SINK_CONSOLE_OUTPUT_DIRECT
+
+MU_DEFINE_ENUM(LOG_SINK_CONSOLE_OUTPUT, LOG_SINK_CONSOLE_OUTPUT_VALUES)
+
+#define LOG_SINK_CONSOLE_BATCH_SIZE (64 * 1024)
+#define LOG_SINK_CONSOLE_BATCH_TIME_NS INT64_C(100000000)
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+    // pattern is a log_layout pattern (for example "%v %t %f:%l %m%c"), NULL goes back to the built-in line format
+    int log_sink_console_set_layout(const char* pattern);
+
+    int log_sink_console_set_output(LOG_SINK_CONSOLE_OUTPUT output);
+
+    // writes the lines collected by the DIRECT output (it is also registered with atexit the first time the DIRECT output is set)
+    void log_sink_console_flush(void);
+
     extern const LOG_SINK_IF log_sink_console;
 
 #ifdef __cplusplus
@@ -0,0 +1,57 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef LOG_TIMESTAMP_H
+#define LOG_TIMESTAMP_H
+
+#ifdef __cplusplus
+#include <cstdint>
+#else
+#include <stdbool.h>
+#include <stdint.h>
+#endif
+
+// returned by log_timestamp_now when the clock cannot be read
+#define LOG_TIMESTAMP_INVALID INT64_MIN
+
+// the mapping from counter ticks to wall clock time is refreshed when it is older than this
+#define LOG_TIMESTAMP_CALIBRATION_PERIOD_NS INT64_C(1000000000)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    // Reads the wall clock once and returns the number of nanoseconds since 1970-01-01T00:00:00Z (LOG_TIMESTAMP_INVALID on failure).
+    // The text sinks call it once per line and render the result with timestamp_microseconds_to_string (which keeps the text of
+    // the current second per thread), instead of calling time and ctime.
+    // On Linux the clock is CLOCK_REALTIME, or CLOCK_REALTIME_COARSE (cheaper, with the resolution of the scheduler tick) when
+    // built with LOG_TIMESTAMP_USE_COARSE_CLOCK.
+    // When built with LOG_TIMESTAMP_USE_COUNTER and the CPU has an invariant counter, the time is read from the counter and
+    // converted with the published calibration instead. The first calibration is made on first use (normally the first logging
+    // call): the calling thread spins for 2 ms to measure the frequency of the counter and threads that log meanwhile wait for it.
+    // Call log_timestamp_calibrate at startup to move this cost out of the first logging call.
+    int64_t log_timestamp_now(void);
+
+    // Ticks are what a record captures when it is made, they are only converted to wall clock time when the record is rendered.
+    // With LOG_TIMESTAMP_USE_COUNTER they are the invariant TSC (rdtsc, x86/x64) or the virtual counter (CNTVCT_EL0, ARM64),
+    // otherwise (or when the counter is not invariant) they are the nanoseconds returned by log_timestamp_now.
+    uint64_t log_timestamp_ticks(void);
+    int64_t log_timestamp_ticks_to_ns(uint64_t ticks);
+
+    // true if the ticks come from the CPU counter
+    bool log_timestamp_uses_counter(void);
+
+    // Publishes a new mapping from ticks to wall clock time. The application can call it periodically from a thread of its own
+    // (log_deferred_flush calls it), otherwise the mapping is refreshed by log_timestamp_now when it gets older than
+    // LOG_TIMESTAMP_CALIBRATION_PERIOD_NS.
+    int log_timestamp_calibrate(void);
+
+    // While a record captured earlier is being rendered, log_timestamp_now returns the time of its ticks on the calling thread
+    void log_timestamp_begin_record(uint64_t ticks);
+    void log_timestamp_end_record(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LOG_TIMESTAMP_H */
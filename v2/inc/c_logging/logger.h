@@ -24,6 +24,7 @@
 #include "c_logging/log_errno.h"
 
 #define LOG_MAX_MESSAGE_LENGTH              4096 /*in bytes - a message is not expected to exceed this size in bytes, if it does, only LOG_MAX_MESSAGE_LENGTH characters are retained*/
+#define LOGGER_STACK_MERGED_PAIR_COUNT      16 /*merged views (ambient context and the context passed to the logger) of up to this many property/value pairs are built on the stack of the logging call, bigger ones are allocated*/
 
 #ifdef __cplusplus
 extern "C" {
@@ -62,6 +63,8 @@ extern "C" {
         (void)(0 && printf(format MU_IFCOMMALOGIC(MU_COUNT_ARG(__VA_ARGS__)) __VA_ARGS__)); \
     } while (0) \
 
+/*format has to be a string literal: the sinks cache the parsed format by its address (see log_vsnprintf_cached) and do not compare its text again,
+so a format built at run time (on the stack or in a reused buffer) has to be logged as "%s" with the text as argument*/
 #define LOGGER_LOG(log_level, log_context, format, ...) \
     do \
     { \
@@ -88,6 +91,14 @@ extern "C" {
 
 #define EXPAND_MESSAGE_LOG_CONTEXT_STRING_PROPERTY(...) \
 
+#define EXPAND_MESSAGE_LOG_CONTEXT_BORROWED_STRING_PROPERTY(...) \
+
+#define EXPAND_MESSAGE_LOG_CONTEXT_BINARY_PROPERTY(...) \
+
+#define EXPAND_MESSAGE_LOG_CONTEXT_BORROWED_BINARY_PROPERTY(...) \
+
+#define EXPAND_MESSAGE_LOG_CONTEXT_ARRAY_PROPERTY(...) \
+
 #define EXPAND_MESSAGE(A) MU_C2(EXPAND_MESSAGE_, A)
 
 #define HAS_ANY_PROPERTIES_LOG_MESSAGE(...) \
@@ -98,6 +109,18 @@ extern "C" {
 #define HAS_ANY_PROPERTIES_LOG_CONTEXT_STRING_PROPERTY(...) \
     + 1
 
+#define HAS_ANY_PROPERTIES_LOG_CONTEXT_BORROWED_STRING_PROPERTY(...) \
+    + 1
+
+#define HAS_ANY_PROPERTIES_LOG_CONTEXT_BINARY_PROPERTY(...) \
+    + 1
+
+#define HAS_ANY_PROPERTIES_LOG_CONTEXT_BORROWED_BINARY_PROPERTY(...) \
+    + 1
+
+#define HAS_ANY_PROPERTIES_LOG_CONTEXT_ARRAY_PROPERTY(...) \
+    + 1
+
 #define HAS_ANY_PROPERTIES(A) MU_C2(HAS_ANY_PROPERTIES_, A)
 
 #define LOGGER_LOG_EX(log_level, ...) \
@@ -0,0 +1,44 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TIME_TO_STRING_H
+#define TIME_TO_STRING_H
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cstdint>
+#else
+#include <stddef.h>
+#include <stdint.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// number of characters produced for a timestamp ("2026-10-18T20:00:46.123456789Z"), without the zero terminator
+#define TIMESTAMP_TO_STRING_LENGTH 30
+
+// number of characters produced for a timestamp with microseconds ("2026-10-18T20:00:46.123456Z"), without the zero terminator
+#define TIMESTAMP_MICROSECONDS_TO_STRING_LENGTH 27
+
+// maximum number of characters produced for a duration ("-106751d23h47m16.854s"), without the zero terminator
+#define DURATION_TO_STRING_MAX_LENGTH 21
+
+// These follow the snprintf contract: the result is the length of the full representation,
+// buffer is always zero terminated (if buffer_length is not 0) and the representation is truncated if it does not fit
+
+// nanoseconds_since_epoch is the number of nanoseconds since 1970-01-01T00:00:00Z, the output is ISO 8601 UTC with nanoseconds
+int timestamp_to_string(int64_t nanoseconds_since_epoch, char* buffer, size_t buffer_length);
+
+// same as timestamp_to_string with the fraction truncated to microseconds (2026-10-18T20:00:46.123456Z)
+int timestamp_microseconds_to_string(int64_t nanoseconds_since_epoch, char* buffer, size_t buffer_length);
+
+// the output uses the largest unit that applies: "850ns", "12.345us", "12.345ms", "12.345s", "2m03.456s", "1h02m03.456s", "3d01h02m03.456s"
+int duration_to_string(int64_t nanoseconds, char* buffer, size_t buffer_length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIME_TO_STRING_H */
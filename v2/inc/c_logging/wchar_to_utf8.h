@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef WCHAR_TO_UTF8_H
+#define WCHAR_TO_UTF8_H
+
+#ifdef __cplusplus
+#include <cstddef>
+#include <cwchar>
+#else
+#include <stddef.h>
+#include <wchar.h>
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Converts a zero terminated wchar_t string to UTF-8 without depending on the current locale.
+// wchar_t strings are UTF-32 when wchar_t is 32 bits wide (Linux) and UTF-16 when it is 16 bits wide (Windows).
+// Code units that do not encode a valid code point (unpaired surrogates, values above 0x10FFFF) are replaced with U+FFFD.
+// The result is the length of the full UTF-8 string, buffer is always zero terminated (if buffer_length is not 0)
+// and when the UTF-8 string does not fit only the characters that fit entirely are written (a character is never cut)
+// and the rest of buffer is filled with zero terminators.
+int wchar_to_utf8(const wchar_t* source, char* buffer, size_t buffer_length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WCHAR_TO_UTF8_H */
@@ -0,0 +1,103 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <limits.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define BINARY_TO_HEX_STRING_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "c_logging/binary_to_hex_string.h"
+
+static const char hex_digits[16] =
+{
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+};
+
+#ifdef BINARY_TO_HEX_STRING_USE_SSE2
+// encodes 16 bytes in 32 characters: the nibbles are split in 2 vectors, turned into digits
+// ('0' + nibble, plus 'a' - '0' - 10 for the nibbles above 9) and interleaved back
+static void encode_16_bytes(char* destination, const uint8_t* source)
+{
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    const __m128i nine = _mm_set1_epi8(9);
+    const __m128i digit_zero = _mm_set1_epi8('0');
+    const __m128i letter_offset = _mm_set1_epi8('a' - '0' - 10);
+
+    __m128i input = _mm_loadu_si128((const __m128i*)source);
+    __m128i high_nibbles = _mm_and_si128(_mm_srli_epi16(input, 4), nibble_mask);
+    __m128i low_nibbles = _mm_and_si128(input, nibble_mask);
+
+    __m128i high_digits = _mm_add_epi8(_mm_add_epi8(high_nibbles, digit_zero), _mm_and_si128(_mm_cmpgt_epi8(high_nibbles, nine), letter_offset));
+    __m128i low_digits = _mm_add_epi8(_mm_add_epi8(low_nibbles, digit_zero), _mm_and_si128(_mm_cmpgt_epi8(low_nibbles, nine), letter_offset));
+
+    _mm_storeu_si128((__m128i*)destination, _mm_unpacklo_epi8(high_digits, low_digits));
+    _mm_storeu_si128((__m128i*)(destination + 16), _mm_unpackhi_epi8(high_digits, low_digits));
+}
+#endif
+
+static void encode_bytes(char* destination, const uint8_t* source, size_t byte_count)
+{
+    size_t i = 0;
+
+#ifdef BINARY_TO_HEX_STRING_USE_SSE2
+    for (; i + 16 <= byte_count; i += 16)
+    {
+        encode_16_bytes(destination + (i * 2), source + i);
+    }
+#endif
+
+    for (; i < byte_count; i++)
+    {
+        destination[i * 2] = hex_digits[source[i] >> 4];
+        destination[(i * 2) + 1] = hex_digits[source[i] & 0x0F];
+    }
+}
+
+int binary_to_hex_string(const void* data, size_t data_length, char* buffer, size_t buffer_length)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_BINARY_TO_HEX_STRING_01_001: [ If data is NULL and data_length is greater than 0, binary_to_hex_string shall fail and return a negative value. ]*/
+        ((data == NULL) && (data_length > 0)) ||
+        /* Codes_SRS_BINARY_TO_HEX_STRING_01_002: [ If buffer is NULL and buffer_length is greater than 0, binary_to_hex_string shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_length > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const void* data=%p, size_t data_length=%zu, char* buffer=%p, size_t buffer_length=%zu\r\n",
+            data, data_length, buffer, buffer_length);
+        result = -1;
+    }
+    else if (data_length > INT_MAX / 2)
+    {
+        /* Codes_SRS_BINARY_TO_HEX_STRING_01_003: [ If the length of the hex representation does not fit in an int, binary_to_hex_string shall fail and return a negative value. ]*/
+        (void)printf("Data too long: data_length=%zu\r\n", data_length);
+        result = -1;
+    }
+    else
+    {
+        if (buffer_length > 0)
+        {
+            /* Codes_SRS_BINARY_TO_HEX_STRING_01_004: [ binary_to_hex_string shall write in buffer 2 lowercase hex digits for each byte of data, for as many bytes as fit entirely in buffer (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+            /* Codes_SRS_BINARY_TO_HEX_STRING_01_005: [ binary_to_hex_string shall encode the bytes 16 at a time using SSE2 instructions when they are available. ]*/
+            size_t byte_count = (buffer_length - 1) / 2;
+            if (byte_count > data_length)
+            {
+                byte_count = data_length;
+            }
+
+            encode_bytes(buffer, data, byte_count);
+            buffer[byte_count * 2] = '\0';
+        }
+
+        /* Codes_SRS_BINARY_TO_HEX_STRING_01_006: [ binary_to_hex_string shall succeed and return the length of the full hex representation of data (2 * data_length). ]*/
+        result = (int)(data_length * 2);
+    }
+
+    return result;
+}
@@ -0,0 +1,491 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "c_logging/integer_to_string.h"
+
+#include "c_logging/floating_point_to_string.h"
+
+// The digits are produced with Grisu2 (Florian Loitsch, "Printing Floating-Point Numbers Quickly and Accurately with Integers", 2010):
+// the value and its rounding boundaries are scaled by a cached power of 10 so that the integer part of the upper boundary fits in 32 bits,
+// then digits are generated until the result is inside the rounding interval. Everything is done with 64 bit integer arithmetic.
+
+// the exponent range of the scaled upper boundary, the integer part then fits in 32 bits
+#define GRISU_ALPHA (-60)
+#define GRISU_GAMMA (-32)
+
+// the range of decimal exponents printed without an exponent, same as "%g" for the lower end
+#define FIXED_NOTATION_MIN_EXPONENT (-4)
+#define FIXED_NOTATION_MAX_EXPONENT 15
+
+#define DOUBLE_SIGNIFICAND_BITS 52
+#define DOUBLE_EXPONENT_BIAS 1023
+#define DOUBLE_MAX_BIASED_EXPONENT 0x7FF
+
+#define FLOAT_SIGNIFICAND_BITS 23
+#define FLOAT_EXPONENT_BIAS 127
+#define FLOAT_MAX_BIASED_EXPONENT 0xFF
+
+// maximum number of significant digits produced for a double
+#define MAX_DIGIT_COUNT 17
+
+typedef struct DIY_FP_TAG
+{
+    uint64_t f;
+    int e;
+} DIY_FP;
+
+typedef struct BOUNDARIES_TAG
+{
+    DIY_FP w;
+    DIY_FP minus;
+    DIY_FP plus;
+} BOUNDARIES;
+
+typedef struct CACHED_POWER_TAG
+{
+    uint64_t f;
+    int e;
+    int k;
+} CACHED_POWER;
+
+// 10^k for k = -300, -292, ..., 340, normalized to 64 bits (f * 2^e)
+#define CACHED_POWERS_MIN_DECIMAL_EXPONENT (-300)
+#define CACHED_POWERS_DECIMAL_EXPONENT_STEP 8
+
+static const CACHED_POWER cached_powers[] =
+{
+    { 0xAB70FE17C79AC6CAULL, -1060, -300 },
+    { 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+    { 0xBE5691EF416BD60CULL, -1007, -284 },
+    { 0x8DD01FAD907FFC3CULL, -980, -276 },
+    { 0xD3515C2831559A83ULL, -954, -268 },
+    { 0x9D71AC8FADA6C9B5ULL, -927, -260 },
+    { 0xEA9C227723EE8BCBULL, -901, -252 },
+    { 0xAECC49914078536DULL, -874, -244 },
+    { 0x823C12795DB6CE57ULL, -847, -236 },
+    { 0xC21094364DFB5637ULL, -821, -228 },
+    { 0x9096EA6F3848984FULL, -794, -220 },
+    { 0xD77485CB25823AC7ULL, -768, -212 },
+    { 0xA086CFCD97BF97F4ULL, -741, -204 },
+    { 0xEF340A98172AACE5ULL, -715, -196 },
+    { 0xB23867FB2A35B28EULL, -688, -188 },
+    { 0x84C8D4DFD2C63F3BULL, -661, -180 },
+    { 0xC5DD44271AD3CDBAULL, -635, -172 },
+    { 0x936B9FCEBB25C996ULL, -608, -164 },
+    { 0xDBAC6C247D62A584ULL, -582, -156 },
+    { 0xA3AB66580D5FDAF6ULL, -555, -148 },
+    { 0xF3E2F893DEC3F126ULL, -529, -140 },
+    { 0xB5B5ADA8AAFF80B8ULL, -502, -132 },
+    { 0x87625F056C7C4A8BULL, -475, -124 },
+    { 0xC9BCFF6034C13053ULL, -449, -116 },
+    { 0x964E858C91BA2655ULL, -422, -108 },
+    { 0xDFF9772470297EBDULL, -396, -100 },
+    { 0xA6DFBD9FB8E5B88FULL, -369, -92 },
+    { 0xF8A95FCF88747D94ULL, -343, -84 },
+    { 0xB94470938FA89BCFULL, -316, -76 },
+    { 0x8A08F0F8BF0F156BULL, -289, -68 },
+    { 0xCDB02555653131B6ULL, -263, -60 },
+    { 0x993FE2C6D07B7FACULL, -236, -52 },
+    { 0xE45C10C42A2B3B06ULL, -210, -44 },
+    { 0xAA242499697392D3ULL, -183, -36 },
+    { 0xFD87B5F28300CA0EULL, -157, -28 },
+    { 0xBCE5086492111AEBULL, -130, -20 },
+    { 0x8CBCCC096F5088CCULL, -103, -12 },
+    { 0xD1B71758E219652CULL, -77, -4 },
+    { 0x9C40000000000000ULL, -50, 4 },
+    { 0xE8D4A51000000000ULL, -24, 12 },
+    { 0xAD78EBC5AC620000ULL, 3, 20 },
+    { 0x813F3978F8940984ULL, 30, 28 },
+    { 0xC097CE7BC90715B3ULL, 56, 36 },
+    { 0x8F7E32CE7BEA5C70ULL, 83, 44 },
+    { 0xD5D238A4ABE98068ULL, 109, 52 },
+    { 0x9F4F2726179A2245ULL, 136, 60 },
+    { 0xED63A231D4C4FB27ULL, 162, 68 },
+    { 0xB0DE65388CC8ADA8ULL, 189, 76 },
+    { 0x83C7088E1AAB65DBULL, 216, 84 },
+    { 0xC45D1DF942711D9AULL, 242, 92 },
+    { 0x924D692CA61BE758ULL, 269, 100 },
+    { 0xDA01EE641A708DEAULL, 295, 108 },
+    { 0xA26DA3999AEF774AULL, 322, 116 },
+    { 0xF209787BB47D6B85ULL, 348, 124 },
+    { 0xB454E4A179DD1877ULL, 375, 132 },
+    { 0x865B86925B9BC5C2ULL, 402, 140 },
+    { 0xC83553C5C8965D3DULL, 428, 148 },
+    { 0x952AB45CFA97A0B3ULL, 455, 156 },
+    { 0xDE469FBD99A05FE3ULL, 481, 164 },
+    { 0xA59BC234DB398C25ULL, 508, 172 },
+    { 0xF6C69A72A3989F5CULL, 534, 180 },
+    { 0xB7DCBF5354E9BECEULL, 561, 188 },
+    { 0x88FCF317F22241E2ULL, 588, 196 },
+    { 0xCC20CE9BD35C78A5ULL, 614, 204 },
+    { 0x98165AF37B2153DFULL, 641, 212 },
+    { 0xE2A0B5DC971F303AULL, 667, 220 },
+    { 0xA8D9D1535CE3B396ULL, 694, 228 },
+    { 0xFB9B7CD9A4A7443CULL, 720, 236 },
+    { 0xBB764C4CA7A44410ULL, 747, 244 },
+    { 0x8BAB8EEFB6409C1AULL, 774, 252 },
+    { 0xD01FEF10A657842CULL, 800, 260 },
+    { 0x9B10A4E5E9913129ULL, 827, 268 },
+    { 0xE7109BFBA19C0C9DULL, 853, 276 },
+    { 0xAC2820D9623BF429ULL, 880, 284 },
+    { 0x80444B5E7AA7CF85ULL, 907, 292 },
+    { 0xBF21E44003ACDD2DULL, 933, 300 },
+    { 0x8E679C2F5E44FF8FULL, 960, 308 },
+    { 0xD433179D9C8CB841ULL, 986, 316 },
+    { 0x9E19DB92B4E31BA9ULL, 1013, 324 },
+    { 0xEB96BF6EBADF77D9ULL, 1039, 332 },
+    { 0xAF87023B9BF0EE6BULL, 1066, 340 }
+};
+
+static const uint32_t uint32_powers_of_10[] =
+{
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+static DIY_FP diy_fp_subtract(DIY_FP x, DIY_FP y)
+{
+    // x and y have the same exponent and x.f >= y.f
+    DIY_FP result = { x.f - y.f, x.e };
+    return result;
+}
+
+static DIY_FP diy_fp_multiply(DIY_FP x, DIY_FP y)
+{
+    // upper 64 bits of the 128 bit product, rounded
+    uint64_t x_lo = x.f & 0xFFFFFFFF;
+    uint64_t x_hi = x.f >> 32;
+    uint64_t y_lo = y.f & 0xFFFFFFFF;
+    uint64_t y_hi = y.f >> 32;
+
+    uint64_t p0 = x_lo * y_lo;
+    uint64_t p1 = x_lo * y_hi;
+    uint64_t p2 = x_hi * y_lo;
+    uint64_t p3 = x_hi * y_hi;
+
+    uint64_t middle = (p0 >> 32) + (p1 & 0xFFFFFFFF) + (p2 & 0xFFFFFFFF) + ((uint64_t)1 << 31);
+
+    DIY_FP result = { p3 + (p1 >> 32) + (p2 >> 32) + (middle >> 32), x.e + y.e + 64 };
+    return result;
+}
+
+static DIY_FP diy_fp_normalize(DIY_FP x)
+{
+    // x.f is not 0
+    while ((x.f & 0xFFC0000000000000ULL) == 0)
+    {
+        x.f <<= 10;
+        x.e -= 10;
+    }
+
+    while ((x.f & 0x8000000000000000ULL) == 0)
+    {
+        x.f <<= 1;
+        x.e--;
+    }
+
+    return x;
+}
+
+// significand and biased_exponent are the raw fields of a finite, non-zero IEEE 754 number
+static BOUNDARIES compute_boundaries(uint64_t significand, int biased_exponent, int significand_bits, int exponent_bias)
+{
+    BOUNDARIES result;
+    DIY_FP v;
+    DIY_FP m_plus;
+    DIY_FP m_minus;
+
+    if (biased_exponent == 0)
+    {
+        // subnormal
+        v.f = significand;
+        v.e = 1 - exponent_bias - significand_bits;
+    }
+    else
+    {
+        v.f = significand | ((uint64_t)1 << significand_bits);
+        v.e = biased_exponent - exponent_bias - significand_bits;
+    }
+
+    // the boundaries are the middle points between v and its neighbours,
+    // the lower neighbour is closer when v is a power of 2 (the exponent changes)
+    m_plus.f = (v.f << 1) + 1;
+    m_plus.e = v.e - 1;
+
+    if ((significand == 0) && (biased_exponent > 1))
+    {
+        m_minus.f = (v.f << 2) - 1;
+        m_minus.e = v.e - 2;
+    }
+    else
+    {
+        m_minus.f = (v.f << 1) - 1;
+        m_minus.e = v.e - 1;
+    }
+
+    result.plus = diy_fp_normalize(m_plus);
+    result.minus.f = m_minus.f << (m_minus.e - result.plus.e);
+    result.minus.e = result.plus.e;
+    result.w = diy_fp_normalize(v);
+
+    return result;
+}
+
+static CACHED_POWER get_cached_power(int e)
+{
+    // pick the power of 10 c such that the exponent of the product with a number of binary exponent e is in [GRISU_ALPHA, GRISU_GAMMA],
+    // 78913 / 2^18 approximates log10(2)
+    int f = GRISU_ALPHA - e - 1;
+    int k = (f * 78913) / (1 << 18) + (f > 0);
+    int index = (-CACHED_POWERS_MIN_DECIMAL_EXPONENT + k + (CACHED_POWERS_DECIMAL_EXPONENT_STEP - 1)) / CACHED_POWERS_DECIMAL_EXPONENT_STEP;
+
+    return cached_powers[index];
+}
+
+static void grisu2_round(char* digits, int digit_count, uint64_t distance, uint64_t delta, uint64_t rest, uint64_t ten_k)
+{
+    // move the last digit down while the result gets closer to w and stays in the rounding interval
+    while ((rest < distance) &&
+        (delta - rest >= ten_k) &&
+        ((rest + ten_k < distance) || (distance - rest > rest + ten_k - distance)))
+    {
+        digits[digit_count - 1]--;
+        rest += ten_k;
+    }
+}
+
+static int grisu2_generate_digits(char* digits, int* decimal_exponent, DIY_FP m_minus, DIY_FP w, DIY_FP m_plus)
+{
+    int digit_count = 0;
+
+    uint64_t delta = diy_fp_subtract(m_plus, m_minus).f;
+    uint64_t distance = diy_fp_subtract(m_plus, w).f;
+
+    // split m_plus in an integer part (at most 32 bits) and a fractional part
+    int shift = -m_plus.e;
+    uint64_t one = (uint64_t)1 << shift;
+    uint32_t integer_part = (uint32_t)(m_plus.f >> shift);
+    uint64_t fractional_part = m_plus.f & (one - 1);
+
+    int n = (int)integer_to_string_uint32_digit_count(integer_part);
+    uint32_t power_of_10 = uint32_powers_of_10[n - 1];
+
+    while (n > 0)
+    {
+        uint32_t digit = integer_part / power_of_10;
+        integer_part %= power_of_10;
+        digits[digit_count++] = (char)('0' + digit);
+        n--;
+
+        uint64_t rest = ((uint64_t)integer_part << shift) + fractional_part;
+        if (rest <= delta)
+        {
+            *decimal_exponent += n;
+            grisu2_round(digits, digit_count, distance, delta, rest, (uint64_t)power_of_10 << shift);
+            return digit_count;
+        }
+
+        power_of_10 /= 10;
+    }
+
+    // the integer part is not enough, continue with the fractional part
+    int m = 0;
+    for (;;)
+    {
+        fractional_part *= 10;
+        delta *= 10;
+        distance *= 10;
+        digits[digit_count++] = (char)('0' + (fractional_part >> shift));
+        fractional_part &= one - 1;
+        m++;
+
+        if (fractional_part <= delta)
+        {
+            break;
+        }
+    }
+
+    *decimal_exponent -= m;
+    grisu2_round(digits, digit_count, distance, delta, fractional_part, one);
+    return digit_count;
+}
+
+static int grisu2(char* digits, int* decimal_exponent, uint64_t significand, int biased_exponent, int significand_bits, int exponent_bias)
+{
+    BOUNDARIES boundaries = compute_boundaries(significand, biased_exponent, significand_bits, exponent_bias);
+    CACHED_POWER cached_power = get_cached_power(boundaries.plus.e);
+    DIY_FP c_minus_k = { cached_power.f, cached_power.e };
+
+    DIY_FP w = diy_fp_multiply(boundaries.w, c_minus_k);
+    DIY_FP w_minus = diy_fp_multiply(boundaries.minus, c_minus_k);
+    DIY_FP w_plus = diy_fp_multiply(boundaries.plus, c_minus_k);
+
+    // the products can be off by 1 ulp, shrink the interval so that all the numbers in it are safe
+    DIY_FP m_minus = { w_minus.f + 1, w_minus.e };
+    DIY_FP m_plus = { w_plus.f - 1, w_plus.e };
+
+    *decimal_exponent = -cached_power.k;
+    return grisu2_generate_digits(digits, decimal_exponent, m_minus, w, m_plus);
+}
+
+// writes digits * 10^decimal_exponent at pos and returns the position after the last character written
+static char* format_digits(char* pos, const char* digits, int digit_count, int decimal_exponent)
+{
+    // n is the position of the decimal point relative to the first digit
+    int n = digit_count + decimal_exponent;
+
+    if ((digit_count <= n) && (n <= FIXED_NOTATION_MAX_EXPONENT))
+    {
+        /* Codes_SRS_FLOATING_POINT_TO_STRING_01_006: [ If the value is an integer with at most 15 digits, the floating_point_to_string functions shall write the digits followed by as many zeros as needed. ]*/
+        (void)memcpy(pos, digits, digit_count);
+        pos += digit_count;
+        (void)memset(pos, '0', n - digit_count);
+        pos += n - digit_count;
+    }
+    else if ((0 < n) && (n <= FIXED_NOTATION_MAX_EXPONENT))
+    {
+        /* Codes_SRS_FLOATING_POINT_TO_STRING_01_007: [ If the integer part of the value is not 0 and has at most 15 digits, the floating_point_to_string functions shall write the digits with a . after the digits of the integer part. ]*/
+        (void)memcpy(pos, digits, n);
+        pos += n;
+        *pos++ = '.';
+        (void)memcpy(pos, digits + n, digit_count - n);
+        pos += digit_count - n;
+    }
+    else if ((FIXED_NOTATION_MIN_EXPONENT < n) && (n <= 0))
+    {
+        /* Codes_SRS_FLOATING_POINT_TO_STRING_01_008: [ If the absolute value is less than 1 and at least 0.0001, the floating_point_to_string functions shall write 0. followed by the zeros after the decimal point and the digits. ]*/
+        *pos++ = '0';
+        *pos++ = '.';
+        (void)memset(pos, '0', -n);
+        pos += -n;
+        (void)memcpy(pos, digits, digit_count);
+        pos += digit_count;
+    }
+    else
+    {
+        /* Codes_SRS_FLOATING_POINT_TO_STRING_01_009: [ Otherwise the floating_point_to_string functions shall write the first digit, a . followed by the other digits if there are any, e, the sign of the exponent and the exponent with at least 2 digits. ]*/
+        int exponent = n - 1;
+
+        *pos++ = digits[0];
+        if (digit_count > 1)
+        {
+            *pos++ = '.';
+            (void)memcpy(pos, digits + 1, digit_count - 1);
+            pos += digit_count - 1;
+        }
+
+        *pos++ = 'e';
+        if (exponent < 0)
+        {
+            *pos++ = '-';
+            exponent = -exponent;
+        }
+        else
+        {
+            *pos++ = '+';
+        }
+
+        if (exponent >= 100)
+        {
+            *pos++ = (char)('0' + exponent / 100);
+            exponent %= 100;
+        }
+        *pos++ = (char)('0' + exponent / 10);
+        *pos++ = (char)('0' + exponent % 10);
+    }
+
+    return pos;
+}
+
+static int write_floating_point(uint64_t significand, int biased_exponent, bool is_negative, int significand_bits, int exponent_bias, int max_biased_exponent, char* buffer, size_t buffer_length)
+{
+    char temp[FLOATING_POINT_TO_STRING_MAX_LENGTH];
+    char* pos = temp;
+
+    if ((biased_exponent == max_biased_exponent) && (significand != 0))
+    {
+        /* Codes_SRS_FLOATING_POINT_TO_STRING_01_001: [ If value is NaN, the floating_point_to_string functions shall produce nan. ]*/
+        (void)memcpy(pos, "nan", 3);
+        pos += 3;
+    }
+    else
+    {
+        if (is_negative)
+        {
+            /* Codes_SRS_FLOATING_POINT_TO_STRING_01_005: [ If value is negative (including -0 and -inf), the floating_point_to_string functions shall write a - sign first. ]*/
+            *pos++ = '-';
+        }
+
+        if (biased_exponent == max_biased_exponent)
+        {
+            /* Codes_SRS_FLOATING_POINT_TO_STRING_01_002: [ If value is infinite, the floating_point_to_string functions shall produce inf. ]*/
+            (void)memcpy(pos, "inf", 3);
+            pos += 3;
+        }
+        else if ((biased_exponent == 0) && (significand == 0))
+        {
+            /* Codes_SRS_FLOATING_POINT_TO_STRING_01_003: [ If value is 0, the floating_point_to_string functions shall produce 0. ]*/
+            *pos++ = '0';
+        }
+        else
+        {
+            /* Codes_SRS_FLOATING_POINT_TO_STRING_01_004: [ Otherwise the floating_point_to_string functions shall compute with Grisu2 the decimal digits and the decimal exponent of a number that is inside the rounding interval of value in its own precision (float or double). ]*/
+            char digits[MAX_DIGIT_COUNT + 1];
+            int decimal_exponent;
+            int digit_count = grisu2(digits, &decimal_exponent, significand, biased_exponent, significand_bits, exponent_bias);
+            pos = format_digits(pos, digits, digit_count, decimal_exponent);
+        }
+    }
+
+    size_t length = (size_t)(pos - temp);
+
+    if ((buffer == NULL) || (buffer_length == 0))
+    {
+        /* Codes_SRS_FLOATING_POINT_TO_STRING_01_010: [ If buffer is NULL or buffer_length is 0, the floating_point_to_string functions shall only return the length of the string representation. ]*/
+    }
+    else if (buffer_length > length)
+    {
+        /* Codes_SRS_FLOATING_POINT_TO_STRING_01_011: [ If the string representation fits in buffer, the floating_point_to_string functions shall copy it to buffer, followed by a zero terminator. ]*/
+        (void)memcpy(buffer, temp, length);
+        buffer[length] = '\0';
+    }
+    else
+    {
+        /* Codes_SRS_FLOATING_POINT_TO_STRING_01_012: [ Otherwise the floating_point_to_string functions shall copy the first buffer_length - 1 characters of the string representation to buffer, followed by a zero terminator. ]*/
+        (void)memcpy(buffer, temp, buffer_length - 1);
+        buffer[buffer_length - 1] = '\0';
+    }
+
+    /* Codes_SRS_FLOATING_POINT_TO_STRING_01_013: [ The floating_point_to_string functions shall return the number of characters of the string representation, excluding the zero terminator. ]*/
+    return (int)length;
+}
+
+int floating_point_to_string_double(double value, char* buffer, size_t buffer_length)
+{
+    uint64_t bits;
+    (void)memcpy(&bits, &value, sizeof(bits));
+
+    return write_floating_point(
+        bits & (((uint64_t)1 << DOUBLE_SIGNIFICAND_BITS) - 1),
+        (int)((bits >> DOUBLE_SIGNIFICAND_BITS) & DOUBLE_MAX_BIASED_EXPONENT),
+        (bits >> 63) != 0,
+        DOUBLE_SIGNIFICAND_BITS, DOUBLE_EXPONENT_BIAS, DOUBLE_MAX_BIASED_EXPONENT,
+        buffer, buffer_length);
+}
+
+int floating_point_to_string_float(float value, char* buffer, size_t buffer_length)
+{
+    uint32_t bits;
+    (void)memcpy(&bits, &value, sizeof(bits));
+
+    return write_floating_point(
+        bits & (((uint32_t)1 << FLOAT_SIGNIFICAND_BITS) - 1),
+        (int)((bits >> FLOAT_SIGNIFICAND_BITS) & FLOAT_MAX_BIASED_EXPONENT),
+        (bits >> 31) != 0,
+        FLOAT_SIGNIFICAND_BITS, FLOAT_EXPONENT_BIAS, FLOAT_MAX_BIASED_EXPONENT,
+        buffer, buffer_length);
+}
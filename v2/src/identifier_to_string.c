@@ -0,0 +1,281 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "c_logging/identifier_to_string.h"
+
+static const char hex_digits[16] =
+{
+    '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'
+};
+
+// number of bytes in each dash separated group of a UUID
+static const uint8_t uuid_group_sizes[] = { 4, 2, 2, 2, 6 };
+
+static size_t write_uuid(char* destination, const uint8_t* uuid)
+{
+    char* pos = destination;
+    const uint8_t* source = uuid;
+
+    for (size_t group = 0; group < sizeof(uuid_group_sizes); group++)
+    {
+        if (group > 0)
+        {
+            *pos++ = '-';
+        }
+
+        for (uint8_t i = 0; i < uuid_group_sizes[group]; i++)
+        {
+            *pos++ = hex_digits[*source >> 4];
+            *pos++ = hex_digits[*source & 0x0F];
+            source++;
+        }
+    }
+
+    return (size_t)(pos - destination);
+}
+
+static size_t write_decimal_byte(char* destination, uint8_t value)
+{
+    size_t length;
+
+    if (value >= 100)
+    {
+        destination[0] = (char)('0' + (value / 100));
+        destination[1] = (char)('0' + ((value / 10) % 10));
+        destination[2] = (char)('0' + (value % 10));
+        length = 3;
+    }
+    else if (value >= 10)
+    {
+        destination[0] = (char)('0' + (value / 10));
+        destination[1] = (char)('0' + (value % 10));
+        length = 2;
+    }
+    else
+    {
+        destination[0] = (char)('0' + value);
+        length = 1;
+    }
+
+    return length;
+}
+
+static size_t write_ipv4_address(char* destination, const uint8_t* address)
+{
+    char* pos = destination;
+
+    for (size_t i = 0; i < 4; i++)
+    {
+        if (i > 0)
+        {
+            *pos++ = '.';
+        }
+        pos += write_decimal_byte(pos, address[i]);
+    }
+
+    return (size_t)(pos - destination);
+}
+
+// writes a 16 bit group without leading zeros
+static size_t write_hex_group(char* destination, uint16_t group)
+{
+    size_t length = 0;
+    bool started = false;
+
+    for (int shift = 12; shift >= 0; shift -= 4)
+    {
+        uint8_t nibble = (uint8_t)((group >> shift) & 0x0F);
+        if (started || (nibble != 0) || (shift == 0))
+        {
+            destination[length++] = hex_digits[nibble];
+            started = true;
+        }
+    }
+
+    return length;
+}
+
+static size_t write_ipv6_address(char* destination, const uint8_t* address)
+{
+    static const uint8_t ipv4_mapped_prefix[12] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF };
+    char* pos = destination;
+
+    if (memcmp(address, ipv4_mapped_prefix, sizeof(ipv4_mapped_prefix)) == 0)
+    {
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_007: [ For an IPv4-mapped address (::ffff:0:0/96), ipv6_address_to_string shall produce ::ffff: followed by the dotted decimal form of the last 4 bytes. ]*/
+        (void)memcpy(pos, "::ffff:", sizeof("::ffff:") - 1);
+        pos += sizeof("::ffff:") - 1;
+        pos += write_ipv4_address(pos, address + 12);
+    }
+    else
+    {
+        uint16_t groups[8];
+        size_t best_run_start = 0;
+        size_t best_run_length = 0;
+        size_t run_start = 0;
+        size_t run_length = 0;
+
+        for (size_t i = 0; i < 8; i++)
+        {
+            groups[i] = (uint16_t)((address[i * 2] << 8) | address[(i * 2) + 1]);
+
+            if (groups[i] == 0)
+            {
+                if (run_length == 0)
+                {
+                    run_start = i;
+                }
+                run_length++;
+
+                if (run_length > best_run_length)
+                {
+                    best_run_start = run_start;
+                    best_run_length = run_length;
+                }
+            }
+            else
+            {
+                run_length = 0;
+            }
+        }
+
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_006: [ ipv6_address_to_string shall replace the longest run of 2 or more zero groups (the first one when several runs have the same length) with ::. ]*/
+        if (best_run_length < 2)
+        {
+            best_run_length = 0;
+            best_run_start = 8;
+        }
+
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_005: [ ipv6_address_to_string shall produce the 8 groups of 16 bits of address as lowercase hex digits without leading zeros, separated by :. ]*/
+        for (size_t i = 0; i < 8; i++)
+        {
+            if (i == best_run_start)
+            {
+                *pos++ = ':';
+                *pos++ = ':';
+                i += best_run_length - 1;
+            }
+            else
+            {
+                if ((i > 0) && (i != best_run_start + best_run_length))
+                {
+                    *pos++ = ':';
+                }
+                pos += write_hex_group(pos, groups[i]);
+            }
+        }
+    }
+
+    return (size_t)(pos - destination);
+}
+
+// hands the representation built in a local buffer to the caller following the snprintf contract
+static int copy_representation(const char* representation, size_t length, char* buffer, size_t buffer_length)
+{
+    if (buffer_length == 0)
+    {
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_008: [ If buffer_length is 0, the identifier_to_string functions shall only return the length of the representation. ]*/
+    }
+    else if (buffer_length > length)
+    {
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_009: [ If the representation fits in buffer, the identifier_to_string functions shall write it in buffer followed by a zero terminator. ]*/
+        (void)memcpy(buffer, representation, length);
+        buffer[length] = '\0';
+    }
+    else
+    {
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_010: [ Otherwise the identifier_to_string functions shall write the first buffer_length - 1 characters of the representation in buffer, followed by a zero terminator. ]*/
+        (void)memcpy(buffer, representation, buffer_length - 1);
+        buffer[buffer_length - 1] = '\0';
+    }
+
+    /* Codes_SRS_IDENTIFIER_TO_STRING_01_011: [ The identifier_to_string functions shall return the number of characters of the representation, excluding the zero terminator. ]*/
+    return (int)length;
+}
+
+int uuid_to_string(const uint8_t* uuid, char* buffer, size_t buffer_length)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_001: [ If the identifier (uuid or address) is NULL, the identifier_to_string functions shall fail and return a negative value. ]*/
+        (uuid == NULL) ||
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_002: [ If buffer is NULL and buffer_length is greater than 0, the identifier_to_string functions shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_length > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const uint8_t* uuid=%p, char* buffer=%p, size_t buffer_length=%zu\r\n",
+            uuid, buffer, buffer_length);
+        result = -1;
+    }
+    else if (buffer_length > UUID_TO_STRING_LENGTH)
+    {
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_003: [ uuid_to_string shall produce the 16 bytes of uuid as lowercase hex digits in 5 groups of 8, 4, 4, 4 and 12 digits separated by -. ]*/
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_009: [ If the representation fits in buffer, the identifier_to_string functions shall write it in buffer followed by a zero terminator. ]*/
+        buffer[write_uuid(buffer, uuid)] = '\0';
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_011: [ The identifier_to_string functions shall return the number of characters of the representation, excluding the zero terminator. ]*/
+        result = UUID_TO_STRING_LENGTH;
+    }
+    else
+    {
+        char representation[UUID_TO_STRING_LENGTH];
+        result = copy_representation(representation, write_uuid(representation, uuid), buffer, buffer_length);
+    }
+
+    return result;
+}
+
+int ipv4_address_to_string(const uint8_t* address, char* buffer, size_t buffer_length)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_001: [ If the identifier (uuid or address) is NULL, the identifier_to_string functions shall fail and return a negative value. ]*/
+        (address == NULL) ||
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_002: [ If buffer is NULL and buffer_length is greater than 0, the identifier_to_string functions shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_length > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const uint8_t* address=%p, char* buffer=%p, size_t buffer_length=%zu\r\n",
+            address, buffer, buffer_length);
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_004: [ ipv4_address_to_string shall produce the 4 bytes of address as decimal numbers separated by .. ]*/
+        char representation[IPV4_ADDRESS_TO_STRING_MAX_LENGTH];
+        result = copy_representation(representation, write_ipv4_address(representation, address), buffer, buffer_length);
+    }
+
+    return result;
+}
+
+int ipv6_address_to_string(const uint8_t* address, char* buffer, size_t buffer_length)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_001: [ If the identifier (uuid or address) is NULL, the identifier_to_string functions shall fail and return a negative value. ]*/
+        (address == NULL) ||
+        /* Codes_SRS_IDENTIFIER_TO_STRING_01_002: [ If buffer is NULL and buffer_length is greater than 0, the identifier_to_string functions shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_length > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const uint8_t* address=%p, char* buffer=%p, size_t buffer_length=%zu\r\n",
+            address, buffer, buffer_length);
+        result = -1;
+    }
+    else
+    {
+        char representation[IPV6_ADDRESS_TO_STRING_MAX_LENGTH];
+        result = copy_representation(representation, write_ipv6_address(representation, address), buffer, buffer_length);
+    }
+
+    return result;
+}
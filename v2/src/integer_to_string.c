@@ -0,0 +1,220 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#include "c_logging/integer_to_string.h"
+
+static const char digit_pairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+// powers_of_10[i] is the smallest number with i + 1 digits (except for index 0, so that 0 has 1 digit)
+static const uint64_t powers_of_10[] =
+{
+    0,
+    10ULL,
+    100ULL,
+    1000ULL,
+    10000ULL,
+    100000ULL,
+    1000000ULL,
+    10000000ULL,
+    100000000ULL,
+    1000000000ULL,
+    10000000000ULL,
+    100000000000ULL,
+    1000000000000ULL,
+    10000000000000ULL,
+    100000000000000ULL,
+    1000000000000000ULL,
+    10000000000000000ULL,
+    100000000000000000ULL,
+    1000000000000000000ULL,
+    10000000000000000000ULL
+};
+
+// number of bits needed to represent value, value has to be non-zero
+static uint32_t bit_length_uint64(uint64_t value)
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    (void)_BitScanReverse64(&index, value);
+    return (uint32_t)index + 1;
+#elif defined(_MSC_VER)
+    unsigned long index;
+    uint32_t result;
+    if (_BitScanReverse(&index, (unsigned long)(value >> 32)))
+    {
+        result = (uint32_t)index + 33;
+    }
+    else
+    {
+        (void)_BitScanReverse(&index, (unsigned long)value);
+        result = (uint32_t)index + 1;
+    }
+    return result;
+#elif defined(__GNUC__)
+    return 64 - (uint32_t)__builtin_clzll(value);
+#else
+    uint32_t result = 0;
+    while (value != 0)
+    {
+        value >>= 1;
+        result++;
+    }
+    return result;
+#endif
+}
+
+uint32_t integer_to_string_uint64_digit_count(uint64_t value)
+{
+    /* Codes_SRS_INTEGER_TO_STRING_01_001: [ integer_to_string_uint64_digit_count shall return the number of decimal digits of value (1 for 0). ]*/
+    // 1233 / 4096 approximates log10(2), which gives the digit count or one less, the powers of 10 table settles it
+    uint32_t approximation = (bit_length_uint64(value | 1) * 1233) >> 12;
+    return approximation + (value >= powers_of_10[approximation]);
+}
+
+uint32_t integer_to_string_uint32_digit_count(uint32_t value)
+{
+    /* Codes_SRS_INTEGER_TO_STRING_01_002: [ integer_to_string_uint32_digit_count shall return the number of decimal digits of value (1 for 0). ]*/
+    return integer_to_string_uint64_digit_count(value);
+}
+
+uint32_t integer_to_string_int64_length(int64_t value)
+{
+    /* Codes_SRS_INTEGER_TO_STRING_01_008: [ integer_to_string_int64_length shall return the number of decimal digits of the absolute value of value, plus 1 if value is negative. ]*/
+    return (value < 0) ?
+        integer_to_string_uint64_digit_count((uint64_t)0 - (uint64_t)value) + 1 :
+        integer_to_string_uint64_digit_count((uint64_t)value);
+}
+
+// writes the digits of value backwards, the last digit being written just before end
+static void write_digits_uint32(char* end, uint32_t value)
+{
+    while (value >= 100)
+    {
+        uint32_t pair_index = (value % 100) * 2;
+        value /= 100;
+        end -= 2;
+        (void)memcpy(end, &digit_pairs[pair_index], 2);
+    }
+
+    if (value >= 10)
+    {
+        (void)memcpy(end - 2, &digit_pairs[value * 2], 2);
+    }
+    else
+    {
+        end[-1] = (char)('0' + value);
+    }
+}
+
+static void write_digits_uint64(char* end, uint64_t value)
+{
+    // only use 64 bit divisions while the value does not fit in 32 bits
+    while (value > UINT32_MAX)
+    {
+        uint32_t pair_index = (uint32_t)(value % 100) * 2;
+        value /= 100;
+        end -= 2;
+        (void)memcpy(end, &digit_pairs[pair_index], 2);
+    }
+
+    write_digits_uint32(end, (uint32_t)value);
+}
+
+static int write_integer(uint64_t magnitude, bool is_negative, char* buffer, size_t buffer_length)
+{
+    size_t length = integer_to_string_uint64_digit_count(magnitude) + (is_negative ? 1 : 0);
+
+    if ((buffer == NULL) || (buffer_length == 0))
+    {
+        /* Codes_SRS_INTEGER_TO_STRING_01_004: [ If buffer is NULL or buffer_length is 0, the integer_to_string functions shall only return the length of the decimal representation. ]*/
+    }
+    else if (buffer_length > length)
+    {
+        /* Codes_SRS_INTEGER_TO_STRING_01_005: [ If the decimal representation fits in buffer, the integer_to_string functions shall write it in buffer, 2 digits at a time, followed by a zero terminator. ]*/
+        buffer[0] = '-';
+        write_digits_uint64(buffer + length, magnitude);
+        buffer[length] = '\0';
+    }
+    else
+    {
+        /* Codes_SRS_INTEGER_TO_STRING_01_006: [ Otherwise the integer_to_string functions shall write the first buffer_length - 1 characters of the decimal representation in buffer, followed by a zero terminator. ]*/
+        char temp[INTEGER_TO_STRING_MAX_LENGTH];
+        temp[0] = '-';
+        write_digits_uint64(temp + length, magnitude);
+        (void)memcpy(buffer, temp, buffer_length - 1);
+        buffer[buffer_length - 1] = '\0';
+    }
+
+    /* Codes_SRS_INTEGER_TO_STRING_01_003: [ The integer_to_string functions shall return the number of characters of the decimal representation of value (including the - sign for negative values), excluding the zero terminator. ]*/
+    return (int)length;
+}
+
+int integer_to_string_uint64(uint64_t value, char* buffer, size_t buffer_length)
+{
+    return write_integer(value, false, buffer, buffer_length);
+}
+
+int integer_to_string_int64(int64_t value, char* buffer, size_t buffer_length)
+{
+    /* Codes_SRS_INTEGER_TO_STRING_01_007: [ For a negative value, integer_to_string_int64 and integer_to_string_int32 shall write a - sign followed by the digits of the absolute value. ]*/
+    return (value < 0) ?
+        write_integer((uint64_t)0 - (uint64_t)value, true, buffer, buffer_length) :
+        write_integer((uint64_t)value, false, buffer, buffer_length);
+}
+
+int integer_to_string_uint32(uint32_t value, char* buffer, size_t buffer_length)
+{
+    return write_integer(value, false, buffer, buffer_length);
+}
+
+uint32_t integer_to_string_write_uint64(uint64_t value, char* buffer)
+{
+    /* Codes_SRS_INTEGER_TO_STRING_01_009: [ integer_to_string_write_uint64 and integer_to_string_write_int64 shall write the decimal representation of value at buffer, 2 digits at a time, without a zero terminator. ]*/
+    uint32_t length = integer_to_string_uint64_digit_count(value);
+    write_digits_uint64(buffer + length, value);
+    /* Codes_SRS_INTEGER_TO_STRING_01_010: [ integer_to_string_write_uint64 and integer_to_string_write_int64 shall return the number of characters written. ]*/
+    return length;
+}
+
+uint32_t integer_to_string_write_int64(int64_t value, char* buffer)
+{
+    uint32_t result;
+
+    if (value < 0)
+    {
+        /* Codes_SRS_INTEGER_TO_STRING_01_011: [ For a negative value, integer_to_string_write_int64 shall write a - sign followed by the digits of the absolute value. ]*/
+        buffer[0] = '-';
+        result = integer_to_string_write_uint64((uint64_t)0 - (uint64_t)value, buffer + 1) + 1;
+    }
+    else
+    {
+        result = integer_to_string_write_uint64((uint64_t)value, buffer);
+    }
+
+    return result;
+}
+
+int integer_to_string_int32(int32_t value, char* buffer, size_t buffer_length)
+{
+    /* Codes_SRS_INTEGER_TO_STRING_01_007: [ For a negative value, integer_to_string_int64 and integer_to_string_int32 shall write a - sign followed by the digits of the absolute value. ]*/
+    return integer_to_string_int64(value, buffer, buffer_length);
+}
@@ -1,9 +1,17 @@
 // Copyright (c) Microsoft. All rights reserved.
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
+#include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <inttypes.h>
+#include <errno.h>
+
+#ifdef _WIN32
+#include "windows.h"
+#endif
 
 #include "macro_utils/macro_utils.h"
 
@@ -53,23 +61,74 @@ uint32_t internal_log_context_get_values_data_length_or_zero(LOG_CONTEXT_HANDLE
     return (log_context == NULL) ? 0 : log_context->values_data_length;
 }
 
+// a view (as passed to the sinks when the ambient context is merged) has no values data, its pairs point into other contexts
+static bool is_view(LOG_CONTEXT_HANDLE log_context)
+{
+    return (log_context->values_data == NULL);
+}
+
+// copies the name of a parent pair at the same offset in the data area of dest_log_context if it is stored in the parent data area
+static const char* copy_name_at_same_offset(LOG_CONTEXT_HANDLE dest_log_context, LOG_CONTEXT_HANDLE parent_log_context, const char* parent_name)
+{
+    const char* result;
+    uintptr_t parent_name_offset = (uintptr_t)parent_name - (uintptr_t)parent_log_context->values_data;
+
+    if (((uintptr_t)parent_name >= (uintptr_t)parent_log_context->values_data) &&
+        (parent_name_offset < parent_log_context->values_data_length))
+    {
+        /* Codes_SRS_LOG_CONTEXT_01_043: [ If the name of a parent property/value pair is stored in the data area of the parent context (as done by log_context_builder_freeze), the name shall be copied at the same offset in the data area of the created context. ]*/
+        char* dest_name = (char*)(dest_log_context->values_data + 1 + parent_name_offset);
+        (void)memcpy(dest_name, parent_name, strlen(parent_name) + 1);
+        result = dest_name;
+    }
+    else
+    {
+        result = parent_name;
+    }
+
+    return result;
+}
+
+static int copy_pair_at_same_offset(LOG_CONTEXT_HANDLE dest_log_context, LOG_CONTEXT_HANDLE parent_log_context, uint32_t index)
+{
+    int result;
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* parent_pair = &parent_log_context->property_value_pairs_ptr[index];
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR* dest_pair = &dest_log_context->property_value_pairs_ptr[index + 1];
+
+    dest_pair->name = copy_name_at_same_offset(dest_log_context, parent_log_context, parent_pair->name);
+    dest_pair->type = parent_pair->type;
+    dest_pair->value = (void*)(dest_log_context->values_data + 1 + ((uint8_t*)parent_pair->value - parent_log_context->values_data));
+    if (dest_pair->type->copy(dest_pair->value, parent_pair->value) != 0)
+    {
+        (void)printf("Error copying property value/pair %" PRIu32 "\r\n", index);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        result = 0;
+    }
+
+    return result;
+}
+
 int internal_log_context_init_from_parent(LOG_CONTEXT_HANDLE dest_log_context, LOG_CONTEXT_HANDLE parent_log_context)
 {
     int result;
 
     /* Copy all the pairs from the parent */
-    if (parent_log_context != NULL)
+    if ((parent_log_context != NULL) && is_view(parent_log_context))
+    {
+        /* Codes_SRS_LOG_CONTEXT_01_058: [ If parent_context is a view with no values data, LOG_CONTEXT_LOCAL_DEFINE shall copy the property/value pairs of parent_context referencing the same values. ]*/
+        (void)memcpy(&dest_log_context->property_value_pairs_ptr[1], parent_log_context->property_value_pairs_ptr, sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) * parent_log_context->property_value_pair_count);
+        result = 0;
+    }
+    else if (parent_log_context != NULL)
     {
-        size_t prop_copy_index;
+        uint32_t prop_copy_index;
         for (prop_copy_index = 0; prop_copy_index < parent_log_context->property_value_pair_count; prop_copy_index++)
         {
-            dest_log_context->property_value_pairs_ptr[prop_copy_index + 1].name = parent_log_context->property_value_pairs_ptr[prop_copy_index].name;
-            dest_log_context->property_value_pairs_ptr[prop_copy_index + 1].type = parent_log_context->property_value_pairs_ptr[prop_copy_index].type;
-
-            dest_log_context->property_value_pairs_ptr[prop_copy_index + 1].value = (void*)(dest_log_context->values_data + 1 + ((uint8_t*)parent_log_context->property_value_pairs_ptr[prop_copy_index].value - parent_log_context->values_data));
-            if (dest_log_context->property_value_pairs_ptr[prop_copy_index + 1].type->copy(dest_log_context->property_value_pairs_ptr[prop_copy_index + 1].value, parent_log_context->property_value_pairs_ptr[prop_copy_index].value) != 0)
+            if (copy_pair_at_same_offset(dest_log_context, parent_log_context, prop_copy_index) != 0)
             {
-                (void)printf("Error copying property value/pair %zu\r\n", prop_copy_index);
                 break;
             }
         }
@@ -91,26 +150,350 @@ int internal_log_context_init_from_parent(LOG_CONTEXT_HANDLE dest_log_context, L
     return result;
 }
 
-LOG_CONTEXT_HANDLE log_context_create(LOG_CONTEXT_HANDLE parent_context, uint32_t properties_count, uint32_t data_size)
+const LOG_CONTEXT_PROPERTY_TYPE_IF* internal_log_context_get_owning_property_type(const LOG_CONTEXT_PROPERTY_TYPE_IF* property_type)
 {
-    /* Codes_SRS_LOG_CONTEXT_01_001: [ LOG_CONTEXT_CREATE shall allocate memory for the log context. ]*/
-    LOG_CONTEXT_HANDLE result =  malloc(sizeof(LOG_CONTEXT) + (sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) * properties_count) + data_size);
-    if (result == NULL)
+    const LOG_CONTEXT_PROPERTY_TYPE_IF* result;
+
+    switch (property_type->type_tag)
     {
-        /* Codes_SRS_LOG_CONTEXT_01_002: [ If any error occurs, LOG_CONTEXT_CREATE shall fail and return NULL. ]*/
-        (void)printf("malloc(sizeof(LOG_CONTEXT)) failed, properties_count=%" PRIu32 ", data_size=%" PRIu32 "\r\n",
-            properties_count, data_size);
+    default:
+        result = property_type;
+        break;
+
+    /* serialize of the borrowed types writes exactly what the owning type stores in a context */
+    case LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr:
+        result = &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr);
+        break;
+    case LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary:
+        result = &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary);
+        break;
+    }
+
+    return result;
+}
+
+static bool is_borrowed(const LOG_CONTEXT_PROPERTY_TYPE_IF* property_type)
+{
+    return (internal_log_context_get_owning_property_type(property_type) != property_type);
+}
+
+// size of the value of a pair once copied in a context owning its data
+static int get_owned_value_size(const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pair)
+{
+    return is_borrowed(pair->type) ? pair->type->serialize(pair->value, NULL, 0) : pair->type->get_size(pair->value);
+}
+
+static int copy_owned_value(void* dst_value, int value_size, const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pair)
+{
+    int result;
+
+    if (value_size < 0)
+    {
+        result = MU_FAILURE;
+    }
+    else if (is_borrowed(pair->type))
+    {
+        result = (pair->type->serialize(pair->value, dst_value, (size_t)value_size) == value_size) ? 0 : MU_FAILURE;
+    }
+    else
+    {
+        result = pair->type->copy(dst_value, pair->value);
+    }
+
+    return result;
+}
+
+// a pair of a view points into other contexts and a borrowed value points into the memory of the caller, neither is owned by parent_log_context
+static bool needs_owned_copy(LOG_CONTEXT_HANDLE parent_log_context, const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pair)
+{
+    return is_view(parent_log_context) || is_borrowed(pair->type);
+}
+
+// number of bytes the copy of the pairs of parent_log_context takes in the data area of a context owning its data:
+// the parent data area, followed by the pairs that need their own copy (names and values of a view, borrowed values)
+static int get_owned_copy_data_length(LOG_CONTEXT_HANDLE parent_log_context, uint32_t* copy_data_length)
+{
+    int result;
+
+    if (parent_log_context == NULL)
+    {
+        *copy_data_length = 0;
+        result = 0;
+    }
+    else
+    {
+        uint32_t i;
+        uint32_t length = parent_log_context->values_data_length;
+
+        for (i = 0; i < parent_log_context->property_value_pair_count; i++)
+        {
+            const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pair = &parent_log_context->property_value_pairs_ptr[i];
+
+            if (needs_owned_copy(parent_log_context, pair))
+            {
+                size_t name_size = is_view(parent_log_context) ? strlen(pair->name) + 1 : 0;
+                int value_size = get_owned_value_size(pair);
+
+                if (value_size < 0)
+                {
+                    (void)printf("Cannot get the size of the value of property %s\r\n", pair->name);
+                    break;
+                }
+                else if ((uint64_t)length + name_size + (uint64_t)value_size > UINT32_MAX)
+                {
+                    (void)printf("Data length overflow: length = %" PRIu32 ", name_size = %zu, value_size = %d\r\n",
+                        length, name_size, value_size);
+                    break;
+                }
+                else
+                {
+                    length += (uint32_t)name_size + (uint32_t)value_size;
+                }
+            }
+        }
+
+        if (i < parent_log_context->property_value_pair_count)
+        {
+            result = MU_FAILURE;
+        }
+        else
+        {
+            *copy_data_length = length;
+            result = 0;
+        }
+    }
+
+    return result;
+}
+
+// copies the pairs of parent_log_context so that dest_log_context does not reference any memory of parent_log_context
+static int copy_from_parent_owning_values(LOG_CONTEXT_HANDLE dest_log_context, LOG_CONTEXT_HANDLE parent_log_context)
+{
+    int result;
+
+    if (parent_log_context == NULL)
+    {
+        result = 0;
     }
     else
     {
-        result->property_value_pairs_ptr = (void*)((uint8_t*)result + sizeof(LOG_CONTEXT));
-        result->property_value_pair_count = properties_count;
-        result->values_data = (void*)(result->property_value_pairs_ptr + properties_count);
-        result->values_data_length = data_size;
+        /* the pairs that need their own copy go after the copy of the parent data area */
+        uint8_t* data_pos = dest_log_context->values_data + 1 + parent_log_context->values_data_length;
+        uint32_t i;
 
         /* Codes_SRS_LOG_CONTEXT_01_014: [ If parent_context is non-NULL, the created context shall copy all the property/value pairs of parent_context. ]*/
-        internal_log_context_init_from_parent(result, parent_context);
-        /* return as is */
+        for (i = 0; i < parent_log_context->property_value_pair_count; i++)
+        {
+            const LOG_CONTEXT_PROPERTY_VALUE_PAIR* parent_pair = &parent_log_context->property_value_pairs_ptr[i];
+
+            if (!needs_owned_copy(parent_log_context, parent_pair))
+            {
+                if (copy_pair_at_same_offset(dest_log_context, parent_log_context, i) != 0)
+                {
+                    break;
+                }
+            }
+            else
+            {
+                LOG_CONTEXT_PROPERTY_VALUE_PAIR* dest_pair = &dest_log_context->property_value_pairs_ptr[i + 1];
+                int value_size = get_owned_value_size(parent_pair);
+
+                if (is_view(parent_log_context))
+                {
+                    /* Codes_SRS_LOG_CONTEXT_01_044: [ If parent_context is a view with no values data (as passed to the sinks when the ambient context is merged), LOG_CONTEXT_CREATE shall copy the names and the values of the property/value pairs of parent_context in the data area of the created context. ]*/
+                    size_t name_size = strlen(parent_pair->name) + 1;
+                    (void)memcpy(data_pos, parent_pair->name, name_size);
+                    dest_pair->name = (const char*)data_pos;
+                    data_pos += name_size;
+                }
+                else
+                {
+                    dest_pair->name = copy_name_at_same_offset(dest_log_context, parent_log_context, parent_pair->name);
+                }
+
+                /* Codes_SRS_LOG_CONTEXT_01_059: [ If a property/value pair of parent_context has a borrowed type (borrowed_ascii_char_ptr or borrowed_binary), LOG_CONTEXT_CREATE shall copy what the value points to in the data area of the created context and store the pair with the owning type (ascii_char_ptr or binary). ]*/
+                dest_pair->type = internal_log_context_get_owning_property_type(parent_pair->type);
+                dest_pair->value = data_pos;
+                if (copy_owned_value(dest_pair->value, value_size, parent_pair) != 0)
+                {
+                    (void)printf("Error copying property value/pair %" PRIu32 "\r\n", i);
+                    break;
+                }
+                data_pos += value_size;
+            }
+        }
+
+        if (i < parent_log_context->property_value_pair_count)
+        {
+            result = MU_FAILURE;
+        }
+        else
+        {
+            result = 0;
+        }
+    }
+
+    return result;
+}
+
+static void* rebase_into_values_data(const void* pointer, uintptr_t old_values_data, uint32_t old_values_data_length, uint8_t* new_values_data)
+{
+    void* result;
+    uintptr_t offset = (uintptr_t)pointer - old_values_data;
+
+    if (((uintptr_t)pointer >= old_values_data) &&
+        (offset < old_values_data_length))
+    {
+        result = new_values_data + offset;
+    }
+    else
+    {
+        /* pointing outside of the data area (string literal name, value of a view parent), stays as is */
+        result = (void*)pointer;
+    }
+
+    return result;
+}
+
+int internal_log_context_reserve(LOG_CONTEXT_FILL_STATE* fill_state, uint32_t needed_size)
+{
+    int result;
+    /* Codes_SRS_LOG_CONTEXT_01_060: [ internal_log_context_reserve shall preserve errno (and on Windows the last error) so that a value produced again after the reserve sees the same error as the first call. ]*/
+    int saved_errno = errno;
+#ifdef _WIN32
+    DWORD saved_last_error = GetLastError();
+#endif
+
+    if (fill_state->failed)
+    {
+        /* Codes_SRS_LOG_CONTEXT_01_036: [ If a previous property could not be stored, internal_log_context_reserve shall fail and return a non-zero value. ]*/
+        result = MU_FAILURE;
+    }
+    else if ((size_t)(fill_state->data_end - fill_state->data_pos) >= needed_size)
+    {
+        /* Codes_SRS_LOG_CONTEXT_01_037: [ If at least needed_size bytes are left in the context data area, internal_log_context_reserve shall succeed and return 0. ]*/
+        result = 0;
+    }
+    else
+    {
+        LOG_CONTEXT_HANDLE log_context = fill_state->log_context;
+        uint32_t used_size = (uint32_t)(fill_state->data_pos - log_context->values_data);
+        uint32_t property_value_pair_index = (uint32_t)(fill_state->property_value_pair - log_context->property_value_pairs_ptr);
+
+        if (!fill_state->can_grow)
+        {
+            /* Codes_SRS_LOG_CONTEXT_01_038: [ If the context cannot be reallocated (it was not created by LOG_CONTEXT_CREATE), internal_log_context_reserve shall fail and return a non-zero value. ]*/
+            (void)printf("Data length too big: values_data_length = %" PRIu32 ", needed_size = %" PRIu32 "\r\n",
+                used_size, needed_size);
+            result = MU_FAILURE;
+        }
+        else if (needed_size > UINT32_MAX - LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE - used_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_01_039: [ If any error occurs, internal_log_context_reserve shall fail and return a non-zero value. ]*/
+            (void)printf("Data length overflow: values_data_length = %" PRIu32 ", needed_size = %" PRIu32 "\r\n",
+                used_size, needed_size);
+            result = MU_FAILURE;
+        }
+        else
+        {
+            /* Codes_SRS_LOG_CONTEXT_01_040: [ Otherwise internal_log_context_reserve shall reallocate the context so that needed_size bytes and an extra LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE bytes are available after the values already stored. ]*/
+            uint32_t new_data_size = used_size + needed_size + LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE;
+            uintptr_t old_values_data = (uintptr_t)log_context->values_data;
+            uint32_t old_values_data_length = log_context->values_data_length;
+            LOG_CONTEXT_HANDLE new_log_context = realloc(log_context, sizeof(LOG_CONTEXT) + (sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) * log_context->property_value_pair_count) + new_data_size);
+            if (new_log_context == NULL)
+            {
+                /* Codes_SRS_LOG_CONTEXT_01_039: [ If any error occurs, internal_log_context_reserve shall fail and return a non-zero value. ]*/
+                (void)printf("realloc failed, properties_count=%" PRIu32 ", data_size=%" PRIu32 "\r\n",
+                    log_context->property_value_pair_count, new_data_size);
+                result = MU_FAILURE;
+            }
+            else
+            {
+                uint32_t i;
+
+                new_log_context->property_value_pairs_ptr = (void*)((uint8_t*)new_log_context + sizeof(LOG_CONTEXT));
+                new_log_context->values_data = (void*)(new_log_context->property_value_pairs_ptr + new_log_context->property_value_pair_count);
+                new_log_context->values_data_length = new_data_size;
+
+                for (i = 0; i < property_value_pair_index; i++)
+                {
+                    /* Codes_SRS_LOG_CONTEXT_01_041: [ internal_log_context_reserve shall update the values of all the property/value pairs already stored that point into the data area to point into the reallocated data area. ]*/
+                    new_log_context->property_value_pairs_ptr[i].value = rebase_into_values_data(new_log_context->property_value_pairs_ptr[i].value, old_values_data, old_values_data_length, new_log_context->values_data);
+                    /* Codes_SRS_LOG_CONTEXT_01_057: [ internal_log_context_reserve shall update the names of all the property/value pairs already stored that point into the data area (names copied from a frozen parent) to point into the reallocated data area. ]*/
+                    new_log_context->property_value_pairs_ptr[i].name = rebase_into_values_data(new_log_context->property_value_pairs_ptr[i].name, old_values_data, old_values_data_length, new_log_context->values_data);
+                }
+
+                fill_state->log_context = new_log_context;
+                fill_state->property_value_pair = new_log_context->property_value_pairs_ptr + property_value_pair_index;
+                fill_state->data_pos = new_log_context->values_data + used_size;
+                fill_state->data_end = new_log_context->values_data + new_data_size;
+
+                /* Codes_SRS_LOG_CONTEXT_01_042: [ internal_log_context_reserve shall succeed and return 0. ]*/
+                result = 0;
+            }
+        }
+    }
+
+    if (result != 0)
+    {
+        fill_state->failed = true;
+        fill_state->data_end = fill_state->data_pos;
+    }
+
+#ifdef _WIN32
+    SetLastError(saved_last_error);
+#endif
+    errno = saved_errno;
+
+    return result;
+}
+
+LOG_CONTEXT_HANDLE log_context_create(LOG_CONTEXT_HANDLE parent_context, uint32_t properties_count, uint32_t data_size, uint32_t* parent_data_length)
+{
+    LOG_CONTEXT_HANDLE result;
+    uint32_t copy_data_length;
+
+    if (get_owned_copy_data_length(parent_context, &copy_data_length) != 0)
+    {
+        /* Codes_SRS_LOG_CONTEXT_01_002: [ If any error occurs, LOG_CONTEXT_CREATE shall fail and return NULL. ]*/
+        result = NULL;
+    }
+    else if (data_size > UINT32_MAX - copy_data_length)
+    {
+        /* Codes_SRS_LOG_CONTEXT_01_002: [ If any error occurs, LOG_CONTEXT_CREATE shall fail and return NULL. ]*/
+        (void)printf("Data length overflow: data_size=%" PRIu32 ", copy_data_length=%" PRIu32 "\r\n",
+            data_size, copy_data_length);
+        result = NULL;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_01_001: [ LOG_CONTEXT_CREATE shall allocate memory for the log context. ]*/
+        result = malloc(sizeof(LOG_CONTEXT) + (sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) * properties_count) + data_size + copy_data_length);
+        if (result == NULL)
+        {
+            /* Codes_SRS_LOG_CONTEXT_01_002: [ If any error occurs, LOG_CONTEXT_CREATE shall fail and return NULL. ]*/
+            (void)printf("malloc(sizeof(LOG_CONTEXT)) failed, properties_count=%" PRIu32 ", data_size=%" PRIu32 ", copy_data_length=%" PRIu32 "\r\n",
+                properties_count, data_size, copy_data_length);
+        }
+        else
+        {
+            result->property_value_pairs_ptr = (void*)((uint8_t*)result + sizeof(LOG_CONTEXT));
+            result->property_value_pair_count = properties_count;
+            result->values_data = (void*)(result->property_value_pairs_ptr + properties_count);
+            result->values_data_length = data_size + copy_data_length;
+
+            if (copy_from_parent_owning_values(result, parent_context) != 0)
+            {
+                /* Codes_SRS_LOG_CONTEXT_01_002: [ If any error occurs, LOG_CONTEXT_CREATE shall fail and return NULL. ]*/
+                free(result);
+                result = NULL;
+            }
+            else if (parent_data_length != NULL)
+            {
+                *parent_data_length = copy_data_length;
+            }
+        }
     }
 
     return result;
@@ -0,0 +1,183 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logging_stacktrace.h"
+#include "c_logging/log_context.h"
+#include "c_logging/log_context_property_value_pair.h"
+#include "c_logging/log_context_property_type_if.h"
+#include "c_logging/log_context_property_type_struct.h"
+
+#include "c_logging/log_context_ambient.h"
+
+static XLOGGING_THREAD_LOCAL LOG_CONTEXT_HANDLE ambient_log_contexts[LOG_CONTEXT_AMBIENT_MAX_DEPTH];
+static XLOGGING_THREAD_LOCAL uint32_t ambient_log_context_depth;
+
+// field count of the struct property at the root of a merged view: the ambient context and the context passed to the logger
+static uint8_t merged_log_context_field_count = 2;
+
+int log_context_ambient_push(LOG_CONTEXT_HANDLE log_context)
+{
+    int result;
+
+    if (log_context == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_001: [ If log_context is NULL, log_context_ambient_push shall fail and return a non-zero value. ]*/
+        (void)printf("Invalid arguments: LOG_CONTEXT_HANDLE log_context=%p\r\n", log_context);
+        result = MU_FAILURE;
+    }
+    else if (ambient_log_context_depth == LOG_CONTEXT_AMBIENT_MAX_DEPTH)
+    {
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_002: [ If LOG_CONTEXT_AMBIENT_MAX_DEPTH contexts are already pushed on the calling thread, log_context_ambient_push shall fail and return a non-zero value. ]*/
+        (void)printf("Ambient context stack is full, depth=%" PRIu32 "\r\n", ambient_log_context_depth);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_003: [ log_context_ambient_push shall push log_context on the ambient context stack of the calling thread, making it the ambient context of the thread. ]*/
+        ambient_log_contexts[ambient_log_context_depth] = log_context;
+        ambient_log_context_depth++;
+
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_004: [ log_context_ambient_push shall succeed and return 0. ]*/
+        result = 0;
+    }
+
+    return result;
+}
+
+void log_context_ambient_pop(LOG_CONTEXT_HANDLE log_context)
+{
+    uint32_t i = ambient_log_context_depth;
+
+    while ((i > 0) && (ambient_log_contexts[i - 1] != log_context))
+    {
+        i--;
+    }
+
+    if (i == 0)
+    {
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_005: [ If log_context is not on the ambient context stack of the calling thread, log_context_ambient_pop shall return. ]*/
+        (void)printf("LOG_CONTEXT_HANDLE log_context=%p is not an ambient context\r\n", log_context);
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_006: [ log_context_ambient_pop shall remove log_context and any context pushed after it from the ambient context stack of the calling thread. ]*/
+        ambient_log_context_depth = i - 1;
+    }
+}
+
+LOG_CONTEXT_HANDLE log_context_ambient_get(void)
+{
+    /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_007: [ If no context is pushed on the calling thread, log_context_ambient_get shall return NULL. ]*/
+    /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_008: [ Otherwise log_context_ambient_get shall return the context last pushed on the calling thread. ]*/
+    return (ambient_log_context_depth == 0) ? NULL : ambient_log_contexts[ambient_log_context_depth - 1];
+}
+
+// a context created with the ambient context as parent starts with the struct property of the context followed by all the pairs of the ambient context
+static bool is_child_of(LOG_CONTEXT_HANDLE log_context, LOG_CONTEXT_HANDLE parent_log_context)
+{
+    bool result;
+
+    if (log_context->property_value_pair_count <= parent_log_context->property_value_pair_count)
+    {
+        result = false;
+    }
+    else
+    {
+        uint32_t i;
+
+        for (i = 0; i < parent_log_context->property_value_pair_count; i++)
+        {
+            const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pair = &log_context->property_value_pairs_ptr[i + 1];
+            const LOG_CONTEXT_PROPERTY_VALUE_PAIR* parent_pair = &parent_log_context->property_value_pairs_ptr[i];
+
+            /* a context that owns its data holds the borrowed values of its parent with the owning type */
+            if (((pair->type != parent_pair->type) && ((pair->type == NULL) || (parent_pair->type == NULL) || (internal_log_context_get_owning_property_type(pair->type) != internal_log_context_get_owning_property_type(parent_pair->type)))) ||
+                ((pair->name != parent_pair->name) && (strcmp(pair->name, parent_pair->name) != 0)))
+            {
+                break;
+            }
+        }
+
+        result = (i == parent_log_context->property_value_pair_count);
+    }
+
+    return result;
+}
+
+uint32_t internal_log_context_ambient_get_merged_pair_count(LOG_CONTEXT_HANDLE log_context)
+{
+    uint32_t result;
+    LOG_CONTEXT_HANDLE ambient_log_context = log_context_ambient_get();
+
+    if ((ambient_log_context == NULL) ||
+        (log_context == NULL) ||
+        (log_context == ambient_log_context) ||
+        is_child_of(log_context, ambient_log_context) ||
+        (ambient_log_context->property_value_pair_count + log_context->property_value_pair_count >= LOG_CONTEXT_AMBIENT_MAX_MERGED_PAIR_COUNT))
+    {
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_018: [ If internal_log_context_ambient_merge would not build a merged view for log_context, internal_log_context_ambient_get_merged_pair_count shall return 0. ]*/
+        result = 0;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_019: [ Otherwise internal_log_context_ambient_get_merged_pair_count shall return the number of property/value pairs of the merged view: 1 plus the number of property/value pairs of the ambient context and of log_context. ]*/
+        result = 1 + ambient_log_context->property_value_pair_count + log_context->property_value_pair_count;
+    }
+
+    return result;
+}
+
+LOG_CONTEXT_HANDLE internal_log_context_ambient_merge(LOG_CONTEXT_HANDLE log_context, LOG_CONTEXT* merged_log_context, LOG_CONTEXT_PROPERTY_VALUE_PAIR* merged_property_value_pairs)
+{
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_HANDLE ambient_log_context = log_context_ambient_get();
+
+    if (ambient_log_context == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_009: [ If there is no ambient context on the calling thread, internal_log_context_ambient_merge shall return log_context. ]*/
+        result = log_context;
+    }
+    else if ((log_context == NULL) || (log_context == ambient_log_context))
+    {
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_010: [ If log_context is NULL or it is the ambient context, internal_log_context_ambient_merge shall return the ambient context. ]*/
+        result = ambient_log_context;
+    }
+    else if (is_child_of(log_context, ambient_log_context))
+    {
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_011: [ If log_context already starts with all the property/value pairs of the ambient context (it was created with the ambient context as parent), internal_log_context_ambient_merge shall return log_context. ]*/
+        result = log_context;
+    }
+    else if (ambient_log_context->property_value_pair_count + log_context->property_value_pair_count >= LOG_CONTEXT_AMBIENT_MAX_MERGED_PAIR_COUNT)
+    {
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_012: [ If the merged view would have more than LOG_CONTEXT_AMBIENT_MAX_MERGED_PAIR_COUNT property/value pairs, internal_log_context_ambient_merge shall return log_context. ]*/
+        (void)printf("Too many properties to merge the ambient context, ambient count=%" PRIu32 ", count=%" PRIu32 "\r\n",
+            ambient_log_context->property_value_pair_count, log_context->property_value_pair_count);
+        result = log_context;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_013: [ Otherwise internal_log_context_ambient_merge shall fill merged_property_value_pairs with a struct property with 2 fields, followed by the property/value pairs of the ambient context and the property/value pairs of log_context, without copying any value. ]*/
+        merged_property_value_pairs[0].name = "";
+        merged_property_value_pairs[0].value = &merged_log_context_field_count;
+        merged_property_value_pairs[0].type = &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct);
+        (void)memcpy(&merged_property_value_pairs[1], ambient_log_context->property_value_pairs_ptr, sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) * ambient_log_context->property_value_pair_count);
+        (void)memcpy(&merged_property_value_pairs[1 + ambient_log_context->property_value_pair_count], log_context->property_value_pairs_ptr, sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) * log_context->property_value_pair_count);
+
+        /* Codes_SRS_LOG_CONTEXT_AMBIENT_01_014: [ internal_log_context_ambient_merge shall initialize merged_log_context as a view with no values data over merged_property_value_pairs and return it. ]*/
+        merged_log_context->values_data = NULL;
+        merged_log_context->values_data_length = 0;
+        merged_log_context->property_value_pairs_ptr = merged_property_value_pairs;
+        merged_log_context->property_value_pair_count = 1 + ambient_log_context->property_value_pair_count + log_context->property_value_pair_count;
+        result = merged_log_context;
+    }
+
+    return result;
+}
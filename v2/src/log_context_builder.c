@@ -0,0 +1,469 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context.h"
+#include "c_logging/log_context_property_type_if.h"
+#include "c_logging/log_context_property_type_ascii_char_ptr.h"
+#include "c_logging/log_context_property_type_struct.h"
+#include "c_logging/log_context_property_basic_types.h"
+#include "c_logging/log_context_property_bool_type.h"
+
+#include "c_logging/log_context_builder.h"
+
+// the field count of the context struct property is an uint8_t and one of the fields can be the parent context
+#define LOG_CONTEXT_BUILDER_MAX_PROPERTY_COUNT (UINT8_MAX - 1)
+
+#define LOG_CONTEXT_BUILDER_MIN_DATA_CAPACITY 256
+#define LOG_CONTEXT_BUILDER_MIN_PROPERTY_CAPACITY 16
+
+typedef struct LOG_CONTEXT_BUILDER_PROPERTY_TAG
+{
+    uint32_t name_offset;
+    uint32_t value_offset;
+    const LOG_CONTEXT_PROPERTY_TYPE_IF* type;
+} LOG_CONTEXT_BUILDER_PROPERTY;
+
+typedef struct LOG_CONTEXT_BUILDER_TAG
+{
+    // values and names are appended in this buffer, which is copied as is in the data area of the frozen context
+    uint8_t* data;
+    uint32_t data_length;
+    uint32_t data_capacity;
+    LOG_CONTEXT_BUILDER_PROPERTY* properties;
+    uint32_t property_count;
+    uint32_t property_capacity;
+    bool has_name;
+    uint32_t name_offset;
+} LOG_CONTEXT_BUILDER;
+
+static int reserve_data(LOG_CONTEXT_BUILDER_HANDLE log_context_builder, size_t needed_size)
+{
+    int result;
+
+    if (needed_size > (size_t)(UINT32_MAX - log_context_builder->data_length))
+    {
+        (void)printf("Data length overflow: data_length=%" PRIu32 ", needed_size=%zu\r\n",
+            log_context_builder->data_length, needed_size);
+        result = MU_FAILURE;
+    }
+    else if (log_context_builder->data_length + (uint32_t)needed_size <= log_context_builder->data_capacity)
+    {
+        result = 0;
+    }
+    else
+    {
+        uint32_t needed_capacity = log_context_builder->data_length + (uint32_t)needed_size;
+        uint32_t new_capacity = (log_context_builder->data_capacity < LOG_CONTEXT_BUILDER_MIN_DATA_CAPACITY) ? LOG_CONTEXT_BUILDER_MIN_DATA_CAPACITY :
+            (log_context_builder->data_capacity > UINT32_MAX / 2) ? UINT32_MAX : log_context_builder->data_capacity * 2;
+        if (new_capacity < needed_capacity)
+        {
+            new_capacity = needed_capacity;
+        }
+
+        uint8_t* new_data = realloc(log_context_builder->data, new_capacity);
+        if (new_data == NULL)
+        {
+            (void)printf("realloc failed, new_capacity=%" PRIu32 "\r\n", new_capacity);
+            result = MU_FAILURE;
+        }
+        else
+        {
+            log_context_builder->data = new_data;
+            log_context_builder->data_capacity = new_capacity;
+            result = 0;
+        }
+    }
+
+    return result;
+}
+
+static int reserve_property(LOG_CONTEXT_BUILDER_HANDLE log_context_builder)
+{
+    int result;
+
+    if (log_context_builder->property_count >= LOG_CONTEXT_BUILDER_MAX_PROPERTY_COUNT)
+    {
+        (void)printf("Too many properties: property_count=%" PRIu32 "\r\n", log_context_builder->property_count);
+        result = MU_FAILURE;
+    }
+    else if (log_context_builder->property_count < log_context_builder->property_capacity)
+    {
+        result = 0;
+    }
+    else
+    {
+        uint32_t new_capacity = (log_context_builder->property_capacity < LOG_CONTEXT_BUILDER_MIN_PROPERTY_CAPACITY) ? LOG_CONTEXT_BUILDER_MIN_PROPERTY_CAPACITY : log_context_builder->property_capacity * 2;
+        LOG_CONTEXT_BUILDER_PROPERTY* new_properties = realloc(log_context_builder->properties, sizeof(LOG_CONTEXT_BUILDER_PROPERTY) * new_capacity);
+        if (new_properties == NULL)
+        {
+            (void)printf("realloc failed, new_capacity=%" PRIu32 "\r\n", new_capacity);
+            result = MU_FAILURE;
+        }
+        else
+        {
+            log_context_builder->properties = new_properties;
+            log_context_builder->property_capacity = new_capacity;
+            result = 0;
+        }
+    }
+
+    return result;
+}
+
+// the value has already been written at data_length, the name is placed right after it
+static void commit_property(LOG_CONTEXT_BUILDER_HANDLE log_context_builder, const char* property_name, size_t property_name_size, const LOG_CONTEXT_PROPERTY_TYPE_IF* property_type, uint32_t property_value_size)
+{
+    LOG_CONTEXT_BUILDER_PROPERTY* property = &log_context_builder->properties[log_context_builder->property_count];
+
+    property->value_offset = log_context_builder->data_length;
+    property->name_offset = log_context_builder->data_length + property_value_size;
+    property->type = property_type;
+    (void)memcpy(log_context_builder->data + property->name_offset, property_name, property_name_size);
+
+    log_context_builder->data_length += property_value_size + (uint32_t)property_name_size;
+    log_context_builder->property_count++;
+}
+
+LOG_CONTEXT_BUILDER_HANDLE log_context_builder_create(void)
+{
+    /* Codes_SRS_LOG_CONTEXT_BUILDER_01_001: [ log_context_builder_create shall allocate memory for a new builder. ]*/
+    LOG_CONTEXT_BUILDER_HANDLE result = malloc(sizeof(LOG_CONTEXT_BUILDER));
+    if (result == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_002: [ If any error occurs, log_context_builder_create shall fail and return NULL. ]*/
+        (void)printf("malloc(sizeof(LOG_CONTEXT_BUILDER)) failed\r\n");
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_003: [ The builder shall start with no properties and no context name. ]*/
+        result->data = NULL;
+        result->data_length = 0;
+        result->data_capacity = 0;
+        result->properties = NULL;
+        result->property_count = 0;
+        result->property_capacity = 0;
+        result->has_name = false;
+        result->name_offset = 0;
+    }
+
+    return result;
+}
+
+void log_context_builder_destroy(LOG_CONTEXT_BUILDER_HANDLE log_context_builder)
+{
+    if (log_context_builder == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_004: [ If log_context_builder is NULL, log_context_builder_destroy shall return. ]*/
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_005: [ log_context_builder_destroy shall free the buffers used by the builder and the builder itself. ]*/
+        free(log_context_builder->data);
+        free(log_context_builder->properties);
+        free(log_context_builder);
+    }
+}
+
+void log_context_builder_reset(LOG_CONTEXT_BUILDER_HANDLE log_context_builder)
+{
+    if (log_context_builder == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_006: [ If log_context_builder is NULL, log_context_builder_reset shall return. ]*/
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_007: [ log_context_builder_reset shall discard all the properties and the context name added to the builder, while keeping the builder buffers for reuse. ]*/
+        log_context_builder->data_length = 0;
+        log_context_builder->property_count = 0;
+        log_context_builder->has_name = false;
+        log_context_builder->name_offset = 0;
+    }
+}
+
+int log_context_builder_set_name(LOG_CONTEXT_BUILDER_HANDLE log_context_builder, const char* log_context_name)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_008: [ If log_context_builder is NULL, log_context_builder_set_name shall fail and return a non-zero value. ]*/
+        (log_context_builder == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_009: [ If log_context_name is NULL, log_context_builder_set_name shall fail and return a non-zero value. ]*/
+        (log_context_name == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: LOG_CONTEXT_BUILDER_HANDLE log_context_builder=%p, const char* log_context_name=%p\r\n",
+            log_context_builder, log_context_name);
+        result = MU_FAILURE;
+    }
+    else if (log_context_builder->has_name)
+    {
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_010: [ If the context name was already set, log_context_builder_set_name shall fail and return a non-zero value. ]*/
+        (void)printf("Context name already set\r\n");
+        result = MU_FAILURE;
+    }
+    else
+    {
+        size_t log_context_name_size = strlen(log_context_name) + 1;
+
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_011: [ log_context_builder_set_name shall copy log_context_name in the builder data buffer, growing the buffer if needed. ]*/
+        if (reserve_data(log_context_builder, log_context_name_size) != 0)
+        {
+            /* Codes_SRS_LOG_CONTEXT_BUILDER_01_012: [ If any error occurs, log_context_builder_set_name shall fail and return a non-zero value. ]*/
+            result = MU_FAILURE;
+        }
+        else
+        {
+            (void)memcpy(log_context_builder->data + log_context_builder->data_length, log_context_name, log_context_name_size);
+            log_context_builder->name_offset = log_context_builder->data_length;
+            log_context_builder->data_length += (uint32_t)log_context_name_size;
+            log_context_builder->has_name = true;
+
+            /* Codes_SRS_LOG_CONTEXT_BUILDER_01_013: [ log_context_builder_set_name shall succeed and return 0. ]*/
+            result = 0;
+        }
+    }
+
+    return result;
+}
+
+int log_context_builder_add_property(LOG_CONTEXT_BUILDER_HANDLE log_context_builder, const char* property_name, const LOG_CONTEXT_PROPERTY_TYPE_IF* property_type, const void* property_value, uint32_t property_value_size)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_014: [ If log_context_builder is NULL, log_context_builder_add_property shall fail and return a non-zero value. ]*/
+        (log_context_builder == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_015: [ If property_name is NULL, log_context_builder_add_property shall fail and return a non-zero value. ]*/
+        (property_name == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_016: [ If property_type is NULL, log_context_builder_add_property shall fail and return a non-zero value. ]*/
+        (property_type == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_017: [ If property_value is NULL, log_context_builder_add_property shall fail and return a non-zero value. ]*/
+        (property_value == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: LOG_CONTEXT_BUILDER_HANDLE log_context_builder=%p, const char* property_name=%p, const LOG_CONTEXT_PROPERTY_TYPE_IF* property_type=%p, const void* property_value=%p, uint32_t property_value_size=%" PRIu32 "\r\n",
+            log_context_builder, property_name, property_type, property_value, property_value_size);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        size_t property_name_size = strlen(property_name) + 1;
+
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_018: [ log_context_builder_add_property shall reserve property_value_size bytes for the value and the bytes needed for the name in the builder data buffer, growing the buffers if needed. ]*/
+        if (
+            (reserve_property(log_context_builder) != 0) ||
+            (property_name_size > UINT32_MAX - property_value_size) ||
+            (reserve_data(log_context_builder, property_value_size + property_name_size) != 0)
+            )
+        {
+            /* Codes_SRS_LOG_CONTEXT_BUILDER_01_021: [ If any error occurs, log_context_builder_add_property shall fail and return a non-zero value. ]*/
+            result = MU_FAILURE;
+        }
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_019: [ log_context_builder_add_property shall copy the value by calling the copy function of property_type. ]*/
+        else if (property_type->copy(log_context_builder->data + log_context_builder->data_length, property_value) != 0)
+        {
+            /* Codes_SRS_LOG_CONTEXT_BUILDER_01_021: [ If any error occurs, log_context_builder_add_property shall fail and return a non-zero value. ]*/
+            (void)printf("Copying the value of property %s failed\r\n", property_name);
+            result = MU_FAILURE;
+        }
+        else
+        {
+            /* Codes_SRS_LOG_CONTEXT_BUILDER_01_020: [ log_context_builder_add_property shall copy property_name in the builder data buffer, store the property and succeed and return 0. ]*/
+            commit_property(log_context_builder, property_name, property_name_size, property_type, property_value_size);
+            result = 0;
+        }
+    }
+
+    return result;
+}
+
+int log_context_builder_add_string_property(LOG_CONTEXT_BUILDER_HANDLE log_context_builder, const char* property_name, const char* format, ...)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_022: [ If log_context_builder is NULL, log_context_builder_add_string_property shall fail and return a non-zero value. ]*/
+        (log_context_builder == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_023: [ If property_name is NULL, log_context_builder_add_string_property shall fail and return a non-zero value. ]*/
+        (property_name == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_024: [ If format is NULL, log_context_builder_add_string_property shall fail and return a non-zero value. ]*/
+        (format == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: LOG_CONTEXT_BUILDER_HANDLE log_context_builder=%p, const char* property_name=%p, const char* format=%p\r\n",
+            log_context_builder, property_name, format);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        size_t property_name_size = strlen(property_name) + 1;
+
+        if (
+            (reserve_property(log_context_builder) != 0) ||
+            (reserve_data(log_context_builder, property_name_size + 1) != 0)
+            )
+        {
+            /* Codes_SRS_LOG_CONTEXT_BUILDER_01_028: [ If any error occurs, log_context_builder_add_string_property shall fail and return a non-zero value. ]*/
+            result = MU_FAILURE;
+        }
+        else
+        {
+            va_list args;
+            size_t space_left = log_context_builder->data_capacity - log_context_builder->data_length - property_name_size;
+
+            /* Codes_SRS_LOG_CONTEXT_BUILDER_01_025: [ log_context_builder_add_string_property shall format the string with format and the arguments in ... directly in the space left in the builder data buffer. ]*/
+            va_start(args, format);
+            int vsnprintf_result = vsnprintf((char*)log_context_builder->data + log_context_builder->data_length, space_left, format, args);
+            va_end(args);
+
+            if (
+                (vsnprintf_result >= 0) &&
+                ((size_t)vsnprintf_result + 1 > space_left)
+                )
+            {
+                /* Codes_SRS_LOG_CONTEXT_BUILDER_01_026: [ If the formatted string does not fit, log_context_builder_add_string_property shall grow the builder data buffer and format the string again. ]*/
+                if (reserve_data(log_context_builder, (size_t)vsnprintf_result + 1 + property_name_size) != 0)
+                {
+                    vsnprintf_result = -1;
+                }
+                else
+                {
+                    va_start(args, format);
+                    vsnprintf_result = vsnprintf((char*)log_context_builder->data + log_context_builder->data_length, (size_t)vsnprintf_result + 1, format, args);
+                    va_end(args);
+                }
+            }
+
+            if (vsnprintf_result < 0)
+            {
+                /* Codes_SRS_LOG_CONTEXT_BUILDER_01_028: [ If any error occurs, log_context_builder_add_string_property shall fail and return a non-zero value. ]*/
+                (void)printf("Formatting the value of property %s failed\r\n", property_name);
+                result = MU_FAILURE;
+            }
+            else
+            {
+                /* Codes_SRS_LOG_CONTEXT_BUILDER_01_027: [ log_context_builder_add_string_property shall copy property_name in the builder data buffer, store the property with the type ascii_char_ptr and succeed and return 0. ]*/
+                commit_property(log_context_builder, property_name, property_name_size, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr), (uint32_t)vsnprintf_result + 1);
+                result = 0;
+            }
+        }
+    }
+
+    return result;
+}
+
+#define DEFINE_LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name) \
+    int LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name)(LOG_CONTEXT_BUILDER_HANDLE log_context_builder, const char* property_name, type_name value) \
+    { \
+        int result; \
+        if ( \
+            /* Codes_SRS_LOG_CONTEXT_BUILDER_01_029: [ If log_context_builder is NULL, LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name) shall fail and return a non-zero value. ]*/ \
+            (log_context_builder == NULL) || \
+            /* Codes_SRS_LOG_CONTEXT_BUILDER_01_030: [ If property_name is NULL, LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name) shall fail and return a non-zero value. ]*/ \
+            (property_name == NULL) \
+            ) \
+        { \
+            (void)printf("Invalid arguments: LOG_CONTEXT_BUILDER_HANDLE log_context_builder=%p, const char* property_name=%p\r\n", \
+                log_context_builder, property_name); \
+            result = MU_FAILURE; \
+        } \
+        else \
+        { \
+            size_t property_name_size = strlen(property_name) + 1; \
+            if ( \
+                (reserve_property(log_context_builder) != 0) || \
+                (reserve_data(log_context_builder, sizeof(type_name) + property_name_size) != 0) || \
+                /* Codes_SRS_LOG_CONTEXT_BUILDER_01_031: [ LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name) shall store value in the builder data buffer by calling LOG_CONTEXT_PROPERTY_TYPE_INIT(type_name). ]*/ \
+                (LOG_CONTEXT_PROPERTY_TYPE_INIT(type_name)(log_context_builder->data + log_context_builder->data_length, value) != 0) \
+                ) \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_BUILDER_01_033: [ If any error occurs, LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name) shall fail and return a non-zero value. ]*/ \
+                result = MU_FAILURE; \
+            } \
+            else \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_BUILDER_01_032: [ LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name) shall copy property_name in the builder data buffer, store the property with the type type_name and succeed and return 0. ]*/ \
+                commit_property(log_context_builder, property_name, property_name_size, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name), (uint32_t)sizeof(type_name)); \
+                result = 0; \
+            } \
+        } \
+        return result; \
+    } \
+
+MU_FOR_EACH_1(DEFINE_LOG_CONTEXT_BUILDER_ADD_PROPERTY, LOG_CONTEXT_BUILDER_SUPPORTED_TYPES)
+
+LOG_CONTEXT_HANDLE log_context_builder_freeze(LOG_CONTEXT_BUILDER_HANDLE log_context_builder, LOG_CONTEXT_HANDLE parent_context)
+{
+    LOG_CONTEXT_HANDLE result;
+
+    if (log_context_builder == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_BUILDER_01_034: [ If log_context_builder is NULL, log_context_builder_freeze shall fail and return NULL. ]*/
+        (void)printf("Invalid arguments: LOG_CONTEXT_BUILDER_HANDLE log_context_builder=%p, LOG_CONTEXT_HANDLE parent_context=%p\r\n",
+            log_context_builder, parent_context);
+        result = NULL;
+    }
+    else
+    {
+        uint32_t parent_property_value_pair_count = log_context_get_property_value_pair_count(parent_context);
+
+        if (log_context_builder->data_length > UINT32_MAX - 1)
+        {
+            /* Codes_SRS_LOG_CONTEXT_BUILDER_01_038: [ If any error occurs, log_context_builder_freeze shall fail and return NULL. ]*/
+            (void)printf("Data length overflow: data_length=%" PRIu32 "\r\n",
+                log_context_builder->data_length);
+            result = NULL;
+        }
+        else
+        {
+            uint32_t parent_data_length;
+
+            /* Codes_SRS_LOG_CONTEXT_BUILDER_01_035: [ log_context_builder_freeze shall create the context with a single allocation, sized for the properties of parent_context, one struct property and the properties added to the builder. ]*/
+            /* Codes_SRS_LOG_CONTEXT_BUILDER_01_036: [ If parent_context is non-NULL, the created context shall copy all the property/value pairs of parent_context. ]*/
+            result = log_context_create(parent_context, parent_property_value_pair_count + 1 + log_context_builder->property_count, 1 + log_context_builder->data_length, &parent_data_length);
+            if (result == NULL)
+            {
+                /* Codes_SRS_LOG_CONTEXT_BUILDER_01_038: [ If any error occurs, log_context_builder_freeze shall fail and return NULL. ]*/
+            }
+            else
+            {
+                uint32_t i;
+                uint8_t* builder_data = result->values_data + 1 + parent_data_length;
+
+                /* Codes_SRS_LOG_CONTEXT_BUILDER_01_037: [ log_context_builder_freeze shall copy the values and names added to the builder in the context and store one struct property named with the context name (or empty string if no name was set) followed by the properties added to the builder. ]*/
+                if (log_context_builder->data_length > 0)
+                {
+                    (void)memcpy(builder_data, log_context_builder->data, log_context_builder->data_length);
+                }
+
+                result->values_data[0] = (uint8_t)((parent_context != NULL ? 1 : 0) + log_context_builder->property_count);
+                result->property_value_pairs_ptr[0].value = result->values_data;
+                result->property_value_pairs_ptr[0].name = log_context_builder->has_name ? (const char*)(builder_data + log_context_builder->name_offset) : "";
+                result->property_value_pairs_ptr[0].type = &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct);
+
+                for (i = 0; i < log_context_builder->property_count; i++)
+                {
+                    LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pair = &result->property_value_pairs_ptr[parent_property_value_pair_count + 1 + i];
+                    property_value_pair->name = (const char*)(builder_data + log_context_builder->properties[i].name_offset);
+                    property_value_pair->value = builder_data + log_context_builder->properties[i].value_offset;
+                    property_value_pair->type = log_context_builder->properties[i].type;
+                }
+
+                /* Codes_SRS_LOG_CONTEXT_BUILDER_01_039: [ log_context_builder_freeze shall reset the builder (keeping its buffers) so that it can be used to build another context. ]*/
+                log_context_builder_reset(log_context_builder);
+            }
+        }
+    }
+
+    return result;
+}
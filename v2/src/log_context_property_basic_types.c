@@ -10,10 +10,12 @@
 
 #include "c_logging/log_context_property_type.h"
 #include "c_logging/log_context_property_type_if.h"
+#include "c_logging/integer_to_string.h"
+#include "c_logging/floating_point_to_string.h"
 
 #include "c_logging/log_context_property_basic_types.h"
 
-#define DEFINE_BASIC_TYPE_TO_STRING(type_name, print_format_string) \
+#define DEFINE_BASIC_TYPE_TO_STRING(type_name, to_string_function) \
     static int MU_C2(type_name,_log_context_property_type_to_string)(const void* property_value, char* buffer, size_t buffer_length) \
     { \
         int result; \
@@ -25,6 +27,8 @@
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_051: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall fail and return a negative value. ]*/ \
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_061: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall fail and return a negative value. ]*/ \
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_071: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall fail and return a negative value. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_121: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string shall fail and return a negative value. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_135: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string shall fail and return a negative value. ]*/ \
         if (property_value == NULL) \
         { \
             (void)printf("Invalid arguments: const void* property_value=%p, char* buffer=%p, size_t buffer_length=%zu\r\n", \
@@ -33,31 +37,27 @@
         } \
         else \
         { \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall call snprintf with buffer, buffer_length and format string PRId64 and pass in the values list the int64_t value pointed to be property_value. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall succeed and return the result of snprintf. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_004: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall fail and return a negative value. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_012: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu64 and pass in the values list the uint64_t value pointed to be property_value. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_013: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall succeed and return the result of snprintf. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_014: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall fail and return a negative value. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall call snprintf with buffer, buffer_length and format string PRId32 and pass in the values list the int32_t value pointed to be property_value. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall succeed and return the result of snprintf. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_024: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall fail and return a negative value. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_032: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu32 and pass in the values list the uint32_t value pointed to be property_value. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_033: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall succeed and return the result of snprintf. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_034: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall fail and return a negative value. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_042: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall call snprintf with buffer, buffer_length and format string PRId16 and pass in the values list the int16_t value pointed to be property_value. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_043: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall succeed and return the result of snprintf. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_044: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall fail and return a negative value. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_052: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu16 and pass in the values list the uint16_t value pointed to be property_value. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_053: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall succeed and return the result of snprintf. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_054: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall fail and return a negative value. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall call snprintf with buffer, buffer_length and format string PRId8 and pass in the values list the int8_t value pointed to be property_value. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_063: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall succeed and return the result of snprintf. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_064: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall fail and return a negative value. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_072: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu8 and pass in the values list the uint8_t value pointed to be property_value. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_073: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall succeed and return the result of snprintf. ]*/ \
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_074: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall fail and return a negative value. ]*/ \
-            result = snprintf(buffer, buffer_length, "%" print_format_string "", *(type_name*)property_value); \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall write the decimal representation of the int64_t value pointed to by property_value in buffer by calling integer_to_string_int64 with buffer and buffer_length. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall succeed and return the result of integer_to_string_int64. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_012: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall write the decimal representation of the uint64_t value pointed to by property_value in buffer by calling integer_to_string_uint64 with buffer and buffer_length. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_013: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall succeed and return the result of integer_to_string_uint64. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall write the decimal representation of the int32_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_032: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall write the decimal representation of the uint32_t value pointed to by property_value in buffer by calling integer_to_string_uint32 with buffer and buffer_length. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_033: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall succeed and return the result of integer_to_string_uint32. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_042: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall write the decimal representation of the int16_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_043: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_052: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall write the decimal representation of the uint16_t value pointed to by property_value in buffer by calling integer_to_string_uint32 with buffer and buffer_length. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_053: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall succeed and return the result of integer_to_string_uint32. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall write the decimal representation of the int8_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_063: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_072: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall write the decimal representation of the uint8_t value pointed to by property_value in buffer by calling integer_to_string_uint32 with buffer and buffer_length. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_122: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string shall write a decimal representation that reads back as the float value pointed to by property_value in buffer by calling floating_point_to_string_float with buffer and buffer_length. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_136: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string shall write a decimal representation that reads back as the double value pointed to by property_value in buffer by calling floating_point_to_string_double with buffer and buffer_length. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_073: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall succeed and return the result of integer_to_string_uint32. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_123: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string shall succeed and return the result of floating_point_to_string_float. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_137: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string shall succeed and return the result of floating_point_to_string_double. ]*/ \
+            result = to_string_function(*(type_name*)property_value, buffer, buffer_length); \
         } \
         return result; \
     } \
@@ -75,6 +75,8 @@
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_056: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).copy shall fail and return a non-zero value. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_066: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).copy shall fail and return a non-zero value. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_076: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).copy shall fail and return a non-zero value. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_125: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).copy shall fail and return a non-zero value. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_139: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).copy shall fail and return a non-zero value. ]*/ \
             (dst_value == NULL) || \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_005: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).copy shall fail and return a non-zero value. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_015: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).copy shall fail and return a non-zero value. ]*/ \
@@ -84,6 +86,8 @@
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_055: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).copy shall fail and return a non-zero value. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_065: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).copy shall fail and return a non-zero value. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_075: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).copy shall fail and return a non-zero value. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_124: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).copy shall fail and return a non-zero value. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_138: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).copy shall fail and return a non-zero value. ]*/ \
             (src_value == NULL) \
             ) \
         { \
@@ -101,6 +105,8 @@
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_057: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).copy shall copy the bytes of the uint16_t value from the address pointed by src_value to dst_value. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_067: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).copy shall copy the byte of the int8_t value from the address pointed by src_value to dst_value. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_077: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).copy shall copy the byte of the uint8_t value from the address pointed by src_value to dst_value. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_126: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).copy shall copy the bytes of the float value from the address pointed by src_value to dst_value. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_140: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).copy shall copy the bytes of the double value from the address pointed by src_value to dst_value. ]*/ \
             (void)memcpy(dst_value, src_value, sizeof(type_name)); \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_008: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).copy shall succeed and return 0. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_018: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).copy shall succeed and return 0. ]*/ \
@@ -110,6 +116,8 @@
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_058: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).copy shall succeed and return 0. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_068: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).copy shall succeed and return 0. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_078: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).copy shall succeed and return 0. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_127: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).copy shall succeed and return 0. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_141: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).copy shall succeed and return 0. ]*/ \
             result = 0; \
         } \
         return result; \
@@ -126,6 +134,8 @@
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_059: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).free shall return. ]*/ \
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_069: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).free shall return. ]*/ \
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_079: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).free shall return. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_128: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).free shall return. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_142: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).free shall return. ]*/ \
         (void)value; \
     } \
 
@@ -140,16 +150,108 @@
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_060: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).get_type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_uint16_t. ]*/ \
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_070: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).get_type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_int8_t. ]*/ \
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_080: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).get_type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_uint8_t. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_129: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).get_type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_float. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_143: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).get_type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_double. ]*/ \
         return MU_C2(LOG_CONTEXT_PROPERTY_TYPE_, type_name); \
     } \
 
+#define DEFINE_BASIC_TYPE_GET_SIZE(type_name) \
+    static int MU_C2(type_name, _log_context_property_type_get_size)(const void* property_value) \
+    { \
+        int result; \
+        if (property_value == NULL) \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_149: [ If property_value is NULL, the get_size function of each basic type shall fail and return a negative value. ]*/ \
+            (void)printf("Invalid arguments: const void* property_value=%p\r\n", property_value); \
+            result = -1; \
+        } \
+        else \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_150: [ Otherwise the get_size function of each basic type shall return sizeof(type). ]*/ \
+            result = (int)sizeof(type_name); \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_BASIC_TYPE_SERIALIZE(type_name) \
+    static int MU_C2(type_name, _log_context_property_type_serialize)(const void* property_value, void* buffer, size_t buffer_size) \
+    { \
+        int result; \
+        if ( \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_151: [ If property_value is NULL, the serialize function of each basic type shall fail and return a negative value. ]*/ \
+            (property_value == NULL) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_152: [ If buffer is NULL and buffer_size is greater than 0, the serialize function of each basic type shall fail and return a negative value. ]*/ \
+            ((buffer == NULL) && (buffer_size > 0)) \
+            ) \
+        { \
+            (void)printf("Invalid arguments: const void* property_value=%p, void* buffer=%p, size_t buffer_size=%zu\r\n", \
+                property_value, buffer, buffer_size); \
+            result = -1; \
+        } \
+        else \
+        { \
+            if (sizeof(type_name) <= buffer_size) \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_153: [ If sizeof(type) bytes fit in buffer_size, the serialize function of each basic type shall copy the bytes of the value from property_value to buffer. ]*/ \
+                (void)memcpy(buffer, property_value, sizeof(type_name)); \
+            } \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_154: [ The serialize function of each basic type shall succeed and return sizeof(type). ]*/ \
+            result = (int)sizeof(type_name); \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_BASIC_TYPE_DESERIALIZE(type_name) \
+    static int MU_C2(type_name, _log_context_property_type_deserialize)(void* dst_value, size_t dst_size, const void* buffer, size_t buffer_size) \
+    { \
+        int result; \
+        if ( \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_155: [ If dst_value is NULL and dst_size is greater than 0, the deserialize function of each basic type shall fail and return a negative value. ]*/ \
+            ((dst_value == NULL) && (dst_size > 0)) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_156: [ If buffer is NULL, the deserialize function of each basic type shall fail and return a negative value. ]*/ \
+            (buffer == NULL) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_157: [ If buffer_size is not sizeof(type), the deserialize function of each basic type shall fail and return a negative value. ]*/ \
+            (buffer_size != sizeof(type_name)) \
+            ) \
+        { \
+            (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const void* buffer=%p, size_t buffer_size=%zu\r\n", \
+                dst_value, dst_size, buffer, buffer_size); \
+            result = -1; \
+        } \
+        else \
+        { \
+            if (sizeof(type_name) <= dst_size) \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_158: [ If sizeof(type) bytes fit in dst_size, the deserialize function of each basic type shall copy the bytes of the value from buffer to dst_value. ]*/ \
+                (void)memcpy(dst_value, buffer, sizeof(type_name)); \
+            } \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_159: [ The deserialize function of each basic type shall succeed and return sizeof(type). ]*/ \
+            result = (int)sizeof(type_name); \
+        } \
+        return result; \
+    } \
+
 #define DEFINE_BASIC_TYPE_IF(type_name) \
     const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name) = \
     { \
         .to_string = MU_C2(type_name, _log_context_property_type_to_string), \
         .copy = MU_C2(type_name, _log_context_property_type_copy), \
         .free = MU_C2(type_name, _log_context_property_type_free), \
-        .get_type = MU_C2(type_name, _log_context_property_type_get_type) \
+        .get_type = MU_C2(type_name, _log_context_property_type_get_type), \
+        .get_size = MU_C2(type_name, _log_context_property_type_get_size), \
+        .serialize = MU_C2(type_name, _log_context_property_type_serialize), \
+        .deserialize = MU_C2(type_name, _log_context_property_type_deserialize), \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_113: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_int64_t. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_114: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_uint64_t. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_115: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_int32_t. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_116: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_uint32_t. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_117: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_int16_t. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_118: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_uint16_t. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_119: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_int8_t. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_120: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_uint8_t. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_130: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_float. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_144: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_double. ]*/ \
+        .type_tag = MU_C2(LOG_CONTEXT_PROPERTY_TYPE_, type_name) \
     }; \
 
 #define DEFINE_BASIC_TYPE_INIT(type_name, print_format_string) \
@@ -164,6 +266,8 @@
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_101: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(uint16_t) shall fail and return a non-zero value. ]*/ \
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_105: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(int8_t) shall fail and return a non-zero value. ]*/ \
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_109: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(uint8_t) shall fail and return a non-zero value. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_131: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(float) shall fail and return a non-zero value. ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_145: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(double) shall fail and return a non-zero value. ]*/ \
         if (dst_value == NULL) \
         { \
             (void)printf("Invalid arguments: void* dst_value = %p, void* src_value = %" print_format_string "\r\n", \
@@ -180,6 +284,8 @@
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_102: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(uint16_t) shall copy the src_value bytes of the uint16_t to dst_value. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_106: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(int8_t) shall copy the src_value byte of the int8_t to dst_value. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_110: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(uint8_t) shall copy the src_value byte of the uint8_t to dst_value. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_132: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(float) shall copy the src_value bytes of the float to dst_value. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_146: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(double) shall copy the src_value bytes of the double to dst_value. ]*/ \
             (void)memcpy(dst_value, &src_value, sizeof(type_name)); \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_083: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(int64_t) shall succeed and return 0. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_087: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(uint64_t) shall succeed and return 0. ]*/ \
@@ -189,6 +295,8 @@
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_103: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(uint16_t) shall succeed and return 0. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_107: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(int8_t) shall succeed and return 0. ]*/ \
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_111: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(uint8_t) shall succeed and return 0. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_133: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(float) shall succeed and return 0. ]*/ \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_147: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(double) shall succeed and return 0. ]*/ \
             result = 0; \
         } \
         return result; \
@@ -205,23 +313,30 @@
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_104: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(uint16_t) shall return sizeof(uint16_t). ]*/ \
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_108: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(int8_t) shall return sizeof(int8_t). ]*/ \
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_112: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(uint8_t) shall return sizeof(uint8_t). ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_134: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(float) shall return sizeof(float). ]*/ \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_148: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(double) shall return sizeof(double). ]*/ \
         return (int)sizeof(type_name); \
     }
 
-#define DEFINE_BASIC_TYPE(type_name, print_format_string) \
-    DEFINE_BASIC_TYPE_TO_STRING(type_name, print_format_string) \
+#define DEFINE_BASIC_TYPE(type_name, print_format_string, to_string_function) \
+    DEFINE_BASIC_TYPE_TO_STRING(type_name, to_string_function) \
     DEFINE_BASIC_TYPE_COPY(type_name) \
     DEFINE_BASIC_TYPE_FREE(type_name) \
     DEFINE_BASIC_TYPE_GET_TYPE(type_name) \
+    DEFINE_BASIC_TYPE_GET_SIZE(type_name) \
+    DEFINE_BASIC_TYPE_SERIALIZE(type_name) \
+    DEFINE_BASIC_TYPE_DESERIALIZE(type_name) \
     DEFINE_BASIC_TYPE_INIT(type_name, print_format_string) \
     DEFINE_BASIC_TYPE_GET_INIT_DATA_SIZE(type_name) \
     DEFINE_BASIC_TYPE_IF(type_name) \
 
-DEFINE_BASIC_TYPE(int64_t, PRId64)
-DEFINE_BASIC_TYPE(uint64_t, PRIu64)
-DEFINE_BASIC_TYPE(int32_t, PRId32)
-DEFINE_BASIC_TYPE(uint32_t, PRIu32)
-DEFINE_BASIC_TYPE(int16_t, PRId16)
-DEFINE_BASIC_TYPE(uint16_t, PRIu16)
-DEFINE_BASIC_TYPE(int8_t, PRId8)
-DEFINE_BASIC_TYPE(uint8_t, PRIu8)
+DEFINE_BASIC_TYPE(int64_t, PRId64, integer_to_string_int64)
+DEFINE_BASIC_TYPE(uint64_t, PRIu64, integer_to_string_uint64)
+DEFINE_BASIC_TYPE(int32_t, PRId32, integer_to_string_int32)
+DEFINE_BASIC_TYPE(uint32_t, PRIu32, integer_to_string_uint32)
+DEFINE_BASIC_TYPE(int16_t, PRId16, integer_to_string_int32)
+DEFINE_BASIC_TYPE(uint16_t, PRIu16, integer_to_string_uint32)
+DEFINE_BASIC_TYPE(int8_t, PRId8, integer_to_string_int32)
+DEFINE_BASIC_TYPE(uint8_t, PRIu8, integer_to_string_uint32)
+DEFINE_BASIC_TYPE(float, "g", floating_point_to_string_float)
+DEFINE_BASIC_TYPE(double, "g", floating_point_to_string_double)
@@ -67,6 +67,79 @@ static LOG_CONTEXT_PROPERTY_TYPE bool_log_context_property_type_get_type(void)
     return LOG_CONTEXT_PROPERTY_TYPE_bool;
 }
 
+static int bool_log_context_property_type_get_size(const void* property_value)
+{
+    int result;
+    if (property_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_016: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).get_size shall fail and return a negative value. ]*/
+        (void)printf("Invalid arguments: const void* property_value=%p\r\n", property_value);
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_017: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).get_size shall return sizeof(bool). ]*/
+        result = (int)sizeof(bool);
+    }
+    return result;
+}
+
+static int bool_log_context_property_type_serialize(const void* property_value, void* buffer, size_t buffer_size)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_018: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize shall fail and return a negative value. ]*/
+        (property_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_019: [ If buffer is NULL and buffer_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_size > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const void* property_value=%p, void* buffer=%p, size_t buffer_size=%zu\r\n",
+            property_value, buffer, buffer_size);
+        result = -1;
+    }
+    else
+    {
+        if (sizeof(bool) <= buffer_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_020: [ If sizeof(bool) bytes fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize shall copy the bytes of the bool value from property_value to buffer. ]*/
+            (void)memcpy(buffer, property_value, sizeof(bool));
+        }
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_021: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize shall succeed and return sizeof(bool). ]*/
+        result = (int)sizeof(bool);
+    }
+    return result;
+}
+
+static int bool_log_context_property_type_deserialize(void* dst_value, size_t dst_size, const void* buffer, size_t buffer_size)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_022: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize shall fail and return a negative value. ]*/
+        ((dst_value == NULL) && (dst_size > 0)) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_023: [ If buffer is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize shall fail and return a negative value. ]*/
+        (buffer == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_024: [ If buffer_size is not sizeof(bool), LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize shall fail and return a negative value. ]*/
+        (buffer_size != sizeof(bool))
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const void* buffer=%p, size_t buffer_size=%zu\r\n",
+            dst_value, dst_size, buffer, buffer_size);
+        result = -1;
+    }
+    else
+    {
+        if (sizeof(bool) <= dst_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_025: [ If sizeof(bool) bytes fit in dst_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize shall copy the bytes of the bool value from buffer to dst_value. ]*/
+            (void)memcpy(dst_value, buffer, sizeof(bool));
+        }
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_026: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize shall succeed and return sizeof(bool). ]*/
+        result = (int)sizeof(bool);
+    }
+    return result;
+}
+
 int LOG_CONTEXT_PROPERTY_TYPE_INIT(bool)(void* dst_value, bool src_value)
 {
     int result;
@@ -97,5 +170,10 @@ const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool) =
     .to_string = bool_log_context_property_type_to_string,
     .copy = bool_log_context_property_type_copy,
     .free = bool_log_context_property_type_free,
-    .get_type = bool_log_context_property_type_get_type
+    .get_type = bool_log_context_property_type_get_type,
+    .get_size = bool_log_context_property_type_get_size,
+    .serialize = bool_log_context_property_type_serialize,
+    .deserialize = bool_log_context_property_type_deserialize,
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_015: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_bool. ]*/
+    .type_tag = LOG_CONTEXT_PROPERTY_TYPE_bool
 };
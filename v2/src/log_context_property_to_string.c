@@ -3,6 +3,7 @@
 
 #include <stdio.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "c_logging/log_context_property_type.h"
 #include "c_logging/log_context_property_type_if.h"
@@ -10,114 +11,163 @@
 
 #include "c_logging/log_context_property_to_string.h"
 
-#define MIN(a, b) ((a) < (b)) ? (a) : (b)
+// maximum number of structs that can be open at the same time (each level costs one byte of stack)
+#define MAX_STRUCT_NESTING_DEPTH 256
 
-#define UPDATE_BUFFER_AND_SIZE(result, buffer, buffer_size, no_of_bytes) \
-    no_of_bytes = MIN(no_of_bytes, (int)buffer_size); \
-    buffer += no_of_bytes; \
-    buffer_size -= no_of_bytes; \
-    result += no_of_bytes;
+// Append-only writer over the caller's buffer.
+// remaining counts the bytes left including the one for the null terminator, so that the number of bytes
+// produced so far is always buffer_size - remaining (which is what the per-snprintf clamping used to add up to).
+typedef struct PROPERTY_STRING_WRITER_TAG
+{
+    char* position;
+    size_t remaining;
+} PROPERTY_STRING_WRITER;
+
+static void property_string_writer_append(PROPERTY_STRING_WRITER* writer, const char* source, size_t length)
+{
+    if (writer->remaining == 0)
+    {
+        // buffer already full, nothing to do
+    }
+    else if (length < writer->remaining)
+    {
+        (void)memcpy(writer->position, source, length);
+        writer->position += length;
+        writer->remaining -= length;
+    }
+    else
+    {
+        // truncated, same as snprintf: copy what fits, terminate and count the whole buffer as used
+        (void)memcpy(writer->position, source, writer->remaining - 1);
+        writer->position[writer->remaining - 1] = '\0';
+        writer->position += writer->remaining;
+        writer->remaining = 0;
+    }
+}
+
+static int property_string_writer_append_value(PROPERTY_STRING_WRITER* writer, const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pair)
+{
+    int result;
+
+    if (writer->remaining == 0)
+    {
+        // the name already filled the buffer, the value would not be visible
+        result = 0;
+    }
+    else
+    {
+        // the type writes the value directly at the current position
+        int to_string_result = property_value_pair->type->to_string(property_value_pair->value, writer->position, writer->remaining);
+        if (to_string_result < 0)
+        {
+            result = -1;
+        }
+        else
+        {
+            size_t value_length = ((size_t)to_string_result < writer->remaining) ? (size_t)to_string_result : writer->remaining;
+            writer->position += value_length;
+            writer->remaining -= value_length;
+            result = 0;
+        }
+    }
 
-static int log_n_properties(char* buffer, size_t buffer_size, const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs, size_t property_value_pair_count, uint32_t depth, size_t* properties_added)
+    return result;
+}
+
+static int log_n_properties(char* buffer, size_t buffer_size, const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs, size_t property_value_pair_count)
 {
     int result = 0;
+    PROPERTY_STRING_WRITER writer = { buffer, buffer_size };
+
+    // number of fields still to be printed for each open struct, innermost last
+    uint8_t struct_fields_left[MAX_STRUCT_NESTING_DEPTH];
+    uint32_t depth = 0;
 
     /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_016: [ For each property: ]*/
-    // Note that for the depth==0 case, we want to iterate over all properties, knowing that we will skip over some for structs
-    // In case we are in depth>0, then we are in a struct and only want to iterate over the property_value_pair_count
-    // BUT, if we have nested structs, we need to skip over those properties at this depth, but not count them against property_value_pair_count
-    size_t properties_added_this_level = 0;
-    size_t i = 0;
-    for (; (depth == 0 && i < property_value_pair_count) || (depth > 0 && properties_added_this_level < property_value_pair_count); i++)
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_034: [ Once buffer is full, log_context_property_to_string shall stop formatting the remaining properties. ]*/
+    for (size_t i = 0; (i < property_value_pair_count) && (writer.remaining > 0); i++)
     {
-        properties_added_this_level++;
+        const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pair = &property_value_pairs[i];
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_033: [ log_context_property_to_string shall copy property names, spaces, equal signs and braces to buffer without calling printf class functions. ]*/
+        size_t name_length = strlen(property_value_pair->name);
+
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_017: [ If the property type is struct (used as a container for context properties): ]*/
-        if (property_value_pairs[i].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_struct)
+        if (property_value_pair->type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_struct)
         {
-            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_025: [ log_context_property_to_string shall print the struct property name and an opening brace. ]*/
-            int snprintf_result = snprintf(buffer, buffer_size, " %s%s{", property_value_pairs[i].name, property_value_pairs[i].name[0] == 0 ? "" : "=");
-            if (snprintf_result < 0)
+            if (depth == MAX_STRUCT_NESTING_DEPTH)
             {
-                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_context_property_to_string shall fail and return a negative value. ]*/
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_032: [ If structs are nested more than 256 levels deep, log_context_property_to_string shall fail and return a negative value. ]*/
+                (void)printf("Structs nested more than %d levels deep\r\n", MAX_STRUCT_NESTING_DEPTH);
                 result = -1;
                 break;
             }
-            else
+
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_025: [ log_context_property_to_string shall print the struct property name and an opening brace. ]*/
+            property_string_writer_append(&writer, " ", 1);
+            if (name_length > 0)
             {
-                UPDATE_BUFFER_AND_SIZE(result, buffer, buffer_size, snprintf_result);
-
-                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_018: [ log_context_property_to_string shall obtain the number of fields in the struct. ]*/
-                uint8_t struct_properties_count = *(uint8_t*)(property_value_pairs[i].value);
-
-                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_019: [ log_context_property_to_string shall print the next n properties as being the fields that are part of the struct. ]*/
-                size_t increment_i = 0;
-                int log_n_properties_result = log_n_properties(buffer, buffer_size, &property_value_pairs[i + 1], struct_properties_count, depth + 1, &increment_i);
-                if (log_n_properties_result < 0)
-                {
-                    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_context_property_to_string shall fail and return a negative value. ]*/
-                    result = -1;
-                    break;
-                }
-                else
-                {
-                    UPDATE_BUFFER_AND_SIZE(result, buffer, buffer_size, log_n_properties_result);
-
-                    i += increment_i;
-
-                    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_026: [ log_context_property_to_string shall print a closing brace as end of the struct. ]*/
-                    snprintf_result = snprintf(buffer, buffer_size, " }");
-                    if (snprintf_result < 0)
-                    {
-                        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_context_property_to_string shall fail and return a negative value. ]*/
-                        result = -1;
-                        break;
-                    }
-                    else
-                    {
-                        snprintf_result = MIN(snprintf_result, (int)buffer_size);
-
-                        buffer += snprintf_result;
-                        buffer_size -= snprintf_result;
-                        result += snprintf_result;
-                    }
-                }
+                property_string_writer_append(&writer, property_value_pair->name, name_length);
+                property_string_writer_append(&writer, "=", 1);
             }
+            property_string_writer_append(&writer, "{", 1);
+
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_018: [ log_context_property_to_string shall obtain the number of fields in the struct. ]*/
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_019: [ log_context_property_to_string shall print the next n properties as being the fields that are part of the struct. ]*/
+            struct_fields_left[depth] = *(const uint8_t*)(property_value_pair->value);
+            depth++;
         }
         else
         {
             /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_020: [ Otherwise log_context_property_to_string shall call to_string for the property and print its name and value. ]*/
-            int snprintf_result = snprintf(buffer, buffer_size, " %s=", property_value_pairs[i].name);
-            if (snprintf_result < 0)
+            property_string_writer_append(&writer, " ", 1);
+            property_string_writer_append(&writer, property_value_pair->name, name_length);
+            property_string_writer_append(&writer, "=", 1);
+
+            if (property_string_writer_append_value(&writer, property_value_pair) != 0)
             {
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_022: [ If to_string fails for any property, log_context_property_to_string shall fail and return a negative value. ]*/
                 result = -1;
+                break;
             }
-            else
+
+            if (depth > 0)
             {
-                UPDATE_BUFFER_AND_SIZE(result, buffer, buffer_size, snprintf_result);
-
-                int to_string_result = property_value_pairs[i].type->to_string(property_value_pairs[i].value, buffer, buffer_size);
-
-                if (to_string_result < 0)
-                {
-                    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_context_property_to_string shall fail and return a negative value. ]*/
-                    result = -1;
-                    break;
-                }
-                else
-                {
-                    UPDATE_BUFFER_AND_SIZE(result, buffer, buffer_size, to_string_result);
-                }
+                struct_fields_left[depth - 1]--;
+            }
+        }
+
+        // a struct whose fields have all been printed is closed, which in turn completes one field of its parent
+        while ((depth > 0) && (struct_fields_left[depth - 1] == 0))
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_026: [ log_context_property_to_string shall print a closing brace as end of the struct. ]*/
+            property_string_writer_append(&writer, " }", 2);
+            depth--;
+
+            if (depth > 0)
+            {
+                struct_fields_left[depth - 1]--;
             }
         }
     }
 
-    if (properties_added != NULL)
+    if (result == 0)
     {
-        *properties_added += i;
-    }
+        // structs claiming more fields than there are properties are closed at the end
+        while (depth > 0)
+        {
+            property_string_writer_append(&writer, " }", 2);
+            depth--;
+        }
+
+        if (writer.remaining > 0)
+        {
+            *writer.position = '\0';
+        }
 
-    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_021: [ log_context_property_to_string shall store at most buffer_size characters including the null terminator in buffer (the rest of the context shall be truncated). ]*/
-    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_031: [ log_context_property_to_string shall return the number of bytes written to the buffer. ]*/
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_021: [ log_context_property_to_string shall store at most buffer_size characters including the null terminator in buffer (the rest of the context shall be truncated). ]*/
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_031: [ log_context_property_to_string shall return the number of bytes written to the buffer. ]*/
+        result = (int)(buffer_size - writer.remaining);
+    }
 
     return result;
 }
@@ -141,7 +191,7 @@ int log_context_property_to_string(char* buffer, size_t buffer_size, const LOG_C
     }
     else
     {
-        result = log_n_properties(buffer, buffer_size, property_value_pairs, property_value_pair_count, 0, NULL);
+        result = log_n_properties(buffer, buffer_size, property_value_pairs, property_value_pair_count);
     }
 
     return result;
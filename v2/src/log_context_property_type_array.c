@@ -0,0 +1,362 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/integer_to_string.h"
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+
+#include "c_logging/log_context_property_type_array.h"
+
+// appends as much of text as fits in buffer (keeping room for the zero terminator), used only when the whole array does not fit
+static void append_truncated(char* buffer, size_t buffer_length, size_t* pos, const char* text, size_t text_length)
+{
+    size_t space_left = buffer_length - 1 - *pos;
+    size_t copy_length = (text_length < space_left) ? text_length : space_left;
+    (void)memcpy(buffer + *pos, text, copy_length);
+    *pos += copy_length;
+}
+
+static void store_array_value(void* dst_value, const void* values, uint16_t count, size_t element_size)
+{
+    (void)memcpy(dst_value, &count, sizeof(uint16_t));
+    if (count > 0)
+    {
+        (void)memcpy((uint8_t*)dst_value + sizeof(uint16_t), values, count * element_size);
+    }
+}
+
+// the size of an array value (and of its binary form): the count as a uint16_t followed by the values
+static size_t get_array_value_size(const void* value, size_t element_size)
+{
+    uint16_t count;
+    (void)memcpy(&count, value, sizeof(uint16_t));
+    return sizeof(uint16_t) + (size_t)count * element_size;
+}
+
+// every element is widened to wide_type (int64_t or uint64_t) and formatted with the matching integer_to_string functions
+#define DEFINE_ARRAY_TYPE_TO_STRING(element_type, wide_type, length_function, write_function) \
+    static int MU_C2(element_type, _array_log_context_property_type_to_string)(const void* property_value, char* buffer, size_t buffer_length) \
+    { \
+        int result; \
+        if ( \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_001: [ If property_value is NULL, the to_string function of each array type shall fail and return a negative value. ]*/ \
+            (property_value == NULL) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_002: [ If buffer is NULL and buffer_length is greater than 0, the to_string function of each array type shall fail and return a negative value. ]*/ \
+            ((buffer == NULL) && (buffer_length > 0)) \
+            ) \
+        { \
+            (void)printf("Invalid arguments: const void* property_value=%p, char* buffer=%p, size_t buffer_length=%zu\r\n", \
+                property_value, buffer, buffer_length); \
+            result = -1; \
+        } \
+        else \
+        { \
+            uint16_t count; \
+            const uint8_t* values = (const uint8_t*)property_value + sizeof(uint16_t); \
+            element_type value; \
+            uint16_t i; \
+            (void)memcpy(&count, property_value, sizeof(uint16_t)); \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_003: [ The to_string function of each array type shall compute the length of the text form [v1,v2,...] of the values by adding the lengths of the decimal representations of all the values, before writing anything. ]*/ \
+            size_t length = 2 + ((count > 0) ? (size_t)count - 1 : 0); \
+            for (i = 0; i < count; i++) \
+            { \
+                (void)memcpy(&value, values + (size_t)i * sizeof(element_type), sizeof(element_type)); \
+                length += length_function((wide_type)value); \
+            } \
+            if ((buffer == NULL) || (buffer_length == 0)) \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_004: [ If buffer is NULL or buffer_length is 0, the to_string function of each array type shall only return the length of the text form. ]*/ \
+            } \
+            else if (buffer_length > length) \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_005: [ If the text form fits in buffer, the to_string function of each array type shall write [, the values separated by , (each written with integer_to_string_write_int64 or integer_to_string_write_uint64, without any further bounds check), ] and a zero terminator. ]*/ \
+                char* pos = buffer; \
+                *pos++ = '['; \
+                for (i = 0; i < count; i++) \
+                { \
+                    if (i > 0) \
+                    { \
+                        *pos++ = ','; \
+                    } \
+                    (void)memcpy(&value, values + (size_t)i * sizeof(element_type), sizeof(element_type)); \
+                    pos += write_function((wide_type)value, pos); \
+                } \
+                *pos++ = ']'; \
+                *pos = '\0'; \
+            } \
+            else \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_006: [ Otherwise the to_string function of each array type shall write the first buffer_length - 1 characters of the text form in buffer, followed by a zero terminator. ]*/ \
+                size_t pos = 0; \
+                append_truncated(buffer, buffer_length, &pos, "[", 1); \
+                for (i = 0; (i < count) && (pos < buffer_length - 1); i++) \
+                { \
+                    char temp[1 + INTEGER_TO_STRING_MAX_LENGTH]; \
+                    uint32_t temp_length = 0; \
+                    if (i > 0) \
+                    { \
+                        temp[temp_length++] = ','; \
+                    } \
+                    (void)memcpy(&value, values + (size_t)i * sizeof(element_type), sizeof(element_type)); \
+                    temp_length += write_function((wide_type)value, temp + temp_length); \
+                    append_truncated(buffer, buffer_length, &pos, temp, temp_length); \
+                } \
+                append_truncated(buffer, buffer_length, &pos, "]", 1); \
+                buffer[pos] = '\0'; \
+            } \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_007: [ The to_string function of each array type shall return the length of the text form, excluding the zero terminator. ]*/ \
+            result = (int)length; \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_ARRAY_TYPE_COPY(element_type) \
+    static int MU_C2(element_type, _array_log_context_property_type_copy)(void* dst_value, const void* src_value) \
+    { \
+        int result; \
+        if ( \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_008: [ If dst_value is NULL, the copy function of each array type shall fail and return a non-zero value. ]*/ \
+            (dst_value == NULL) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_009: [ If src_value is NULL, the copy function of each array type shall fail and return a non-zero value. ]*/ \
+            (src_value == NULL) \
+            ) \
+        { \
+            (void)printf("Invalid arguments: void* dst_value=%p, void* src_value=%p\r\n", \
+                dst_value, src_value); \
+            result = MU_FAILURE; \
+        } \
+        else \
+        { \
+            uint16_t count; \
+            (void)memcpy(&count, src_value, sizeof(uint16_t)); \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_010: [ The copy function of each array type shall copy the count and the values from src_value to dst_value. ]*/ \
+            (void)memcpy(dst_value, src_value, sizeof(uint16_t) + (size_t)count * sizeof(element_type)); \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_011: [ The copy function of each array type shall succeed and return 0. ]*/ \
+            result = 0; \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_ARRAY_TYPE_FREE(element_type) \
+    static void MU_C2(element_type, _array_log_context_property_type_free)(void* value) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_012: [ The free function of each array type shall return. ]*/ \
+        (void)value; \
+    } \
+
+#define DEFINE_ARRAY_TYPE_GET_TYPE(element_type) \
+    static LOG_CONTEXT_PROPERTY_TYPE MU_C2(element_type, _array_log_context_property_type_get_type)(void) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_013: [ The get_type function of each array type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_{element_type}_array. ]*/ \
+        return MU_C3(LOG_CONTEXT_PROPERTY_TYPE_, element_type, _array); \
+    } \
+
+#define DEFINE_ARRAY_TYPE_GET_SIZE(element_type) \
+    static int MU_C2(element_type, _array_log_context_property_type_get_size)(const void* property_value) \
+    { \
+        int result; \
+        if (property_value == NULL) \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_027: [ If property_value is NULL, the get_size function of each array type shall fail and return a negative value. ]*/ \
+            (void)printf("Invalid arguments: const void* property_value=%p\r\n", property_value); \
+            result = -1; \
+        } \
+        else \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_028: [ Otherwise the get_size function of each array type shall return sizeof(uint16_t) plus the count stored in property_value multiplied by sizeof(element_type). ]*/ \
+            result = (int)get_array_value_size(property_value, sizeof(element_type)); \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_ARRAY_TYPE_SERIALIZE(element_type) \
+    static int MU_C2(element_type, _array_log_context_property_type_serialize)(const void* property_value, void* buffer, size_t buffer_size) \
+    { \
+        int result; \
+        if ( \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_029: [ If property_value is NULL, the serialize function of each array type shall fail and return a negative value. ]*/ \
+            (property_value == NULL) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_030: [ If buffer is NULL and buffer_size is greater than 0, the serialize function of each array type shall fail and return a negative value. ]*/ \
+            ((buffer == NULL) && (buffer_size > 0)) \
+            ) \
+        { \
+            (void)printf("Invalid arguments: const void* property_value=%p, void* buffer=%p, size_t buffer_size=%zu\r\n", \
+                property_value, buffer, buffer_size); \
+            result = -1; \
+        } \
+        else \
+        { \
+            size_t size = get_array_value_size(property_value, sizeof(element_type)); \
+            if (size <= buffer_size) \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_031: [ If the count and the values fit in buffer_size, the serialize function of each array type shall copy the count and the values from property_value to buffer. ]*/ \
+                (void)memcpy(buffer, property_value, size); \
+            } \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_032: [ The serialize function of each array type shall succeed and return sizeof(uint16_t) plus the count multiplied by sizeof(element_type). ]*/ \
+            result = (int)size; \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_ARRAY_TYPE_DESERIALIZE(element_type) \
+    static int MU_C2(element_type, _array_log_context_property_type_deserialize)(void* dst_value, size_t dst_size, const void* buffer, size_t buffer_size) \
+    { \
+        int result; \
+        if ( \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_033: [ If dst_value is NULL and dst_size is greater than 0, the deserialize function of each array type shall fail and return a negative value. ]*/ \
+            ((dst_value == NULL) && (dst_size > 0)) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_034: [ If buffer is NULL, the deserialize function of each array type shall fail and return a negative value. ]*/ \
+            (buffer == NULL) \
+            ) \
+        { \
+            (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const void* buffer=%p, size_t buffer_size=%zu\r\n", \
+                dst_value, dst_size, buffer, buffer_size); \
+            result = -1; \
+        } \
+        else if ( \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_035: [ If buffer_size is smaller than sizeof(uint16_t) or is not sizeof(uint16_t) plus the count stored at the beginning of buffer multiplied by sizeof(element_type), the deserialize function of each array type shall fail and return a negative value. ]*/ \
+            (buffer_size < sizeof(uint16_t)) || \
+            (buffer_size != get_array_value_size(buffer, sizeof(element_type))) \
+            ) \
+        { \
+            (void)printf("Buffer of size %zu does not hold a count and exactly that many values\r\n", buffer_size); \
+            result = -1; \
+        } \
+        else \
+        { \
+            if (buffer_size <= dst_size) \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_036: [ If buffer_size bytes fit in dst_size, the deserialize function of each array type shall copy the count and the values from buffer to dst_value. ]*/ \
+                (void)memcpy(dst_value, buffer, buffer_size); \
+            } \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_037: [ The deserialize function of each array type shall succeed and return buffer_size. ]*/ \
+            result = (int)buffer_size; \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_ARRAY_TYPE_INIT(element_type) \
+    int LOG_CONTEXT_PROPERTY_TYPE_INIT(element_type##_array)(void* dst_value, const element_type* values, size_t count) \
+    { \
+        int result; \
+        if ( \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_014: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT of each array type shall fail and return a non-zero value. ]*/ \
+            (dst_value == NULL) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_015: [ If values is NULL and count is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_INIT of each array type shall fail and return a non-zero value. ]*/ \
+            ((values == NULL) && (count > 0)) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_016: [ If count is greater than LOG_CONTEXT_ARRAY_MAX_COUNT, LOG_CONTEXT_PROPERTY_TYPE_INIT of each array type shall fail and return a non-zero value. ]*/ \
+            (count > LOG_CONTEXT_ARRAY_MAX_COUNT) \
+            ) \
+        { \
+            (void)printf("Invalid arguments: void* dst_value=%p, const " MU_TOSTRING(element_type) "* values=%p, size_t count=%zu\r\n", \
+                dst_value, (const void*)values, count); \
+            result = MU_FAILURE; \
+        } \
+        else \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_017: [ LOG_CONTEXT_PROPERTY_TYPE_INIT of each array type shall store in the memory at dst_value the count as a uint16_t followed by the count values. ]*/ \
+            store_array_value(dst_value, values, (uint16_t)count, sizeof(element_type)); \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_018: [ LOG_CONTEXT_PROPERTY_TYPE_INIT of each array type shall succeed and return 0. ]*/ \
+            result = 0; \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_ARRAY_TYPE_GET_INIT_DATA_SIZE(element_type) \
+    int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(element_type##_array)(size_t count) \
+    { \
+        int result; \
+        if (count > LOG_CONTEXT_ARRAY_MAX_COUNT) \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_019: [ If count is greater than LOG_CONTEXT_ARRAY_MAX_COUNT, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE of each array type shall return a negative value. ]*/ \
+            (void)printf("Array too long: count=%zu\r\n", count); \
+            result = -1; \
+        } \
+        else \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_020: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE of each array type shall return sizeof(uint16_t) + count * sizeof(element_type). ]*/ \
+            result = (int)(sizeof(uint16_t) + count * sizeof(element_type)); \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_ARRAY_TYPE_FILL(element_type) \
+    int LOG_CONTEXT_PROPERTY_TYPE_FILL(element_type##_array)(void* dst_value, size_t dst_size, const element_type* values, size_t count) \
+    { \
+        int result; \
+        if ( \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_021: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_FILL of each array type shall fail and return a negative value. ]*/ \
+            ((dst_value == NULL) && (dst_size > 0)) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_022: [ If values is NULL and count is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_FILL of each array type shall fail and return a negative value. ]*/ \
+            ((values == NULL) && (count > 0)) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_023: [ If count is greater than LOG_CONTEXT_ARRAY_MAX_COUNT, LOG_CONTEXT_PROPERTY_TYPE_FILL of each array type shall fail and return a negative value. ]*/ \
+            (count > LOG_CONTEXT_ARRAY_MAX_COUNT) \
+            ) \
+        { \
+            (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const " MU_TOSTRING(element_type) "* values=%p, size_t count=%zu\r\n", \
+                dst_value, dst_size, (const void*)values, count); \
+            result = -1; \
+        } \
+        else \
+        { \
+            size_t needed_size = sizeof(uint16_t) + count * sizeof(element_type); \
+            if (needed_size <= dst_size) \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_024: [ If sizeof(uint16_t) + count * sizeof(element_type) bytes fit in dst_size, LOG_CONTEXT_PROPERTY_TYPE_FILL of each array type shall store in the memory at dst_value the count as a uint16_t followed by the count values. ]*/ \
+                store_array_value(dst_value, values, (uint16_t)count, sizeof(element_type)); \
+            } \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_025: [ LOG_CONTEXT_PROPERTY_TYPE_FILL of each array type shall succeed and return sizeof(uint16_t) + count * sizeof(element_type). ]*/ \
+            result = (int)needed_size; \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_ARRAY_TYPE_IF(element_type) \
+    const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(element_type##_array) = \
+    { \
+        .to_string = MU_C2(element_type, _array_log_context_property_type_to_string), \
+        .copy = MU_C2(element_type, _array_log_context_property_type_copy), \
+        .free = MU_C2(element_type, _array_log_context_property_type_free), \
+        .get_type = MU_C2(element_type, _array_log_context_property_type_get_type), \
+        .get_size = MU_C2(element_type, _array_log_context_property_type_get_size), \
+        .serialize = MU_C2(element_type, _array_log_context_property_type_serialize), \
+        .deserialize = MU_C2(element_type, _array_log_context_property_type_deserialize), \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_026: [ The type_tag of each array type shall be the property type LOG_CONTEXT_PROPERTY_TYPE_{element_type}_array. ]*/ \
+        .type_tag = MU_C3(LOG_CONTEXT_PROPERTY_TYPE_, element_type, _array) \
+    }; \
+
+#define DEFINE_ARRAY_TYPE(element_type, wide_type, length_function, write_function) \
+    DEFINE_ARRAY_TYPE_TO_STRING(element_type, wide_type, length_function, write_function) \
+    DEFINE_ARRAY_TYPE_COPY(element_type) \
+    DEFINE_ARRAY_TYPE_FREE(element_type) \
+    DEFINE_ARRAY_TYPE_GET_TYPE(element_type) \
+    DEFINE_ARRAY_TYPE_GET_SIZE(element_type) \
+    DEFINE_ARRAY_TYPE_SERIALIZE(element_type) \
+    DEFINE_ARRAY_TYPE_DESERIALIZE(element_type) \
+    DEFINE_ARRAY_TYPE_INIT(element_type) \
+    DEFINE_ARRAY_TYPE_GET_INIT_DATA_SIZE(element_type) \
+    DEFINE_ARRAY_TYPE_FILL(element_type) \
+    DEFINE_ARRAY_TYPE_IF(element_type) \
+
+#define DEFINE_SIGNED_ARRAY_TYPE(element_type) \
+    DEFINE_ARRAY_TYPE(element_type, int64_t, integer_to_string_int64_length, integer_to_string_write_int64) \
+
+#define DEFINE_UNSIGNED_ARRAY_TYPE(element_type) \
+    DEFINE_ARRAY_TYPE(element_type, uint64_t, integer_to_string_uint64_digit_count, integer_to_string_write_uint64) \
+
+DEFINE_SIGNED_ARRAY_TYPE(int64_t)
+DEFINE_UNSIGNED_ARRAY_TYPE(uint64_t)
+DEFINE_SIGNED_ARRAY_TYPE(int32_t)
+DEFINE_UNSIGNED_ARRAY_TYPE(uint32_t)
+DEFINE_SIGNED_ARRAY_TYPE(int16_t)
+DEFINE_UNSIGNED_ARRAY_TYPE(uint16_t)
+DEFINE_SIGNED_ARRAY_TYPE(int8_t)
+DEFINE_UNSIGNED_ARRAY_TYPE(uint8_t)
@@ -76,6 +76,87 @@ static LOG_CONTEXT_PROPERTY_TYPE ascii_char_ptr_log_context_property_type_get_ty
     return LOG_CONTEXT_PROPERTY_TYPE_ascii_char_ptr;
 }
 
+static int ascii_char_ptr_log_context_property_type_get_size(const void* property_value)
+{
+    int result;
+    if (property_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_026: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).get_size shall fail and return a negative value. ]*/
+        (void)printf("Invalid arguments: const void* property_value=%p\r\n", property_value);
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_027: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).get_size shall return the length of the string pointed to by property_value plus 1 (for the null terminator). ]*/
+        result = (int)strlen(property_value) + 1;
+    }
+    return result;
+}
+
+static int ascii_char_ptr_log_context_property_type_serialize(const void* property_value, void* buffer, size_t buffer_size)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_028: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize shall fail and return a negative value. ]*/
+        (property_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_029: [ If buffer is NULL and buffer_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_size > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const void* property_value=%p, void* buffer=%p, size_t buffer_size=%zu\r\n",
+            property_value, buffer, buffer_size);
+        result = -1;
+    }
+    else
+    {
+        size_t size = strlen(property_value) + 1;
+        if (size <= buffer_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_030: [ If the string and its null terminator fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize shall copy the string (including the null terminator) from property_value to buffer. ]*/
+            (void)memcpy(buffer, property_value, size);
+        }
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_031: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize shall succeed and return the length of the string plus 1. ]*/
+        result = (int)size;
+    }
+    return result;
+}
+
+static int ascii_char_ptr_log_context_property_type_deserialize(void* dst_value, size_t dst_size, const void* buffer, size_t buffer_size)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_032: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize shall fail and return a negative value. ]*/
+        ((dst_value == NULL) && (dst_size > 0)) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_033: [ If buffer is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize shall fail and return a negative value. ]*/
+        (buffer == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const void* buffer=%p, size_t buffer_size=%zu\r\n",
+            dst_value, dst_size, buffer, buffer_size);
+        result = -1;
+    }
+    else if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_034: [ If the first null terminator in buffer is not the byte at buffer_size - 1, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize shall fail and return a negative value. ]*/
+        (buffer_size == 0) ||
+        (memchr(buffer, '\0', buffer_size) != (const char*)buffer + buffer_size - 1)
+        )
+    {
+        (void)printf("Buffer of size %zu does not hold exactly one null terminated string\r\n", buffer_size);
+        result = -1;
+    }
+    else
+    {
+        if (buffer_size <= dst_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_035: [ If buffer_size bytes fit in dst_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize shall copy the string (including the null terminator) from buffer to dst_value. ]*/
+            (void)memcpy(dst_value, buffer, buffer_size);
+        }
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_036: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize shall succeed and return buffer_size. ]*/
+        result = (int)buffer_size;
+    }
+    return result;
+}
+
 int LOG_CONTEXT_PROPERTY_TYPE_INIT(ascii_char_ptr)(void* dst_value, const char* format, ...)
 {
     int result;
@@ -132,10 +213,54 @@ int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(ascii_char_ptr)(const char* for
     return result;
 }
 
+int LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr)(void* dst_value, size_t dst_size, const char* format, ...)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_020: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr) shall fail and return a negative value. ]*/
+        ((dst_value == NULL) && (dst_size > 0)) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_021: [ If format is NULL, LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr) shall fail and return a negative value. ]*/
+        (format == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const char* format=%s\r\n",
+            dst_value, dst_size, MU_P_OR_NULL(format));
+        result = -1;
+    }
+    else
+    {
+        va_list args;
+        va_start(args, format);
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr) shall format in the memory at dst_value by calling vsnprintf with dst_value, dst_size, format and the arguments in .... ]*/
+        int vsnprintf_result = vsnprintf(dst_value, dst_size, format, args);
+        if (vsnprintf_result < 0)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_023: [ If vsnprintf fails, LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr) shall fail and return a negative value. ]*/
+            result = -1;
+        }
+        else
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_024: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr) shall succeed and return the amount of memory needed to store the formatted string, including the null terminator. ]*/
+            result = vsnprintf_result + 1;
+        }
+
+        va_end(args);
+    }
+
+    return result;
+}
+
 const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr) =
 {
     .to_string = ascii_char_ptr_log_context_property_type_to_string,
     .copy = ascii_char_ptr_log_context_property_type_copy,
     .free = ascii_char_ptr_log_context_property_type_free,
-    .get_type = ascii_char_ptr_log_context_property_type_get_type
+    .get_type = ascii_char_ptr_log_context_property_type_get_type,
+    .get_size = ascii_char_ptr_log_context_property_type_get_size,
+    .serialize = ascii_char_ptr_log_context_property_type_serialize,
+    .deserialize = ascii_char_ptr_log_context_property_type_deserialize,
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_025: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_ascii_char_ptr. ]*/
+    .type_tag = LOG_CONTEXT_PROPERTY_TYPE_ascii_char_ptr
 };
@@ -0,0 +1,489 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/binary_to_hex_string.h"
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+
+#include "c_logging/log_context_property_type_binary.h"
+
+static void store_binary_value(void* dst_value, const void* data, uint16_t length)
+{
+    (void)memcpy(dst_value, &length, sizeof(uint16_t));
+    if (length > 0)
+    {
+        (void)memcpy((uint8_t*)dst_value + sizeof(uint16_t), data, length);
+    }
+}
+
+// the binary form of both types is the length as a uint16_t followed by the bytes
+static bool is_serialized_binary_value(const void* buffer, size_t buffer_size)
+{
+    bool result;
+    if (buffer_size < sizeof(uint16_t))
+    {
+        result = false;
+    }
+    else
+    {
+        uint16_t length;
+        (void)memcpy(&length, buffer, sizeof(uint16_t));
+        result = (buffer_size == sizeof(uint16_t) + (size_t)length);
+    }
+    return result;
+}
+
+static int binary_log_context_property_type_to_string(const void* property_value, char* buffer, size_t buffer_length)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_001: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string shall fail and return a negative value. ]*/
+        (property_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_002: [ If buffer is NULL and buffer_length is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_length > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const void* property_value=%p, char* buffer=%p, size_t buffer_length=%zu\r\n",
+            property_value, buffer, buffer_length);
+        result = -1;
+    }
+    else
+    {
+        uint16_t length;
+        (void)memcpy(&length, property_value, sizeof(uint16_t));
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_003: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string shall produce the hex representation of the bytes that follow the length in property_value by calling binary_to_hex_string with buffer and buffer_length. ]*/
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_004: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string shall return the result of binary_to_hex_string. ]*/
+        result = binary_to_hex_string((const uint8_t*)property_value + sizeof(uint16_t), length, buffer, buffer_length);
+    }
+    return result;
+}
+
+static int binary_log_context_property_type_copy(void* dst_value, const void* src_value)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_005: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).copy shall fail and return a non-zero value. ]*/
+        (dst_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_006: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).copy shall fail and return a non-zero value. ]*/
+        (src_value == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, void* src_value=%p\r\n",
+            dst_value, src_value);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        uint16_t length;
+        (void)memcpy(&length, src_value, sizeof(uint16_t));
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_007: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).copy shall copy the length and the bytes from src_value to dst_value. ]*/
+        (void)memcpy(dst_value, src_value, sizeof(uint16_t) + (size_t)length);
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_008: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).copy shall succeed and return 0. ]*/
+        result = 0;
+    }
+
+    return result;
+}
+
+static void binary_log_context_property_type_free(void* value)
+{
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_009: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).free shall return. ]*/
+    (void)value;
+}
+
+static LOG_CONTEXT_PROPERTY_TYPE binary_log_context_property_type_get_type(void)
+{
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_010: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).get_type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_binary. ]*/
+    return LOG_CONTEXT_PROPERTY_TYPE_binary;
+}
+
+static int binary_log_context_property_type_get_size(const void* property_value)
+{
+    int result;
+    if (property_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_041: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).get_size shall fail and return a negative value. ]*/
+        (void)printf("Invalid arguments: const void* property_value=%p\r\n", property_value);
+        result = -1;
+    }
+    else
+    {
+        uint16_t length;
+        (void)memcpy(&length, property_value, sizeof(uint16_t));
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_042: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).get_size shall return sizeof(uint16_t) plus the length stored in property_value. ]*/
+        result = (int)sizeof(uint16_t) + (int)length;
+    }
+    return result;
+}
+
+static int binary_log_context_property_type_serialize(const void* property_value, void* buffer, size_t buffer_size)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_043: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).serialize shall fail and return a negative value. ]*/
+        (property_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_044: [ If buffer is NULL and buffer_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).serialize shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_size > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const void* property_value=%p, void* buffer=%p, size_t buffer_size=%zu\r\n",
+            property_value, buffer, buffer_size);
+        result = -1;
+    }
+    else
+    {
+        uint16_t length;
+        (void)memcpy(&length, property_value, sizeof(uint16_t));
+        size_t size = sizeof(uint16_t) + (size_t)length;
+        if (size <= buffer_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_045: [ If the length and the bytes fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).serialize shall copy the length and the bytes from property_value to buffer. ]*/
+            (void)memcpy(buffer, property_value, size);
+        }
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_046: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).serialize shall succeed and return sizeof(uint16_t) plus the length. ]*/
+        result = (int)size;
+    }
+    return result;
+}
+
+static int binary_log_context_property_type_deserialize(void* dst_value, size_t dst_size, const void* buffer, size_t buffer_size)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_047: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize shall fail and return a negative value. ]*/
+        ((dst_value == NULL) && (dst_size > 0)) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_048: [ If buffer is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize shall fail and return a negative value. ]*/
+        (buffer == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const void* buffer=%p, size_t buffer_size=%zu\r\n",
+            dst_value, dst_size, buffer, buffer_size);
+        result = -1;
+    }
+    else if (!is_serialized_binary_value(buffer, buffer_size))
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_049: [ If buffer_size is smaller than sizeof(uint16_t) or is not sizeof(uint16_t) plus the length stored at the beginning of buffer, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize shall fail and return a negative value. ]*/
+        (void)printf("Buffer of size %zu does not hold a length and exactly that many bytes\r\n", buffer_size);
+        result = -1;
+    }
+    else
+    {
+        if (buffer_size <= dst_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_050: [ If buffer_size bytes fit in dst_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize shall copy the length and the bytes from buffer to dst_value. ]*/
+            (void)memcpy(dst_value, buffer, buffer_size);
+        }
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_051: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize shall succeed and return buffer_size. ]*/
+        result = (int)buffer_size;
+    }
+    return result;
+}
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(void* dst_value, const void* data, size_t length)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_011: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(binary) shall fail and return a non-zero value. ]*/
+        (dst_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_012: [ If data is NULL and length is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_INIT(binary) shall fail and return a non-zero value. ]*/
+        ((data == NULL) && (length > 0)) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_013: [ If length is greater than LOG_CONTEXT_BINARY_MAX_LENGTH, LOG_CONTEXT_PROPERTY_TYPE_INIT(binary) shall fail and return a non-zero value. ]*/
+        (length > LOG_CONTEXT_BINARY_MAX_LENGTH)
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, const void* data=%p, size_t length=%zu\r\n",
+            dst_value, data, length);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_014: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(binary) shall store in the memory at dst_value the length as a uint16_t followed by the length bytes at data. ]*/
+        store_binary_value(dst_value, data, (uint16_t)length);
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_015: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(binary) shall succeed and return 0. ]*/
+        result = 0;
+    }
+
+    return result;
+}
+
+int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(binary)(size_t length)
+{
+    int result;
+
+    if (length > LOG_CONTEXT_BINARY_MAX_LENGTH)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_016: [ If length is greater than LOG_CONTEXT_BINARY_MAX_LENGTH, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(binary) shall return a negative value. ]*/
+        (void)printf("Binary value too long: length=%zu\r\n", length);
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_017: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(binary) shall return sizeof(uint16_t) + length. ]*/
+        result = (int)(sizeof(uint16_t) + length);
+    }
+
+    return result;
+}
+
+int LOG_CONTEXT_PROPERTY_TYPE_FILL(binary)(void* dst_value, size_t dst_size, const void* data, size_t length)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_018: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_FILL(binary) shall fail and return a negative value. ]*/
+        ((dst_value == NULL) && (dst_size > 0)) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_019: [ If data is NULL and length is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_FILL(binary) shall fail and return a negative value. ]*/
+        ((data == NULL) && (length > 0)) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_020: [ If length is greater than LOG_CONTEXT_BINARY_MAX_LENGTH, LOG_CONTEXT_PROPERTY_TYPE_FILL(binary) shall fail and return a negative value. ]*/
+        (length > LOG_CONTEXT_BINARY_MAX_LENGTH)
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const void* data=%p, size_t length=%zu\r\n",
+            dst_value, dst_size, data, length);
+        result = -1;
+    }
+    else
+    {
+        size_t needed_size = sizeof(uint16_t) + length;
+
+        if (needed_size <= dst_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_021: [ If sizeof(uint16_t) + length bytes fit in dst_size, LOG_CONTEXT_PROPERTY_TYPE_FILL(binary) shall store in the memory at dst_value the length as a uint16_t followed by the length bytes at data. ]*/
+            store_binary_value(dst_value, data, (uint16_t)length);
+        }
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_FILL(binary) shall succeed and return sizeof(uint16_t) + length. ]*/
+        result = (int)needed_size;
+    }
+
+    return result;
+}
+
+const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary) =
+{
+    .to_string = binary_log_context_property_type_to_string,
+    .copy = binary_log_context_property_type_copy,
+    .free = binary_log_context_property_type_free,
+    .get_type = binary_log_context_property_type_get_type,
+    .get_size = binary_log_context_property_type_get_size,
+    .serialize = binary_log_context_property_type_serialize,
+    .deserialize = binary_log_context_property_type_deserialize,
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_binary. ]*/
+    .type_tag = LOG_CONTEXT_PROPERTY_TYPE_binary
+};
+
+static int borrowed_binary_log_context_property_type_to_string(const void* property_value, char* buffer, size_t buffer_length)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_024: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).to_string shall fail and return a negative value. ]*/
+        (property_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_025: [ If buffer is NULL and buffer_length is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).to_string shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_length > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const void* property_value=%p, char* buffer=%p, size_t buffer_length=%zu\r\n",
+            property_value, buffer, buffer_length);
+        result = -1;
+    }
+    else
+    {
+        const BORROWED_BINARY* borrowed = property_value;
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_026: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).to_string shall produce the hex representation of the borrowed bytes by calling binary_to_hex_string with buffer and buffer_length. ]*/
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_027: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).to_string shall return the result of binary_to_hex_string. ]*/
+        result = binary_to_hex_string(borrowed->data, borrowed->length, buffer, buffer_length);
+    }
+    return result;
+}
+
+static int borrowed_binary_log_context_property_type_copy(void* dst_value, const void* src_value)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_028: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).copy shall fail and return a non-zero value. ]*/
+        (dst_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_029: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).copy shall fail and return a non-zero value. ]*/
+        (src_value == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, void* src_value=%p\r\n",
+            dst_value, src_value);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_030: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).copy shall copy the pointer and the length from src_value to dst_value (the bytes stay borrowed). ]*/
+        (void)memcpy(dst_value, src_value, sizeof(BORROWED_BINARY));
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_031: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).copy shall succeed and return 0. ]*/
+        result = 0;
+    }
+
+    return result;
+}
+
+static void borrowed_binary_log_context_property_type_free(void* value)
+{
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_032: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).free shall return. ]*/
+    (void)value;
+}
+
+static LOG_CONTEXT_PROPERTY_TYPE borrowed_binary_log_context_property_type_get_type(void)
+{
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_033: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).get_type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary. ]*/
+    return LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary;
+}
+
+static int borrowed_binary_log_context_property_type_get_size(const void* property_value)
+{
+    int result;
+    if (property_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_052: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).get_size shall fail and return a negative value. ]*/
+        (void)printf("Invalid arguments: const void* property_value=%p\r\n", property_value);
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_053: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).get_size shall return sizeof(BORROWED_BINARY). ]*/
+        result = (int)sizeof(BORROWED_BINARY);
+    }
+    return result;
+}
+
+static int borrowed_binary_log_context_property_type_serialize(const void* property_value, void* buffer, size_t buffer_size)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_054: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).serialize shall fail and return a negative value. ]*/
+        (property_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_055: [ If buffer is NULL and buffer_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).serialize shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_size > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const void* property_value=%p, void* buffer=%p, size_t buffer_size=%zu\r\n",
+            property_value, buffer, buffer_size);
+        result = -1;
+    }
+    else
+    {
+        const BORROWED_BINARY* borrowed = property_value;
+        size_t size = sizeof(uint16_t) + (size_t)borrowed->length;
+        if (size <= buffer_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_056: [ If the length and the borrowed bytes fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).serialize shall write to buffer the length as a uint16_t followed by the borrowed bytes. ]*/
+            (void)memcpy(buffer, &borrowed->length, sizeof(uint16_t));
+            if (borrowed->length > 0)
+            {
+                (void)memcpy((uint8_t*)buffer + sizeof(uint16_t), borrowed->data, borrowed->length);
+            }
+        }
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_057: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).serialize shall succeed and return sizeof(uint16_t) plus the length. ]*/
+        result = (int)size;
+    }
+    return result;
+}
+
+static int borrowed_binary_log_context_property_type_deserialize(void* dst_value, size_t dst_size, const void* buffer, size_t buffer_size)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_058: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize shall fail and return a negative value. ]*/
+        ((dst_value == NULL) && (dst_size > 0)) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_059: [ If buffer is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize shall fail and return a negative value. ]*/
+        (buffer == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const void* buffer=%p, size_t buffer_size=%zu\r\n",
+            dst_value, dst_size, buffer, buffer_size);
+        result = -1;
+    }
+    else if (!is_serialized_binary_value(buffer, buffer_size))
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_060: [ If buffer_size is smaller than sizeof(uint16_t) or is not sizeof(uint16_t) plus the length stored at the beginning of buffer, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize shall fail and return a negative value. ]*/
+        (void)printf("Buffer of size %zu does not hold a length and exactly that many bytes\r\n", buffer_size);
+        result = -1;
+    }
+    else
+    {
+        if (sizeof(BORROWED_BINARY) <= dst_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_061: [ If sizeof(BORROWED_BINARY) fits in dst_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize shall store in dst_value a BORROWED_BINARY that borrows the bytes that follow the length in buffer. ]*/
+            BORROWED_BINARY borrowed;
+            (void)memcpy(&borrowed.length, buffer, sizeof(uint16_t));
+            borrowed.data = (const uint8_t*)buffer + sizeof(uint16_t);
+            (void)memcpy(dst_value, &borrowed, sizeof(BORROWED_BINARY));
+        }
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize shall succeed and return sizeof(BORROWED_BINARY). ]*/
+        result = (int)sizeof(BORROWED_BINARY);
+    }
+    return result;
+}
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary)(void* dst_value, const void* data, size_t length)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_034: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary) shall fail and return a non-zero value. ]*/
+        (dst_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_035: [ If data is NULL and length is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary) shall fail and return a non-zero value. ]*/
+        ((data == NULL) && (length > 0)) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_036: [ If length is greater than LOG_CONTEXT_BINARY_MAX_LENGTH, LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary) shall fail and return a non-zero value. ]*/
+        (length > LOG_CONTEXT_BINARY_MAX_LENGTH)
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, const void* data=%p, size_t length=%zu\r\n",
+            dst_value, data, length);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        BORROWED_BINARY borrowed;
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_037: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary) shall store in the memory at dst_value the pointer data and length, without copying the bytes. ]*/
+        borrowed.data = data;
+        borrowed.length = (uint16_t)length;
+        (void)memcpy(dst_value, &borrowed, sizeof(BORROWED_BINARY));
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_038: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary) shall succeed and return 0. ]*/
+        result = 0;
+    }
+
+    return result;
+}
+
+int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(borrowed_binary)(void)
+{
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_039: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(borrowed_binary) shall return sizeof(BORROWED_BINARY). ]*/
+    return (int)sizeof(BORROWED_BINARY);
+}
+
+const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary) =
+{
+    .to_string = borrowed_binary_log_context_property_type_to_string,
+    .copy = borrowed_binary_log_context_property_type_copy,
+    .free = borrowed_binary_log_context_property_type_free,
+    .get_type = borrowed_binary_log_context_property_type_get_type,
+    .get_size = borrowed_binary_log_context_property_type_get_size,
+    .serialize = borrowed_binary_log_context_property_type_serialize,
+    .deserialize = borrowed_binary_log_context_property_type_deserialize,
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_040: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary. ]*/
+    .type_tag = LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary
+};
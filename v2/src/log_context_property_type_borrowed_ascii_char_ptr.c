@@ -0,0 +1,279 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+
+#include "c_logging/log_context_property_type_borrowed_ascii_char_ptr.h"
+
+static int borrowed_ascii_char_ptr_log_context_property_type_to_string(const void* property_value, char* buffer, size_t buffer_length)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_001: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string shall fail and return a negative value. ]*/
+        (property_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_002: [ If buffer is NULL and buffer_length is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_length > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const void* property_value=%p, char* buffer=%p, size_t buffer_length=%zu\r\n",
+            property_value, buffer, buffer_length);
+        result = -1;
+    }
+    else
+    {
+        const BORROWED_ASCII_CHAR_PTR* borrowed = property_value;
+
+        if (borrowed->length > INT_MAX)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_003: [ If the length of the borrowed string does not fit in an int, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string shall fail and return a negative value. ]*/
+            (void)printf("Borrowed string too long: length=%zu\r\n", borrowed->length);
+            result = -1;
+        }
+        else
+        {
+            if (buffer_length > 0)
+            {
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_004: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string shall copy from the borrowed string as many characters as fit in buffer (keeping one byte for the null terminator), without computing the length of the string again. ]*/
+                size_t copy_length = (borrowed->length < buffer_length) ? borrowed->length : buffer_length - 1;
+                (void)memcpy(buffer, borrowed->value, copy_length);
+                buffer[copy_length] = '\0';
+            }
+
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_005: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string shall succeed and return the length of the borrowed string. ]*/
+            result = (int)borrowed->length;
+        }
+    }
+    return result;
+}
+
+static int borrowed_ascii_char_ptr_log_context_property_type_copy(void* dst_value, const void* src_value)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_006: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).copy shall fail and return a non-zero value. ]*/
+        (dst_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_007: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).copy shall fail and return a non-zero value. ]*/
+        (src_value == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, void* src_value=%p\r\n",
+            dst_value, src_value);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_008: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).copy shall copy the pointer and the length from src_value to dst_value (the string itself stays borrowed). ]*/
+        (void)memcpy(dst_value, src_value, sizeof(BORROWED_ASCII_CHAR_PTR));
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_009: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).copy shall succeed and return 0. ]*/
+        result = 0;
+    }
+
+    return result;
+}
+
+static void borrowed_ascii_char_ptr_log_context_property_type_free(void* value)
+{
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_010: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).free shall return. ]*/
+    (void)value;
+}
+
+static LOG_CONTEXT_PROPERTY_TYPE borrowed_ascii_char_ptr_log_context_property_type_get_type(void)
+{
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_011: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).get_type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr. ]*/
+    return LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr;
+}
+
+static int borrowed_ascii_char_ptr_log_context_property_type_get_size(const void* property_value)
+{
+    int result;
+    if (property_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_023: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).get_size shall fail and return a negative value. ]*/
+        (void)printf("Invalid arguments: const void* property_value=%p\r\n", property_value);
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_024: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).get_size shall return sizeof(BORROWED_ASCII_CHAR_PTR). ]*/
+        result = (int)sizeof(BORROWED_ASCII_CHAR_PTR);
+    }
+    return result;
+}
+
+static int borrowed_ascii_char_ptr_log_context_property_type_serialize(const void* property_value, void* buffer, size_t buffer_size)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_025: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize shall fail and return a negative value. ]*/
+        (property_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_026: [ If buffer is NULL and buffer_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_size > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const void* property_value=%p, void* buffer=%p, size_t buffer_size=%zu\r\n",
+            property_value, buffer, buffer_size);
+        result = -1;
+    }
+    else
+    {
+        const BORROWED_ASCII_CHAR_PTR* borrowed = property_value;
+
+        if (borrowed->length >= INT_MAX)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_027: [ If the length of the borrowed string plus 1 does not fit in an int, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize shall fail and return a negative value. ]*/
+            (void)printf("Borrowed string too long: length=%zu\r\n", borrowed->length);
+            result = -1;
+        }
+        else
+        {
+            if (borrowed->length < buffer_size)
+            {
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_028: [ If the borrowed string and a null terminator fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize shall copy the borrowed string to buffer, followed by a null terminator. ]*/
+                (void)memcpy(buffer, borrowed->value, borrowed->length);
+                ((char*)buffer)[borrowed->length] = '\0';
+            }
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_029: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize shall succeed and return the length of the borrowed string plus 1. ]*/
+            result = (int)borrowed->length + 1;
+        }
+    }
+    return result;
+}
+
+static int borrowed_ascii_char_ptr_log_context_property_type_deserialize(void* dst_value, size_t dst_size, const void* buffer, size_t buffer_size)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_030: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize shall fail and return a negative value. ]*/
+        ((dst_value == NULL) && (dst_size > 0)) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_031: [ If buffer is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize shall fail and return a negative value. ]*/
+        (buffer == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const void* buffer=%p, size_t buffer_size=%zu\r\n",
+            dst_value, dst_size, buffer, buffer_size);
+        result = -1;
+    }
+    else if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_032: [ If the first null terminator in buffer is not the byte at buffer_size - 1, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize shall fail and return a negative value. ]*/
+        (buffer_size == 0) ||
+        (memchr(buffer, '\0', buffer_size) != (const char*)buffer + buffer_size - 1)
+        )
+    {
+        (void)printf("Buffer of size %zu does not hold exactly one null terminated string\r\n", buffer_size);
+        result = -1;
+    }
+    else
+    {
+        if (sizeof(BORROWED_ASCII_CHAR_PTR) <= dst_size)
+        {
+            BORROWED_ASCII_CHAR_PTR borrowed;
+
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_033: [ If sizeof(BORROWED_ASCII_CHAR_PTR) fits in dst_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize shall store in dst_value a BORROWED_ASCII_CHAR_PTR that borrows the string in buffer, with the length buffer_size - 1. ]*/
+            borrowed.value = buffer;
+            borrowed.length = buffer_size - 1;
+            (void)memcpy(dst_value, &borrowed, sizeof(BORROWED_ASCII_CHAR_PTR));
+        }
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_034: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize shall succeed and return sizeof(BORROWED_ASCII_CHAR_PTR). ]*/
+        result = (int)sizeof(BORROWED_ASCII_CHAR_PTR);
+    }
+    return result;
+}
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr)(void* dst_value, const char* value)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_012: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr) shall fail and return a non-zero value. ]*/
+        (dst_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_013: [ If value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr) shall fail and return a non-zero value. ]*/
+        (value == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, const char* value=%p\r\n",
+            dst_value, value);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        BORROWED_ASCII_CHAR_PTR* borrowed = dst_value;
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_014: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr) shall store in the memory at dst_value the pointer value and the length of the string pointed to by value, without copying the string. ]*/
+        borrowed->value = value;
+        borrowed->length = strlen(value);
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_015: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr) shall succeed and return 0. ]*/
+        result = 0;
+    }
+
+    return result;
+}
+
+int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(borrowed_ascii_char_ptr)(void)
+{
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_016: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(borrowed_ascii_char_ptr) shall return sizeof(BORROWED_ASCII_CHAR_PTR). ]*/
+    return (int)sizeof(BORROWED_ASCII_CHAR_PTR);
+}
+
+int LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr)(void* dst_value, size_t dst_size, const char* value)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_017: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) shall fail and return a negative value. ]*/
+        ((dst_value == NULL) && (dst_size > 0)) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_018: [ If value is NULL, LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) shall fail and return a negative value. ]*/
+        (value == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const char* value=%p\r\n",
+            dst_value, dst_size, value);
+        result = -1;
+    }
+    else
+    {
+        size_t needed_size = strlen(value) + 1;
+
+        if (needed_size > INT_MAX)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_019: [ If the size of the string does not fit in an int, LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) shall fail and return a negative value. ]*/
+            (void)printf("String too long: needed_size=%zu\r\n", needed_size);
+            result = -1;
+        }
+        else
+        {
+            if (needed_size <= dst_size)
+            {
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_020: [ If the string (including the null terminator) fits in dst_size bytes, LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) shall copy it to dst_value, producing an ascii_char_ptr value. ]*/
+                (void)memcpy(dst_value, value, needed_size);
+            }
+
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_021: [ LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) shall succeed and return the amount of memory needed to store the string, including the null terminator. ]*/
+            result = (int)needed_size;
+        }
+    }
+
+    return result;
+}
+
+const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr) =
+{
+    .to_string = borrowed_ascii_char_ptr_log_context_property_type_to_string,
+    .copy = borrowed_ascii_char_ptr_log_context_property_type_copy,
+    .free = borrowed_ascii_char_ptr_log_context_property_type_free,
+    .get_type = borrowed_ascii_char_ptr_log_context_property_type_get_type,
+    .get_size = borrowed_ascii_char_ptr_log_context_property_type_get_size,
+    .serialize = borrowed_ascii_char_ptr_log_context_property_type_serialize,
+    .deserialize = borrowed_ascii_char_ptr_log_context_property_type_deserialize,
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr. ]*/
+    .type_tag = LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr
+};
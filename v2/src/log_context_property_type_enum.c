@@ -0,0 +1,220 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <inttypes.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/integer_to_string.h"
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+
+#include "c_logging/log_context_property_type_enum.h"
+
+// copies as much of source as fits in the buffer (keeping one byte for the zero terminator), starting at position, and returns the new position
+static size_t append_truncated(char* buffer, size_t buffer_length, size_t position, const char* source, size_t source_length)
+{
+    if (position + 1 < buffer_length)
+    {
+        size_t available = buffer_length - 1 - position;
+        (void)memcpy(buffer + position, source, (source_length < available) ? source_length : available);
+    }
+    return position + source_length;
+}
+
+int log_context_property_type_enum_to_string(const void* property_value, LOG_CONTEXT_PROPERTY_TYPE_ENUM_VALUE_TO_STRING value_to_string, char* buffer, size_t buffer_length)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_008: [ If property_value is NULL, log_context_property_type_enum_to_string shall fail and return a negative value. ]*/
+        (property_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_009: [ If value_to_string is NULL, log_context_property_type_enum_to_string shall fail and return a negative value. ]*/
+        (value_to_string == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_010: [ If buffer is NULL and buffer_length is greater than 0, log_context_property_type_enum_to_string shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_length > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const void* property_value=%p, LOG_CONTEXT_PROPERTY_TYPE_ENUM_VALUE_TO_STRING value_to_string=%p, char* buffer=%p, size_t buffer_length=%zu\r\n",
+            property_value, (void*)value_to_string, buffer, buffer_length);
+        result = -1;
+    }
+    else
+    {
+        int32_t value;
+        (void)memcpy(&value, property_value, sizeof(int32_t));
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_011: [ log_context_property_type_enum_to_string shall obtain the string for the stored value by calling value_to_string. ]*/
+        const char* value_string = value_to_string(value);
+        if (value_string == NULL)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_012: [ If value_to_string returns NULL, log_context_property_type_enum_to_string shall use an empty string. ]*/
+            value_string = "";
+        }
+
+        char number[INTEGER_TO_STRING_MAX_LENGTH + 1];
+        size_t number_length = (size_t)integer_to_string_int32(value, number, sizeof(number));
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_013: [ log_context_property_type_enum_to_string shall produce the string of the value, followed by a space, (, the decimal value and ). ]*/
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_014: [ log_context_property_type_enum_to_string shall write in buffer as many characters of the representation as fit (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+        size_t length = append_truncated(buffer, buffer_length, 0, value_string, strlen(value_string));
+        length = append_truncated(buffer, buffer_length, length, " (", 2);
+        length = append_truncated(buffer, buffer_length, length, number, number_length);
+        length = append_truncated(buffer, buffer_length, length, ")", 1);
+
+        if (buffer_length > 0)
+        {
+            buffer[(length < buffer_length) ? length : buffer_length - 1] = '\0';
+        }
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_015: [ log_context_property_type_enum_to_string shall succeed and return the length of the full representation. ]*/
+        result = (int)length;
+    }
+
+    return result;
+}
+
+int log_context_property_type_enum_init(void* dst_value, int32_t value)
+{
+    int result;
+
+    if (dst_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_016: [ If dst_value is NULL, log_context_property_type_enum_init shall fail and return a non-zero value. ]*/
+        (void)printf("Invalid arguments: void* dst_value=%p, int32_t value=%" PRId32 "\r\n",
+            dst_value, value);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_017: [ log_context_property_type_enum_init shall store value in dst_value as an int32_t. ]*/
+        (void)memcpy(dst_value, &value, sizeof(int32_t));
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_018: [ log_context_property_type_enum_init shall succeed and return 0. ]*/
+        result = 0;
+    }
+
+    return result;
+}
+
+int log_context_property_type_enum_copy(void* dst_value, const void* src_value)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_019: [ If dst_value is NULL, log_context_property_type_enum_copy shall fail and return a non-zero value. ]*/
+        (dst_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_020: [ If src_value is NULL, log_context_property_type_enum_copy shall fail and return a non-zero value. ]*/
+        (src_value == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, void* src_value=%p\r\n",
+            dst_value, src_value);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_021: [ log_context_property_type_enum_copy shall copy the int32_t value from src_value to dst_value. ]*/
+        (void)memcpy(dst_value, src_value, sizeof(int32_t));
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_022: [ log_context_property_type_enum_copy shall succeed and return 0. ]*/
+        result = 0;
+    }
+
+    return result;
+}
+
+void log_context_property_type_enum_free(void* value)
+{
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_023: [ log_context_property_type_enum_free shall return. ]*/
+    (void)value;
+}
+
+LOG_CONTEXT_PROPERTY_TYPE log_context_property_type_enum_get_type(void)
+{
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_024: [ log_context_property_type_enum_get_type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_enum. ]*/
+    return LOG_CONTEXT_PROPERTY_TYPE_enum;
+}
+
+int log_context_property_type_enum_get_size(const void* property_value)
+{
+    int result;
+
+    if (property_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_025: [ If property_value is NULL, log_context_property_type_enum_get_size shall fail and return a negative value. ]*/
+        (void)printf("Invalid arguments: const void* property_value=%p\r\n", property_value);
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_026: [ Otherwise log_context_property_type_enum_get_size shall return sizeof(int32_t). ]*/
+        result = (int)sizeof(int32_t);
+    }
+
+    return result;
+}
+
+int log_context_property_type_enum_serialize(const void* property_value, void* buffer, size_t buffer_size)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_027: [ If property_value is NULL, log_context_property_type_enum_serialize shall fail and return a negative value. ]*/
+        (property_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_028: [ If buffer is NULL and buffer_size is greater than 0, log_context_property_type_enum_serialize shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_size > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const void* property_value=%p, void* buffer=%p, size_t buffer_size=%zu\r\n",
+            property_value, buffer, buffer_size);
+        result = -1;
+    }
+    else
+    {
+        if (sizeof(int32_t) <= buffer_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_029: [ If sizeof(int32_t) bytes fit in buffer_size, log_context_property_type_enum_serialize shall copy the bytes of the int32_t value from property_value to buffer. ]*/
+            (void)memcpy(buffer, property_value, sizeof(int32_t));
+        }
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_030: [ log_context_property_type_enum_serialize shall succeed and return sizeof(int32_t). ]*/
+        result = (int)sizeof(int32_t);
+    }
+
+    return result;
+}
+
+int log_context_property_type_enum_deserialize(void* dst_value, size_t dst_size, const void* buffer, size_t buffer_size)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_031: [ If dst_value is NULL and dst_size is greater than 0, log_context_property_type_enum_deserialize shall fail and return a negative value. ]*/
+        ((dst_value == NULL) && (dst_size > 0)) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_032: [ If buffer is NULL, log_context_property_type_enum_deserialize shall fail and return a negative value. ]*/
+        (buffer == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_033: [ If buffer_size is not sizeof(int32_t), log_context_property_type_enum_deserialize shall fail and return a negative value. ]*/
+        (buffer_size != sizeof(int32_t))
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const void* buffer=%p, size_t buffer_size=%zu\r\n",
+            dst_value, dst_size, buffer, buffer_size);
+        result = -1;
+    }
+    else
+    {
+        if (sizeof(int32_t) <= dst_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_034: [ If sizeof(int32_t) bytes fit in dst_size, log_context_property_type_enum_deserialize shall copy the bytes of the int32_t value from buffer to dst_value. ]*/
+            (void)memcpy(dst_value, buffer, sizeof(int32_t));
+        }
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_035: [ log_context_property_type_enum_deserialize shall succeed and return sizeof(int32_t). ]*/
+        result = (int)sizeof(int32_t);
+    }
+
+    return result;
+}
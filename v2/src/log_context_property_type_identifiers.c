@@ -0,0 +1,507 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include "winsock2.h"
+#include "ws2ipdef.h"
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/identifier_to_string.h"
+#include "c_logging/integer_to_string.h"
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+
+#include "c_logging/log_context_property_type_identifiers.h"
+
+// position in the GUID memory layout of each byte of a UUID in RFC 4122 order
+// (Data1, Data2 and Data3 are little endian, Data4 is a plain byte array)
+static const uint8_t guid_layout_index[16] = { 3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+typedef union SOCKET_ADDRESS_UNION_TAG
+{
+    struct sockaddr generic;
+    struct sockaddr_in v4;
+    struct sockaddr_in6 v6;
+} SOCKET_ADDRESS_UNION;
+
+#define DEFINE_IDENTIFIER_TYPE_COPY(type_name) \
+    static int MU_C2(type_name, _log_context_property_type_copy)(void* dst_value, const void* src_value) \
+    { \
+        int result; \
+        if ( \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_017: [ If dst_value is NULL, the copy function of each identifier type shall fail and return a non-zero value. ]*/ \
+            (dst_value == NULL) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_018: [ If src_value is NULL, the copy function of each identifier type shall fail and return a non-zero value. ]*/ \
+            (src_value == NULL) \
+            ) \
+        { \
+            (void)printf("Invalid arguments: void* dst_value=%p, void* src_value=%p\r\n", \
+                dst_value, src_value); \
+            result = MU_FAILURE; \
+        } \
+        else \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_019: [ The copy function of each identifier type shall copy the sizeof(type) bytes of the value from src_value to dst_value. ]*/ \
+            (void)memcpy(dst_value, src_value, sizeof(type_name)); \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_020: [ The copy function of each identifier type shall succeed and return 0. ]*/ \
+            result = 0; \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_IDENTIFIER_TYPE_FREE(type_name) \
+    static void MU_C2(type_name, _log_context_property_type_free)(void* value) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_021: [ The free function of each identifier type shall return. ]*/ \
+        (void)value; \
+    } \
+
+#define DEFINE_IDENTIFIER_TYPE_GET_TYPE(type_name) \
+    static LOG_CONTEXT_PROPERTY_TYPE MU_C2(type_name, _log_context_property_type_get_type)(void) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_022: [ The get_type function of each identifier type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_{type}. ]*/ \
+        return MU_C2(LOG_CONTEXT_PROPERTY_TYPE_, type_name); \
+    } \
+
+#define DEFINE_IDENTIFIER_TYPE_GET_INIT_DATA_SIZE(type_name) \
+    int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(type_name)(void) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE of each identifier type shall return sizeof(type). ]*/ \
+        return (int)sizeof(type_name); \
+    } \
+
+#define DEFINE_IDENTIFIER_TYPE_GET_SIZE(type_name) \
+    static int MU_C2(type_name, _log_context_property_type_get_size)(const void* property_value) \
+    { \
+        int result; \
+        if (property_value == NULL) \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_043: [ If property_value is NULL, the get_size function of each identifier type shall fail and return a negative value. ]*/ \
+            (void)printf("Invalid arguments: const void* property_value=%p\r\n", property_value); \
+            result = -1; \
+        } \
+        else \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_044: [ Otherwise the get_size function of each identifier type shall return sizeof(type). ]*/ \
+            result = (int)sizeof(type_name); \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_IDENTIFIER_TYPE_SERIALIZE(type_name) \
+    static int MU_C2(type_name, _log_context_property_type_serialize)(const void* property_value, void* buffer, size_t buffer_size) \
+    { \
+        int result; \
+        if ( \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_045: [ If property_value is NULL, the serialize function of each identifier type shall fail and return a negative value. ]*/ \
+            (property_value == NULL) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_046: [ If buffer is NULL and buffer_size is greater than 0, the serialize function of each identifier type shall fail and return a negative value. ]*/ \
+            ((buffer == NULL) && (buffer_size > 0)) \
+            ) \
+        { \
+            (void)printf("Invalid arguments: const void* property_value=%p, void* buffer=%p, size_t buffer_size=%zu\r\n", \
+                property_value, buffer, buffer_size); \
+            result = -1; \
+        } \
+        else \
+        { \
+            if (sizeof(type_name) <= buffer_size) \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_047: [ If sizeof(type) bytes fit in buffer_size, the serialize function of each identifier type shall copy the bytes of the value from property_value to buffer. ]*/ \
+                (void)memcpy(buffer, property_value, sizeof(type_name)); \
+            } \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_048: [ The serialize function of each identifier type shall succeed and return sizeof(type). ]*/ \
+            result = (int)sizeof(type_name); \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_IDENTIFIER_TYPE_DESERIALIZE(type_name) \
+    static int MU_C2(type_name, _log_context_property_type_deserialize)(void* dst_value, size_t dst_size, const void* buffer, size_t buffer_size) \
+    { \
+        int result; \
+        if ( \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_049: [ If dst_value is NULL and dst_size is greater than 0, the deserialize function of each identifier type shall fail and return a negative value. ]*/ \
+            ((dst_value == NULL) && (dst_size > 0)) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_050: [ If buffer is NULL, the deserialize function of each identifier type shall fail and return a negative value. ]*/ \
+            (buffer == NULL) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_051: [ If buffer_size is not sizeof(type), the deserialize function of each identifier type shall fail and return a negative value. ]*/ \
+            (buffer_size != sizeof(type_name)) \
+            ) \
+        { \
+            (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const void* buffer=%p, size_t buffer_size=%zu\r\n", \
+                dst_value, dst_size, buffer, buffer_size); \
+            result = -1; \
+        } \
+        else \
+        { \
+            if (sizeof(type_name) <= dst_size) \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_052: [ If sizeof(type) bytes fit in dst_size, the deserialize function of each identifier type shall copy the bytes of the value from buffer to dst_value. ]*/ \
+                (void)memcpy(dst_value, buffer, sizeof(type_name)); \
+            } \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_053: [ The deserialize function of each identifier type shall succeed and return sizeof(type). ]*/ \
+            result = (int)sizeof(type_name); \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_IDENTIFIER_TYPE_IF(type_name) \
+    const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name) = \
+    { \
+        .to_string = MU_C2(type_name, _log_context_property_type_to_string), \
+        .copy = MU_C2(type_name, _log_context_property_type_copy), \
+        .free = MU_C2(type_name, _log_context_property_type_free), \
+        .get_type = MU_C2(type_name, _log_context_property_type_get_type), \
+        .get_size = MU_C2(type_name, _log_context_property_type_get_size), \
+        .serialize = MU_C2(type_name, _log_context_property_type_serialize), \
+        .deserialize = MU_C2(type_name, _log_context_property_type_deserialize), \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_024: [ The type_tag of each identifier type shall be the property type LOG_CONTEXT_PROPERTY_TYPE_{type}. ]*/ \
+        .type_tag = MU_C2(LOG_CONTEXT_PROPERTY_TYPE_, type_name) \
+    }; \
+
+#define DEFINE_IDENTIFIER_TYPE(type_name) \
+    DEFINE_IDENTIFIER_TYPE_COPY(type_name) \
+    DEFINE_IDENTIFIER_TYPE_FREE(type_name) \
+    DEFINE_IDENTIFIER_TYPE_GET_TYPE(type_name) \
+    DEFINE_IDENTIFIER_TYPE_GET_SIZE(type_name) \
+    DEFINE_IDENTIFIER_TYPE_SERIALIZE(type_name) \
+    DEFINE_IDENTIFIER_TYPE_DESERIALIZE(type_name) \
+    DEFINE_IDENTIFIER_TYPE_GET_INIT_DATA_SIZE(type_name) \
+    DEFINE_IDENTIFIER_TYPE_IF(type_name) \
+
+/* log_uuid_t */
+
+static int log_uuid_t_log_context_property_type_to_string(const void* property_value, char* buffer, size_t buffer_length)
+{
+    int result;
+
+    if (property_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_001: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_uuid_t).to_string shall fail and return a negative value. ]*/
+        (void)printf("Invalid arguments: const void* property_value=%p, char* buffer=%p, size_t buffer_length=%zu\r\n",
+            property_value, buffer, buffer_length);
+        result = -1;
+    }
+    else
+    {
+        const log_uuid_t* value = property_value;
+        uint8_t uuid[16];
+
+        for (size_t i = 0; i < sizeof(uuid); i++)
+        {
+            uuid[i] = value->bytes[guid_layout_index[i]];
+        }
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_uuid_t).to_string shall put the stored bytes back in RFC 4122 order and produce the UUID text form by calling uuid_to_string with buffer and buffer_length. ]*/
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_uuid_t).to_string shall return the result of uuid_to_string. ]*/
+        result = uuid_to_string(uuid, buffer, buffer_length);
+    }
+
+    return result;
+}
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t)(void* dst_value, const void* uuid)
+{
+    int result;
+
+    if (dst_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_025: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t) shall fail and return a non-zero value. ]*/
+        (void)printf("Invalid arguments: void* dst_value=%p, const void* uuid=%p\r\n",
+            dst_value, uuid);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        log_uuid_t value;
+
+        if (uuid == NULL)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_026: [ If uuid is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t) shall store the nil UUID in dst_value and fail and return a non-zero value. ]*/
+            (void)printf("Invalid arguments: void* dst_value=%p, const void* uuid=%p\r\n",
+                dst_value, uuid);
+            (void)memset(&value, 0, sizeof(value));
+            result = MU_FAILURE;
+        }
+        else
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_027: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t) shall store in dst_value the 16 bytes at uuid (RFC 4122 order) in the GUID memory layout. ]*/
+            for (size_t i = 0; i < sizeof(value.bytes); i++)
+            {
+                value.bytes[guid_layout_index[i]] = ((const uint8_t*)uuid)[i];
+            }
+
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_028: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t) shall succeed and return 0. ]*/
+            result = 0;
+        }
+
+        (void)memcpy(dst_value, &value, sizeof(log_uuid_t));
+    }
+
+    return result;
+}
+
+DEFINE_IDENTIFIER_TYPE(log_uuid_t)
+
+/* log_ipv4_address_t */
+
+static int log_ipv4_address_t_log_context_property_type_to_string(const void* property_value, char* buffer, size_t buffer_length)
+{
+    int result;
+
+    if (property_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_004: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv4_address_t).to_string shall fail and return a negative value. ]*/
+        (void)printf("Invalid arguments: const void* property_value=%p, char* buffer=%p, size_t buffer_length=%zu\r\n",
+            property_value, buffer, buffer_length);
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_005: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv4_address_t).to_string shall produce the dotted decimal form of the address by calling ipv4_address_to_string with buffer and buffer_length. ]*/
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_006: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv4_address_t).to_string shall return the result of ipv4_address_to_string. ]*/
+        result = ipv4_address_to_string(((const log_ipv4_address_t*)property_value)->bytes, buffer, buffer_length);
+    }
+
+    return result;
+}
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv4_address_t)(void* dst_value, const void* address)
+{
+    int result;
+
+    if (dst_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_029: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv4_address_t) shall fail and return a non-zero value. ]*/
+        (void)printf("Invalid arguments: void* dst_value=%p, const void* address=%p\r\n",
+            dst_value, address);
+        result = MU_FAILURE;
+    }
+    else if (address == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_030: [ If address is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv4_address_t) shall store the address 0.0.0.0 in dst_value and fail and return a non-zero value. ]*/
+        (void)printf("Invalid arguments: void* dst_value=%p, const void* address=%p\r\n",
+            dst_value, address);
+        (void)memset(dst_value, 0, sizeof(log_ipv4_address_t));
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_031: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv4_address_t) shall copy the 4 bytes at address to dst_value. ]*/
+        (void)memcpy(dst_value, address, sizeof(log_ipv4_address_t));
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_032: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv4_address_t) shall succeed and return 0. ]*/
+        result = 0;
+    }
+
+    return result;
+}
+
+DEFINE_IDENTIFIER_TYPE(log_ipv4_address_t)
+
+/* log_ipv6_address_t */
+
+static int log_ipv6_address_t_log_context_property_type_to_string(const void* property_value, char* buffer, size_t buffer_length)
+{
+    int result;
+
+    if (property_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_007: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv6_address_t).to_string shall fail and return a negative value. ]*/
+        (void)printf("Invalid arguments: const void* property_value=%p, char* buffer=%p, size_t buffer_length=%zu\r\n",
+            property_value, buffer, buffer_length);
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_008: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv6_address_t).to_string shall produce the RFC 5952 text form of the address by calling ipv6_address_to_string with buffer and buffer_length. ]*/
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_009: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv6_address_t).to_string shall return the result of ipv6_address_to_string. ]*/
+        result = ipv6_address_to_string(((const log_ipv6_address_t*)property_value)->bytes, buffer, buffer_length);
+    }
+
+    return result;
+}
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv6_address_t)(void* dst_value, const void* address)
+{
+    int result;
+
+    if (dst_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_033: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv6_address_t) shall fail and return a non-zero value. ]*/
+        (void)printf("Invalid arguments: void* dst_value=%p, const void* address=%p\r\n",
+            dst_value, address);
+        result = MU_FAILURE;
+    }
+    else if (address == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_034: [ If address is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv6_address_t) shall store the address :: in dst_value and fail and return a non-zero value. ]*/
+        (void)printf("Invalid arguments: void* dst_value=%p, const void* address=%p\r\n",
+            dst_value, address);
+        (void)memset(dst_value, 0, sizeof(log_ipv6_address_t));
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_035: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv6_address_t) shall copy the 16 bytes at address to dst_value. ]*/
+        (void)memcpy(dst_value, address, sizeof(log_ipv6_address_t));
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_036: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv6_address_t) shall succeed and return 0. ]*/
+        result = 0;
+    }
+
+    return result;
+}
+
+DEFINE_IDENTIFIER_TYPE(log_ipv6_address_t)
+
+/* log_socket_address_t */
+
+static uint16_t get_port(const void* port_in_network_order)
+{
+    const uint8_t* port_bytes = port_in_network_order;
+    return (uint16_t)((port_bytes[0] << 8) | port_bytes[1]);
+}
+
+// builds the text form of a stored socket address in representation (LOG_SOCKET_ADDRESS_TO_STRING_MAX_LENGTH characters at most)
+static size_t write_socket_address(char* representation, const log_socket_address_t* value)
+{
+    SOCKET_ADDRESS_UNION socket_address;
+    size_t length = 0;
+
+    (void)memset(&socket_address, 0, sizeof(socket_address));
+    (void)memcpy(&socket_address, value->bytes, (value->length <= sizeof(socket_address)) ? value->length : sizeof(socket_address));
+
+    if ((value->length == sizeof(struct sockaddr_in)) && (socket_address.generic.sa_family == AF_INET))
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_011: [ For an AF_INET address, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall produce the dotted decimal form of the address followed by : and the decimal port. ]*/
+        length += (size_t)ipv4_address_to_string((const uint8_t*)&socket_address.v4.sin_addr, representation, IPV4_ADDRESS_TO_STRING_MAX_LENGTH + 1);
+        representation[length++] = ':';
+        length += (size_t)integer_to_string_uint32(get_port(&socket_address.v4.sin_port), representation + length, INTEGER_TO_STRING_MAX_LENGTH + 1);
+    }
+    else if ((value->length == sizeof(struct sockaddr_in6)) && (socket_address.generic.sa_family == AF_INET6))
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_012: [ For an AF_INET6 address, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall produce [, the RFC 5952 form of the address, % and the decimal scope id if the scope id is not 0, ]: and the decimal port. ]*/
+        representation[length++] = '[';
+        length += (size_t)ipv6_address_to_string((const uint8_t*)&socket_address.v6.sin6_addr, representation + length, IPV6_ADDRESS_TO_STRING_MAX_LENGTH + 1);
+        if (socket_address.v6.sin6_scope_id != 0)
+        {
+            representation[length++] = '%';
+            length += (size_t)integer_to_string_uint32((uint32_t)socket_address.v6.sin6_scope_id, representation + length, INTEGER_TO_STRING_MAX_LENGTH + 1);
+        }
+        representation[length++] = ']';
+        representation[length++] = ':';
+        length += (size_t)integer_to_string_uint32(get_port(&socket_address.v6.sin6_port), representation + length, INTEGER_TO_STRING_MAX_LENGTH + 1);
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_013: [ If the stored socket address is empty, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall produce an empty string. ]*/
+    }
+
+    return length;
+}
+
+static int log_socket_address_t_log_context_property_type_to_string(const void* property_value, char* buffer, size_t buffer_length)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_010: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall fail and return a negative value. ]*/
+        (property_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_014: [ If buffer is NULL and buffer_length is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_length > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const void* property_value=%p, char* buffer=%p, size_t buffer_length=%zu\r\n",
+            property_value, buffer, buffer_length);
+        result = -1;
+    }
+    else
+    {
+        // extra room so that the parts can be written with their own zero terminators
+        char representation[LOG_SOCKET_ADDRESS_TO_STRING_MAX_LENGTH + INTEGER_TO_STRING_MAX_LENGTH + 1];
+        size_t length = write_socket_address(representation, property_value);
+
+        if (buffer_length > 0)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_015: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall write in buffer as many characters of the representation as fit (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+            size_t copy_length = (length < buffer_length) ? length : buffer_length - 1;
+            (void)memcpy(buffer, representation, copy_length);
+            buffer[copy_length] = '\0';
+        }
+
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_016: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall succeed and return the length of the full representation. ]*/
+        result = (int)length;
+    }
+
+    return result;
+}
+
+int LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t)(void* dst_value, const void* socket_address)
+{
+    int result;
+
+    if (dst_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_037: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t) shall fail and return a non-zero value. ]*/
+        (void)printf("Invalid arguments: void* dst_value=%p, const void* socket_address=%p\r\n",
+            dst_value, socket_address);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        log_socket_address_t value;
+        (void)memset(&value, 0, sizeof(value));
+
+        if (socket_address == NULL)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_038: [ If socket_address is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t) shall store an empty socket address (length 0) in dst_value and fail and return a non-zero value. ]*/
+            (void)printf("Invalid arguments: void* dst_value=%p, const void* socket_address=%p\r\n",
+                dst_value, socket_address);
+            result = MU_FAILURE;
+        }
+        else
+        {
+            struct sockaddr generic;
+            (void)memcpy(&generic, socket_address, sizeof(generic));
+
+            if (generic.sa_family == AF_INET)
+            {
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_039: [ If the address family of socket_address is AF_INET, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t) shall store in dst_value sizeof(struct sockaddr_in) as length, followed by the bytes of the sockaddr_in at socket_address. ]*/
+                value.length = (uint16_t)sizeof(struct sockaddr_in);
+                (void)memcpy(value.bytes, socket_address, sizeof(struct sockaddr_in));
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_041: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t) shall succeed and return 0. ]*/
+                result = 0;
+            }
+            else if (generic.sa_family == AF_INET6)
+            {
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_040: [ If the address family of socket_address is AF_INET6, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t) shall store in dst_value sizeof(struct sockaddr_in6) as length, followed by the bytes of the sockaddr_in6 at socket_address. ]*/
+                value.length = (uint16_t)sizeof(struct sockaddr_in6);
+                (void)memcpy(value.bytes, socket_address, sizeof(struct sockaddr_in6));
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_041: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t) shall succeed and return 0. ]*/
+                result = 0;
+            }
+            else
+            {
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_042: [ If the address family of socket_address is any other value, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t) shall store an empty socket address (length 0) in dst_value and fail and return a non-zero value. ]*/
+                (void)printf("Unsupported address family: %d\r\n", (int)generic.sa_family);
+                result = MU_FAILURE;
+            }
+        }
+
+        (void)memcpy(dst_value, &value, sizeof(log_socket_address_t));
+    }
+
+    return result;
+}
+
+DEFINE_IDENTIFIER_TYPE(log_socket_address_t)
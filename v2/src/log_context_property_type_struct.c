@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <stddef.h>
 #include <inttypes.h>
+#include <string.h>
 
 #include "macro_utils/macro_utils.h"
 
@@ -85,6 +86,79 @@ static LOG_CONTEXT_PROPERTY_TYPE struct_log_context_property_type_get_type(void)
     return LOG_CONTEXT_PROPERTY_TYPE_struct;
 }
 
+static int struct_log_context_property_type_get_size(const void* property_value)
+{
+    int result;
+    if (property_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_017: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).get_size shall fail and return a negative value. ]*/
+        (void)printf("Invalid arguments: const void* property_value=%p\r\n", property_value);
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_018: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).get_size shall return sizeof(uint8_t). ]*/
+        result = (int)sizeof(uint8_t);
+    }
+    return result;
+}
+
+static int struct_log_context_property_type_serialize(const void* property_value, void* buffer, size_t buffer_size)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_019: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize shall fail and return a negative value. ]*/
+        (property_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_020: [ If buffer is NULL and buffer_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_size > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const void* property_value=%p, void* buffer=%p, size_t buffer_size=%zu\r\n",
+            property_value, buffer, buffer_size);
+        result = -1;
+    }
+    else
+    {
+        if (sizeof(uint8_t) <= buffer_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_021: [ If sizeof(uint8_t) bytes fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize shall copy the bytes of the field count from property_value to buffer. ]*/
+            (void)memcpy(buffer, property_value, sizeof(uint8_t));
+        }
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize shall succeed and return sizeof(uint8_t). ]*/
+        result = (int)sizeof(uint8_t);
+    }
+    return result;
+}
+
+static int struct_log_context_property_type_deserialize(void* dst_value, size_t dst_size, const void* buffer, size_t buffer_size)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_023: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize shall fail and return a negative value. ]*/
+        ((dst_value == NULL) && (dst_size > 0)) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_024: [ If buffer is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize shall fail and return a negative value. ]*/
+        (buffer == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_025: [ If buffer_size is not sizeof(uint8_t), LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize shall fail and return a negative value. ]*/
+        (buffer_size != sizeof(uint8_t))
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const void* buffer=%p, size_t buffer_size=%zu\r\n",
+            dst_value, dst_size, buffer, buffer_size);
+        result = -1;
+    }
+    else
+    {
+        if (sizeof(uint8_t) <= dst_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_026: [ If sizeof(uint8_t) bytes fit in dst_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize shall copy the bytes of the field count from buffer to dst_value. ]*/
+            (void)memcpy(dst_value, buffer, sizeof(uint8_t));
+        }
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_027: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize shall succeed and return sizeof(uint8_t). ]*/
+        result = (int)sizeof(uint8_t);
+    }
+    return result;
+}
+
 int LOG_CONTEXT_PROPERTY_TYPE_INIT(struct)(void* dst_value, uint8_t src_value)
 {
     int result;
@@ -120,4 +194,9 @@ const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct) =
     .copy = struct_log_context_property_type_copy,
     .free = struct_log_context_property_type_free,
     .get_type = struct_log_context_property_type_get_type,
+    .get_size = struct_log_context_property_type_get_size,
+    .serialize = struct_log_context_property_type_serialize,
+    .deserialize = struct_log_context_property_type_deserialize,
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_016: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_struct. ]*/
+    .type_tag = LOG_CONTEXT_PROPERTY_TYPE_struct
 };
@@ -0,0 +1,232 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <inttypes.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/time_to_string.h"
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+
+#include "c_logging/log_context_property_type_time.h"
+
+#define DEFINE_TIME_TYPE_TO_STRING(type_name, to_string_function) \
+    static int MU_C2(type_name, _log_context_property_type_to_string)(const void* property_value, char* buffer, size_t buffer_length) \
+    { \
+        int result; \
+        if (property_value == NULL) \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_003: [ If property_value is NULL, the to_string function of each time type shall fail and return a negative value. ]*/ \
+            (void)printf("Invalid arguments: const void* property_value=%p, char* buffer=%p, size_t buffer_length=%zu\r\n", \
+                property_value, buffer, buffer_length); \
+            result = -1; \
+        } \
+        else \
+        { \
+            int64_t value; \
+            (void)memcpy(&value, property_value, sizeof(int64_t)); \
+            result = to_string_function(value, buffer, buffer_length); \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_TIME_TYPE_INIT(type_name) \
+    int LOG_CONTEXT_PROPERTY_TYPE_INIT(type_name)(void* dst_value, type_name value) \
+    { \
+        int result; \
+        if (dst_value == NULL) \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_006: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT of each time type shall fail and return a non-zero value. ]*/ \
+            (void)printf("Invalid arguments: void* dst_value=%p, " MU_TOSTRING(type_name) " value=%" PRId64 "\r\n", \
+                dst_value, (int64_t)value); \
+            result = MU_FAILURE; \
+        } \
+        else \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_007: [ LOG_CONTEXT_PROPERTY_TYPE_INIT of each time type shall store the 64 bit value in dst_value. ]*/ \
+            (void)memcpy(dst_value, &value, sizeof(type_name)); \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_008: [ LOG_CONTEXT_PROPERTY_TYPE_INIT of each time type shall succeed and return 0. ]*/ \
+            result = 0; \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_TIME_TYPE_COPY(type_name) \
+    static int MU_C2(type_name, _log_context_property_type_copy)(void* dst_value, const void* src_value) \
+    { \
+        int result; \
+        if ( \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_009: [ If dst_value is NULL, the copy function of each time type shall fail and return a non-zero value. ]*/ \
+            (dst_value == NULL) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_010: [ If src_value is NULL, the copy function of each time type shall fail and return a non-zero value. ]*/ \
+            (src_value == NULL) \
+            ) \
+        { \
+            (void)printf("Invalid arguments: void* dst_value=%p, void* src_value=%p\r\n", \
+                dst_value, src_value); \
+            result = MU_FAILURE; \
+        } \
+        else \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_011: [ The copy function of each time type shall copy the 64 bit value from src_value to dst_value. ]*/ \
+            (void)memcpy(dst_value, src_value, sizeof(type_name)); \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_012: [ The copy function of each time type shall succeed and return 0. ]*/ \
+            result = 0; \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_TIME_TYPE_FREE(type_name) \
+    static void MU_C2(type_name, _log_context_property_type_free)(void* value) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_013: [ The free function of each time type shall return. ]*/ \
+        (void)value; \
+    } \
+
+#define DEFINE_TIME_TYPE_GET_TYPE(type_name) \
+    static LOG_CONTEXT_PROPERTY_TYPE MU_C2(type_name, _log_context_property_type_get_type)(void) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_014: [ The get_type function of each time type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_{type}. ]*/ \
+        return MU_C2(LOG_CONTEXT_PROPERTY_TYPE_, type_name); \
+    } \
+
+#define DEFINE_TIME_TYPE_GET_INIT_DATA_SIZE(type_name) \
+    int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(type_name)(void) \
+    { \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_015: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE of each time type shall return sizeof(int64_t). ]*/ \
+        return (int)sizeof(int64_t); \
+    } \
+
+#define DEFINE_TIME_TYPE_GET_SIZE(type_name) \
+    static int MU_C2(type_name, _log_context_property_type_get_size)(const void* property_value) \
+    { \
+        int result; \
+        if (property_value == NULL) \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_017: [ If property_value is NULL, the get_size function of each time type shall fail and return a negative value. ]*/ \
+            (void)printf("Invalid arguments: const void* property_value=%p\r\n", property_value); \
+            result = -1; \
+        } \
+        else \
+        { \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_018: [ Otherwise the get_size function of each time type shall return sizeof(int64_t). ]*/ \
+            result = (int)sizeof(type_name); \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_TIME_TYPE_SERIALIZE(type_name) \
+    static int MU_C2(type_name, _log_context_property_type_serialize)(const void* property_value, void* buffer, size_t buffer_size) \
+    { \
+        int result; \
+        if ( \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_019: [ If property_value is NULL, the serialize function of each time type shall fail and return a negative value. ]*/ \
+            (property_value == NULL) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_020: [ If buffer is NULL and buffer_size is greater than 0, the serialize function of each time type shall fail and return a negative value. ]*/ \
+            ((buffer == NULL) && (buffer_size > 0)) \
+            ) \
+        { \
+            (void)printf("Invalid arguments: const void* property_value=%p, void* buffer=%p, size_t buffer_size=%zu\r\n", \
+                property_value, buffer, buffer_size); \
+            result = -1; \
+        } \
+        else \
+        { \
+            if (sizeof(type_name) <= buffer_size) \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_021: [ If sizeof(int64_t) bytes fit in buffer_size, the serialize function of each time type shall copy the bytes of the 64 bit value from property_value to buffer. ]*/ \
+                (void)memcpy(buffer, property_value, sizeof(type_name)); \
+            } \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_022: [ The serialize function of each time type shall succeed and return sizeof(int64_t). ]*/ \
+            result = (int)sizeof(type_name); \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_TIME_TYPE_DESERIALIZE(type_name) \
+    static int MU_C2(type_name, _log_context_property_type_deserialize)(void* dst_value, size_t dst_size, const void* buffer, size_t buffer_size) \
+    { \
+        int result; \
+        if ( \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_023: [ If dst_value is NULL and dst_size is greater than 0, the deserialize function of each time type shall fail and return a negative value. ]*/ \
+            ((dst_value == NULL) && (dst_size > 0)) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_024: [ If buffer is NULL, the deserialize function of each time type shall fail and return a negative value. ]*/ \
+            (buffer == NULL) || \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_025: [ If buffer_size is not sizeof(int64_t), the deserialize function of each time type shall fail and return a negative value. ]*/ \
+            (buffer_size != sizeof(type_name)) \
+            ) \
+        { \
+            (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const void* buffer=%p, size_t buffer_size=%zu\r\n", \
+                dst_value, dst_size, buffer, buffer_size); \
+            result = -1; \
+        } \
+        else \
+        { \
+            if (sizeof(type_name) <= dst_size) \
+            { \
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_026: [ If sizeof(int64_t) bytes fit in dst_size, the deserialize function of each time type shall copy the bytes of the 64 bit value from buffer to dst_value. ]*/ \
+                (void)memcpy(dst_value, buffer, sizeof(type_name)); \
+            } \
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_027: [ The deserialize function of each time type shall succeed and return sizeof(int64_t). ]*/ \
+            result = (int)sizeof(type_name); \
+        } \
+        return result; \
+    } \
+
+#define DEFINE_TIME_TYPE_IF(type_name) \
+    const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name) = \
+    { \
+        .to_string = MU_C2(type_name, _log_context_property_type_to_string), \
+        .copy = MU_C2(type_name, _log_context_property_type_copy), \
+        .free = MU_C2(type_name, _log_context_property_type_free), \
+        .get_type = MU_C2(type_name, _log_context_property_type_get_type), \
+        .get_size = MU_C2(type_name, _log_context_property_type_get_size), \
+        .serialize = MU_C2(type_name, _log_context_property_type_serialize), \
+        .deserialize = MU_C2(type_name, _log_context_property_type_deserialize), \
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_016: [ The type_tag of each time type shall be the property type LOG_CONTEXT_PROPERTY_TYPE_{type}. ]*/ \
+        .type_tag = MU_C2(LOG_CONTEXT_PROPERTY_TYPE_, type_name) \
+    }; \
+
+#define DEFINE_TIME_TYPE(type_name, to_string_function) \
+    DEFINE_TIME_TYPE_TO_STRING(type_name, to_string_function) \
+    DEFINE_TIME_TYPE_INIT(type_name) \
+    DEFINE_TIME_TYPE_COPY(type_name) \
+    DEFINE_TIME_TYPE_FREE(type_name) \
+    DEFINE_TIME_TYPE_GET_TYPE(type_name) \
+    DEFINE_TIME_TYPE_GET_SIZE(type_name) \
+    DEFINE_TIME_TYPE_SERIALIZE(type_name) \
+    DEFINE_TIME_TYPE_DESERIALIZE(type_name) \
+    DEFINE_TIME_TYPE_GET_INIT_DATA_SIZE(type_name) \
+    DEFINE_TIME_TYPE_IF(type_name) \
+
+log_timestamp_t log_timestamp_from_timespec(const struct timespec* ts)
+{
+    log_timestamp_t result;
+
+    if (ts == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_001: [ If ts is NULL, log_timestamp_from_timespec shall return 0. ]*/
+        (void)printf("Invalid arguments: const struct timespec* ts=%p\r\n",
+            (const void*)ts);
+        result = 0;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_002: [ log_timestamp_from_timespec shall return ts->tv_sec * 1000000000 + ts->tv_nsec. ]*/
+        result = (log_timestamp_t)ts->tv_sec * 1000000000 + (log_timestamp_t)ts->tv_nsec;
+    }
+
+    return result;
+}
+
+/* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_004: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_timestamp_t).to_string shall produce the ISO 8601 form of the value by calling timestamp_to_string with buffer and buffer_length and return its result. ]*/
+DEFINE_TIME_TYPE(log_timestamp_t, timestamp_to_string)
+
+/* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_005: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_duration_t).to_string shall produce the text form of the value by calling duration_to_string with buffer and buffer_length and return its result. ]*/
+DEFINE_TIME_TYPE(log_duration_t, duration_to_string)
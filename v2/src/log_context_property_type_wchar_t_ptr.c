@@ -2,18 +2,38 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 #include <stdarg.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <wchar.h>
 
 #include "macro_utils/macro_utils.h"
 
 #include "c_logging/log_context_property_type.h"
 #include "c_logging/log_context_property_type_if.h"
+#include "c_logging/wchar_to_utf8.h"
 
 #include "c_logging/log_context_property_type_wchar_t_ptr.h"
 
+// the first buffer used to find out how much memory a formatted string needs, it is doubled until the string fits
+#define INITIAL_FORMAT_BUFFER_LENGTH 256
+
+// the values are packed in the context data and may not be aligned for wchar_t (which the vectorized
+// wcslen and wcscpy implementations rely on), so the string is scanned one wchar_t at a time with memcpy
+static size_t get_wchar_t_string_size(const void* value)
+{
+    const unsigned char* position = value;
+    wchar_t c;
+    do
+    {
+        (void)memcpy(&c, position, sizeof(wchar_t));
+        position += sizeof(wchar_t);
+    } while (c != L'\0');
+    return (size_t)(position - (const unsigned char*)value);
+}
+
 static int wchar_t_ptr_log_context_property_type_to_string(const void* property_value, char* buffer, size_t buffer_length)
 {
     int result;
@@ -30,11 +50,11 @@ static int wchar_t_ptr_log_context_property_type_to_string(const void* property_
     }
     else
     {
-        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_003: [ If buffer is NULL and buffer_length is 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall return the length of the wchar_t string pointed to by property_value. ]*/
-        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_004: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall copy the wchar_t string pointed to by property_value to buffer by using wcstombs with buffer, buffer_length and pass in the values list the const wchar_t* value pointed to by property_value. ]*/
-        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_005: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall succeed and return the result of snprintf. ]*/
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_003: [ If buffer is NULL and buffer_length is 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall return the length of the UTF-8 representation of the wchar_t string pointed to by property_value. ]*/
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_004: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall convert the wchar_t string pointed to by property_value to UTF-8 in buffer by calling wchar_to_utf8 with property_value, buffer and buffer_length. ]*/
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_005: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall succeed and return the result of wchar_to_utf8. ]*/
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_006: [ If any error is encountered (truncation is not an error), LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall fail and return a negative value. ]*/
-        result = (int)wcstombs(buffer, property_value, buffer_length);
+        result = wchar_to_utf8(property_value, buffer, buffer_length);
     }
     return result;
 }
@@ -57,7 +77,7 @@ static int wchar_t_ptr_log_context_property_type_copy(void* dst_value, const voi
     else
     {
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_009: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).copy shall copy the entire string (including the null terminator) from src_value to dst_value. ]*/
-        (void)wcscpy(dst_value, src_value);
+        (void)memcpy(dst_value, src_value, get_wchar_t_string_size(src_value));
         /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_010: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).copy shall succeed and return 0. ]*/
         result = 0;
     }
@@ -77,6 +97,106 @@ static LOG_CONTEXT_PROPERTY_TYPE wchar_t_ptr_log_context_property_type_get_type(
     return LOG_CONTEXT_PROPERTY_TYPE_wchar_t_ptr;
 }
 
+// the serialized string may not be aligned for wchar_t, so it is scanned one wchar_t at a time with memcpy
+static bool is_one_null_terminated_wchar_t_string(const unsigned char* buffer, size_t buffer_size)
+{
+    bool result = false;
+    if ((buffer_size > 0) && (buffer_size % sizeof(wchar_t) == 0))
+    {
+        size_t count = buffer_size / sizeof(wchar_t);
+        size_t i;
+        for (i = 0; i < count; i++)
+        {
+            wchar_t c;
+            (void)memcpy(&c, buffer + i * sizeof(wchar_t), sizeof(wchar_t));
+            if (c == L'\0')
+            {
+                break;
+            }
+        }
+        result = (i == count - 1);
+    }
+    return result;
+}
+
+static int wchar_t_ptr_log_context_property_type_get_size(const void* property_value)
+{
+    int result;
+    if (property_value == NULL)
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_021: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).get_size shall fail and return a negative value. ]*/
+        (void)printf("Invalid arguments: const void* property_value=%p\r\n", property_value);
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_022: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).get_size shall return the size in bytes of the wchar_t string pointed to by property_value, including the null terminator. ]*/
+        result = (int)get_wchar_t_string_size(property_value);
+    }
+    return result;
+}
+
+static int wchar_t_ptr_log_context_property_type_serialize(const void* property_value, void* buffer, size_t buffer_size)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_023: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).serialize shall fail and return a negative value. ]*/
+        (property_value == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_024: [ If buffer is NULL and buffer_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).serialize shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_size > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const void* property_value=%p, void* buffer=%p, size_t buffer_size=%zu\r\n",
+            property_value, buffer, buffer_size);
+        result = -1;
+    }
+    else
+    {
+        size_t size = get_wchar_t_string_size(property_value);
+        if (size <= buffer_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_025: [ If the wchar_t string and its null terminator fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).serialize shall copy the wchar_t string (including the null terminator) from property_value to buffer. ]*/
+            (void)memcpy(buffer, property_value, size);
+        }
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_026: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).serialize shall succeed and return the size in bytes of the wchar_t string, including the null terminator. ]*/
+        result = (int)size;
+    }
+    return result;
+}
+
+static int wchar_t_ptr_log_context_property_type_deserialize(void* dst_value, size_t dst_size, const void* buffer, size_t buffer_size)
+{
+    int result;
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_027: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize shall fail and return a negative value. ]*/
+        ((dst_value == NULL) && (dst_size > 0)) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_028: [ If buffer is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize shall fail and return a negative value. ]*/
+        (buffer == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const void* buffer=%p, size_t buffer_size=%zu\r\n",
+            dst_value, dst_size, buffer, buffer_size);
+        result = -1;
+    }
+    else if (!is_one_null_terminated_wchar_t_string(buffer, buffer_size))
+    {
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_029: [ If buffer_size is not a multiple of sizeof(wchar_t) or the first null wchar_t in buffer is not the last wchar_t of buffer, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize shall fail and return a negative value. ]*/
+        (void)printf("Buffer of size %zu does not hold exactly one null terminated wchar_t string\r\n", buffer_size);
+        result = -1;
+    }
+    else
+    {
+        if (buffer_size <= dst_size)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_030: [ If buffer_size bytes fit in dst_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize shall copy the wchar_t string (including the null terminator) from buffer to dst_value. ]*/
+            (void)memcpy(dst_value, buffer, buffer_size);
+        }
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_031: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize shall succeed and return buffer_size. ]*/
+        result = (int)buffer_size;
+    }
+    return result;
+}
+
 int LOG_CONTEXT_PROPERTY_TYPE_INIT(wchar_t_ptr)(void* dst_value, size_t count, const wchar_t* format, ...)
 {
     int result;
@@ -117,21 +237,112 @@ int LOG_CONTEXT_PROPERTY_TYPE_INIT(wchar_t_ptr)(void* dst_value, size_t count, c
     return result;
 }
 
+// vswprintf does not say how long a string that does not fit would have been, so the string is formatted
+// in a heap buffer whose length is doubled until the string fits (at most LOG_MAX_WCHAR_STRING_LENGTH wchar_t)
+static int get_formatted_size(const wchar_t* format, va_list args)
+{
+    int result = -1;
+    size_t buffer_length = INITIAL_FORMAT_BUFFER_LENGTH;
+
+    while (result < 0)
+    {
+        wchar_t* buffer = malloc(buffer_length * sizeof(wchar_t));
+        if (buffer == NULL)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_033: [ If malloc fails, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall fail and return a negative value. ]*/
+            (void)printf("malloc failed, size=%zu\r\n", buffer_length * sizeof(wchar_t));
+            break;
+        }
+        else
+        {
+            va_list args_copy;
+            va_copy(args_copy, args);
+            int vswprintf_result = vswprintf(buffer, buffer_length, format, args_copy);
+            va_end(args_copy);
+
+            free(buffer);
+
+            if (vswprintf_result >= 0)
+            {
+                result = (int)((vswprintf_result + 1) * sizeof(wchar_t));
+            }
+            else if (buffer_length >= LOG_MAX_WCHAR_STRING_LENGTH)
+            {
+                /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_018: [ If vswprintf fails with a buffer of LOG_MAX_WCHAR_STRING_LENGTH wchar_t, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall return a negative value. ]*/
+                (void)printf("Cannot format string in %zu wchar_t, format=%ls\r\n", buffer_length, format);
+                break;
+            }
+            else
+            {
+                buffer_length *= 2;
+                if (buffer_length > LOG_MAX_WCHAR_STRING_LENGTH)
+                {
+                    buffer_length = LOG_MAX_WCHAR_STRING_LENGTH;
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
 int LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr)(const wchar_t* format, ...)
 {
     va_list args;
     va_start(args, format);
 
-    wchar_t buffer[LOG_MAX_WCHAR_STRING_LENGTH];
-    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_018: [ If vswprintf fails, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall return a negative value. ]*/
-    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_019: [ Otherwise, on success, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall return the amount of memory needed in number of wide-chracters to store the wprintf style formatted wchar_t string given by format and the arguments in .... ]*/
-    int result = vswprintf(buffer, LOG_MAX_WCHAR_STRING_LENGTH, format, args) * sizeof(wchar_t);
-    if (result >= 0)
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_032: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall format the string by calling vswprintf in a buffer of 256 wchar_t allocated with malloc, doubling the buffer length until the formatted string fits or the buffer has LOG_MAX_WCHAR_STRING_LENGTH wchar_t. ]*/
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_019: [ Otherwise, on success, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall return the amount of memory in bytes needed to store the wprintf style formatted wchar_t string given by format and the arguments in ..., including the null terminator. ]*/
+    int result = get_formatted_size(format, args);
+
+    va_end(args);
+
+    return result;
+}
+
+int LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr)(void* dst_value, size_t dst_size, const wchar_t* format, ...)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_034: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr) shall fail and return a negative value. ]*/
+        ((dst_value == NULL) && (dst_size > 0)) ||
+        /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_035: [ If format is NULL, LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr) shall fail and return a negative value. ]*/
+        (format == NULL)
+        )
     {
-        result += sizeof(wchar_t);
+        (void)printf("Invalid arguments: void* dst_value=%p, size_t dst_size=%zu, const wchar_t* format=%ls\r\n",
+            dst_value, dst_size, MU_WP_OR_NULL(format));
+        result = -1;
     }
+    else
+    {
+        va_list args;
+        va_start(args, format);
 
-    va_end(args);
+        int vswprintf_result = -1;
+        if (dst_size >= sizeof(wchar_t))
+        {
+            va_list args_copy;
+            va_copy(args_copy, args);
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_036: [ If dst_size can hold at least one wchar_t, LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr) shall format in the memory at dst_value by calling vswprintf with dst_value, dst_size / sizeof(wchar_t), format and the arguments in .... ]*/
+            vswprintf_result = vswprintf(dst_value, dst_size / sizeof(wchar_t), format, args_copy);
+            va_end(args_copy);
+        }
+
+        if (vswprintf_result >= 0)
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_037: [ If the formatted string fits, LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr) shall succeed and return the amount of memory in bytes used by the formatted string, including the null terminator. ]*/
+            result = (int)((vswprintf_result + 1) * sizeof(wchar_t));
+        }
+        else
+        {
+            /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_038: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr) shall return the amount of memory in bytes needed to store the formatted string, as computed by LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) (a negative value if that fails). ]*/
+            result = get_formatted_size(format, args);
+        }
+
+        va_end(args);
+    }
 
     return result;
 }
@@ -141,5 +352,10 @@ const LOG_CONTEXT_PROPERTY_TYPE_IF LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr
     .to_string = wchar_t_ptr_log_context_property_type_to_string,
     .copy = wchar_t_ptr_log_context_property_type_copy,
     .free = wchar_t_ptr_log_context_property_type_free,
-    .get_type = wchar_t_ptr_log_context_property_type_get_type
+    .get_type = wchar_t_ptr_log_context_property_type_get_type,
+    .get_size = wchar_t_ptr_log_context_property_type_get_size,
+    .serialize = wchar_t_ptr_log_context_property_type_serialize,
+    .deserialize = wchar_t_ptr_log_context_property_type_deserialize,
+    /* Codes_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_020: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_wchar_t_ptr. ]*/
+    .type_tag = LOG_CONTEXT_PROPERTY_TYPE_wchar_t_ptr
 };
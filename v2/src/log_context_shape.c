@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context.h"
+#include "c_logging/log_context_property_value_pair.h"
+
+#include "c_logging/log_context_shape.h"
+
+void internal_log_context_shape_init(LOG_CONTEXT_HANDLE log_context, LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs, void* values_data, const LOG_CONTEXT_SHAPE* log_context_shape)
+{
+    uint32_t i;
+
+    log_context->values_data = values_data;
+    log_context->values_data_length = log_context_shape->values_data_length;
+    log_context->property_value_pairs_ptr = property_value_pairs;
+    log_context->property_value_pair_count = log_context_shape->property_value_pair_count;
+
+    /* Codes_SRS_LOG_CONTEXT_SHAPE_01_009: [ internal_log_context_shape_init shall copy the property/value pairs template of log_context_shape (names and types) in property_value_pairs. ]*/
+    (void)memcpy(property_value_pairs, log_context_shape->property_value_pairs, sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) * log_context_shape->property_value_pair_count);
+
+    /* Codes_SRS_LOG_CONTEXT_SHAPE_01_010: [ internal_log_context_shape_init shall point the value of each property/value pair at its offset in values_data. ]*/
+    for (i = 0; i < log_context_shape->property_value_pair_count; i++)
+    {
+        property_value_pairs[i].value = (uint8_t*)values_data + log_context_shape->value_offsets[i];
+    }
+}
+
+LOG_CONTEXT_HANDLE log_context_shape_create(const LOG_CONTEXT_SHAPE* log_context_shape, const void* values_data)
+{
+    LOG_CONTEXT_HANDLE result;
+
+    if (
+        /* Codes_SRS_LOG_CONTEXT_SHAPE_01_011: [ If log_context_shape is NULL, log_context_shape_create shall fail and return NULL. ]*/
+        (log_context_shape == NULL) ||
+        /* Codes_SRS_LOG_CONTEXT_SHAPE_01_012: [ If values_data is NULL, log_context_shape_create shall fail and return NULL. ]*/
+        (values_data == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: const LOG_CONTEXT_SHAPE* log_context_shape=%p, const void* values_data=%p\r\n",
+            log_context_shape, values_data);
+        result = NULL;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_CONTEXT_SHAPE_01_013: [ log_context_shape_create shall allocate the context, its property/value pairs and its values with a single allocation. ]*/
+        result = log_context_create(NULL, log_context_shape->property_value_pair_count, log_context_shape->values_data_length, NULL);
+        if (result == NULL)
+        {
+            /* Codes_SRS_LOG_CONTEXT_SHAPE_01_016: [ If any error occurs, log_context_shape_create shall fail and return NULL. ]*/
+        }
+        else
+        {
+            /* Codes_SRS_LOG_CONTEXT_SHAPE_01_014: [ log_context_shape_create shall copy values_data in the context. ]*/
+            (void)memcpy(result->values_data, values_data, log_context_shape->values_data_length);
+
+            /* Codes_SRS_LOG_CONTEXT_SHAPE_01_015: [ log_context_shape_create shall initialize the context by calling internal_log_context_shape_init. ]*/
+            internal_log_context_shape_init(result, result->property_value_pairs_ptr, result->values_data, log_context_shape);
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,809 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+#ifdef _WIN32
+#include "windows.h"
+#else
+#include <pthread.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_level.h"
+#include "c_logging/log_printf.h"
+#include "c_logging/log_timestamp.h"
+#include "c_logging/logger.h"
+#include "c_logging/logging_stacktrace.h"
+
+#include "c_logging/log_deferred.h"
+
+// records start on 8 byte boundaries, so that the headers can be copied without straddling the end of the buffer
+#define RECORD_ALIGNMENT 8
+
+// enough for '%', the flags, 2 numbers, '.', the length modifier and the conversion
+#define MAX_DEFERRED_SPEC_LENGTH 32
+
+// space kept in a record for each argument still to be stored when a string is truncated (the largest value, or the length and terminator of a string)
+#define MAX_ARG_STORAGE_SIZE (sizeof(long double) + sizeof(uint32_t) + 1)
+
+// length stored for a NULL string
+#define NULL_STRING_LENGTH UINT32_MAX
+
+typedef struct LOG_DEFERRED_RECORD_HEADER_TAG
+{
+    LOG_DEFERRED_SITE* site; // NULL for the padding that skips to the start of the buffer
+    uint64_t ticks; // log_timestamp_ticks of the call, converted to wall clock time when the record is formatted
+    uint32_t size; // including the header and the padding up to RECORD_ALIGNMENT
+    uint32_t log_level;
+    int errno_value; // for %m
+} LOG_DEFERRED_RECORD_HEADER;
+
+// Single producer (the owning thread), single consumer (log_deferred_flush) ring of records.
+// The positions only grow (wrapping at 2^32), the offset in data is the position modulo the buffer size.
+// A record never wraps: when it does not fit before the end of data, the end is skipped (with a padding header if one fits).
+typedef struct LOG_DEFERRED_THREAD_BUFFER_TAG
+{
+    struct LOG_DEFERRED_THREAD_BUFFER_TAG* next;
+    volatile long in_use; // 0 once the thread that owned the buffer exited
+    volatile long write_position;
+    volatile long read_position;
+    unsigned char data[LOG_DEFERRED_THREAD_BUFFER_SIZE];
+} LOG_DEFERRED_THREAD_BUFFER;
+
+typedef struct DEFERRED_SPEC_TAG
+{
+    const char* end; // after the conversion
+    uint32_t star_count;
+    bool has_l_modifier;
+    char conversion;
+} DEFERRED_SPEC;
+
+// all the buffers ever created, a buffer is taken by a new thread once the thread that owned it exited and its records were flushed
+static LOG_DEFERRED_THREAD_BUFFER* volatile thread_buffers;
+static XLOGGING_THREAD_LOCAL LOG_DEFERRED_THREAD_BUFFER* thread_buffer;
+static volatile long dropped_count;
+static uint32_t reported_dropped_count;
+static volatile long flush_in_progress;
+
+// the site state lives in the public LOG_DEFERRED_SITE, so the atomics work on plain volatile longs
+#ifdef _MSC_VER
+static long atomic_load_long(volatile long* value)
+{
+    return _InterlockedCompareExchange(value, 0, 0);
+}
+
+static void atomic_store_long(volatile long* value, long new_value)
+{
+    (void)_InterlockedExchange(value, new_value);
+}
+
+static bool atomic_compare_exchange_long(volatile long* value, long expected, long desired)
+{
+    return (_InterlockedCompareExchange(value, desired, expected) == expected);
+}
+
+static void atomic_increment_long(volatile long* value)
+{
+    (void)_InterlockedIncrement(value);
+}
+
+static bool atomic_compare_exchange_thread_buffers(LOG_DEFERRED_THREAD_BUFFER* expected, LOG_DEFERRED_THREAD_BUFFER* desired)
+{
+    return (_InterlockedCompareExchangePointer((void* volatile*)&thread_buffers, desired, expected) == expected);
+}
+
+static LOG_DEFERRED_THREAD_BUFFER* atomic_load_thread_buffers(void)
+{
+    return _InterlockedCompareExchangePointer((void* volatile*)&thread_buffers, NULL, NULL);
+}
+#else
+static long atomic_load_long(volatile long* value)
+{
+    return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+}
+
+static void atomic_store_long(volatile long* value, long new_value)
+{
+    __atomic_store_n(value, new_value, __ATOMIC_RELEASE);
+}
+
+static bool atomic_compare_exchange_long(volatile long* value, long expected, long desired)
+{
+    return __atomic_compare_exchange_n(value, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static void atomic_increment_long(volatile long* value)
+{
+    (void)__atomic_add_fetch(value, 1, __ATOMIC_RELAXED);
+}
+
+static bool atomic_compare_exchange_thread_buffers(LOG_DEFERRED_THREAD_BUFFER* expected, LOG_DEFERRED_THREAD_BUFFER* desired)
+{
+    return __atomic_compare_exchange_n(&thread_buffers, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+static LOG_DEFERRED_THREAD_BUFFER* atomic_load_thread_buffers(void)
+{
+    return __atomic_load_n(&thread_buffers, __ATOMIC_ACQUIRE);
+}
+#endif
+
+// parses the conversion spec starting at percent, returns false for the specs that cannot be deferred
+// (%n, positional arguments, grouping, wide characters and strings, platform specific length modifiers)
+static bool parse_deferred_spec(const char* percent, DEFERRED_SPEC* spec)
+{
+    bool result;
+    const char* position = percent + 1;
+
+    spec->star_count = 0;
+    spec->has_l_modifier = false;
+
+    if (*position == '%')
+    {
+        spec->conversion = '%';
+        spec->end = position + 1;
+        result = true;
+    }
+    else
+    {
+        while ((*position == '-') || (*position == '+') || (*position == ' ') || (*position == '#') || (*position == '0'))
+        {
+            position++;
+        }
+
+        if (*position == '*')
+        {
+            spec->star_count++;
+            position++;
+        }
+        else
+        {
+            while ((*position >= '0') && (*position <= '9'))
+            {
+                position++;
+            }
+        }
+
+        if (*position == '.')
+        {
+            position++;
+            if (*position == '*')
+            {
+                spec->star_count++;
+                position++;
+            }
+            else
+            {
+                while ((*position >= '0') && (*position <= '9'))
+                {
+                    position++;
+                }
+            }
+        }
+
+        if ((position[0] == 'h') && (position[1] == 'h'))
+        {
+            position += 2;
+        }
+        else if ((position[0] == 'l') && (position[1] == 'l'))
+        {
+            position += 2;
+        }
+        else if (*position == 'l')
+        {
+            spec->has_l_modifier = true;
+            position++;
+        }
+        else if ((*position == 'h') || (*position == 'j') || (*position == 'z') || (*position == 't') || (*position == 'L'))
+        {
+            position++;
+        }
+        else
+        {
+            // no length modifier
+        }
+
+        spec->conversion = *position;
+        spec->end = position + 1;
+
+        result =
+            (*position != '\0') &&
+            (strchr("diouxXcspfFeEgGaAm", *position) != NULL) &&
+            (!(spec->has_l_modifier && ((*position == 'c') || (*position == 's')))) &&
+            ((size_t)(spec->end - percent) < MAX_DEFERRED_SPEC_LENGTH);
+    }
+
+    return result;
+}
+
+static bool is_integer_arg_type(uint8_t arg_type)
+{
+    return (arg_type <= LOG_DEFERRED_ARG_TYPE_UNSIGNED_LONG_LONG);
+}
+
+// checks that every conversion of the format can be formatted later from the captured value of its argument
+// and fills arg_kinds with the way each argument is stored
+static bool check_site(LOG_DEFERRED_SITE* site)
+{
+    bool result = (site->arg_count <= LOG_DEFERRED_MAX_ARG_COUNT);
+    uint32_t arg_index = 0;
+    const char* position = site->format;
+    const char* percent;
+
+    while (result && ((percent = strchr(position, '%')) != NULL))
+    {
+        DEFERRED_SPEC spec;
+        if (!parse_deferred_spec(percent, &spec))
+        {
+            result = false;
+            break;
+        }
+        position = spec.end;
+
+        for (uint32_t i = 0; i < spec.star_count; i++)
+        {
+            if ((arg_index == site->arg_count) || (site->arg_types[arg_index] != LOG_DEFERRED_ARG_TYPE_INT))
+            {
+                result = false;
+                break;
+            }
+            site->arg_kinds[arg_index] = LOG_DEFERRED_ARG_TYPE_INT;
+            arg_index++;
+        }
+
+        if (result && (spec.conversion != '%') && (spec.conversion != 'm'))
+        {
+            if (arg_index == site->arg_count)
+            {
+                result = false;
+            }
+            else
+            {
+                uint8_t arg_type = site->arg_types[arg_index];
+                switch (spec.conversion)
+                {
+                case 's':
+                    result = (arg_type == LOG_DEFERRED_ARG_TYPE_STRING);
+                    break;
+                case 'p':
+                    // a string printed with %p is stored as the pointer
+                    result = (arg_type == LOG_DEFERRED_ARG_TYPE_POINTER) || (arg_type == LOG_DEFERRED_ARG_TYPE_STRING);
+                    arg_type = LOG_DEFERRED_ARG_TYPE_POINTER;
+                    break;
+                case 'f':
+                case 'F':
+                case 'e':
+                case 'E':
+                case 'g':
+                case 'G':
+                case 'a':
+                case 'A':
+                    result = (arg_type == LOG_DEFERRED_ARG_TYPE_DOUBLE) || (arg_type == LOG_DEFERRED_ARG_TYPE_LONG_DOUBLE);
+                    break;
+                default:
+                    result = is_integer_arg_type(arg_type);
+                    break;
+                }
+                site->arg_kinds[arg_index] = arg_type;
+                arg_index++;
+            }
+        }
+    }
+
+    // arguments that no conversion uses are not worth capturing
+    return result && (arg_index == site->arg_count);
+}
+
+bool log_deferred_site_is_deferred(LOG_DEFERRED_SITE* site)
+{
+    bool result;
+
+    if (site == NULL)
+    {
+        /* Codes_SRS_LOG_DEFERRED_01_005: [ If site is NULL, log_deferred_site_is_deferred shall fail and return false. ]*/
+        (void)printf("Invalid arguments: LOG_DEFERRED_SITE* site=%p\r\n", (void*)site);
+        result = false;
+    }
+    else
+    {
+        long state = atomic_load_long(&site->state);
+        if (
+            (state == LOG_DEFERRED_SITE_STATE_NOT_CHECKED) &&
+            /* Codes_SRS_LOG_DEFERRED_01_006: [ On the first call for a site, log_deferred_site_is_deferred shall check the format of the site without taking a lock. ]*/
+            atomic_compare_exchange_long(&site->state, LOG_DEFERRED_SITE_STATE_NOT_CHECKED, LOG_DEFERRED_SITE_STATE_CHECKING)
+            )
+        {
+            /* Codes_SRS_LOG_DEFERRED_01_007: [ The site shall be deferred if the number of arguments is at most LOG_DEFERRED_MAX_ARG_COUNT, each argument is used by exactly one conversion and each conversion can be formatted from the captured value (integers, doubles, strings, pointers and %m; not %n, %lc, %ls, positional arguments or grouping). ]*/
+            state = check_site(site) ? LOG_DEFERRED_SITE_STATE_DEFERRED : LOG_DEFERRED_SITE_STATE_IMMEDIATE;
+            atomic_store_long(&site->state, state);
+        }
+
+        /* Codes_SRS_LOG_DEFERRED_01_008: [ log_deferred_site_is_deferred shall return true if the site is deferred and false otherwise (including while another thread checks the site). ]*/
+        result = (state == LOG_DEFERRED_SITE_STATE_DEFERRED);
+    }
+
+    return result;
+}
+
+/* Codes_SRS_LOG_DEFERRED_01_029: [ When a thread that has a buffer exits, the buffer shall be marked as no longer in use. ]*/
+#ifdef _WIN32
+static DWORD thread_exit_fls_index = FLS_OUT_OF_INDEXES;
+static INIT_ONCE thread_exit_init_once = INIT_ONCE_STATIC_INIT;
+
+static VOID NTAPI release_thread_buffer(PVOID value)
+{
+    LOG_DEFERRED_THREAD_BUFFER* buffer = value;
+    thread_buffer = NULL;
+    atomic_store_long(&buffer->in_use, 0);
+}
+
+static BOOL CALLBACK create_thread_exit_index(PINIT_ONCE init_once, PVOID parameter, PVOID* context)
+{
+    (void)init_once;
+    (void)parameter;
+    (void)context;
+    thread_exit_fls_index = FlsAlloc(release_thread_buffer);
+    return TRUE;
+}
+
+static void release_at_thread_exit(LOG_DEFERRED_THREAD_BUFFER* buffer)
+{
+    (void)InitOnceExecuteOnce(&thread_exit_init_once, create_thread_exit_index, NULL, NULL);
+    if ((thread_exit_fls_index == FLS_OUT_OF_INDEXES) ||
+        !FlsSetValue(thread_exit_fls_index, buffer))
+    {
+        // the buffer stays with the thread for the life of the process
+        (void)printf("Cannot release the deferred log buffer at thread exit\r\n");
+    }
+}
+#else
+static pthread_once_t thread_exit_key_once = PTHREAD_ONCE_INIT;
+static pthread_key_t thread_exit_key;
+static bool thread_exit_key_created;
+
+static void release_thread_buffer(void* value)
+{
+    LOG_DEFERRED_THREAD_BUFFER* buffer = value;
+    thread_buffer = NULL;
+    atomic_store_long(&buffer->in_use, 0);
+}
+
+static void create_thread_exit_key(void)
+{
+    thread_exit_key_created = (pthread_key_create(&thread_exit_key, release_thread_buffer) == 0);
+}
+
+static void release_at_thread_exit(LOG_DEFERRED_THREAD_BUFFER* buffer)
+{
+    if ((pthread_once(&thread_exit_key_once, create_thread_exit_key) != 0) ||
+        !thread_exit_key_created ||
+        (pthread_setspecific(thread_exit_key, buffer) != 0))
+    {
+        // the buffer stays with the thread for the life of the process
+        (void)printf("Cannot release the deferred log buffer at thread exit\r\n");
+    }
+}
+#endif
+
+// a buffer whose thread exited and whose records were all consumed, NULL if there is none
+static LOG_DEFERRED_THREAD_BUFFER* take_free_thread_buffer(void)
+{
+    LOG_DEFERRED_THREAD_BUFFER* result;
+
+    for (result = atomic_load_thread_buffers(); result != NULL; result = result->next)
+    {
+        if ((atomic_load_long(&result->in_use) == 0) &&
+            (atomic_load_long(&result->read_position) == atomic_load_long(&result->write_position)) &&
+            atomic_compare_exchange_long(&result->in_use, 0, 1))
+        {
+            break;
+        }
+    }
+
+    return result;
+}
+
+static LOG_DEFERRED_THREAD_BUFFER* get_thread_buffer(void)
+{
+    if (thread_buffer == NULL)
+    {
+        /* Codes_SRS_LOG_DEFERRED_01_028: [ On the first call from a thread, log_deferred_log shall take a buffer whose thread exited and whose records were all consumed by log_deferred_flush, without taking a lock. ]*/
+        LOG_DEFERRED_THREAD_BUFFER* new_buffer = take_free_thread_buffer();
+        if (new_buffer == NULL)
+        {
+            /* Codes_SRS_LOG_DEFERRED_01_011: [ If there is no such buffer, log_deferred_log shall allocate a buffer of LOG_DEFERRED_THREAD_BUFFER_SIZE bytes for the thread and add it to the list of thread buffers without taking a lock. ]*/
+            new_buffer = malloc(sizeof(LOG_DEFERRED_THREAD_BUFFER));
+            if (new_buffer == NULL)
+            {
+                (void)printf("malloc(sizeof(LOG_DEFERRED_THREAD_BUFFER)) failed\r\n");
+            }
+            else
+            {
+                LOG_DEFERRED_THREAD_BUFFER* head;
+
+                new_buffer->in_use = 1;
+                new_buffer->write_position = 0;
+                new_buffer->read_position = 0;
+                do
+                {
+                    head = atomic_load_thread_buffers();
+                    new_buffer->next = head;
+                } while (!atomic_compare_exchange_thread_buffers(head, new_buffer));
+            }
+        }
+
+        if (new_buffer != NULL)
+        {
+            release_at_thread_exit(new_buffer);
+            thread_buffer = new_buffer;
+        }
+    }
+
+    return thread_buffer;
+}
+
+static void store_arg(unsigned char* record, size_t* size, const void* value, size_t value_size)
+{
+    (void)memcpy(record + *size, value, value_size);
+    *size += value_size;
+}
+
+void log_deferred_log(LOG_DEFERRED_SITE* site, LOG_LEVEL log_level, ...)
+{
+    // errno as it was when the call was made, for %m
+    int errno_value = errno;
+
+    if (
+        /* Codes_SRS_LOG_DEFERRED_01_009: [ If site is NULL, log_deferred_log shall return. ]*/
+        (site == NULL) ||
+        /* Codes_SRS_LOG_DEFERRED_01_010: [ If site is not deferred, log_deferred_log shall return. ]*/
+        (atomic_load_long(&site->state) != LOG_DEFERRED_SITE_STATE_DEFERRED)
+        )
+    {
+        (void)printf("Invalid arguments: LOG_DEFERRED_SITE* site=%p, LOG_LEVEL log_level=%" PRI_MU_ENUM "\r\n",
+            (void*)site, MU_ENUM_VALUE(LOG_LEVEL, log_level));
+    }
+    else
+    {
+        /* Codes_SRS_LOG_DEFERRED_01_025: [ log_deferred_log shall store in the record the ticks obtained by calling log_timestamp_ticks. ]*/
+        uint64_t ticks = log_timestamp_ticks();
+        unsigned char record[LOG_DEFERRED_MAX_RECORD_SIZE];
+        size_t size = sizeof(LOG_DEFERRED_RECORD_HEADER);
+        va_list args;
+
+        /* Codes_SRS_LOG_DEFERRED_01_012: [ log_deferred_log shall build a record made of the site, log_level, the value of errno and the value of each argument as given by the argument kinds of the site. ]*/
+        va_start(args, log_level);
+        for (uint32_t i = 0; i < site->arg_count; i++)
+        {
+            switch (site->arg_kinds[i])
+            {
+            case LOG_DEFERRED_ARG_TYPE_INT: { int value = va_arg(args, int); store_arg(record, &size, &value, sizeof(value)); break; }
+            case LOG_DEFERRED_ARG_TYPE_UNSIGNED_INT: { unsigned int value = va_arg(args, unsigned int); store_arg(record, &size, &value, sizeof(value)); break; }
+            case LOG_DEFERRED_ARG_TYPE_LONG: { long value = va_arg(args, long); store_arg(record, &size, &value, sizeof(value)); break; }
+            case LOG_DEFERRED_ARG_TYPE_UNSIGNED_LONG: { unsigned long value = va_arg(args, unsigned long); store_arg(record, &size, &value, sizeof(value)); break; }
+            case LOG_DEFERRED_ARG_TYPE_LONG_LONG: { long long value = va_arg(args, long long); store_arg(record, &size, &value, sizeof(value)); break; }
+            case LOG_DEFERRED_ARG_TYPE_UNSIGNED_LONG_LONG: { unsigned long long value = va_arg(args, unsigned long long); store_arg(record, &size, &value, sizeof(value)); break; }
+            case LOG_DEFERRED_ARG_TYPE_DOUBLE: { double value = va_arg(args, double); store_arg(record, &size, &value, sizeof(value)); break; }
+            case LOG_DEFERRED_ARG_TYPE_LONG_DOUBLE: { long double value = va_arg(args, long double); store_arg(record, &size, &value, sizeof(value)); break; }
+            case LOG_DEFERRED_ARG_TYPE_POINTER: { void* value = va_arg(args, void*); store_arg(record, &size, &value, sizeof(value)); break; }
+            default:
+            {
+                /* Codes_SRS_LOG_DEFERRED_01_013: [ log_deferred_log shall copy the strings in the record, truncated so that the record has at most LOG_DEFERRED_MAX_RECORD_SIZE bytes. ]*/
+                const char* value = va_arg(args, const char*);
+                uint32_t length;
+                if (value == NULL)
+                {
+                    length = NULL_STRING_LENGTH;
+                    store_arg(record, &size, &length, sizeof(length));
+                }
+                else
+                {
+                    size_t room = sizeof(record) - size - sizeof(length) - 1 - ((site->arg_count - i - 1) * MAX_ARG_STORAGE_SIZE);
+                    const char* terminator = memchr(value, '\0', room);
+                    length = (uint32_t)((terminator == NULL) ? room : (size_t)(terminator - value));
+                    store_arg(record, &size, &length, sizeof(length));
+                    store_arg(record, &size, value, length);
+                    record[size++] = '\0';
+                }
+                break;
+            }
+            }
+        }
+        va_end(args);
+
+        size = (size + RECORD_ALIGNMENT - 1) & ~(size_t)(RECORD_ALIGNMENT - 1);
+
+        LOG_DEFERRED_RECORD_HEADER header = { site, ticks, (uint32_t)size, (uint32_t)log_level, errno_value };
+        (void)memcpy(record, &header, sizeof(header));
+
+        LOG_DEFERRED_THREAD_BUFFER* buffer = get_thread_buffer();
+        if (buffer == NULL)
+        {
+            /* Codes_SRS_LOG_DEFERRED_01_014: [ If any error occurs, log_deferred_log shall drop the record and count it as dropped. ]*/
+            atomic_increment_long(&dropped_count);
+        }
+        else
+        {
+            uint32_t write_position = (uint32_t)buffer->write_position;
+            uint32_t read_position = (uint32_t)atomic_load_long(&buffer->read_position);
+            uint32_t offset = write_position % LOG_DEFERRED_THREAD_BUFFER_SIZE;
+            uint32_t to_end = LOG_DEFERRED_THREAD_BUFFER_SIZE - offset;
+            uint32_t skipped = (to_end < size) ? to_end : 0;
+
+            if ((write_position - read_position) + skipped + size > LOG_DEFERRED_THREAD_BUFFER_SIZE)
+            {
+                /* Codes_SRS_LOG_DEFERRED_01_015: [ If the buffer of the thread does not have room for the record, log_deferred_log shall drop the record and count it as dropped. ]*/
+                atomic_increment_long(&dropped_count);
+            }
+            else
+            {
+                if (skipped > 0)
+                {
+                    if (skipped >= sizeof(LOG_DEFERRED_RECORD_HEADER))
+                    {
+                        LOG_DEFERRED_RECORD_HEADER padding = { NULL, 0, skipped, 0, 0 };
+                        (void)memcpy(&buffer->data[offset], &padding, sizeof(padding));
+                    }
+                    write_position += skipped;
+                    offset = 0;
+                }
+
+                /* Codes_SRS_LOG_DEFERRED_01_016: [ log_deferred_log shall copy the record in the buffer of the calling thread without taking a lock. ]*/
+                (void)memcpy(&buffer->data[offset], record, size);
+                atomic_store_long(&buffer->write_position, (long)(write_position + (uint32_t)size));
+            }
+        }
+    }
+}
+
+// formats one conversion with its captured value (and the captured * values), reading the value moves past it
+static int format_captured_value(char* destination, size_t room, const char* spec_text, uint32_t star_count, const int stars[2], uint8_t arg_kind, const unsigned char** value)
+{
+#define FORMAT_WITH_STARS(...) \
+    ((star_count == 0) ? log_snprintf(destination, room, spec_text, __VA_ARGS__) : \
+    (star_count == 1) ? log_snprintf(destination, room, spec_text, stars[0], __VA_ARGS__) : \
+    log_snprintf(destination, room, spec_text, stars[0], stars[1], __VA_ARGS__))
+
+#define FORMAT_CAPTURED(type) \
+    { \
+        type captured; \
+        (void)memcpy(&captured, *value, sizeof(captured)); \
+        *value += sizeof(captured); \
+        result = FORMAT_WITH_STARS(captured); \
+        break; \
+    }
+
+    int result;
+
+    switch (arg_kind)
+    {
+    case LOG_DEFERRED_ARG_TYPE_INT: FORMAT_CAPTURED(int)
+    case LOG_DEFERRED_ARG_TYPE_UNSIGNED_INT: FORMAT_CAPTURED(unsigned int)
+    case LOG_DEFERRED_ARG_TYPE_LONG: FORMAT_CAPTURED(long)
+    case LOG_DEFERRED_ARG_TYPE_UNSIGNED_LONG: FORMAT_CAPTURED(unsigned long)
+    case LOG_DEFERRED_ARG_TYPE_LONG_LONG: FORMAT_CAPTURED(long long)
+    case LOG_DEFERRED_ARG_TYPE_UNSIGNED_LONG_LONG: FORMAT_CAPTURED(unsigned long long)
+    case LOG_DEFERRED_ARG_TYPE_DOUBLE: FORMAT_CAPTURED(double)
+    case LOG_DEFERRED_ARG_TYPE_LONG_DOUBLE: FORMAT_CAPTURED(long double)
+    case LOG_DEFERRED_ARG_TYPE_POINTER: FORMAT_CAPTURED(void*)
+    default:
+    {
+        uint32_t length;
+        (void)memcpy(&length, *value, sizeof(length));
+        *value += sizeof(length);
+        if (length == NULL_STRING_LENGTH)
+        {
+            result = FORMAT_WITH_STARS((const char*)NULL);
+        }
+        else
+        {
+            result = FORMAT_WITH_STARS((const char*)*value);
+            *value += length + 1;
+        }
+        break;
+    }
+    }
+
+#undef FORMAT_CAPTURED
+#undef FORMAT_WITH_STARS
+
+    return result;
+}
+
+// the part of message still available at length (NULL when the message is already full)
+static char* message_position(char* message, size_t message_size, size_t length, size_t* room)
+{
+    char* result;
+    if (length < message_size)
+    {
+        *room = message_size - length;
+        result = message + length;
+    }
+    else
+    {
+        *room = 0;
+        result = NULL;
+    }
+    return result;
+}
+
+static void message_append(char* message, size_t message_size, size_t* length, const char* source, size_t source_length)
+{
+    if (*length + 1 < message_size)
+    {
+        size_t room = message_size - 1 - *length;
+        (void)memcpy(message + *length, source, (source_length < room) ? source_length : room);
+    }
+    *length += source_length;
+}
+
+static void format_record(const LOG_DEFERRED_RECORD_HEADER* header, const unsigned char* values)
+{
+    LOG_DEFERRED_SITE* site = header->site;
+    char message[LOG_MAX_MESSAGE_LENGTH];
+    size_t length = 0;
+    uint32_t arg_index = 0;
+    const char* position = site->format;
+    const char* percent;
+
+    /* Codes_SRS_LOG_DEFERRED_01_020: [ log_deferred_flush shall format the message of each record by copying the text of the format and formatting each conversion with log_snprintf from the captured values. ]*/
+    while ((percent = strchr(position, '%')) != NULL)
+    {
+        DEFERRED_SPEC spec;
+
+        message_append(message, sizeof(message), &length, position, (size_t)(percent - position));
+
+        // the site was checked when the record was made
+        (void)parse_deferred_spec(percent, &spec);
+        position = spec.end;
+
+        if (spec.conversion == '%')
+        {
+            message_append(message, sizeof(message), &length, "%", 1);
+        }
+        else
+        {
+            char spec_text[MAX_DEFERRED_SPEC_LENGTH];
+            int stars[2] = { 0, 0 };
+            size_t room;
+            char* destination = message_position(message, sizeof(message), length, &room);
+            int format_result;
+
+            (void)memcpy(spec_text, percent, (size_t)(spec.end - percent));
+            spec_text[spec.end - percent] = '\0';
+
+            for (uint32_t i = 0; i < spec.star_count; i++)
+            {
+                (void)memcpy(&stars[i], values, sizeof(int));
+                values += sizeof(int);
+                arg_index++;
+            }
+
+            if (spec.conversion == 'm')
+            {
+                errno = header->errno_value;
+                format_result = (spec.star_count == 0) ? log_snprintf(destination, room, spec_text) :
+                    (spec.star_count == 1) ? log_snprintf(destination, room, spec_text, stars[0]) :
+                    log_snprintf(destination, room, spec_text, stars[0], stars[1]);
+            }
+            else
+            {
+                format_result = format_captured_value(destination, room, spec_text, spec.star_count, stars, site->arg_kinds[arg_index], &values);
+                arg_index++;
+            }
+
+            if (format_result > 0)
+            {
+                length += (size_t)format_result;
+            }
+        }
+    }
+    message_append(message, sizeof(message), &length, position, strlen(position));
+    message[(length < sizeof(message)) ? length : sizeof(message) - 1] = '\0';
+
+    /* Codes_SRS_LOG_DEFERRED_01_021: [ log_deferred_flush shall pass the message to the sinks by calling logger_log with the level, file, function and line of the site and no context. ]*/
+    /* Codes_SRS_LOG_DEFERRED_01_027: [ log_deferred_flush shall call log_timestamp_begin_record with the ticks of the record before calling logger_log and log_timestamp_end_record after. ]*/
+    log_timestamp_begin_record(header->ticks);
+    logger_log((LOG_LEVEL)header->log_level, NULL, site->file, site->func, site->line, "%s", message);
+    log_timestamp_end_record();
+}
+
+int log_deferred_flush(void)
+{
+    int result;
+
+    if (!atomic_compare_exchange_long(&flush_in_progress, 0, 1))
+    {
+        /* Codes_SRS_LOG_DEFERRED_01_017: [ If another call to log_deferred_flush is in progress, log_deferred_flush shall return 0. ]*/
+        result = 0;
+    }
+    else
+    {
+        uint32_t record_count = 0;
+
+        /* Codes_SRS_LOG_DEFERRED_01_026: [ log_deferred_flush shall refresh the mapping of ticks to wall clock time by calling log_timestamp_calibrate. ]*/
+        (void)log_timestamp_calibrate();
+
+        /* Codes_SRS_LOG_DEFERRED_01_018: [ log_deferred_flush shall go through the buffers of all the threads that called log_deferred_log. ]*/
+        for (LOG_DEFERRED_THREAD_BUFFER* buffer = atomic_load_thread_buffers(); buffer != NULL; buffer = buffer->next)
+        {
+            uint32_t read_position = (uint32_t)buffer->read_position;
+            uint32_t write_position = (uint32_t)atomic_load_long(&buffer->write_position);
+
+            /* Codes_SRS_LOG_DEFERRED_01_019: [ log_deferred_flush shall consume the records of each buffer in the order they were made. ]*/
+            while (read_position != write_position)
+            {
+                uint32_t offset = read_position % LOG_DEFERRED_THREAD_BUFFER_SIZE;
+                uint32_t to_end = LOG_DEFERRED_THREAD_BUFFER_SIZE - offset;
+
+                if (to_end < sizeof(LOG_DEFERRED_RECORD_HEADER))
+                {
+                    // skipped by the writer, no room for a padding header
+                    read_position += to_end;
+                }
+                else
+                {
+                    LOG_DEFERRED_RECORD_HEADER header;
+                    (void)memcpy(&header, &buffer->data[offset], sizeof(header));
+                    if (header.site != NULL)
+                    {
+                        format_record(&header, &buffer->data[offset + sizeof(header)]);
+                        record_count++;
+                    }
+                    read_position += header.size;
+                }
+
+                // hand the room back to the writer right away
+                atomic_store_long(&buffer->read_position, (long)read_position);
+            }
+        }
+
+        uint32_t dropped = (uint32_t)atomic_load_long(&dropped_count);
+        if (dropped != reported_dropped_count)
+        {
+            /* Codes_SRS_LOG_DEFERRED_01_022: [ If records were dropped since the previous call, log_deferred_flush shall log a warning with the number of dropped records. ]*/
+            logger_log(LOG_LEVEL_WARNING, NULL, __FILE__, __FUNCTION__, __LINE__, "%" PRIu32 " deferred log records were dropped", dropped - reported_dropped_count);
+            reported_dropped_count = dropped;
+        }
+
+        atomic_store_long(&flush_in_progress, 0);
+
+        /* Codes_SRS_LOG_DEFERRED_01_023: [ log_deferred_flush shall return the number of records formatted. ]*/
+        result = (int)record_count;
+    }
+
+    return result;
+}
+
+uint32_t log_deferred_get_dropped_count(void)
+{
+    /* Codes_SRS_LOG_DEFERRED_01_024: [ log_deferred_get_dropped_count shall return the number of records dropped since the start of the process. ]*/
+    return (uint32_t)atomic_load_long(&dropped_count);
+}
+
+uint32_t log_deferred_get_thread_buffer_count(void)
+{
+    uint32_t result = 0;
+
+    /* Codes_SRS_LOG_DEFERRED_01_030: [ log_deferred_get_thread_buffer_count shall return the number of thread buffers allocated since the start of the process. ]*/
+    for (LOG_DEFERRED_THREAD_BUFFER* buffer = atomic_load_thread_buffers(); buffer != NULL; buffer = buffer->next)
+    {
+        result++;
+    }
+
+    return result;
+}
@@ -19,30 +19,38 @@ static void unused_var_function(void)
     (void)test_message_to_trigger_a_compiler_error;
 }
 
-int log_errno_fill_property(void* buffer, int dummy)
+int log_errno_fill_property(void* buffer, size_t buffer_size, int dummy)
 {
+    int result;
+
     (void)dummy;
 
     if (buffer == NULL)
     {
         /* Codes_SRS_LOG_ERRNO_LINUX_01_002: [ If buffer is NULL, log_errno_fill_property shall return 512 to indicate how many bytes shall be reserved for the string formatted errno. ] */
-        // do nothing
+        result = MESSAGE_BUFFER_SIZE;
     }
     else
     {
+        char message[MESSAGE_BUFFER_SIZE];
+
         /* Codes_SRS_LOG_ERRNO_LINUX_01_003: [ Otherwise, log_errno_fill_property shall obtain the errno value. ] */
-        /* Codes_SRS_LOG_ERRNO_LINUX_01_004: [ log_errno_fill_property shall call strerror_r with buffer, 512 and the errno value. ] */
-        if (strerror_r(errno, buffer, MESSAGE_BUFFER_SIZE) != 0)
+        /* Codes_SRS_LOG_ERRNO_LINUX_01_012: [ log_errno_fill_property shall call strerror_r with the errno value, a local buffer of 512 bytes and 512. ] */
+        if (strerror_r(errno, message, MESSAGE_BUFFER_SIZE) != 0)
         {
-            /* Codes_SRS_LOG_ERRNO_LINUX_01_005: [ If strerror_r fails, log_errno_fill_property shall copy in buffer the string failure in strerror_r and return 512. ] */
-            (void)memcpy(buffer, strerror_r_failure_message, sizeof(strerror_r_failure_message));
+            /* Codes_SRS_LOG_ERRNO_LINUX_01_013: [ If strerror_r fails, log_errno_fill_property shall use the string failure in strerror_r instead. ] */
+            (void)memcpy(message, strerror_r_failure_message, sizeof(strerror_r_failure_message));
         }
-        else
+
+        /* Codes_SRS_LOG_ERRNO_LINUX_01_015: [ log_errno_fill_property shall return the length of the string plus 1 for the null terminator. ] */
+        result = (int)strlen(message) + 1;
+
+        if ((size_t)result <= buffer_size)
         {
-            // return
+            /* Codes_SRS_LOG_ERRNO_LINUX_01_014: [ If the string and its null terminator fit in buffer_size bytes, log_errno_fill_property shall copy them to buffer. ] */
+            (void)memcpy(buffer, message, result);
         }
     }
 
-    /* Codes_SRS_LOG_ERRNO_LINUX_01_007: [ log_errno_fill_property shall return 512. ] */
-    return MESSAGE_BUFFER_SIZE;
+    return result;
 }
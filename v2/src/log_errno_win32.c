@@ -15,30 +15,38 @@ static const char strerror_s_failure_message[] = "failure in strerror_s";
 // This array is not used for anything, but rather just to emit a compiler error
 static const char test_message_to_trigger_a_compiler_error[1 * (MESSAGE_BUFFER_SIZE >= sizeof(strerror_s_failure_message))] = { 0 }; /*this construct will generate a compile time error (array of size 0) when MESSAGE_BUFFER_SIZE is not enough to hold even the failure message*/
 
-int log_errno_fill_property(void* buffer, int dummy)
+int log_errno_fill_property(void* buffer, size_t buffer_size, int dummy)
 {
+    int result;
+
     (void)dummy;
 
     if (buffer == NULL)
     {
         /* Codes_SRS_LOG_ERRNO_WIN32_01_002: [ If buffer is NULL, log_errno_fill_property shall return 512 to indicate how many bytes shall be reserved for the string formatted errno. ] */
-        // do nothing
+        result = MESSAGE_BUFFER_SIZE;
     }
     else
     {
+        char message[MESSAGE_BUFFER_SIZE];
+
         /* Codes_SRS_LOG_ERRNO_WIN32_01_003: [ Otherwise, log_errno_fill_property shall obtain the errno value. ] */
-        /* Codes_SRS_LOG_ERRNO_WIN32_01_004: [ log_errno_fill_property shall call strerror_s with buffer, 512 and the errno value. ] */
-        if (strerror_s(buffer, MESSAGE_BUFFER_SIZE, errno) != 0)
+        /* Codes_SRS_LOG_ERRNO_WIN32_01_011: [ log_errno_fill_property shall call strerror_s with a local buffer of 512 bytes, 512 and the errno value. ] */
+        if (strerror_s(message, MESSAGE_BUFFER_SIZE, errno) != 0)
         {
-            /* Codes_SRS_LOG_ERRNO_WIN32_01_005: [ If strerror_s fails, log_errno_fill_property shall copy in buffer the string failure in strerror_s and return 512. ] */
-            (void)memcpy(buffer, strerror_s_failure_message, sizeof(strerror_s_failure_message));
+            /* Codes_SRS_LOG_ERRNO_WIN32_01_012: [ If strerror_s fails, log_errno_fill_property shall use the string failure in strerror_s instead. ] */
+            (void)memcpy(message, strerror_s_failure_message, sizeof(strerror_s_failure_message));
         }
-        else
+
+        /* Codes_SRS_LOG_ERRNO_WIN32_01_014: [ log_errno_fill_property shall return the length of the string plus 1 for the null terminator. ] */
+        result = (int)strlen(message) + 1;
+
+        if ((size_t)result <= buffer_size)
         {
-            // return
+            /* Codes_SRS_LOG_ERRNO_WIN32_01_013: [ If the string and its null terminator fit in buffer_size bytes, log_errno_fill_property shall copy them to buffer. ] */
+            (void)memcpy(buffer, message, result);
         }
     }
 
-    /* Codes_SRS_LOG_ERRNO_WIN32_01_007: [ log_errno_fill_property shall return 512. ] */
-    return MESSAGE_BUFFER_SIZE;
+    return result;
 }
@@ -2,6 +2,7 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 #include <inttypes.h>
+#include <string.h>
 
 #include "windows.h"
 #include "psapi.h"
@@ -23,22 +24,27 @@ static const char snprintf_failure_message[] = "snprintf failed";
 static const char test_message_to_trigger_a_compiler_error[1 * (MESSAGE_BUFFER_SIZE >= sizeof(snprintf_failure_message))] = { 0 }; /*this construct will generate a compile time error (array of size 0) when MESSAGE_BUFFER_SIZE is not enough to hold even the failure message*/
 
 
-int log_hresult_fill_property(void* buffer, HRESULT hresult)
+int log_hresult_fill_property(void* buffer, size_t buffer_size, HRESULT hresult)
 {
+    int result;
+
     if (buffer == NULL)
     {
         /* Codes_SRS_LOG_HRESULT_01_001: [ If buffer is NULL, log_hresult_fill_property shall return 512 to indicate how many bytes shall be reserved for the HRESULT string formatted version. ] */
+        result = MESSAGE_BUFFER_SIZE;
     }
     else
     {
+        char message[MESSAGE_BUFFER_SIZE];
+
         /*see if the "system" can provide the code*/
-        /* Codes_SRS_LOG_HRESULT_01_002: [ log_hresult_fill_property shall call FormatMessageA_no_newline with FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, hresult, 0 as language Id, buffer as buffer to place the output and 512 as buffer size. ] */
+        /* Codes_SRS_LOG_HRESULT_01_015: [ log_hresult_fill_property shall call FormatMessageA_no_newline with FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, hresult, 0 as language Id, a local buffer of 512 bytes as buffer to place the output and 512 as buffer size. ] */
         if (FormatMessageA_no_newline(
             FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS,
             NULL,
             hresult,
             0, /*if you pass in zero, FormatMessage looks for a message for LANGIDs in the following order...*/
-            buffer, MESSAGE_BUFFER_SIZE, NULL) != 0)
+            message, MESSAGE_BUFFER_SIZE, NULL) != 0)
         {
             /*success, SYSTEM was able to find the message*/
             /*return as is*/
@@ -57,11 +63,11 @@ int log_hresult_fill_property(void* buffer, HRESULT hresult)
             /* Codes_SRS_LOG_HRESULT_01_006: [ log_hresult_fill_property shall call EnumProcessModules and obtain the information about 10 modules. ] */
             if (EnumProcessModules(currentProcess, module_handles, sizeof(module_handles), &enumModulesUsedBytes) == 0)
             {
-                /* Codes_SRS_LOG_HRESULT_01_009: [ If EnumProcessModules fails, log_hresult_fill_property shall place in buffer a string indicating what failed, the last error and unknown HRESULT 0x%x, where %x is the hresult value. ] */
-                if (snprintf(buffer, MESSAGE_BUFFER_SIZE, "failure in EnumProcessModules, LE=%lu, unknown HRESULT 0x%x", GetLastError(), hresult) < 0)
+                /* Codes_SRS_LOG_HRESULT_01_009: [ If EnumProcessModules fails, log_hresult_fill_property shall place in the local buffer a string indicating what failed, the last error and unknown HRESULT 0x%x, where %x is the hresult value. ] */
+                if (snprintf(message, MESSAGE_BUFFER_SIZE, "failure in EnumProcessModules, LE=%lu, unknown HRESULT 0x%x", GetLastError(), hresult) < 0)
                 {
-                    /* Codes_SRS_LOG_HRESULT_01_008: [ If printing the unknown HRESULT 0x%x string fails, log_hresult_fill_property shall place in buffer the string snprintf failed. ] */
-                    (void)memcpy(buffer, snprintf_failure_message, sizeof(snprintf_failure_message));
+                    /* Codes_SRS_LOG_HRESULT_01_008: [ If printing the unknown HRESULT 0x%x string fails, log_hresult_fill_property shall place in the local buffer the string snprintf failed. ] */
+                    (void)memcpy(message, snprintf_failure_message, sizeof(snprintf_failure_message));
                 }
                 else
                 {
@@ -76,13 +82,13 @@ int log_hresult_fill_property(void* buffer, HRESULT hresult)
                 for (iModule = 0; iModule < (enumModulesUsedBytes / sizeof(HMODULE)); iModule++)
                 {
                     /*see if this module */
-                    /* Codes_SRS_LOG_HRESULT_01_011: [ log_hresult_fill_property shall call FormatMessageA with FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS, the module handle, the hresult value, 0 as language Id, buffer as buffer to place the output and 512 as buffer size. ] */
+                    /* Codes_SRS_LOG_HRESULT_01_016: [ log_hresult_fill_property shall call FormatMessageA with FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS, the module handle, the hresult value, 0 as language Id, the local buffer as buffer to place the output and 512 as buffer size. ] */
                     if (FormatMessageA_no_newline(
                         FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS,
                         module_handles[iModule],
                         hresult,
                         0,
-                        buffer, MESSAGE_BUFFER_SIZE, NULL) != 0)
+                        message, MESSAGE_BUFFER_SIZE, NULL) != 0)
                     {
                         break;
                     }
@@ -94,11 +100,11 @@ int log_hresult_fill_property(void* buffer, HRESULT hresult)
 
                 if (iModule == (enumModulesUsedBytes / sizeof(HMODULE)))
                 {
-                    /* Codes_SRS_LOG_HRESULT_01_007: [ If no module has the formatted message, log_hresult_fill_property shall place in buffer the string unknown HRESULT 0x%x, where %x is the hresult value. ] */
-                    if (snprintf(buffer, MESSAGE_BUFFER_SIZE, "unknown HRESULT 0x%x", hresult) < 0)
+                    /* Codes_SRS_LOG_HRESULT_01_007: [ If no module has the formatted message, log_hresult_fill_property shall place in the local buffer the string unknown HRESULT 0x%x, where %x is the hresult value. ] */
+                    if (snprintf(message, MESSAGE_BUFFER_SIZE, "unknown HRESULT 0x%x", hresult) < 0)
                     {
-                        /* Codes_SRS_LOG_HRESULT_01_008: [ If printing the unknown HRESULT 0x%x string fails, log_hresult_fill_property shall place in buffer the string snprintf failed. ] */
-                        (void)memcpy(buffer, snprintf_failure_message, sizeof(snprintf_failure_message));
+                        /* Codes_SRS_LOG_HRESULT_01_008: [ If printing the unknown HRESULT 0x%x string fails, log_hresult_fill_property shall place in the local buffer the string snprintf failed. ] */
+                        (void)memcpy(message, snprintf_failure_message, sizeof(snprintf_failure_message));
                     }
                     else
                     {
@@ -111,8 +117,16 @@ int log_hresult_fill_property(void* buffer, HRESULT hresult)
                 }
             }
         }
+
+        /* Codes_SRS_LOG_HRESULT_01_017: [ log_hresult_fill_property shall return the length of the string placed in the local buffer plus 1 for the null terminator. ] */
+        result = (int)strlen(message) + 1;
+
+        if ((size_t)result <= buffer_size)
+        {
+            /* Codes_SRS_LOG_HRESULT_01_018: [ If the string and its null terminator fit in buffer_size bytes, log_hresult_fill_property shall copy them to buffer. ] */
+            (void)memcpy(buffer, message, result);
+        }
     }
 
-    /* Codes_SRS_LOG_HRESULT_01_003: [ log_lasterror_fill_property shall return 512. ] */
-    return MESSAGE_BUFFER_SIZE;
+    return result;
 }
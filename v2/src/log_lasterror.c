@@ -2,6 +2,7 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 #include <inttypes.h>
+#include <string.h>
 
 #include "macro_utils/macro_utils.h"
 
@@ -17,32 +18,41 @@ static const char FormatMessageA_failure_message[] = "failure in FormatMessageA"
 // This array is not used for anything, but rather just to emit a compiler error
 static const char test_message_to_trigger_a_compiler_error[1 * (MESSAGE_BUFFER_SIZE >= sizeof(FormatMessageA_failure_message))] = { 0 }; /*this construct will generate a compile time error (array of size 0) when MESSAGE_BUFFER_SIZE is not enough to hold even the failure message*/
 
-int log_lasterror_fill_property(void* buffer, int dummy)
+int log_lasterror_fill_property(void* buffer, size_t buffer_size, int dummy)
 {
+    int result;
+
     (void)dummy;
 
     if (buffer == NULL)
     {
         /* Codes_SRS_LOG_LASTERROR_01_002: [ If buffer is NULL, log_lasterror_fill_property shall return 512 to indicate how many bytes shall be reserved for the last error string formatted version. ] */
+        result = MESSAGE_BUFFER_SIZE;
     }
     else
     {
+        char message[MESSAGE_BUFFER_SIZE];
+
         /* Codes_SRS_LOG_LASTERROR_01_003: [ Otherwise, log_lasterror_fill_property shall call GetLastError to obtain the last error information. ] */
         DWORD last_error = GetLastError();
 
-        /* Codes_SRS_LOG_LASTERROR_01_004: [ log_lasterror_fill_property shall call FormatMessageA_no_newline with FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, the last error value, LANG_NEUTRAL as language Id, buffer as buffer to place the output and 512 as buffer size. ] */
-        DWORD chars_written = FormatMessageA_no_newline(FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, NULL, last_error, MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT), buffer, MESSAGE_BUFFER_SIZE, NULL);
+        /* Codes_SRS_LOG_LASTERROR_01_011: [ log_lasterror_fill_property shall call FormatMessageA_no_newline with FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, the last error value, LANG_NEUTRAL as language Id, a local buffer of 512 bytes as buffer to place the output and 512 as buffer size. ] */
+        DWORD chars_written = FormatMessageA_no_newline(FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, NULL, last_error, MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT), message, MESSAGE_BUFFER_SIZE, NULL);
         if (chars_written == 0)
         {
-            /* Codes_SRS_LOG_LASTERROR_01_005: [ If FormatMessageA returns 0, log_lasterror_fill_property shall copy in buffer the string failure in FormatMessageA and return 512. ] */
-            (void)memcpy(buffer, FormatMessageA_failure_message, sizeof(FormatMessageA_failure_message));
+            /* Codes_SRS_LOG_LASTERROR_01_012: [ If FormatMessageA returns 0, log_lasterror_fill_property shall use the string failure in FormatMessageA instead. ] */
+            (void)memcpy(message, FormatMessageA_failure_message, sizeof(FormatMessageA_failure_message));
         }
-        else
+
+        /* Codes_SRS_LOG_LASTERROR_01_014: [ log_lasterror_fill_property shall return the length of the string plus 1 for the null terminator. ] */
+        result = (int)strlen(message) + 1;
+
+        if ((size_t)result <= buffer_size)
         {
-            // return
+            /* Codes_SRS_LOG_LASTERROR_01_013: [ If the string and its null terminator fit in buffer_size bytes, log_lasterror_fill_property shall copy them to buffer. ] */
+            (void)memcpy(buffer, message, result);
         }
     }
 
-    /* Codes_SRS_LOG_LASTERROR_01_007: [ log_lasterror_fill_property shall return 512. ] */
-    return MESSAGE_BUFFER_SIZE;
+    return result;
 }
@@ -0,0 +1,370 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context.h"
+#include "c_logging/log_context_property_to_string.h"
+#include "c_logging/log_context_property_value_pair.h"
+#include "c_logging/log_level.h"
+#include "c_logging/log_printf.h"
+#include "c_logging/log_timestamp.h"
+#include "c_logging/integer_to_string.h"
+#include "c_logging/time_to_string.h"
+
+#include "c_logging/log_layout.h"
+
+static const char short_levels[] =
+{
+    'C', // LOG_LEVEL_CRITICAL
+    'E', // LOG_LEVEL_ERROR
+    'W', // LOG_LEVEL_WARNING
+    'I', // LOG_LEVEL_INFO
+    'V', // LOG_LEVEL_VERBOSE
+};
+
+static const char null_string[] = "NULL";
+
+// Append-only writer over the caller's buffer, one character is always kept for the null terminator (once a field is truncated only that one is left)
+typedef struct LOG_LAYOUT_WRITER_TAG
+{
+    char* position;
+    size_t remaining;
+} LOG_LAYOUT_WRITER;
+
+static void layout_writer_append(LOG_LAYOUT_WRITER* writer, const char* source, size_t length)
+{
+    size_t copied = (length < writer->remaining - 1) ? length : writer->remaining - 1;
+    (void)memcpy(writer->position, source, copied);
+    writer->position += copied;
+    writer->remaining -= copied;
+}
+
+// written is the result of a snprintf like function called at the writer position
+static void layout_writer_advance(LOG_LAYOUT_WRITER* writer, int written)
+{
+    if ((size_t)written < writer->remaining - 1)
+    {
+        writer->position += (size_t)written;
+        writer->remaining -= (size_t)written;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_LAYOUT_01_032: [ If the message or the context is truncated, log_layout_format shall end the line at the zero terminator written by log_vsnprintf_cached or log_context_property_to_string. ]*/
+        // a truncated text ends at its terminator, which is before the end of the buffer when a multibyte character did not fit
+        writer->position += strlen(writer->position);
+        writer->remaining = 1;
+    }
+}
+
+static const char* file_name_of(const char* file)
+{
+    const char* result = file;
+    for (const char* position = file; *position != '\0'; position++)
+    {
+        if ((*position == '/') || (*position == '\\'))
+        {
+            result = position + 1;
+        }
+    }
+    return result;
+}
+
+static bool add_op(LOG_LAYOUT* layout, LOG_LAYOUT_OP_TYPE type)
+{
+    bool result;
+    if (layout->op_count == LOG_LAYOUT_MAX_OP_COUNT)
+    {
+        result = false;
+    }
+    else
+    {
+        layout->ops[layout->op_count].type = (uint8_t)type;
+        layout->ops[layout->op_count].literal_length = 0;
+        layout->ops[layout->op_count].literal_offset = 0;
+        layout->op_count++;
+        result = true;
+    }
+    return result;
+}
+
+// consecutive literal characters (including the ones given as %%) make a single op
+static bool add_literal_char(LOG_LAYOUT* layout, size_t* literal_length, char c)
+{
+    bool result;
+    if (*literal_length == LOG_LAYOUT_MAX_LITERAL_LENGTH)
+    {
+        result = false;
+    }
+    else
+    {
+        if ((layout->op_count > 0) && (layout->ops[layout->op_count - 1].type == LOG_LAYOUT_OP_TYPE_LITERAL))
+        {
+            result = true;
+        }
+        else
+        {
+            result = add_op(layout, LOG_LAYOUT_OP_TYPE_LITERAL);
+            if (result)
+            {
+                layout->ops[layout->op_count - 1].literal_offset = (uint8_t)*literal_length;
+            }
+        }
+
+        if (result)
+        {
+            layout->literals[*literal_length] = c;
+            (*literal_length)++;
+            layout->ops[layout->op_count - 1].literal_length++;
+        }
+    }
+    return result;
+}
+
+int log_layout_compile(LOG_LAYOUT* layout, const char* pattern)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_LAYOUT_01_001: [ If layout is NULL, log_layout_compile shall fail and return a non-zero value. ]*/
+        (layout == NULL) ||
+        /* Codes_SRS_LOG_LAYOUT_01_002: [ If pattern is NULL, log_layout_compile shall fail and return a non-zero value. ]*/
+        (pattern == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: LOG_LAYOUT* layout=%p, const char* pattern=%s\r\n", (void*)layout, MU_P_OR_NULL(pattern));
+        result = MU_FAILURE;
+    }
+    else
+    {
+        size_t literal_length = 0;
+        bool succeeded = true;
+        const char* position = pattern;
+
+        layout->op_count = 0;
+
+        /* Codes_SRS_LOG_LAYOUT_01_003: [ log_layout_compile shall parse pattern into a list of ops stored in layout: one for each run of literal characters and one for each field. ]*/
+        while (succeeded && (*position != '\0'))
+        {
+            if (*position != '%')
+            {
+                succeeded = add_literal_char(layout, &literal_length, *position);
+                position++;
+            }
+            else
+            {
+                position++;
+                switch (*position)
+                {
+                /* Codes_SRS_LOG_LAYOUT_01_004: [ %% shall be compiled as the literal character %. ]*/
+                case '%': succeeded = add_literal_char(layout, &literal_length, '%'); break;
+                /* Codes_SRS_LOG_LAYOUT_01_031: [ %L, %v, %T, %t, %F, %f, %l, %M, %m and %c shall be compiled as the level name, the short level, the UTC time with microseconds, the UTC time with nanoseconds, the file, the file name, the line, the function, the message and the context. ]*/
+                case 'L': succeeded = add_op(layout, LOG_LAYOUT_OP_TYPE_LEVEL); break;
+                case 'v': succeeded = add_op(layout, LOG_LAYOUT_OP_TYPE_SHORT_LEVEL); break;
+                case 'T': succeeded = add_op(layout, LOG_LAYOUT_OP_TYPE_TIME); break;
+                case 't': succeeded = add_op(layout, LOG_LAYOUT_OP_TYPE_PRECISE_TIME); break;
+                case 'F': succeeded = add_op(layout, LOG_LAYOUT_OP_TYPE_FILE); break;
+                case 'f': succeeded = add_op(layout, LOG_LAYOUT_OP_TYPE_FILE_NAME); break;
+                case 'l': succeeded = add_op(layout, LOG_LAYOUT_OP_TYPE_LINE); break;
+                case 'M': succeeded = add_op(layout, LOG_LAYOUT_OP_TYPE_FUNC); break;
+                case 'm': succeeded = add_op(layout, LOG_LAYOUT_OP_TYPE_MESSAGE); break;
+                case 'c': succeeded = add_op(layout, LOG_LAYOUT_OP_TYPE_CONTEXT); break;
+                default:
+                    /* Codes_SRS_LOG_LAYOUT_01_006: [ If pattern contains any other character after %, or ends with %, log_layout_compile shall fail and return a non-zero value. ]*/
+                    (void)printf("Invalid layout pattern \"%s\": unknown field at offset %d\r\n", pattern, (int)(position - 1 - pattern));
+                    succeeded = false;
+                    break;
+                }
+
+                if (*position != '\0')
+                {
+                    position++;
+                }
+            }
+        }
+
+        if (!succeeded)
+        {
+            /* Codes_SRS_LOG_LAYOUT_01_007: [ If pattern needs more than LOG_LAYOUT_MAX_OP_COUNT ops or more than LOG_LAYOUT_MAX_LITERAL_LENGTH literal characters, log_layout_compile shall fail and return a non-zero value. ]*/
+            (void)printf("Cannot compile layout pattern \"%s\"\r\n", pattern);
+            layout->op_count = 0;
+            result = MU_FAILURE;
+        }
+        else
+        {
+            /* Codes_SRS_LOG_LAYOUT_01_008: [ log_layout_compile shall succeed and return 0. ]*/
+            result = 0;
+        }
+    }
+
+    return result;
+}
+
+int log_layout_format(const LOG_LAYOUT* layout, char* buffer, size_t buffer_size, LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context, const char* file, const char* func, int line, const char* message_format, va_list args)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_LAYOUT_01_009: [ If layout is NULL, log_layout_format shall fail and return a negative value. ]*/
+        (layout == NULL) ||
+        /* Codes_SRS_LOG_LAYOUT_01_010: [ If buffer is NULL, log_layout_format shall fail and return a negative value. ]*/
+        (buffer == NULL) ||
+        /* Codes_SRS_LOG_LAYOUT_01_011: [ If buffer_size is 0, log_layout_format shall fail and return a negative value. ]*/
+        (buffer_size == 0) ||
+        /* Codes_SRS_LOG_LAYOUT_01_012: [ If message_format is NULL, log_layout_format shall fail and return a negative value. ]*/
+        (message_format == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: const LOG_LAYOUT* layout=%p, char* buffer=%p, size_t buffer_size=%zu, LOG_LEVEL log_level=%" PRI_MU_ENUM ", LOG_CONTEXT_HANDLE log_context=%p, const char* file=%s, const char* func=%s, int line=%d, const char* message_format=%s\r\n",
+            (const void*)layout, (void*)buffer, buffer_size, MU_ENUM_VALUE(LOG_LEVEL, log_level), (void*)log_context, MU_P_OR_NULL(file), MU_P_OR_NULL(func), line, MU_P_OR_NULL(message_format));
+        result = -1;
+    }
+    else
+    {
+        LOG_LAYOUT_WRITER writer = { buffer, buffer_size };
+        bool error = false;
+
+        /* Codes_SRS_LOG_LAYOUT_01_013: [ log_layout_format shall run the ops of layout in order, so that only the fields in the pattern are computed: ]*/
+        for (uint32_t i = 0; (i < layout->op_count) && !error; i++)
+        {
+            const LOG_LAYOUT_OP* op = &layout->ops[i];
+            switch (op->type)
+            {
+            case LOG_LAYOUT_OP_TYPE_LITERAL:
+                /* Codes_SRS_LOG_LAYOUT_01_014: [ For a literal op, log_layout_format shall copy the literal characters. ]*/
+                layout_writer_append(&writer, &layout->literals[op->literal_offset], op->literal_length);
+                break;
+            case LOG_LAYOUT_OP_TYPE_LEVEL:
+            {
+                /* Codes_SRS_LOG_LAYOUT_01_015: [ For a level op, log_layout_format shall write the name of log_level. ]*/
+                const char* level_name = MU_ENUM_TO_STRING(LOG_LEVEL, log_level);
+                layout_writer_append(&writer, level_name, strlen(level_name));
+                break;
+            }
+            case LOG_LAYOUT_OP_TYPE_SHORT_LEVEL:
+                /* Codes_SRS_LOG_LAYOUT_01_016: [ For a short level op, log_layout_format shall write C, E, W, I or V for log_level. ]*/
+                layout_writer_append(&writer, ((uint32_t)log_level < sizeof(short_levels)) ? &short_levels[log_level] : "?", 1);
+                break;
+            case LOG_LAYOUT_OP_TYPE_TIME:
+            case LOG_LAYOUT_OP_TYPE_PRECISE_TIME:
+            {
+                /* Codes_SRS_LOG_LAYOUT_01_028: [ For a time op, log_layout_format shall obtain the time by calling log_timestamp_now and write it with timestamp_microseconds_to_string. ]*/
+                /* Codes_SRS_LOG_LAYOUT_01_029: [ For a precise time op, log_layout_format shall obtain the time by calling log_timestamp_now and write it with timestamp_to_string. ]*/
+                int64_t now = log_timestamp_now();
+                char timestamp[TIMESTAMP_TO_STRING_LENGTH + 1];
+                int timestamp_length;
+                if (now == LOG_TIMESTAMP_INVALID)
+                {
+                    timestamp_length = -1;
+                }
+                else if (op->type == LOG_LAYOUT_OP_TYPE_TIME)
+                {
+                    timestamp_length = timestamp_microseconds_to_string(now, timestamp, sizeof(timestamp));
+                }
+                else
+                {
+                    timestamp_length = timestamp_to_string(now, timestamp, sizeof(timestamp));
+                }
+
+                if (timestamp_length < 0)
+                {
+                    /* Codes_SRS_LOG_LAYOUT_01_030: [ If obtaining or writing the time fails, log_layout_format shall write NULL for the time. ]*/
+                    layout_writer_append(&writer, null_string, sizeof(null_string) - 1);
+                }
+                else
+                {
+                    layout_writer_append(&writer, timestamp, (size_t)timestamp_length);
+                }
+                break;
+            }
+            case LOG_LAYOUT_OP_TYPE_FILE:
+            {
+                /* Codes_SRS_LOG_LAYOUT_01_020: [ For a file op, log_layout_format shall write file (NULL if file is NULL). ]*/
+                const char* file_text = MU_P_OR_NULL(file);
+                layout_writer_append(&writer, file_text, strlen(file_text));
+                break;
+            }
+            case LOG_LAYOUT_OP_TYPE_FILE_NAME:
+            {
+                /* Codes_SRS_LOG_LAYOUT_01_021: [ For a file name op, log_layout_format shall write the part of file after the last / or \ (NULL if file is NULL). ]*/
+                const char* file_name = (file == NULL) ? null_string : file_name_of(file);
+                layout_writer_append(&writer, file_name, strlen(file_name));
+                break;
+            }
+            case LOG_LAYOUT_OP_TYPE_LINE:
+            {
+                /* Codes_SRS_LOG_LAYOUT_01_022: [ For a line op, log_layout_format shall write line in decimal. ]*/
+                char line_text[INTEGER_TO_STRING_MAX_LENGTH];
+                uint32_t line_length = integer_to_string_write_int64(line, line_text);
+                layout_writer_append(&writer, line_text, line_length);
+                break;
+            }
+            case LOG_LAYOUT_OP_TYPE_FUNC:
+            {
+                /* Codes_SRS_LOG_LAYOUT_01_023: [ For a function op, log_layout_format shall write func (NULL if func is NULL). ]*/
+                const char* func_text = MU_P_OR_NULL(func);
+                layout_writer_append(&writer, func_text, strlen(func_text));
+                break;
+            }
+            case LOG_LAYOUT_OP_TYPE_MESSAGE:
+            {
+                va_list message_args;
+                va_copy(message_args, args);
+                /* Codes_SRS_LOG_LAYOUT_01_024: [ For a message op, log_layout_format shall format the message by calling log_vsnprintf_cached with message_format and args. ]*/
+                int vsnprintf_result = log_vsnprintf_cached(writer.position, writer.remaining, message_format, message_args);
+                va_end(message_args);
+                if (vsnprintf_result < 0)
+                {
+                    /* Codes_SRS_LOG_LAYOUT_01_027: [ If formatting the message or the context fails, log_layout_format shall fail and return a negative value. ]*/
+                    error = true;
+                }
+                else
+                {
+                    layout_writer_advance(&writer, vsnprintf_result);
+                }
+                break;
+            }
+            default:
+            {
+                /* Codes_SRS_LOG_LAYOUT_01_025: [ For a context op, if log_context is not NULL, log_layout_format shall write the properties of log_context by calling log_context_property_to_string. ]*/
+                if (log_context != NULL)
+                {
+                    size_t property_value_pair_count = log_context_get_property_value_pair_count(log_context);
+                    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(log_context);
+                    int to_string_result = log_context_property_to_string(writer.position, writer.remaining, property_value_pairs, property_value_pair_count); // lgtm[cpp/unguardednullreturndereference] Tests and code review ensure that NULL access cannot happen
+                    if (to_string_result < 0)
+                    {
+                        /* Codes_SRS_LOG_LAYOUT_01_027: [ If formatting the message or the context fails, log_layout_format shall fail and return a negative value. ]*/
+                        error = true;
+                    }
+                    else
+                    {
+                        layout_writer_advance(&writer, to_string_result);
+                    }
+                }
+                break;
+            }
+            }
+        }
+
+        if (error)
+        {
+            result = -1;
+        }
+        else
+        {
+            /* Codes_SRS_LOG_LAYOUT_01_026: [ log_layout_format shall write at most buffer_size characters including the null terminator and return the number of characters written without the null terminator. ]*/
+            *writer.position = '\0';
+            result = (int)(writer.position - buffer);
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,1148 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <errno.h>
+#include <limits.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <wchar.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <stdatomic.h>
+#endif
+
+#include "c_logging/integer_to_string.h"
+#ifndef __GLIBC__
+#include "c_logging/log_errno.h"
+#endif
+
+#include "c_logging/log_printf.h"
+
+// enough for the 22 octal digits of a 64 bit value
+#define MAX_INTEGER_DIGITS 24
+
+// enough for a conversion spec handed to the C library: '%', 5 flags, 2 numbers of at most 10 digits, '.', "ll" and the conversion
+#define MAX_DELEGATED_SPEC_LENGTH 32
+
+// enough for any errno text
+#define ERRNO_MESSAGE_BUFFER_SIZE 512
+
+typedef enum LENGTH_MODIFIER_TAG
+{
+    LENGTH_MODIFIER_NONE,
+    LENGTH_MODIFIER_hh,
+    LENGTH_MODIFIER_h,
+    LENGTH_MODIFIER_l,
+    LENGTH_MODIFIER_ll,
+    LENGTH_MODIFIER_j,
+    LENGTH_MODIFIER_z,
+    LENGTH_MODIFIER_t,
+    LENGTH_MODIFIER_L
+} LENGTH_MODIFIER;
+
+typedef struct CONVERSION_SPEC_TAG
+{
+    bool left_align;        // '-'
+    bool force_sign;        // '+'
+    bool space_sign;        // ' '
+    bool alternate_form;    // '#'
+    bool zero_pad;          // '0'
+    bool width_from_args;
+    bool precision_from_args;
+    int width;
+    int precision;          // -1 when not specified
+    LENGTH_MODIFIER length_modifier;
+    char conversion;
+} CONVERSION_SPEC;
+
+// Output over the caller's buffer. length is the length of the full output so far, including what did not fit,
+// characters are stored only while they fit before the zero terminator.
+typedef struct LOG_PRINTF_OUTPUT_TAG
+{
+    char* buffer;
+    size_t buffer_size;
+    size_t length;
+} LOG_PRINTF_OUTPUT;
+
+static void output_append(LOG_PRINTF_OUTPUT* output, const char* source, size_t source_length)
+{
+    if (output->length + 1 < output->buffer_size)
+    {
+        size_t room = output->buffer_size - 1 - output->length;
+        (void)memcpy(output->buffer + output->length, source, (source_length < room) ? source_length : room);
+    }
+    output->length += source_length;
+}
+
+static void output_append_repeated(LOG_PRINTF_OUTPUT* output, char c, size_t count)
+{
+    if (output->length + 1 < output->buffer_size)
+    {
+        size_t room = output->buffer_size - 1 - output->length;
+        (void)memset(output->buffer + output->length, c, (count < room) ? count : room);
+    }
+    output->length += count;
+}
+
+// where the C library writes when a conversion is handed to it (it follows the same snprintf contract)
+static char* output_position(LOG_PRINTF_OUTPUT* output, size_t* room)
+{
+    char* result;
+    if (output->length < output->buffer_size)
+    {
+        *room = output->buffer_size - output->length;
+        result = output->buffer + output->length;
+    }
+    else
+    {
+        *room = 0;
+        result = NULL;
+    }
+    return result;
+}
+
+static int output_append_formatted(LOG_PRINTF_OUTPUT* output, const char* format, ...)
+{
+    int result;
+    size_t room;
+    char* position = output_position(output, &room);
+
+    va_list args;
+    va_start(args, format);
+    int vsnprintf_result = vsnprintf(position, room, format, args);
+    va_end(args);
+
+    if (vsnprintf_result < 0)
+    {
+        result = -1;
+    }
+    else
+    {
+        output->length += (size_t)vsnprintf_result;
+        result = 0;
+    }
+
+    return result;
+}
+
+// pads a field of field_length characters up to the width, on the side given by the '-' flag
+static void output_append_padding(LOG_PRINTF_OUTPUT* output, const CONVERSION_SPEC* spec, size_t field_length)
+{
+    if ((size_t)spec->width > field_length)
+    {
+        output_append_repeated(output, ' ', (size_t)spec->width - field_length);
+    }
+}
+
+// parses a width or precision, numbers that do not fit in an int are capped (the C library then reports the overflow)
+static const char* parse_number(const char* format, int* value)
+{
+    int number = 0;
+    while ((*format >= '0') && (*format <= '9'))
+    {
+        number = (number > (INT_MAX - 9) / 10) ? INT_MAX : number * 10 + (*format - '0');
+        format++;
+    }
+    *value = number;
+    return format;
+}
+
+// parses the flags, width, precision, length modifier and conversion after a '%'
+// returns a pointer after the conversion, or NULL when the spec is not one formatted in-house
+static const char* parse_conversion_spec(const char* format, CONVERSION_SPEC* spec)
+{
+    const char* result = format;
+
+    spec->left_align = false;
+    spec->force_sign = false;
+    spec->space_sign = false;
+    spec->alternate_form = false;
+    spec->zero_pad = false;
+    spec->width_from_args = false;
+    spec->precision_from_args = false;
+    spec->width = 0;
+    spec->precision = -1;
+    spec->length_modifier = LENGTH_MODIFIER_NONE;
+
+    for (;; result++)
+    {
+        if (*result == '-')
+        {
+            spec->left_align = true;
+        }
+        else if (*result == '+')
+        {
+            spec->force_sign = true;
+        }
+        else if (*result == ' ')
+        {
+            spec->space_sign = true;
+        }
+        else if (*result == '#')
+        {
+            spec->alternate_form = true;
+        }
+        else if (*result == '0')
+        {
+            spec->zero_pad = true;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if (*result == '*')
+    {
+        spec->width_from_args = true;
+        result++;
+    }
+    else
+    {
+        result = parse_number(result, &spec->width);
+    }
+
+    if (*result == '.')
+    {
+        result++;
+        spec->precision = 0;
+        if (*result == '*')
+        {
+            spec->precision_from_args = true;
+            result++;
+        }
+        else
+        {
+            result = parse_number(result, &spec->precision);
+        }
+    }
+
+    switch (*result)
+    {
+    case 'h':
+        result++;
+        if (*result == 'h')
+        {
+            result++;
+            spec->length_modifier = LENGTH_MODIFIER_hh;
+        }
+        else
+        {
+            spec->length_modifier = LENGTH_MODIFIER_h;
+        }
+        break;
+    case 'l':
+        result++;
+        if (*result == 'l')
+        {
+            result++;
+            spec->length_modifier = LENGTH_MODIFIER_ll;
+        }
+        else
+        {
+            spec->length_modifier = LENGTH_MODIFIER_l;
+        }
+        break;
+    case 'j':
+        result++;
+        spec->length_modifier = LENGTH_MODIFIER_j;
+        break;
+    case 'z':
+        result++;
+        spec->length_modifier = LENGTH_MODIFIER_z;
+        break;
+    case 't':
+        result++;
+        spec->length_modifier = LENGTH_MODIFIER_t;
+        break;
+    case 'L':
+        result++;
+        spec->length_modifier = LENGTH_MODIFIER_L;
+        break;
+    default:
+        break;
+    }
+
+    spec->conversion = *result;
+    switch (spec->conversion)
+    {
+    case 'd':
+    case 'i':
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+    case 'n':
+        // long double length modifier does not apply to integers
+        result = (spec->length_modifier == LENGTH_MODIFIER_L) ? NULL : result + 1;
+        break;
+    case 'f':
+    case 'F':
+    case 'e':
+    case 'E':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+        result = ((spec->length_modifier == LENGTH_MODIFIER_NONE) || (spec->length_modifier == LENGTH_MODIFIER_l) || (spec->length_modifier == LENGTH_MODIFIER_L)) ? result + 1 : NULL;
+        break;
+    case 'c':
+    case 's':
+        result = ((spec->length_modifier == LENGTH_MODIFIER_NONE) || (spec->length_modifier == LENGTH_MODIFIER_l)) ? result + 1 : NULL;
+        break;
+    case 'p':
+    case 'm':
+        result = (spec->length_modifier == LENGTH_MODIFIER_NONE) ? result + 1 : NULL;
+        break;
+    case '%':
+        // only the plain "%%" form, anything else is left to the C library
+        result = (result == format) ? result + 1 : NULL;
+        break;
+    default:
+        // positional arguments ('$'), grouping ('\''), platform specific modifiers and invalid specs
+        result = NULL;
+        break;
+    }
+
+    return result;
+}
+
+// rebuilds the spec (with the * values resolved) for handing a single conversion to the C library
+static void build_delegated_spec(const CONVERSION_SPEC* spec, char delegated_spec[MAX_DELEGATED_SPEC_LENGTH])
+{
+    char* position = delegated_spec;
+
+    *position++ = '%';
+    if (spec->left_align)
+    {
+        *position++ = '-';
+    }
+    if (spec->force_sign)
+    {
+        *position++ = '+';
+    }
+    if (spec->space_sign)
+    {
+        *position++ = ' ';
+    }
+    if (spec->alternate_form)
+    {
+        *position++ = '#';
+    }
+    if (spec->zero_pad)
+    {
+        *position++ = '0';
+    }
+    if (spec->width > 0)
+    {
+        position += integer_to_string_write_uint64((uint64_t)spec->width, position);
+    }
+    if (spec->precision >= 0)
+    {
+        *position++ = '.';
+        position += integer_to_string_write_uint64((uint64_t)spec->precision, position);
+    }
+    if (spec->length_modifier == LENGTH_MODIFIER_l)
+    {
+        *position++ = 'l';
+    }
+    else if (spec->length_modifier == LENGTH_MODIFIER_L)
+    {
+        *position++ = 'L';
+    }
+    *position++ = spec->conversion;
+    *position = '\0';
+}
+
+static void format_integer(LOG_PRINTF_OUTPUT* output, const CONVERSION_SPEC* spec, uint64_t magnitude, bool is_negative)
+{
+    char digits[MAX_INTEGER_DIGITS];
+    size_t digit_count;
+    char* digits_end = digits + sizeof(digits);
+    const char* prefix = "";
+    size_t prefix_length = 0;
+
+    if ((spec->precision == 0) && (magnitude == 0))
+    {
+        // an explicit precision of 0 prints no digits for 0
+        digit_count = 0;
+    }
+    else if ((spec->conversion == 'd') || (spec->conversion == 'i') || (spec->conversion == 'u'))
+    {
+        digit_count = integer_to_string_write_uint64(magnitude, digits);
+        digits_end = digits + digit_count;
+    }
+    else if (spec->conversion == 'o')
+    {
+        char* position = digits_end;
+        do
+        {
+            *--position = (char)('0' + (magnitude & 7));
+            magnitude >>= 3;
+        } while (magnitude != 0);
+        digit_count = (size_t)(digits_end - position);
+    }
+    else
+    {
+        const char* hex_digits = (spec->conversion == 'x') ? "0123456789abcdef" : "0123456789ABCDEF";
+        char* position = digits_end;
+        if ((spec->alternate_form) && (magnitude != 0))
+        {
+            prefix = (spec->conversion == 'x') ? "0x" : "0X";
+            prefix_length = 2;
+        }
+        do
+        {
+            *--position = hex_digits[magnitude & 0xF];
+            magnitude >>= 4;
+        } while (magnitude != 0);
+        digit_count = (size_t)(digits_end - position);
+    }
+
+    if ((spec->conversion == 'd') || (spec->conversion == 'i'))
+    {
+        if (is_negative)
+        {
+            prefix = "-";
+            prefix_length = 1;
+        }
+        else if (spec->force_sign)
+        {
+            prefix = "+";
+            prefix_length = 1;
+        }
+        else if (spec->space_sign)
+        {
+            prefix = " ";
+            prefix_length = 1;
+        }
+    }
+
+    size_t zero_count = ((spec->precision >= 0) && ((size_t)spec->precision > digit_count)) ? (size_t)spec->precision - digit_count : 0;
+    if ((spec->conversion == 'o') && (spec->alternate_form) && (zero_count == 0) && ((digit_count == 0) || (digits_end[-(ptrdiff_t)digit_count] != '0')))
+    {
+        // '#' makes the first octal digit a 0
+        zero_count = 1;
+    }
+
+    size_t field_length = prefix_length + zero_count + digit_count;
+    if ((spec->zero_pad) && (!spec->left_align) && (spec->precision < 0) && ((size_t)spec->width > field_length))
+    {
+        // '0' pads between the sign or prefix and the digits
+        zero_count += (size_t)spec->width - field_length;
+        field_length = (size_t)spec->width;
+    }
+
+    if (!spec->left_align)
+    {
+        output_append_padding(output, spec, field_length);
+    }
+    output_append(output, prefix, prefix_length);
+    output_append_repeated(output, '0', zero_count);
+    output_append(output, digits_end - digit_count, digit_count);
+    if (spec->left_align)
+    {
+        output_append_padding(output, spec, field_length);
+    }
+}
+
+static void format_chars(LOG_PRINTF_OUTPUT* output, const CONVERSION_SPEC* spec, const char* chars, size_t char_count)
+{
+    if (!spec->left_align)
+    {
+        output_append_padding(output, spec, char_count);
+    }
+    output_append(output, chars, char_count);
+    if (spec->left_align)
+    {
+        output_append_padding(output, spec, char_count);
+    }
+}
+
+#ifndef __GLIBC__
+static const char* get_errno_name(int errno_value)
+{
+    const char* result;
+
+    switch (errno_value)
+    {
+#define ERRNO_NAME_CASE(name) case name: result = #name; break;
+        ERRNO_NAME_CASE(EPERM)
+        ERRNO_NAME_CASE(ENOENT)
+        ERRNO_NAME_CASE(ESRCH)
+        ERRNO_NAME_CASE(EINTR)
+        ERRNO_NAME_CASE(EIO)
+        ERRNO_NAME_CASE(ENXIO)
+        ERRNO_NAME_CASE(E2BIG)
+        ERRNO_NAME_CASE(ENOEXEC)
+        ERRNO_NAME_CASE(EBADF)
+        ERRNO_NAME_CASE(ECHILD)
+        ERRNO_NAME_CASE(EAGAIN)
+        ERRNO_NAME_CASE(ENOMEM)
+        ERRNO_NAME_CASE(EACCES)
+        ERRNO_NAME_CASE(EFAULT)
+        ERRNO_NAME_CASE(EBUSY)
+        ERRNO_NAME_CASE(EEXIST)
+        ERRNO_NAME_CASE(EXDEV)
+        ERRNO_NAME_CASE(ENODEV)
+        ERRNO_NAME_CASE(ENOTDIR)
+        ERRNO_NAME_CASE(EISDIR)
+        ERRNO_NAME_CASE(EINVAL)
+        ERRNO_NAME_CASE(ENFILE)
+        ERRNO_NAME_CASE(EMFILE)
+        ERRNO_NAME_CASE(ENOTTY)
+        ERRNO_NAME_CASE(EFBIG)
+        ERRNO_NAME_CASE(ENOSPC)
+        ERRNO_NAME_CASE(ESPIPE)
+        ERRNO_NAME_CASE(EROFS)
+        ERRNO_NAME_CASE(EMLINK)
+        ERRNO_NAME_CASE(EPIPE)
+        ERRNO_NAME_CASE(EDOM)
+        ERRNO_NAME_CASE(ERANGE)
+        ERRNO_NAME_CASE(EDEADLK)
+        ERRNO_NAME_CASE(ENAMETOOLONG)
+        ERRNO_NAME_CASE(ENOLCK)
+        ERRNO_NAME_CASE(ENOSYS)
+        ERRNO_NAME_CASE(ENOTEMPTY)
+        ERRNO_NAME_CASE(EILSEQ)
+#undef ERRNO_NAME_CASE
+    default:
+        result = NULL;
+        break;
+    }
+
+    return result;
+}
+#endif
+
+// %m and %#m: glibc formats them itself, elsewhere the text comes from log_errno_fill_property and the name from a table of the C and POSIX errno values
+static int format_errno(LOG_PRINTF_OUTPUT* output, const CONVERSION_SPEC* spec, int errno_value)
+{
+    int result;
+
+#ifdef __GLIBC__
+    char delegated_spec[MAX_DELEGATED_SPEC_LENGTH];
+    build_delegated_spec(spec, delegated_spec);
+    errno = errno_value;
+    result = output_append_formatted(output, delegated_spec);
+#else
+    char errno_text[ERRNO_MESSAGE_BUFFER_SIZE];
+    const char* errno_name = spec->alternate_form ? get_errno_name(errno_value) : NULL;
+
+    if (errno_name != NULL)
+    {
+        format_chars(output, spec, errno_name, strlen(errno_name));
+        result = 0;
+    }
+    else if (spec->alternate_form)
+    {
+        // unknown values are printed as numbers (as glibc does)
+        char digits[INTEGER_TO_STRING_MAX_LENGTH];
+        format_chars(output, spec, digits, integer_to_string_write_int64(errno_value, digits));
+        result = 0;
+    }
+    else
+    {
+        errno = errno_value;
+        if (log_errno_fill_property(errno_text, sizeof(errno_text), 0) < 0)
+        {
+            result = -1;
+        }
+        else
+        {
+            format_chars(output, spec, errno_text, strlen(errno_text));
+            result = 0;
+        }
+    }
+#endif
+
+    return result;
+}
+
+// formats one conversion (the spec as parsed, the * values are taken from arg_list), returns 0 on success
+static int format_conversion(LOG_PRINTF_OUTPUT* output, CONVERSION_SPEC* spec, va_list* arg_list, int errno_value)
+{
+    int result = 0;
+
+    /* Codes_SRS_LOG_PRINTF_01_004: [ log_vsnprintf shall take the width and precision given as * from the arguments (a negative width sets the - flag, a negative precision is ignored). ]*/
+    if (spec->width_from_args)
+    {
+        int width = va_arg(*arg_list, int);
+        if (width < 0)
+        {
+            spec->left_align = true;
+            width = (width == INT_MIN) ? INT_MAX : -width;
+        }
+        spec->width = width;
+    }
+    if (spec->precision_from_args)
+    {
+        int precision = va_arg(*arg_list, int);
+        spec->precision = (precision < 0) ? -1 : precision;
+    }
+
+    switch (spec->conversion)
+    {
+    case 'd':
+    case 'i':
+    {
+        /* Codes_SRS_LOG_PRINTF_01_005: [ log_vsnprintf shall format d, i, u, o, x and X conversions for all length modifiers, flags, widths and precisions without calling the C library. ]*/
+        int64_t value;
+        switch (spec->length_modifier)
+        {
+        case LENGTH_MODIFIER_hh: value = (signed char)va_arg(*arg_list, int); break;
+        case LENGTH_MODIFIER_h: value = (short)va_arg(*arg_list, int); break;
+        case LENGTH_MODIFIER_l: value = va_arg(*arg_list, long); break;
+        case LENGTH_MODIFIER_ll: value = va_arg(*arg_list, long long); break;
+        case LENGTH_MODIFIER_j: value = va_arg(*arg_list, intmax_t); break;
+        case LENGTH_MODIFIER_z: value = (int64_t)va_arg(*arg_list, size_t); break;
+        case LENGTH_MODIFIER_t: value = va_arg(*arg_list, ptrdiff_t); break;
+        default: value = va_arg(*arg_list, int); break;
+        }
+        format_integer(output, spec, (value < 0) ? (uint64_t)0 - (uint64_t)value : (uint64_t)value, value < 0);
+        break;
+    }
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+    {
+        uint64_t value;
+        switch (spec->length_modifier)
+        {
+        case LENGTH_MODIFIER_hh: value = (unsigned char)va_arg(*arg_list, unsigned int); break;
+        case LENGTH_MODIFIER_h: value = (unsigned short)va_arg(*arg_list, unsigned int); break;
+        case LENGTH_MODIFIER_l: value = va_arg(*arg_list, unsigned long); break;
+        case LENGTH_MODIFIER_ll: value = va_arg(*arg_list, unsigned long long); break;
+        case LENGTH_MODIFIER_j: value = va_arg(*arg_list, uintmax_t); break;
+        case LENGTH_MODIFIER_z: value = va_arg(*arg_list, size_t); break;
+        case LENGTH_MODIFIER_t: value = (uint64_t)va_arg(*arg_list, ptrdiff_t); break;
+        default: value = va_arg(*arg_list, unsigned int); break;
+        }
+        format_integer(output, spec, value, false);
+        break;
+    }
+    case 'c':
+    {
+        if (spec->length_modifier == LENGTH_MODIFIER_NONE)
+        {
+            /* Codes_SRS_LOG_PRINTF_01_006: [ log_vsnprintf shall format c and s conversions (with width and precision) without calling the C library. ]*/
+            char c = (char)va_arg(*arg_list, int);
+            format_chars(output, spec, &c, 1);
+        }
+        else
+        {
+            /* Codes_SRS_LOG_PRINTF_01_010: [ log_vsnprintf shall format floating point conversions, wide characters and wide strings by calling snprintf for the single conversion. ]*/
+            char delegated_spec[MAX_DELEGATED_SPEC_LENGTH];
+            build_delegated_spec(spec, delegated_spec);
+            result = output_append_formatted(output, delegated_spec, va_arg(*arg_list, wint_t));
+        }
+        break;
+    }
+    case 's':
+    {
+        if (spec->length_modifier == LENGTH_MODIFIER_NONE)
+        {
+            const char* value = va_arg(*arg_list, const char*);
+            if (value == NULL)
+            {
+                /* Codes_SRS_LOG_PRINTF_01_011: [ log_vsnprintf shall format a NULL string as the C library does. ]*/
+                char delegated_spec[MAX_DELEGATED_SPEC_LENGTH];
+                build_delegated_spec(spec, delegated_spec);
+                result = output_append_formatted(output, delegated_spec, value);
+            }
+            else
+            {
+                // the precision limits how many characters are read
+                const char* terminator = (spec->precision >= 0) ? memchr(value, '\0', (size_t)spec->precision) : NULL;
+                size_t value_length = (spec->precision < 0) ? strlen(value) : (terminator == NULL) ? (size_t)spec->precision : (size_t)(terminator - value);
+                format_chars(output, spec, value, value_length);
+            }
+        }
+        else
+        {
+            char delegated_spec[MAX_DELEGATED_SPEC_LENGTH];
+            build_delegated_spec(spec, delegated_spec);
+            result = output_append_formatted(output, delegated_spec, va_arg(*arg_list, const wchar_t*));
+        }
+        break;
+    }
+    case 'p':
+    {
+        void* value = va_arg(*arg_list, void*);
+#if defined(__GLIBC__) || defined(_MSC_VER)
+        if ((value != NULL) && (!spec->force_sign) && (!spec->space_sign) && (!spec->zero_pad) && (spec->precision < 0))
+        {
+            /* Codes_SRS_LOG_PRINTF_01_007: [ log_vsnprintf shall format non NULL p conversions without flags other than - and without precision the way the C library does, without calling it. ]*/
+            char digits[2 + 2 * sizeof(void*)];
+            char* digits_end = digits + sizeof(digits);
+            char* digits_start = digits_end;
+            uintptr_t address = (uintptr_t)value;
+#ifdef _MSC_VER
+            // all the digits, upper case, no prefix
+            for (size_t i = 0; i < 2 * sizeof(void*); i++)
+            {
+                *--digits_start = "0123456789ABCDEF"[address & 0xF];
+                address >>= 4;
+            }
+#else
+            // 0x followed by the significant digits, lower case
+            do
+            {
+                *--digits_start = "0123456789abcdef"[address & 0xF];
+                address >>= 4;
+            } while (address != 0);
+            *--digits_start = 'x';
+            *--digits_start = '0';
+#endif
+            format_chars(output, spec, digits_start, (size_t)(digits_end - digits_start));
+        }
+        else
+#endif
+        {
+            char delegated_spec[MAX_DELEGATED_SPEC_LENGTH];
+            build_delegated_spec(spec, delegated_spec);
+            result = output_append_formatted(output, delegated_spec, value);
+        }
+        break;
+    }
+    case 'n':
+    {
+        /* Codes_SRS_LOG_PRINTF_01_008: [ log_vsnprintf shall store the number of characters produced so far for n conversions. ]*/
+        switch (spec->length_modifier)
+        {
+        case LENGTH_MODIFIER_hh: *va_arg(*arg_list, signed char*) = (signed char)output->length; break;
+        case LENGTH_MODIFIER_h: *va_arg(*arg_list, short*) = (short)output->length; break;
+        case LENGTH_MODIFIER_l: *va_arg(*arg_list, long*) = (long)output->length; break;
+        case LENGTH_MODIFIER_ll: *va_arg(*arg_list, long long*) = (long long)output->length; break;
+        case LENGTH_MODIFIER_j: *va_arg(*arg_list, intmax_t*) = (intmax_t)output->length; break;
+        case LENGTH_MODIFIER_z: *va_arg(*arg_list, size_t*) = output->length; break;
+        case LENGTH_MODIFIER_t: *va_arg(*arg_list, ptrdiff_t*) = (ptrdiff_t)output->length; break;
+        default: *va_arg(*arg_list, int*) = (int)output->length; break;
+        }
+        break;
+    }
+    case 'm':
+    {
+        /* Codes_SRS_LOG_PRINTF_01_013: [ log_vsnprintf shall format m as the text for the errno value at the time of the call and #m as the name of that errno value. ]*/
+        result = format_errno(output, spec, errno_value);
+        break;
+    }
+    case '%':
+    {
+        /* Codes_SRS_LOG_PRINTF_01_009: [ log_vsnprintf shall format %% as %. ]*/
+        output_append(output, "%", 1);
+        break;
+    }
+    default:
+    {
+        /* Codes_SRS_LOG_PRINTF_01_010: [ log_vsnprintf shall format floating point conversions, wide characters and wide strings by calling snprintf for the single conversion. ]*/
+        char delegated_spec[MAX_DELEGATED_SPEC_LENGTH];
+        build_delegated_spec(spec, delegated_spec);
+        if (spec->length_modifier == LENGTH_MODIFIER_L)
+        {
+            result = output_append_formatted(output, delegated_spec, va_arg(*arg_list, long double));
+        }
+        else
+        {
+            result = output_append_formatted(output, delegated_spec, va_arg(*arg_list, double));
+        }
+        break;
+    }
+    }
+
+    return result;
+}
+
+// One piece of a format: the literal text up to the next '%' followed by either a conversion,
+// the rest of the format (when that has to be handed to the C library) or nothing (end of the format).
+typedef enum FORMAT_STEP_KIND_TAG
+{
+    FORMAT_STEP_KIND_CONVERSION,
+    FORMAT_STEP_KIND_DELEGATED_REST,
+    FORMAT_STEP_KIND_END
+} FORMAT_STEP_KIND;
+
+typedef struct FORMAT_STEP_TAG
+{
+    const char* literal;
+    size_t literal_length;
+    FORMAT_STEP_KIND kind;
+    CONVERSION_SPEC spec;   // FORMAT_STEP_KIND_CONVERSION
+} FORMAT_STEP;
+
+// parses the step starting at position, returns where the next step starts
+static const char* parse_format_step(const char* position, FORMAT_STEP* step)
+{
+    const char* result;
+    const char* percent = strchr(position, '%');
+
+    step->literal = position;
+    if (percent == NULL)
+    {
+        step->literal_length = strlen(position);
+        step->kind = FORMAT_STEP_KIND_END;
+        result = position + step->literal_length;
+    }
+    else
+    {
+        step->literal_length = (size_t)(percent - position);
+        result = parse_conversion_spec(percent + 1, &step->spec);
+        if (result == NULL)
+        {
+            // the rest of the format starts at the '%' right after the literal text
+            step->kind = FORMAT_STEP_KIND_DELEGATED_REST;
+            result = percent + strlen(percent);
+        }
+        else
+        {
+            step->kind = FORMAT_STEP_KIND_CONVERSION;
+        }
+    }
+
+    return result;
+}
+
+static int format_step(LOG_PRINTF_OUTPUT* output, const FORMAT_STEP* step, va_list* arg_list, int errno_value)
+{
+    int result;
+
+    /* Codes_SRS_LOG_PRINTF_01_003: [ log_vsnprintf shall copy the characters between conversion specs to buffer as they are. ]*/
+    output_append(output, step->literal, step->literal_length);
+
+    switch (step->kind)
+    {
+    case FORMAT_STEP_KIND_CONVERSION:
+    {
+        // the spec is copied, the * values are resolved in the copy (a cached plan is shared by all threads)
+        CONVERSION_SPEC spec = step->spec;
+        result = format_conversion(output, &spec, arg_list, errno_value);
+        break;
+    }
+    case FORMAT_STEP_KIND_DELEGATED_REST:
+    {
+        /* Codes_SRS_LOG_PRINTF_01_012: [ When a conversion spec is not one that log_vsnprintf formats itself (positional arguments, grouping, platform specific length modifiers, invalid specs), log_vsnprintf shall format the rest of format by calling vsnprintf with the remaining arguments. ]*/
+        size_t room;
+        char* rest_position = output_position(output, &room);
+        int vsnprintf_result = vsnprintf(rest_position, room, step->literal + step->literal_length, *arg_list);
+        if (vsnprintf_result < 0)
+        {
+            result = -1;
+        }
+        else
+        {
+            output->length += (size_t)vsnprintf_result;
+            result = 0;
+        }
+        break;
+    }
+    default:
+        result = 0;
+        break;
+    }
+
+    return result;
+}
+
+// Cache of parsed formats (plans), keyed by the format pointer.
+// The pointer is trusted: a hit does not look at the text at format, the callers only pass formats whose text never changes
+// at a given address (the string literals of the LOGGER_LOG call sites). The text is read once, when the slot is filled:
+// the slot keeps a copy of it and the plan is made of that copy, so a plan never points into the memory of the caller.
+// A slot is claimed by the first thread that misses on it (EMPTY -> FILLING), filled, and published (FILLING -> READY).
+// Threads that find a slot being filled do not wait, they parse the format as if there was no cache.
+// Slots are never reused, so a plan stays valid for the life of the process. The steps live in a static pool,
+// formats that have too many steps (or arrive after the pool is used up) get a READY slot without steps
+// and are always parsed while formatting.
+#define FORMAT_PLAN_CACHE_SIZE_BITS 10
+#define FORMAT_PLAN_CACHE_SIZE (1 << FORMAT_PLAN_CACHE_SIZE_BITS)
+#define FORMAT_PLAN_CACHE_MAX_PROBES 8
+#define FORMAT_PLAN_MAX_STEPS (32 + 1) // 32 conversions and the text after the last one
+#define FORMAT_PLAN_STEP_POOL_SIZE 4096
+#define FORMAT_PLAN_TEXT_POOL_SIZE (64 * 1024)
+
+#define FORMAT_PLAN_SLOT_EMPTY 0
+#define FORMAT_PLAN_SLOT_FILLING 1
+#define FORMAT_PLAN_SLOT_READY 2
+
+#ifdef _MSC_VER
+typedef volatile long FORMAT_PLAN_ATOMIC;
+
+static long format_plan_atomic_load(FORMAT_PLAN_ATOMIC* value)
+{
+    return _InterlockedCompareExchange(value, 0, 0);
+}
+
+static void format_plan_atomic_store(FORMAT_PLAN_ATOMIC* value, long new_value)
+{
+    (void)_InterlockedExchange(value, new_value);
+}
+
+static bool format_plan_atomic_compare_exchange(FORMAT_PLAN_ATOMIC* value, long* expected, long desired)
+{
+    long previous = _InterlockedCompareExchange(value, desired, *expected);
+    bool result = (previous == *expected);
+    *expected = previous;
+    return result;
+}
+#else
+typedef atomic_long FORMAT_PLAN_ATOMIC;
+
+static long format_plan_atomic_load(FORMAT_PLAN_ATOMIC* value)
+{
+    return atomic_load_explicit(value, memory_order_acquire);
+}
+
+static void format_plan_atomic_store(FORMAT_PLAN_ATOMIC* value, long new_value)
+{
+    atomic_store_explicit(value, new_value, memory_order_release);
+}
+
+static bool format_plan_atomic_compare_exchange(FORMAT_PLAN_ATOMIC* value, long* expected, long desired)
+{
+    return atomic_compare_exchange_strong(value, expected, desired);
+}
+#endif
+
+typedef struct FORMAT_PLAN_CACHE_SLOT_TAG
+{
+    FORMAT_PLAN_ATOMIC state;
+    const char* format;
+    const char* format_text;    // copy of the format the steps point into
+    const FORMAT_STEP* steps;   // NULL when the format is not cached
+    uint32_t step_count;
+} FORMAT_PLAN_CACHE_SLOT;
+
+static FORMAT_PLAN_CACHE_SLOT format_plan_cache[FORMAT_PLAN_CACHE_SIZE];
+static FORMAT_STEP format_plan_step_pool[FORMAT_PLAN_STEP_POOL_SIZE];
+static FORMAT_PLAN_ATOMIC format_plan_step_pool_used;
+static char format_plan_text_pool[FORMAT_PLAN_TEXT_POOL_SIZE];
+static FORMAT_PLAN_ATOMIC format_plan_text_pool_used;
+
+// reserves count items of a static pool, returns the index of the first one or -1 if the pool is used up
+static long reserve_from_pool(FORMAT_PLAN_ATOMIC* pool_used, long pool_size, size_t count)
+{
+    long result = -1;
+    long used = format_plan_atomic_load(pool_used);
+
+    while ((count <= (size_t)pool_size) && (used <= pool_size - (long)count))
+    {
+        if (format_plan_atomic_compare_exchange(pool_used, &used, used + (long)count))
+        {
+            result = used;
+            break;
+        }
+    }
+
+    return result;
+}
+
+// parses format and stores its plan in the slot (which the caller has claimed)
+static void fill_plan_cache_slot(FORMAT_PLAN_CACHE_SLOT* slot, const char* format)
+{
+    FORMAT_STEP steps[FORMAT_PLAN_MAX_STEPS];
+    uint32_t step_count = 0;
+    size_t format_size = strlen(format) + 1;
+    long text_index = reserve_from_pool(&format_plan_text_pool_used, FORMAT_PLAN_TEXT_POOL_SIZE, format_size);
+    char* format_text = (text_index < 0) ? NULL : &format_plan_text_pool[text_index];
+    const char* position = format_text;
+    bool fits = (format_text != NULL);
+
+    if (fits)
+    {
+        (void)memcpy(format_text, format, format_size);
+    }
+
+    while (fits)
+    {
+        if (step_count == FORMAT_PLAN_MAX_STEPS)
+        {
+            fits = false;
+            break;
+        }
+        position = parse_format_step(position, &steps[step_count]);
+        step_count++;
+        if (steps[step_count - 1].kind != FORMAT_STEP_KIND_CONVERSION)
+        {
+            break;
+        }
+    }
+
+    long step_index = fits ? reserve_from_pool(&format_plan_step_pool_used, FORMAT_PLAN_STEP_POOL_SIZE, step_count) : -1;
+    FORMAT_STEP* pool_steps = (step_index < 0) ? NULL : &format_plan_step_pool[step_index];
+    if (pool_steps != NULL)
+    {
+        (void)memcpy(pool_steps, steps, step_count * sizeof(FORMAT_STEP));
+    }
+
+    slot->format = format;
+    slot->format_text = format_text;
+    slot->steps = pool_steps;
+    slot->step_count = (pool_steps == NULL) ? 0 : step_count;
+    format_plan_atomic_store(&slot->state, FORMAT_PLAN_SLOT_READY);
+}
+
+// returns the slot holding the plan for format, or NULL if the format has to be parsed while formatting
+static const FORMAT_PLAN_CACHE_SLOT* get_format_plan(const char* format)
+{
+    const FORMAT_PLAN_CACHE_SLOT* result = NULL;
+    // Fibonacci hashing of the pointer (the low bits of string literal addresses carry little information)
+    uint32_t slot_index = (uint32_t)(((uint64_t)(uintptr_t)format * 0x9E3779B97F4A7C15ULL) >> (64 - FORMAT_PLAN_CACHE_SIZE_BITS));
+
+    for (uint32_t probe = 0; probe < FORMAT_PLAN_CACHE_MAX_PROBES; probe++)
+    {
+        FORMAT_PLAN_CACHE_SLOT* slot = &format_plan_cache[(slot_index + probe) & (FORMAT_PLAN_CACHE_SIZE - 1)];
+        long state = format_plan_atomic_load(&slot->state);
+
+        if (state == FORMAT_PLAN_SLOT_EMPTY)
+        {
+            if (format_plan_atomic_compare_exchange(&slot->state, &state, FORMAT_PLAN_SLOT_FILLING))
+            {
+                fill_plan_cache_slot(slot, format);
+                result = slot;
+                break;
+            }
+        }
+
+        if (state == FORMAT_PLAN_SLOT_FILLING)
+        {
+            // another thread is adding a format, it could be this one
+            break;
+        }
+
+        if ((state == FORMAT_PLAN_SLOT_READY) && (slot->format == format))
+        {
+            result = slot;
+            break;
+        }
+    }
+
+    return ((result != NULL) && (result->steps != NULL)) ? result : NULL;
+}
+
+static int format_message(char* buffer, size_t buffer_size, const char* format, va_list args, const FORMAT_PLAN_CACHE_SLOT* plan)
+{
+    int result;
+
+    // %m refers to errno as it was when the call was made
+    int errno_value = errno;
+    bool error = false;
+    LOG_PRINTF_OUTPUT output = { buffer, buffer_size, 0 };
+    va_list arg_list;
+    va_copy(arg_list, args);
+
+    if (plan != NULL)
+    {
+        for (uint32_t i = 0; (i < plan->step_count) && (!error); i++)
+        {
+            error = (format_step(&output, &plan->steps[i], &arg_list, errno_value) != 0);
+        }
+    }
+    else
+    {
+        const char* position = format;
+        FORMAT_STEP step;
+        do
+        {
+            position = parse_format_step(position, &step);
+            error = (format_step(&output, &step, &arg_list, errno_value) != 0);
+        } while ((!error) && (step.kind == FORMAT_STEP_KIND_CONVERSION));
+    }
+
+    va_end(arg_list);
+
+    if (error)
+    {
+        /* Codes_SRS_LOG_PRINTF_01_014: [ If the C library fails formatting a conversion, log_vsnprintf shall fail and return a negative value. ]*/
+        result = -1;
+    }
+    else if (output.length > INT_MAX)
+    {
+        /* Codes_SRS_LOG_PRINTF_01_015: [ If the length of the output does not fit in an int, log_vsnprintf shall fail and return a negative value. ]*/
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_PRINTF_01_016: [ log_vsnprintf shall store at most buffer_size characters including the null terminator in buffer (the rest of the output shall be truncated). ]*/
+        if (buffer_size > 0)
+        {
+            buffer[(output.length < buffer_size) ? output.length : buffer_size - 1] = '\0';
+        }
+
+        /* Codes_SRS_LOG_PRINTF_01_017: [ log_vsnprintf shall succeed and return the length of the full output (without the null terminator). ]*/
+        result = (int)output.length;
+    }
+
+    return result;
+}
+
+int log_vsnprintf(char* buffer, size_t buffer_size, const char* format, va_list args)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_PRINTF_01_001: [ If buffer is NULL and buffer_size is not 0, log_vsnprintf shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_size > 0)) ||
+        /* Codes_SRS_LOG_PRINTF_01_002: [ If format is NULL, log_vsnprintf shall fail and return a negative value. ]*/
+        (format == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: char* buffer=%p, size_t buffer_size=%zu, const char* format=%s\r\n",
+            buffer, buffer_size, (format == NULL) ? "NULL" : format);
+        result = -1;
+    }
+    else
+    {
+        result = format_message(buffer, buffer_size, format, args, NULL);
+    }
+
+    return result;
+}
+
+int log_vsnprintf_cached(char* buffer, size_t buffer_size, const char* format, va_list args)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_LOG_PRINTF_01_020: [ If buffer is NULL and buffer_size is not 0, log_vsnprintf_cached shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_size > 0)) ||
+        /* Codes_SRS_LOG_PRINTF_01_021: [ If format is NULL, log_vsnprintf_cached shall fail and return a negative value. ]*/
+        (format == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: char* buffer=%p, size_t buffer_size=%zu, const char* format=%s\r\n",
+            buffer, buffer_size, (format == NULL) ? "NULL" : format);
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_PRINTF_01_022: [ log_vsnprintf_cached shall look up the plan for format (its literal text and parsed conversion specs) in a cache keyed by the format pointer. ]*/
+        /* Codes_SRS_LOG_PRINTF_01_023: [ If the format is not in the cache, log_vsnprintf_cached shall parse it and add its plan to the cache without taking a lock. ]*/
+        /* Codes_SRS_LOG_PRINTF_01_024: [ If the plan cannot be added to the cache (the cache is full, another thread is adding a plan in the same place or the format has more than 32 conversions), log_vsnprintf_cached shall format the message as log_vsnprintf does. ]*/
+        /* Codes_SRS_LOG_PRINTF_01_026: [ log_vsnprintf_cached shall use a cached plan only if the text at format is the same as the text the plan was made of, otherwise it shall format the message as log_vsnprintf does. ]*/
+        const FORMAT_PLAN_CACHE_SLOT* plan = get_format_plan(format);
+
+        /* Codes_SRS_LOG_PRINTF_01_025: [ log_vsnprintf_cached shall produce the same output and return the same value as log_vsnprintf. ]*/
+        result = format_message(buffer, buffer_size, format, args, plan);
+    }
+
+    return result;
+}
+
+int log_snprintf(char* buffer, size_t buffer_size, const char* format, ...)
+{
+    int result;
+    va_list args;
+
+    va_start(args, format);
+    /* Codes_SRS_LOG_PRINTF_01_018: [ log_snprintf shall call log_vsnprintf with buffer, buffer_size, format and the arguments in .... ]*/
+    /* Codes_SRS_LOG_PRINTF_01_019: [ log_snprintf shall return the result of log_vsnprintf. ]*/
+    result = log_vsnprintf(buffer, buffer_size, format, args);
+    va_end(args);
+
+    return result;
+}
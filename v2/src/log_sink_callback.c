@@ -2,9 +2,11 @@
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdio.h>
 #include <stdarg.h>
-#include <time.h>
+#include <stdint.h>
+#include <inttypes.h>
 
 #include "macro_utils/macro_utils.h"
 
@@ -12,11 +14,25 @@
 #include "c_logging/log_context.h"
 #include "c_logging/log_context_property_to_string.h"
 #include "c_logging/log_context_property_value_pair.h"
+#include "c_logging/log_layout.h"
+#include "c_logging/log_printf.h"
 #include "c_logging/log_sink_if.h"
+#include "c_logging/log_timestamp.h"
 #include "c_logging/logger.h"
+#include "c_logging/time_to_string.h"
 
 #include "c_logging/log_sink_callback.h" // IWYU pragma: keep
 
+#ifdef _WIN32
+#include "windows.h"
+#else
+#include <pthread.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
 #define MIN(a, b) ((a) < (b)) ? (a) : (b)
 
 static const char error_string_invalid_args[] = "Error logging: invalid arguments";
@@ -33,6 +49,184 @@ static LOG_SINK_CALLBACK_LOG log_sink_callback_callback = log_sink_callback_noop
 static void* log_sink_callback_context = NULL;
 static LOG_LEVEL log_sink_callback_max_level = LOG_LEVEL_VERBOSE;
 
+static LOG_SINK_CALLBACK_LOG_RECORD log_sink_callback_record_callback = NULL;
+static void* log_sink_callback_record_context = NULL;
+
+// the message of a record, formatted from a copy of the arguments on the first call to log_sink_callback_record_get_message
+struct LOG_SINK_CALLBACK_RECORD_MESSAGE_TAG
+{
+    const char* message_format;
+    va_list args;
+    bool formatted;
+    const char* text; // NULL if formatting failed
+    char buffer[LOG_MAX_MESSAGE_LENGTH];
+};
+
+#define SUBSCRIBER_STATE_VALUES \
+    SUBSCRIBER_STATE_FREE, \
+    SUBSCRIBER_STATE_SUBSCRIBING, \
+    SUBSCRIBER_STATE_ACTIVE, \
+    SUBSCRIBER_STATE_UNSUBSCRIBING
+
+MU_DEFINE_ENUM(SUBSCRIBER_STATE, SUBSCRIBER_STATE_VALUES)
+
+// The state, the level mask and the generation of a subscriber share one atomic word, so that checking that a subscription id is
+// still the subscription of the slot and changing its state or its mask is one compare-exchange:
+// bits 0-2 are the SUBSCRIBER_STATE, bits 3-7 the level mask (one bit per LOG_LEVEL) and bits 8-30 the generation.
+// The id of a subscription is its generation * LOG_SINK_CALLBACK_MAX_SUBSCRIBERS + the index of its slot.
+#define SUBSCRIBER_STATE_BITS 3
+#define SUBSCRIBER_LEVEL_MASK_BITS 5
+#define SUBSCRIBER_GENERATION_SHIFT (SUBSCRIBER_STATE_BITS + SUBSCRIBER_LEVEL_MASK_BITS)
+#define SUBSCRIBER_GENERATION_MASK ((UINT32_C(1) << (31 - SUBSCRIBER_GENERATION_SHIFT)) - 1)
+
+// the fields other than the atomics are written while the slot is SUBSCRIBING and only read while it is ACTIVE
+typedef struct LOG_SINK_CALLBACK_SUBSCRIBER_TAG
+{
+    volatile long word; // 0 (SUBSCRIBER_STATE_INVALID) is a slot that was never used
+    volatile long call_count; // calls to the callbacks of the subscriber in progress
+    LOG_SINK_CALLBACK_LOG log_callback;
+    LOG_SINK_CALLBACK_LOG_RECORD log_record_callback;
+    void* context;
+} LOG_SINK_CALLBACK_SUBSCRIBER;
+
+static LOG_SINK_CALLBACK_SUBSCRIBER subscribers[LOG_SINK_CALLBACK_MAX_SUBSCRIBERS];
+static volatile long subscription_sequence;
+
+// the logging path checks the state of a subscriber after counting its call and log_sink_callback_unsubscribe checks the
+// count after changing the state, so these are sequentially consistent
+#ifdef _MSC_VER
+static long atomic_load_long(volatile long* value)
+{
+    return _InterlockedCompareExchange(value, 0, 0);
+}
+
+static void atomic_store_long(volatile long* value, long new_value)
+{
+    (void)_InterlockedExchange(value, new_value);
+}
+
+static bool atomic_compare_exchange_long(volatile long* value, long expected, long desired)
+{
+    return (_InterlockedCompareExchange(value, desired, expected) == expected);
+}
+
+static long atomic_increment_long(volatile long* value)
+{
+    return _InterlockedIncrement(value);
+}
+
+static long atomic_decrement_long(volatile long* value)
+{
+    return _InterlockedDecrement(value);
+}
+#else
+static long atomic_load_long(volatile long* value)
+{
+    return __atomic_load_n(value, __ATOMIC_SEQ_CST);
+}
+
+static void atomic_store_long(volatile long* value, long new_value)
+{
+    __atomic_store_n(value, new_value, __ATOMIC_SEQ_CST);
+}
+
+static bool atomic_compare_exchange_long(volatile long* value, long expected, long desired)
+{
+    return __atomic_compare_exchange_n(value, &expected, desired, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+static long atomic_increment_long(volatile long* value)
+{
+    return __atomic_add_fetch(value, 1, __ATOMIC_SEQ_CST);
+}
+
+static long atomic_decrement_long(volatile long* value)
+{
+    return __atomic_sub_fetch(value, 1, __ATOMIC_SEQ_CST);
+}
+#endif
+
+// log_sink_callback_unsubscribe sleeps on unsubscribe_condition until the calls in progress of the subscriber return,
+// the logging path only takes the lock when it ends the last call in progress of a subscriber that is being unsubscribed
+#ifdef _WIN32
+static SRWLOCK unsubscribe_lock = SRWLOCK_INIT;
+static CONDITION_VARIABLE unsubscribe_condition = CONDITION_VARIABLE_INIT;
+
+static void lock_unsubscribe(void)
+{
+    AcquireSRWLockExclusive(&unsubscribe_lock);
+}
+
+static void unlock_unsubscribe(void)
+{
+    ReleaseSRWLockExclusive(&unsubscribe_lock);
+}
+
+static void wait_unsubscribe(void)
+{
+    (void)SleepConditionVariableSRW(&unsubscribe_condition, &unsubscribe_lock, INFINITE, 0);
+}
+
+static void wake_unsubscribe(void)
+{
+    WakeAllConditionVariable(&unsubscribe_condition);
+}
+#else
+static pthread_mutex_t unsubscribe_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t unsubscribe_condition = PTHREAD_COND_INITIALIZER;
+
+static void lock_unsubscribe(void)
+{
+    (void)pthread_mutex_lock(&unsubscribe_lock);
+}
+
+static void unlock_unsubscribe(void)
+{
+    (void)pthread_mutex_unlock(&unsubscribe_lock);
+}
+
+static void wait_unsubscribe(void)
+{
+    (void)pthread_cond_wait(&unsubscribe_condition, &unsubscribe_lock);
+}
+
+static void wake_unsubscribe(void)
+{
+    (void)pthread_cond_broadcast(&unsubscribe_condition);
+}
+#endif
+
+static long make_subscriber_word(uint32_t generation, uint32_t level_mask, SUBSCRIBER_STATE state)
+{
+    return (long)(((generation & SUBSCRIBER_GENERATION_MASK) << SUBSCRIBER_GENERATION_SHIFT) | ((level_mask & LOG_SINK_CALLBACK_LEVEL_MASK_ALL) << SUBSCRIBER_STATE_BITS) | (uint32_t)state);
+}
+
+static SUBSCRIBER_STATE get_subscriber_state(long word)
+{
+    return (SUBSCRIBER_STATE)((uint32_t)word & ((UINT32_C(1) << SUBSCRIBER_STATE_BITS) - 1));
+}
+
+static uint32_t get_subscriber_level_mask(long word)
+{
+    return ((uint32_t)word >> SUBSCRIBER_STATE_BITS) & LOG_SINK_CALLBACK_LEVEL_MASK_ALL;
+}
+
+static uint32_t get_subscriber_generation(long word)
+{
+    return ((uint32_t)word >> SUBSCRIBER_GENERATION_SHIFT) & SUBSCRIBER_GENERATION_MASK;
+}
+
+// true if word is the word of the active subscription subscription_id
+static bool is_active_subscription(long word, uint32_t subscription_id)
+{
+    return (get_subscriber_state(word) == SUBSCRIBER_STATE_ACTIVE) &&
+        (get_subscriber_generation(word) == ((subscription_id / LOG_SINK_CALLBACK_MAX_SUBSCRIBERS) & SUBSCRIBER_GENERATION_MASK));
+}
+
+// the built-in line is used until a layout is set
+static LOG_LAYOUT log_sink_callback_layout;
+static bool log_sink_callback_has_layout = false;
+
 static int log_sink_callback_init(void)
 {
     /* Codes_SRS_LOG_SINK_CALLBACK_42_001: [ log_sink_callback.init shall return 0. ]*/
@@ -70,106 +264,514 @@ void log_sink_callback_set_max_level(LOG_LEVEL log_level)
     log_sink_callback_max_level = log_level;
 }
 
-static void log_sink_callback_log(LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context, const char* file, const char* func, int line, const char* message_format, va_list args)
+void log_sink_callback_set_record_callback(LOG_SINK_CALLBACK_LOG_RECORD log_record_callback, void* context)
+{
+    /*Codes_SRS_LOG_SINK_CALLBACK_01_011: [ log_sink_callback_set_record_callback shall store log_record_callback and context so that they are used by all future calls to log_sink_callback.log (NULL removes the record callback). ]*/
+    log_sink_callback_record_callback = log_record_callback;
+    log_sink_callback_record_context = context;
+}
+
+const char* log_sink_callback_record_get_message(const LOG_SINK_CALLBACK_RECORD* record)
 {
+    const char* result;
 
-    if (message_format == NULL)
+    if (record == NULL)
     {
-        /* Codes_SRS_LOG_SINK_CALLBACK_42_006: [ If message_format is NULL, log_sink_callback.log shall call the log_callback with an error message and return. ]*/
-        log_sink_callback_callback(log_sink_callback_context, LOG_LEVEL_CRITICAL, error_string_invalid_args);
+        /*Codes_SRS_LOG_SINK_CALLBACK_01_018: [ If record is NULL, log_sink_callback_record_get_message shall fail and return NULL. ]*/
+        (void)printf("Invalid arguments: const LOG_SINK_CALLBACK_RECORD* record=%p\r\n", (void*)record);
+        result = NULL;
     }
     else
     {
-        if (log_level > log_sink_callback_max_level)
+        LOG_SINK_CALLBACK_RECORD_MESSAGE* message = record->message;
+
+        if (!message->formatted)
         {
-            /* Codes_SRS_LOG_SINK_CALLBACK_42_020: [ If log_level is greater than the maximum level set by log_sink_callback_set_max_level, then log_sink_callback.log shall return without calling the log_callback. ]*/
+            va_list args;
+
+            /*Codes_SRS_LOG_SINK_CALLBACK_01_019: [ On the first call for record, log_sink_callback_record_get_message shall format the message by calling log_vsnprintf_cached with the message format and arguments of the event. ]*/
+            va_copy(args, message->args);
+            /*Codes_SRS_LOG_SINK_CALLBACK_01_021: [ If formatting the message fails, log_sink_callback_record_get_message shall return NULL. ]*/
+            message->text = (log_vsnprintf_cached(message->buffer, sizeof(message->buffer), message->message_format, args) < 0) ? NULL : message->buffer;
+            va_end(args);
+            message->formatted = true;
+        }
+
+        /*Codes_SRS_LOG_SINK_CALLBACK_01_020: [ log_sink_callback_record_get_message shall return the formatted message (later calls for the same record return it without formatting again). ]*/
+        result = message->text;
+    }
+
+    return result;
+}
+
+int log_sink_callback_subscribe(LOG_SINK_CALLBACK_LOG log_callback, LOG_SINK_CALLBACK_LOG_RECORD log_record_callback, void* context, uint32_t level_mask, uint32_t* subscription_id)
+{
+    int result;
+
+    if (
+        /*Codes_SRS_LOG_SINK_CALLBACK_01_024: [ If both log_callback and log_record_callback are NULL, log_sink_callback_subscribe shall fail and return a non-zero value. ]*/
+        ((log_callback == NULL) && (log_record_callback == NULL)) ||
+        /*Codes_SRS_LOG_SINK_CALLBACK_01_025: [ If subscription_id is NULL, log_sink_callback_subscribe shall fail and return a non-zero value. ]*/
+        (subscription_id == NULL)
+        )
+    {
+        (void)printf("Invalid arguments: LOG_SINK_CALLBACK_LOG log_callback=%p, LOG_SINK_CALLBACK_LOG_RECORD log_record_callback=%p, void* context=%p, uint32_t level_mask=%" PRIu32 ", uint32_t* subscription_id=%p\r\n",
+            log_callback, log_record_callback, context, level_mask, (void*)subscription_id);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        uint32_t i;
+
+        /*Codes_SRS_LOG_SINK_CALLBACK_01_026: [ log_sink_callback_subscribe shall claim a free subscriber slot without taking a lock. ]*/
+        for (i = 0; i < LOG_SINK_CALLBACK_MAX_SUBSCRIBERS; i++)
+        {
+            long word = atomic_load_long(&subscribers[i].word);
+            SUBSCRIBER_STATE state = get_subscriber_state(word);
+
+            if (((state == SUBSCRIBER_STATE_INVALID) || (state == SUBSCRIBER_STATE_FREE)) &&
+                atomic_compare_exchange_long(&subscribers[i].word, word, make_subscriber_word(get_subscriber_generation(word), 0, SUBSCRIBER_STATE_SUBSCRIBING)))
+            {
+                break;
+            }
+        }
+
+        if (i == LOG_SINK_CALLBACK_MAX_SUBSCRIBERS)
+        {
+            /*Codes_SRS_LOG_SINK_CALLBACK_01_027: [ If LOG_SINK_CALLBACK_MAX_SUBSCRIBERS subscribers are already subscribed, log_sink_callback_subscribe shall fail and return a non-zero value. ]*/
+            (void)printf("All %" PRIu32 " subscriber slots are in use\r\n", (uint32_t)LOG_SINK_CALLBACK_MAX_SUBSCRIBERS);
+            result = MU_FAILURE;
         }
         else
         {
-            /* Codes_SRS_LOG_SINK_CALLBACK_42_016: [ log_sink_callback.log shall include at most LOG_MAX_MESSAGE_LENGTH characters including the null terminator in the callback argument (the rest of the context shall be truncated). ]*/
-            char temp[LOG_MAX_MESSAGE_LENGTH];
-            char* buffer = temp;
-            size_t buffer_size = sizeof(temp);
-
-            /* Codes_SRS_LOG_SINK_CALLBACK_42_007: [ log_sink_callback.log shall obtain the time by calling time. ]*/
-            time_t t = time(NULL);
-            /* Codes_SRS_LOG_SINK_CALLBACK_42_008: [ log_sink_callback.log shall write the time to string by calling ctime. ]*/
-            /* Codes_SRS_LOG_SINK_CALLBACK_42_010: [ If the call to time fails then log_sink_callback.log shall format the time as NULL. ]*/
-            char* ctime_result = (t == (time_t)-1) ? NULL : ctime(&t);
-
-            /* Codes_SRS_LOG_SINK_CALLBACK_42_009: [ log_sink_callback.log shall create a line in the format: Time: {formatted time} File:{file}:{line} Func:{func} {optional context information} {formatted message}. ]*/
-            int snprintf_result = snprintf(buffer, buffer_size, "Time:%.24s File:%s:%d Func:%s",
-                /* Codes_SRS_LOG_SINK_CALLBACK_42_011: [ If the call to ctime fails then log_sink_callback.log shall format the time as NULL. ]*/
-                MU_P_OR_NULL(ctime_result),
-                MU_P_OR_NULL(file),
-                line,
-                MU_P_OR_NULL(func));
-            if (snprintf_result < 0)
+            LOG_SINK_CALLBACK_SUBSCRIBER* subscriber = &subscribers[i];
+
+            /*Codes_SRS_LOG_SINK_CALLBACK_01_028: [ log_sink_callback_subscribe shall store log_callback, log_record_callback, context and level_mask in the slot, and make the subscriber visible to log_sink_callback.log only once they are stored. ]*/
+            subscriber->log_callback = log_callback;
+            subscriber->log_record_callback = log_record_callback;
+            subscriber->context = context;
+            // the generation tells a subscription apart from a later one that reuses the slot
+            uint32_t generation = (uint32_t)atomic_increment_long(&subscription_sequence) & SUBSCRIBER_GENERATION_MASK;
+            atomic_store_long(&subscriber->word, make_subscriber_word(generation, level_mask, SUBSCRIBER_STATE_ACTIVE));
+
+            /*Codes_SRS_LOG_SINK_CALLBACK_01_029: [ log_sink_callback_subscribe shall write the id of the subscription in subscription_id and return 0. ]*/
+            *subscription_id = (generation * LOG_SINK_CALLBACK_MAX_SUBSCRIBERS) + i;
+            result = 0;
+        }
+    }
+
+    return result;
+}
+
+int log_sink_callback_unsubscribe(uint32_t subscription_id)
+{
+    int result;
+    LOG_SINK_CALLBACK_SUBSCRIBER* subscriber = &subscribers[subscription_id % LOG_SINK_CALLBACK_MAX_SUBSCRIBERS];
+    long word = atomic_load_long(&subscriber->word);
+
+    // the id and the state are checked and the state is changed by the same compare-exchange
+    while (is_active_subscription(word, subscription_id) &&
+        !atomic_compare_exchange_long(&subscriber->word, word, make_subscriber_word(get_subscriber_generation(word), 0, SUBSCRIBER_STATE_UNSUBSCRIBING)))
+    {
+        // the level mask was changed meanwhile
+        word = atomic_load_long(&subscriber->word);
+    }
+
+    if (!is_active_subscription(word, subscription_id))
+    {
+        /*Codes_SRS_LOG_SINK_CALLBACK_01_030: [ If subscription_id is not the id of an active subscription, log_sink_callback_unsubscribe shall fail and return a non-zero value. ]*/
+        (void)printf("Invalid arguments: uint32_t subscription_id=%" PRIu32 " is not subscribed\r\n", subscription_id);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /*Codes_SRS_LOG_SINK_CALLBACK_01_031: [ log_sink_callback_unsubscribe shall stop log_sink_callback.log from calling the callbacks of the subscription and wait (sleeping, not spinning) for the calls already in progress to return. ]*/
+        // the count is checked under the lock that the last call takes to wake this thread, so the wake up cannot be missed
+        lock_unsubscribe();
+        while (atomic_load_long(&subscriber->call_count) != 0)
+        {
+            wait_unsubscribe();
+        }
+        unlock_unsubscribe();
+
+        /*Codes_SRS_LOG_SINK_CALLBACK_01_032: [ log_sink_callback_unsubscribe shall free the slot and return 0. ]*/
+        atomic_store_long(&subscriber->word, make_subscriber_word(get_subscriber_generation(word), 0, SUBSCRIBER_STATE_FREE));
+        result = 0;
+    }
+
+    return result;
+}
+
+int log_sink_callback_set_subscriber_level_mask(uint32_t subscription_id, uint32_t level_mask)
+{
+    int result;
+    LOG_SINK_CALLBACK_SUBSCRIBER* subscriber = &subscribers[subscription_id % LOG_SINK_CALLBACK_MAX_SUBSCRIBERS];
+    long word = atomic_load_long(&subscriber->word);
+
+    // the id and the state are checked and the mask is changed by the same compare-exchange
+    while (is_active_subscription(word, subscription_id) &&
+        !atomic_compare_exchange_long(&subscriber->word, word, make_subscriber_word(get_subscriber_generation(word), level_mask, SUBSCRIBER_STATE_ACTIVE)))
+    {
+        word = atomic_load_long(&subscriber->word);
+    }
+
+    if (!is_active_subscription(word, subscription_id))
+    {
+        /*Codes_SRS_LOG_SINK_CALLBACK_01_033: [ If subscription_id is not the id of an active subscription, log_sink_callback_set_subscriber_level_mask shall fail and return a non-zero value. ]*/
+        (void)printf("Invalid arguments: uint32_t subscription_id=%" PRIu32 " is not subscribed, uint32_t level_mask=%" PRIu32 "\r\n", subscription_id, level_mask);
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /*Codes_SRS_LOG_SINK_CALLBACK_01_038: [ log_sink_callback_set_subscriber_level_mask shall store level_mask so that it is used by all future calls to log_sink_callback.log and return 0. ]*/
+        result = 0;
+    }
+
+    return result;
+}
+
+int log_sink_callback_set_layout(const char* pattern)
+{
+    int result;
+
+    if (pattern == NULL)
+    {
+        /*Codes_SRS_LOG_SINK_CALLBACK_01_002: [ If pattern is NULL, log_sink_callback_set_layout shall go back to the built-in line format and return 0. ]*/
+        log_sink_callback_has_layout = false;
+        result = 0;
+    }
+    else
+    {
+        LOG_LAYOUT new_layout;
+
+        /*Codes_SRS_LOG_SINK_CALLBACK_01_003: [ Otherwise log_sink_callback_set_layout shall compile pattern by calling log_layout_compile. ]*/
+        if (log_layout_compile(&new_layout, pattern) != 0)
+        {
+            /*Codes_SRS_LOG_SINK_CALLBACK_01_004: [ If log_layout_compile fails, log_sink_callback_set_layout shall fail and return a non-zero value (the layout in use is not changed). ]*/
+            (void)printf("log_layout_compile failed for pattern %s\r\n", pattern);
+            result = MU_FAILURE;
+        }
+        else
+        {
+            /*Codes_SRS_LOG_SINK_CALLBACK_01_005: [ log_sink_callback_set_layout shall store the compiled layout so that it is used by all future calls to log_sink_callback.log and return 0. ]*/
+            log_sink_callback_layout = new_layout;
+            log_sink_callback_has_layout = true;
+            result = 0;
+        }
+    }
+
+    return result;
+}
+
+// level_bit is LOG_SINK_CALLBACK_LEVEL_MASK_ALL for the invalid arguments error, so that all the subscribers get it
+static bool wants_level(long word, uint32_t level_bit)
+{
+    return (get_subscriber_state(word) == SUBSCRIBER_STATE_ACTIVE) && ((get_subscriber_level_mask(word) & level_bit) != 0);
+}
+
+static void leave_subscriber(LOG_SINK_CALLBACK_SUBSCRIBER* subscriber)
+{
+    // the state is read after the count, so the last call of a subscriber that log_sink_callback_unsubscribe waits for sees UNSUBSCRIBING
+    if ((atomic_decrement_long(&subscriber->call_count) == 0) &&
+        (get_subscriber_state(atomic_load_long(&subscriber->word)) == SUBSCRIBER_STATE_UNSUBSCRIBING))
+    {
+        lock_unsubscribe();
+        wake_unsubscribe();
+        unlock_unsubscribe();
+    }
+}
+
+static bool enter_subscriber(LOG_SINK_CALLBACK_SUBSCRIBER* subscriber, uint32_t level_bit)
+{
+    bool result;
+
+    if (!wants_level(atomic_load_long(&subscriber->word), level_bit))
+    {
+        result = false;
+    }
+    else
+    {
+        // the state and the mask are checked again once the call is counted, log_sink_callback_unsubscribe waits for the counted calls
+        atomic_increment_long(&subscriber->call_count);
+        if (!wants_level(atomic_load_long(&subscriber->word), level_bit))
+        {
+            leave_subscriber(subscriber);
+            result = false;
+        }
+        else
+        {
+            result = true;
+        }
+    }
+
+    return result;
+}
+
+static void get_subscribers_for_level(uint32_t level_bit, bool* has_line_subscribers, bool* has_record_subscribers)
+{
+    *has_line_subscribers = false;
+    *has_record_subscribers = false;
+
+    for (uint32_t i = 0; i < LOG_SINK_CALLBACK_MAX_SUBSCRIBERS; i++)
+    {
+        LOG_SINK_CALLBACK_SUBSCRIBER* subscriber = &subscribers[i];
+        if (enter_subscriber(subscriber, level_bit))
+        {
+            *has_line_subscribers |= (subscriber->log_callback != NULL);
+            *has_record_subscribers |= (subscriber->log_record_callback != NULL);
+            leave_subscriber(subscriber);
+        }
+    }
+}
+
+// message is kept by the caller, so that the line can reuse the message if a callback formatted it
+static void call_record_callbacks(bool call_record_callback, uint32_t level_bit, LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context, const char* file, const char* func, int line, LOG_SINK_CALLBACK_RECORD_MESSAGE* message)
+{
+    LOG_SINK_CALLBACK_RECORD record;
+
+    /* Codes_SRS_LOG_SINK_CALLBACK_01_013: [ log_sink_callback.log shall obtain the time of the record by calling log_timestamp_now. ]*/
+    record.time = log_timestamp_now();
+    record.log_level = log_level;
+    record.file = file;
+    record.func = func;
+    record.line = line;
+
+    if (log_context == NULL)
+    {
+        record.property_value_pairs = NULL;
+        record.property_value_pair_count = 0;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_SINK_CALLBACK_01_014: [ If log_context is not NULL, log_sink_callback.log shall obtain the properties of the record by calling log_context_get_property_value_pair_count and log_context_get_property_value_pairs. ]*/
+        record.property_value_pair_count = log_context_get_property_value_pair_count(log_context);
+        record.property_value_pairs = log_context_get_property_value_pairs(log_context);
+    }
+
+    record.message = message;
+
+    if (call_record_callback)
+    {
+        /* Codes_SRS_LOG_SINK_CALLBACK_01_016: [ log_sink_callback.log shall call the record callback with its context and the record. ]*/
+        log_sink_callback_record_callback(log_sink_callback_record_context, &record);
+    }
+
+    for (uint32_t i = 0; i < LOG_SINK_CALLBACK_MAX_SUBSCRIBERS; i++)
+    {
+        LOG_SINK_CALLBACK_SUBSCRIBER* subscriber = &subscribers[i];
+        if (enter_subscriber(subscriber, level_bit))
+        {
+            if (subscriber->log_record_callback != NULL)
             {
-                /* Codes_SRS_LOG_SINK_CALLBACK_42_017: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_sink_callback.log shall call the log_callback with Error formatting log line and return. ]*/
-                log_sink_callback_callback(log_sink_callback_context, LOG_LEVEL_CRITICAL, error_string);
+                /* Codes_SRS_LOG_SINK_CALLBACK_01_034: [ log_sink_callback.log shall call the log_record_callback of each subscriber whose level_mask has the bit of log_level with the same record (the message is formatted at most once for all of them). ]*/
+                subscriber->log_record_callback(subscriber->context, &record);
             }
-            else
+            leave_subscriber(subscriber);
+        }
+    }
+}
+
+static void call_line_callbacks(bool call_log_callback, uint32_t level_bit, LOG_LEVEL log_level, const char* text)
+{
+    if (call_log_callback)
+    {
+        log_sink_callback_callback(log_sink_callback_context, log_level, text);
+    }
+
+    for (uint32_t i = 0; i < LOG_SINK_CALLBACK_MAX_SUBSCRIBERS; i++)
+    {
+        LOG_SINK_CALLBACK_SUBSCRIBER* subscriber = &subscribers[i];
+        if (enter_subscriber(subscriber, level_bit))
+        {
+            if (subscriber->log_callback != NULL)
+            {
+                /* Codes_SRS_LOG_SINK_CALLBACK_01_035: [ log_sink_callback.log shall call the log_callback of each subscriber whose level_mask has the bit of log_level with the same line (the line is built at most once for all of them). ]*/
+                subscriber->log_callback(subscriber->context, log_level, text);
+            }
+            leave_subscriber(subscriber);
+        }
+    }
+}
+
+static int format_line(char* temp, size_t temp_size, LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context, const char* file, const char* func, int line, const char* message_format, va_list args)
+{
+    int result;
+
+    if (log_sink_callback_has_layout)
+    {
+        /* Codes_SRS_LOG_SINK_CALLBACK_01_006: [ If a layout was set, log_sink_callback.log shall format the line by calling log_layout_format with the layout instead of using the built-in line format. ]*/
+        result = (log_layout_format(&log_sink_callback_layout, temp, temp_size, log_level, log_context, file, func, line, message_format, args) < 0) ? MU_FAILURE : 0;
+    }
+    else
+    {
+        char* buffer = temp;
+        size_t buffer_size = temp_size;
+
+        /* Codes_SRS_LOG_SINK_CALLBACK_01_007: [ log_sink_callback.log shall obtain the time by calling log_timestamp_now. ]*/
+        int64_t now = log_timestamp_now();
+        char time_string[TIMESTAMP_MICROSECONDS_TO_STRING_LENGTH + 1];
+        /* Codes_SRS_LOG_SINK_CALLBACK_01_008: [ log_sink_callback.log shall write the time to string by calling timestamp_microseconds_to_string. ]*/
+        /* Codes_SRS_LOG_SINK_CALLBACK_01_009: [ If the call to log_timestamp_now fails then log_sink_callback.log shall format the time as NULL. ]*/
+        /* Codes_SRS_LOG_SINK_CALLBACK_01_010: [ If the call to timestamp_microseconds_to_string fails then log_sink_callback.log shall format the time as NULL. ]*/
+        const char* time_result = ((now == LOG_TIMESTAMP_INVALID) || (timestamp_microseconds_to_string(now, time_string, sizeof(time_string)) < 0)) ? NULL : time_string;
+
+        /* Codes_SRS_LOG_SINK_CALLBACK_42_009: [ log_sink_callback.log shall create a line in the format: Time: {formatted time} File:{file}:{line} Func:{func} {optional context information} {formatted message}. ]*/
+        int snprintf_result = snprintf(buffer, buffer_size, "Time:%s File:%s:%d Func:%s",
+            MU_P_OR_NULL(time_result),
+            MU_P_OR_NULL(file),
+            line,
+            MU_P_OR_NULL(func));
+        if (snprintf_result < 0)
+        {
+            result = MU_FAILURE;
+        }
+        else
+        {
+            bool error = false;
+
+            snprintf_result = MIN(snprintf_result, (int)buffer_size);
+            buffer += snprintf_result;
+            buffer_size -= snprintf_result;
+
+            /* Codes_SRS_LOG_SINK_CALLBACK_42_012: [ If log_context is non-NULL: ]*/
+            if (log_context != NULL)
             {
-                bool error = false;
+                /* Codes_SRS_LOG_SINK_CALLBACK_42_013: [ log_sink_callback.log shall call log_context_get_property_value_pair_count to obtain the count of properties. ]*/
+                size_t property_value_pair_count = log_context_get_property_value_pair_count(log_context);
+                /* Codes_SRS_LOG_SINK_CALLBACK_42_014: [ log_sink_callback.log shall call log_context_get_property_value_pairs to obtain the properties. ]*/
+                const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(log_context);
 
-                snprintf_result = MIN(snprintf_result, (int)buffer_size);
-                buffer += snprintf_result;
-                buffer_size -= snprintf_result;
+                /* Codes_SRS_LOG_SINK_CALLBACK_42_015: [ log_sink_callback.log shall call log_context_property_to_string to write the properties to the string buffer. ]*/
+                int log_n_properties_result = log_context_property_to_string(buffer, buffer_size, property_value_pairs, property_value_pair_count); // lgtm[cpp/unguardednullreturndereference] Tests and code review ensure that NULL access cannot happen
+                if (log_n_properties_result < 0)
+                {
+                    error = true;
+                }
+                else
+                {
+                    log_n_properties_result = MIN(log_n_properties_result, (int)buffer_size);
+                    buffer += log_n_properties_result;
+                    buffer_size -= log_n_properties_result;
+                }
+            }
 
-                /* Codes_SRS_LOG_SINK_CALLBACK_42_012: [ If log_context is non-NULL: ]*/
-                if (log_context != NULL)
+            if (!error)
+            {
+                if (buffer_size > 1)
                 {
-                    /* Codes_SRS_LOG_SINK_CALLBACK_42_013: [ log_sink_callback.log shall call log_context_get_property_value_pair_count to obtain the count of properties. ]*/
-                    size_t property_value_pair_count = log_context_get_property_value_pair_count(log_context);
-                    /* Codes_SRS_LOG_SINK_CALLBACK_42_014: [ log_sink_callback.log shall call log_context_get_property_value_pairs to obtain the properties. ]*/
-                    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(log_context);
-
-                    /* Codes_SRS_LOG_SINK_CALLBACK_42_015: [ log_sink_callback.log shall call log_context_property_to_string to write the properties to the string buffer. ]*/
-                    int log_n_properties_result = log_context_property_to_string(buffer, buffer_size, property_value_pairs, property_value_pair_count); // lgtm[cpp/unguardednullreturndereference] Tests and code review ensure that NULL access cannot happen
-                    if (log_n_properties_result < 0)
+                    *buffer = ' ';
+                    buffer++;
+                    buffer_size--;
+
+                    /* Codes_SRS_LOG_SINK_CALLBACK_01_001: [ log_sink_callback.log shall format the message by calling log_vsnprintf_cached. ]*/
+                    int vsnprintf_result = log_vsnprintf_cached(buffer, buffer_size, message_format, args);
+                    if (vsnprintf_result < 0)
                     {
-                        /* Codes_SRS_LOG_SINK_CALLBACK_42_017: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_sink_callback.log shall call the log_callback with Error formatting log line and return. ]*/
                         error = true;
                     }
                     else
                     {
-                        log_n_properties_result = MIN(log_n_properties_result, (int)buffer_size);
-                        buffer += log_n_properties_result;
-                        buffer_size -= log_n_properties_result;
+                        // all ok
                     }
                 }
+            }
 
-                if (!error)
-                {
-                    if (buffer_size > 1)
-                    {
-                        *buffer = ' ';
-                        buffer++;
-                        buffer_size--;
-
-                        int vsnprintf_result = vsnprintf(buffer, buffer_size, message_format, args);
-                        if (vsnprintf_result < 0)
-                        {
-                            /* Codes_SRS_LOG_SINK_CALLBACK_42_017: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_sink_callback.log shall call the log_callback with Error formatting log line and return. ]*/
-                            error = true;
-                        }
-                        else
-                        {
-                            // all ok
-                        }
-                    }
-                }
+            result = error ? MU_FAILURE : 0;
+        }
+    }
 
-                if (error)
-                {
-                    log_sink_callback_callback(log_sink_callback_context, LOG_LEVEL_CRITICAL, error_string);
-                }
-                else
-                {
-                    /* Codes_SRS_LOG_SINK_CALLBACK_42_018: [ log_sink_callback.log shall call log_callback with its context, log_level, and the formatted message. ]*/
-                    log_sink_callback_callback(log_sink_callback_context, log_level, temp);
-                }
+    return result;
+}
+
+// builds the line for a message that was already formatted for the record callbacks
+static int format_line_with_message_text(char* temp, size_t temp_size, LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context, const char* file, const char* func, int line, const char* message_format, ...)
+{
+    int result;
+    va_list args;
+
+    va_start(args, message_format);
+    result = format_line(temp, temp_size, log_level, log_context, file, func, line, message_format, args);
+    va_end(args);
+
+    return result;
+}
+
+static void log_sink_callback_log(LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context, const char* file, const char* func, int line, const char* message_format, va_list args)
+{
+    bool has_line_subscribers;
+    bool has_record_subscribers;
+
+    if (message_format == NULL)
+    {
+        /* Codes_SRS_LOG_SINK_CALLBACK_01_036: [ If message_format is NULL, log_sink_callback.log shall give the error to all the subscribers regardless of their level_mask. ]*/
+        get_subscribers_for_level(LOG_SINK_CALLBACK_LEVEL_MASK_ALL, &has_line_subscribers, &has_record_subscribers);
+
+        if ((log_sink_callback_record_callback != NULL) || has_record_subscribers)
+        {
+            LOG_SINK_CALLBACK_RECORD_MESSAGE message;
+
+            /* Codes_SRS_LOG_SINK_CALLBACK_01_017: [ If message_format is NULL and a record callback is set, log_sink_callback.log shall call the record callback with a LOG_LEVEL_CRITICAL record whose message is the error message. ]*/
+            message.message_format = NULL;
+            message.formatted = true;
+            message.text = error_string_invalid_args;
+            call_record_callbacks(log_sink_callback_record_callback != NULL, LOG_SINK_CALLBACK_LEVEL_MASK_ALL, LOG_LEVEL_CRITICAL, NULL, file, func, line, &message);
+        }
+
+        /* Codes_SRS_LOG_SINK_CALLBACK_42_006: [ If message_format is NULL, log_sink_callback.log shall call the log_callback with an error message and return. ]*/
+        call_line_callbacks(true, LOG_SINK_CALLBACK_LEVEL_MASK_ALL, LOG_LEVEL_CRITICAL, error_string_invalid_args);
+    }
+    else
+    {
+        /* Codes_SRS_LOG_SINK_CALLBACK_42_020: [ If log_level is greater than the maximum level set by log_sink_callback_set_max_level, then log_sink_callback.log shall return without calling the log_callback. ]*/
+        /* Codes_SRS_LOG_SINK_CALLBACK_01_023: [ If log_level is greater than the maximum level set by log_sink_callback_set_max_level, then log_sink_callback.log shall not call the record callback. ]*/
+        bool level_enabled = (log_level <= log_sink_callback_max_level);
+        bool call_record_callback = level_enabled && (log_sink_callback_record_callback != NULL);
+        /* Codes_SRS_LOG_SINK_CALLBACK_01_022: [ If the log_callback is log_sink_callback_noop_callback, log_sink_callback.log shall not build the line. ]*/
+        bool call_log_callback = level_enabled && (log_sink_callback_callback != log_sink_callback_noop_callback);
+        uint32_t level_bit = LOG_SINK_CALLBACK_LEVEL_MASK(log_level);
+        LOG_SINK_CALLBACK_RECORD_MESSAGE message;
+
+        message.message_format = message_format;
+        message.formatted = false;
+        message.text = NULL;
+
+        /* Codes_SRS_LOG_SINK_CALLBACK_01_037: [ The maximum level set by log_sink_callback_set_max_level shall not apply to the subscribers. ]*/
+        get_subscribers_for_level(level_bit, &has_line_subscribers, &has_record_subscribers);
+
+        if (call_record_callback || has_record_subscribers)
+        {
+            /* Codes_SRS_LOG_SINK_CALLBACK_01_015: [ log_sink_callback.log shall not format the message before calling the record callback, it shall keep a copy of the arguments for log_sink_callback_record_get_message. ]*/
+            va_copy(message.args, args);
+            /* Codes_SRS_LOG_SINK_CALLBACK_01_012: [ If a record callback is set, log_sink_callback.log shall call it before the log_callback. ]*/
+            call_record_callbacks(call_record_callback, level_bit, log_level, log_context, file, func, line, &message);
+            va_end(message.args);
+        }
+
+        if (call_log_callback || has_line_subscribers)
+        {
+            /* Codes_SRS_LOG_SINK_CALLBACK_42_016: [ log_sink_callback.log shall include at most LOG_MAX_MESSAGE_LENGTH characters including the null terminator in the callback argument (the rest of the context shall be truncated). ]*/
+            char temp[LOG_MAX_MESSAGE_LENGTH];
+            int format_result;
+
+            if (message.formatted && (message.text != NULL))
+            {
+                /* Codes_SRS_LOG_SINK_CALLBACK_01_039: [ If a record callback already formatted the message, log_sink_callback.log shall build the line with that message instead of formatting message_format again. ]*/
+                format_result = format_line_with_message_text(temp, sizeof(temp), log_level, log_context, file, func, line, "%s", message.text);
+            }
+            else
+            {
+                format_result = format_line(temp, sizeof(temp), log_level, log_context, file, func, line, message_format, args);
+            }
+
+            if (format_result != 0)
+            {
+                /* Codes_SRS_LOG_SINK_CALLBACK_42_017: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_sink_callback.log shall call the log_callback with Error formatting log line and return. ]*/
+                call_line_callbacks(call_log_callback, level_bit, LOG_LEVEL_CRITICAL, error_string);
+            }
+            else
+            {
+                /* Codes_SRS_LOG_SINK_CALLBACK_42_018: [ log_sink_callback.log shall call log_callback with its context, log_level, and the formatted message. ]*/
+                call_line_callbacks(call_log_callback, level_bit, log_level, temp);
             }
         }
     }
@@ -1,10 +1,23 @@
 // Copyright (c) Microsoft. All rights reserved.
 // Licensed under the MIT license. See LICENSE file in the project root for full license information.
 
+#include <errno.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdarg.h>
-#include <time.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <io.h>
+#include "windows.h"
+#else
+#include <pthread.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
 
 #include "macro_utils/macro_utils.h"
 
@@ -12,8 +25,12 @@
 #include "c_logging/log_context.h"
 #include "c_logging/log_context_property_to_string.h"
 #include "c_logging/log_context_property_value_pair.h"
+#include "c_logging/log_layout.h"
+#include "c_logging/log_printf.h"
 #include "c_logging/log_sink_if.h"
+#include "c_logging/log_timestamp.h"
 #include "c_logging/logger.h"
+#include "c_logging/time_to_string.h"
 
 #include "c_logging/log_sink_console.h" // IWYU pragma: keep
 
@@ -31,6 +48,11 @@
 #define LOG_SINK_CONSOLE_ANSI_COLOR_GRAY            "\x1b[90m"
 #define LOG_SINK_CONSOLE_ANSI_COLOR_RESET           "\x1b[0m"
 
+#define LINE_END "\r\n"
+#define COLOR_LINE_END LOG_SINK_CONSOLE_ANSI_COLOR_RESET LINE_END
+
+MU_DEFINE_ENUM_STRINGS(LOG_SINK_CONSOLE_OUTPUT, LOG_SINK_CONSOLE_OUTPUT_VALUES)
+
 static const char* level_colors[] =
 {
     LOG_SINK_CONSOLE_ANSI_COLOR_BRIGHT_RED,     // LOG_LEVEL_CRITICAL
@@ -40,7 +62,217 @@ static const char* level_colors[] =
     LOG_SINK_CONSOLE_ANSI_COLOR_GRAY,           // LOG_LEVEL_VERBOSE
 };
 
-static const char error_string[] = "Error formatting log line\r\n";
+static const char error_string[] = "Error formatting log line";
+
+// the built-in line is used until a layout is set
+static LOG_LAYOUT log_sink_console_layout;
+static bool log_sink_console_has_layout = false;
+
+static LOG_SINK_CONSOLE_OUTPUT log_sink_console_output = LOG_SINK_CONSOLE_OUTPUT_PRINTF;
+// false when the direct output does not go to a terminal
+static bool log_sink_console_colors = true;
+
+// lines collected by the direct output when it does not go to a terminal, guarded by batch_lock
+static char batch[LOG_SINK_CONSOLE_BATCH_SIZE];
+static size_t batch_length;
+static int64_t batch_start_time;
+static bool flush_at_exit_registered = false;
+
+// the lock is held while copying a line or writing the batch, so a write that blocks (a full pipe) makes the other
+// logging threads sleep instead of spinning
+#ifdef _WIN32
+static SRWLOCK batch_lock = SRWLOCK_INIT;
+
+static void lock_batch(void)
+{
+    AcquireSRWLockExclusive(&batch_lock);
+}
+
+static void unlock_batch(void)
+{
+    ReleaseSRWLockExclusive(&batch_lock);
+}
+#else
+static pthread_mutex_t batch_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void lock_batch(void)
+{
+    (void)pthread_mutex_lock(&batch_lock);
+}
+
+static void unlock_batch(void)
+{
+    (void)pthread_mutex_unlock(&batch_lock);
+}
+#endif
+
+#ifdef _WIN32
+static bool stdout_is_terminal(void)
+{
+    return (_isatty(_fileno(stdout)) != 0);
+}
+
+static void write_all(const char* data, size_t length)
+{
+    int fd = _fileno(stdout);
+
+    while (length > 0)
+    {
+        int written = _write(fd, data, (unsigned int)length);
+        if (written <= 0)
+        {
+            // nowhere to report it
+            break;
+        }
+        data += written;
+        length -= (size_t)written;
+    }
+}
+
+// there is no writev, both parts end with a complete line
+static void write_all_2(const char* first, size_t first_length, const char* second, size_t second_length)
+{
+    write_all(first, first_length);
+    write_all(second, second_length);
+}
+#else
+static bool stdout_is_terminal(void)
+{
+    return (isatty(STDOUT_FILENO) != 0);
+}
+
+static void write_all(const char* data, size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t written = write(STDOUT_FILENO, data, length);
+        if (written < 0)
+        {
+            if (errno != EINTR)
+            {
+                // nowhere to report it
+                break;
+            }
+        }
+        else
+        {
+            data += written;
+            length -= (size_t)written;
+        }
+    }
+}
+
+static void write_all_2(const char* first, size_t first_length, const char* second, size_t second_length)
+{
+    struct iovec parts[2] = { { (void*)first, first_length }, { (void*)second, second_length } };
+    int part = 0;
+
+    while (part < 2)
+    {
+        if (parts[part].iov_len == 0)
+        {
+            part++;
+        }
+        else
+        {
+            ssize_t written = writev(STDOUT_FILENO, &parts[part], 2 - part);
+            if (written < 0)
+            {
+                if (errno != EINTR)
+                {
+                    // nowhere to report it
+                    break;
+                }
+            }
+            else
+            {
+                size_t remaining = (size_t)written;
+                while ((part < 2) && (remaining >= parts[part].iov_len))
+                {
+                    remaining -= parts[part].iov_len;
+                    part++;
+                }
+                if (part < 2)
+                {
+                    parts[part].iov_base = (char*)parts[part].iov_base + remaining;
+                    parts[part].iov_len -= remaining;
+                }
+            }
+        }
+    }
+}
+#endif
+
+static void write_batched_line(LOG_LEVEL log_level, const char* line, size_t line_length)
+{
+    int64_t now = log_timestamp_ticks_to_ns(log_timestamp_ticks());
+
+    lock_batch();
+
+    if (batch_length + line_length > sizeof(batch))
+    {
+        /* Codes_SRS_LOG_SINK_CONSOLE_01_045: [ If the line does not fit in the batch, log_sink_console.log shall write the batched lines and the line with one call to writev. ]*/
+        write_all_2(batch, batch_length, line, line_length);
+        batch_length = 0;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_SINK_CONSOLE_01_044: [ Otherwise log_sink_console.log shall add the line to a batch of LOG_SINK_CONSOLE_BATCH_SIZE bytes. ]*/
+        if (batch_length == 0)
+        {
+            batch_start_time = now;
+        }
+        (void)memcpy(batch + batch_length, line, line_length);
+        batch_length += line_length;
+
+        if ((log_level <= LOG_LEVEL_ERROR) || (now - batch_start_time >= LOG_SINK_CONSOLE_BATCH_TIME_NS))
+        {
+            /* Codes_SRS_LOG_SINK_CONSOLE_01_046: [ If log_level is LOG_LEVEL_ERROR or LOG_LEVEL_CRITICAL, or the first line of the batch was added at least LOG_SINK_CONSOLE_BATCH_TIME_NS ago, log_sink_console.log shall write the batch with one call to write. ]*/
+            write_all(batch, batch_length);
+            batch_length = 0;
+        }
+    }
+
+    unlock_batch();
+}
+
+// line has room for COLOR_LINE_END after length
+static void print_line(LOG_LEVEL log_level, char* line, size_t length)
+{
+    if (log_sink_console_output == LOG_SINK_CONSOLE_OUTPUT_PRINTF)
+    {
+        /* Codes_SRS_LOG_SINK_CONSOLE_01_005: [ In order to not break the line in multiple parts when displayed on the console, log_sink_console.log shall print the line in such a way that only one printf call is made. ]*/
+        /* Codes_SRS_LOG_SINK_CONSOLE_01_012: [ At the end of each line that is printed, the color shall be reset by using the x1b[0m code. ]*/
+        (void)printf("%s%s\r\n", line, LOG_SINK_CONSOLE_ANSI_COLOR_RESET);
+    }
+    else
+    {
+        const char* line_end = log_sink_console_colors ? COLOR_LINE_END : LINE_END;
+        size_t line_end_length = log_sink_console_colors ? sizeof(COLOR_LINE_END) - 1 : sizeof(LINE_END) - 1;
+
+        (void)memcpy(line + length, line_end, line_end_length);
+        length += line_end_length;
+
+        if (log_sink_console_colors)
+        {
+            /* Codes_SRS_LOG_SINK_CONSOLE_01_043: [ If stdout is a terminal, log_sink_console.log shall write the line with its colors with one call to write. ]*/
+            write_all(line, length);
+        }
+        else
+        {
+            write_batched_line(log_level, line, length);
+        }
+    }
+}
+
+static void print_error(LOG_LEVEL log_level)
+{
+    // room for the end of the line after the error text
+    char line[sizeof(error_string) + sizeof(COLOR_LINE_END)];
+
+    (void)memcpy(line, error_string, sizeof(error_string));
+    print_line(log_level, line, sizeof(error_string) - 1);
+}
 
 static int log_sink_console_init(void)
 {
@@ -50,7 +282,126 @@ static int log_sink_console_init(void)
 
 static void log_sink_console_deinit(void)
 {
-    /* Codes_SRS_LOG_SINK_CONSOLE_01_028: [ log_sink_console.deinit shall return. ] */
+    /* Codes_SRS_LOG_SINK_CONSOLE_01_028: [ log_sink_console.deinit shall write the batched lines by calling log_sink_console_flush. ] */
+    log_sink_console_flush();
+}
+
+int log_sink_console_set_output(LOG_SINK_CONSOLE_OUTPUT output)
+{
+    int result;
+
+    if ((output != LOG_SINK_CONSOLE_OUTPUT_PRINTF) && (output != LOG_SINK_CONSOLE_OUTPUT_DIRECT))
+    {
+        /* Codes_SRS_LOG_SINK_CONSOLE_01_039: [ If output is not LOG_SINK_CONSOLE_OUTPUT_PRINTF or LOG_SINK_CONSOLE_OUTPUT_DIRECT, log_sink_console_set_output shall fail and return a non-zero value. ]*/
+        (void)printf("Invalid arguments: LOG_SINK_CONSOLE_OUTPUT output=%" PRI_MU_ENUM "\r\n", MU_ENUM_VALUE(LOG_SINK_CONSOLE_OUTPUT, output));
+        result = MU_FAILURE;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_SINK_CONSOLE_01_040: [ log_sink_console_set_output shall write the batched lines by calling log_sink_console_flush and flush stdout. ]*/
+        log_sink_console_flush();
+        (void)fflush(stdout);
+
+        if (output == LOG_SINK_CONSOLE_OUTPUT_DIRECT)
+        {
+            /* Codes_SRS_LOG_SINK_CONSOLE_01_041: [ If output is LOG_SINK_CONSOLE_OUTPUT_DIRECT, log_sink_console_set_output shall call isatty for stdout to determine whether the lines are colored. ]*/
+            log_sink_console_colors = stdout_is_terminal();
+
+            if (!flush_at_exit_registered)
+            {
+                /* Codes_SRS_LOG_SINK_CONSOLE_01_049: [ The first time output is LOG_SINK_CONSOLE_OUTPUT_DIRECT, log_sink_console_set_output shall register log_sink_console_flush with atexit, so that the batched lines are written when the process exits. ]*/
+                if (atexit(log_sink_console_flush) != 0)
+                {
+                    (void)printf("atexit failed, the batched lines are not written at exit unless log_sink_console_flush is called\r\n");
+                }
+                else
+                {
+                    flush_at_exit_registered = true;
+                }
+            }
+        }
+        else
+        {
+            log_sink_console_colors = true;
+        }
+
+        /* Codes_SRS_LOG_SINK_CONSOLE_01_042: [ log_sink_console_set_output shall store output so that it is used by all future calls to log_sink_console.log and return 0. ]*/
+        log_sink_console_output = output;
+        result = 0;
+    }
+
+    return result;
+}
+
+void log_sink_console_flush(void)
+{
+    lock_batch();
+
+    if (batch_length > 0)
+    {
+        /* Codes_SRS_LOG_SINK_CONSOLE_01_047: [ If there are batched lines, log_sink_console_flush shall write them with one call to write. ]*/
+        write_all(batch, batch_length);
+        batch_length = 0;
+    }
+
+    unlock_batch();
+}
+
+int log_sink_console_set_layout(const char* pattern)
+{
+    int result;
+
+    if (pattern == NULL)
+    {
+        /* Codes_SRS_LOG_SINK_CONSOLE_01_030: [ If pattern is NULL, log_sink_console_set_layout shall go back to the built-in line format and return 0. ]*/
+        log_sink_console_has_layout = false;
+        result = 0;
+    }
+    else
+    {
+        LOG_LAYOUT new_layout;
+
+        /* Codes_SRS_LOG_SINK_CONSOLE_01_031: [ Otherwise log_sink_console_set_layout shall compile pattern by calling log_layout_compile. ]*/
+        if (log_layout_compile(&new_layout, pattern) != 0)
+        {
+            /* Codes_SRS_LOG_SINK_CONSOLE_01_032: [ If log_layout_compile fails, log_sink_console_set_layout shall fail and return a non-zero value (the layout in use is not changed). ]*/
+            (void)printf("log_layout_compile failed for pattern %s\r\n", pattern);
+            result = MU_FAILURE;
+        }
+        else
+        {
+            /* Codes_SRS_LOG_SINK_CONSOLE_01_033: [ log_sink_console_set_layout shall store the compiled layout so that it is used by all future calls to log_sink_console.log and return 0. ]*/
+            log_sink_console_layout = new_layout;
+            log_sink_console_has_layout = true;
+            result = 0;
+        }
+    }
+
+    return result;
+}
+
+static void log_sink_console_log_with_layout(LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context, const char* file, const char* func, int line, const char* message_format, va_list args)
+{
+    // room for the end of the line after LOG_MAX_MESSAGE_LENGTH characters
+    char temp[LOG_MAX_MESSAGE_LENGTH + sizeof(COLOR_LINE_END)];
+    /* Codes_SRS_LOG_SINK_CONSOLE_01_048: [ If the output is LOG_SINK_CONSOLE_OUTPUT_DIRECT and stdout is not a terminal, log_sink_console.log shall not write the color codes. ]*/
+    const char* level_color = log_sink_console_colors ? level_colors[log_level] : "";
+    size_t level_color_length = strlen(level_color);
+    int format_result;
+
+    (void)memcpy(temp, level_color, level_color_length);
+
+    /* Codes_SRS_LOG_SINK_CONSOLE_01_034: [ If a layout was set, log_sink_console.log shall format the line by calling log_layout_format with the layout instead of using the built-in line format. ]*/
+    format_result = log_layout_format(&log_sink_console_layout, temp + level_color_length, LOG_MAX_MESSAGE_LENGTH - level_color_length, log_level, log_context, file, func, line, message_format, args);
+    if (format_result < 0)
+    {
+        /* Codes_SRS_LOG_SINK_CONSOLE_01_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_sink_console.log shall print Error formatting log line and return. ]*/
+        print_error(log_level);
+    }
+    else
+    {
+        print_line(log_level, temp, level_color_length + (size_t)format_result);
+    }
 }
 
 static void log_sink_console_log(LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context, const char* file, const char* func, int line, const char* message_format, va_list args)
@@ -62,33 +413,40 @@ static void log_sink_console_log(LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_con
         (void)printf("Invalid arguments: LOG_LEVEL log_level=%" PRI_MU_ENUM ", LOG_CONTEXT_HANDLE log_context=%p, const char* file=%s, const char* func=%s, int line=%d, const char* message_format=%s\r\n",
             MU_ENUM_VALUE(LOG_LEVEL, log_level), log_context, MU_P_OR_NULL(file), MU_P_OR_NULL(func), line, MU_P_OR_NULL(message_format));
     }
+    else if (log_sink_console_has_layout)
+    {
+        log_sink_console_log_with_layout(log_level, log_context, file, func, line, message_format, args);
+    }
     else
     {
         /* Codes_SRS_LOG_SINK_CONSOLE_01_021: [ log_sink_console.log shall print at most LOG_MAX_MESSAGE_LENGTH characters including the null terminator (the rest of the context shall be truncated). ]*/
-        char temp[LOG_MAX_MESSAGE_LENGTH];
+        // room for the end of the line after LOG_MAX_MESSAGE_LENGTH characters
+        char temp[LOG_MAX_MESSAGE_LENGTH + sizeof(COLOR_LINE_END)];
         char* buffer = temp;
-        size_t buffer_size = sizeof(temp);
+        size_t buffer_size = LOG_MAX_MESSAGE_LENGTH;
 
-        /* Codes_SRS_LOG_SINK_CONSOLE_01_002: [ log_sink_console.log shall obtain the time by calling time. ]*/
-        time_t t = time(NULL);
-        /* Codes_SRS_LOG_SINK_CONSOLE_01_024: [ If the call to ctime fails then log_sink_console.log shall print the time as NULL. ]*/
-        char* ctime_result = (t == (time_t)-1) ? NULL : ctime(&t);
+        /* Codes_SRS_LOG_SINK_CONSOLE_01_035: [ log_sink_console.log shall obtain the time by calling log_timestamp_now. ]*/
+        int64_t now = log_timestamp_now();
+        char time_string[TIMESTAMP_MICROSECONDS_TO_STRING_LENGTH + 1];
+        /* Codes_SRS_LOG_SINK_CONSOLE_01_036: [ log_sink_console.log shall convert the time to string by calling timestamp_microseconds_to_string. ]*/
+        /* Codes_SRS_LOG_SINK_CONSOLE_01_037: [ If the call to log_timestamp_now fails then log_sink_console.log shall print the time as NULL. ]*/
+        /* Codes_SRS_LOG_SINK_CONSOLE_01_038: [ If the call to timestamp_microseconds_to_string fails then log_sink_console.log shall print the time as NULL. ]*/
+        const char* time_result = ((now == LOG_TIMESTAMP_INVALID) || (timestamp_microseconds_to_string(now, time_string, sizeof(time_string)) < 0)) ? NULL : time_string;
 
-        /* Codes_SRS_LOG_SINK_CONSOLE_01_003: [ log_sink_console.log shall convert the time to string by calling ctime. ]*/
         /* Codes_SRS_LOG_SINK_CONSOLE_01_004: [ log_sink_console.log shall print a line in the format: {log_level} Time: {formatted time} File:{file}:{line} Func:{func} {optional context information} {formatted message} ]*/
-        int snprintf_result = snprintf(buffer, buffer_size, "%s%s Time:%.24s File:%s:%d Func:%s",
+        int snprintf_result = snprintf(buffer, buffer_size, "%s%s Time:%s File:%s:%d Func:%s",
             /* Codes_SRS_LOG_SINK_CONSOLE_01_006: [ log_sink_console.log shall color the lines using ANSI color codes (https://en.wikipedia.org/wiki/ANSI_escape_code#Colors), as follows: ]*/
-            level_colors[log_level],
+            /* Codes_SRS_LOG_SINK_CONSOLE_01_048: [ If the output is LOG_SINK_CONSOLE_OUTPUT_DIRECT and stdout is not a terminal, log_sink_console.log shall not write the color codes. ]*/
+            log_sink_console_colors ? level_colors[log_level] : "",
             MU_ENUM_TO_STRING(LOG_LEVEL, log_level),
-            /* Codes_SRS_LOG_SINK_CONSOLE_01_023: [ If the call to time fails then log_sink_console.log shall print the time as NULL. ]*/
-            MU_P_OR_NULL(ctime_result),
+            MU_P_OR_NULL(time_result),
             MU_P_OR_NULL(file),
             line,
             MU_P_OR_NULL(func));
         if (snprintf_result < 0)
         {
             /* Codes_SRS_LOG_SINK_CONSOLE_01_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_sink_console.log shall print Error formatting log line and return. ]*/
-            (void)printf(error_string);
+            print_error(log_level);
         }
         else
         {
@@ -129,7 +487,8 @@ static void log_sink_console_log(LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_con
                     buffer++;
                     buffer_size--;
 
-                    int vsnprintf_result = vsnprintf(buffer, buffer_size, message_format, args);
+                    /* Codes_SRS_LOG_SINK_CONSOLE_01_029: [ log_sink_console.log shall format the message by calling log_vsnprintf_cached. ]*/
+                    int vsnprintf_result = log_vsnprintf_cached(buffer, buffer_size, message_format, args);
                     if (vsnprintf_result < 0)
                     {
                         /* Codes_SRS_LOG_SINK_CONSOLE_01_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_sink_console.log shall print Error formatting log line and return. ]*/
@@ -144,13 +503,11 @@ static void log_sink_console_log(LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_con
 
             if (error)
             {
-                (void)printf(error_string);
+                print_error(log_level);
             }
             else
             {
-                /* Codes_SRS_LOG_SINK_CONSOLE_01_005: [ In order to not break the line in multiple parts when displayed on the console, log_sink_console.log shall print the line in such a way that only one printf call is made. ]*/
-                /* Codes_SRS_LOG_SINK_CONSOLE_01_012: [ At the end of each line that is printed, the color shall be reset by using the x1b[0m code. ]*/
-                (void)printf("%s%s\r\n", temp, LOG_SINK_CONSOLE_ANSI_COLOR_RESET);
+                print_line(log_level, temp, strlen(temp));
             }
         }
     }
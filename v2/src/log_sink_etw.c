@@ -5,6 +5,8 @@
 #include <stdarg.h>
 #include <stdbool.h>
 #include <inttypes.h>
+#include <stddef.h>
+#include <string.h>
 
 #include "windows.h"
 
@@ -21,6 +23,10 @@
 #include "c_logging/log_sink_if.h"
 #include "c_logging/log_sink_etw.h"
 #include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_borrowed_ascii_char_ptr.h"
+#include "c_logging/log_context_property_type_binary.h"
+#include "c_logging/log_context_property_type_identifiers.h"
+#include "c_logging/log_printf.h"
 
 // The following is copy/paste from TraceLoggingProvider.h
 
@@ -209,6 +215,14 @@ static void log_sink_etw_log(LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context
 
 // This function was written with a little bit of reverse engineering of TraceLogging and guidance from
 // the TraceLogging.h header about the format of the self described events
+// size of the value of an array property: the count followed by count elements of element_size bytes (which is also the ETW layout of a variable count array)
+static ULONG get_array_value_size(const void* value, size_t element_size)
+{
+    uint16_t count;
+    (void)memcpy(&count, value, sizeof(uint16_t));
+    return (ULONG)(sizeof(uint16_t) + count * element_size);
+}
+
 static void internal_emit_self_described_event_va(const char* event_name, uint16_t event_name_length, uint8_t trace_level, const LOG_CONTEXT_PROPERTY_VALUE_PAIR* context_property_value_pairs, uint16_t property_value_count, const char* file, const char* func, int32_t line, const char* message_format, va_list args)
 {
     TraceLoggingHProvider const _tlgProv = log_sink_etw_provider;
@@ -283,7 +297,7 @@ static void internal_emit_self_described_event_va(const char* event_name, uint16
                     pos += name_length + 1;
                 }
 
-                LOG_CONTEXT_PROPERTY_TYPE property_type = context_property_value_pairs[i].type->get_type();
+                LOG_CONTEXT_PROPERTY_TYPE property_type = context_property_value_pairs[i].type->type_tag;
 
                 /* Codes_SRS_LOG_SINK_ETW_01_055: [ A byte with the type of property, as follows: ]*/
                 switch (property_type)
@@ -339,6 +353,86 @@ static void internal_emit_self_described_event_va(const char* event_name, uint16
                     /* Codes_SRS_LOG_SINK_ETW_01_079: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_uint8_t, a byte with the value TlgInUINT8 shall be added in the metadata. ]*/
                     *pos = TlgInUINT8;
                     break;
+                case LOG_CONTEXT_PROPERTY_TYPE_float:
+                    /* Codes_SRS_LOG_SINK_ETW_01_095: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_float, a byte with the value TlgInFLOAT shall be added in the metadata. ]*/
+                    *pos = TlgInFLOAT;
+                    break;
+                case LOG_CONTEXT_PROPERTY_TYPE_double:
+                    /* Codes_SRS_LOG_SINK_ETW_01_097: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_double, a byte with the value TlgInDOUBLE shall be added in the metadata. ]*/
+                    *pos = TlgInDOUBLE;
+                    break;
+                case LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr:
+                    /* Codes_SRS_LOG_SINK_ETW_01_099: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr, a byte with the value TlgInANSISTRING shall be added in the metadata. ]*/
+                    *pos = TlgInANSISTRING;
+                    break;
+                case LOG_CONTEXT_PROPERTY_TYPE_binary:
+                    /* Codes_SRS_LOG_SINK_ETW_01_101: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_binary, a byte with the value TlgInBINARY shall be added in the metadata. ]*/
+                    *pos = TlgInBINARY;
+                    break;
+                case LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary:
+                    /* Codes_SRS_LOG_SINK_ETW_01_102: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary, a byte with the value TlgInBINARY shall be added in the metadata. ]*/
+                    *pos = TlgInBINARY;
+                    break;
+                case LOG_CONTEXT_PROPERTY_TYPE_log_uuid_t:
+                    /* Codes_SRS_LOG_SINK_ETW_01_105: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_uuid_t, a byte with the value TlgInGUID shall be added in the metadata. ]*/
+                    *pos = TlgInGUID;
+                    break;
+                case LOG_CONTEXT_PROPERTY_TYPE_log_ipv4_address_t:
+                case LOG_CONTEXT_PROPERTY_TYPE_log_ipv6_address_t:
+                case LOG_CONTEXT_PROPERTY_TYPE_log_socket_address_t:
+                    /* Codes_SRS_LOG_SINK_ETW_01_106: [ For IP address and socket address properties one extra byte shall be added for the out type. ]*/
+                    /* Codes_SRS_LOG_SINK_ETW_01_107: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_ipv4_address_t, a byte with the value TlgInUINT32 | _TlgInChain followed by a byte with the value TlgOutIPV4 shall be added in the metadata. ]*/
+                    /* Codes_SRS_LOG_SINK_ETW_01_108: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_ipv6_address_t, a byte with the value TlgInBINARY | _TlgInChain followed by a byte with the value TlgOutIPV6 shall be added in the metadata. ]*/
+                    /* Codes_SRS_LOG_SINK_ETW_01_109: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_socket_address_t, a byte with the value TlgInBINARY | _TlgInChain followed by a byte with the value TlgOutSOCKETADDRESS shall be added in the metadata. ]*/
+                    *pos = ((property_type == LOG_CONTEXT_PROPERTY_TYPE_log_ipv4_address_t) ? TlgInUINT32 : TlgInBINARY) | _TlgInChain;
+                    pos++;
+
+                    if (pos == &_tlgEvent.metadata[MAX_METADATA_SIZE])
+                    {
+                        (void)printf("Property %" PRIu16 "/%" PRIu16 " does not fit for ETW event, file=%s, func=%s, line=%" PRId32 ".\r\n",
+                            i, property_value_count, file, func, line);
+                        add_properties = false;
+                    }
+                    else
+                    {
+                        *pos = (property_type == LOG_CONTEXT_PROPERTY_TYPE_log_ipv4_address_t) ? TlgOutIPV4 :
+                            (property_type == LOG_CONTEXT_PROPERTY_TYPE_log_ipv6_address_t) ? TlgOutIPV6 : TlgOutSOCKETADDRESS;
+                    }
+                    break;
+                case LOG_CONTEXT_PROPERTY_TYPE_enum:
+                    /* Codes_SRS_LOG_SINK_ETW_01_114: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_enum, a byte with the value TlgInINT32 shall be added in the metadata. ]*/
+                    *pos = TlgInINT32;
+                    break;
+                case LOG_CONTEXT_PROPERTY_TYPE_log_timestamp_t:
+                case LOG_CONTEXT_PROPERTY_TYPE_log_duration_t:
+                    /* Codes_SRS_LOG_SINK_ETW_01_116: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_timestamp_t or LOG_CONTEXT_PROPERTY_TYPE_log_duration_t, a byte with the value TlgInINT64 shall be added in the metadata. ]*/
+                    *pos = TlgInINT64;
+                    break;
+                /* Codes_SRS_LOG_SINK_ETW_01_118: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_{element_type}_array, a byte with the in type of element_type (TlgInINT64, TlgInUINT64, TlgInINT32, TlgInUINT32, TlgInINT16, TlgInUINT16, TlgInINT8 or TlgInUINT8) combined with TlgInVcount shall be added in the metadata. ]*/
+                case LOG_CONTEXT_PROPERTY_TYPE_int64_t_array:
+                    *pos = TlgInINT64 | TlgInVcount;
+                    break;
+                case LOG_CONTEXT_PROPERTY_TYPE_uint64_t_array:
+                    *pos = TlgInUINT64 | TlgInVcount;
+                    break;
+                case LOG_CONTEXT_PROPERTY_TYPE_int32_t_array:
+                    *pos = TlgInINT32 | TlgInVcount;
+                    break;
+                case LOG_CONTEXT_PROPERTY_TYPE_uint32_t_array:
+                    *pos = TlgInUINT32 | TlgInVcount;
+                    break;
+                case LOG_CONTEXT_PROPERTY_TYPE_int16_t_array:
+                    *pos = TlgInINT16 | TlgInVcount;
+                    break;
+                case LOG_CONTEXT_PROPERTY_TYPE_uint16_t_array:
+                    *pos = TlgInUINT16 | TlgInVcount;
+                    break;
+                case LOG_CONTEXT_PROPERTY_TYPE_int8_t_array:
+                    *pos = TlgInINT8 | TlgInVcount;
+                    break;
+                case LOG_CONTEXT_PROPERTY_TYPE_uint8_t_array:
+                    *pos = TlgInUINT8 | TlgInVcount;
+                    break;
 
                 case LOG_CONTEXT_PROPERTY_TYPE_struct:
                     /* Codes_SRS_LOG_SINK_ETW_01_052: [ For struct properties one extra byte shall be added for the field count. ]*/
@@ -395,7 +489,8 @@ static void internal_emit_self_described_event_va(const char* event_name, uint16
         va_list saved_args;
         va_copy(saved_args, args);
 
-        int formatted_message_length = vsnprintf(formatted_message, available_bytes, message_format, args);
+        /* Codes_SRS_LOG_SINK_ETW_01_120: [ log_sink_etw.log shall format the message by calling log_vsnprintf_cached. ]*/
+        int formatted_message_length = log_vsnprintf_cached(formatted_message, available_bytes, message_format, args);
         if (formatted_message_length < 0)
         {
             /* Codes_SRS_LOG_SINK_ETW_01_086: [ If any error occurs log_sink_etw.log shall print Error emitting ETW event and return. ]*/
@@ -415,7 +510,7 @@ static void internal_emit_self_described_event_va(const char* event_name, uint16
 
                     formatted_message = (char*)&_tlgEvent.metadata[metadata_size_without_properties];
                     available_bytes = (char*)&_tlgEvent.metadata[MAX_METADATA_SIZE] - formatted_message;
-                    formatted_message_length = vsnprintf(formatted_message, available_bytes, message_format, saved_args);
+                    formatted_message_length = log_vsnprintf_cached(formatted_message, available_bytes, message_format, saved_args);
                     if (formatted_message_length < 0)
                     {
                         /* Codes_SRS_LOG_SINK_ETW_01_086: [ If any error occurs log_sink_etw.log shall print Error emitting ETW event and return. ]*/
@@ -465,9 +560,9 @@ static void internal_emit_self_described_event_va(const char* event_name, uint16
                 // 1 for the file field
                 // 1 for the func field
                 // 1 for the line field
-                // n entries (1 for each property)
-                /* Codes_SRS_LOG_SINK_ETW_01_039: [ log_sink_etw.log shall fill an EVENT_DATA_DESCRIPTOR array of size 2 + 1 + 1 + 1 + 1 + property count. ]*/
-                EVENT_DATA_DESCRIPTOR _tlgData[2 + 1 + 1 + 1 + 1 + LOG_MAX_ETW_PROPERTY_VALUE_PAIR_COUNT];
+                // n entries (1 for each property, 2 for borrowed binary and IPv6 address properties: the byte count and the bytes)
+                /* Codes_SRS_LOG_SINK_ETW_01_039: [ log_sink_etw.log shall fill an EVENT_DATA_DESCRIPTOR array of size 2 + 1 + 1 + 1 + 1 + 2 * property count. ]*/
+                EVENT_DATA_DESCRIPTOR _tlgData[2 + 1 + 1 + 1 + 1 + 2 * LOG_MAX_ETW_PROPERTY_VALUE_PAIR_COUNT];
 
                 uint32_t _tlgIdx = 2;
 
@@ -489,7 +584,7 @@ static void internal_emit_self_described_event_va(const char* event_name, uint16
                     /* Codes_SRS_LOG_SINK_ETW_01_061: [ For each property in log_context: ]*/
                     for (i = 0; i < property_value_count; i++)
                     {
-                        switch (context_property_value_pairs[i].type->get_type())
+                        switch (context_property_value_pairs[i].type->type_tag)
                         {
                         default:
                             break;
@@ -525,6 +620,14 @@ static void internal_emit_self_described_event_va(const char* event_name, uint16
                             /* Codes_SRS_LOG_SINK_ETW_01_080: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_uint8_t, the event data descriptor shall be filled with the value of the property by calling EventDataDescCreate. ]*/
                             EventDataDescCreate(&_tlgData[_tlgIdx], context_property_value_pairs[i].value, sizeof(uint8_t));
                             break;
+                        case LOG_CONTEXT_PROPERTY_TYPE_float:
+                            /* Codes_SRS_LOG_SINK_ETW_01_096: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_float, the event data descriptor shall be filled with the value of the property by calling EventDataDescCreate. ]*/
+                            EventDataDescCreate(&_tlgData[_tlgIdx], context_property_value_pairs[i].value, sizeof(float));
+                            break;
+                        case LOG_CONTEXT_PROPERTY_TYPE_double:
+                            /* Codes_SRS_LOG_SINK_ETW_01_098: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_double, the event data descriptor shall be filled with the value of the property by calling EventDataDescCreate. ]*/
+                            EventDataDescCreate(&_tlgData[_tlgIdx], context_property_value_pairs[i].value, sizeof(double));
+                            break;
                         case LOG_CONTEXT_PROPERTY_TYPE_bool:
                             static const int32_t true_value = 1;
                             static const int32_t false_value = 0;
@@ -535,6 +638,82 @@ static void internal_emit_self_described_event_va(const char* event_name, uint16
                             /* Codes_SRS_LOG_SINK_ETW_01_067: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_ascii_char_ptr, the event data descriptor shall be filled with the value of the property by calling _tlgCreate1Sz_char. ]*/
                             _tlgCreate1Sz_char(&_tlgData[_tlgIdx], context_property_value_pairs[i].value);
                             break;
+                        case LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr:
+                        {
+                            /* Codes_SRS_LOG_SINK_ETW_01_100: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr, the event data descriptor shall be filled by calling EventDataDescCreate with the borrowed string and its stored length plus the null terminator. ]*/
+                            const BORROWED_ASCII_CHAR_PTR* borrowed = context_property_value_pairs[i].value;
+                            EventDataDescCreate(&_tlgData[_tlgIdx], borrowed->value, (ULONG)(borrowed->length + 1));
+                            break;
+                        }
+                        case LOG_CONTEXT_PROPERTY_TYPE_binary:
+                        {
+                            /* Codes_SRS_LOG_SINK_ETW_01_103: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_binary, the event data descriptor shall be filled by calling EventDataDescCreate with the value of the property (the byte count followed by the bytes). ]*/
+                            uint16_t length;
+                            (void)memcpy(&length, context_property_value_pairs[i].value, sizeof(uint16_t));
+                            EventDataDescCreate(&_tlgData[_tlgIdx], context_property_value_pairs[i].value, (ULONG)(sizeof(uint16_t) + length));
+                            break;
+                        }
+                        case LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary:
+                        {
+                            /* Codes_SRS_LOG_SINK_ETW_01_104: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary, 2 event data descriptors shall be filled by calling EventDataDescCreate: one with the byte count and one with the borrowed bytes. ]*/
+                            BORROWED_BINARY borrowed;
+                            (void)memcpy(&borrowed, context_property_value_pairs[i].value, sizeof(BORROWED_BINARY));
+                            EventDataDescCreate(&_tlgData[_tlgIdx], (const uint8_t*)context_property_value_pairs[i].value + offsetof(BORROWED_BINARY, length), sizeof(uint16_t));
+                            _tlgIdx++;
+                            EventDataDescCreate(&_tlgData[_tlgIdx], borrowed.data, borrowed.length);
+                            break;
+                        }
+                        case LOG_CONTEXT_PROPERTY_TYPE_log_uuid_t:
+                            /* Codes_SRS_LOG_SINK_ETW_01_110: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_uuid_t, the event data descriptor shall be filled with the 16 bytes of the property (GUID layout) by calling EventDataDescCreate. ]*/
+                            EventDataDescCreate(&_tlgData[_tlgIdx], context_property_value_pairs[i].value, sizeof(log_uuid_t));
+                            break;
+                        case LOG_CONTEXT_PROPERTY_TYPE_log_ipv4_address_t:
+                            /* Codes_SRS_LOG_SINK_ETW_01_111: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_ipv4_address_t, the event data descriptor shall be filled with the 4 bytes of the address by calling EventDataDescCreate. ]*/
+                            EventDataDescCreate(&_tlgData[_tlgIdx], context_property_value_pairs[i].value, sizeof(log_ipv4_address_t));
+                            break;
+                        case LOG_CONTEXT_PROPERTY_TYPE_log_ipv6_address_t:
+                        {
+                            /* Codes_SRS_LOG_SINK_ETW_01_112: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_ipv6_address_t, 2 event data descriptors shall be filled by calling EventDataDescCreate: one with the byte count (16) and one with the 16 bytes of the address. ]*/
+                            static const uint16_t ipv6_address_length = sizeof(log_ipv6_address_t);
+                            EventDataDescCreate(&_tlgData[_tlgIdx], &ipv6_address_length, sizeof(uint16_t));
+                            _tlgIdx++;
+                            EventDataDescCreate(&_tlgData[_tlgIdx], context_property_value_pairs[i].value, sizeof(log_ipv6_address_t));
+                            break;
+                        }
+                        case LOG_CONTEXT_PROPERTY_TYPE_log_socket_address_t:
+                        {
+                            /* Codes_SRS_LOG_SINK_ETW_01_113: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_socket_address_t, the event data descriptor shall be filled by calling EventDataDescCreate with the value of the property (the byte count followed by the bytes of the socket address). ]*/
+                            uint16_t length;
+                            (void)memcpy(&length, context_property_value_pairs[i].value, sizeof(uint16_t));
+                            EventDataDescCreate(&_tlgData[_tlgIdx], context_property_value_pairs[i].value, (ULONG)(sizeof(uint16_t) + length));
+                            break;
+                        }
+                        case LOG_CONTEXT_PROPERTY_TYPE_enum:
+                            /* Codes_SRS_LOG_SINK_ETW_01_115: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_enum, the event data descriptor shall be filled with the int32_t value of the property by calling EventDataDescCreate. ]*/
+                            EventDataDescCreate(&_tlgData[_tlgIdx], context_property_value_pairs[i].value, sizeof(int32_t));
+                            break;
+                        case LOG_CONTEXT_PROPERTY_TYPE_log_timestamp_t:
+                        case LOG_CONTEXT_PROPERTY_TYPE_log_duration_t:
+                            /* Codes_SRS_LOG_SINK_ETW_01_117: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_timestamp_t or LOG_CONTEXT_PROPERTY_TYPE_log_duration_t, the event data descriptor shall be filled with the 64 bit value of the property (nanoseconds) by calling EventDataDescCreate. ]*/
+                            EventDataDescCreate(&_tlgData[_tlgIdx], context_property_value_pairs[i].value, sizeof(int64_t));
+                            break;
+                        /* Codes_SRS_LOG_SINK_ETW_01_119: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_{element_type}_array, the event data descriptor shall be filled by calling EventDataDescCreate with the value of the property (the count followed by the values). ]*/
+                        case LOG_CONTEXT_PROPERTY_TYPE_int64_t_array:
+                        case LOG_CONTEXT_PROPERTY_TYPE_uint64_t_array:
+                            EventDataDescCreate(&_tlgData[_tlgIdx], context_property_value_pairs[i].value, get_array_value_size(context_property_value_pairs[i].value, sizeof(uint64_t)));
+                            break;
+                        case LOG_CONTEXT_PROPERTY_TYPE_int32_t_array:
+                        case LOG_CONTEXT_PROPERTY_TYPE_uint32_t_array:
+                            EventDataDescCreate(&_tlgData[_tlgIdx], context_property_value_pairs[i].value, get_array_value_size(context_property_value_pairs[i].value, sizeof(uint32_t)));
+                            break;
+                        case LOG_CONTEXT_PROPERTY_TYPE_int16_t_array:
+                        case LOG_CONTEXT_PROPERTY_TYPE_uint16_t_array:
+                            EventDataDescCreate(&_tlgData[_tlgIdx], context_property_value_pairs[i].value, get_array_value_size(context_property_value_pairs[i].value, sizeof(uint16_t)));
+                            break;
+                        case LOG_CONTEXT_PROPERTY_TYPE_int8_t_array:
+                        case LOG_CONTEXT_PROPERTY_TYPE_uint8_t_array:
+                            EventDataDescCreate(&_tlgData[_tlgIdx], context_property_value_pairs[i].value, get_array_value_size(context_property_value_pairs[i].value, sizeof(uint8_t)));
+                            break;
                         case LOG_CONTEXT_PROPERTY_TYPE_wchar_t_ptr:
                             /* Codes_SRS_LOG_SINK_ETW_07_004: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_wchar_t_ptr, the event data descriptor shall be filled with the value of the property by calling _tlgCreate1Sz_wchar_t. ]*/
                             _tlgCreate1Sz_wchar_t(&_tlgData[_tlgIdx], context_property_value_pairs[i].value);
@@ -0,0 +1,518 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include "windows.h"
+#else
+#include <sched.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/logging_stacktrace.h"
+
+#include "c_logging/log_timestamp.h"
+
+#if defined(LOG_TIMESTAMP_USE_COUNTER) && (defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__))
+#define LOG_TIMESTAMP_COUNTER_X86
+#elif defined(LOG_TIMESTAMP_USE_COUNTER) && (defined(_M_ARM64) || defined(__aarch64__))
+#define LOG_TIMESTAMP_COUNTER_ARM64
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#elif defined(LOG_TIMESTAMP_COUNTER_X86)
+#include <cpuid.h>
+#include <x86intrin.h>
+#endif
+
+#define NANOSECONDS_PER_SECOND INT64_C(1000000000)
+
+// the first calibration measures the frequency of the counter over this interval
+#define INITIAL_CALIBRATION_NS INT64_C(2000000)
+
+// a new frequency is only measured over at least this interval, and only kept if it is within MAX_FREQUENCY_CHANGE of the
+// previous one (a larger change means the wall clock was stepped, the mapping is then only moved to the new wall clock time)
+#define MIN_FREQUENCY_MEASUREMENT_NS (LOG_TIMESTAMP_CALIBRATION_PERIOD_NS / 2)
+#define MAX_FREQUENCY_CHANGE 0.01
+
+// number of reads of the counter and the clock for one calibration pair
+#define CLOCK_READ_COUNT 5
+
+#if defined(_WIN32)
+// timespec_get reads GetSystemTimePreciseAsFileTime
+#define LOG_TIMESTAMP_READ_CLOCK(now) (timespec_get((now), TIME_UTC) == TIME_UTC)
+#elif defined(LOG_TIMESTAMP_USE_COARSE_CLOCK) && defined(CLOCK_REALTIME_COARSE)
+#define LOG_TIMESTAMP_READ_CLOCK(now) (clock_gettime(CLOCK_REALTIME_COARSE, (now)) == 0)
+#else
+#define LOG_TIMESTAMP_READ_CLOCK(now) (clock_gettime(CLOCK_REALTIME, (now)) == 0)
+#endif
+
+#define COUNTER_STATE_VALUES \
+    COUNTER_STATE_NOT_CHECKED, \
+    COUNTER_STATE_AVAILABLE, \
+    COUNTER_STATE_NOT_AVAILABLE
+
+MU_DEFINE_ENUM(COUNTER_STATE, COUNTER_STATE_VALUES)
+
+typedef struct CALIBRATION_TAG
+{
+    uint64_t base_ticks;
+    int64_t base_ns; // wall clock time at base_ticks
+    double ns_per_tick;
+} CALIBRATION;
+
+static volatile long counter_state = COUNTER_STATE_NOT_CHECKED; // COUNTER_STATE
+
+// The calibration is published with a sequence lock: the sequence is odd while a new calibration is written and 0 until the
+// first calibration, readers retry when the sequence changed while they copied the calibration. Writers are serialized by
+// calibration_in_progress.
+static volatile long calibration_sequence;
+static volatile long calibration_in_progress;
+static volatile uint64_t calibration_base_ticks;
+static volatile int64_t calibration_base_ns;
+static volatile double calibration_ns_per_tick;
+
+// the ticks of the record being rendered on this thread (see log_timestamp_begin_record)
+static XLOGGING_THREAD_LOCAL bool record_in_progress;
+static XLOGGING_THREAD_LOCAL uint64_t record_ticks;
+
+#ifdef _MSC_VER
+static long atomic_load_long(volatile long* value)
+{
+    return _InterlockedCompareExchange(value, 0, 0);
+}
+
+static void atomic_store_long(volatile long* value, long new_value)
+{
+    (void)_InterlockedExchange(value, new_value);
+}
+
+static bool atomic_compare_exchange_long(volatile long* value, long expected, long desired)
+{
+    return (_InterlockedCompareExchange(value, desired, expected) == expected);
+}
+
+// the interlocked functions are full barriers
+static void fence_after_store(void)
+{
+}
+
+static void fence_before_load(void)
+{
+}
+#else
+static long atomic_load_long(volatile long* value)
+{
+    return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+}
+
+static void atomic_store_long(volatile long* value, long new_value)
+{
+    __atomic_store_n(value, new_value, __ATOMIC_RELEASE);
+}
+
+static bool atomic_compare_exchange_long(volatile long* value, long expected, long desired)
+{
+    return __atomic_compare_exchange_n(value, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+}
+
+// orders the store of the odd sequence before the stores of the calibration
+static void fence_after_store(void)
+{
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+}
+
+// orders the loads of the calibration before the second load of the sequence
+static void fence_before_load(void)
+{
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+}
+#endif
+
+static int64_t read_clock(void)
+{
+    int64_t result;
+    struct timespec now;
+
+    /* Codes_SRS_LOG_TIMESTAMP_01_001: [ If the counter is not used, log_timestamp_now shall read the wall clock once: clock_gettime with CLOCK_REALTIME on Linux (CLOCK_REALTIME_COARSE if LOG_TIMESTAMP_USE_COARSE_CLOCK is defined) and timespec_get with TIME_UTC on Windows. ]*/
+    if (!LOG_TIMESTAMP_READ_CLOCK(&now))
+    {
+        /* Codes_SRS_LOG_TIMESTAMP_01_002: [ If reading the clock fails, log_timestamp_now shall return LOG_TIMESTAMP_INVALID. ]*/
+        result = LOG_TIMESTAMP_INVALID;
+    }
+    else
+    {
+        /* Codes_SRS_LOG_TIMESTAMP_01_003: [ log_timestamp_now shall return the number of nanoseconds since 1970-01-01T00:00:00Z. ]*/
+        result = (int64_t)now.tv_sec * NANOSECONDS_PER_SECOND + now.tv_nsec;
+    }
+
+    return result;
+}
+
+static bool counter_is_invariant(void)
+{
+#if defined(LOG_TIMESTAMP_COUNTER_X86)
+    // CPUID.80000007H:EDX[8], the TSC runs at a constant rate in all ACPI P-, C- and T-states
+#ifdef _MSC_VER
+    int registers[4];
+    __cpuid(registers, (int)0x80000000);
+    if ((unsigned int)registers[0] < 0x80000007)
+    {
+        return false;
+    }
+    __cpuid(registers, (int)0x80000007);
+    return ((registers[3] & (1 << 8)) != 0);
+#else
+    unsigned int eax;
+    unsigned int ebx;
+    unsigned int ecx;
+    unsigned int edx;
+    return ((__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) != 0) && ((edx & (1u << 8)) != 0));
+#endif
+#elif defined(LOG_TIMESTAMP_COUNTER_ARM64)
+    // the generic timer counts at a fixed frequency
+    return true;
+#else
+    return false;
+#endif
+}
+
+static uint64_t read_counter(void)
+{
+#if defined(LOG_TIMESTAMP_COUNTER_X86)
+    return __rdtsc();
+#elif defined(LOG_TIMESTAMP_COUNTER_ARM64)
+#ifdef _MSC_VER
+    return (uint64_t)_ReadStatusReg(0x5F02); // CNTVCT_EL0
+#else
+    uint64_t value;
+    __asm__ __volatile__("isb\n\tmrs %0, cntvct_el0" : "=r"(value) : : "memory");
+    return value;
+#endif
+#else
+    return 0;
+#endif
+}
+
+static bool counter_is_available(void)
+{
+    long state = atomic_load_long(&counter_state);
+
+    if (state == COUNTER_STATE_NOT_CHECKED)
+    {
+        /* Codes_SRS_LOG_TIMESTAMP_01_004: [ On the first call, the counter shall be used only if LOG_TIMESTAMP_USE_COUNTER is defined and the CPU reports an invariant counter (CPUID leaf 80000007H, EDX bit 8 on x86/x64; always on ARM64). ]*/
+        // checking is idempotent, threads racing here store the same value
+        state = counter_is_invariant() ? COUNTER_STATE_AVAILABLE : COUNTER_STATE_NOT_AVAILABLE;
+        atomic_store_long(&counter_state, state);
+    }
+
+    return (state == COUNTER_STATE_AVAILABLE);
+}
+
+// reads the counter on both sides of the clock, so that the pair is taken at the same time, and keeps the narrowest of a few
+// reads (the first read of the clock can take microseconds)
+static bool read_counter_and_clock(uint64_t* ticks, int64_t* ns)
+{
+    bool result = true;
+    uint64_t narrowest = UINT64_MAX;
+
+    for (uint32_t i = 0; result && (i < CLOCK_READ_COUNT); i++)
+    {
+        uint64_t before = read_counter();
+        int64_t clock_ns = read_clock();
+        uint64_t after = read_counter();
+
+        if (clock_ns == LOG_TIMESTAMP_INVALID)
+        {
+            result = false;
+        }
+        else if (after - before < narrowest)
+        {
+            narrowest = after - before;
+            *ticks = before + ((after - before) / 2);
+            *ns = clock_ns;
+        }
+    }
+
+    return result;
+}
+
+static bool read_calibration(CALIBRATION* calibration)
+{
+    bool result;
+    long sequence_before;
+    long sequence_after;
+
+    do
+    {
+        sequence_before = atomic_load_long(&calibration_sequence);
+        calibration->base_ticks = calibration_base_ticks;
+        calibration->base_ns = calibration_base_ns;
+        calibration->ns_per_tick = calibration_ns_per_tick;
+        fence_before_load();
+        sequence_after = atomic_load_long(&calibration_sequence);
+    } while ((sequence_before != sequence_after) || ((sequence_before & 1) != 0));
+
+    result = (sequence_before != 0);
+    return result;
+}
+
+static void publish_calibration(const CALIBRATION* calibration)
+{
+    long sequence = atomic_load_long(&calibration_sequence);
+
+    atomic_store_long(&calibration_sequence, sequence + 1);
+    fence_after_store();
+    calibration_base_ticks = calibration->base_ticks;
+    calibration_base_ns = calibration->base_ns;
+    calibration_ns_per_tick = calibration->ns_per_tick;
+    atomic_store_long(&calibration_sequence, sequence + 2);
+}
+
+static void yield_thread(void)
+{
+#ifdef _WIN32
+    (void)SwitchToThread();
+#else
+    (void)sched_yield();
+#endif
+}
+
+// gets the calibration, calibrating (or waiting for the thread that calibrates) on first use
+static bool get_calibration(CALIBRATION* calibration)
+{
+    bool result;
+
+    // log_timestamp_calibrate returns 0 if it published a calibration or if another thread is calibrating, then the calibration
+    // is read again. If another thread fails, this thread tries itself on the next pass.
+    while (!(result = read_calibration(calibration)))
+    {
+        if (log_timestamp_calibrate() != 0)
+        {
+            // the calibration made by this thread failed, another thread could have published one in the meantime
+            result = read_calibration(calibration);
+            break;
+        }
+        else if (!(result = read_calibration(calibration)))
+        {
+            // another thread is measuring the first calibration (INITIAL_CALIBRATION_NS), give it the processor while waiting
+            yield_thread();
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    return result;
+}
+
+static int64_t convert_ticks(const CALIBRATION* calibration, uint64_t ticks)
+{
+    // records made before the base (or rendered after a newer calibration) have a negative distance to it
+    int64_t distance = (int64_t)(ticks - calibration->base_ticks);
+    return calibration->base_ns + (int64_t)((double)distance * calibration->ns_per_tick);
+}
+
+int64_t log_timestamp_now(void)
+{
+    int64_t result;
+
+    if (record_in_progress)
+    {
+        /* Codes_SRS_LOG_TIMESTAMP_01_015: [ If log_timestamp_begin_record was called on the calling thread without a matching log_timestamp_end_record, log_timestamp_now shall return the result of log_timestamp_ticks_to_ns for the ticks of the record. ]*/
+        result = log_timestamp_ticks_to_ns(record_ticks);
+    }
+    else if (!counter_is_available())
+    {
+        result = read_clock();
+    }
+    else if ((atomic_load_long(&calibration_sequence) == 0) && (atomic_load_long(&calibration_in_progress) != 0))
+    {
+        /* Codes_SRS_LOG_TIMESTAMP_01_021: [ If the counter is used and another thread is making the first calibration, log_timestamp_now shall read the wall clock instead of waiting for the calibration. ]*/
+        result = read_clock();
+    }
+    else
+    {
+        CALIBRATION calibration;
+        uint64_t ticks = read_counter();
+
+        if (!get_calibration(&calibration))
+        {
+            /* Codes_SRS_LOG_TIMESTAMP_01_016: [ If the counter is used and no calibration can be made, log_timestamp_now shall return LOG_TIMESTAMP_INVALID. ]*/
+            result = LOG_TIMESTAMP_INVALID;
+        }
+        else
+        {
+            /* Codes_SRS_LOG_TIMESTAMP_01_017: [ If the counter is used, log_timestamp_now shall read the counter and convert it with the published calibration. ]*/
+            result = convert_ticks(&calibration, ticks);
+
+            if (result - calibration.base_ns > LOG_TIMESTAMP_CALIBRATION_PERIOD_NS)
+            {
+                /* Codes_SRS_LOG_TIMESTAMP_01_018: [ If the calibration is older than LOG_TIMESTAMP_CALIBRATION_PERIOD_NS, log_timestamp_now shall call log_timestamp_calibrate before converting. ]*/
+                (void)log_timestamp_calibrate();
+                if (read_calibration(&calibration))
+                {
+                    result = convert_ticks(&calibration, ticks);
+                }
+            }
+        }
+    }
+
+    return result;
+}
+
+uint64_t log_timestamp_ticks(void)
+{
+    uint64_t result;
+
+    if (counter_is_available())
+    {
+        /* Codes_SRS_LOG_TIMESTAMP_01_005: [ If the counter is used, log_timestamp_ticks shall return the value of the counter (rdtsc on x86/x64, CNTVCT_EL0 on ARM64). ]*/
+        result = read_counter();
+    }
+    else
+    {
+        /* Codes_SRS_LOG_TIMESTAMP_01_006: [ Otherwise log_timestamp_ticks shall return the wall clock time in nanoseconds since 1970-01-01T00:00:00Z. ]*/
+        result = (uint64_t)read_clock();
+    }
+
+    return result;
+}
+
+int64_t log_timestamp_ticks_to_ns(uint64_t ticks)
+{
+    int64_t result;
+
+    if (!counter_is_available())
+    {
+        /* Codes_SRS_LOG_TIMESTAMP_01_007: [ If the counter is not used, log_timestamp_ticks_to_ns shall return ticks. ]*/
+        result = (int64_t)ticks;
+    }
+    else
+    {
+        CALIBRATION calibration;
+
+        if (!get_calibration(&calibration))
+        {
+            /* Codes_SRS_LOG_TIMESTAMP_01_008: [ If no calibration can be made, log_timestamp_ticks_to_ns shall return LOG_TIMESTAMP_INVALID. ]*/
+            result = LOG_TIMESTAMP_INVALID;
+        }
+        else
+        {
+            /* Codes_SRS_LOG_TIMESTAMP_01_009: [ Otherwise log_timestamp_ticks_to_ns shall convert ticks to nanoseconds since 1970-01-01T00:00:00Z with the published calibration (calibrating first if no calibration was published yet, or yielding the processor while another thread makes the first calibration). ]*/
+            result = convert_ticks(&calibration, ticks);
+        }
+    }
+
+    return result;
+}
+
+bool log_timestamp_uses_counter(void)
+{
+    /* Codes_SRS_LOG_TIMESTAMP_01_010: [ log_timestamp_uses_counter shall return true if the ticks come from the counter and false otherwise. ]*/
+    return counter_is_available();
+}
+
+int log_timestamp_calibrate(void)
+{
+    int result;
+
+    if (!counter_is_available())
+    {
+        /* Codes_SRS_LOG_TIMESTAMP_01_011: [ If the counter is not used or another thread is calibrating, log_timestamp_calibrate shall return 0. ]*/
+        result = 0;
+    }
+    else if (!atomic_compare_exchange_long(&calibration_in_progress, 0, 1))
+    {
+        /* Codes_SRS_LOG_TIMESTAMP_01_011: [ If the counter is not used or another thread is calibrating, log_timestamp_calibrate shall return 0. ]*/
+        result = 0;
+    }
+    else
+    {
+        CALIBRATION previous;
+        CALIBRATION calibration;
+        bool has_previous = read_calibration(&previous);
+
+        /* Codes_SRS_LOG_TIMESTAMP_01_012: [ log_timestamp_calibrate shall read the counter and the wall clock together. ]*/
+        if (!read_counter_and_clock(&calibration.base_ticks, &calibration.base_ns))
+        {
+            /* Codes_SRS_LOG_TIMESTAMP_01_014: [ If reading the wall clock fails, log_timestamp_calibrate shall fail and return a non-zero value. ]*/
+            (void)printf("cannot read the wall clock to calibrate the counter\r\n");
+            result = MU_FAILURE;
+        }
+        else if (!has_previous)
+        {
+            /* Codes_SRS_LOG_TIMESTAMP_01_013: [ log_timestamp_calibrate shall publish the new mapping from ticks to wall clock time so that readers never see a partially written one. On the first calibration the frequency of the counter is measured over 2 ms, afterwards it is measured since the previous calibration if that is at least half of LOG_TIMESTAMP_CALIBRATION_PERIOD_NS away and the result is within 1% of the previous frequency. ]*/
+            uint64_t start_ticks = calibration.base_ticks;
+            int64_t start_ns = calibration.base_ns;
+            bool clock_read = true;
+
+            while (clock_read && (calibration.base_ns - start_ns < INITIAL_CALIBRATION_NS))
+            {
+                clock_read = read_counter_and_clock(&calibration.base_ticks, &calibration.base_ns);
+                if (calibration.base_ns < start_ns)
+                {
+                    // the wall clock was stepped back, start over
+                    start_ticks = calibration.base_ticks;
+                    start_ns = calibration.base_ns;
+                }
+            }
+
+            if (!clock_read || (calibration.base_ticks == start_ticks))
+            {
+                /* Codes_SRS_LOG_TIMESTAMP_01_014: [ If reading the wall clock fails, log_timestamp_calibrate shall fail and return a non-zero value. ]*/
+                (void)printf("cannot measure the frequency of the counter\r\n");
+                result = MU_FAILURE;
+            }
+            else
+            {
+                calibration.ns_per_tick = (double)(calibration.base_ns - start_ns) / (double)(calibration.base_ticks - start_ticks);
+                publish_calibration(&calibration);
+                result = 0;
+            }
+        }
+        else
+        {
+            /* Codes_SRS_LOG_TIMESTAMP_01_013: [ log_timestamp_calibrate shall publish the new mapping from ticks to wall clock time so that readers never see a partially written one. On the first calibration the frequency of the counter is measured over 2 ms, afterwards it is measured since the previous calibration if that is at least half of LOG_TIMESTAMP_CALIBRATION_PERIOD_NS away and the result is within 1% of the previous frequency. ]*/
+            calibration.ns_per_tick = previous.ns_per_tick;
+
+            int64_t elapsed_ns = calibration.base_ns - previous.base_ns;
+            if ((elapsed_ns >= MIN_FREQUENCY_MEASUREMENT_NS) && (calibration.base_ticks > previous.base_ticks))
+            {
+                double ns_per_tick = (double)elapsed_ns / (double)(calibration.base_ticks - previous.base_ticks);
+                double change = (ns_per_tick - previous.ns_per_tick) / previous.ns_per_tick;
+                if ((change < MAX_FREQUENCY_CHANGE) && (change > -MAX_FREQUENCY_CHANGE))
+                {
+                    calibration.ns_per_tick = ns_per_tick;
+                }
+            }
+
+            publish_calibration(&calibration);
+            result = 0;
+        }
+
+        atomic_store_long(&calibration_in_progress, 0);
+    }
+
+    return result;
+}
+
+void log_timestamp_begin_record(uint64_t ticks)
+{
+    /* Codes_SRS_LOG_TIMESTAMP_01_019: [ log_timestamp_begin_record shall store ticks as the ticks of the record being rendered on the calling thread. ]*/
+    record_ticks = ticks;
+    record_in_progress = true;
+}
+
+void log_timestamp_end_record(void)
+{
+    /* Codes_SRS_LOG_TIMESTAMP_01_020: [ log_timestamp_end_record shall make log_timestamp_now read the wall clock again on the calling thread. ]*/
+    record_in_progress = false;
+}
@@ -10,6 +10,7 @@
 
 #include "c_logging/log_level.h"
 #include "c_logging/log_context.h"
+#include "c_logging/log_context_ambient.h"
 #include "c_logging/log_sink_if.h"
 #include "c_logging/get_thread_stack.h"
 
@@ -153,6 +154,38 @@ void logger_set_config(LOGGER_CONFIG new_config)
     log_sink_count = new_config.log_sink_count;
 }
 
+// merges the ambient context with log_context, the pairs of the merged view are on the stack of the logging call unless there are too many of them
+static LOG_CONTEXT_HANDLE merge_ambient_context(LOG_CONTEXT_HANDLE log_context, LOG_CONTEXT* merged_log_context, LOG_CONTEXT_PROPERTY_VALUE_PAIR stack_merged_property_value_pairs[LOGGER_STACK_MERGED_PAIR_COUNT], LOG_CONTEXT_PROPERTY_VALUE_PAIR** allocated_merged_property_value_pairs)
+{
+    LOG_CONTEXT_HANDLE result;
+    uint32_t merged_pair_count = internal_log_context_ambient_get_merged_pair_count(log_context);
+
+    *allocated_merged_property_value_pairs = NULL;
+
+    if (merged_pair_count <= LOGGER_STACK_MERGED_PAIR_COUNT)
+    {
+        /* Codes_SRS_LOGGER_01_027: [ If the merged view has at most LOGGER_STACK_MERGED_PAIR_COUNT property/value pairs, they shall be stored on the stack. ] */
+        result = internal_log_context_ambient_merge(log_context, merged_log_context, stack_merged_property_value_pairs);
+    }
+    else
+    {
+        /* Codes_SRS_LOGGER_01_028: [ Otherwise the property/value pairs of the merged view shall be stored in memory allocated for the logging call. ] */
+        *allocated_merged_property_value_pairs = malloc(sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) * merged_pair_count);
+        if (*allocated_merged_property_value_pairs == NULL)
+        {
+            /* Codes_SRS_LOGGER_01_029: [ If allocating the property/value pairs of the merged view fails, log_context shall be passed to the sinks as is. ] */
+            (void)printf("malloc failed for %" PRIu32 " merged property/value pairs\r\n", merged_pair_count);
+            result = log_context;
+        }
+        else
+        {
+            result = internal_log_context_ambient_merge(log_context, merged_log_context, *allocated_merged_property_value_pairs);
+        }
+    }
+
+    return result;
+}
+
 void logger_log(LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context, const char* file, const char* func, int line_no, const char* format, ...)
 {
     if (logger_state != LOGGER_STATE_INITIALIZED)
@@ -163,6 +196,13 @@ void logger_log(LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context, const char*
     else
     {
         va_list args;
+        MU_SUPPRESS_WARNING(4815) /* warning C4815: zero-sized array in stack object will have no elements (unless the object is an aggregate that has been aggregate initialized) */
+        LOG_CONTEXT merged_log_context;
+        LOG_CONTEXT_PROPERTY_VALUE_PAIR stack_merged_property_value_pairs[LOGGER_STACK_MERGED_PAIR_COUNT];
+        LOG_CONTEXT_PROPERTY_VALUE_PAIR* allocated_merged_property_value_pairs;
+
+        /* Codes_SRS_LOGGER_01_025: [ LOGGER_LOG shall pass to the sinks the context obtained by merging the ambient context of the calling thread with log_context by calling internal_log_context_ambient_merge. ] */
+        log_context = merge_ambient_context(log_context, &merged_log_context, stack_merged_property_value_pairs, &allocated_merged_property_value_pairs);
 
         va_start(args, format);
 
@@ -177,6 +217,8 @@ void logger_log(LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context, const char*
         }
 
         va_end(args);
+
+        free(allocated_merged_property_value_pairs);
     }
 }
 
@@ -199,6 +241,13 @@ void logger_log_with_config(LOGGER_CONFIG logger_config, LOG_LEVEL log_level, LO
     else
     {
         va_list args;
+        MU_SUPPRESS_WARNING(4815) /* warning C4815: zero-sized array in stack object will have no elements (unless the object is an aggregate that has been aggregate initialized) */
+        LOG_CONTEXT merged_log_context;
+        LOG_CONTEXT_PROPERTY_VALUE_PAIR stack_merged_property_value_pairs[LOGGER_STACK_MERGED_PAIR_COUNT];
+        LOG_CONTEXT_PROPERTY_VALUE_PAIR* allocated_merged_property_value_pairs;
+
+        /* Codes_SRS_LOGGER_01_026: [ LOGGER_LOG_WITH_CONFIG shall pass to the sinks the context obtained by merging the ambient context of the calling thread with log_context by calling internal_log_context_ambient_merge. ] */
+        log_context = merge_ambient_context(log_context, &merged_log_context, stack_merged_property_value_pairs, &allocated_merged_property_value_pairs);
 
         va_start(args, format);
 
@@ -213,5 +262,7 @@ void logger_log_with_config(LOGGER_CONFIG logger_config, LOG_LEVEL log_level, LO
         }
 
         va_end(args);
+
+        free(allocated_merged_property_value_pairs);
     }
 }
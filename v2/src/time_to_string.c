@@ -0,0 +1,323 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "c_logging/logging_stacktrace.h"
+
+#include "c_logging/time_to_string.h"
+
+#define NANOSECONDS_PER_SECOND INT64_C(1000000000)
+#define SECONDS_PER_DAY INT64_C(86400)
+
+// "YYYY-MM-DDTHH:MM:SS"
+#define TIMESTAMP_PREFIX_LENGTH 19
+
+// the date and time of day of the last second rendered on this thread, most timestamps rendered in a row fall in the same second
+static XLOGGING_THREAD_LOCAL bool timestamp_prefix_cached;
+static XLOGGING_THREAD_LOCAL int64_t timestamp_prefix_seconds;
+static XLOGGING_THREAD_LOCAL char timestamp_prefix[TIMESTAMP_PREFIX_LENGTH];
+
+static void write_2_digits(char* destination, uint32_t value)
+{
+    destination[0] = (char)('0' + (value / 10));
+    destination[1] = (char)('0' + (value % 10));
+}
+
+static void write_digits(char* destination, uint64_t value, size_t digit_count)
+{
+    for (size_t i = digit_count; i > 0; i--)
+    {
+        destination[i - 1] = (char)('0' + (value % 10));
+        value /= 10;
+    }
+}
+
+// proleptic Gregorian calendar date of a number of days since 1970-01-01 (works in 400 year eras starting on March 1st,
+// so that the leap day is the last day of the year)
+static void civil_from_days(int64_t days, int64_t* year, uint32_t* month, uint32_t* day)
+{
+    int64_t z = days + 719468;
+    int64_t era = ((z >= 0) ? z : z - 146096) / 146097;
+    uint32_t day_of_era = (uint32_t)(z - era * 146097);
+    uint32_t year_of_era = (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    uint32_t day_of_year = day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    uint32_t shifted_month = (5 * day_of_year + 2) / 153;
+
+    *day = day_of_year - (153 * shifted_month + 2) / 5 + 1;
+    *month = (shifted_month < 10) ? shifted_month + 3 : shifted_month - 9;
+    *year = (int64_t)year_of_era + era * 400 + ((*month <= 2) ? 1 : 0);
+}
+
+static void write_timestamp_prefix(char* destination, int64_t seconds)
+{
+    int64_t days = seconds / SECONDS_PER_DAY;
+    int64_t second_of_day = seconds % SECONDS_PER_DAY;
+    if (second_of_day < 0)
+    {
+        days--;
+        second_of_day += SECONDS_PER_DAY;
+    }
+
+    int64_t year;
+    uint32_t month;
+    uint32_t day;
+    civil_from_days(days, &year, &month, &day);
+
+    // years representable with 64 bit nanoseconds are 1677 to 2262
+    write_digits(destination, (uint64_t)year, 4);
+    destination[4] = '-';
+    write_2_digits(destination + 5, month);
+    destination[7] = '-';
+    write_2_digits(destination + 8, day);
+    destination[10] = 'T';
+    write_2_digits(destination + 11, (uint32_t)(second_of_day / 3600));
+    destination[13] = ':';
+    write_2_digits(destination + 14, (uint32_t)((second_of_day / 60) % 60));
+    destination[16] = ':';
+    write_2_digits(destination + 17, (uint32_t)(second_of_day % 60));
+}
+
+// writes the timestamp with fraction_digit_count digits of fraction (9 for nanoseconds, 6 for microseconds) and returns its length
+static size_t write_timestamp(char* destination, int64_t nanoseconds_since_epoch, size_t fraction_digit_count)
+{
+    int64_t seconds = nanoseconds_since_epoch / NANOSECONDS_PER_SECOND;
+    int64_t nanoseconds = nanoseconds_since_epoch % NANOSECONDS_PER_SECOND;
+    if (nanoseconds < 0)
+    {
+        seconds--;
+        nanoseconds += NANOSECONDS_PER_SECOND;
+    }
+
+    if (!timestamp_prefix_cached || (timestamp_prefix_seconds != seconds))
+    {
+        write_timestamp_prefix(timestamp_prefix, seconds);
+        timestamp_prefix_seconds = seconds;
+        timestamp_prefix_cached = true;
+    }
+
+    uint64_t fraction = (uint64_t)nanoseconds;
+    for (size_t i = fraction_digit_count; i < 9; i++)
+    {
+        fraction /= 10;
+    }
+
+    (void)memcpy(destination, timestamp_prefix, TIMESTAMP_PREFIX_LENGTH);
+    destination[TIMESTAMP_PREFIX_LENGTH] = '.';
+    write_digits(destination + TIMESTAMP_PREFIX_LENGTH + 1, fraction, fraction_digit_count);
+    destination[TIMESTAMP_PREFIX_LENGTH + 1 + fraction_digit_count] = 'Z';
+
+    return TIMESTAMP_PREFIX_LENGTH + fraction_digit_count + 2;
+}
+
+static size_t write_decimal(char* destination, uint64_t value)
+{
+    char digits[20];
+    size_t digit_count = 0;
+
+    do
+    {
+        digits[digit_count++] = (char)('0' + (value % 10));
+        value /= 10;
+    } while (value != 0);
+
+    for (size_t i = 0; i < digit_count; i++)
+    {
+        destination[i] = digits[digit_count - 1 - i];
+    }
+
+    return digit_count;
+}
+
+// writes value / 1000 followed by . and the 3 digits of value % 1000
+static size_t write_thousandths(char* destination, uint64_t value)
+{
+    size_t length = write_decimal(destination, value / 1000);
+    destination[length] = '.';
+    write_digits(destination + length + 1, value % 1000, 3);
+    return length + 4;
+}
+
+static size_t write_duration(char* destination, int64_t nanoseconds)
+{
+    char* pos = destination;
+    uint64_t magnitude;
+
+    if (nanoseconds < 0)
+    {
+        *pos++ = '-';
+        magnitude = (uint64_t)(-(nanoseconds + 1)) + 1;
+    }
+    else
+    {
+        magnitude = (uint64_t)nanoseconds;
+    }
+
+    if (magnitude < 1000)
+    {
+        pos += write_decimal(pos, magnitude);
+        *pos++ = 'n';
+        *pos++ = 's';
+    }
+    else if (magnitude < 1000000)
+    {
+        pos += write_thousandths(pos, magnitude);
+        *pos++ = 'u';
+        *pos++ = 's';
+    }
+    else if (magnitude < 1000000000)
+    {
+        pos += write_thousandths(pos, magnitude / 1000);
+        *pos++ = 'm';
+        *pos++ = 's';
+    }
+    else
+    {
+        uint64_t milliseconds = magnitude / 1000000;
+        uint64_t seconds = milliseconds / 1000;
+
+        if (seconds < 60)
+        {
+            pos += write_thousandths(pos, milliseconds);
+        }
+        else
+        {
+            uint64_t minutes = seconds / 60;
+            uint64_t hours = minutes / 60;
+            uint64_t days = hours / 24;
+
+            if (days > 0)
+            {
+                pos += write_decimal(pos, days);
+                *pos++ = 'd';
+                write_2_digits(pos, (uint32_t)(hours % 24));
+                pos += 2;
+                *pos++ = 'h';
+            }
+            else if (hours > 0)
+            {
+                pos += write_decimal(pos, hours);
+                *pos++ = 'h';
+            }
+
+            if (hours > 0)
+            {
+                write_2_digits(pos, (uint32_t)(minutes % 60));
+                pos += 2;
+            }
+            else
+            {
+                pos += write_decimal(pos, minutes);
+            }
+            *pos++ = 'm';
+
+            write_2_digits(pos, (uint32_t)(seconds % 60));
+            pos += 2;
+            *pos++ = '.';
+            write_digits(pos, milliseconds % 1000, 3);
+            pos += 3;
+        }
+
+        *pos++ = 's';
+    }
+
+    return (size_t)(pos - destination);
+}
+
+// hands the representation built in a local buffer to the caller following the snprintf contract
+static int copy_representation(const char* representation, size_t length, char* buffer, size_t buffer_length)
+{
+    if (buffer_length == 0)
+    {
+        /* Codes_SRS_TIME_TO_STRING_01_010: [ If buffer_length is 0, timestamp_to_string, timestamp_microseconds_to_string and duration_to_string shall only return the length of the representation. ]*/
+    }
+    else if (buffer_length > length)
+    {
+        /* Codes_SRS_TIME_TO_STRING_01_011: [ If the representation fits in buffer, timestamp_to_string, timestamp_microseconds_to_string and duration_to_string shall write it in buffer followed by a zero terminator. ]*/
+        (void)memcpy(buffer, representation, length);
+        buffer[length] = '\0';
+    }
+    else
+    {
+        /* Codes_SRS_TIME_TO_STRING_01_012: [ Otherwise timestamp_to_string, timestamp_microseconds_to_string and duration_to_string shall write the first buffer_length - 1 characters of the representation in buffer, followed by a zero terminator. ]*/
+        (void)memcpy(buffer, representation, buffer_length - 1);
+        buffer[buffer_length - 1] = '\0';
+    }
+
+    /* Codes_SRS_TIME_TO_STRING_01_013: [ timestamp_to_string, timestamp_microseconds_to_string and duration_to_string shall return the number of characters of the representation, excluding the zero terminator. ]*/
+    return (int)length;
+}
+
+int timestamp_to_string(int64_t nanoseconds_since_epoch, char* buffer, size_t buffer_length)
+{
+    int result;
+
+    if ((buffer == NULL) && (buffer_length > 0))
+    {
+        /* Codes_SRS_TIME_TO_STRING_01_001: [ If buffer is NULL and buffer_length is greater than 0, timestamp_to_string shall fail and return a negative value. ]*/
+        (void)printf("Invalid arguments: int64_t nanoseconds_since_epoch=%" PRId64 ", char* buffer=%p, size_t buffer_length=%zu\r\n",
+            nanoseconds_since_epoch, buffer, buffer_length);
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_TIME_TO_STRING_01_002: [ timestamp_to_string shall produce the UTC date and time of nanoseconds_since_epoch in the ISO 8601 form YYYY-MM-DDTHH:MM:SS.nnnnnnnnnZ, using the proleptic Gregorian calendar. ]*/
+        /* Codes_SRS_TIME_TO_STRING_01_003: [ timestamp_to_string shall compute the date and time of day without calling gmtime, gmtime_r or strftime. ]*/
+        /* Codes_SRS_TIME_TO_STRING_01_004: [ timestamp_to_string shall keep, per thread, the YYYY-MM-DDTHH:MM:SS text of the last second it rendered and reuse it when rendering a timestamp in the same second. ]*/
+        char representation[TIMESTAMP_TO_STRING_LENGTH];
+        result = copy_representation(representation, write_timestamp(representation, nanoseconds_since_epoch, 9), buffer, buffer_length);
+    }
+
+    return result;
+}
+
+int timestamp_microseconds_to_string(int64_t nanoseconds_since_epoch, char* buffer, size_t buffer_length)
+{
+    int result;
+
+    if ((buffer == NULL) && (buffer_length > 0))
+    {
+        /* Codes_SRS_TIME_TO_STRING_01_014: [ If buffer is NULL and buffer_length is greater than 0, timestamp_microseconds_to_string shall fail and return a negative value. ]*/
+        (void)printf("Invalid arguments: int64_t nanoseconds_since_epoch=%" PRId64 ", char* buffer=%p, size_t buffer_length=%zu\r\n",
+            nanoseconds_since_epoch, buffer, buffer_length);
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_TIME_TO_STRING_01_015: [ timestamp_microseconds_to_string shall produce the UTC date and time of nanoseconds_since_epoch in the ISO 8601 form YYYY-MM-DDTHH:MM:SS.uuuuuuZ, with the microseconds truncated. ]*/
+        /* Codes_SRS_TIME_TO_STRING_01_016: [ timestamp_microseconds_to_string shall share with timestamp_to_string the per thread YYYY-MM-DDTHH:MM:SS text of the last second rendered. ]*/
+        char representation[TIMESTAMP_MICROSECONDS_TO_STRING_LENGTH];
+        result = copy_representation(representation, write_timestamp(representation, nanoseconds_since_epoch, 6), buffer, buffer_length);
+    }
+
+    return result;
+}
+
+int duration_to_string(int64_t nanoseconds, char* buffer, size_t buffer_length)
+{
+    int result;
+
+    if ((buffer == NULL) && (buffer_length > 0))
+    {
+        /* Codes_SRS_TIME_TO_STRING_01_005: [ If buffer is NULL and buffer_length is greater than 0, duration_to_string shall fail and return a negative value. ]*/
+        (void)printf("Invalid arguments: int64_t nanoseconds=%" PRId64 ", char* buffer=%p, size_t buffer_length=%zu\r\n",
+            nanoseconds, buffer, buffer_length);
+        result = -1;
+    }
+    else
+    {
+        /* Codes_SRS_TIME_TO_STRING_01_006: [ If nanoseconds is negative, duration_to_string shall produce - followed by the representation of its magnitude. ]*/
+        /* Codes_SRS_TIME_TO_STRING_01_007: [ If the magnitude is less than 1 microsecond, duration_to_string shall produce the number of nanoseconds followed by ns. ]*/
+        /* Codes_SRS_TIME_TO_STRING_01_008: [ If the magnitude is less than 1 second, duration_to_string shall produce the number of microseconds (respectively milliseconds) with 3 decimals, truncated, followed by us (respectively ms). ]*/
+        /* Codes_SRS_TIME_TO_STRING_01_009: [ Otherwise duration_to_string shall produce the number of days followed by d, hours followed by h and minutes followed by m, omitting the leading units that are 0 and using 2 digits for all but the first unit, followed by the seconds with 3 decimals, truncated, and s. ]*/
+        char representation[DURATION_TO_STRING_MAX_LENGTH];
+        result = copy_representation(representation, write_duration(representation, nanoseconds), buffer, buffer_length);
+    }
+
+    return result;
+}
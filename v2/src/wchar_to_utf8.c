@@ -0,0 +1,248 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <limits.h>
+#include <string.h>
+#include <wchar.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define WCHAR_TO_UTF8_USE_SSE2
+#include <emmintrin.h>
+#endif
+
+#include "c_logging/wchar_to_utf8.h"
+
+#if WCHAR_MAX > 0xFFFF
+// UTF-32: one wchar_t is at most 4 UTF-8 bytes
+#define MAX_UTF8_BYTES_PER_WCHAR 4
+#else
+// UTF-16: a surrogate pair (2 wchar_t) is 4 UTF-8 bytes, any other wchar_t is at most 3 UTF-8 bytes
+#define MAX_UTF8_BYTES_PER_WCHAR 3
+#endif
+
+#define REPLACEMENT_CHARACTER 0xFFFD
+
+#define ASCII_BLOCK_SIZE 16
+
+#ifdef WCHAR_TO_UTF8_USE_SSE2
+// checks whether the 16 wchar_t at source are all ASCII (OR-ing them together and masking the bits above 0x7F)
+// and if so narrows them to 16 bytes at destination (unless destination is NULL)
+static bool convert_ascii_block(char* destination, const wchar_t* source)
+{
+    bool result;
+#if WCHAR_MAX > 0xFFFF
+    const __m128i non_ascii_mask = _mm_set1_epi32(~0x7F);
+
+    __m128i input_0 = _mm_loadu_si128((const __m128i*)source);
+    __m128i input_1 = _mm_loadu_si128((const __m128i*)source + 1);
+    __m128i input_2 = _mm_loadu_si128((const __m128i*)source + 2);
+    __m128i input_3 = _mm_loadu_si128((const __m128i*)source + 3);
+    __m128i non_ascii_bits = _mm_and_si128(_mm_or_si128(_mm_or_si128(input_0, input_1), _mm_or_si128(input_2, input_3)), non_ascii_mask);
+
+    result = (_mm_movemask_epi8(_mm_cmpeq_epi32(non_ascii_bits, _mm_setzero_si128())) == 0xFFFF);
+    if (result && (destination != NULL))
+    {
+        _mm_storeu_si128((__m128i*)destination, _mm_packus_epi16(_mm_packs_epi32(input_0, input_1), _mm_packs_epi32(input_2, input_3)));
+    }
+#else
+    const __m128i non_ascii_mask = _mm_set1_epi16((short)0xFF80);
+
+    __m128i input_0 = _mm_loadu_si128((const __m128i*)source);
+    __m128i input_1 = _mm_loadu_si128((const __m128i*)source + 1);
+    __m128i non_ascii_bits = _mm_and_si128(_mm_or_si128(input_0, input_1), non_ascii_mask);
+
+    result = (_mm_movemask_epi8(_mm_cmpeq_epi16(non_ascii_bits, _mm_setzero_si128())) == 0xFFFF);
+    if (result && (destination != NULL))
+    {
+        _mm_storeu_si128((__m128i*)destination, _mm_packus_epi16(input_0, input_1));
+    }
+#endif
+    return result;
+}
+#endif
+
+// wchar_t strings stored in a log context are not necessarily aligned for wchar_t (and the vectorized
+// wcslen implementations rely on that alignment), so the code units are read with memcpy
+static wchar_t read_code_unit(const wchar_t* source, size_t index)
+{
+    wchar_t result;
+    (void)memcpy(&result, (const unsigned char*)source + (index * sizeof(wchar_t)), sizeof(wchar_t));
+    return result;
+}
+
+static size_t get_string_length(const wchar_t* source)
+{
+    size_t result = 0;
+    while (read_code_unit(source, result) != L'\0')
+    {
+        result++;
+    }
+    return result;
+}
+
+// reads the code point starting at source[*index] and moves *index past it
+static uint32_t read_code_point(const wchar_t* source, size_t source_length, size_t* index)
+{
+    uint32_t result = (uint32_t)read_code_unit(source, *index);
+    (*index)++;
+
+#if WCHAR_MAX > 0xFFFF
+    if ((result > 0x10FFFF) || ((result >= 0xD800) && (result <= 0xDFFF)))
+    {
+        result = REPLACEMENT_CHARACTER;
+    }
+
+    (void)source_length;
+#else
+    if ((result >= 0xD800) && (result <= 0xDBFF))
+    {
+        uint32_t low_surrogate = (*index < source_length) ? (uint32_t)read_code_unit(source, *index) : 0;
+        if ((low_surrogate >= 0xDC00) && (low_surrogate <= 0xDFFF))
+        {
+            result = 0x10000 + ((result - 0xD800) << 10) + (low_surrogate - 0xDC00);
+            (*index)++;
+        }
+        else
+        {
+            result = REPLACEMENT_CHARACTER;
+        }
+    }
+    else if ((result >= 0xDC00) && (result <= 0xDFFF))
+    {
+        result = REPLACEMENT_CHARACTER;
+    }
+#endif
+
+    return result;
+}
+
+static size_t get_utf8_length(uint32_t code_point)
+{
+    return (code_point < 0x80) ? 1 : (code_point < 0x800) ? 2 : (code_point < 0x10000) ? 3 : 4;
+}
+
+static void encode_code_point(char* destination, uint32_t code_point, size_t utf8_length)
+{
+    switch (utf8_length)
+    {
+    case 1:
+        destination[0] = (char)code_point;
+        break;
+    case 2:
+        destination[0] = (char)(0xC0 | (code_point >> 6));
+        destination[1] = (char)(0x80 | (code_point & 0x3F));
+        break;
+    case 3:
+        destination[0] = (char)(0xE0 | (code_point >> 12));
+        destination[1] = (char)(0x80 | ((code_point >> 6) & 0x3F));
+        destination[2] = (char)(0x80 | (code_point & 0x3F));
+        break;
+    default:
+        destination[0] = (char)(0xF0 | (code_point >> 18));
+        destination[1] = (char)(0x80 | ((code_point >> 12) & 0x3F));
+        destination[2] = (char)(0x80 | ((code_point >> 6) & 0x3F));
+        destination[3] = (char)(0x80 | (code_point & 0x3F));
+        break;
+    }
+}
+
+int wchar_to_utf8(const wchar_t* source, char* buffer, size_t buffer_length)
+{
+    int result;
+
+    if (
+        /* Codes_SRS_WCHAR_TO_UTF8_01_001: [ If source is NULL, wchar_to_utf8 shall fail and return a negative value. ]*/
+        (source == NULL) ||
+        /* Codes_SRS_WCHAR_TO_UTF8_01_002: [ If buffer is NULL and buffer_length is greater than 0, wchar_to_utf8 shall fail and return a negative value. ]*/
+        ((buffer == NULL) && (buffer_length > 0))
+        )
+    {
+        (void)printf("Invalid arguments: const wchar_t* source=%p, char* buffer=%p, size_t buffer_length=%zu\r\n",
+            (const void*)source, buffer, buffer_length);
+        result = -1;
+    }
+    else
+    {
+        size_t source_length = get_string_length(source);
+        if (source_length > INT_MAX / MAX_UTF8_BYTES_PER_WCHAR)
+        {
+            /* Codes_SRS_WCHAR_TO_UTF8_01_003: [ If the length of the UTF-8 string may not fit in an int, wchar_to_utf8 shall fail and return a negative value. ]*/
+            (void)printf("String too long: source_length=%zu\r\n", source_length);
+            result = -1;
+        }
+        else
+        {
+            size_t i = 0;
+            size_t utf8_length = 0;
+
+            if (buffer_length > 0)
+            {
+                /* Codes_SRS_WCHAR_TO_UTF8_01_004: [ wchar_to_utf8 shall write in buffer the UTF-8 encoding of the code points in source, for as many code points as fit entirely in buffer (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+                size_t room = buffer_length - 1;
+                while (i < source_length)
+                {
+#ifdef WCHAR_TO_UTF8_USE_SSE2
+                    /* Codes_SRS_WCHAR_TO_UTF8_01_007: [ When SSE2 instructions are available, wchar_to_utf8 shall check and convert runs of ASCII characters 16 at a time. ]*/
+                    if ((i + ASCII_BLOCK_SIZE <= source_length) && (utf8_length + ASCII_BLOCK_SIZE <= room) && convert_ascii_block(buffer + utf8_length, source + i))
+                    {
+                        i += ASCII_BLOCK_SIZE;
+                        utf8_length += ASCII_BLOCK_SIZE;
+                    }
+                    else
+#endif
+                    {
+                        size_t next = i;
+                        /* Codes_SRS_WCHAR_TO_UTF8_01_005: [ wchar_to_utf8 shall decode source as UTF-32 when wchar_t is 32 bits wide and as UTF-16 (combining surrogate pairs) when wchar_t is 16 bits wide. ]*/
+                        /* Codes_SRS_WCHAR_TO_UTF8_01_006: [ wchar_to_utf8 shall replace each code unit that does not encode a valid code point (an unpaired surrogate or a value above 0x10FFFF) with U+FFFD. ]*/
+                        uint32_t code_point = read_code_point(source, source_length, &next);
+                        size_t code_point_length = get_utf8_length(code_point);
+                        if (utf8_length + code_point_length > room)
+                        {
+                            break;
+                        }
+
+                        encode_code_point(buffer + utf8_length, code_point, code_point_length);
+                        utf8_length += code_point_length;
+                        i = next;
+                    }
+                }
+
+                if (i < source_length)
+                {
+                    /* Codes_SRS_WCHAR_TO_UTF8_01_009: [ If not all the code points fit, wchar_to_utf8 shall fill the rest of buffer up to buffer_length - 1 with zero terminators. ]*/
+                    // less than one character, so that the callers that take the result as the number of bytes written (like with snprintf) find no uninitialized bytes
+                    (void)memset(buffer + utf8_length, '\0', buffer_length - utf8_length);
+                }
+                else
+                {
+                    buffer[utf8_length] = '\0';
+                }
+            }
+
+            // whatever did not fit is only measured
+            while (i < source_length)
+            {
+#ifdef WCHAR_TO_UTF8_USE_SSE2
+                if ((i + ASCII_BLOCK_SIZE <= source_length) && convert_ascii_block(NULL, source + i))
+                {
+                    i += ASCII_BLOCK_SIZE;
+                    utf8_length += ASCII_BLOCK_SIZE;
+                }
+                else
+#endif
+                {
+                    utf8_length += get_utf8_length(read_code_point(source, source_length, &i));
+                }
+            }
+
+            /* Codes_SRS_WCHAR_TO_UTF8_01_008: [ wchar_to_utf8 shall succeed and return the length in bytes of the full UTF-8 string (without the zero terminator). ]*/
+            result = (int)utf8_length;
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,192 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/binary_to_hex_string.h"
+
+#define TEST_DATA_SIZE 256
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+// builds the expected hex representation with snprintf and "%02x", the way it was done by hand before
+static void build_expected(const uint8_t* data, size_t data_length, char* expected)
+{
+    for (size_t i = 0; i < data_length; i++)
+    {
+        (void)snprintf(&expected[i * 2], 3, "%02x", data[i]);
+    }
+    expected[data_length * 2] = '\0';
+}
+
+static void fill_all_byte_values(uint8_t data[TEST_DATA_SIZE])
+{
+    for (size_t i = 0; i < TEST_DATA_SIZE; i++)
+    {
+        data[i] = (uint8_t)(i * 167 + 13);
+    }
+}
+
+/* binary_to_hex_string */
+
+/* Tests_SRS_BINARY_TO_HEX_STRING_01_001: [ If data is NULL and data_length is greater than 0, binary_to_hex_string shall fail and return a negative value. ]*/
+static void binary_to_hex_string_with_NULL_data_and_non_zero_data_length_fails(void)
+{
+    // arrange
+    char buffer[8];
+
+    // act
+    int result = binary_to_hex_string(NULL, 1, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_BINARY_TO_HEX_STRING_01_002: [ If buffer is NULL and buffer_length is greater than 0, binary_to_hex_string shall fail and return a negative value. ]*/
+static void binary_to_hex_string_with_NULL_buffer_and_non_zero_buffer_length_fails(void)
+{
+    // arrange
+    uint8_t data[] = { 0x42 };
+
+    // act
+    int result = binary_to_hex_string(data, sizeof(data), NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_BINARY_TO_HEX_STRING_01_003: [ If the length of the hex representation does not fit in an int, binary_to_hex_string shall fail and return a negative value. ]*/
+static void binary_to_hex_string_with_data_length_too_big_fails(void)
+{
+    // arrange
+    uint8_t data[] = { 0x42 };
+
+    // act
+    int result = binary_to_hex_string(data, (size_t)INT_MAX / 2 + 1, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_BINARY_TO_HEX_STRING_01_004: [ binary_to_hex_string shall write in buffer 2 lowercase hex digits for each byte of data, for as many bytes as fit entirely in buffer (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+/* Tests_SRS_BINARY_TO_HEX_STRING_01_006: [ binary_to_hex_string shall succeed and return the length of the full hex representation of data (2 * data_length). ]*/
+static void binary_to_hex_string_succeeds(void)
+{
+    // arrange
+    uint8_t data[] = { 0x00, 0x01, 0x7F, 0x80, 0x9A, 0xBC, 0xDE, 0xFF };
+    char buffer[32];
+
+    // act
+    int result = binary_to_hex_string(data, sizeof(data), buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 16);
+    POOR_MANS_ASSERT(strcmp(buffer, "00017f809abcdeff") == 0);
+}
+
+/* Tests_SRS_BINARY_TO_HEX_STRING_01_004: [ binary_to_hex_string shall write in buffer 2 lowercase hex digits for each byte of data, for as many bytes as fit entirely in buffer (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+/* Tests_SRS_BINARY_TO_HEX_STRING_01_005: [ binary_to_hex_string shall encode the bytes 16 at a time using SSE2 instructions when they are available. ]*/
+/* Tests_SRS_BINARY_TO_HEX_STRING_01_006: [ binary_to_hex_string shall succeed and return the length of the full hex representation of data (2 * data_length). ]*/
+static void binary_to_hex_string_matches_snprintf_for_all_byte_values_and_data_lengths(void)
+{
+    // arrange
+    uint8_t data[TEST_DATA_SIZE];
+    char expected[TEST_DATA_SIZE * 2 + 1];
+    char actual[TEST_DATA_SIZE * 2 + 2];
+    fill_all_byte_values(data);
+
+    // act
+    // assert
+    // covers the 16 byte blocks, the bytes left after them and the data not being aligned
+    for (size_t offset = 0; offset < 4; offset++)
+    {
+        for (size_t data_length = 0; data_length <= TEST_DATA_SIZE - offset; data_length++)
+        {
+            build_expected(data + offset, data_length, expected);
+            (void)memset(actual, 'x', sizeof(actual));
+            POOR_MANS_ASSERT(binary_to_hex_string(data + offset, data_length, actual, sizeof(actual)) == (int)(data_length * 2));
+            POOR_MANS_ASSERT(strcmp(actual, expected) == 0);
+            POOR_MANS_ASSERT(actual[data_length * 2 + 1] == 'x');
+        }
+    }
+}
+
+/* Tests_SRS_BINARY_TO_HEX_STRING_01_004: [ binary_to_hex_string shall write in buffer 2 lowercase hex digits for each byte of data, for as many bytes as fit entirely in buffer (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+/* Tests_SRS_BINARY_TO_HEX_STRING_01_006: [ binary_to_hex_string shall succeed and return the length of the full hex representation of data (2 * data_length). ]*/
+static void binary_to_hex_string_truncates_to_whole_bytes_for_all_buffer_lengths(void)
+{
+    // arrange
+    uint8_t data[40];
+    char expected[sizeof(data) * 2 + 1];
+    char actual[sizeof(data) * 2 + 2];
+    for (size_t i = 0; i < sizeof(data); i++)
+    {
+        data[i] = (uint8_t)(0xF0 - i);
+    }
+    build_expected(data, sizeof(data), expected);
+
+    // act
+    // assert
+    for (size_t buffer_length = 1; buffer_length <= sizeof(expected); buffer_length++)
+    {
+        size_t expected_byte_count = (buffer_length - 1) / 2;
+        (void)memset(actual, 'x', sizeof(actual));
+        POOR_MANS_ASSERT(binary_to_hex_string(data, sizeof(data), actual, buffer_length) == (int)(sizeof(data) * 2));
+        POOR_MANS_ASSERT(strlen(actual) == expected_byte_count * 2);
+        POOR_MANS_ASSERT(strncmp(actual, expected, expected_byte_count * 2) == 0);
+        POOR_MANS_ASSERT(actual[buffer_length] == 'x');
+    }
+}
+
+/* Tests_SRS_BINARY_TO_HEX_STRING_01_006: [ binary_to_hex_string shall succeed and return the length of the full hex representation of data (2 * data_length). ]*/
+static void binary_to_hex_string_with_NULL_buffer_and_0_buffer_length_returns_the_length(void)
+{
+    // arrange
+    uint8_t data[33] = { 0 };
+
+    // act
+    int result = binary_to_hex_string(data, sizeof(data), NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == 66);
+}
+
+/* Tests_SRS_BINARY_TO_HEX_STRING_01_004: [ binary_to_hex_string shall write in buffer 2 lowercase hex digits for each byte of data, for as many bytes as fit entirely in buffer (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+static void binary_to_hex_string_with_NULL_data_and_0_data_length_produces_an_empty_string(void)
+{
+    // arrange
+    char buffer[4] = "xxx";
+
+    // act
+    int result = binary_to_hex_string(NULL, 0, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(buffer[0] == '\0');
+}
+
+int main(void)
+{
+    binary_to_hex_string_with_NULL_data_and_non_zero_data_length_fails();
+    binary_to_hex_string_with_NULL_buffer_and_non_zero_buffer_length_fails();
+    binary_to_hex_string_with_data_length_too_big_fails();
+    binary_to_hex_string_succeeds();
+    binary_to_hex_string_matches_snprintf_for_all_byte_values_and_data_lengths();
+    binary_to_hex_string_truncates_to_whole_bytes_for_all_buffer_lengths();
+    binary_to_hex_string_with_NULL_buffer_and_0_buffer_length_returns_the_length();
+    binary_to_hex_string_with_NULL_data_and_0_data_length_produces_an_empty_string();
+
+    return 0;
+}
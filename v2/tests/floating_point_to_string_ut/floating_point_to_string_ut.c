@@ -0,0 +1,309 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/floating_point_to_string.h"
+
+#define TEST_BUFFER_SIZE 64
+#define RANDOM_VALUE_COUNT 100000
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+static uint64_t random_state = 0x2545F4914F6CDD1DULL;
+
+// xorshift, so that the values are the same on all platforms
+static uint64_t next_random(void)
+{
+    random_state ^= random_state << 13;
+    random_state ^= random_state >> 7;
+    random_state ^= random_state << 17;
+    return random_state;
+}
+
+// checks the output of floating_point_to_string_double for a big enough buffer and for all the buffer sizes that truncate it
+static void assert_double_to_string(double value, const char* expected)
+{
+    char actual[TEST_BUFFER_SIZE];
+    int expected_length = (int)strlen(expected);
+
+    POOR_MANS_ASSERT(floating_point_to_string_double(value, actual, sizeof(actual)) == expected_length);
+    POOR_MANS_ASSERT(strcmp(actual, expected) == 0);
+
+    for (size_t buffer_length = 1; buffer_length <= (size_t)expected_length; buffer_length++)
+    {
+        (void)memset(actual, 'x', sizeof(actual));
+        POOR_MANS_ASSERT(floating_point_to_string_double(value, actual, buffer_length) == expected_length);
+        POOR_MANS_ASSERT(strlen(actual) == buffer_length - 1);
+        POOR_MANS_ASSERT(strncmp(actual, expected, buffer_length - 1) == 0);
+    }
+}
+
+static void assert_float_to_string(float value, const char* expected)
+{
+    char actual[TEST_BUFFER_SIZE];
+    int expected_length = (int)strlen(expected);
+
+    POOR_MANS_ASSERT(floating_point_to_string_float(value, actual, sizeof(actual)) == expected_length);
+    POOR_MANS_ASSERT(strcmp(actual, expected) == 0);
+}
+
+/* floating_point_to_string_double */
+
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_001: [ If value is NaN, the floating_point_to_string functions shall produce nan. ]*/
+static void floating_point_to_string_double_with_NaN_succeeds(void)
+{
+    // arrange
+
+    // act
+    // assert
+    assert_double_to_string(NAN, "nan");
+    assert_double_to_string(-NAN, "nan");
+}
+
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_002: [ If value is infinite, the floating_point_to_string functions shall produce inf. ]*/
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_005: [ If value is negative (including -0 and -inf), the floating_point_to_string functions shall write a - sign first. ]*/
+static void floating_point_to_string_double_with_infinity_succeeds(void)
+{
+    // arrange
+
+    // act
+    // assert
+    assert_double_to_string(INFINITY, "inf");
+    assert_double_to_string(-INFINITY, "-inf");
+}
+
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_003: [ If value is 0, the floating_point_to_string functions shall produce 0. ]*/
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_005: [ If value is negative (including -0 and -inf), the floating_point_to_string functions shall write a - sign first. ]*/
+static void floating_point_to_string_double_with_0_succeeds(void)
+{
+    // arrange
+
+    // act
+    // assert
+    assert_double_to_string(0.0, "0");
+    assert_double_to_string(-0.0, "-0");
+}
+
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_004: [ Otherwise the floating_point_to_string functions shall compute with Grisu2 the decimal digits and the decimal exponent of a number that is inside the rounding interval of value in its own precision (float or double). ]*/
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_006: [ If the value is an integer with at most 15 digits, the floating_point_to_string functions shall write the digits followed by as many zeros as needed. ]*/
+static void floating_point_to_string_double_with_integers_succeeds(void)
+{
+    // arrange
+
+    // act
+    // assert
+    assert_double_to_string(1.0, "1");
+    assert_double_to_string(-42.0, "-42");
+    assert_double_to_string(100.0, "100");
+    assert_double_to_string(123456789012345.0, "123456789012345");
+    assert_double_to_string(999999999999999.0, "999999999999999");
+}
+
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_004: [ Otherwise the floating_point_to_string functions shall compute with Grisu2 the decimal digits and the decimal exponent of a number that is inside the rounding interval of value in its own precision (float or double). ]*/
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_007: [ If the integer part of the value is not 0 and has at most 15 digits, the floating_point_to_string functions shall write the digits with a . after the digits of the integer part. ]*/
+static void floating_point_to_string_double_with_integer_and_fractional_parts_succeeds(void)
+{
+    // arrange
+
+    // act
+    // assert
+    assert_double_to_string(1.5, "1.5");
+    assert_double_to_string(-123.456, "-123.456");
+    assert_double_to_string(12345678901234.5, "12345678901234.5");
+}
+
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_004: [ Otherwise the floating_point_to_string functions shall compute with Grisu2 the decimal digits and the decimal exponent of a number that is inside the rounding interval of value in its own precision (float or double). ]*/
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_008: [ If the absolute value is less than 1 and at least 0.0001, the floating_point_to_string functions shall write 0. followed by the zeros after the decimal point and the digits. ]*/
+static void floating_point_to_string_double_less_than_1_succeeds(void)
+{
+    // arrange
+
+    // act
+    // assert
+    assert_double_to_string(0.1, "0.1");
+    assert_double_to_string(0.3, "0.3");
+    assert_double_to_string(-0.25, "-0.25");
+    assert_double_to_string(2.0 / 3.0, "0.6666666666666666");
+    assert_double_to_string(0.0001, "0.0001");
+    assert_double_to_string(0.00012345, "0.00012345");
+}
+
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_004: [ Otherwise the floating_point_to_string functions shall compute with Grisu2 the decimal digits and the decimal exponent of a number that is inside the rounding interval of value in its own precision (float or double). ]*/
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_009: [ Otherwise the floating_point_to_string functions shall write the first digit, a . followed by the other digits if there are any, e, the sign of the exponent and the exponent with at least 2 digits. ]*/
+static void floating_point_to_string_double_with_exponent_succeeds(void)
+{
+    // arrange
+
+    // act
+    // assert
+    assert_double_to_string(1e15, "1e+15");
+    assert_double_to_string(1e21, "1e+21");
+    assert_double_to_string(1234567890123456.0, "1.234567890123456e+15");
+    assert_double_to_string(0.00001, "1e-05");
+    assert_double_to_string(-1.5e-7, "-1.5e-07");
+    assert_double_to_string(-1e100, "-1e+100");
+    assert_double_to_string(1.7976931348623157e308, "1.7976931348623157e+308");
+    assert_double_to_string(2.2250738585072014e-308, "2.2250738585072014e-308");
+    assert_double_to_string(-2.2250738585072014e-308, "-2.2250738585072014e-308");
+    assert_double_to_string(5e-324, "5e-324");
+}
+
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_004: [ Otherwise the floating_point_to_string functions shall compute with Grisu2 the decimal digits and the decimal exponent of a number that is inside the rounding interval of value in its own precision (float or double). ]*/
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_013: [ The floating_point_to_string functions shall return the number of characters of the string representation, excluding the zero terminator. ]*/
+static void floating_point_to_string_double_reads_back_as_the_same_value(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+    char longest[TEST_BUFFER_SIZE];
+
+    // act
+    // assert
+    for (uint32_t i = 0; i < RANDOM_VALUE_COUNT; i++)
+    {
+        uint64_t bits = next_random();
+        double value;
+        (void)memcpy(&value, &bits, sizeof(value));
+        if (isfinite(value))
+        {
+            int result = floating_point_to_string_double(value, buffer, sizeof(buffer));
+            POOR_MANS_ASSERT(result == (int)strlen(buffer));
+            POOR_MANS_ASSERT(result <= FLOATING_POINT_TO_STRING_MAX_LENGTH);
+            POOR_MANS_ASSERT(strtod(buffer, NULL) == value);
+            // never more digits than needed by the always round-tripping 17 digits
+            POOR_MANS_ASSERT(result <= snprintf(longest, sizeof(longest), "%.16e", value));
+        }
+    }
+}
+
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_011: [ If the string representation fits in buffer, the floating_point_to_string functions shall copy it to buffer, followed by a zero terminator. ]*/
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_012: [ Otherwise the floating_point_to_string functions shall copy the first buffer_length - 1 characters of the string representation to buffer, followed by a zero terminator. ]*/
+static void floating_point_to_string_double_with_just_enough_big_buffer_succeeds(void)
+{
+    // arrange
+    char buffer[6];
+
+    // act
+    int result = floating_point_to_string_double(-1.25, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(strcmp(buffer, "-1.25") == 0);
+}
+
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_010: [ If buffer is NULL or buffer_length is 0, the floating_point_to_string functions shall only return the length of the string representation. ]*/
+static void floating_point_to_string_double_with_NULL_buffer_returns_the_length(void)
+{
+    // arrange
+
+    // act
+    int result = floating_point_to_string_double(-1.25e-100, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == 10);
+}
+
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_010: [ If buffer is NULL or buffer_length is 0, the floating_point_to_string functions shall only return the length of the string representation. ]*/
+static void floating_point_to_string_double_with_0_buffer_length_does_not_write(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+    buffer[0] = 'x';
+
+    // act
+    int result = floating_point_to_string_double(0.5, buffer, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == 3);
+    POOR_MANS_ASSERT(buffer[0] == 'x');
+}
+
+/* floating_point_to_string_float */
+
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_001: [ If value is NaN, the floating_point_to_string functions shall produce nan. ]*/
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_002: [ If value is infinite, the floating_point_to_string functions shall produce inf. ]*/
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_003: [ If value is 0, the floating_point_to_string functions shall produce 0. ]*/
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_005: [ If value is negative (including -0 and -inf), the floating_point_to_string functions shall write a - sign first. ]*/
+static void floating_point_to_string_float_with_special_values_succeeds(void)
+{
+    // arrange
+
+    // act
+    // assert
+    assert_float_to_string(NAN, "nan");
+    assert_float_to_string(INFINITY, "inf");
+    assert_float_to_string(-INFINITY, "-inf");
+    assert_float_to_string(0.0f, "0");
+    assert_float_to_string(-0.0f, "-0");
+}
+
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_004: [ Otherwise the floating_point_to_string functions shall compute with Grisu2 the decimal digits and the decimal exponent of a number that is inside the rounding interval of value in its own precision (float or double). ]*/
+static void floating_point_to_string_float_uses_the_float_precision(void)
+{
+    // arrange
+
+    // act
+    // assert
+    assert_float_to_string(0.1f, "0.1");
+    assert_float_to_string(123.456f, "123.456");
+    assert_float_to_string(1.0f / 3.0f, "0.33333334");
+    assert_float_to_string(16777216.0f, "16777216");
+    assert_float_to_string(3.4028235e38f, "3.4028235e+38");
+    assert_float_to_string(1.17549435e-38f, "1.1754944e-38");
+    assert_float_to_string(1e-45f, "1e-45");
+}
+
+/* Tests_SRS_FLOATING_POINT_TO_STRING_01_004: [ Otherwise the floating_point_to_string functions shall compute with Grisu2 the decimal digits and the decimal exponent of a number that is inside the rounding interval of value in its own precision (float or double). ]*/
+static void floating_point_to_string_float_reads_back_as_the_same_value(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+
+    // act
+    // assert
+    for (uint32_t i = 0; i < RANDOM_VALUE_COUNT; i++)
+    {
+        uint32_t bits = (uint32_t)next_random();
+        float value;
+        (void)memcpy(&value, &bits, sizeof(value));
+        if (isfinite(value))
+        {
+            int result = floating_point_to_string_float(value, buffer, sizeof(buffer));
+            POOR_MANS_ASSERT(result == (int)strlen(buffer));
+            POOR_MANS_ASSERT(strtof(buffer, NULL) == value);
+        }
+    }
+}
+
+int main(void)
+{
+    floating_point_to_string_double_with_NaN_succeeds();
+    floating_point_to_string_double_with_infinity_succeeds();
+    floating_point_to_string_double_with_0_succeeds();
+    floating_point_to_string_double_with_integers_succeeds();
+    floating_point_to_string_double_with_integer_and_fractional_parts_succeeds();
+    floating_point_to_string_double_less_than_1_succeeds();
+    floating_point_to_string_double_with_exponent_succeeds();
+    floating_point_to_string_double_reads_back_as_the_same_value();
+    floating_point_to_string_double_with_just_enough_big_buffer_succeeds();
+    floating_point_to_string_double_with_NULL_buffer_returns_the_length();
+    floating_point_to_string_double_with_0_buffer_length_does_not_write();
+
+    floating_point_to_string_float_with_special_values_succeeds();
+    floating_point_to_string_float_uses_the_float_precision();
+    floating_point_to_string_float_reads_back_as_the_same_value();
+
+    return 0;
+}
@@ -0,0 +1,308 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/identifier_to_string.h"
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+static const uint8_t test_uuid[16] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xFE, 0xDC, 0xBA, 0x98, 0x76, 0x54, 0x32, 0x10 };
+static const char test_uuid_string[] = "01234567-89ab-cdef-fedc-ba9876543210";
+
+typedef struct IPV6_TEST_CASE_TAG
+{
+    uint8_t address[16];
+    const char* expected;
+} IPV6_TEST_CASE;
+
+static const IPV6_TEST_CASE ipv6_test_cases[] =
+{
+    { { 0 }, "::" },
+    { { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 }, "::1" },
+    { { 0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 }, "2001:db8::" },
+    { { 0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 }, "2001:db8::1" },
+    // a single zero group is not compressed
+    { { 0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1 }, "2001:db8:0:1:1:1:1:1" },
+    // the longest run is compressed
+    { { 0x20, 0x01, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1 }, "2001:0:0:1::1" },
+    // the first of 2 runs of the same length is compressed
+    { { 0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1 }, "2001:db8::1:0:0:1" },
+    { { 0xFE, 0x80, 0, 0, 0, 0, 0, 0, 0x02, 0x1A, 0x2B, 0xFF, 0xFE, 0x3C, 0x4D, 0x5E }, "fe80::21a:2bff:fe3c:4d5e" },
+    { { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF }, "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff" },
+    { { 0, 0x10, 0x02, 0, 0x03, 0x40, 0, 0x05, 0x60, 0x70, 0, 0, 0x0A, 0xBC, 0, 0 }, "10:200:340:5:6070:0:abc:0" },
+    // IPv4-mapped addresses end with the dotted decimal form
+    { { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF, 192, 168, 1, 42 }, "::ffff:192.168.1.42" },
+};
+
+/* uuid_to_string */
+
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_001: [ If the identifier (uuid or address) is NULL, the identifier_to_string functions shall fail and return a negative value. ]*/
+static void uuid_to_string_with_NULL_uuid_fails(void)
+{
+    // arrange
+    char buffer[UUID_TO_STRING_LENGTH + 1];
+
+    // act
+    int result = uuid_to_string(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_002: [ If buffer is NULL and buffer_length is greater than 0, the identifier_to_string functions shall fail and return a negative value. ]*/
+static void uuid_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails(void)
+{
+    // arrange
+
+    // act
+    int result = uuid_to_string(test_uuid, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_003: [ uuid_to_string shall produce the 16 bytes of uuid as lowercase hex digits in 5 groups of 8, 4, 4, 4 and 12 digits separated by -. ]*/
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_009: [ If the representation fits in buffer, the identifier_to_string functions shall write it in buffer followed by a zero terminator. ]*/
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_011: [ The identifier_to_string functions shall return the number of characters of the representation, excluding the zero terminator. ]*/
+static void uuid_to_string_succeeds(void)
+{
+    // arrange
+    char buffer[UUID_TO_STRING_LENGTH + 1];
+
+    // act
+    int result = uuid_to_string(test_uuid, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == UUID_TO_STRING_LENGTH);
+    POOR_MANS_ASSERT(strcmp(buffer, test_uuid_string) == 0);
+}
+
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_008: [ If buffer_length is 0, the identifier_to_string functions shall only return the length of the representation. ]*/
+static void uuid_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length(void)
+{
+    // arrange
+
+    // act
+    int result = uuid_to_string(test_uuid, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == UUID_TO_STRING_LENGTH);
+}
+
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_010: [ Otherwise the identifier_to_string functions shall write the first buffer_length - 1 characters of the representation in buffer, followed by a zero terminator. ]*/
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_011: [ The identifier_to_string functions shall return the number of characters of the representation, excluding the zero terminator. ]*/
+static void uuid_to_string_truncates_for_all_buffer_lengths(void)
+{
+    // arrange
+    char buffer[UUID_TO_STRING_LENGTH + 2];
+
+    // act
+    // assert
+    for (size_t buffer_length = 1; buffer_length <= UUID_TO_STRING_LENGTH; buffer_length++)
+    {
+        (void)memset(buffer, 'x', sizeof(buffer));
+        POOR_MANS_ASSERT(uuid_to_string(test_uuid, buffer, buffer_length) == UUID_TO_STRING_LENGTH);
+        POOR_MANS_ASSERT(strlen(buffer) == buffer_length - 1);
+        POOR_MANS_ASSERT(strncmp(buffer, test_uuid_string, buffer_length - 1) == 0);
+        POOR_MANS_ASSERT(buffer[buffer_length] == 'x');
+    }
+}
+
+/* ipv4_address_to_string */
+
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_001: [ If the identifier (uuid or address) is NULL, the identifier_to_string functions shall fail and return a negative value. ]*/
+static void ipv4_address_to_string_with_NULL_address_fails(void)
+{
+    // arrange
+    char buffer[IPV4_ADDRESS_TO_STRING_MAX_LENGTH + 1];
+
+    // act
+    int result = ipv4_address_to_string(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_002: [ If buffer is NULL and buffer_length is greater than 0, the identifier_to_string functions shall fail and return a negative value. ]*/
+static void ipv4_address_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails(void)
+{
+    // arrange
+    uint8_t address[4] = { 127, 0, 0, 1 };
+
+    // act
+    int result = ipv4_address_to_string(address, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_004: [ ipv4_address_to_string shall produce the 4 bytes of address as decimal numbers separated by .. ]*/
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_009: [ If the representation fits in buffer, the identifier_to_string functions shall write it in buffer followed by a zero terminator. ]*/
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_011: [ The identifier_to_string functions shall return the number of characters of the representation, excluding the zero terminator. ]*/
+static void ipv4_address_to_string_matches_snprintf_for_all_byte_values(void)
+{
+    // arrange
+    char expected[IPV4_ADDRESS_TO_STRING_MAX_LENGTH + 1];
+    char actual[IPV4_ADDRESS_TO_STRING_MAX_LENGTH + 1];
+
+    // act
+    // assert
+    for (uint32_t value = 0; value < 256; value++)
+    {
+        uint8_t address[4] = { (uint8_t)value, (uint8_t)(255 - value), (uint8_t)(value * 7), (uint8_t)(value / 3) };
+        int expected_length = snprintf(expected, sizeof(expected), "%u.%u.%u.%u", address[0], address[1], address[2], address[3]);
+        POOR_MANS_ASSERT(ipv4_address_to_string(address, actual, sizeof(actual)) == expected_length);
+        POOR_MANS_ASSERT(strcmp(actual, expected) == 0);
+    }
+}
+
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_010: [ Otherwise the identifier_to_string functions shall write the first buffer_length - 1 characters of the representation in buffer, followed by a zero terminator. ]*/
+static void ipv4_address_to_string_truncates_for_all_buffer_lengths(void)
+{
+    // arrange
+    uint8_t address[4] = { 255, 255, 255, 255 };
+    char buffer[IPV4_ADDRESS_TO_STRING_MAX_LENGTH + 2];
+
+    // act
+    // assert
+    for (size_t buffer_length = 1; buffer_length <= IPV4_ADDRESS_TO_STRING_MAX_LENGTH; buffer_length++)
+    {
+        (void)memset(buffer, 'x', sizeof(buffer));
+        POOR_MANS_ASSERT(ipv4_address_to_string(address, buffer, buffer_length) == IPV4_ADDRESS_TO_STRING_MAX_LENGTH);
+        POOR_MANS_ASSERT(strlen(buffer) == buffer_length - 1);
+        POOR_MANS_ASSERT(strncmp(buffer, "255.255.255.255", buffer_length - 1) == 0);
+        POOR_MANS_ASSERT(buffer[buffer_length] == 'x');
+    }
+}
+
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_008: [ If buffer_length is 0, the identifier_to_string functions shall only return the length of the representation. ]*/
+static void ipv4_address_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length(void)
+{
+    // arrange
+    uint8_t address[4] = { 10, 0, 0, 1 };
+
+    // act
+    int result = ipv4_address_to_string(address, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == 8);
+}
+
+/* ipv6_address_to_string */
+
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_001: [ If the identifier (uuid or address) is NULL, the identifier_to_string functions shall fail and return a negative value. ]*/
+static void ipv6_address_to_string_with_NULL_address_fails(void)
+{
+    // arrange
+    char buffer[IPV6_ADDRESS_TO_STRING_MAX_LENGTH + 1];
+
+    // act
+    int result = ipv6_address_to_string(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_002: [ If buffer is NULL and buffer_length is greater than 0, the identifier_to_string functions shall fail and return a negative value. ]*/
+static void ipv6_address_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails(void)
+{
+    // arrange
+
+    // act
+    int result = ipv6_address_to_string(ipv6_test_cases[0].address, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_005: [ ipv6_address_to_string shall produce the 8 groups of 16 bits of address as lowercase hex digits without leading zeros, separated by :. ]*/
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_006: [ ipv6_address_to_string shall replace the longest run of 2 or more zero groups (the first one when several runs have the same length) with ::. ]*/
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_007: [ For an IPv4-mapped address (::ffff:0:0/96), ipv6_address_to_string shall produce ::ffff: followed by the dotted decimal form of the last 4 bytes. ]*/
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_009: [ If the representation fits in buffer, the identifier_to_string functions shall write it in buffer followed by a zero terminator. ]*/
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_011: [ The identifier_to_string functions shall return the number of characters of the representation, excluding the zero terminator. ]*/
+static void ipv6_address_to_string_produces_the_RFC_5952_text_form(void)
+{
+    // arrange
+    char buffer[IPV6_ADDRESS_TO_STRING_MAX_LENGTH + 1];
+
+    // act
+    // assert
+    for (size_t i = 0; i < sizeof(ipv6_test_cases) / sizeof(ipv6_test_cases[0]); i++)
+    {
+        (void)memset(buffer, 'x', sizeof(buffer));
+        int result = ipv6_address_to_string(ipv6_test_cases[i].address, buffer, sizeof(buffer));
+        if (strcmp(buffer, ipv6_test_cases[i].expected) != 0)
+        {
+            (void)printf("Expected %s, actual %s\r\n", ipv6_test_cases[i].expected, buffer);
+        }
+        POOR_MANS_ASSERT(result == (int)strlen(ipv6_test_cases[i].expected));
+        POOR_MANS_ASSERT(strcmp(buffer, ipv6_test_cases[i].expected) == 0);
+    }
+}
+
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_010: [ Otherwise the identifier_to_string functions shall write the first buffer_length - 1 characters of the representation in buffer, followed by a zero terminator. ]*/
+static void ipv6_address_to_string_truncates_for_all_buffer_lengths(void)
+{
+    // arrange
+    const IPV6_TEST_CASE* test_case = &ipv6_test_cases[7];
+    size_t expected_length = strlen(test_case->expected);
+    char buffer[IPV6_ADDRESS_TO_STRING_MAX_LENGTH + 2];
+
+    // act
+    // assert
+    for (size_t buffer_length = 1; buffer_length <= expected_length; buffer_length++)
+    {
+        (void)memset(buffer, 'x', sizeof(buffer));
+        POOR_MANS_ASSERT(ipv6_address_to_string(test_case->address, buffer, buffer_length) == (int)expected_length);
+        POOR_MANS_ASSERT(strlen(buffer) == buffer_length - 1);
+        POOR_MANS_ASSERT(strncmp(buffer, test_case->expected, buffer_length - 1) == 0);
+        POOR_MANS_ASSERT(buffer[buffer_length] == 'x');
+    }
+}
+
+/* Tests_SRS_IDENTIFIER_TO_STRING_01_008: [ If buffer_length is 0, the identifier_to_string functions shall only return the length of the representation. ]*/
+static void ipv6_address_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length(void)
+{
+    // arrange
+
+    // act
+    int result = ipv6_address_to_string(ipv6_test_cases[8].address, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == IPV6_ADDRESS_TO_STRING_MAX_LENGTH);
+}
+
+int main(void)
+{
+    uuid_to_string_with_NULL_uuid_fails();
+    uuid_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails();
+    uuid_to_string_succeeds();
+    uuid_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length();
+    uuid_to_string_truncates_for_all_buffer_lengths();
+
+    ipv4_address_to_string_with_NULL_address_fails();
+    ipv4_address_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails();
+    ipv4_address_to_string_matches_snprintf_for_all_byte_values();
+    ipv4_address_to_string_truncates_for_all_buffer_lengths();
+    ipv4_address_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length();
+
+    ipv6_address_to_string_with_NULL_address_fails();
+    ipv6_address_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails();
+    ipv6_address_to_string_produces_the_RFC_5952_text_form();
+    ipv6_address_to_string_truncates_for_all_buffer_lengths();
+    ipv6_address_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length();
+
+    return 0;
+}
@@ -0,0 +1,387 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/integer_to_string.h"
+
+#define TEST_BUFFER_SIZE 64
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+// checks the output of integer_to_string_uint64 against snprintf for all buffer sizes
+static void assert_uint64_matches_snprintf(uint64_t value)
+{
+    char expected[TEST_BUFFER_SIZE];
+    char actual[TEST_BUFFER_SIZE];
+    int expected_length = snprintf(expected, sizeof(expected), "%" PRIu64, value);
+
+    for (size_t buffer_length = 1; buffer_length <= (size_t)expected_length + 1; buffer_length++)
+    {
+        (void)memset(actual, 'x', sizeof(actual));
+        (void)snprintf(expected, buffer_length, "%" PRIu64, value);
+        POOR_MANS_ASSERT(integer_to_string_uint64(value, actual, buffer_length) == expected_length);
+        POOR_MANS_ASSERT(strcmp(actual, expected) == 0);
+    }
+}
+
+static void assert_int64_matches_snprintf(int64_t value)
+{
+    char expected[TEST_BUFFER_SIZE];
+    char actual[TEST_BUFFER_SIZE];
+    int expected_length = snprintf(expected, sizeof(expected), "%" PRId64, value);
+
+    for (size_t buffer_length = 1; buffer_length <= (size_t)expected_length + 1; buffer_length++)
+    {
+        (void)memset(actual, 'x', sizeof(actual));
+        (void)snprintf(expected, buffer_length, "%" PRId64, value);
+        POOR_MANS_ASSERT(integer_to_string_int64(value, actual, buffer_length) == expected_length);
+        POOR_MANS_ASSERT(strcmp(actual, expected) == 0);
+    }
+}
+
+static void assert_uint32_matches_snprintf(uint32_t value)
+{
+    char expected[TEST_BUFFER_SIZE];
+    char actual[TEST_BUFFER_SIZE];
+    int expected_length = snprintf(expected, sizeof(expected), "%" PRIu32, value);
+
+    for (size_t buffer_length = 1; buffer_length <= (size_t)expected_length + 1; buffer_length++)
+    {
+        (void)memset(actual, 'x', sizeof(actual));
+        (void)snprintf(expected, buffer_length, "%" PRIu32, value);
+        POOR_MANS_ASSERT(integer_to_string_uint32(value, actual, buffer_length) == expected_length);
+        POOR_MANS_ASSERT(strcmp(actual, expected) == 0);
+    }
+}
+
+static void assert_int32_matches_snprintf(int32_t value)
+{
+    char expected[TEST_BUFFER_SIZE];
+    char actual[TEST_BUFFER_SIZE];
+    int expected_length = snprintf(expected, sizeof(expected), "%" PRId32, value);
+
+    for (size_t buffer_length = 1; buffer_length <= (size_t)expected_length + 1; buffer_length++)
+    {
+        (void)memset(actual, 'x', sizeof(actual));
+        (void)snprintf(expected, buffer_length, "%" PRId32, value);
+        POOR_MANS_ASSERT(integer_to_string_int32(value, actual, buffer_length) == expected_length);
+        POOR_MANS_ASSERT(strcmp(actual, expected) == 0);
+    }
+}
+
+/* integer_to_string_uint64_digit_count */
+
+/* Tests_SRS_INTEGER_TO_STRING_01_001: [ integer_to_string_uint64_digit_count shall return the number of decimal digits of value (1 for 0). ]*/
+static void integer_to_string_uint64_digit_count_around_all_powers_of_10_succeeds(void)
+{
+    // arrange
+    uint64_t power_of_10 = 1;
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(integer_to_string_uint64_digit_count(0) == 1);
+    for (uint32_t digit_count = 1; digit_count < 20; digit_count++)
+    {
+        POOR_MANS_ASSERT(integer_to_string_uint64_digit_count(power_of_10) == digit_count);
+        POOR_MANS_ASSERT(integer_to_string_uint64_digit_count(power_of_10 * 10 - 1) == digit_count);
+        power_of_10 *= 10;
+    }
+    POOR_MANS_ASSERT(integer_to_string_uint64_digit_count(power_of_10) == 20);
+    POOR_MANS_ASSERT(integer_to_string_uint64_digit_count(UINT64_MAX) == 20);
+}
+
+/* Tests_SRS_INTEGER_TO_STRING_01_001: [ integer_to_string_uint64_digit_count shall return the number of decimal digits of value (1 for 0). ]*/
+static void integer_to_string_uint64_digit_count_for_all_powers_of_2_succeeds(void)
+{
+    // arrange
+    char expected[TEST_BUFFER_SIZE];
+
+    // act
+    // assert
+    for (uint32_t i = 0; i < 64; i++)
+    {
+        uint64_t value = (uint64_t)1 << i;
+        POOR_MANS_ASSERT(integer_to_string_uint64_digit_count(value) == (uint32_t)snprintf(expected, sizeof(expected), "%" PRIu64, value));
+        POOR_MANS_ASSERT(integer_to_string_uint64_digit_count(value - 1) == (uint32_t)snprintf(expected, sizeof(expected), "%" PRIu64, value - 1));
+    }
+}
+
+/* integer_to_string_uint32_digit_count */
+
+/* Tests_SRS_INTEGER_TO_STRING_01_002: [ integer_to_string_uint32_digit_count shall return the number of decimal digits of value (1 for 0). ]*/
+static void integer_to_string_uint32_digit_count_succeeds(void)
+{
+    // arrange
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(integer_to_string_uint32_digit_count(0) == 1);
+    POOR_MANS_ASSERT(integer_to_string_uint32_digit_count(9) == 1);
+    POOR_MANS_ASSERT(integer_to_string_uint32_digit_count(10) == 2);
+    POOR_MANS_ASSERT(integer_to_string_uint32_digit_count(999999999) == 9);
+    POOR_MANS_ASSERT(integer_to_string_uint32_digit_count(1000000000) == 10);
+    POOR_MANS_ASSERT(integer_to_string_uint32_digit_count(UINT32_MAX) == 10);
+}
+
+/* integer_to_string_int64_length */
+
+/* Tests_SRS_INTEGER_TO_STRING_01_008: [ integer_to_string_int64_length shall return the number of decimal digits of the absolute value of value, plus 1 if value is negative. ]*/
+static void integer_to_string_int64_length_succeeds(void)
+{
+    // arrange
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(integer_to_string_int64_length(0) == 1);
+    POOR_MANS_ASSERT(integer_to_string_int64_length(9) == 1);
+    POOR_MANS_ASSERT(integer_to_string_int64_length(-9) == 2);
+    POOR_MANS_ASSERT(integer_to_string_int64_length(-10) == 3);
+    POOR_MANS_ASSERT(integer_to_string_int64_length(INT64_MAX) == 19);
+    POOR_MANS_ASSERT(integer_to_string_int64_length(INT64_MIN) == 20);
+}
+
+/* integer_to_string_write_uint64 */
+
+/* Tests_SRS_INTEGER_TO_STRING_01_009: [ integer_to_string_write_uint64 and integer_to_string_write_int64 shall write the decimal representation of value at buffer, 2 digits at a time, without a zero terminator. ]*/
+/* Tests_SRS_INTEGER_TO_STRING_01_010: [ integer_to_string_write_uint64 and integer_to_string_write_int64 shall return the number of characters written. ]*/
+static void integer_to_string_write_uint64_writes_values_back_to_back(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+    (void)memset(buffer, 'x', sizeof(buffer));
+    uint32_t pos = 0;
+
+    // act
+    pos += integer_to_string_write_uint64(0, buffer + pos);
+    pos += integer_to_string_write_uint64(42, buffer + pos);
+    pos += integer_to_string_write_uint64(UINT64_MAX, buffer + pos);
+
+    // assert
+    POOR_MANS_ASSERT(pos == 1 + 2 + 20);
+    POOR_MANS_ASSERT(memcmp(buffer, "04218446744073709551615", pos) == 0);
+    POOR_MANS_ASSERT(buffer[pos] == 'x');
+}
+
+/* integer_to_string_write_int64 */
+
+/* Tests_SRS_INTEGER_TO_STRING_01_011: [ For a negative value, integer_to_string_write_int64 shall write a - sign followed by the digits of the absolute value. ]*/
+/* Tests_SRS_INTEGER_TO_STRING_01_010: [ integer_to_string_write_uint64 and integer_to_string_write_int64 shall return the number of characters written. ]*/
+static void integer_to_string_write_int64_matches_snprintf(void)
+{
+    // arrange
+    static const int64_t values[] = { 0, 7, -7, 100, -100, INT32_MIN, INT64_MAX, INT64_MIN };
+
+    // act
+    // assert
+    for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+    {
+        char expected[TEST_BUFFER_SIZE];
+        char actual[TEST_BUFFER_SIZE];
+        int expected_length = snprintf(expected, sizeof(expected), "%" PRId64, values[i]);
+        (void)memset(actual, 'x', sizeof(actual));
+        POOR_MANS_ASSERT(integer_to_string_write_int64(values[i], actual) == (uint32_t)expected_length);
+        POOR_MANS_ASSERT(integer_to_string_int64_length(values[i]) == (uint32_t)expected_length);
+        POOR_MANS_ASSERT(memcmp(actual, expected, expected_length) == 0);
+        POOR_MANS_ASSERT(actual[expected_length] == 'x');
+    }
+}
+
+/* integer_to_string_uint64 */
+
+/* Tests_SRS_INTEGER_TO_STRING_01_005: [ If the decimal representation fits in buffer, the integer_to_string functions shall write it in buffer, 2 digits at a time, followed by a zero terminator. ]*/
+/* Tests_SRS_INTEGER_TO_STRING_01_003: [ The integer_to_string functions shall return the number of characters of the decimal representation of value (including the - sign for negative values), excluding the zero terminator. ]*/
+static void integer_to_string_uint64_succeeds(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+
+    // act
+    int result = integer_to_string_uint64(UINT64_MAX, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 20);
+    POOR_MANS_ASSERT(strcmp(buffer, "18446744073709551615") == 0);
+}
+
+/* Tests_SRS_INTEGER_TO_STRING_01_005: [ If the decimal representation fits in buffer, the integer_to_string functions shall write it in buffer, 2 digits at a time, followed by a zero terminator. ]*/
+/* Tests_SRS_INTEGER_TO_STRING_01_006: [ Otherwise the integer_to_string functions shall write the first buffer_length - 1 characters of the decimal representation in buffer, followed by a zero terminator. ]*/
+/* Tests_SRS_INTEGER_TO_STRING_01_003: [ The integer_to_string functions shall return the number of characters of the decimal representation of value (including the - sign for negative values), excluding the zero terminator. ]*/
+static void integer_to_string_uint64_matches_snprintf_for_all_digit_counts_and_buffer_sizes(void)
+{
+    // arrange
+    uint64_t power_of_10 = 1;
+
+    // act
+    // assert
+    assert_uint64_matches_snprintf(0);
+    for (uint32_t i = 0; i < 19; i++)
+    {
+        assert_uint64_matches_snprintf(power_of_10);
+        assert_uint64_matches_snprintf(power_of_10 * 10 - 1);
+        assert_uint64_matches_snprintf(power_of_10 * 7 + 3);
+        power_of_10 *= 10;
+    }
+    assert_uint64_matches_snprintf(power_of_10);
+    assert_uint64_matches_snprintf(UINT32_MAX);
+    assert_uint64_matches_snprintf((uint64_t)UINT32_MAX + 1);
+    assert_uint64_matches_snprintf(UINT64_MAX);
+}
+
+/* Tests_SRS_INTEGER_TO_STRING_01_004: [ If buffer is NULL or buffer_length is 0, the integer_to_string functions shall only return the length of the decimal representation. ]*/
+static void integer_to_string_uint64_with_NULL_buffer_returns_the_length(void)
+{
+    // arrange
+
+    // act
+    int result = integer_to_string_uint64(12345, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+}
+
+/* Tests_SRS_INTEGER_TO_STRING_01_004: [ If buffer is NULL or buffer_length is 0, the integer_to_string functions shall only return the length of the decimal representation. ]*/
+static void integer_to_string_uint64_with_0_buffer_length_does_not_write(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+    buffer[0] = 'x';
+
+    // act
+    int result = integer_to_string_uint64(12345, buffer, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(buffer[0] == 'x');
+}
+
+/* integer_to_string_int64 */
+
+/* Tests_SRS_INTEGER_TO_STRING_01_007: [ For a negative value, integer_to_string_int64 and integer_to_string_int32 shall write a - sign followed by the digits of the absolute value. ]*/
+static void integer_to_string_int64_with_INT64_MIN_succeeds(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+
+    // act
+    int result = integer_to_string_int64(INT64_MIN, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 20);
+    POOR_MANS_ASSERT(strcmp(buffer, "-9223372036854775808") == 0);
+}
+
+/* Tests_SRS_INTEGER_TO_STRING_01_007: [ For a negative value, integer_to_string_int64 and integer_to_string_int32 shall write a - sign followed by the digits of the absolute value. ]*/
+/* Tests_SRS_INTEGER_TO_STRING_01_006: [ Otherwise the integer_to_string functions shall write the first buffer_length - 1 characters of the decimal representation in buffer, followed by a zero terminator. ]*/
+static void integer_to_string_int64_matches_snprintf_for_all_digit_counts_and_buffer_sizes(void)
+{
+    // arrange
+    int64_t power_of_10 = 1;
+
+    // act
+    // assert
+    assert_int64_matches_snprintf(0);
+    for (uint32_t i = 0; i < 18; i++)
+    {
+        assert_int64_matches_snprintf(power_of_10);
+        assert_int64_matches_snprintf(-power_of_10);
+        assert_int64_matches_snprintf(power_of_10 * 10 - 1);
+        assert_int64_matches_snprintf(-(power_of_10 * 10 - 1));
+        power_of_10 *= 10;
+    }
+    assert_int64_matches_snprintf(INT64_MAX);
+    assert_int64_matches_snprintf(INT64_MIN);
+    assert_int64_matches_snprintf(-1);
+}
+
+/* integer_to_string_uint32 */
+
+/* Tests_SRS_INTEGER_TO_STRING_01_005: [ If the decimal representation fits in buffer, the integer_to_string functions shall write it in buffer, 2 digits at a time, followed by a zero terminator. ]*/
+/* Tests_SRS_INTEGER_TO_STRING_01_006: [ Otherwise the integer_to_string functions shall write the first buffer_length - 1 characters of the decimal representation in buffer, followed by a zero terminator. ]*/
+static void integer_to_string_uint32_matches_snprintf(void)
+{
+    // arrange
+
+    // act
+    // assert
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        assert_uint32_matches_snprintf(i);
+    }
+    assert_uint32_matches_snprintf(65535);
+    assert_uint32_matches_snprintf(999999999);
+    assert_uint32_matches_snprintf(1000000000);
+    assert_uint32_matches_snprintf(UINT32_MAX);
+}
+
+/* integer_to_string_int32 */
+
+/* Tests_SRS_INTEGER_TO_STRING_01_007: [ For a negative value, integer_to_string_int64 and integer_to_string_int32 shall write a - sign followed by the digits of the absolute value. ]*/
+static void integer_to_string_int32_matches_snprintf(void)
+{
+    // arrange
+
+    // act
+    // assert
+    for (int32_t i = -1000; i < 1000; i++)
+    {
+        assert_int32_matches_snprintf(i);
+    }
+    assert_int32_matches_snprintf(INT8_MIN);
+    assert_int32_matches_snprintf(INT16_MIN);
+    assert_int32_matches_snprintf(INT32_MAX);
+    assert_int32_matches_snprintf(INT32_MIN);
+}
+
+/* Tests_SRS_INTEGER_TO_STRING_01_004: [ If buffer is NULL or buffer_length is 0, the integer_to_string functions shall only return the length of the decimal representation. ]*/
+static void integer_to_string_int32_with_NULL_buffer_returns_the_length(void)
+{
+    // arrange
+
+    // act
+    int result = integer_to_string_int32(-42, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == 3);
+}
+
+int main(void)
+{
+    integer_to_string_uint64_digit_count_around_all_powers_of_10_succeeds();
+    integer_to_string_uint64_digit_count_for_all_powers_of_2_succeeds();
+
+    integer_to_string_uint32_digit_count_succeeds();
+
+    integer_to_string_int64_length_succeeds();
+
+    integer_to_string_write_uint64_writes_values_back_to_back();
+
+    integer_to_string_write_int64_matches_snprintf();
+
+    integer_to_string_uint64_succeeds();
+    integer_to_string_uint64_matches_snprintf_for_all_digit_counts_and_buffer_sizes();
+    integer_to_string_uint64_with_NULL_buffer_returns_the_length();
+    integer_to_string_uint64_with_0_buffer_length_does_not_write();
+
+    integer_to_string_int64_with_INT64_MIN_succeeds();
+    integer_to_string_int64_matches_snprintf_for_all_digit_counts_and_buffer_sizes();
+
+    integer_to_string_uint32_matches_snprintf();
+
+    integer_to_string_int32_matches_snprintf();
+    integer_to_string_int32_with_NULL_buffer_returns_the_length();
+
+    return 0;
+}
@@ -0,0 +1,572 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context_property_basic_types.h"
+#include "c_logging/log_context_property_type_ascii_char_ptr.h"
+#include "c_logging/log_context_property_value_pair.h"
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+#include "c_logging/log_context.h"
+
+#include "c_logging/log_context_ambient.h"
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+/* log_context_ambient_push */
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_001: [ If log_context is NULL, log_context_ambient_push shall fail and return a non-zero value. ]*/
+static void log_context_ambient_push_with_NULL_log_context_fails(void)
+{
+    // arrange
+
+    // act
+    int result = log_context_ambient_push(NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(log_context_ambient_get() == NULL);
+}
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_003: [ log_context_ambient_push shall push log_context on the ambient context stack of the calling thread, making it the ambient context of the thread. ]*/
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_004: [ log_context_ambient_push shall succeed and return 0. ]*/
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_008: [ Otherwise log_context_ambient_get shall return the context last pushed on the calling thread. ]*/
+static void log_context_ambient_push_succeeds(void)
+{
+    // arrange
+    LOG_CONTEXT_LOCAL_DEFINE(log_context, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+
+    // act
+    int result = log_context_ambient_push(&log_context);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(log_context_ambient_get() == &log_context);
+
+    // cleanup
+    log_context_ambient_pop(&log_context);
+}
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_003: [ log_context_ambient_push shall push log_context on the ambient context stack of the calling thread, making it the ambient context of the thread. ]*/
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_006: [ log_context_ambient_pop shall remove log_context and any context pushed after it from the ambient context stack of the calling thread. ]*/
+static void log_context_ambient_push_twice_makes_the_last_one_ambient_and_pop_restores_the_first(void)
+{
+    // arrange
+    LOG_CONTEXT_LOCAL_DEFINE(outer, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 1));
+    LOG_CONTEXT_LOCAL_DEFINE(inner, NULL, LOG_CONTEXT_PROPERTY(int32_t, y, 2));
+    POOR_MANS_ASSERT(log_context_ambient_push(&outer) == 0);
+
+    // act
+    int result = log_context_ambient_push(&inner);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(log_context_ambient_get() == &inner);
+    log_context_ambient_pop(&inner);
+    POOR_MANS_ASSERT(log_context_ambient_get() == &outer);
+    log_context_ambient_pop(&outer);
+    POOR_MANS_ASSERT(log_context_ambient_get() == NULL);
+}
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_002: [ If LOG_CONTEXT_AMBIENT_MAX_DEPTH contexts are already pushed on the calling thread, log_context_ambient_push shall fail and return a non-zero value. ]*/
+static void log_context_ambient_push_when_the_stack_is_full_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_LOCAL_DEFINE(log_context, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+    LOG_CONTEXT_LOCAL_DEFINE(one_too_many, NULL, LOG_CONTEXT_PROPERTY(int32_t, y, 43));
+    for (uint32_t i = 0; i < LOG_CONTEXT_AMBIENT_MAX_DEPTH; i++)
+    {
+        POOR_MANS_ASSERT(log_context_ambient_push(&log_context) == 0);
+    }
+
+    // act
+    int result = log_context_ambient_push(&one_too_many);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(log_context_ambient_get() == &log_context);
+
+    // cleanup
+    log_context_ambient_pop(&log_context);
+    POOR_MANS_ASSERT(log_context_ambient_get() == &log_context);
+    // popping the bottom most instance empties the stack
+    while (log_context_ambient_get() != NULL)
+    {
+        log_context_ambient_pop(&log_context);
+    }
+}
+
+/* log_context_ambient_pop */
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_005: [ If log_context is not on the ambient context stack of the calling thread, log_context_ambient_pop shall return. ]*/
+static void log_context_ambient_pop_with_a_context_that_was_not_pushed_returns(void)
+{
+    // arrange
+    LOG_CONTEXT_LOCAL_DEFINE(log_context, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+    LOG_CONTEXT_LOCAL_DEFINE(other, NULL, LOG_CONTEXT_PROPERTY(int32_t, y, 43));
+    POOR_MANS_ASSERT(log_context_ambient_push(&log_context) == 0);
+
+    // act
+    log_context_ambient_pop(&other);
+
+    // assert
+    POOR_MANS_ASSERT(log_context_ambient_get() == &log_context);
+
+    // cleanup
+    log_context_ambient_pop(&log_context);
+}
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_006: [ log_context_ambient_pop shall remove log_context and any context pushed after it from the ambient context stack of the calling thread. ]*/
+static void log_context_ambient_pop_of_the_outer_context_also_removes_the_inner_context(void)
+{
+    // arrange
+    LOG_CONTEXT_LOCAL_DEFINE(outer, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 1));
+    LOG_CONTEXT_LOCAL_DEFINE(inner, NULL, LOG_CONTEXT_PROPERTY(int32_t, y, 2));
+    POOR_MANS_ASSERT(log_context_ambient_push(&outer) == 0);
+    POOR_MANS_ASSERT(log_context_ambient_push(&inner) == 0);
+
+    // act
+    log_context_ambient_pop(&outer);
+
+    // assert
+    POOR_MANS_ASSERT(log_context_ambient_get() == NULL);
+}
+
+/* log_context_ambient_get */
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_007: [ If no context is pushed on the calling thread, log_context_ambient_get shall return NULL. ]*/
+static void log_context_ambient_get_with_no_context_pushed_returns_NULL(void)
+{
+    // arrange
+
+    // act
+    LOG_CONTEXT_HANDLE result = log_context_ambient_get();
+
+    // assert
+    POOR_MANS_ASSERT(result == NULL);
+}
+
+/* LOG_CONTEXT_AMBIENT_PUSH */
+
+static uint32_t get_log_context_call_count;
+
+static LOG_CONTEXT_HANDLE get_log_context(LOG_CONTEXT_HANDLE log_context)
+{
+    get_log_context_call_count++;
+    return log_context;
+}
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_015: [ LOG_CONTEXT_AMBIENT_PUSH shall evaluate log_context once, store it in a LOG_CONTEXT_HANDLE variable named scope_name and call log_context_ambient_push with it. ]*/
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_017: [ If scope_name is not NULL, LOG_CONTEXT_AMBIENT_POP shall call log_context_ambient_pop with scope_name and set scope_name to NULL. ]*/
+static void LOG_CONTEXT_AMBIENT_PUSH_and_POP_push_and_pop_the_context(void)
+{
+    // arrange
+    LOG_CONTEXT_LOCAL_DEFINE(log_context, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+    get_log_context_call_count = 0;
+
+    // act
+    LOG_CONTEXT_AMBIENT_PUSH(scope, get_log_context(&log_context));
+
+    // assert
+    POOR_MANS_ASSERT(get_log_context_call_count == 1);
+    POOR_MANS_ASSERT(scope == &log_context);
+    POOR_MANS_ASSERT(log_context_ambient_get() == &log_context);
+
+    // act
+    LOG_CONTEXT_AMBIENT_POP(scope);
+
+    // assert
+    POOR_MANS_ASSERT(scope == NULL);
+    POOR_MANS_ASSERT(log_context_ambient_get() == NULL);
+}
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_016: [ If log_context_ambient_push fails, LOG_CONTEXT_AMBIENT_PUSH shall set scope_name to NULL. ]*/
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_020: [ If scope_name is NULL, LOG_CONTEXT_AMBIENT_POP shall not call log_context_ambient_pop. ]*/
+static void LOG_CONTEXT_AMBIENT_POP_after_a_failed_push_leaves_the_stack_unchanged(void)
+{
+    // arrange
+    LOG_CONTEXT_LOCAL_DEFINE(outer_log_context, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+    LOG_CONTEXT_AMBIENT_PUSH(outer_scope, &outer_log_context);
+
+    // act
+    LOG_CONTEXT_AMBIENT_PUSH(scope, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(scope == NULL);
+    POOR_MANS_ASSERT(log_context_ambient_get() == &outer_log_context);
+
+    // act
+    LOG_CONTEXT_AMBIENT_POP(scope);
+
+    // assert
+    POOR_MANS_ASSERT(log_context_ambient_get() == &outer_log_context);
+
+    // cleanup
+    LOG_CONTEXT_AMBIENT_POP(outer_scope);
+    POOR_MANS_ASSERT(log_context_ambient_get() == NULL);
+}
+
+static int handle_request(bool fail_early)
+{
+    int result;
+    LOG_CONTEXT_LOCAL_DEFINE(request_log_context, NULL, LOG_CONTEXT_PROPERTY(int32_t, request_id, 7));
+    LOG_CONTEXT_AMBIENT_PUSH(request_scope, &request_log_context);
+
+    if (fail_early)
+    {
+        result = MU_FAILURE;
+    }
+    else
+    {
+        POOR_MANS_ASSERT(log_context_ambient_get() == &request_log_context);
+        result = 0;
+    }
+
+    LOG_CONTEXT_AMBIENT_POP(request_scope);
+
+    return result;
+}
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_017: [ If scope_name is not NULL, LOG_CONTEXT_AMBIENT_POP shall call log_context_ambient_pop with scope_name and set scope_name to NULL. ]*/
+static void LOG_CONTEXT_AMBIENT_PUSH_in_a_function_returning_early_with_no_outer_scope_leaves_no_context(void)
+{
+    // arrange
+    POOR_MANS_ASSERT(log_context_ambient_get() == NULL);
+
+    // act
+    int result = handle_request(true);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(log_context_ambient_get() == NULL);
+    POOR_MANS_ASSERT(internal_log_context_ambient_get_merged_pair_count(NULL) == 0);
+
+    // act
+    result = handle_request(false);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(log_context_ambient_get() == NULL);
+}
+
+/* internal_log_context_ambient_get_merged_pair_count */
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_018: [ If internal_log_context_ambient_merge would not build a merged view for log_context, internal_log_context_ambient_get_merged_pair_count shall return 0. ]*/
+static void internal_log_context_ambient_get_merged_pair_count_when_no_view_is_needed_returns_0(void)
+{
+    // arrange
+    LOG_CONTEXT_LOCAL_DEFINE(ambient, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+    LOG_CONTEXT_LOCAL_DEFINE(log_context, NULL, LOG_CONTEXT_PROPERTY(int32_t, y, 43));
+
+    // act
+    uint32_t result_no_ambient = internal_log_context_ambient_get_merged_pair_count(&log_context);
+    POOR_MANS_ASSERT(log_context_ambient_push(&ambient) == 0);
+    LOG_CONTEXT_LOCAL_DEFINE(child, log_context_ambient_get(), LOG_CONTEXT_PROPERTY(int32_t, z, 44));
+    uint32_t result_NULL = internal_log_context_ambient_get_merged_pair_count(NULL);
+    uint32_t result_ambient = internal_log_context_ambient_get_merged_pair_count(&ambient);
+    uint32_t result_child = internal_log_context_ambient_get_merged_pair_count(&child);
+
+    // assert
+    POOR_MANS_ASSERT(result_no_ambient == 0);
+    POOR_MANS_ASSERT(result_NULL == 0);
+    POOR_MANS_ASSERT(result_ambient == 0);
+    POOR_MANS_ASSERT(result_child == 0);
+
+    // cleanup
+    log_context_ambient_pop(&ambient);
+}
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_019: [ Otherwise internal_log_context_ambient_get_merged_pair_count shall return the number of property/value pairs of the merged view: 1 plus the number of property/value pairs of the ambient context and of log_context. ]*/
+static void internal_log_context_ambient_get_merged_pair_count_with_an_unrelated_context_returns_the_pair_count_of_the_view(void)
+{
+    // arrange
+    LOG_CONTEXT_LOCAL_DEFINE(ambient, NULL, LOG_CONTEXT_NAME(request), LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+    LOG_CONTEXT_LOCAL_DEFINE(log_context, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 43), LOG_CONTEXT_STRING_PROPERTY(s, "haga%s", "gaga"));
+    POOR_MANS_ASSERT(log_context_ambient_push(&ambient) == 0);
+
+    // act
+    uint32_t result = internal_log_context_ambient_get_merged_pair_count(&log_context);
+
+    // assert
+    POOR_MANS_ASSERT(result == 6);
+
+    // cleanup
+    log_context_ambient_pop(&ambient);
+}
+
+/* internal_log_context_ambient_merge */
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_009: [ If there is no ambient context on the calling thread, internal_log_context_ambient_merge shall return log_context. ]*/
+static void internal_log_context_ambient_merge_with_no_ambient_context_returns_log_context(void)
+{
+    // arrange
+    MU_SUPPRESS_WARNING(4815) /* warning C4815: zero-sized array in stack object will have no elements (unless the object is an aggregate that has been aggregate initialized) */
+    LOG_CONTEXT merged_log_context;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR merged_property_value_pairs[LOG_CONTEXT_AMBIENT_MAX_MERGED_PAIR_COUNT];
+    LOG_CONTEXT_LOCAL_DEFINE(log_context, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+
+    // act
+    LOG_CONTEXT_HANDLE result_1 = internal_log_context_ambient_merge(&log_context, &merged_log_context, merged_property_value_pairs);
+    LOG_CONTEXT_HANDLE result_2 = internal_log_context_ambient_merge(NULL, &merged_log_context, merged_property_value_pairs);
+
+    // assert
+    POOR_MANS_ASSERT(result_1 == &log_context);
+    POOR_MANS_ASSERT(result_2 == NULL);
+}
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_010: [ If log_context is NULL or it is the ambient context, internal_log_context_ambient_merge shall return the ambient context. ]*/
+static void internal_log_context_ambient_merge_with_NULL_log_context_returns_the_ambient_context(void)
+{
+    // arrange
+    MU_SUPPRESS_WARNING(4815) /* warning C4815: zero-sized array in stack object will have no elements (unless the object is an aggregate that has been aggregate initialized) */
+    LOG_CONTEXT merged_log_context;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR merged_property_value_pairs[LOG_CONTEXT_AMBIENT_MAX_MERGED_PAIR_COUNT];
+    LOG_CONTEXT_LOCAL_DEFINE(ambient, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+    POOR_MANS_ASSERT(log_context_ambient_push(&ambient) == 0);
+
+    // act
+    LOG_CONTEXT_HANDLE result_1 = internal_log_context_ambient_merge(NULL, &merged_log_context, merged_property_value_pairs);
+    LOG_CONTEXT_HANDLE result_2 = internal_log_context_ambient_merge(&ambient, &merged_log_context, merged_property_value_pairs);
+
+    // assert
+    POOR_MANS_ASSERT(result_1 == &ambient);
+    POOR_MANS_ASSERT(result_2 == &ambient);
+
+    // cleanup
+    log_context_ambient_pop(&ambient);
+}
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_011: [ If log_context already starts with all the property/value pairs of the ambient context (it was created with the ambient context as parent), internal_log_context_ambient_merge shall return log_context. ]*/
+static void internal_log_context_ambient_merge_with_a_child_of_the_ambient_context_returns_log_context(void)
+{
+    // arrange
+    MU_SUPPRESS_WARNING(4815) /* warning C4815: zero-sized array in stack object will have no elements (unless the object is an aggregate that has been aggregate initialized) */
+    LOG_CONTEXT merged_log_context;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR merged_property_value_pairs[LOG_CONTEXT_AMBIENT_MAX_MERGED_PAIR_COUNT];
+    LOG_CONTEXT_LOCAL_DEFINE(ambient, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+    POOR_MANS_ASSERT(log_context_ambient_push(&ambient) == 0);
+    LOG_CONTEXT_LOCAL_DEFINE(child, log_context_ambient_get(), LOG_CONTEXT_PROPERTY(int32_t, y, 43));
+
+    // act
+    LOG_CONTEXT_HANDLE result = internal_log_context_ambient_merge(&child, &merged_log_context, merged_property_value_pairs);
+
+    // assert
+    POOR_MANS_ASSERT(result == &child);
+
+    // cleanup
+    log_context_ambient_pop(&ambient);
+}
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_011: [ If log_context already starts with all the property/value pairs of the ambient context (it was created with the ambient context as parent), internal_log_context_ambient_merge shall return log_context. ]*/
+static void internal_log_context_ambient_merge_with_a_heap_child_of_an_ambient_context_with_a_borrowed_string_returns_log_context(void)
+{
+    // arrange
+    MU_SUPPRESS_WARNING(4815) /* warning C4815: zero-sized array in stack object will have no elements (unless the object is an aggregate that has been aggregate initialized) */
+    LOG_CONTEXT merged_log_context;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR merged_property_value_pairs[LOG_CONTEXT_AMBIENT_MAX_MERGED_PAIR_COUNT];
+    LOG_CONTEXT_LOCAL_DEFINE(ambient, NULL, LOG_CONTEXT_BORROWED_STRING_PROPERTY(component, "borrowed"));
+    POOR_MANS_ASSERT(log_context_ambient_push(&ambient) == 0);
+    LOG_CONTEXT_HANDLE child;
+    LOG_CONTEXT_CREATE(child, log_context_ambient_get(), LOG_CONTEXT_PROPERTY(int32_t, y, 43));
+    POOR_MANS_ASSERT(child != NULL);
+
+    // act
+    LOG_CONTEXT_HANDLE result = internal_log_context_ambient_merge(child, &merged_log_context, merged_property_value_pairs);
+
+    // assert
+    POOR_MANS_ASSERT(result == child);
+
+    // cleanup
+    log_context_ambient_pop(&ambient);
+    LOG_CONTEXT_DESTROY(child);
+}
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_013: [ Otherwise internal_log_context_ambient_merge shall fill merged_property_value_pairs with a struct property with 2 fields, followed by the property/value pairs of the ambient context and the property/value pairs of log_context, without copying any value. ]*/
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_014: [ internal_log_context_ambient_merge shall initialize merged_log_context as a view with no values data over merged_property_value_pairs and return it. ]*/
+static void internal_log_context_ambient_merge_with_an_unrelated_context_returns_a_merged_view(void)
+{
+    // arrange
+    MU_SUPPRESS_WARNING(4815) /* warning C4815: zero-sized array in stack object will have no elements (unless the object is an aggregate that has been aggregate initialized) */
+    LOG_CONTEXT merged_log_context;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR merged_property_value_pairs[LOG_CONTEXT_AMBIENT_MAX_MERGED_PAIR_COUNT];
+    LOG_CONTEXT_LOCAL_DEFINE(ambient, NULL, LOG_CONTEXT_NAME(request), LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+    LOG_CONTEXT_LOCAL_DEFINE(log_context, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 43), LOG_CONTEXT_STRING_PROPERTY(s, "haga%s", "gaga"));
+    POOR_MANS_ASSERT(log_context_ambient_push(&ambient) == 0);
+
+    // act
+    LOG_CONTEXT_HANDLE result = internal_log_context_ambient_merge(&log_context, &merged_log_context, merged_property_value_pairs);
+
+    // assert
+    POOR_MANS_ASSERT(result == &merged_log_context);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(result) == 6);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(pairs == merged_property_value_pairs);
+    POOR_MANS_ASSERT(strcmp(pairs[0].name, "") == 0);
+    POOR_MANS_ASSERT(pairs[0].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_struct);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 2);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "request") == 0);
+    POOR_MANS_ASSERT(pairs[1].value == ambient.property_value_pairs_ptr[0].value);
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "x") == 0);
+    POOR_MANS_ASSERT(pairs[2].value == ambient.property_value_pairs_ptr[1].value);
+    POOR_MANS_ASSERT(pairs[3].value == log_context.property_value_pairs_ptr[0].value);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[3].value == 2);
+    POOR_MANS_ASSERT(strcmp(pairs[4].name, "x") == 0);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[4].value == 43);
+    POOR_MANS_ASSERT(pairs[4].value == log_context.property_value_pairs_ptr[1].value);
+    POOR_MANS_ASSERT(strcmp(pairs[5].name, "s") == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[5].value, "hagagaga") == 0);
+
+    // cleanup
+    log_context_ambient_pop(&ambient);
+}
+
+/* Tests_SRS_LOG_CONTEXT_AMBIENT_01_012: [ If the merged view would have more than LOG_CONTEXT_AMBIENT_MAX_MERGED_PAIR_COUNT property/value pairs, internal_log_context_ambient_merge shall return log_context. ]*/
+static void internal_log_context_ambient_merge_with_too_many_pairs_returns_log_context(void)
+{
+    // arrange
+    MU_SUPPRESS_WARNING(4815) /* warning C4815: zero-sized array in stack object will have no elements (unless the object is an aggregate that has been aggregate initialized) */
+    LOG_CONTEXT merged_log_context;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR merged_property_value_pairs[LOG_CONTEXT_AMBIENT_MAX_MERGED_PAIR_COUNT];
+    LOG_CONTEXT_LOCAL_DEFINE(ambient, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+    LOG_CONTEXT_HANDLE log_context = log_context_create(NULL, LOG_CONTEXT_AMBIENT_MAX_MERGED_PAIR_COUNT - 2, 0, NULL);
+    POOR_MANS_ASSERT(log_context != NULL);
+    (void)memset(log_context->property_value_pairs_ptr, 0, sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) * log_context->property_value_pair_count);
+    POOR_MANS_ASSERT(log_context_ambient_push(&ambient) == 0);
+
+    // act
+    LOG_CONTEXT_HANDLE result = internal_log_context_ambient_merge(log_context, &merged_log_context, merged_property_value_pairs);
+
+    // assert
+    POOR_MANS_ASSERT(result == log_context);
+
+    // cleanup
+    log_context_ambient_pop(&ambient);
+    LOG_CONTEXT_DESTROY(log_context);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_044: [ If parent_context is a view with no values data (as passed to the sinks when the ambient context is merged), LOG_CONTEXT_CREATE shall copy the names and the values of the property/value pairs of parent_context in the data area of the created context. ]*/
+static void LOG_CONTEXT_CREATE_with_a_merged_view_as_parent_succeeds(void)
+{
+    // arrange
+    MU_SUPPRESS_WARNING(4815) /* warning C4815: zero-sized array in stack object will have no elements (unless the object is an aggregate that has been aggregate initialized) */
+    LOG_CONTEXT merged_log_context;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR merged_property_value_pairs[LOG_CONTEXT_AMBIENT_MAX_MERGED_PAIR_COUNT];
+    LOG_CONTEXT_LOCAL_DEFINE(ambient, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+    LOG_CONTEXT_LOCAL_DEFINE(log_context, NULL, LOG_CONTEXT_PROPERTY(int32_t, y, 43));
+    POOR_MANS_ASSERT(log_context_ambient_push(&ambient) == 0);
+    LOG_CONTEXT_HANDLE merged = internal_log_context_ambient_merge(&log_context, &merged_log_context, merged_property_value_pairs);
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, merged, LOG_CONTEXT_PROPERTY(int32_t, z, 44));
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(result) == 7);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 2);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[1].value == 2);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[3].value == 42);
+    POOR_MANS_ASSERT(strcmp(pairs[3].name, "x") == 0);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[5].value == 43);
+    POOR_MANS_ASSERT(strcmp(pairs[5].name, "y") == 0);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[6].value == 44);
+    POOR_MANS_ASSERT(strcmp(pairs[6].name, "z") == 0);
+
+    // cleanup
+    LOG_CONTEXT_DESTROY(result);
+    log_context_ambient_pop(&ambient);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_044: [ If parent_context is a view with no values data (as passed to the sinks when the ambient context is merged), LOG_CONTEXT_CREATE shall copy the names and the values of the property/value pairs of parent_context in the data area of the created context. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_041: [ internal_log_context_reserve shall update the values of all the property/value pairs already stored that point into the data area to point into the reallocated data area. ]*/
+static void LOG_CONTEXT_CREATE_with_a_merged_view_as_parent_and_a_value_that_does_not_fit_does_not_depend_on_the_merged_contexts(void)
+{
+    // arrange
+    MU_SUPPRESS_WARNING(4815) /* warning C4815: zero-sized array in stack object will have no elements (unless the object is an aggregate that has been aggregate initialized) */
+    LOG_CONTEXT merged_log_context;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR merged_property_value_pairs[LOG_CONTEXT_AMBIENT_MAX_MERGED_PAIR_COUNT];
+    LOG_CONTEXT_HANDLE ambient;
+    LOG_CONTEXT_CREATE(ambient, NULL, LOG_CONTEXT_NAME(ambient_name), LOG_CONTEXT_STRING_PROPERTY(a, "%s", "ambient value"));
+    POOR_MANS_ASSERT(ambient != NULL);
+    LOG_CONTEXT_HANDLE log_context;
+    LOG_CONTEXT_CREATE(log_context, NULL, LOG_CONTEXT_PROPERTY(int32_t, y, 43));
+    POOR_MANS_ASSERT(log_context != NULL);
+    POOR_MANS_ASSERT(log_context_ambient_push(ambient) == 0);
+    LOG_CONTEXT_HANDLE merged = internal_log_context_ambient_merge(log_context, &merged_log_context, merged_property_value_pairs);
+    POOR_MANS_ASSERT(merged == &merged_log_context);
+    char big_string[1000];
+    (void)memset(big_string, 'x', sizeof(big_string) - 1);
+    big_string[sizeof(big_string) - 1] = '\0';
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, merged, LOG_CONTEXT_STRING_PROPERTY(s, "%s", big_string));
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    // the merged contexts go away, the created context keeps its own copy
+    log_context_ambient_pop(ambient);
+    LOG_CONTEXT_DESTROY(ambient);
+    LOG_CONTEXT_DESTROY(log_context);
+    (void)memset(merged_property_value_pairs, 0, sizeof(merged_property_value_pairs));
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(result) == 7);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 2);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[1].value == 2);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[2].value == 1);
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "ambient_name") == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[3].value, "ambient value") == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[3].name, "a") == 0);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[5].value == 43);
+    POOR_MANS_ASSERT(strcmp(pairs[5].name, "y") == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[6].value, big_string) == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[6].name, "s") == 0);
+
+    // cleanup
+    LOG_CONTEXT_DESTROY(result);
+}
+
+int main(void)
+{
+    log_context_ambient_push_with_NULL_log_context_fails();
+    log_context_ambient_push_succeeds();
+    log_context_ambient_push_twice_makes_the_last_one_ambient_and_pop_restores_the_first();
+    log_context_ambient_push_when_the_stack_is_full_fails();
+
+    log_context_ambient_pop_with_a_context_that_was_not_pushed_returns();
+    log_context_ambient_pop_of_the_outer_context_also_removes_the_inner_context();
+
+    log_context_ambient_get_with_no_context_pushed_returns_NULL();
+
+    LOG_CONTEXT_AMBIENT_PUSH_and_POP_push_and_pop_the_context();
+    LOG_CONTEXT_AMBIENT_POP_after_a_failed_push_leaves_the_stack_unchanged();
+    LOG_CONTEXT_AMBIENT_PUSH_in_a_function_returning_early_with_no_outer_scope_leaves_no_context();
+
+    internal_log_context_ambient_get_merged_pair_count_when_no_view_is_needed_returns_0();
+    internal_log_context_ambient_get_merged_pair_count_with_an_unrelated_context_returns_the_pair_count_of_the_view();
+
+    internal_log_context_ambient_merge_with_no_ambient_context_returns_log_context();
+    internal_log_context_ambient_merge_with_NULL_log_context_returns_the_ambient_context();
+    internal_log_context_ambient_merge_with_a_child_of_the_ambient_context_returns_log_context();
+    internal_log_context_ambient_merge_with_a_heap_child_of_an_ambient_context_with_a_borrowed_string_returns_log_context();
+    internal_log_context_ambient_merge_with_an_unrelated_context_returns_a_merged_view();
+    internal_log_context_ambient_merge_with_too_many_pairs_returns_log_context();
+
+    LOG_CONTEXT_CREATE_with_a_merged_view_as_parent_succeeds();
+    LOG_CONTEXT_CREATE_with_a_merged_view_as_parent_and_a_value_that_does_not_fit_does_not_depend_on_the_merged_contexts();
+
+    return 0;
+}
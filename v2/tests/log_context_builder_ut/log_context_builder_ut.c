@@ -0,0 +1,1165 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context_property_basic_types.h"
+#include "c_logging/log_context_property_bool_type.h"
+#include "c_logging/log_context_property_type_ascii_char_ptr.h"
+#include "c_logging/log_context_property_value_pair.h"
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+#include "c_logging/log_context.h"
+
+#include "c_logging/log_context_builder.h"
+
+// defines how many mock calls we can have
+#define MAX_MOCK_CALL_COUNT (128)
+
+#define MOCK_CALL_TYPE_VALUES \
+    MOCK_CALL_TYPE_malloc, \
+    MOCK_CALL_TYPE_realloc, \
+    MOCK_CALL_TYPE_free
+
+MU_DEFINE_ENUM(MOCK_CALL_TYPE, MOCK_CALL_TYPE_VALUES)
+
+// very poor mans mocks :-(
+typedef struct malloc_CALL_TAG
+{
+    bool override_result;
+    void* call_result;
+    size_t size;
+} malloc_CALL;
+
+typedef struct realloc_CALL_TAG
+{
+    bool override_result;
+    void* call_result;
+    void* ptr;
+    size_t size;
+} realloc_CALL;
+
+typedef struct free_CALL_TAG
+{
+    void* ptr;
+} free_CALL;
+
+typedef struct MOCK_CALL_TAG
+{
+    MOCK_CALL_TYPE mock_call_type;
+    union
+    {
+        malloc_CALL malloc_call;
+        realloc_CALL realloc_call;
+        free_CALL free_call;
+    };
+} MOCK_CALL;
+
+static MOCK_CALL expected_calls[MAX_MOCK_CALL_COUNT];
+static size_t expected_call_count;
+static size_t actual_call_count;
+static bool actual_and_expected_match;
+
+static void setup_mocks(void)
+{
+    expected_call_count = 0;
+    actual_call_count = 0;
+    actual_and_expected_match = true;
+}
+
+void* mock_malloc(size_t size)
+{
+    void* result;
+
+    if ((actual_call_count == expected_call_count) ||
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_malloc))
+    {
+        actual_and_expected_match = false;
+        result = NULL;
+    }
+    else
+    {
+        if (expected_calls[actual_call_count].malloc_call.override_result)
+        {
+            result = expected_calls[actual_call_count].malloc_call.call_result;
+        }
+        else
+        {
+            expected_calls[actual_call_count].malloc_call.size = size;
+
+            result = malloc(size);
+        }
+
+        actual_call_count++;
+    }
+
+    return result;
+}
+
+void* mock_realloc(void* ptr, size_t size)
+{
+    void* result;
+
+    if ((actual_call_count == expected_call_count) ||
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_realloc))
+    {
+        actual_and_expected_match = false;
+        result = NULL;
+    }
+    else
+    {
+        expected_calls[actual_call_count].realloc_call.ptr = ptr;
+        expected_calls[actual_call_count].realloc_call.size = size;
+
+        if (expected_calls[actual_call_count].realloc_call.override_result)
+        {
+            result = expected_calls[actual_call_count].realloc_call.call_result;
+        }
+        else
+        {
+            result = realloc(ptr, size);
+        }
+
+        actual_call_count++;
+    }
+
+    return result;
+}
+
+void mock_free(void* ptr)
+{
+    if ((actual_call_count == expected_call_count) ||
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_free))
+    {
+        actual_and_expected_match = false;
+    }
+    else
+    {
+        expected_calls[actual_call_count].free_call.ptr = ptr;
+        free(ptr);
+
+        actual_call_count++;
+    }
+}
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+static void setup_malloc_call(void)
+{
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_malloc;
+    expected_calls[expected_call_count].malloc_call.override_result = false;
+    expected_call_count++;
+}
+
+static void setup_realloc_call(void)
+{
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_realloc;
+    expected_calls[expected_call_count].realloc_call.override_result = false;
+    expected_call_count++;
+}
+
+static void setup_free_call(void)
+{
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_free;
+    expected_call_count++;
+}
+
+static LOG_CONTEXT_BUILDER_HANDLE test_create_builder(void)
+{
+    setup_mocks();
+    setup_malloc_call();
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = log_context_builder_create();
+    POOR_MANS_ASSERT(log_context_builder != NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    return log_context_builder;
+}
+
+static void test_destroy_builder(LOG_CONTEXT_BUILDER_HANDLE log_context_builder)
+{
+    setup_mocks();
+    setup_free_call();
+    setup_free_call();
+    setup_free_call();
+    log_context_builder_destroy(log_context_builder);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+static void test_destroy_context(LOG_CONTEXT_HANDLE log_context)
+{
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(log_context);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* log_context_builder_create */
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_001: [ log_context_builder_create shall allocate memory for a new builder. ]*/
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_003: [ The builder shall start with no properties and no context name. ]*/
+static void log_context_builder_create_succeeds(void)
+{
+    // arrange
+    setup_mocks();
+    setup_malloc_call();
+
+    // act
+    LOG_CONTEXT_BUILDER_HANDLE result = log_context_builder_create();
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    test_destroy_builder(result);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_002: [ If any error occurs, log_context_builder_create shall fail and return NULL. ]*/
+static void when_malloc_fails_log_context_builder_create_also_fails(void)
+{
+    // arrange
+    setup_mocks();
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_malloc;
+    expected_calls[expected_call_count].malloc_call.override_result = true;
+    expected_calls[expected_call_count].malloc_call.call_result = NULL;
+    expected_call_count++;
+
+    // act
+    LOG_CONTEXT_BUILDER_HANDLE result = log_context_builder_create();
+
+    // assert
+    POOR_MANS_ASSERT(result == NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* log_context_builder_destroy */
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_004: [ If log_context_builder is NULL, log_context_builder_destroy shall return. ]*/
+static void log_context_builder_destroy_with_NULL_returns(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    log_context_builder_destroy(NULL);
+
+    // assert
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_005: [ log_context_builder_destroy shall free the buffers used by the builder and the builder itself. ]*/
+static void log_context_builder_destroy_frees_the_buffers_and_the_builder(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+    setup_realloc_call();
+    setup_realloc_call();
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(int32_t)(log_context_builder, "the_answer", 42) == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    setup_mocks();
+    setup_free_call();
+    setup_free_call();
+    setup_free_call();
+
+    // act
+    log_context_builder_destroy(log_context_builder);
+
+    // assert
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* log_context_builder_reset */
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_006: [ If log_context_builder is NULL, log_context_builder_reset shall return. ]*/
+static void log_context_builder_reset_with_NULL_returns(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    log_context_builder_reset(NULL);
+
+    // assert
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_007: [ log_context_builder_reset shall discard all the properties and the context name added to the builder, while keeping the builder buffers for reuse. ]*/
+static void log_context_builder_reset_discards_the_properties_and_the_name(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+    setup_realloc_call();
+    POOR_MANS_ASSERT(log_context_builder_set_name(log_context_builder, "some_name") == 0);
+    setup_realloc_call();
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(int32_t)(log_context_builder, "the_answer", 42) == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    setup_mocks();
+
+    // act
+    log_context_builder_reset(log_context_builder);
+
+    // assert
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    setup_mocks();
+    setup_malloc_call();
+    LOG_CONTEXT_HANDLE log_context = log_context_builder_freeze(log_context_builder, NULL);
+    POOR_MANS_ASSERT(log_context != NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(log_context) == 1);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(log_context);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[0].name, "") == 0);
+
+    // cleanup
+    test_destroy_context(log_context);
+    test_destroy_builder(log_context_builder);
+}
+
+/* log_context_builder_set_name */
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_008: [ If log_context_builder is NULL, log_context_builder_set_name shall fail and return a non-zero value. ]*/
+static void log_context_builder_set_name_with_NULL_log_context_builder_fails(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = log_context_builder_set_name(NULL, "some_name");
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_009: [ If log_context_name is NULL, log_context_builder_set_name shall fail and return a non-zero value. ]*/
+static void log_context_builder_set_name_with_NULL_log_context_name_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+
+    // act
+    int result = log_context_builder_set_name(log_context_builder, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_010: [ If the context name was already set, log_context_builder_set_name shall fail and return a non-zero value. ]*/
+static void log_context_builder_set_name_twice_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+    setup_realloc_call();
+    POOR_MANS_ASSERT(log_context_builder_set_name(log_context_builder, "some_name") == 0);
+    setup_mocks();
+
+    // act
+    int result = log_context_builder_set_name(log_context_builder, "some_other_name");
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_011: [ log_context_builder_set_name shall copy log_context_name in the builder data buffer, growing the buffer if needed. ]*/
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_013: [ log_context_builder_set_name shall succeed and return 0. ]*/
+static void log_context_builder_set_name_succeeds(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    char name[] = "some_name";
+    setup_mocks();
+    setup_realloc_call();
+
+    // act
+    int result = log_context_builder_set_name(log_context_builder, name);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    // the name is copied
+    name[0] = 'x';
+    setup_mocks();
+    setup_malloc_call();
+    LOG_CONTEXT_HANDLE log_context = log_context_builder_freeze(log_context_builder, NULL);
+    POOR_MANS_ASSERT(log_context != NULL);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(log_context);
+    POOR_MANS_ASSERT(strcmp(pairs[0].name, "some_name") == 0);
+    POOR_MANS_ASSERT(pairs[0].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_struct);
+
+    // cleanup
+    test_destroy_context(log_context);
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_012: [ If any error occurs, log_context_builder_set_name shall fail and return a non-zero value. ]*/
+static void when_realloc_fails_log_context_builder_set_name_also_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_realloc;
+    expected_calls[expected_call_count].realloc_call.override_result = true;
+    expected_calls[expected_call_count].realloc_call.call_result = NULL;
+    expected_call_count++;
+
+    // act
+    int result = log_context_builder_set_name(log_context_builder, "some_name");
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    test_destroy_builder(log_context_builder);
+}
+
+/* log_context_builder_add_property */
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_014: [ If log_context_builder is NULL, log_context_builder_add_property shall fail and return a non-zero value. ]*/
+static void log_context_builder_add_property_with_NULL_log_context_builder_fails(void)
+{
+    // arrange
+    int32_t value = 42;
+    setup_mocks();
+
+    // act
+    int result = log_context_builder_add_property(NULL, "the_answer", &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t), &value, sizeof(value));
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_015: [ If property_name is NULL, log_context_builder_add_property shall fail and return a non-zero value. ]*/
+static void log_context_builder_add_property_with_NULL_property_name_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    int32_t value = 42;
+    setup_mocks();
+
+    // act
+    int result = log_context_builder_add_property(log_context_builder, NULL, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t), &value, sizeof(value));
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_016: [ If property_type is NULL, log_context_builder_add_property shall fail and return a non-zero value. ]*/
+static void log_context_builder_add_property_with_NULL_property_type_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    int32_t value = 42;
+    setup_mocks();
+
+    // act
+    int result = log_context_builder_add_property(log_context_builder, "the_answer", NULL, &value, sizeof(value));
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_017: [ If property_value is NULL, log_context_builder_add_property shall fail and return a non-zero value. ]*/
+static void log_context_builder_add_property_with_NULL_property_value_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+
+    // act
+    int result = log_context_builder_add_property(log_context_builder, "the_answer", &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t), NULL, sizeof(int32_t));
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_018: [ log_context_builder_add_property shall reserve property_value_size bytes for the value and the bytes needed for the name in the builder data buffer, growing the buffers if needed. ]*/
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_019: [ log_context_builder_add_property shall copy the value by calling the copy function of property_type. ]*/
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_020: [ log_context_builder_add_property shall copy property_name in the builder data buffer, store the property and succeed and return 0. ]*/
+static void log_context_builder_add_property_with_an_ascii_char_ptr_succeeds(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    char property_name[] = "some_string";
+    char value[] = "Baba cloantza";
+    setup_mocks();
+    setup_realloc_call();
+    setup_realloc_call();
+
+    // act
+    int result = log_context_builder_add_property(log_context_builder, property_name, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr), value, sizeof(value));
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    // name and value are copied
+    property_name[0] = 'x';
+    value[0] = 'x';
+    setup_mocks();
+    setup_malloc_call();
+    LOG_CONTEXT_HANDLE log_context = log_context_builder_freeze(log_context_builder, NULL);
+    POOR_MANS_ASSERT(log_context != NULL);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(log_context) == 2);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(log_context);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 1);
+    POOR_MANS_ASSERT(strcmp(pairs[1].value, "Baba cloantza") == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "some_string") == 0);
+    POOR_MANS_ASSERT(pairs[1].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_ascii_char_ptr);
+
+    // cleanup
+    test_destroy_context(log_context);
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_021: [ If any error occurs, log_context_builder_add_property shall fail and return a non-zero value. ]*/
+static void when_realloc_fails_log_context_builder_add_property_also_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    int32_t value = 42;
+    setup_mocks();
+    setup_realloc_call();
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_realloc;
+    expected_calls[expected_call_count].realloc_call.override_result = true;
+    expected_calls[expected_call_count].realloc_call.call_result = NULL;
+    expected_call_count++;
+
+    // act
+    int result = log_context_builder_add_property(log_context_builder, "the_answer", &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t), &value, sizeof(value));
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_021: [ If any error occurs, log_context_builder_add_property shall fail and return a non-zero value. ]*/
+static void log_context_builder_add_property_with_too_many_properties_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    uint32_t i;
+    for (i = 0; i < UINT8_MAX - 1; i++)
+    {
+        char property_name[32];
+        (void)snprintf(property_name, sizeof(property_name), "property_%" PRIu32 "", i);
+        setup_mocks();
+        for (size_t j = 0; j < 2; j++)
+        {
+            setup_realloc_call();
+        }
+        POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(uint32_t)(log_context_builder, property_name, i) == 0);
+    }
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_BUILDER_ADD_PROPERTY(uint32_t)(log_context_builder, "one_too_many", 0);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    test_destroy_builder(log_context_builder);
+}
+
+/* log_context_builder_add_string_property */
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_022: [ If log_context_builder is NULL, log_context_builder_add_string_property shall fail and return a non-zero value. ]*/
+static void log_context_builder_add_string_property_with_NULL_log_context_builder_fails(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = log_context_builder_add_string_property(NULL, "some_string", "%d", 42);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_023: [ If property_name is NULL, log_context_builder_add_string_property shall fail and return a non-zero value. ]*/
+static void log_context_builder_add_string_property_with_NULL_property_name_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+
+    // act
+    int result = log_context_builder_add_string_property(log_context_builder, NULL, "%d", 42);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_024: [ If format is NULL, log_context_builder_add_string_property shall fail and return a non-zero value. ]*/
+static void log_context_builder_add_string_property_with_NULL_format_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+
+    // act
+    int result = log_context_builder_add_string_property(log_context_builder, "some_string", NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_025: [ log_context_builder_add_string_property shall format the string with format and the arguments in ... directly in the space left in the builder data buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_027: [ log_context_builder_add_string_property shall copy property_name in the builder data buffer, store the property with the type ascii_char_ptr and succeed and return 0. ]*/
+static void log_context_builder_add_string_property_succeeds(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+    setup_realloc_call();
+    setup_realloc_call();
+
+    // act
+    int result = log_context_builder_add_string_property(log_context_builder, "some_string", "%s=%d", "the_answer", 42);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    setup_mocks();
+    setup_malloc_call();
+    LOG_CONTEXT_HANDLE log_context = log_context_builder_freeze(log_context_builder, NULL);
+    POOR_MANS_ASSERT(log_context != NULL);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(log_context) == 2);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(log_context);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 1);
+    POOR_MANS_ASSERT(strcmp(pairs[1].value, "the_answer=42") == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "some_string") == 0);
+    POOR_MANS_ASSERT(pairs[1].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_ascii_char_ptr);
+
+    // cleanup
+    test_destroy_context(log_context);
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_026: [ If the formatted string does not fit, log_context_builder_add_string_property shall grow the builder data buffer and format the string again. ]*/
+static void log_context_builder_add_string_property_with_a_string_that_does_not_fit_grows_the_buffer(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    char long_string[1000];
+    (void)memset(long_string, 'a', sizeof(long_string) - 1);
+    long_string[sizeof(long_string) - 1] = '\0';
+    setup_mocks();
+    setup_realloc_call();
+    setup_realloc_call();
+    setup_realloc_call();
+
+    // act
+    int result = log_context_builder_add_string_property(log_context_builder, "some_string", "%s", long_string);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    setup_mocks();
+    setup_malloc_call();
+    LOG_CONTEXT_HANDLE log_context = log_context_builder_freeze(log_context_builder, NULL);
+    POOR_MANS_ASSERT(log_context != NULL);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(log_context);
+    POOR_MANS_ASSERT(strcmp(pairs[1].value, long_string) == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "some_string") == 0);
+
+    // cleanup
+    test_destroy_context(log_context);
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_028: [ If any error occurs, log_context_builder_add_string_property shall fail and return a non-zero value. ]*/
+static void when_growing_the_buffer_fails_log_context_builder_add_string_property_also_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    char long_string[1000];
+    (void)memset(long_string, 'a', sizeof(long_string) - 1);
+    long_string[sizeof(long_string) - 1] = '\0';
+    setup_mocks();
+    setup_realloc_call();
+    setup_realloc_call();
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_realloc;
+    expected_calls[expected_call_count].realloc_call.override_result = true;
+    expected_calls[expected_call_count].realloc_call.call_result = NULL;
+    expected_call_count++;
+
+    // act
+    int result = log_context_builder_add_string_property(log_context_builder, "some_string", "%s", long_string);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    test_destroy_builder(log_context_builder);
+}
+
+/* LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name) */
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_029: [ If log_context_builder is NULL, LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name) shall fail and return a non-zero value. ]*/
+static void LOG_CONTEXT_BUILDER_ADD_PROPERTY_with_NULL_log_context_builder_fails(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_BUILDER_ADD_PROPERTY(int32_t)(NULL, "the_answer", 42);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_030: [ If property_name is NULL, LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name) shall fail and return a non-zero value. ]*/
+static void LOG_CONTEXT_BUILDER_ADD_PROPERTY_with_NULL_property_name_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_BUILDER_ADD_PROPERTY(int32_t)(log_context_builder, NULL, 42);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_031: [ LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name) shall store value in the builder data buffer by calling LOG_CONTEXT_PROPERTY_TYPE_INIT(type_name). ]*/
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_032: [ LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name) shall copy property_name in the builder data buffer, store the property with the type type_name and succeed and return 0. ]*/
+static void LOG_CONTEXT_BUILDER_ADD_PROPERTY_with_all_supported_types_succeeds(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+    setup_realloc_call();
+    setup_realloc_call();
+
+    // act
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(int64_t)(log_context_builder, "the_int64_t", INT64_MIN) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(uint64_t)(log_context_builder, "the_uint64_t", UINT64_MAX) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(int32_t)(log_context_builder, "the_int32_t", INT32_MIN) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(uint32_t)(log_context_builder, "the_uint32_t", UINT32_MAX) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(int16_t)(log_context_builder, "the_int16_t", INT16_MIN) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(uint16_t)(log_context_builder, "the_uint16_t", UINT16_MAX) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(int8_t)(log_context_builder, "the_int8_t", INT8_MIN) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(uint8_t)(log_context_builder, "the_uint8_t", UINT8_MAX) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(bool)(log_context_builder, "the_bool", true) == 0);
+
+    // assert
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    setup_mocks();
+    setup_malloc_call();
+    LOG_CONTEXT_HANDLE log_context = log_context_builder_freeze(log_context_builder, NULL);
+    POOR_MANS_ASSERT(log_context != NULL);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(log_context) == 10);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(log_context);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 9);
+    POOR_MANS_ASSERT(*(int64_t*)pairs[1].value == INT64_MIN);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "the_int64_t") == 0);
+    POOR_MANS_ASSERT(pairs[1].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_int64_t);
+    POOR_MANS_ASSERT(*(uint64_t*)pairs[2].value == UINT64_MAX);
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "the_uint64_t") == 0);
+    POOR_MANS_ASSERT(pairs[2].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_uint64_t);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[3].value == INT32_MIN);
+    POOR_MANS_ASSERT(strcmp(pairs[3].name, "the_int32_t") == 0);
+    POOR_MANS_ASSERT(pairs[3].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_int32_t);
+    POOR_MANS_ASSERT(*(uint32_t*)pairs[4].value == UINT32_MAX);
+    POOR_MANS_ASSERT(strcmp(pairs[4].name, "the_uint32_t") == 0);
+    POOR_MANS_ASSERT(pairs[4].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_uint32_t);
+    POOR_MANS_ASSERT(*(int16_t*)pairs[5].value == INT16_MIN);
+    POOR_MANS_ASSERT(strcmp(pairs[5].name, "the_int16_t") == 0);
+    POOR_MANS_ASSERT(pairs[5].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_int16_t);
+    POOR_MANS_ASSERT(*(uint16_t*)pairs[6].value == UINT16_MAX);
+    POOR_MANS_ASSERT(strcmp(pairs[6].name, "the_uint16_t") == 0);
+    POOR_MANS_ASSERT(pairs[6].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_uint16_t);
+    POOR_MANS_ASSERT(*(int8_t*)pairs[7].value == INT8_MIN);
+    POOR_MANS_ASSERT(strcmp(pairs[7].name, "the_int8_t") == 0);
+    POOR_MANS_ASSERT(pairs[7].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_int8_t);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[8].value == UINT8_MAX);
+    POOR_MANS_ASSERT(strcmp(pairs[8].name, "the_uint8_t") == 0);
+    POOR_MANS_ASSERT(pairs[8].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_uint8_t);
+    POOR_MANS_ASSERT(*(bool*)pairs[9].value == true);
+    POOR_MANS_ASSERT(strcmp(pairs[9].name, "the_bool") == 0);
+    POOR_MANS_ASSERT(pairs[9].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_bool);
+
+    // cleanup
+    test_destroy_context(log_context);
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_033: [ If any error occurs, LOG_CONTEXT_BUILDER_ADD_PROPERTY(type_name) shall fail and return a non-zero value. ]*/
+static void when_realloc_fails_LOG_CONTEXT_BUILDER_ADD_PROPERTY_also_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_realloc;
+    expected_calls[expected_call_count].realloc_call.override_result = true;
+    expected_calls[expected_call_count].realloc_call.call_result = NULL;
+    expected_call_count++;
+
+    // act
+    int result = LOG_CONTEXT_BUILDER_ADD_PROPERTY(int32_t)(log_context_builder, "the_answer", 42);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    test_destroy_builder(log_context_builder);
+}
+
+/* log_context_builder_freeze */
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_034: [ If log_context_builder is NULL, log_context_builder_freeze shall fail and return NULL. ]*/
+static void log_context_builder_freeze_with_NULL_log_context_builder_fails(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_HANDLE result = log_context_builder_freeze(NULL, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result == NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_035: [ log_context_builder_freeze shall create the context with a single allocation, sized for the properties of parent_context, one struct property and the properties added to the builder. ]*/
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_037: [ log_context_builder_freeze shall copy the values and names added to the builder in the context and store one struct property named with the context name (or empty string if no name was set) followed by the properties added to the builder. ]*/
+static void log_context_builder_freeze_with_no_properties_succeeds(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+    setup_malloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result = log_context_builder_freeze(log_context_builder, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(result) == 1);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[0].name, "") == 0);
+    POOR_MANS_ASSERT(pairs[0].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_struct);
+
+    // cleanup
+    test_destroy_context(result);
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_035: [ log_context_builder_freeze shall create the context with a single allocation, sized for the properties of parent_context, one struct property and the properties added to the builder. ]*/
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_036: [ If parent_context is non-NULL, the created context shall copy all the property/value pairs of parent_context. ]*/
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_037: [ log_context_builder_freeze shall copy the values and names added to the builder in the context and store one struct property named with the context name (or empty string if no name was set) followed by the properties added to the builder. ]*/
+static void log_context_builder_freeze_with_a_parent_succeeds(void)
+{
+    // arrange
+    setup_mocks();
+    setup_malloc_call();
+    LOG_CONTEXT_HANDLE parent_context;
+    LOG_CONTEXT_CREATE(parent_context, NULL,
+        LOG_CONTEXT_NAME(parent_name),
+        LOG_CONTEXT_PROPERTY(int32_t, the_answer, 42));
+    POOR_MANS_ASSERT(parent_context != NULL);
+
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+    setup_realloc_call();
+    POOR_MANS_ASSERT(log_context_builder_set_name(log_context_builder, "child_name") == 0);
+    setup_realloc_call();
+    POOR_MANS_ASSERT(log_context_builder_add_string_property(log_context_builder, "child_string", "%s", "gigi") == 0);
+    setup_malloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result = log_context_builder_freeze(log_context_builder, parent_context);
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(result) == 4);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    // context struct
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 2);
+    POOR_MANS_ASSERT(strcmp(pairs[0].name, "child_name") == 0);
+    POOR_MANS_ASSERT(pairs[0].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_struct);
+    // parent context struct
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[1].value == 1);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "parent_name") == 0);
+    POOR_MANS_ASSERT(pairs[1].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_struct);
+    // parent property
+    POOR_MANS_ASSERT(*(int32_t*)pairs[2].value == 42);
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "the_answer") == 0);
+    POOR_MANS_ASSERT(pairs[2].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_int32_t);
+    // child property
+    POOR_MANS_ASSERT(strcmp(pairs[3].value, "gigi") == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[3].name, "child_string") == 0);
+    POOR_MANS_ASSERT(pairs[3].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_ascii_char_ptr);
+
+    // cleanup
+    test_destroy_context(result);
+    test_destroy_context(parent_context);
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_043: [ If the name of a parent property/value pair is stored in the data area of the parent context (as done by log_context_builder_freeze), the name shall be copied at the same offset in the data area of the created context. ]*/
+static void LOG_CONTEXT_CREATE_with_a_frozen_parent_copies_the_names(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+    setup_realloc_call();
+    POOR_MANS_ASSERT(log_context_builder_set_name(log_context_builder, "parent_name") == 0);
+    setup_realloc_call();
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(int32_t)(log_context_builder, "the_answer", 42) == 0);
+    setup_malloc_call();
+    LOG_CONTEXT_HANDLE parent_context = log_context_builder_freeze(log_context_builder, NULL);
+    POOR_MANS_ASSERT(parent_context != NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    setup_mocks();
+    setup_malloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, parent_context, LOG_CONTEXT_PROPERTY(int32_t, child_property, 43));
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    // the names must not depend on the parent context anymore
+    test_destroy_context(parent_context);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(result) == 4);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 2);
+    POOR_MANS_ASSERT(strcmp(pairs[0].name, "") == 0);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[1].value == 1);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "parent_name") == 0);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[2].value == 42);
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "the_answer") == 0);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[3].value == 43);
+    POOR_MANS_ASSERT(strcmp(pairs[3].name, "child_property") == 0);
+
+    // cleanup
+    test_destroy_context(result);
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_057: [ internal_log_context_reserve shall update the names of all the property/value pairs already stored that point into the data area (names copied from a frozen parent) to point into the reallocated data area. ]*/
+static void LOG_CONTEXT_CREATE_with_a_frozen_parent_and_a_value_that_does_not_fit_rebases_the_names(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+    setup_realloc_call();
+    POOR_MANS_ASSERT(log_context_builder_set_name(log_context_builder, "parent_name") == 0);
+    setup_realloc_call();
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(int32_t)(log_context_builder, "the_answer", 42) == 0);
+    setup_malloc_call();
+    LOG_CONTEXT_HANDLE parent_context = log_context_builder_freeze(log_context_builder, NULL);
+    POOR_MANS_ASSERT(parent_context != NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    char big_string[1000];
+    (void)memset(big_string, 'x', sizeof(big_string) - 1);
+    big_string[sizeof(big_string) - 1] = '\0';
+
+    setup_mocks();
+    setup_malloc_call();
+    setup_realloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, parent_context, LOG_CONTEXT_STRING_PROPERTY(s, "%s", big_string));
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    test_destroy_context(parent_context);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(result) == 4);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 2);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "parent_name") == 0);
+    POOR_MANS_ASSERT((const uint8_t*)pairs[1].name > (const uint8_t*)pairs[0].value);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[2].value == 42);
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "the_answer") == 0);
+    POOR_MANS_ASSERT((const uint8_t*)pairs[2].name > (const uint8_t*)pairs[0].value);
+    POOR_MANS_ASSERT(strcmp(pairs[3].value, big_string) == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[3].name, "s") == 0);
+
+    // cleanup
+    test_destroy_context(result);
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_039: [ log_context_builder_freeze shall reset the builder (keeping its buffers) so that it can be used to build another context. ]*/
+static void log_context_builder_freeze_resets_the_builder_and_keeps_the_buffers(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+    setup_realloc_call();
+    setup_realloc_call();
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(int32_t)(log_context_builder, "the_answer", 42) == 0);
+    setup_malloc_call();
+    LOG_CONTEXT_HANDLE first_context = log_context_builder_freeze(log_context_builder, NULL);
+    POOR_MANS_ASSERT(first_context != NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // no realloc is expected, the buffers are reused
+    setup_mocks();
+    setup_malloc_call();
+
+    // act
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(uint8_t)(log_context_builder, "small", 1) == 0);
+    LOG_CONTEXT_HANDLE result = log_context_builder_freeze(log_context_builder, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(result) == 2);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 1);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[1].value == 1);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "small") == 0);
+    // the first context is untouched
+    pairs = log_context_get_property_value_pairs(first_context);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[1].value == 42);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "the_answer") == 0);
+
+    // cleanup
+    test_destroy_context(result);
+    test_destroy_context(first_context);
+    test_destroy_builder(log_context_builder);
+}
+
+/* Tests_SRS_LOG_CONTEXT_BUILDER_01_038: [ If any error occurs, log_context_builder_freeze shall fail and return NULL. ]*/
+static void when_malloc_fails_log_context_builder_freeze_also_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = test_create_builder();
+    setup_mocks();
+    setup_realloc_call();
+    setup_realloc_call();
+    POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(int32_t)(log_context_builder, "the_answer", 42) == 0);
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_malloc;
+    expected_calls[expected_call_count].malloc_call.override_result = true;
+    expected_calls[expected_call_count].malloc_call.call_result = NULL;
+    expected_call_count++;
+
+    // act
+    LOG_CONTEXT_HANDLE result = log_context_builder_freeze(log_context_builder, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result == NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    test_destroy_builder(log_context_builder);
+}
+
+int main(void)
+{
+    log_context_builder_create_succeeds();
+    when_malloc_fails_log_context_builder_create_also_fails();
+
+    log_context_builder_destroy_with_NULL_returns();
+    log_context_builder_destroy_frees_the_buffers_and_the_builder();
+
+    log_context_builder_reset_with_NULL_returns();
+    log_context_builder_reset_discards_the_properties_and_the_name();
+
+    log_context_builder_set_name_with_NULL_log_context_builder_fails();
+    log_context_builder_set_name_with_NULL_log_context_name_fails();
+    log_context_builder_set_name_twice_fails();
+    log_context_builder_set_name_succeeds();
+    when_realloc_fails_log_context_builder_set_name_also_fails();
+
+    log_context_builder_add_property_with_NULL_log_context_builder_fails();
+    log_context_builder_add_property_with_NULL_property_name_fails();
+    log_context_builder_add_property_with_NULL_property_type_fails();
+    log_context_builder_add_property_with_NULL_property_value_fails();
+    log_context_builder_add_property_with_an_ascii_char_ptr_succeeds();
+    when_realloc_fails_log_context_builder_add_property_also_fails();
+    log_context_builder_add_property_with_too_many_properties_fails();
+
+    log_context_builder_add_string_property_with_NULL_log_context_builder_fails();
+    log_context_builder_add_string_property_with_NULL_property_name_fails();
+    log_context_builder_add_string_property_with_NULL_format_fails();
+    log_context_builder_add_string_property_succeeds();
+    log_context_builder_add_string_property_with_a_string_that_does_not_fit_grows_the_buffer();
+    when_growing_the_buffer_fails_log_context_builder_add_string_property_also_fails();
+
+    LOG_CONTEXT_BUILDER_ADD_PROPERTY_with_NULL_log_context_builder_fails();
+    LOG_CONTEXT_BUILDER_ADD_PROPERTY_with_NULL_property_name_fails();
+    LOG_CONTEXT_BUILDER_ADD_PROPERTY_with_all_supported_types_succeeds();
+    when_realloc_fails_LOG_CONTEXT_BUILDER_ADD_PROPERTY_also_fails();
+
+    log_context_builder_freeze_with_NULL_log_context_builder_fails();
+    log_context_builder_freeze_with_no_properties_succeeds();
+    log_context_builder_freeze_with_a_parent_succeeds();
+    LOG_CONTEXT_CREATE_with_a_frozen_parent_copies_the_names();
+    LOG_CONTEXT_CREATE_with_a_frozen_parent_and_a_value_that_does_not_fit_rebases_the_names();
+    log_context_builder_freeze_resets_the_builder_and_keeps_the_buffers();
+    when_malloc_fails_log_context_builder_freeze_also_fails();
+
+    return 0;
+}
@@ -7,6 +7,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <inttypes.h>
+#include <float.h>
 
 #include "macro_utils/macro_utils.h"
 
@@ -44,6 +45,7 @@ static size_t expected_call_count;
 static size_t actual_call_count;
 static bool actual_and_expected_match;
 
+// the to_string functions do not use snprintf, no test expects a call to it
 int mock_snprintf(char* s, size_t n, const char* format, ...)
 {
     int result;
@@ -85,13 +87,6 @@ static void setup_mocks(void)
     actual_and_expected_match = true;
 }
 
-static void setup_expected_snprintf_call(void)
-{
-    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_snprintf;
-    expected_calls[expected_call_count].snprintf_call.override_result = false;
-    expected_call_count++;
-}
-
 #define TEST_BUFFER_SIZE 1024
 
 #define POOR_MANS_ASSERT(cond) \
@@ -118,8 +113,8 @@ static void int64_t_to_string_with_NULL_value_fails(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall call snprintf with buffer, buffer_length and format string PRId64 and pass in the values list the int64_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall write the decimal representation of the int64_t value pointed to by property_value in buffer by calling integer_to_string_int64 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall succeed and return the result of integer_to_string_int64. ]*/
 static void int64_t_to_string_succeeds(void)
 {
     // arrange
@@ -127,20 +122,18 @@ static void int64_t_to_string_succeeds(void)
     int64_t int64_t_value = 0;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string(&int64_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId64) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "0") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall call snprintf with buffer, buffer_length and format string PRId64 and pass in the values list the int64_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall write the decimal representation of the int64_t value pointed to by property_value in buffer by calling integer_to_string_int64 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall succeed and return the result of integer_to_string_int64. ]*/
 static void int64_t_to_string_INT64_MAX_succeeds(void)
 {
     // arrange
@@ -148,20 +141,18 @@ static void int64_t_to_string_INT64_MAX_succeeds(void)
     int64_t int64_t_value = INT64_MAX;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string(&int64_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 19);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId64) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "9223372036854775807") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall call snprintf with buffer, buffer_length and format string PRId64 and pass in the values list the int64_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall write the decimal representation of the int64_t value pointed to by property_value in buffer by calling integer_to_string_int64 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall succeed and return the result of integer_to_string_int64. ]*/
 static void int64_t_to_string_with_truncation_succeeds(void)
 {
     // arrange
@@ -169,20 +160,18 @@ static void int64_t_to_string_with_truncation_succeeds(void)
     int64_t int64_t_value = 42;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string(&int64_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 2);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId64) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "4") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall call snprintf with buffer, buffer_length and format string PRId64 and pass in the values list the int64_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall write the decimal representation of the int64_t value pointed to by property_value in buffer by calling integer_to_string_int64 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall succeed and return the result of integer_to_string_int64. ]*/
 static void int64_t_to_string_with_truncation_minus_1_succeeds(void)
 {
     // arrange
@@ -190,20 +179,18 @@ static void int64_t_to_string_with_truncation_minus_1_succeeds(void)
     int64_t int64_t_value = -1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string(&int64_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 2);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId64) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "-") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall call snprintf with buffer, buffer_length and format string PRId64 and pass in the values list the int64_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall write the decimal representation of the int64_t value pointed to by property_value in buffer by calling integer_to_string_int64 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall succeed and return the result of integer_to_string_int64. ]*/
 static void int64_t_to_string_with_negative_value_succeeds(void)
 {
     // arrange
@@ -211,20 +198,18 @@ static void int64_t_to_string_with_negative_value_succeeds(void)
     int64_t int64_t_value = -1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string(&int64_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 2);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId64) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "-1") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall call snprintf with buffer, buffer_length and format string PRId64 and pass in the values list the int64_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall write the decimal representation of the int64_t value pointed to by property_value in buffer by calling integer_to_string_int64 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall succeed and return the result of integer_to_string_int64. ]*/
 static void int64_t_to_string_with_just_enough_big_buffer_succeeds(void)
 {
     // arrange
@@ -232,39 +217,16 @@ static void int64_t_to_string_with_just_enough_big_buffer_succeeds(void)
     int64_t int64_t_value = 1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string(&int64_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId64) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "1") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_004: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string shall fail and return a negative value. ]*/
-static void when_snprintf_fails_int64_t_to_string_also_fails(void)
-{
-    // arrange
-    char buffer[TEST_BUFFER_SIZE];
-    int64_t int64_t_value = -1;
-
-    setup_mocks();
-    expected_calls[0].mock_call_type = MOCK_CALL_TYPE_snprintf;
-    expected_calls[0].snprintf_call.call_result = -1;
-    expected_calls[0].snprintf_call.override_result = true;
-    expected_call_count = 1;
-
-    // act
-    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).to_string(&int64_t_value, buffer, sizeof(buffer));
-
-    // assert
-    POOR_MANS_ASSERT(result < 0);
-    POOR_MANS_ASSERT(actual_and_expected_match);
-}
-
 /* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).copy */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_005: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).copy shall fail and return a non-zero value. ]*/
@@ -370,6 +332,22 @@ static void int64_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_int64_t(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_113: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_int64_t. ]*/
+static void int64_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_int64_t(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t).type_tag;
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_int64_t);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
 /* LOG_CONTEXT_PROPERTY_TYPE_INIT(int64_t) */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_081: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(int64_t) shall fail and return a non-zero value. ]*/
@@ -453,8 +431,8 @@ static void uint64_t_to_string_with_NULL_value_fails(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_012: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu64 and pass in the values list the uint64_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_013: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_012: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall write the decimal representation of the uint64_t value pointed to by property_value in buffer by calling integer_to_string_uint64 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_013: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall succeed and return the result of integer_to_string_uint64. ]*/
 static void uint64_t_to_string_succeeds(void)
 {
     // arrange
@@ -462,20 +440,18 @@ static void uint64_t_to_string_succeeds(void)
     uint64_t uint64_t_value = 0;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string(&uint64_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu64) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "0") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_012: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu64 and pass in the values list the uint64_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_013: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_012: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall write the decimal representation of the uint64_t value pointed to by property_value in buffer by calling integer_to_string_uint64 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_013: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall succeed and return the result of integer_to_string_uint64. ]*/
 static void uint64_t_to_string_UINT64_MAX_succeeds(void)
 {
     // arrange
@@ -483,20 +459,18 @@ static void uint64_t_to_string_UINT64_MAX_succeeds(void)
     uint64_t uint64_t_value = UINT64_MAX;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string(&uint64_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 20);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu64) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "18446744073709551615") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_012: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu64 and pass in the values list the uint64_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_013: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_012: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall write the decimal representation of the uint64_t value pointed to by property_value in buffer by calling integer_to_string_uint64 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_013: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall succeed and return the result of integer_to_string_uint64. ]*/
 static void uint64_t_to_string_with_truncation_succeeds(void)
 {
     // arrange
@@ -504,20 +478,18 @@ static void uint64_t_to_string_with_truncation_succeeds(void)
     uint64_t uint64_t_value = 42;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string(&uint64_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 2);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu64) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "4") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_012: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu64 and pass in the values list the uint64_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_013: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_012: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall write the decimal representation of the uint64_t value pointed to by property_value in buffer by calling integer_to_string_uint64 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_013: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall succeed and return the result of integer_to_string_uint64. ]*/
 static void uint64_t_to_string_with_just_enough_big_buffer_succeeds(void)
 {
     // arrange
@@ -525,39 +497,16 @@ static void uint64_t_to_string_with_just_enough_big_buffer_succeeds(void)
     uint64_t uint64_t_value = 1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string(&uint64_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu64) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "1") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_014: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string shall fail and return a negative value. ]*/
-static void when_snprintf_fails_uint64_t_to_string_also_fails(void)
-{
-    // arrange
-    char buffer[TEST_BUFFER_SIZE];
-    uint64_t uint64_t_value = 42;
-
-    setup_mocks();
-    expected_calls[0].mock_call_type = MOCK_CALL_TYPE_snprintf;
-    expected_calls[0].snprintf_call.call_result = -1;
-    expected_calls[0].snprintf_call.override_result = true;
-    expected_call_count = 1;
-
-    // act
-    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).to_string(&uint64_t_value, buffer, sizeof(buffer));
-
-    // assert
-    POOR_MANS_ASSERT(result < 0);
-    POOR_MANS_ASSERT(actual_and_expected_match);
-}
-
 /* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).copy */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_015: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).copy shall fail and return a non-zero value. ]*/
@@ -663,6 +612,22 @@ static void uint64_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_uint64_t(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_114: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_uint64_t. ]*/
+static void uint64_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_uint64_t(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t).type_tag;
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_uint64_t);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
 /* LOG_CONTEXT_PROPERTY_TYPE_INIT(uint64_t) */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_085: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(uint64_t) shall fail and return a non-zero value. ]*/
@@ -746,8 +711,8 @@ static void int32_t_to_string_with_NULL_value_fails(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall call snprintf with buffer, buffer_length and format string PRId32 and pass in the values list the int32_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall write the decimal representation of the int32_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int32_t_to_string_succeeds(void)
 {
     // arrange
@@ -755,20 +720,18 @@ static void int32_t_to_string_succeeds(void)
     int32_t int32_t_value = 0;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string(&int32_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId32) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "0") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall call snprintf with buffer, buffer_length and format string PRId32 and pass in the values list the int32_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall write the decimal representation of the int32_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int32_t_to_string_INT32_MAX_succeeds(void)
 {
     // arrange
@@ -776,20 +739,18 @@ static void int32_t_to_string_INT32_MAX_succeeds(void)
     int32_t int32_t_value = INT32_MAX;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string(&int32_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 10);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId32) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "2147483647") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall call snprintf with buffer, buffer_length and format string PRId32 and pass in the values list the int32_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall write the decimal representation of the int32_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int32_t_to_string_with_truncation_succeeds(void)
 {
     // arrange
@@ -797,7 +758,6 @@ static void int32_t_to_string_with_truncation_succeeds(void)
     int32_t int32_t_value = 42;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string(&int32_t_value, buffer, sizeof(buffer));
@@ -808,8 +768,8 @@ static void int32_t_to_string_with_truncation_succeeds(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall call snprintf with buffer, buffer_length and format string PRId32 and pass in the values list the int32_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall write the decimal representation of the int32_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int32_t_to_string_with_truncation_minus_1_succeeds(void)
 {
     // arrange
@@ -817,7 +777,6 @@ static void int32_t_to_string_with_truncation_minus_1_succeeds(void)
     int32_t int32_t_value = -1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string(&int32_t_value, buffer, sizeof(buffer));
@@ -828,8 +787,8 @@ static void int32_t_to_string_with_truncation_minus_1_succeeds(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall call snprintf with buffer, buffer_length and format string PRId32 and pass in the values list the int32_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall write the decimal representation of the int32_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int32_t_to_string_with_negative_value_succeeds(void)
 {
     // arrange
@@ -837,20 +796,18 @@ static void int32_t_to_string_with_negative_value_succeeds(void)
     int32_t int32_t_value = -1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string(&int32_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result > 0);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId32) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "-1") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall call snprintf with buffer, buffer_length and format string PRId32 and pass in the values list the int32_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall write the decimal representation of the int32_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int32_t_to_string_with_just_enough_big_buffer_succeeds(void)
 {
     // arrange
@@ -858,39 +815,16 @@ static void int32_t_to_string_with_just_enough_big_buffer_succeeds(void)
     int32_t int32_t_value = 1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string(&int32_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId32) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "1") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_024: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string shall fail and return a negative value. ]*/
-static void when_snprintf_fails_int32_t_to_string_also_fails(void)
-{
-    // arrange
-    char buffer[TEST_BUFFER_SIZE];
-    int32_t int32_t_value = -1;
-
-    setup_mocks();
-    expected_calls[0].mock_call_type = MOCK_CALL_TYPE_snprintf;
-    expected_calls[0].snprintf_call.call_result = -1;
-    expected_calls[0].snprintf_call.override_result = true;
-    expected_call_count = 1;
-
-    // act
-    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string(&int32_t_value, buffer, sizeof(buffer));
-
-    // assert
-    POOR_MANS_ASSERT(result < 0);
-    POOR_MANS_ASSERT(actual_and_expected_match);
-}
-
 /* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).copy */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_025: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).copy shall fail and return a non-zero value. ]*/
@@ -996,6 +930,22 @@ static void int32_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_int32_t(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_115: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_int32_t. ]*/
+static void int32_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_int32_t(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).type_tag;
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_int32_t);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
 /* LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t) */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_089: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t) shall fail and return a non-zero value. ]*/
@@ -1079,8 +1029,8 @@ static void uint32_t_to_string_with_NULL_value_fails(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_032: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu32 and pass in the values list the uint32_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_033: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_032: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall write the decimal representation of the uint32_t value pointed to by property_value in buffer by calling integer_to_string_uint32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_033: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall succeed and return the result of integer_to_string_uint32. ]*/
 static void uint32_t_to_string_succeeds(void)
 {
     // arrange
@@ -1088,20 +1038,18 @@ static void uint32_t_to_string_succeeds(void)
     uint32_t uint32_t_value = 0;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string(&uint32_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu32) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "0") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_032: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu32 and pass in the values list the uint32_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_033: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_032: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall write the decimal representation of the uint32_t value pointed to by property_value in buffer by calling integer_to_string_uint32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_033: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall succeed and return the result of integer_to_string_uint32. ]*/
 static void uint32_t_to_string_UINT32_MAX_succeeds(void)
 {
     // arrange
@@ -1109,20 +1057,18 @@ static void uint32_t_to_string_UINT32_MAX_succeeds(void)
     uint32_t uint32_t_value = UINT32_MAX;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string(&uint32_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 10);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu32) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "4294967295") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_032: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu32 and pass in the values list the uint32_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_033: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_032: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall write the decimal representation of the uint32_t value pointed to by property_value in buffer by calling integer_to_string_uint32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_033: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall succeed and return the result of integer_to_string_uint32. ]*/
 static void uint32_t_to_string_with_truncation_succeeds(void)
 {
     // arrange
@@ -1130,20 +1076,18 @@ static void uint32_t_to_string_with_truncation_succeeds(void)
     uint32_t uint32_t_value = 42;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string(&uint32_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 2);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu32) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "4") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_032: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu32 and pass in the values list the uint32_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_033: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_032: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall write the decimal representation of the uint32_t value pointed to by property_value in buffer by calling integer_to_string_uint32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_033: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall succeed and return the result of integer_to_string_uint32. ]*/
 static void uint32_t_to_string_with_just_enough_big_buffer_succeeds(void)
 {
     // arrange
@@ -1151,39 +1095,16 @@ static void uint32_t_to_string_with_just_enough_big_buffer_succeeds(void)
     uint32_t uint32_t_value = 1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string(&uint32_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu32) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "1") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_034: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string shall fail and return a negative value. ]*/
-static void when_snprintf_fails_uint32_t_to_string_also_fails(void)
-{
-    // arrange
-    char buffer[TEST_BUFFER_SIZE];
-    uint32_t uint32_t_value = 42;
-
-    setup_mocks();
-    expected_calls[0].mock_call_type = MOCK_CALL_TYPE_snprintf;
-    expected_calls[0].snprintf_call.call_result = -1;
-    expected_calls[0].snprintf_call.override_result = true;
-    expected_call_count = 1;
-
-    // act
-    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).to_string(&uint32_t_value, buffer, sizeof(buffer));
-
-    // assert
-    POOR_MANS_ASSERT(result < 0);
-    POOR_MANS_ASSERT(actual_and_expected_match);
-}
-
 /* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).copy */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_035: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).copy shall fail and return a non-zero value. ]*/
@@ -1289,6 +1210,22 @@ static void uint32_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_uint32_t(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_116: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_uint32_t. ]*/
+static void uint32_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_uint32_t(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t).type_tag;
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_uint32_t);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
 /* LOG_CONTEXT_PROPERTY_TYPE_INIT(uint32_t) */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_093: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(uint32_t) shall fail and return a non-zero value. ]*/
@@ -1372,8 +1309,8 @@ static void int16_t_to_string_with_NULL_value_fails(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_042: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall call snprintf with buffer, buffer_length and format string PRId16 and pass in the values list the int16_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_043: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_042: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall write the decimal representation of the int16_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_043: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int16_t_to_string_succeeds(void)
 {
     // arrange
@@ -1381,20 +1318,18 @@ static void int16_t_to_string_succeeds(void)
     int16_t int16_t_value = 0;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string(&int16_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId16) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "0") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_042: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall call snprintf with buffer, buffer_length and format string PRId16 and pass in the values list the int16_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_043: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_042: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall write the decimal representation of the int16_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_043: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int16_t_to_string_INT16_MAX_succeeds(void)
 {
     // arrange
@@ -1402,20 +1337,18 @@ static void int16_t_to_string_INT16_MAX_succeeds(void)
     int16_t int16_t_value = INT16_MAX;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string(&int16_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 5);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId16) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "32767") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_042: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall call snprintf with buffer, buffer_length and format string PRId16 and pass in the values list the int16_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_043: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_042: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall write the decimal representation of the int16_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_043: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int16_t_to_string_with_truncation_succeeds(void)
 {
     // arrange
@@ -1423,20 +1356,18 @@ static void int16_t_to_string_with_truncation_succeeds(void)
     int16_t int16_t_value = 42;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string(&int16_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 2);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId16) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "4") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_042: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall call snprintf with buffer, buffer_length and format string PRId16 and pass in the values list the int16_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_043: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_042: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall write the decimal representation of the int16_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_043: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int16_t_to_string_with_truncation_minus_1_succeeds(void)
 {
     // arrange
@@ -1444,20 +1375,18 @@ static void int16_t_to_string_with_truncation_minus_1_succeeds(void)
     int16_t int16_t_value = -1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string(&int16_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 2);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId16) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "-") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_042: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall call snprintf with buffer, buffer_length and format string PRId16 and pass in the values list the int16_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_043: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_042: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall write the decimal representation of the int16_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_043: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int16_t_to_string_with_negative_value_succeeds(void)
 {
     // arrange
@@ -1465,20 +1394,18 @@ static void int16_t_to_string_with_negative_value_succeeds(void)
     int16_t int16_t_value = -1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string(&int16_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result > 0);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId16) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "-1") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_042: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall call snprintf with buffer, buffer_length and format string PRId16 and pass in the values list the int16_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_043: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_042: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall write the decimal representation of the int16_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_043: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int16_t_to_string_with_just_enough_big_buffer_succeeds(void)
 {
     // arrange
@@ -1486,39 +1413,16 @@ static void int16_t_to_string_with_just_enough_big_buffer_succeeds(void)
     int16_t int16_t_value = 1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string(&int16_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId16) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "1") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_044: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string shall fail and return a negative value. ]*/
-static void when_snprintf_fails_int16_t_to_string_also_fails(void)
-{
-    // arrange
-    char buffer[TEST_BUFFER_SIZE];
-    int16_t int16_t_value = -1;
-
-    setup_mocks();
-    expected_calls[0].mock_call_type = MOCK_CALL_TYPE_snprintf;
-    expected_calls[0].snprintf_call.call_result = -1;
-    expected_calls[0].snprintf_call.override_result = true;
-    expected_call_count = 1;
-
-    // act
-    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).to_string(&int16_t_value, buffer, sizeof(buffer));
-
-    // assert
-    POOR_MANS_ASSERT(result < 0);
-    POOR_MANS_ASSERT(actual_and_expected_match);
-}
-
 /* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).copy */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_045: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).copy shall fail and return a non-zero value. ]*/
@@ -1624,6 +1528,22 @@ static void int16_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_int16_t(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_117: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_int16_t. ]*/
+static void int16_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_int16_t(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t).type_tag;
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_int16_t);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
 /* LOG_CONTEXT_PROPERTY_TYPE_INIT(int16_t) */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_097: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(int16_t) shall fail and return a non-zero value. ]*/
@@ -1707,8 +1627,8 @@ static void uint16_t_to_string_with_NULL_value_fails(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_052: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu16 and pass in the values list the uint16_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_053: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_052: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall write the decimal representation of the uint16_t value pointed to by property_value in buffer by calling integer_to_string_uint32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_053: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall succeed and return the result of integer_to_string_uint32. ]*/
 static void uint16_t_to_string_succeeds(void)
 {
     // arrange
@@ -1716,20 +1636,18 @@ static void uint16_t_to_string_succeeds(void)
     uint16_t uint16_t_value = 0;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string(&uint16_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu16) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "0") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_052: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu16 and pass in the values list the uint16_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_053: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_052: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall write the decimal representation of the uint16_t value pointed to by property_value in buffer by calling integer_to_string_uint32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_053: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall succeed and return the result of integer_to_string_uint32. ]*/
 static void uint16_t_to_string_UINT16_MAX_succeeds(void)
 {
     // arrange
@@ -1737,20 +1655,18 @@ static void uint16_t_to_string_UINT16_MAX_succeeds(void)
     uint16_t uint16_t_value = UINT16_MAX;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string(&uint16_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 5);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu16) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "65535") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_052: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu16 and pass in the values list the uint16_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_053: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_052: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall write the decimal representation of the uint16_t value pointed to by property_value in buffer by calling integer_to_string_uint32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_053: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall succeed and return the result of integer_to_string_uint32. ]*/
 static void uint16_t_to_string_with_truncation_succeeds(void)
 {
     // arrange
@@ -1758,20 +1674,18 @@ static void uint16_t_to_string_with_truncation_succeeds(void)
     uint16_t uint16_t_value = 42;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string(&uint16_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 2);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu16) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "4") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_052: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu16 and pass in the values list the uint16_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_053: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_052: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall write the decimal representation of the uint16_t value pointed to by property_value in buffer by calling integer_to_string_uint32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_053: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall succeed and return the result of integer_to_string_uint32. ]*/
 static void uint16_t_to_string_with_just_enough_big_buffer_succeeds(void)
 {
     // arrange
@@ -1779,39 +1693,16 @@ static void uint16_t_to_string_with_just_enough_big_buffer_succeeds(void)
     uint16_t uint16_t_value = 1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string(&uint16_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu16) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "1") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_054: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string shall fail and return a negative value. ]*/
-static void when_snprintf_fails_uint16_t_to_string_also_fails(void)
-{
-    // arrange
-    char buffer[TEST_BUFFER_SIZE];
-    uint16_t uint16_t_value = 42;
-
-    setup_mocks();
-    expected_calls[0].mock_call_type = MOCK_CALL_TYPE_snprintf;
-    expected_calls[0].snprintf_call.call_result = -1;
-    expected_calls[0].snprintf_call.override_result = true;
-    expected_call_count = 1;
-
-    // act
-    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).to_string(&uint16_t_value, buffer, sizeof(buffer));
-
-    // assert
-    POOR_MANS_ASSERT(result < 0);
-    POOR_MANS_ASSERT(actual_and_expected_match);
-}
-
 /* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).copy */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_055: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).copy shall fail and return a non-zero value. ]*/
@@ -1917,6 +1808,22 @@ static void uint16_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_uint16_t(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_118: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_uint16_t. ]*/
+static void uint16_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_uint16_t(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t).type_tag;
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_uint16_t);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
 /* LOG_CONTEXT_PROPERTY_TYPE_INIT(uint16_t) */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_101: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(uint16_t) shall fail and return a non-zero value. ]*/
@@ -2000,8 +1907,8 @@ static void int8_t_to_string_with_NULL_value_fails(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall call snprintf with buffer, buffer_length and format string PRId8 and pass in the values list the int8_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_063: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall write the decimal representation of the int8_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_063: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int8_t_to_string_succeeds(void)
 {
     // arrange
@@ -2009,20 +1916,18 @@ static void int8_t_to_string_succeeds(void)
     int8_t int8_t_value = 0;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string(&int8_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId8) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "0") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall call snprintf with buffer, buffer_length and format string PRId8 and pass in the values list the int8_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_063: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall write the decimal representation of the int8_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_063: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int8_t_to_string_INT8_MAX_succeeds(void)
 {
     // arrange
@@ -2030,20 +1935,18 @@ static void int8_t_to_string_INT8_MAX_succeeds(void)
     int8_t int8_t_value = INT8_MAX;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string(&int8_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 3);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId8) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "127") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall call snprintf with buffer, buffer_length and format string PRId8 and pass in the values list the int8_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_063: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall write the decimal representation of the int8_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_063: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int8_t_to_string_with_truncation_succeeds(void)
 {
     // arrange
@@ -2051,20 +1954,18 @@ static void int8_t_to_string_with_truncation_succeeds(void)
     int8_t int8_t_value = 42;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string(&int8_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 2);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId8) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "4") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall call snprintf with buffer, buffer_length and format string PRId8 and pass in the values list the int8_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_063: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall write the decimal representation of the int8_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_063: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int8_t_to_string_with_truncation_minus_1_succeeds(void)
 {
     // arrange
@@ -2072,20 +1973,18 @@ static void int8_t_to_string_with_truncation_minus_1_succeeds(void)
     int8_t int8_t_value = -1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string(&int8_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 2);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId8) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "-") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall call snprintf with buffer, buffer_length and format string PRId8 and pass in the values list the int8_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_063: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall write the decimal representation of the int8_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_063: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int8_t_to_string_with_negative_value_succeeds(void)
 {
     // arrange
@@ -2093,20 +1992,18 @@ static void int8_t_to_string_with_negative_value_succeeds(void)
     int8_t int8_t_value = -1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string(&int8_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result > 0);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId8) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "-1") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall call snprintf with buffer, buffer_length and format string PRId8 and pass in the values list the int8_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_063: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall write the decimal representation of the int8_t value pointed to by property_value in buffer by calling integer_to_string_int32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_063: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall succeed and return the result of integer_to_string_int32. ]*/
 static void int8_t_to_string_with_just_enough_big_buffer_succeeds(void)
 {
     // arrange
@@ -2114,39 +2011,16 @@ static void int8_t_to_string_with_just_enough_big_buffer_succeeds(void)
     int8_t int8_t_value = 1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string(&int8_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRId8) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "1") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_064: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string shall fail and return a negative value. ]*/
-static void when_snprintf_fails_int8_t_to_string_also_fails(void)
-{
-    // arrange
-    char buffer[TEST_BUFFER_SIZE];
-    int8_t int8_t_value = -1;
-
-    setup_mocks();
-    expected_calls[0].mock_call_type = MOCK_CALL_TYPE_snprintf;
-    expected_calls[0].snprintf_call.call_result = -1;
-    expected_calls[0].snprintf_call.override_result = true;
-    expected_call_count = 1;
-
-    // act
-    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).to_string(&int8_t_value, buffer, sizeof(buffer));
-
-    // assert
-    POOR_MANS_ASSERT(result < 0);
-    POOR_MANS_ASSERT(actual_and_expected_match);
-}
-
 /* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).copy */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_065: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).copy shall fail and return a non-zero value. ]*/
@@ -2252,6 +2126,22 @@ static void int8_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_int8_t(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_119: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_int8_t. ]*/
+static void int8_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_int8_t(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t).type_tag;
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_int8_t);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
 /* LOG_CONTEXT_PROPERTY_TYPE_INIT(int8_t) */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_105: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(int8_t) shall fail and return a non-zero value. ]*/
@@ -2335,8 +2225,8 @@ static void uint8_t_to_string_with_NULL_value_fails(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_072: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu8 and pass in the values list the uint8_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_073: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_072: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall write the decimal representation of the uint8_t value pointed to by property_value in buffer by calling integer_to_string_uint32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_073: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall succeed and return the result of integer_to_string_uint32. ]*/
 static void uint8_t_to_string_succeeds(void)
 {
     // arrange
@@ -2344,20 +2234,18 @@ static void uint8_t_to_string_succeeds(void)
     uint8_t uint8_t_value = 0;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string(&uint8_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu8) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "0") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_072: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu8 and pass in the values list the uint8_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_073: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_072: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall write the decimal representation of the uint8_t value pointed to by property_value in buffer by calling integer_to_string_uint32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_073: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall succeed and return the result of integer_to_string_uint32. ]*/
 static void uint8_t_to_string_UINT8_MAX_succeeds(void)
 {
     // arrange
@@ -2365,20 +2253,18 @@ static void uint8_t_to_string_UINT8_MAX_succeeds(void)
     uint8_t uint8_t_value = UINT8_MAX;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string(&uint8_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 3);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu8) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "255") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_072: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu8 and pass in the values list the uint8_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_073: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_072: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall write the decimal representation of the uint8_t value pointed to by property_value in buffer by calling integer_to_string_uint32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_073: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall succeed and return the result of integer_to_string_uint32. ]*/
 static void uint8_t_to_string_with_truncation_succeeds(void)
 {
     // arrange
@@ -2386,20 +2272,18 @@ static void uint8_t_to_string_with_truncation_succeeds(void)
     uint8_t uint8_t_value = 42;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string(&uint8_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 2);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu8) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "4") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_072: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall call snprintf with buffer, buffer_length and format string PRIu8 and pass in the values list the uint8_t value pointed to be property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_073: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_072: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall write the decimal representation of the uint8_t value pointed to by property_value in buffer by calling integer_to_string_uint32 with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_073: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall succeed and return the result of integer_to_string_uint32. ]*/
 static void uint8_t_to_string_with_just_enough_big_buffer_succeeds(void)
 {
     // arrange
@@ -2407,39 +2291,16 @@ static void uint8_t_to_string_with_just_enough_big_buffer_succeeds(void)
     uint8_t uint8_t_value = 1;
 
     setup_mocks();
-    setup_expected_snprintf_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string(&uint8_t_value, buffer, sizeof(buffer));
 
     // assert
     POOR_MANS_ASSERT(result == 1);
-    POOR_MANS_ASSERT(strcmp(expected_calls[0].snprintf_call.captured_format_arg, "%" PRIu8) == 0);
     POOR_MANS_ASSERT(strcmp(buffer, "1") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_074: [ If any error is encountered, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string shall fail and return a negative value. ]*/
-static void when_snprintf_fails_uint8_t_to_string_also_fails(void)
-{
-    // arrange
-    char buffer[TEST_BUFFER_SIZE];
-    uint8_t uint8_t_value = 42;
-
-    setup_mocks();
-    expected_calls[0].mock_call_type = MOCK_CALL_TYPE_snprintf;
-    expected_calls[0].snprintf_call.call_result = -1;
-    expected_calls[0].snprintf_call.override_result = true;
-    expected_call_count = 1;
-
-    // act
-    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).to_string(&uint8_t_value, buffer, sizeof(buffer));
-
-    // assert
-    POOR_MANS_ASSERT(result < 0);
-    POOR_MANS_ASSERT(actual_and_expected_match);
-}
-
 /* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).copy */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_075: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).copy shall fail and return a non-zero value. ]*/
@@ -2545,6 +2406,22 @@ static void uint8_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_uint8_t(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_120: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_uint8_t. ]*/
+static void uint8_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_uint8_t(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t).type_tag;
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_uint8_t);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
 /* LOG_CONTEXT_PROPERTY_TYPE_INIT(uint8_t) */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_109: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(uint8_t) shall fail and return a non-zero value. ]*/
@@ -2611,39 +2488,786 @@ static void MU_C2(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(uint8_t), _succee
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* very "poor man's" way of testing, as no test harness and mocking framework are available */
-int main(void)
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_121: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string shall fail and return a negative value. ]*/
+static void float_to_string_with_NULL_value_fails(void)
 {
-    int64_t_to_string_with_NULL_value_fails();
-    int64_t_to_string_succeeds();
-    int64_t_to_string_INT64_MAX_succeeds();
-    int64_t_to_string_with_truncation_succeeds();
-    int64_t_to_string_with_truncation_minus_1_succeeds();
-    int64_t_to_string_with_negative_value_succeeds();
-    int64_t_to_string_with_just_enough_big_buffer_succeeds();
-    when_snprintf_fails_int64_t_to_string_also_fails();
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+    setup_mocks();
 
-    int64_t_copy_called_with_NULL_dst_value_fails();
-    int64_t_copy_called_with_NULL_src_value_fails();
-    int64_t_copy_succeeds();
-    int64_t_copy_succeeds_2();
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string(NULL, buffer, TEST_BUFFER_SIZE);
 
-    int64_t_free_returns();
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
 
-    int64_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_int64_t();
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_122: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string shall write a decimal representation that reads back as the float value pointed to by property_value in buffer by calling floating_point_to_string_float with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_123: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string shall succeed and return the result of floating_point_to_string_float. ]*/
+static void float_to_string_succeeds(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+    float float_value = 0;
 
-    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(int64_t), _with_NULL_dst_value_fails)();
-    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(int64_t), _with_int64_t_min_value_succeeds)();
-    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(int64_t), _with_int64_t_max_value_succeeds)();
+    setup_mocks();
 
-    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(int64_t), _succeeds)();
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string(&float_value, buffer, sizeof(buffer));
 
-    uint64_t_to_string_with_NULL_value_fails();
-    uint64_t_to_string_succeeds();
-    uint64_t_to_string_UINT64_MAX_succeeds();
-    uint64_t_to_string_with_truncation_succeeds();
+    // assert
+    POOR_MANS_ASSERT(result == 1);
+    POOR_MANS_ASSERT(strcmp(buffer, "0") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_122: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string shall write a decimal representation that reads back as the float value pointed to by property_value in buffer by calling floating_point_to_string_float with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_123: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string shall succeed and return the result of floating_point_to_string_float. ]*/
+static void float_to_string_FLT_MAX_succeeds(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+    float float_value = FLT_MAX;
+
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string(&float_value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 13);
+    POOR_MANS_ASSERT(strcmp(buffer, "3.4028235e+38") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_122: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string shall write a decimal representation that reads back as the float value pointed to by property_value in buffer by calling floating_point_to_string_float with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_123: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string shall succeed and return the result of floating_point_to_string_float. ]*/
+static void float_to_string_with_truncation_succeeds(void)
+{
+    // arrange
+    char buffer[2];
+    float float_value = 42;
+
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string(&float_value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 2);
+    POOR_MANS_ASSERT(strcmp(buffer, "4") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_122: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string shall write a decimal representation that reads back as the float value pointed to by property_value in buffer by calling floating_point_to_string_float with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_123: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string shall succeed and return the result of floating_point_to_string_float. ]*/
+static void float_to_string_with_just_enough_big_buffer_succeeds(void)
+{
+    // arrange
+    char buffer[2];
+    float float_value = 1;
+
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).to_string(&float_value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 1);
+    POOR_MANS_ASSERT(strcmp(buffer, "1") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).copy */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_124: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).copy shall fail and return a non-zero value. ]*/
+static void float_copy_called_with_NULL_dst_value_fails(void)
+{
+    // arrange
+    float src = 42;
+
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).copy(NULL, &src);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_125: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).copy shall fail and return a non-zero value. ]*/
+static void float_copy_called_with_NULL_src_value_fails(void)
+{
+    // arrange
+    float dst;
+
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).copy(&dst, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_126: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).copy shall copy the bytes of the float value from the address pointed by src_value to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_127: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).copy shall succeed and return 0. ]*/
+static void float_copy_succeeds(void)
+{
+    // arrange
+    float src = 42;
+    float dst = 43;
+
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).copy(&dst, &src);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(dst == 42);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_126: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).copy shall copy the bytes of the float value from the address pointed by src_value to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_127: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).copy shall succeed and return 0. ]*/
+static void float_copy_succeeds_2(void)
+{
+    // arrange
+    float src = FLT_MAX;
+    float dst = 43;
+
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).copy(&dst, &src);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(dst == FLT_MAX);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).free */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_128: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).free shall return. ]*/
+static void float_free_returns(void)
+{
+    // arrange
+    float value = FLT_MAX;
+
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).free(&value);
+
+    // assert
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).get_type */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_129: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).get_type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_float. ]*/
+static void float_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_float(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).get_type();
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_float);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_130: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_float. ]*/
+static void float_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_float(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(float).type_tag;
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_float);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_INIT(float) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_131: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(float) shall fail and return a non-zero value. ]*/
+static void MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(float), _with_NULL_dst_value_fails)(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(float)(NULL, 42);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_132: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(float) shall copy the src_value bytes of the float to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_133: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(float) shall succeed and return 0. ]*/
+static void MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(float), _with_float_min_value_succeeds)(void)
+{
+    // arrange
+    float dst = 43;
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(float)(&dst, -FLT_MAX);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(dst == -FLT_MAX);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_132: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(float) shall copy the src_value bytes of the float to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_133: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(float) shall succeed and return 0. ]*/
+static void MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(float), _with_float_max_value_succeeds)(void)
+{
+    // arrange
+    float dst = 43;
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(float)(&dst, FLT_MAX);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(dst == FLT_MAX);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(float) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_134: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(float) shall return sizeof(float). ]*/
+static void MU_C2(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(float), _succeeds)(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    size_t result = LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(float)();
+
+    // assert
+    POOR_MANS_ASSERT(result == sizeof(float));
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_135: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string shall fail and return a negative value. ]*/
+static void double_to_string_with_NULL_value_fails(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string(NULL, buffer, TEST_BUFFER_SIZE);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_136: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string shall write a decimal representation that reads back as the double value pointed to by property_value in buffer by calling floating_point_to_string_double with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_137: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string shall succeed and return the result of floating_point_to_string_double. ]*/
+static void double_to_string_succeeds(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+    double double_value = 0;
+
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string(&double_value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 1);
+    POOR_MANS_ASSERT(strcmp(buffer, "0") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_136: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string shall write a decimal representation that reads back as the double value pointed to by property_value in buffer by calling floating_point_to_string_double with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_137: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string shall succeed and return the result of floating_point_to_string_double. ]*/
+static void double_to_string_DBL_MAX_succeeds(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+    double double_value = DBL_MAX;
+
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string(&double_value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 23);
+    POOR_MANS_ASSERT(strcmp(buffer, "1.7976931348623157e+308") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_136: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string shall write a decimal representation that reads back as the double value pointed to by property_value in buffer by calling floating_point_to_string_double with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_137: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string shall succeed and return the result of floating_point_to_string_double. ]*/
+static void double_to_string_with_truncation_succeeds(void)
+{
+    // arrange
+    char buffer[2];
+    double double_value = 42;
+
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string(&double_value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 2);
+    POOR_MANS_ASSERT(strcmp(buffer, "4") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_136: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string shall write a decimal representation that reads back as the double value pointed to by property_value in buffer by calling floating_point_to_string_double with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_137: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string shall succeed and return the result of floating_point_to_string_double. ]*/
+static void double_to_string_with_just_enough_big_buffer_succeeds(void)
+{
+    // arrange
+    char buffer[2];
+    double double_value = 1;
+
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).to_string(&double_value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 1);
+    POOR_MANS_ASSERT(strcmp(buffer, "1") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).copy */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_138: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).copy shall fail and return a non-zero value. ]*/
+static void double_copy_called_with_NULL_dst_value_fails(void)
+{
+    // arrange
+    double src = 42;
+
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).copy(NULL, &src);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_139: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).copy shall fail and return a non-zero value. ]*/
+static void double_copy_called_with_NULL_src_value_fails(void)
+{
+    // arrange
+    double dst;
+
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).copy(&dst, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_140: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).copy shall copy the bytes of the double value from the address pointed by src_value to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_141: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).copy shall succeed and return 0. ]*/
+static void double_copy_succeeds(void)
+{
+    // arrange
+    double src = 42;
+    double dst = 43;
+
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).copy(&dst, &src);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(dst == 42);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_140: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).copy shall copy the bytes of the double value from the address pointed by src_value to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_141: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).copy shall succeed and return 0. ]*/
+static void double_copy_succeeds_2(void)
+{
+    // arrange
+    double src = DBL_MAX;
+    double dst = 43;
+
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).copy(&dst, &src);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(dst == DBL_MAX);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).free */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_142: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).free shall return. ]*/
+static void double_free_returns(void)
+{
+    // arrange
+    double value = DBL_MAX;
+
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).free(&value);
+
+    // assert
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).get_type */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_143: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).get_type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_double. ]*/
+static void double_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_double(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).get_type();
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_double);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_144: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_double. ]*/
+static void double_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_double(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(double).type_tag;
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_double);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_INIT(double) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_145: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(double) shall fail and return a non-zero value. ]*/
+static void MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(double), _with_NULL_dst_value_fails)(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(double)(NULL, 42);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_146: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(double) shall copy the src_value bytes of the double to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_147: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(double) shall succeed and return 0. ]*/
+static void MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(double), _with_double_min_value_succeeds)(void)
+{
+    // arrange
+    double dst = 43;
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(double)(&dst, -DBL_MAX);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(dst == -DBL_MAX);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_146: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(double) shall copy the src_value bytes of the double to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_147: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(double) shall succeed and return 0. ]*/
+static void MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(double), _with_double_max_value_succeeds)(void)
+{
+    // arrange
+    double dst = 43;
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(double)(&dst, DBL_MAX);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(dst == DBL_MAX);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(double) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_148: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(double) shall return sizeof(double). ]*/
+static void MU_C2(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(double), _succeeds)(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    size_t result = LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(double)();
+
+    // assert
+    POOR_MANS_ASSERT(result == sizeof(double));
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* get_size, serialize and deserialize (the same for all basic types) */
+
+#define DEFINE_SERIALIZATION_TESTS(type_name, test_value) \
+    /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_149: [ If property_value is NULL, the get_size function of each basic type shall fail and return a negative value. ]*/ \
+    static void MU_C2(type_name, _get_size_with_NULL_value_fails)(void) \
+    { \
+        /* arrange */ \
+        setup_mocks(); \
+        /* act */ \
+        int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name).get_size(NULL); \
+        /* assert */ \
+        POOR_MANS_ASSERT(result < 0); \
+        POOR_MANS_ASSERT(actual_and_expected_match); \
+    } \
+    /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_150: [ Otherwise the get_size function of each basic type shall return sizeof(type). ]*/ \
+    static void MU_C2(type_name, _get_size_returns_the_size_of_the_type)(void) \
+    { \
+        /* arrange */ \
+        type_name value = test_value; \
+        setup_mocks(); \
+        /* act */ \
+        int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name).get_size(&value); \
+        /* assert */ \
+        POOR_MANS_ASSERT(result == (int)sizeof(type_name)); \
+        POOR_MANS_ASSERT(actual_and_expected_match); \
+    } \
+    /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_151: [ If property_value is NULL, the serialize function of each basic type shall fail and return a negative value. ]*/ \
+    static void MU_C2(type_name, _serialize_with_NULL_value_fails)(void) \
+    { \
+        /* arrange */ \
+        unsigned char buffer[sizeof(type_name)]; \
+        setup_mocks(); \
+        /* act */ \
+        int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name).serialize(NULL, buffer, sizeof(buffer)); \
+        /* assert */ \
+        POOR_MANS_ASSERT(result < 0); \
+        POOR_MANS_ASSERT(actual_and_expected_match); \
+    } \
+    /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_152: [ If buffer is NULL and buffer_size is greater than 0, the serialize function of each basic type shall fail and return a negative value. ]*/ \
+    static void MU_C2(type_name, _serialize_with_NULL_buffer_and_non_zero_buffer_size_fails)(void) \
+    { \
+        /* arrange */ \
+        type_name value = test_value; \
+        setup_mocks(); \
+        /* act */ \
+        int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name).serialize(&value, NULL, 1); \
+        /* assert */ \
+        POOR_MANS_ASSERT(result < 0); \
+        POOR_MANS_ASSERT(actual_and_expected_match); \
+    } \
+    /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_154: [ The serialize function of each basic type shall succeed and return sizeof(type). ]*/ \
+    static void MU_C2(type_name, _serialize_with_NULL_buffer_returns_the_size)(void) \
+    { \
+        /* arrange */ \
+        type_name value = test_value; \
+        setup_mocks(); \
+        /* act */ \
+        int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name).serialize(&value, NULL, 0); \
+        /* assert */ \
+        POOR_MANS_ASSERT(result == (int)sizeof(type_name)); \
+        POOR_MANS_ASSERT(actual_and_expected_match); \
+    } \
+    /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_153: [ If sizeof(type) bytes fit in buffer_size, the serialize function of each basic type shall copy the bytes of the value from property_value to buffer. ]*/ \
+    /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_154: [ The serialize function of each basic type shall succeed and return sizeof(type). ]*/ \
+    static void MU_C2(type_name, _serialize_succeeds)(void) \
+    { \
+        /* arrange */ \
+        type_name value = test_value; \
+        unsigned char buffer[sizeof(type_name) + 1]; \
+        (void)memset(buffer, 0xAA, sizeof(buffer)); \
+        setup_mocks(); \
+        /* act */ \
+        int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name).serialize(&value, buffer, sizeof(buffer)); \
+        /* assert */ \
+        POOR_MANS_ASSERT(result == (int)sizeof(type_name)); \
+        POOR_MANS_ASSERT(memcmp(buffer, &value, sizeof(type_name)) == 0); \
+        POOR_MANS_ASSERT(buffer[sizeof(type_name)] == 0xAA); \
+        POOR_MANS_ASSERT(actual_and_expected_match); \
+    } \
+    /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_153: [ If sizeof(type) bytes fit in buffer_size, the serialize function of each basic type shall copy the bytes of the value from property_value to buffer. ]*/ \
+    static void MU_C2(type_name, _serialize_with_too_small_buffer_does_not_write)(void) \
+    { \
+        /* arrange */ \
+        type_name value = test_value; \
+        unsigned char buffer[sizeof(type_name)]; \
+        (void)memset(buffer, 0xAA, sizeof(buffer)); \
+        setup_mocks(); \
+        /* act */ \
+        int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name).serialize(&value, buffer, sizeof(buffer) - 1); \
+        /* assert */ \
+        POOR_MANS_ASSERT(result == (int)sizeof(type_name)); \
+        POOR_MANS_ASSERT(buffer[0] == 0xAA); \
+        POOR_MANS_ASSERT(actual_and_expected_match); \
+    } \
+    /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_155: [ If dst_value is NULL and dst_size is greater than 0, the deserialize function of each basic type shall fail and return a negative value. ]*/ \
+    static void MU_C2(type_name, _deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails)(void) \
+    { \
+        /* arrange */ \
+        type_name value = test_value; \
+        setup_mocks(); \
+        /* act */ \
+        int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name).deserialize(NULL, sizeof(type_name), &value, sizeof(type_name)); \
+        /* assert */ \
+        POOR_MANS_ASSERT(result < 0); \
+        POOR_MANS_ASSERT(actual_and_expected_match); \
+    } \
+    /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_156: [ If buffer is NULL, the deserialize function of each basic type shall fail and return a negative value. ]*/ \
+    static void MU_C2(type_name, _deserialize_with_NULL_buffer_fails)(void) \
+    { \
+        /* arrange */ \
+        type_name value; \
+        setup_mocks(); \
+        /* act */ \
+        int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name).deserialize(&value, sizeof(value), NULL, sizeof(type_name)); \
+        /* assert */ \
+        POOR_MANS_ASSERT(result < 0); \
+        POOR_MANS_ASSERT(actual_and_expected_match); \
+    } \
+    /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_157: [ If buffer_size is not sizeof(type), the deserialize function of each basic type shall fail and return a negative value. ]*/ \
+    static void MU_C2(type_name, _deserialize_with_wrong_buffer_size_fails)(void) \
+    { \
+        /* arrange */ \
+        unsigned char buffer[sizeof(type_name) + 1] = { 0 }; \
+        type_name value; \
+        setup_mocks(); \
+        /* act */ \
+        int result_1 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name).deserialize(&value, sizeof(value), buffer, sizeof(type_name) - 1); \
+        int result_2 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name).deserialize(&value, sizeof(value), buffer, sizeof(type_name) + 1); \
+        /* assert */ \
+        POOR_MANS_ASSERT(result_1 < 0); \
+        POOR_MANS_ASSERT(result_2 < 0); \
+        POOR_MANS_ASSERT(actual_and_expected_match); \
+    } \
+    /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_158: [ If sizeof(type) bytes fit in dst_size, the deserialize function of each basic type shall copy the bytes of the value from buffer to dst_value. ]*/ \
+    /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_159: [ The deserialize function of each basic type shall succeed and return sizeof(type). ]*/ \
+    static void MU_C2(type_name, _deserialize_of_serialized_value_succeeds)(void) \
+    { \
+        /* arrange */ \
+        type_name value = test_value; \
+        type_name deserialized; \
+        unsigned char buffer[sizeof(type_name)]; \
+        POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name).serialize(&value, buffer, sizeof(buffer)) == (int)sizeof(type_name)); \
+        setup_mocks(); \
+        /* act */ \
+        int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name).deserialize(&deserialized, sizeof(deserialized), buffer, sizeof(buffer)); \
+        /* assert */ \
+        POOR_MANS_ASSERT(result == (int)sizeof(type_name)); \
+        POOR_MANS_ASSERT(memcmp(&deserialized, &value, sizeof(type_name)) == 0); \
+        POOR_MANS_ASSERT(actual_and_expected_match); \
+    } \
+    /* Tests_SRS_LOG_CONTEXT_PROPERTY_BASIC_TYPES_01_159: [ The deserialize function of each basic type shall succeed and return sizeof(type). ]*/ \
+    static void MU_C2(type_name, _deserialize_with_NULL_dst_value_returns_the_size)(void) \
+    { \
+        /* arrange */ \
+        type_name value = test_value; \
+        setup_mocks(); \
+        /* act */ \
+        int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name).deserialize(NULL, 0, &value, sizeof(value)); \
+        /* assert */ \
+        POOR_MANS_ASSERT(result == (int)sizeof(type_name)); \
+        POOR_MANS_ASSERT(actual_and_expected_match); \
+    } \
+
+DEFINE_SERIALIZATION_TESTS(int64_t, INT64_MIN)
+DEFINE_SERIALIZATION_TESTS(uint64_t, UINT64_MAX - 1)
+DEFINE_SERIALIZATION_TESTS(int32_t, -42)
+DEFINE_SERIALIZATION_TESTS(uint32_t, 0x12345678)
+DEFINE_SERIALIZATION_TESTS(int16_t, INT16_MIN)
+DEFINE_SERIALIZATION_TESTS(uint16_t, 0x1234)
+DEFINE_SERIALIZATION_TESTS(int8_t, -7)
+DEFINE_SERIALIZATION_TESTS(uint8_t, 0xA5)
+DEFINE_SERIALIZATION_TESTS(float, 1.5f)
+DEFINE_SERIALIZATION_TESTS(double, -2.25)
+
+#define RUN_SERIALIZATION_TESTS(type_name) \
+    MU_C2(type_name, _get_size_with_NULL_value_fails)(); \
+    MU_C2(type_name, _get_size_returns_the_size_of_the_type)(); \
+    MU_C2(type_name, _serialize_with_NULL_value_fails)(); \
+    MU_C2(type_name, _serialize_with_NULL_buffer_and_non_zero_buffer_size_fails)(); \
+    MU_C2(type_name, _serialize_with_NULL_buffer_returns_the_size)(); \
+    MU_C2(type_name, _serialize_succeeds)(); \
+    MU_C2(type_name, _serialize_with_too_small_buffer_does_not_write)(); \
+    MU_C2(type_name, _deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails)(); \
+    MU_C2(type_name, _deserialize_with_NULL_buffer_fails)(); \
+    MU_C2(type_name, _deserialize_with_wrong_buffer_size_fails)(); \
+    MU_C2(type_name, _deserialize_of_serialized_value_succeeds)(); \
+    MU_C2(type_name, _deserialize_with_NULL_dst_value_returns_the_size)(); \
+
+/* very "poor man's" way of testing, as no test harness and mocking framework are available */
+int main(void)
+{
+    int64_t_to_string_with_NULL_value_fails();
+    int64_t_to_string_succeeds();
+    int64_t_to_string_INT64_MAX_succeeds();
+    int64_t_to_string_with_truncation_succeeds();
+    int64_t_to_string_with_truncation_minus_1_succeeds();
+    int64_t_to_string_with_negative_value_succeeds();
+    int64_t_to_string_with_just_enough_big_buffer_succeeds();
+
+    int64_t_copy_called_with_NULL_dst_value_fails();
+    int64_t_copy_called_with_NULL_src_value_fails();
+    int64_t_copy_succeeds();
+    int64_t_copy_succeeds_2();
+
+    int64_t_free_returns();
+
+    int64_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_int64_t();
+    int64_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_int64_t();
+
+    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(int64_t), _with_NULL_dst_value_fails)();
+    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(int64_t), _with_int64_t_min_value_succeeds)();
+    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(int64_t), _with_int64_t_max_value_succeeds)();
+
+    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(int64_t), _succeeds)();
+
+    uint64_t_to_string_with_NULL_value_fails();
+    uint64_t_to_string_succeeds();
+    uint64_t_to_string_UINT64_MAX_succeeds();
+    uint64_t_to_string_with_truncation_succeeds();
     uint64_t_to_string_with_just_enough_big_buffer_succeeds();
-    when_snprintf_fails_uint64_t_to_string_also_fails();
 
     uint64_t_copy_called_with_NULL_dst_value_fails();
     uint64_t_copy_called_with_NULL_src_value_fails();
@@ -2653,6 +3277,7 @@ int main(void)
     uint64_t_free_returns();
 
     uint64_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_uint64_t();
+    uint64_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_uint64_t();
 
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(uint64_t), _with_NULL_dst_value_fails)();
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(uint64_t), _with_uint64_t_min_value_succeeds)();
@@ -2667,7 +3292,6 @@ int main(void)
     int32_t_to_string_with_truncation_minus_1_succeeds();
     int32_t_to_string_with_negative_value_succeeds();
     int32_t_to_string_with_just_enough_big_buffer_succeeds();
-    when_snprintf_fails_int32_t_to_string_also_fails();
 
     int32_t_copy_called_with_NULL_dst_value_fails();
     int32_t_copy_called_with_NULL_src_value_fails();
@@ -2677,6 +3301,7 @@ int main(void)
     int32_t_free_returns();
 
     int32_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_int32_t();
+    int32_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_int32_t();
 
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t), _with_NULL_dst_value_fails)();
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t), _with_int32_t_min_value_succeeds)();
@@ -2689,7 +3314,6 @@ int main(void)
     uint32_t_to_string_UINT32_MAX_succeeds();
     uint32_t_to_string_with_truncation_succeeds();
     uint32_t_to_string_with_just_enough_big_buffer_succeeds();
-    when_snprintf_fails_uint32_t_to_string_also_fails();
 
     uint32_t_copy_called_with_NULL_dst_value_fails();
     uint32_t_copy_called_with_NULL_src_value_fails();
@@ -2699,6 +3323,7 @@ int main(void)
     uint32_t_free_returns();
 
     uint32_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_uint32_t();
+    uint32_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_uint32_t();
 
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(uint32_t), _with_NULL_dst_value_fails)();
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(uint32_t), _with_uint32_t_min_value_succeeds)();
@@ -2713,7 +3338,6 @@ int main(void)
     int16_t_to_string_with_truncation_minus_1_succeeds();
     int16_t_to_string_with_negative_value_succeeds();
     int16_t_to_string_with_just_enough_big_buffer_succeeds();
-    when_snprintf_fails_int16_t_to_string_also_fails();
 
     int16_t_copy_called_with_NULL_dst_value_fails();
     int16_t_copy_called_with_NULL_src_value_fails();
@@ -2723,6 +3347,7 @@ int main(void)
     int16_t_free_returns();
 
     int16_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_int16_t();
+    int16_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_int16_t();
 
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(int16_t), _with_NULL_dst_value_fails)();
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(int16_t), _with_int16_t_min_value_succeeds)();
@@ -2735,7 +3360,6 @@ int main(void)
     uint16_t_to_string_UINT16_MAX_succeeds();
     uint16_t_to_string_with_truncation_succeeds();
     uint16_t_to_string_with_just_enough_big_buffer_succeeds();
-    when_snprintf_fails_uint16_t_to_string_also_fails();
 
     uint16_t_copy_called_with_NULL_dst_value_fails();
     uint16_t_copy_called_with_NULL_src_value_fails();
@@ -2745,6 +3369,7 @@ int main(void)
     uint16_t_free_returns();
 
     uint16_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_uint16_t();
+    uint16_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_uint16_t();
 
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(uint16_t), _with_NULL_dst_value_fails)();
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(uint16_t), _with_uint16_t_min_value_succeeds)();
@@ -2759,7 +3384,6 @@ int main(void)
     int8_t_to_string_with_truncation_minus_1_succeeds();
     int8_t_to_string_with_negative_value_succeeds();
     int8_t_to_string_with_just_enough_big_buffer_succeeds();
-    when_snprintf_fails_int8_t_to_string_also_fails();
 
     int8_t_copy_called_with_NULL_dst_value_fails();
     int8_t_copy_called_with_NULL_src_value_fails();
@@ -2769,6 +3393,7 @@ int main(void)
     int8_t_free_returns();
 
     int8_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_int8_t();
+    int8_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_int8_t();
 
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(int8_t), _with_NULL_dst_value_fails)();
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(int8_t), _with_int8_t_min_value_succeeds)();
@@ -2781,7 +3406,6 @@ int main(void)
     uint8_t_to_string_UINT8_MAX_succeeds();
     uint8_t_to_string_with_truncation_succeeds();
     uint8_t_to_string_with_just_enough_big_buffer_succeeds();
-    when_snprintf_fails_uint8_t_to_string_also_fails();
 
     uint8_t_copy_called_with_NULL_dst_value_fails();
     uint8_t_copy_called_with_NULL_src_value_fails();
@@ -2791,6 +3415,7 @@ int main(void)
     uint8_t_free_returns();
 
     uint8_t_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_uint8_t();
+    uint8_t_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_uint8_t();
 
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(uint8_t), _with_NULL_dst_value_fails)();
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(uint8_t), _with_uint8_t_min_value_succeeds)();
@@ -2798,5 +3423,51 @@ int main(void)
 
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(uint8_t), _succeeds)();
 
+    float_to_string_with_NULL_value_fails();
+    float_to_string_succeeds();
+    float_to_string_FLT_MAX_succeeds();
+    float_to_string_with_truncation_succeeds();
+    float_to_string_with_just_enough_big_buffer_succeeds();
+
+    float_copy_called_with_NULL_dst_value_fails();
+    float_copy_called_with_NULL_src_value_fails();
+    float_copy_succeeds();
+    float_copy_succeeds_2();
+
+    float_free_returns();
+
+    float_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_float();
+    float_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_float();
+
+    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(float), _with_NULL_dst_value_fails)();
+    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(float), _with_float_min_value_succeeds)();
+    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(float), _with_float_max_value_succeeds)();
+
+    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(float), _succeeds)();
+
+    double_to_string_with_NULL_value_fails();
+    double_to_string_succeeds();
+    double_to_string_DBL_MAX_succeeds();
+    double_to_string_with_truncation_succeeds();
+    double_to_string_with_just_enough_big_buffer_succeeds();
+
+    double_copy_called_with_NULL_dst_value_fails();
+    double_copy_called_with_NULL_src_value_fails();
+    double_copy_succeeds();
+    double_copy_succeeds_2();
+
+    double_free_returns();
+
+    double_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_double();
+    double_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_double();
+
+    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(double), _with_NULL_dst_value_fails)();
+    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(double), _with_double_min_value_succeeds)();
+    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(double), _with_double_max_value_succeeds)();
+
+    MU_C2(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(double), _succeeds)();
+
+    MU_FOR_EACH_1(RUN_SERIALIZATION_TESTS, SUPPORTED_BASIC_TYPES)
+
     return 0;
 }
@@ -350,6 +350,22 @@ static void bool_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_bool(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_015: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_bool. ]*/
+static void bool_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_bool(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).type_tag;
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_bool);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
 /* LOG_CONTEXT_PROPERTY_TYPE_INIT(bool) */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_011: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(bool) shall fail and return a non-zero value. ]*/
@@ -417,6 +433,209 @@ static void MU_C2(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(bool), _succeeds)
 }
 
 
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).get_size */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_016: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).get_size shall fail and return a negative value. ]*/
+static void bool_get_size_with_NULL_value_fails(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).get_size(NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_017: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).get_size shall return sizeof(bool). ]*/
+static void bool_get_size_returns_the_size_of_the_value(void)
+{
+    // arrange
+    bool value = true;
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).get_size(&value);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(bool));
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_018: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize shall fail and return a negative value. ]*/
+static void bool_serialize_with_NULL_value_fails(void)
+{
+    // arrange
+    unsigned char buffer[sizeof(bool)];
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_019: [ If buffer is NULL and buffer_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize shall fail and return a negative value. ]*/
+static void bool_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails(void)
+{
+    // arrange
+    bool value = true;
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize(&value, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_021: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize shall succeed and return sizeof(bool). ]*/
+static void bool_serialize_with_NULL_buffer_returns_the_size(void)
+{
+    // arrange
+    bool value = true;
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize(&value, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(bool));
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_020: [ If sizeof(bool) bytes fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize shall copy the bytes of the bool value from property_value to buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_021: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize shall succeed and return sizeof(bool). ]*/
+static void bool_serialize_succeeds(void)
+{
+    // arrange
+    bool value = true;
+    unsigned char buffer[sizeof(bool) + 1];
+    (void)memset(buffer, 0xAA, sizeof(buffer));
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize(&value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(bool));
+    POOR_MANS_ASSERT(memcmp(buffer, &value, sizeof(bool)) == 0);
+    POOR_MANS_ASSERT(buffer[sizeof(bool)] == 0xAA);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_020: [ If sizeof(bool) bytes fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize shall copy the bytes of the bool value from property_value to buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_021: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize shall succeed and return sizeof(bool). ]*/
+static void bool_serialize_with_too_small_buffer_only_returns_the_size(void)
+{
+    // arrange
+    bool value = true;
+    unsigned char buffer[sizeof(bool)];
+    (void)memset(buffer, 0xAA, sizeof(buffer));
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize(&value, buffer, sizeof(buffer) - 1);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(bool));
+    POOR_MANS_ASSERT(buffer[0] == 0xAA);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_022: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize shall fail and return a negative value. ]*/
+static void bool_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    // arrange
+    bool value = true;
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize(NULL, sizeof(bool), &value, sizeof(bool));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_023: [ If buffer is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize shall fail and return a negative value. ]*/
+static void bool_deserialize_with_NULL_buffer_fails(void)
+{
+    // arrange
+    bool deserialized;
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize(&deserialized, sizeof(deserialized), NULL, sizeof(bool));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_024: [ If buffer_size is not sizeof(bool), LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize shall fail and return a negative value. ]*/
+static void bool_deserialize_with_wrong_buffer_size_fails(void)
+{
+    // arrange
+    unsigned char buffer[sizeof(bool) + 1] = { 0 };
+    bool deserialized;
+    setup_mocks();
+
+    // act
+    int result_1 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize(&deserialized, sizeof(deserialized), buffer, sizeof(bool) - 1);
+    int result_2 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize(&deserialized, sizeof(deserialized), buffer, sizeof(bool) + 1);
+
+    // assert
+    POOR_MANS_ASSERT(result_1 < 0);
+    POOR_MANS_ASSERT(result_2 < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_025: [ If sizeof(bool) bytes fit in dst_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize shall copy the bytes of the bool value from buffer to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_026: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize shall succeed and return sizeof(bool). ]*/
+static void bool_deserialize_of_serialized_value_succeeds(void)
+{
+    // arrange
+    bool value = true;
+    bool deserialized;
+    unsigned char buffer[sizeof(bool)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).serialize(&value, buffer, sizeof(buffer)) == (int)sizeof(bool));
+    (void)memset(&deserialized, 0, sizeof(deserialized));
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize(&deserialized, sizeof(deserialized), buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(bool));
+    POOR_MANS_ASSERT(memcmp(&deserialized, &value, sizeof(bool)) == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_BOOL_TYPE_07_026: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize shall succeed and return sizeof(bool). ]*/
+static void bool_deserialize_with_NULL_dst_value_returns_the_size(void)
+{
+    // arrange
+    bool value = true;
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(bool).deserialize(NULL, 0, &value, sizeof(value));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(bool));
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
 /* very "poor man's" way of testing, as no test harness and mocking framework are available */
 int main(void)
 {
@@ -436,6 +655,20 @@ int main(void)
     bool_false_free_returns();
 
     bool_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_bool();
+    bool_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_bool();
+
+    bool_get_size_with_NULL_value_fails();
+    bool_get_size_returns_the_size_of_the_value();
+    bool_serialize_with_NULL_value_fails();
+    bool_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails();
+    bool_serialize_with_NULL_buffer_returns_the_size();
+    bool_serialize_succeeds();
+    bool_serialize_with_too_small_buffer_only_returns_the_size();
+    bool_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    bool_deserialize_with_NULL_buffer_fails();
+    bool_deserialize_with_wrong_buffer_size_fails();
+    bool_deserialize_of_serialized_value_succeeds();
+    bool_deserialize_with_NULL_dst_value_returns_the_size();
 
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(bool), _with_NULL_dst_value_fails)();
     MU_C2(LOG_CONTEXT_PROPERTY_TYPE_INIT(bool), _with_bool_true_succeeds)();
@@ -0,0 +1,348 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context_property_type_if.h"
+#include "c_logging/log_context_property_basic_types.h"
+#include "c_logging/log_context_property_type_struct.h"
+#include "c_logging/log_context_property_value_pair.h"
+#include "c_logging/log_context_property_to_string.h"
+#include "c_logging/log_printf.h"
+
+#include "timer.h"
+
+// Measures the cost of one to_string call for each property type, compared with the snprintf call it replaces,
+// the cost of rendering deep and wide contexts with log_context_property_to_string
+// and the cost of formatting typical user messages with log_snprintf and log_vsnprintf_cached compared with snprintf
+
+#define TEST_TIME 1000 // ms per measurement
+#define ITERATION_COUNT 100000
+#define VALUE_COUNT 16
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+static void print_results(const char* type_name, double to_string_ns, double snprintf_ns)
+{
+    (void)printf("%-10s to_string: %6.2lf ns/call, snprintf: %6.2lf ns/call, speedup: %.2lfx\r\n",
+        type_name, to_string_ns, snprintf_ns, snprintf_ns / to_string_ns);
+}
+
+// values spread over all the digit counts of a type (the values wrap around for the narrow types)
+static void fill_values(uint64_t values[VALUE_COUNT])
+{
+    uint64_t value = 7;
+    for (uint32_t i = 0; i < VALUE_COUNT; i++)
+    {
+        values[i] = value;
+        value = value * 13 + 5;
+    }
+}
+
+// sink for the produced characters, so that the calls cannot be optimized away
+static volatile char last_char;
+
+#define DEFINE_TO_STRING_PERF_TEST(type_name, print_format_string) \
+    static void MU_C2(measure_, type_name)(void) \
+    { \
+        uint64_t raw_values[VALUE_COUNT]; \
+        type_name values[VALUE_COUNT]; \
+        char buffer[32]; \
+        double start_time; \
+        double current_time; \
+        uint64_t call_count; \
+        double to_string_ns; \
+        double snprintf_ns; \
+        fill_values(raw_values); \
+        for (uint32_t i = 0; i < VALUE_COUNT; i++) \
+        { \
+            values[i] = (type_name)raw_values[i]; \
+        } \
+        call_count = 0; \
+        start_time = timer_global_get_elapsed_us(); \
+        while ((current_time = timer_global_get_elapsed_us()) - start_time < TEST_TIME * 1000) \
+        { \
+            for (uint32_t i = 0; i < ITERATION_COUNT; i++) \
+            { \
+                POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(type_name).to_string(&values[i % VALUE_COUNT], buffer, sizeof(buffer)) > 0); \
+                last_char = buffer[0]; \
+            } \
+            call_count += ITERATION_COUNT; \
+        } \
+        to_string_ns = (current_time - start_time) * 1000.0 / (double)call_count; \
+        call_count = 0; \
+        start_time = timer_global_get_elapsed_us(); \
+        while ((current_time = timer_global_get_elapsed_us()) - start_time < TEST_TIME * 1000) \
+        { \
+            for (uint32_t i = 0; i < ITERATION_COUNT; i++) \
+            { \
+                POOR_MANS_ASSERT(snprintf(buffer, sizeof(buffer), "%" print_format_string, values[i % VALUE_COUNT]) > 0); \
+                last_char = buffer[0]; \
+            } \
+            call_count += ITERATION_COUNT; \
+        } \
+        snprintf_ns = (current_time - start_time) * 1000.0 / (double)call_count; \
+        print_results(MU_TOSTRING(type_name), to_string_ns, snprintf_ns); \
+    } \
+
+DEFINE_TO_STRING_PERF_TEST(int64_t, PRId64)
+DEFINE_TO_STRING_PERF_TEST(uint64_t, PRIu64)
+DEFINE_TO_STRING_PERF_TEST(int32_t, PRId32)
+DEFINE_TO_STRING_PERF_TEST(uint32_t, PRIu32)
+DEFINE_TO_STRING_PERF_TEST(int16_t, PRId16)
+DEFINE_TO_STRING_PERF_TEST(uint16_t, PRIu16)
+DEFINE_TO_STRING_PERF_TEST(int8_t, PRId8)
+DEFINE_TO_STRING_PERF_TEST(uint8_t, PRIu8)
+DEFINE_TO_STRING_PERF_TEST(float, "g")
+DEFINE_TO_STRING_PERF_TEST(double, "g")
+
+#define WIDE_PROPERTY_COUNT 64
+#define DEEP_STRUCT_COUNT 32
+#define CONTEXT_BUFFER_SIZE 4096
+
+static const char* property_names[] = { "a", "some_id", "request_count", "x", "latency_us", "b", "retry_index", "partition" };
+
+// snprintf per fragment and recursion for structs, the way log_context_property_to_string used to render
+static int snprintf_render_properties(char* buffer, size_t buffer_size, const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs, size_t property_value_pair_count, uint32_t depth, size_t* properties_consumed)
+{
+    int result = 0;
+    size_t fields_printed = 0;
+    size_t i = 0;
+    for (; (depth == 0 && i < property_value_pair_count) || (depth > 0 && fields_printed < property_value_pair_count); i++)
+    {
+        int n;
+        fields_printed++;
+        if (property_value_pairs[i].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_struct)
+        {
+            size_t consumed = 0;
+            n = snprintf(buffer, buffer_size, " %s%s{", property_value_pairs[i].name, property_value_pairs[i].name[0] == 0 ? "" : "=");
+            n = ((size_t)n < buffer_size) ? n : (int)buffer_size;
+            buffer += n; buffer_size -= n; result += n;
+            n = snprintf_render_properties(buffer, buffer_size, &property_value_pairs[i + 1], *(const uint8_t*)property_value_pairs[i].value, depth + 1, &consumed);
+            n = ((size_t)n < buffer_size) ? n : (int)buffer_size;
+            buffer += n; buffer_size -= n; result += n;
+            i += consumed;
+            n = snprintf(buffer, buffer_size, " }");
+        }
+        else
+        {
+            n = snprintf(buffer, buffer_size, " %s=", property_value_pairs[i].name);
+            n = ((size_t)n < buffer_size) ? n : (int)buffer_size;
+            buffer += n; buffer_size -= n; result += n;
+            n = property_value_pairs[i].type->to_string(property_value_pairs[i].value, buffer, buffer_size);
+        }
+        n = ((size_t)n < buffer_size) ? n : (int)buffer_size;
+        buffer += n; buffer_size -= n; result += n;
+    }
+
+    if (properties_consumed != NULL)
+    {
+        *properties_consumed = i;
+    }
+
+    return result;
+}
+
+static void measure_context(const char* context_name, const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs, size_t property_value_pair_count)
+{
+    char buffer[CONTEXT_BUFFER_SIZE];
+    char expected_buffer[CONTEXT_BUFFER_SIZE];
+    double start_time;
+    double current_time;
+    uint64_t call_count;
+    double to_string_ns;
+    double snprintf_ns;
+
+    // both renderings must be identical, otherwise the comparison is meaningless
+    int expected_length = snprintf_render_properties(expected_buffer, sizeof(expected_buffer), property_value_pairs, property_value_pair_count, 0, NULL);
+    POOR_MANS_ASSERT(log_context_property_to_string(buffer, sizeof(buffer), property_value_pairs, property_value_pair_count) == expected_length);
+    POOR_MANS_ASSERT(strcmp(buffer, expected_buffer) == 0);
+
+    call_count = 0;
+    start_time = timer_global_get_elapsed_us();
+    while ((current_time = timer_global_get_elapsed_us()) - start_time < TEST_TIME * 1000)
+    {
+        for (uint32_t i = 0; i < ITERATION_COUNT / 100; i++)
+        {
+            POOR_MANS_ASSERT(log_context_property_to_string(buffer, sizeof(buffer), property_value_pairs, property_value_pair_count) > 0);
+            last_char = buffer[1];
+        }
+        call_count += ITERATION_COUNT / 100;
+    }
+    to_string_ns = (current_time - start_time) * 1000.0 / (double)call_count;
+
+    call_count = 0;
+    start_time = timer_global_get_elapsed_us();
+    while ((current_time = timer_global_get_elapsed_us()) - start_time < TEST_TIME * 1000)
+    {
+        for (uint32_t i = 0; i < ITERATION_COUNT / 100; i++)
+        {
+            POOR_MANS_ASSERT(snprintf_render_properties(buffer, sizeof(buffer), property_value_pairs, property_value_pair_count, 0, NULL) > 0);
+            last_char = buffer[1];
+        }
+        call_count += ITERATION_COUNT / 100;
+    }
+    snprintf_ns = (current_time - start_time) * 1000.0 / (double)call_count;
+
+    (void)printf("%-10s log_context_property_to_string: %8.2lf ns/call, snprintf per fragment: %8.2lf ns/call, speedup: %.2lfx (%d chars)\r\n",
+        context_name, to_string_ns, snprintf_ns, snprintf_ns / to_string_ns, expected_length);
+}
+
+// one struct with many fields of mixed types
+static void measure_wide_context(void)
+{
+    uint64_t raw_values[VALUE_COUNT];
+    int32_t int32_values[WIDE_PROPERTY_COUNT];
+    uint64_t uint64_values[WIDE_PROPERTY_COUNT];
+    uint8_t field_count = WIDE_PROPERTY_COUNT;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR property_value_pairs[WIDE_PROPERTY_COUNT + 1];
+
+    fill_values(raw_values);
+
+    property_value_pairs[0].name = "wide";
+    property_value_pairs[0].value = &field_count;
+    property_value_pairs[0].type = &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct);
+    for (uint32_t i = 0; i < WIDE_PROPERTY_COUNT; i++)
+    {
+        property_value_pairs[i + 1].name = property_names[i % MU_COUNT_ARRAY_ITEMS(property_names)];
+        if (i % 2 == 0)
+        {
+            int32_values[i] = (int32_t)raw_values[i % VALUE_COUNT];
+            property_value_pairs[i + 1].value = &int32_values[i];
+            property_value_pairs[i + 1].type = &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t);
+        }
+        else
+        {
+            uint64_values[i] = raw_values[i % VALUE_COUNT];
+            property_value_pairs[i + 1].value = &uint64_values[i];
+            property_value_pairs[i + 1].type = &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t);
+        }
+    }
+
+    measure_context("wide", property_value_pairs, MU_COUNT_ARRAY_ITEMS(property_value_pairs));
+}
+
+// a chain of nested structs (as produced by contexts with parents), each with a name and one field of its own
+static void measure_deep_context(void)
+{
+    int32_t values[DEEP_STRUCT_COUNT];
+    uint8_t field_counts[DEEP_STRUCT_COUNT];
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR property_value_pairs[DEEP_STRUCT_COUNT * 2];
+
+    for (uint32_t i = 0; i < DEEP_STRUCT_COUNT; i++)
+    {
+        // the innermost struct only has its own field
+        field_counts[i] = (i == DEEP_STRUCT_COUNT - 1) ? 1 : 2;
+        values[i] = (int32_t)(i * 1000 + 7);
+
+        property_value_pairs[i].name = (i % 2 == 0) ? "outer" : "";
+        property_value_pairs[i].value = &field_counts[i];
+        property_value_pairs[i].type = &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct);
+
+        // the fields follow the innermost struct, innermost first
+        property_value_pairs[DEEP_STRUCT_COUNT * 2 - 1 - i].name = property_names[i % MU_COUNT_ARRAY_ITEMS(property_names)];
+        property_value_pairs[DEEP_STRUCT_COUNT * 2 - 1 - i].value = &values[i];
+        property_value_pairs[DEEP_STRUCT_COUNT * 2 - 1 - i].type = &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t);
+    }
+
+    measure_context("deep", property_value_pairs, MU_COUNT_ARRAY_ITEMS(property_value_pairs));
+}
+
+#define MESSAGE_BUFFER_SIZE 256
+
+// the perf test formats with literal formats only, as log_vsnprintf_cached requires
+static int perf_log_snprintf_cached(char* buffer, size_t buffer_size, const char* format, ...)
+{
+    int result;
+    va_list args;
+    va_start(args, format);
+    result = log_vsnprintf_cached(buffer, buffer_size, format, args);
+    va_end(args);
+    return result;
+}
+
+// measures the ns per call of one snprintf like function for format and its arguments
+#define MEASURE_MESSAGE_FUNCTION(function, result_ns, format, ...) \
+    { \
+        double start_time; \
+        double current_time; \
+        uint64_t call_count = 0; \
+        start_time = timer_global_get_elapsed_us(); \
+        while ((current_time = timer_global_get_elapsed_us()) - start_time < TEST_TIME * 1000) \
+        { \
+            for (uint32_t i = 0; i < ITERATION_COUNT / 10; i++) \
+            { \
+                POOR_MANS_ASSERT(function(buffer, sizeof(buffer), format, __VA_ARGS__) > 0); \
+                last_char = buffer[1]; \
+            } \
+            call_count += ITERATION_COUNT / 10; \
+        } \
+        result_ns = (current_time - start_time) * 1000.0 / (double)call_count; \
+    } \
+
+// format and arguments are expanded in each loop, so that each call sees the arguments the way a log call site does
+#define MEASURE_MESSAGE(message_name, format, ...) \
+    { \
+        char buffer[MESSAGE_BUFFER_SIZE]; \
+        char expected_buffer[MESSAGE_BUFFER_SIZE]; \
+        double log_snprintf_ns; \
+        double cached_ns; \
+        double snprintf_ns; \
+        int expected_length = snprintf(expected_buffer, sizeof(expected_buffer), format, __VA_ARGS__); \
+        POOR_MANS_ASSERT(log_snprintf(buffer, sizeof(buffer), format, __VA_ARGS__) == expected_length); \
+        POOR_MANS_ASSERT(strcmp(buffer, expected_buffer) == 0); \
+        POOR_MANS_ASSERT(perf_log_snprintf_cached(buffer, sizeof(buffer), format, __VA_ARGS__) == expected_length); \
+        POOR_MANS_ASSERT(strcmp(buffer, expected_buffer) == 0); \
+        MEASURE_MESSAGE_FUNCTION(log_snprintf, log_snprintf_ns, format, __VA_ARGS__); \
+        MEASURE_MESSAGE_FUNCTION(perf_log_snprintf_cached, cached_ns, format, __VA_ARGS__); \
+        MEASURE_MESSAGE_FUNCTION(snprintf, snprintf_ns, format, __VA_ARGS__); \
+        (void)printf("%-10s log_snprintf: %6.2lf ns/call, log_vsnprintf_cached: %6.2lf ns/call, snprintf: %6.2lf ns/call, speedup: %.2lfx / %.2lfx\r\n", \
+            message_name, log_snprintf_ns, cached_ns, snprintf_ns, snprintf_ns / log_snprintf_ns, snprintf_ns / cached_ns); \
+    } \
+
+static void measure_messages(void)
+{
+    static volatile uint64_t request_id = 18446744073709ULL;
+    static volatile int error_code = -2147024894;
+    static const char* volatile file_name = "/var/lib/some_service/partition_42/data.bin";
+    static int handle_target;
+    void* volatile handle = &handle_target;
+
+    MEASURE_MESSAGE("%s", "Opening file %s", file_name);
+    MEASURE_MESSAGE("%d", "Operation failed with %d", error_code);
+    MEASURE_MESSAGE("PRIu64", "Request %" PRIu64 " completed", request_id);
+    MEASURE_MESSAGE("%p", "Created handle %p", handle);
+    MEASURE_MESSAGE("mixed", "Request %" PRIu64 " on %s failed with %d (handle=%p)", request_id, file_name, error_code, handle);
+}
+
+int main(void)
+{
+    measure_int64_t();
+    measure_uint64_t();
+    measure_int32_t();
+    measure_uint32_t();
+    measure_int16_t();
+    measure_uint16_t();
+    measure_int8_t();
+    measure_uint8_t();
+    measure_float();
+    measure_double();
+
+    measure_wide_context();
+    measure_deep_context();
+
+    measure_messages();
+
+    return 0;
+}
@@ -0,0 +1,20 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#ifndef TIMER_H
+#define TIMER_H
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// This is a minimal version of the timer unit (just for tests)
+
+double timer_global_get_elapsed_us(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMER_H */
@@ -12,6 +12,7 @@
 
 #include "c_logging/log_context_property_basic_types.h"
 #include "c_logging/log_context_property_type_ascii_char_ptr.h"
+#include "c_logging/log_context_property_type_struct.h"
 #include "c_logging/log_context_property_value_pair.h"
 #include "c_logging/log_context.h"
 
@@ -19,90 +20,51 @@
 
 #define LOG_MAX_MESSAGE_LENGTH 4096
 
-// defines how many mock calls we can have
-#define MAX_MOCK_CALL_COUNT (128)
-
-#define MOCK_CALL_TYPE_VALUES \
-    MOCK_CALL_TYPE_snprintf \
-
-MU_DEFINE_ENUM(MOCK_CALL_TYPE, MOCK_CALL_TYPE_VALUES)
-
-// very poor mans mocks :-(
-
-typedef struct snprintf_CALL_TAG
-{
-    bool override_result;
-    int call_result;
-    const char* captured_format_arg;
-} snprintf_CALL;
-
-typedef struct MOCK_CALL_TAG
-{
-    MOCK_CALL_TYPE mock_call_type;
-    union
-    {
-        snprintf_CALL snprintf_call;
-    };
-} MOCK_CALL;
-
-static MOCK_CALL expected_calls[MAX_MOCK_CALL_COUNT];
-static size_t expected_call_count;
-static size_t actual_call_count;
-static bool actual_and_expected_match;
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
 
-static void setup_mocks(void)
-{
-    expected_call_count = 0;
-    actual_call_count = 0;
-    actual_and_expected_match = true;
-}
+// property type that counts the to_string calls and can be made to fail a given call (renders an int32_t otherwise)
+static size_t test_to_string_call_count;
+static size_t test_to_string_fail_call;
 
-int mock_snprintf(char* s, size_t n, const char* format, ...)
+static int test_property_type_to_string(const void* property_value, char* buffer, size_t buffer_length)
 {
     int result;
 
-    if ((actual_call_count == expected_call_count) ||
-        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_snprintf))
+    test_to_string_call_count++;
+    if (test_to_string_call_count == test_to_string_fail_call)
     {
-        actual_and_expected_match = false;
-        result =-1;
+        result = -1;
     }
     else
     {
-        if (expected_calls[actual_call_count].snprintf_call.override_result)
-        {
-            result = expected_calls[actual_call_count].snprintf_call.call_result;
-        }
-        else
-        {
-            expected_calls[actual_call_count].snprintf_call.captured_format_arg = format;
-
-            va_list args;
-            va_start(args, format);
-
-            result = vsnprintf(s, n, format, args);
-
-            va_end(args);
-        }
-
-        actual_call_count++;
+        result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).to_string(property_value, buffer, buffer_length);
     }
 
     return result;
 }
 
-#define POOR_MANS_ASSERT(cond) \
-    if (!(cond)) \
-    { \
-        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
-        abort(); \
-    } \
-
-static void setup_snprintf_call(void)
+static const LOG_CONTEXT_PROPERTY_TYPE_IF test_property_type =
 {
-    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_snprintf;
-    expected_calls[expected_call_count].snprintf_call.override_result = false;
-    expected_call_count++;
+    test_property_type_to_string,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    LOG_CONTEXT_PROPERTY_TYPE_int32_t
+};
+
+// fail_call is 1 based, 0 means no call fails
+static void setup_test_property_type(size_t fail_call)
+{
+    test_to_string_call_count = 0;
+    test_to_string_fail_call = fail_call;
 }
 
 static void validate_log_line(const char* actual_string, const char* expected_format, const char* expected_log_level_string, const char* file, int line, const char* func, const char* expected_message)
@@ -142,7 +104,6 @@ static void log_context_property_to_string_with_NULL_buffer_fails(void)
     size_t property_value_pair_count = log_context_get_property_value_pair_count(&context_1);
     const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(&context_1);
 
-    setup_mocks();
 
     // act
     int result = log_context_property_to_string(NULL, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, property_value_pair_count);
@@ -161,7 +122,6 @@ static void log_context_property_to_string_with_0_buffer_size_fails(void)
     size_t property_value_pair_count = log_context_get_property_value_pair_count(&context_1);
     const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(&context_1);
 
-    setup_mocks();
 
     // act
     int result = log_context_property_to_string(buffer, 0, property_value_pairs, property_value_pair_count);
@@ -179,7 +139,6 @@ static void log_context_property_to_string_with_NULL_property_value_pairs_fails(
     LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
     size_t property_value_pair_count = log_context_get_property_value_pair_count(&context_1);
 
-    setup_mocks();
 
     // act
     int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, NULL, property_value_pair_count);
@@ -197,7 +156,6 @@ static void log_context_property_to_string_with_0_property_value_pair_count_fail
     LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
     const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(&context_1);
 
-    setup_mocks();
 
     // act
     int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, 0);
@@ -226,16 +184,12 @@ static void log_context_property_to_string_with_single_property_no_struct(void)
     property_value_pair.value = &x;
     property_value_pair.type = &int32_t_log_context_property_type;
 
-    setup_mocks();
 
-    setup_snprintf_call(); // property
 
     // act
     int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, &property_value_pair, property_value_pair_count);
 
     // assert
-    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(actual_and_expected_match);
     const char expected_string[] = " x=42";
     validate_property_string(buffer, expected_string);
     POOR_MANS_ASSERT(result == sizeof(expected_string) - 1);
@@ -258,18 +212,12 @@ static void log_context_property_to_string_with_non_NULL_context_prints_one_prop
     size_t property_value_pair_count = log_context_get_property_value_pair_count(&context_1);
     const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(&context_1);
 
-    setup_mocks();
 
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // property
-    setup_snprintf_call(); // context closing
 
     // act
     int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, property_value_pair_count);
 
     // assert
-    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(actual_and_expected_match);
     const char expected_string[] = " { x=42 }";
     validate_property_string(buffer, expected_string);
     POOR_MANS_ASSERT(result == sizeof(expected_string) - 1);
@@ -292,19 +240,12 @@ static void log_context_property_to_string_with_non_NULL_context_prints_2_proper
     size_t property_value_pair_count = log_context_get_property_value_pair_count(&context_1);
     const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(&context_1);
 
-    setup_mocks();
 
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // property
-    setup_snprintf_call(); // property
-    setup_snprintf_call(); // context closing
 
     // act
     int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, property_value_pair_count);
 
     // assert
-    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(actual_and_expected_match);
     const char expected_string[] = " { x=42 y=1 }";
     validate_property_string(buffer, expected_string);
     POOR_MANS_ASSERT(result == sizeof(expected_string) - 1);
@@ -328,21 +269,12 @@ static void log_context_property_to_string_with_non_NULL_context_with_2_levels_w
     size_t property_value_pair_count = log_context_get_property_value_pair_count(&context_2);
     const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(&context_2);
 
-    setup_mocks();
 
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // property
-    setup_snprintf_call(); // context closing
-    setup_snprintf_call(); // property
-    setup_snprintf_call(); // context closing
 
     // act
     int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, property_value_pair_count);
 
     // assert
-    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(actual_and_expected_match);
     const char expected_string[] = " { { x=42 } y=1 }";
     validate_property_string(buffer, expected_string);
     POOR_MANS_ASSERT(result == sizeof(expected_string) - 1);
@@ -366,21 +298,12 @@ static void log_context_property_to_string_with_non_NULL_named_contexts_with_2_l
     size_t property_value_pair_count = log_context_get_property_value_pair_count(&context_2);
     const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(&context_2);
 
-    setup_mocks();
 
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // property
-    setup_snprintf_call(); // context closing
-    setup_snprintf_call(); // property
-    setup_snprintf_call(); // context closing
 
     // act
     int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, property_value_pair_count);
 
     // assert
-    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(actual_and_expected_match);
     const char expected_string[] = " uaga={ haga={ x=42 } y=1 }";
     validate_property_string(buffer, expected_string);
     POOR_MANS_ASSERT(result == sizeof(expected_string) - 1);
@@ -402,17 +325,12 @@ static void log_context_property_to_string_with_non_NULL_empty_context_works(voi
     size_t property_value_pair_count = log_context_get_property_value_pair_count(&context_1);
     const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(&context_1);
 
-    setup_mocks();
 
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // context closing
 
     // act
     int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, property_value_pair_count);
 
     // assert
-    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(actual_and_expected_match);
     const char expected_string[] = " { }";
     validate_property_string(buffer, expected_string);
     POOR_MANS_ASSERT(result == sizeof(expected_string) - 1);
@@ -438,21 +356,12 @@ static void log_context_property_to_string_with_non_NULL_dynamically_allocated_c
     size_t property_value_pair_count = log_context_get_property_value_pair_count(context_2);
     const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(context_2);
 
-    setup_mocks();
 
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // property
-    setup_snprintf_call(); // context closing
-    setup_snprintf_call(); // property
-    setup_snprintf_call(); // context closing
 
     // act
     int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, property_value_pair_count);
 
     // assert
-    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(actual_and_expected_match);
     const char expected_string[] = " { { x=42 } y=1 }";
     validate_property_string(buffer, expected_string);
     POOR_MANS_ASSERT(result == sizeof(expected_string) - 1);
@@ -462,181 +371,234 @@ static void log_context_property_to_string_with_non_NULL_dynamically_allocated_c
     LOG_CONTEXT_DESTROY(context_2);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_context_property_to_string shall fail and return a negative value. ]*/
-static void when_snprintf_fails_for_context_open_brace_log_context_property_to_string_fails(void)
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_022: [ If to_string fails for any property, log_context_property_to_string shall fail and return a negative value. ]*/
+static void when_to_string_fails_for_property_in_inner_context_log_context_property_to_string_fails(void)
 {
     // arrange
     char buffer[LOG_MAX_MESSAGE_LENGTH];
 
-    LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
-    LOG_CONTEXT_LOCAL_DEFINE(context_2, &context_1, LOG_CONTEXT_PROPERTY(uint32_t, y, 1));
-    size_t property_value_pair_count = log_context_get_property_value_pair_count(&context_2);
-    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(&context_2);
-
-    setup_mocks();
-
-    setup_snprintf_call(); // context opening
+    uint8_t outer_field_count = 2;
+    uint8_t inner_field_count = 1;
+    int32_t x = 42;
+    int32_t y = 1;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR property_value_pairs[] =
+    {
+        { "", &outer_field_count, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct) },
+        { "", &inner_field_count, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct) },
+        { "x", &x, &test_property_type },
+        { "y", &y, &test_property_type }
+    };
 
-    expected_calls[0].snprintf_call.override_result = true;
-    expected_calls[0].snprintf_call.call_result = -1;
+    setup_test_property_type(1);
 
     // act
-    int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, property_value_pair_count);
+    int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, MU_COUNT_ARRAY_ITEMS(property_value_pairs));
 
     // assert
-    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(test_to_string_call_count == 1);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_context_property_to_string shall fail and return a negative value. ]*/
-static void when_snprintf_fails_for_inner_context_open_brace_log_context_property_to_string_fails(void)
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_022: [ If to_string fails for any property, log_context_property_to_string shall fail and return a negative value. ]*/
+static void when_to_string_fails_for_property_in_outer_context_log_context_property_to_string_fails(void)
 {
     // arrange
     char buffer[LOG_MAX_MESSAGE_LENGTH];
 
-    LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
-    LOG_CONTEXT_LOCAL_DEFINE(context_2, &context_1, LOG_CONTEXT_PROPERTY(uint32_t, y, 1));
-    size_t property_value_pair_count = log_context_get_property_value_pair_count(&context_2);
-    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(&context_2);
-
-    setup_mocks();
-
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // context opening
+    uint8_t outer_field_count = 2;
+    uint8_t inner_field_count = 1;
+    int32_t x = 42;
+    int32_t y = 1;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR property_value_pairs[] =
+    {
+        { "", &outer_field_count, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct) },
+        { "", &inner_field_count, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct) },
+        { "x", &x, &test_property_type },
+        { "y", &y, &test_property_type }
+    };
 
-    expected_calls[1].snprintf_call.override_result = true;
-    expected_calls[1].snprintf_call.call_result = -1;
+    setup_test_property_type(2);
 
     // act
-    int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, property_value_pair_count);
+    int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, MU_COUNT_ARRAY_ITEMS(property_value_pairs));
 
     // assert
-    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(test_to_string_call_count == 2);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_context_property_to_string shall fail and return a negative value. ]*/
-static void when_snprintf_fails_for_property_in_inner_context_log_context_property_to_string_fails(void)
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_017: [ If the property type is struct (used as a container for context properties): ]*/
+  /* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_018: [ log_context_property_to_string shall obtain the number of fields in the struct. ]*/
+  /* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_019: [ log_context_property_to_string shall print the next n properties as being the fields that are part of the struct. ]*/
+  /* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_026: [ log_context_property_to_string shall print a closing brace as end of the struct. ]*/
+static void log_context_property_to_string_with_nested_and_empty_structs_between_fields_works(void)
 {
     // arrange
     char buffer[LOG_MAX_MESSAGE_LENGTH];
 
-    LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
-    LOG_CONTEXT_LOCAL_DEFINE(context_2, &context_1, LOG_CONTEXT_PROPERTY(uint32_t, y, 1));
-    size_t property_value_pair_count = log_context_get_property_value_pair_count(&context_2);
-    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(&context_2);
-
-    setup_mocks();
-
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // property
-
-    expected_calls[2].snprintf_call.override_result = true;
-    expected_calls[2].snprintf_call.call_result = -1;
+    uint8_t foo_field_count = 3;
+    uint8_t bar_field_count = 2;
+    uint8_t empty_field_count = 0;
+    int32_t a = 1;
+    int32_t b = 2;
+    int32_t c = 3;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR property_value_pairs[] =
+    {
+        { "foo", &foo_field_count, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct) },
+        { "bar", &bar_field_count, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct) },
+        { "a", &a, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t) },
+        { "", &empty_field_count, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct) },
+        { "b", &b, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t) },
+        { "c", &c, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t) },
+        { "empty", &empty_field_count, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct) }
+    };
 
     // act
-    int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, property_value_pair_count);
+    int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, MU_COUNT_ARRAY_ITEMS(property_value_pairs));
 
     // assert
-    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(actual_and_expected_match);
-    POOR_MANS_ASSERT(result < 0);
+    const char expected_string[] = " foo={ bar={ a=1 { } } b=2 c=3 } empty={ }";
+    validate_property_string(buffer, expected_string);
+    POOR_MANS_ASSERT(result == sizeof(expected_string) - 1);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_context_property_to_string shall fail and return a negative value. ]*/
-static void when_snprintf_fails_for_closing_of_inner_context_log_context_property_to_string_fails(void)
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_019: [ log_context_property_to_string shall print the next n properties as being the fields that are part of the struct. ]*/
+static void log_context_property_to_string_with_struct_claiming_more_fields_than_properties_closes_it(void)
 {
     // arrange
     char buffer[LOG_MAX_MESSAGE_LENGTH];
 
-    LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
-    LOG_CONTEXT_LOCAL_DEFINE(context_2, &context_1, LOG_CONTEXT_PROPERTY(uint32_t, y, 1));
-    size_t property_value_pair_count = log_context_get_property_value_pair_count(&context_2);
-    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(&context_2);
-
-    setup_mocks();
-
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // property
-    setup_snprintf_call(); // context closing
-
-    expected_calls[3].snprintf_call.override_result = true;
-    expected_calls[3].snprintf_call.call_result = -1;
+    uint8_t field_count = 5;
+    int32_t x = 42;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR property_value_pairs[] =
+    {
+        { "haga", &field_count, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct) },
+        { "x", &x, &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t) }
+    };
 
     // act
-    int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, property_value_pair_count);
+    int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, MU_COUNT_ARRAY_ITEMS(property_value_pairs));
 
     // assert
-    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(actual_and_expected_match);
-    POOR_MANS_ASSERT(result < 0);
+    const char expected_string[] = " haga={ x=42 }";
+    validate_property_string(buffer, expected_string);
+    POOR_MANS_ASSERT(result == sizeof(expected_string) - 1);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_context_property_to_string shall fail and return a negative value. ]*/
-static void when_snprintf_fails_for_property_in_outer_context_log_context_property_to_string_fails(void)
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_032: [ If structs are nested more than 256 levels deep, log_context_property_to_string shall fail and return a negative value. ]*/
+static void log_context_property_to_string_with_256_nested_structs_works(void)
 {
     // arrange
     char buffer[LOG_MAX_MESSAGE_LENGTH];
 
-    LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
-    LOG_CONTEXT_LOCAL_DEFINE(context_2, &context_1, LOG_CONTEXT_PROPERTY(uint32_t, y, 1));
-    size_t property_value_pair_count = log_context_get_property_value_pair_count(&context_2);
-    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(&context_2);
+    uint8_t field_count = 1;
+    int32_t x = 42;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR property_value_pairs[256 + 1];
+    for (uint32_t i = 0; i < 256; i++)
+    {
+        property_value_pairs[i].name = "";
+        property_value_pairs[i].value = &field_count;
+        property_value_pairs[i].type = &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct);
+    }
+    property_value_pairs[256].name = "x";
+    property_value_pairs[256].value = &x;
+    property_value_pairs[256].type = &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t);
 
-    setup_mocks();
+    // act
+    int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, MU_COUNT_ARRAY_ITEMS(property_value_pairs));
 
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // property
-    setup_snprintf_call(); // context closing
-    setup_snprintf_call(); // property
+    // assert
+    POOR_MANS_ASSERT(result == 256 * 4 + 5);
+    POOR_MANS_ASSERT(strncmp(buffer, " { { ", 5) == 0);
+    POOR_MANS_ASSERT(strncmp(buffer + 256 * 2, " x=42 }", 7) == 0);
+    POOR_MANS_ASSERT(strcmp(buffer + result - 4, " } }") == 0);
+}
 
-    expected_calls[4].snprintf_call.override_result = true;
-    expected_calls[4].snprintf_call.call_result = -1;
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_032: [ If structs are nested more than 256 levels deep, log_context_property_to_string shall fail and return a negative value. ]*/
+static void log_context_property_to_string_with_257_nested_structs_fails(void)
+{
+    // arrange
+    char buffer[LOG_MAX_MESSAGE_LENGTH];
+
+    uint8_t field_count = 1;
+    int32_t x = 42;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR property_value_pairs[257 + 1];
+    for (uint32_t i = 0; i < 257; i++)
+    {
+        property_value_pairs[i].name = "";
+        property_value_pairs[i].value = &field_count;
+        property_value_pairs[i].type = &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct);
+    }
+    property_value_pairs[257].name = "x";
+    property_value_pairs[257].value = &x;
+    property_value_pairs[257].type = &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t);
 
     // act
-    int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, property_value_pair_count);
+    int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, MU_COUNT_ARRAY_ITEMS(property_value_pairs));
 
     // assert
-    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(result < 0);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_context_property_to_string shall fail and return a negative value. ]*/
-static void when_snprintf_fails_for_closing_of_outer_context_log_context_property_to_string_fails(void)
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_033: [ log_context_property_to_string shall copy property names, spaces, equal signs and braces to buffer without calling printf class functions. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_021: [ log_context_property_to_string shall store at most buffer_size characters including the null terminator in buffer (the rest of the context shall be truncated). ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_031: [ log_context_property_to_string shall return the number of bytes written to the buffer. ]*/
+static void log_context_property_to_string_truncates_at_every_buffer_size(void)
 {
     // arrange
-    char buffer[LOG_MAX_MESSAGE_LENGTH];
-
-    LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
-    LOG_CONTEXT_LOCAL_DEFINE(context_2, &context_1, LOG_CONTEXT_PROPERTY(uint32_t, y, 1));
+    LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_NAME(haga), LOG_CONTEXT_PROPERTY(int32_t, x, 42), LOG_CONTEXT_PROPERTY(uint64_t, big, 1234567890123));
+    LOG_CONTEXT_LOCAL_DEFINE(context_2, &context_1, LOG_CONTEXT_NAME(uaga), LOG_CONTEXT_PROPERTY(uint32_t, y, 1));
     size_t property_value_pair_count = log_context_get_property_value_pair_count(&context_2);
     const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(&context_2);
 
-    setup_mocks();
+    const char full_string[] = " uaga={ haga={ x=42 big=1234567890123 } y=1 }";
 
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // property
-    setup_snprintf_call(); // context closing
-    setup_snprintf_call(); // property
-    setup_snprintf_call(); // context closing
+    for (size_t buffer_size = 1; buffer_size <= sizeof(full_string) + 1; buffer_size++)
+    {
+        char buffer[sizeof(full_string) + 2];
 
-    expected_calls[5].snprintf_call.override_result = true;
-    expected_calls[5].snprintf_call.call_result = -1;
+        // act
+        int result = log_context_property_to_string(buffer, buffer_size, property_value_pairs, property_value_pair_count);
+
+        // assert
+        if (buffer_size > sizeof(full_string) - 1)
+        {
+            validate_property_string(buffer, full_string);
+            POOR_MANS_ASSERT(result == sizeof(full_string) - 1);
+        }
+        else
+        {
+            // same as a single snprintf of the whole string: the first buffer_size - 1 characters and the whole buffer counted
+            POOR_MANS_ASSERT(strlen(buffer) == buffer_size - 1);
+            POOR_MANS_ASSERT(strncmp(buffer, full_string, buffer_size - 1) == 0);
+            POOR_MANS_ASSERT(result == (int)buffer_size);
+        }
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_034: [ Once buffer is full, log_context_property_to_string shall stop formatting the remaining properties. ]*/
+static void log_context_property_to_string_stops_formatting_when_buffer_is_full(void)
+{
+    // arrange
+    char buffer[8];
+
+    int32_t x = 42;
+    int32_t y = 1;
+    LOG_CONTEXT_PROPERTY_VALUE_PAIR property_value_pairs[] =
+    {
+        { "a_long_name", &x, &test_property_type },
+        { "y", &y, &test_property_type }
+    };
+
+    setup_test_property_type(0);
 
     // act
-    int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, property_value_pair_count);
+    int result = log_context_property_to_string(buffer, sizeof(buffer), property_value_pairs, MU_COUNT_ARRAY_ITEMS(property_value_pairs));
 
     // assert
-    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(actual_and_expected_match);
-    POOR_MANS_ASSERT(result < 0);
+    validate_property_string(buffer, " a_long");
+    POOR_MANS_ASSERT(result == sizeof(buffer));
+    POOR_MANS_ASSERT(test_to_string_call_count == 0);
 }
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_TO_STRING_42_021: [ log_context_property_to_string shall store at most buffer_size characters including the null terminator in buffer (the rest of the context shall be truncated). ]*/
@@ -656,18 +618,12 @@ static void when_printing_a_property_value_exceeds_log_line_size_it_is_truncated
     size_t property_value_pair_count = log_context_get_property_value_pair_count(context_1);
     const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs = log_context_get_property_value_pairs(context_1);
 
-    setup_mocks();
 
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // context opening
-    setup_snprintf_call(); // property
 
     // act
     int result = log_context_property_to_string(buffer, LOG_MAX_MESSAGE_LENGTH, property_value_pairs, property_value_pair_count);
 
     // assert
-    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(actual_and_expected_match);
 
     char expected_string[LOG_MAX_MESSAGE_LENGTH];
     (void)snprintf(expected_string, sizeof(expected_string), " { hagauaga=%s }", string_property_value_too_big);
@@ -699,12 +655,16 @@ int main(void)
 
     log_context_property_to_string_with_non_NULL_dynamically_allocated_context();
 
-    when_snprintf_fails_for_context_open_brace_log_context_property_to_string_fails();
-    when_snprintf_fails_for_inner_context_open_brace_log_context_property_to_string_fails();
-    when_snprintf_fails_for_property_in_inner_context_log_context_property_to_string_fails();
-    when_snprintf_fails_for_closing_of_inner_context_log_context_property_to_string_fails();
-    when_snprintf_fails_for_property_in_outer_context_log_context_property_to_string_fails();
-    when_snprintf_fails_for_closing_of_outer_context_log_context_property_to_string_fails();
+    when_to_string_fails_for_property_in_inner_context_log_context_property_to_string_fails();
+    when_to_string_fails_for_property_in_outer_context_log_context_property_to_string_fails();
+
+    log_context_property_to_string_with_nested_and_empty_structs_between_fields_works();
+    log_context_property_to_string_with_struct_claiming_more_fields_than_properties_closes_it();
+    log_context_property_to_string_with_256_nested_structs_works();
+    log_context_property_to_string_with_257_nested_structs_fails();
+
+    log_context_property_to_string_truncates_at_every_buffer_size();
+    log_context_property_to_string_stops_formatting_when_buffer_is_full();
 
     when_printing_a_property_value_exceeds_log_line_size_it_is_truncated();
 
@@ -0,0 +1,652 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <inttypes.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+
+#include "c_logging/log_context_property_type_array.h"
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+static const int32_t test_int32_values[] = { 1, -22, 333, INT32_MIN, 0 };
+#define TEST_INT32_VALUES_COUNT (sizeof(test_int32_values) / sizeof(test_int32_values[0]))
+#define TEST_INT32_VALUES_STRING "[1,-22,333,-2147483648,0]"
+
+/* to_string */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_003: [ The to_string function of each array type shall compute the length of the text form [v1,v2,...] of the values by adding the lengths of the decimal representations of all the values, before writing anything. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_005: [ If the text form fits in buffer, the to_string function of each array type shall write [, the values separated by , (each written with integer_to_string_write_int64 or integer_to_string_write_uint64, without any further bounds check), ] and a zero terminator. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_007: [ The to_string function of each array type shall return the length of the text form, excluding the zero terminator. ]*/
+static void int32_t_array_to_string_succeeds(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, test_int32_values, TEST_INT32_VALUES_COUNT) == 0);
+    char buffer[64];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).to_string(value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)strlen(TEST_INT32_VALUES_STRING));
+    POOR_MANS_ASSERT(strcmp(buffer, TEST_INT32_VALUES_STRING) == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_005: [ If the text form fits in buffer, the to_string function of each array type shall write [, the values separated by , (each written with integer_to_string_write_int64 or integer_to_string_write_uint64, without any further bounds check), ] and a zero terminator. ]*/
+static void to_string_of_each_array_type_succeeds(void)
+{
+    // arrange
+    static const int64_t int64_values[] = { INT64_MIN, INT64_MAX };
+    static const uint64_t uint64_values[] = { 0, UINT64_MAX };
+    static const uint32_t uint32_values[] = { UINT32_MAX };
+    static const int16_t int16_values[] = { INT16_MIN, -1, INT16_MAX };
+    static const uint16_t uint16_values[] = { 0, UINT16_MAX };
+    static const int8_t int8_values[] = { INT8_MIN, 0, INT8_MAX };
+    static const uint8_t uint8_values[] = { 0, 9, 10, 99, 100, UINT8_MAX };
+    uint8_t value[64];
+    char buffer[64];
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int64_t_array)(value, int64_values, 2) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t_array).to_string(value, buffer, sizeof(buffer)) == 42);
+    POOR_MANS_ASSERT(strcmp(buffer, "[-9223372036854775808,9223372036854775807]") == 0);
+
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(uint64_t_array)(value, uint64_values, 2) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t_array).to_string(value, buffer, sizeof(buffer)) == 24);
+    POOR_MANS_ASSERT(strcmp(buffer, "[0,18446744073709551615]") == 0);
+
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(uint32_t_array)(value, uint32_values, 1) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t_array).to_string(value, buffer, sizeof(buffer)) == 12);
+    POOR_MANS_ASSERT(strcmp(buffer, "[4294967295]") == 0);
+
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int16_t_array)(value, int16_values, 3) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t_array).to_string(value, buffer, sizeof(buffer)) == 17);
+    POOR_MANS_ASSERT(strcmp(buffer, "[-32768,-1,32767]") == 0);
+
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(uint16_t_array)(value, uint16_values, 2) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t_array).to_string(value, buffer, sizeof(buffer)) == 9);
+    POOR_MANS_ASSERT(strcmp(buffer, "[0,65535]") == 0);
+
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int8_t_array)(value, int8_values, 3) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t_array).to_string(value, buffer, sizeof(buffer)) == 12);
+    POOR_MANS_ASSERT(strcmp(buffer, "[-128,0,127]") == 0);
+
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(uint8_t_array)(value, uint8_values, 6) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t_array).to_string(value, buffer, sizeof(buffer)) == 19);
+    POOR_MANS_ASSERT(strcmp(buffer, "[0,9,10,99,100,255]") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_005: [ If the text form fits in buffer, the to_string function of each array type shall write [, the values separated by , (each written with integer_to_string_write_int64 or integer_to_string_write_uint64, without any further bounds check), ] and a zero terminator. ]*/
+static void to_string_with_0_values_produces_empty_brackets(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(uint64_t_array)(value, NULL, 0) == 0);
+    char buffer[8];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t_array).to_string(value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 2);
+    POOR_MANS_ASSERT(strcmp(buffer, "[]") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_006: [ Otherwise the to_string function of each array type shall write the first buffer_length - 1 characters of the text form in buffer, followed by a zero terminator. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_007: [ The to_string function of each array type shall return the length of the text form, excluding the zero terminator. ]*/
+static void to_string_truncates_like_snprintf_for_all_buffer_sizes(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, test_int32_values, TEST_INT32_VALUES_COUNT) == 0);
+
+    // act
+    // assert
+    for (size_t buffer_length = 1; buffer_length <= sizeof(TEST_INT32_VALUES_STRING); buffer_length++)
+    {
+        char expected[sizeof(TEST_INT32_VALUES_STRING)];
+        char actual[sizeof(TEST_INT32_VALUES_STRING) + 1];
+        (void)memset(actual, 'x', sizeof(actual));
+        (void)memcpy(expected, TEST_INT32_VALUES_STRING, buffer_length - 1);
+        expected[buffer_length - 1] = '\0';
+        POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).to_string(value, actual, buffer_length) == (int)strlen(TEST_INT32_VALUES_STRING));
+        POOR_MANS_ASSERT(strcmp(actual, expected) == 0);
+        POOR_MANS_ASSERT(actual[buffer_length] == 'x');
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_004: [ If buffer is NULL or buffer_length is 0, the to_string function of each array type shall only return the length of the text form. ]*/
+static void to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, test_int32_values, TEST_INT32_VALUES_COUNT) == 0);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).to_string(value, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)strlen(TEST_INT32_VALUES_STRING));
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_001: [ If property_value is NULL, the to_string function of each array type shall fail and return a negative value. ]*/
+static void to_string_with_NULL_property_value_fails(void)
+{
+    // arrange
+    char buffer[16];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t_array).to_string(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_002: [ If buffer is NULL and buffer_length is greater than 0, the to_string function of each array type shall fail and return a negative value. ]*/
+static void to_string_with_NULL_buffer_and_non_zero_buffer_length_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, test_int32_values, TEST_INT32_VALUES_COUNT) == 0);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).to_string(value, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* copy */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_010: [ The copy function of each array type shall copy the count and the values from src_value to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_011: [ The copy function of each array type shall succeed and return 0. ]*/
+static void copy_succeeds(void)
+{
+    // arrange
+    uint8_t src_value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    uint8_t dst_value[sizeof(uint16_t) + sizeof(test_int32_values) + 1];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(src_value, test_int32_values, TEST_INT32_VALUES_COUNT) == 0);
+    (void)memset(dst_value, 0xAA, sizeof(dst_value));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).copy(dst_value, src_value);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(memcmp(dst_value, src_value, sizeof(src_value)) == 0);
+    POOR_MANS_ASSERT(dst_value[sizeof(src_value)] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_008: [ If dst_value is NULL, the copy function of each array type shall fail and return a non-zero value. ]*/
+static void copy_with_NULL_dst_value_fails(void)
+{
+    // arrange
+    uint8_t src_value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(src_value, test_int32_values, TEST_INT32_VALUES_COUNT) == 0);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).copy(NULL, src_value);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_009: [ If src_value is NULL, the copy function of each array type shall fail and return a non-zero value. ]*/
+static void copy_with_NULL_src_value_fails(void)
+{
+    // arrange
+    uint8_t dst_value[sizeof(uint16_t) + sizeof(test_int32_values)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).copy(dst_value, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* free */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_012: [ The free function of each array type shall return. ]*/
+static void free_returns(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, test_int32_values, TEST_INT32_VALUES_COUNT) == 0);
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).free(value);
+
+    // assert
+    // no explicit assert
+}
+
+/* get_type and type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_013: [ The get_type function of each array type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_{element_type}_array. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_026: [ The type_tag of each array type shall be the property type LOG_CONTEXT_PROPERTY_TYPE_{element_type}_array. ]*/
+static void get_type_and_type_tag_return_the_array_type(void)
+{
+    // arrange
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t_array).get_type() == LOG_CONTEXT_PROPERTY_TYPE_int64_t_array);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t_array).get_type() == LOG_CONTEXT_PROPERTY_TYPE_uint64_t_array);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).get_type() == LOG_CONTEXT_PROPERTY_TYPE_int32_t_array);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint32_t_array).get_type() == LOG_CONTEXT_PROPERTY_TYPE_uint32_t_array);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int16_t_array).get_type() == LOG_CONTEXT_PROPERTY_TYPE_int16_t_array);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint16_t_array).get_type() == LOG_CONTEXT_PROPERTY_TYPE_uint16_t_array);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int8_t_array).get_type() == LOG_CONTEXT_PROPERTY_TYPE_int8_t_array);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t_array).get_type() == LOG_CONTEXT_PROPERTY_TYPE_uint8_t_array);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t_array).type_tag == LOG_CONTEXT_PROPERTY_TYPE_int64_t_array);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint8_t_array).type_tag == LOG_CONTEXT_PROPERTY_TYPE_uint8_t_array);
+}
+
+/* get_size */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_028: [ Otherwise the get_size function of each array type shall return sizeof(uint16_t) plus the count stored in property_value multiplied by sizeof(element_type). ]*/
+static void get_size_returns_the_size_of_the_count_and_the_values(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, test_int32_values, TEST_INT32_VALUES_COUNT) == 0);
+    uint8_t uint64_value[sizeof(uint16_t) + 2 * sizeof(uint64_t)];
+    uint64_t uint64_values[] = { 1, 2 };
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(uint64_t_array)(uint64_value, uint64_values, 2) == 0);
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).get_size(value) == (int)(sizeof(uint16_t) + sizeof(test_int32_values)));
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(uint64_t_array).get_size(uint64_value) == (int)sizeof(uint64_value));
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_027: [ If property_value is NULL, the get_size function of each array type shall fail and return a negative value. ]*/
+static void get_size_with_NULL_property_value_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).get_size(NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* serialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_031: [ If the count and the values fit in buffer_size, the serialize function of each array type shall copy the count and the values from property_value to buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_032: [ The serialize function of each array type shall succeed and return sizeof(uint16_t) plus the count multiplied by sizeof(element_type). ]*/
+static void serialize_copies_the_count_and_the_values(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, test_int32_values, TEST_INT32_VALUES_COUNT) == 0);
+    uint8_t buffer[sizeof(uint16_t) + sizeof(test_int32_values) + 1];
+    (void)memset(buffer, 0xAA, sizeof(buffer));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).serialize(value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(sizeof(uint16_t) + sizeof(test_int32_values)));
+    POOR_MANS_ASSERT(memcmp(buffer, value, sizeof(value)) == 0);
+    POOR_MANS_ASSERT(buffer[sizeof(value)] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_032: [ The serialize function of each array type shall succeed and return sizeof(uint16_t) plus the count multiplied by sizeof(element_type). ]*/
+static void serialize_with_a_buffer_too_small_only_returns_the_needed_size(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, test_int32_values, TEST_INT32_VALUES_COUNT) == 0);
+    uint8_t buffer[sizeof(uint16_t) + sizeof(test_int32_values) - 1];
+    (void)memset(buffer, 0xAA, sizeof(buffer));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).serialize(value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(sizeof(uint16_t) + sizeof(test_int32_values)));
+    POOR_MANS_ASSERT(buffer[0] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_029: [ If property_value is NULL, the serialize function of each array type shall fail and return a negative value. ]*/
+static void serialize_with_NULL_property_value_fails(void)
+{
+    // arrange
+    uint8_t buffer[sizeof(uint16_t) + sizeof(test_int32_values)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).serialize(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_030: [ If buffer is NULL and buffer_size is greater than 0, the serialize function of each array type shall fail and return a negative value. ]*/
+static void serialize_with_NULL_buffer_and_non_zero_buffer_size_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, test_int32_values, TEST_INT32_VALUES_COUNT) == 0);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).serialize(value, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* deserialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_036: [ If buffer_size bytes fit in dst_size, the deserialize function of each array type shall copy the count and the values from buffer to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_037: [ The deserialize function of each array type shall succeed and return buffer_size. ]*/
+static void deserialize_of_a_serialized_value_gives_back_the_value(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, test_int32_values, TEST_INT32_VALUES_COUNT) == 0);
+    uint8_t buffer[sizeof(uint16_t) + sizeof(test_int32_values)];
+    uint8_t dst_value[sizeof(uint16_t) + sizeof(test_int32_values) + 1];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).serialize(value, buffer, sizeof(buffer)) == (int)sizeof(buffer));
+    (void)memset(dst_value, 0xAA, sizeof(dst_value));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).deserialize(dst_value, sizeof(dst_value), buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(sizeof(uint16_t) + sizeof(test_int32_values)));
+    POOR_MANS_ASSERT(memcmp(dst_value, value, sizeof(value)) == 0);
+    POOR_MANS_ASSERT(dst_value[sizeof(value)] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_037: [ The deserialize function of each array type shall succeed and return buffer_size. ]*/
+static void deserialize_with_a_dst_size_too_small_only_returns_the_needed_size(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, test_int32_values, TEST_INT32_VALUES_COUNT) == 0);
+    uint8_t dst_value[sizeof(uint16_t) + sizeof(test_int32_values) - 1];
+    (void)memset(dst_value, 0xAA, sizeof(dst_value));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).deserialize(dst_value, sizeof(dst_value), value, sizeof(value));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(sizeof(uint16_t) + sizeof(test_int32_values)));
+    POOR_MANS_ASSERT(dst_value[0] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_033: [ If dst_value is NULL and dst_size is greater than 0, the deserialize function of each array type shall fail and return a negative value. ]*/
+static void deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, test_int32_values, TEST_INT32_VALUES_COUNT) == 0);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).deserialize(NULL, 1, value, sizeof(value));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_034: [ If buffer is NULL, the deserialize function of each array type shall fail and return a negative value. ]*/
+static void deserialize_with_NULL_buffer_fails(void)
+{
+    // arrange
+    uint8_t dst_value[sizeof(uint16_t) + sizeof(test_int32_values)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).deserialize(dst_value, sizeof(dst_value), NULL, sizeof(dst_value));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_035: [ If buffer_size is smaller than sizeof(uint16_t) or is not sizeof(uint16_t) plus the count stored at the beginning of buffer multiplied by sizeof(element_type), the deserialize function of each array type shall fail and return a negative value. ]*/
+static void deserialize_with_a_buffer_size_that_does_not_match_the_count_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, test_int32_values, TEST_INT32_VALUES_COUNT) == 0);
+    uint8_t dst_value[sizeof(uint16_t) + sizeof(test_int32_values)];
+
+    // act
+    int result_1 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).deserialize(dst_value, sizeof(dst_value), value, 1);
+    int result_2 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).deserialize(dst_value, sizeof(dst_value), value, sizeof(value) - 1);
+    int result_3 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t_array).deserialize(dst_value, sizeof(dst_value), value, sizeof(value) + 1);
+    // the same bytes do not make an int64_t array of the same count
+    int result_4 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int64_t_array).deserialize(dst_value, sizeof(dst_value), value, sizeof(value));
+
+    // assert
+    POOR_MANS_ASSERT(result_1 < 0);
+    POOR_MANS_ASSERT(result_2 < 0);
+    POOR_MANS_ASSERT(result_3 < 0);
+    POOR_MANS_ASSERT(result_4 < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_INIT */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_017: [ LOG_CONTEXT_PROPERTY_TYPE_INIT of each array type shall store in the memory at dst_value the count as a uint16_t followed by the count values. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_018: [ LOG_CONTEXT_PROPERTY_TYPE_INIT of each array type shall succeed and return 0. ]*/
+static void init_succeeds(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    uint16_t count;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, test_int32_values, TEST_INT32_VALUES_COUNT);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    (void)memcpy(&count, value, sizeof(uint16_t));
+    POOR_MANS_ASSERT(count == TEST_INT32_VALUES_COUNT);
+    POOR_MANS_ASSERT(memcmp(value + sizeof(uint16_t), test_int32_values, sizeof(test_int32_values)) == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_014: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT of each array type shall fail and return a non-zero value. ]*/
+static void init_with_NULL_dst_value_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(NULL, test_int32_values, TEST_INT32_VALUES_COUNT);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_015: [ If values is NULL and count is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_INIT of each array type shall fail and return a non-zero value. ]*/
+static void init_with_NULL_values_and_non_zero_count_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(int32_t)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_016: [ If count is greater than LOG_CONTEXT_ARRAY_MAX_COUNT, LOG_CONTEXT_PROPERTY_TYPE_INIT of each array type shall fail and return a non-zero value. ]*/
+static void init_with_count_too_big_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(int32_t_array)(value, test_int32_values, (size_t)LOG_CONTEXT_ARRAY_MAX_COUNT + 1);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_020: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE of each array type shall return sizeof(uint16_t) + count * sizeof(element_type). ]*/
+static void get_init_data_size_returns_the_size_of_the_count_and_the_values(void)
+{
+    // arrange
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(int64_t_array)(3) == (int)(sizeof(uint16_t) + 3 * sizeof(int64_t)));
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(uint32_t_array)(0) == (int)sizeof(uint16_t));
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(uint8_t_array)(LOG_CONTEXT_ARRAY_MAX_COUNT) == (int)(sizeof(uint16_t) + LOG_CONTEXT_ARRAY_MAX_COUNT));
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_019: [ If count is greater than LOG_CONTEXT_ARRAY_MAX_COUNT, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE of each array type shall return a negative value. ]*/
+static void get_init_data_size_with_count_too_big_returns_a_negative_value(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(uint16_t_array)((size_t)LOG_CONTEXT_ARRAY_MAX_COUNT + 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_FILL */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_024: [ If sizeof(uint16_t) + count * sizeof(element_type) bytes fit in dst_size, LOG_CONTEXT_PROPERTY_TYPE_FILL of each array type shall store in the memory at dst_value the count as a uint16_t followed by the count values. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_025: [ LOG_CONTEXT_PROPERTY_TYPE_FILL of each array type shall succeed and return sizeof(uint16_t) + count * sizeof(element_type). ]*/
+static void fill_succeeds(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    uint16_t count;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(int32_t_array)(value, sizeof(value), test_int32_values, TEST_INT32_VALUES_COUNT);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(value));
+    (void)memcpy(&count, value, sizeof(uint16_t));
+    POOR_MANS_ASSERT(count == TEST_INT32_VALUES_COUNT);
+    POOR_MANS_ASSERT(memcmp(value + sizeof(uint16_t), test_int32_values, sizeof(test_int32_values)) == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_025: [ LOG_CONTEXT_PROPERTY_TYPE_FILL of each array type shall succeed and return sizeof(uint16_t) + count * sizeof(element_type). ]*/
+static void fill_with_a_buffer_too_small_only_returns_the_needed_size(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+    (void)memset(value, 0xAA, sizeof(value));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(int32_t_array)(value, sizeof(value) - 1, test_int32_values, TEST_INT32_VALUES_COUNT);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(value));
+    POOR_MANS_ASSERT(value[0] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_025: [ LOG_CONTEXT_PROPERTY_TYPE_FILL of each array type shall succeed and return sizeof(uint16_t) + count * sizeof(element_type). ]*/
+static void fill_with_NULL_dst_value_and_0_dst_size_returns_the_needed_size(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(int32_t_array)(NULL, 0, test_int32_values, TEST_INT32_VALUES_COUNT);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(sizeof(uint16_t) + sizeof(test_int32_values)));
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_021: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_FILL of each array type shall fail and return a negative value. ]*/
+static void fill_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(int32_t_array)(NULL, 1, test_int32_values, TEST_INT32_VALUES_COUNT);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_022: [ If values is NULL and count is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_FILL of each array type shall fail and return a negative value. ]*/
+static void fill_with_NULL_values_and_non_zero_count_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(int32_t)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(int32_t_array)(value, sizeof(value), NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ARRAY_01_023: [ If count is greater than LOG_CONTEXT_ARRAY_MAX_COUNT, LOG_CONTEXT_PROPERTY_TYPE_FILL of each array type shall fail and return a negative value. ]*/
+static void fill_with_count_too_big_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_int32_values)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(int32_t_array)(value, sizeof(value), test_int32_values, (size_t)LOG_CONTEXT_ARRAY_MAX_COUNT + 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+int main(void)
+{
+    int32_t_array_to_string_succeeds();
+    to_string_of_each_array_type_succeeds();
+    to_string_with_0_values_produces_empty_brackets();
+    to_string_truncates_like_snprintf_for_all_buffer_sizes();
+    to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length();
+    to_string_with_NULL_property_value_fails();
+    to_string_with_NULL_buffer_and_non_zero_buffer_length_fails();
+    copy_succeeds();
+    copy_with_NULL_dst_value_fails();
+    copy_with_NULL_src_value_fails();
+    free_returns();
+    get_type_and_type_tag_return_the_array_type();
+    get_size_returns_the_size_of_the_count_and_the_values();
+    get_size_with_NULL_property_value_fails();
+    serialize_copies_the_count_and_the_values();
+    serialize_with_a_buffer_too_small_only_returns_the_needed_size();
+    serialize_with_NULL_property_value_fails();
+    serialize_with_NULL_buffer_and_non_zero_buffer_size_fails();
+    deserialize_of_a_serialized_value_gives_back_the_value();
+    deserialize_with_a_dst_size_too_small_only_returns_the_needed_size();
+    deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    deserialize_with_NULL_buffer_fails();
+    deserialize_with_a_buffer_size_that_does_not_match_the_count_fails();
+    init_succeeds();
+    init_with_NULL_dst_value_fails();
+    init_with_NULL_values_and_non_zero_count_fails();
+    init_with_count_too_big_fails();
+    get_init_data_size_returns_the_size_of_the_count_and_the_values();
+    get_init_data_size_with_count_too_big_returns_a_negative_value();
+    fill_succeeds();
+    fill_with_a_buffer_too_small_only_returns_the_needed_size();
+    fill_with_NULL_dst_value_and_0_dst_size_returns_the_needed_size();
+    fill_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    fill_with_NULL_values_and_non_zero_count_fails();
+    fill_with_count_too_big_fails();
+
+    return 0;
+}
@@ -391,6 +391,273 @@ static void ascii_char_ptr_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_ascii_char
     POOR_MANS_ASSERT(actual_call_count == expected_call_count);
 }
 
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).get_size */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_026: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).get_size shall fail and return a negative value. ]*/
+static void ascii_char_ptr_get_size_with_NULL_property_value_fails(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).get_size(NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_027: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).get_size shall return the length of the string pointed to by property_value plus 1 (for the null terminator). ]*/
+static void ascii_char_ptr_get_size_returns_the_string_length_plus_1(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).get_size("cucu");
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_027: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).get_size shall return the length of the string pointed to by property_value plus 1 (for the null terminator). ]*/
+static void ascii_char_ptr_get_size_with_empty_string_returns_1(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).get_size("");
+
+    // assert
+    POOR_MANS_ASSERT(result == 1);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_028: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize shall fail and return a negative value. ]*/
+static void ascii_char_ptr_serialize_with_NULL_property_value_fails(void)
+{
+    // arrange
+    char buffer[16];
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_029: [ If buffer is NULL and buffer_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize shall fail and return a negative value. ]*/
+static void ascii_char_ptr_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize("cucu", NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_031: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize shall succeed and return the length of the string plus 1. ]*/
+static void ascii_char_ptr_serialize_with_NULL_buffer_and_zero_buffer_size_returns_the_needed_size(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize("cucu", NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_030: [ If the string and its null terminator fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize shall copy the string (including the null terminator) from property_value to buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_031: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize shall succeed and return the length of the string plus 1. ]*/
+static void ascii_char_ptr_serialize_copies_the_string_and_the_null_terminator(void)
+{
+    // arrange
+    char buffer[16];
+    (void)memset(buffer, 'x', sizeof(buffer));
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize("cucu", buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(memcmp(buffer, "cucu\0", 5) == 0);
+    POOR_MANS_ASSERT(buffer[5] == 'x');
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_031: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize shall succeed and return the length of the string plus 1. ]*/
+static void ascii_char_ptr_serialize_with_a_too_small_buffer_does_not_write_and_returns_the_needed_size(void)
+{
+    // arrange
+    char buffer[4];
+    (void)memset(buffer, 'x', sizeof(buffer));
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize("cucu", buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(memcmp(buffer, "xxxx", 4) == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_032: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize shall fail and return a negative value. ]*/
+static void ascii_char_ptr_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize(NULL, 1, "cucu", 5);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_033: [ If buffer is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize shall fail and return a negative value. ]*/
+static void ascii_char_ptr_deserialize_with_NULL_buffer_fails(void)
+{
+    // arrange
+    char destination[16];
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize(destination, sizeof(destination), NULL, 5);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_034: [ If the first null terminator in buffer is not the byte at buffer_size - 1, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize shall fail and return a negative value. ]*/
+static void ascii_char_ptr_deserialize_with_zero_buffer_size_fails(void)
+{
+    // arrange
+    char destination[16];
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize(destination, sizeof(destination), "cucu", 0);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_034: [ If the first null terminator in buffer is not the byte at buffer_size - 1, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize shall fail and return a negative value. ]*/
+static void ascii_char_ptr_deserialize_without_null_terminator_at_the_end_fails(void)
+{
+    // arrange
+    char destination[16];
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize(destination, sizeof(destination), "cucu", 4);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_034: [ If the first null terminator in buffer is not the byte at buffer_size - 1, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize shall fail and return a negative value. ]*/
+static void ascii_char_ptr_deserialize_with_a_null_terminator_before_the_end_fails(void)
+{
+    // arrange
+    char destination[16];
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize(destination, sizeof(destination), "cu\0cu", 6);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_035: [ If buffer_size bytes fit in dst_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize shall copy the string (including the null terminator) from buffer to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_036: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize shall succeed and return buffer_size. ]*/
+static void ascii_char_ptr_deserialize_of_a_serialized_value_gives_back_the_string(void)
+{
+    // arrange
+    char buffer[16];
+    char destination[16];
+    setup_mocks();
+    int size = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).serialize("cucu", buffer, sizeof(buffer));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize(destination, sizeof(destination), buffer, (size_t)size);
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(strcmp(destination, "cucu") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_036: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize shall succeed and return buffer_size. ]*/
+static void ascii_char_ptr_deserialize_with_NULL_dst_value_and_zero_dst_size_returns_the_needed_size(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize(NULL, 0, "cucu", 5);
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_036: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize shall succeed and return buffer_size. ]*/
+static void ascii_char_ptr_deserialize_with_a_too_small_dst_size_does_not_write_and_returns_the_needed_size(void)
+{
+    // arrange
+    char destination[4];
+    (void)memset(destination, 'x', sizeof(destination));
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).deserialize(destination, sizeof(destination), "cucu", 5);
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(memcmp(destination, "xxxx", 4) == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_025: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_ascii_char_ptr. ]*/
+static void ascii_char_ptr_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_ascii_char_ptr(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr).type_tag;
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_ascii_char_ptr);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
 /* LOG_CONTEXT_PROPERTY_TYPE_INIT(ascii_char_ptr) */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_011: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(ascii_char_ptr) shall fail and return a non-zero value. ]*/
@@ -533,6 +800,131 @@ static void ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_with_mul
     POOR_MANS_ASSERT(actual_call_count == expected_call_count);
 }
 
+/* LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr)*/
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_020: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr) shall fail and return a negative value. ]*/
+static void ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr)(NULL, 1, "cucu");
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_021: [ If format is NULL, LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr) shall fail and return a negative value. ]*/
+static void ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_NULL_format_fails(void)
+{
+    // arrange
+    char buffer[10];
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr)(buffer, sizeof(buffer), NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr) shall format in the memory at dst_value by calling vsnprintf with dst_value, dst_size, format and the arguments in .... ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_024: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr) shall succeed and return the amount of memory needed to store the formatted string, including the null terminator. ]*/
+static void ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_succeeds(void)
+{
+    // arrange
+    char buffer[10];
+    setup_mocks();
+    setup_expected_vsnprintf_call();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr)(buffer, sizeof(buffer), "cucu");
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(strcmp(buffer, "cucu") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr) shall format in the memory at dst_value by calling vsnprintf with dst_value, dst_size, format and the arguments in .... ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_024: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr) shall succeed and return the amount of memory needed to store the formatted string, including the null terminator. ]*/
+static void ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_multiple_args_succeeds(void)
+{
+    // arrange
+    char buffer[64];
+    setup_mocks();
+    setup_expected_vsnprintf_call();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr)(buffer, sizeof(buffer), "The answer is %d and let's say hello %s", 42, "world");
+
+    // assert
+    POOR_MANS_ASSERT(result == 43);
+    POOR_MANS_ASSERT(strcmp(buffer, "The answer is 42 and let's say hello world") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_024: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr) shall succeed and return the amount of memory needed to store the formatted string, including the null terminator. ]*/
+static void ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_a_too_small_buffer_truncates_and_returns_the_needed_size(void)
+{
+    // arrange
+    char buffer[4];
+    setup_mocks();
+    setup_expected_vsnprintf_call();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr)(buffer, sizeof(buffer), "cucu");
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(strcmp(buffer, "cuc") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_024: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr) shall succeed and return the amount of memory needed to store the formatted string, including the null terminator. ]*/
+static void ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_NULL_dst_value_and_zero_dst_size_returns_the_needed_size(void)
+{
+    // arrange
+    setup_mocks();
+    setup_expected_vsnprintf_call();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr)(NULL, 0, "cucu");
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ASCII_CHAR_PTR_01_023: [ If vsnprintf fails, LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr) shall fail and return a negative value. ]*/
+static void when_underlying_call_fails_ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_also_fails(void)
+{
+    // arrange
+    char buffer[10];
+    setup_mocks();
+    expected_calls[0].mock_call_type = MOCK_CALL_TYPE_vsnprintf;
+    expected_calls[0].vsnprintf_call.override_result = true;
+    expected_calls[0].vsnprintf_call.call_result = -1;
+    expected_call_count = 1;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr)(buffer, sizeof(buffer), "cucu");
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
 /* very "poor man's" way of testing, as no test harness and mocking framework are available */
 int main(void)
 {
@@ -551,6 +943,25 @@ int main(void)
 
     ascii_char_ptr_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_ascii_char_ptr();
 
+    ascii_char_ptr_get_size_with_NULL_property_value_fails();
+    ascii_char_ptr_get_size_returns_the_string_length_plus_1();
+    ascii_char_ptr_get_size_with_empty_string_returns_1();
+    ascii_char_ptr_serialize_with_NULL_property_value_fails();
+    ascii_char_ptr_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails();
+    ascii_char_ptr_serialize_with_NULL_buffer_and_zero_buffer_size_returns_the_needed_size();
+    ascii_char_ptr_serialize_copies_the_string_and_the_null_terminator();
+    ascii_char_ptr_serialize_with_a_too_small_buffer_does_not_write_and_returns_the_needed_size();
+    ascii_char_ptr_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    ascii_char_ptr_deserialize_with_NULL_buffer_fails();
+    ascii_char_ptr_deserialize_with_zero_buffer_size_fails();
+    ascii_char_ptr_deserialize_without_null_terminator_at_the_end_fails();
+    ascii_char_ptr_deserialize_with_a_null_terminator_before_the_end_fails();
+    ascii_char_ptr_deserialize_of_a_serialized_value_gives_back_the_string();
+    ascii_char_ptr_deserialize_with_NULL_dst_value_and_zero_dst_size_returns_the_needed_size();
+    ascii_char_ptr_deserialize_with_a_too_small_dst_size_does_not_write_and_returns_the_needed_size();
+
+    ascii_char_ptr_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_ascii_char_ptr();
+
     ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_INIT_with_NULL_dst_value_fails();
     ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_INIT_with_NULL_format_fails();
     ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_INIT_succeeds();
@@ -561,5 +972,13 @@ int main(void)
     ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_succeeds();
     ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_with_multiple_args_succeeds();
 
+    ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_NULL_format_fails();
+    ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_succeeds();
+    ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_multiple_args_succeeds();
+    ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_a_too_small_buffer_truncates_and_returns_the_needed_size();
+    ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_NULL_dst_value_and_zero_dst_size_returns_the_needed_size();
+    when_underlying_call_fails_ascii_char_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_also_fails();
+
     return 0;
 }
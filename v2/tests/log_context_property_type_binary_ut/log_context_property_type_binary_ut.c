@@ -0,0 +1,1005 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+
+#include "c_logging/log_context_property_type_binary.h"
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+static const uint8_t test_bytes[] = { 0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x42 };
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_003: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string shall produce the hex representation of the bytes that follow the length in property_value by calling binary_to_hex_string with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_004: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string shall return the result of binary_to_hex_string. ]*/
+static void binary_to_string_succeeds(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+    char buffer[32];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string(value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 12);
+    POOR_MANS_ASSERT(strcmp(buffer, "deadbeef0042") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_003: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string shall produce the hex representation of the bytes that follow the length in property_value by calling binary_to_hex_string with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_004: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string shall return the result of binary_to_hex_string. ]*/
+static void binary_to_string_truncates_to_whole_bytes(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+    char buffer[6];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string(value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 12);
+    POOR_MANS_ASSERT(strcmp(buffer, "dead") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_003: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string shall produce the hex representation of the bytes that follow the length in property_value by calling binary_to_hex_string with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_004: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string shall return the result of binary_to_hex_string. ]*/
+static void binary_to_string_with_0_bytes_produces_an_empty_string(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, NULL, 0) == 0);
+    char buffer[4] = "xxx";
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string(value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(buffer[0] == '\0');
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_004: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string shall return the result of binary_to_hex_string. ]*/
+static void binary_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string(value, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == 12);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_001: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string shall fail and return a negative value. ]*/
+static void binary_to_string_with_NULL_property_value_fails(void)
+{
+    // arrange
+    char buffer[16];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_002: [ If buffer is NULL and buffer_length is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string shall fail and return a negative value. ]*/
+static void binary_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).to_string(value, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).copy */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_007: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).copy shall copy the length and the bytes from src_value to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_008: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).copy shall succeed and return 0. ]*/
+static void binary_copy_succeeds(void)
+{
+    // arrange
+    uint8_t source[sizeof(uint16_t) + sizeof(test_bytes)];
+    uint8_t destination[sizeof(uint16_t) + sizeof(test_bytes) + 1];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(source, test_bytes, sizeof(test_bytes)) == 0);
+    (void)memset(destination, 0xAA, sizeof(destination));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).copy(destination, source);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(memcmp(destination, source, sizeof(source)) == 0);
+    POOR_MANS_ASSERT(destination[sizeof(source)] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_005: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).copy shall fail and return a non-zero value. ]*/
+static void binary_copy_with_NULL_dst_value_fails(void)
+{
+    // arrange
+    uint8_t source[sizeof(uint16_t) + sizeof(test_bytes)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(source, test_bytes, sizeof(test_bytes)) == 0);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).copy(NULL, source);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_006: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).copy shall fail and return a non-zero value. ]*/
+static void binary_copy_with_NULL_src_value_fails(void)
+{
+    // arrange
+    uint8_t destination[sizeof(uint16_t) + sizeof(test_bytes)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).copy(destination, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).free */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_009: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).free shall return. ]*/
+static void binary_free_returns(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).free(value);
+
+    // assert
+    // no explicit assert
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).get_type */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_010: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).get_type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_binary. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_binary. ]*/
+static void binary_get_type_returns_binary(void)
+{
+    // arrange
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).get_type();
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_binary);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).type_tag == LOG_CONTEXT_PROPERTY_TYPE_binary);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).get_size */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_042: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).get_size shall return sizeof(uint16_t) plus the length stored in property_value. ]*/
+static void binary_get_size_returns_the_size_of_the_length_and_the_bytes(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).get_size(value);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(sizeof(uint16_t) + sizeof(test_bytes)));
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_041: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).get_size shall fail and return a negative value. ]*/
+static void binary_get_size_with_NULL_property_value_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).get_size(NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).serialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_045: [ If the length and the bytes fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).serialize shall copy the length and the bytes from property_value to buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_046: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).serialize shall succeed and return sizeof(uint16_t) plus the length. ]*/
+static void binary_serialize_copies_the_length_and_the_bytes(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+    uint8_t buffer[sizeof(uint16_t) + sizeof(test_bytes) + 1];
+    (void)memset(buffer, 0xAA, sizeof(buffer));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).serialize(value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(sizeof(uint16_t) + sizeof(test_bytes)));
+    POOR_MANS_ASSERT(memcmp(buffer, value, sizeof(value)) == 0);
+    POOR_MANS_ASSERT(buffer[sizeof(value)] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_046: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).serialize shall succeed and return sizeof(uint16_t) plus the length. ]*/
+static void binary_serialize_with_a_buffer_too_small_only_returns_the_needed_size(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+    uint8_t buffer[sizeof(uint16_t) + sizeof(test_bytes) - 1];
+    (void)memset(buffer, 0xAA, sizeof(buffer));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).serialize(value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(sizeof(uint16_t) + sizeof(test_bytes)));
+    POOR_MANS_ASSERT(buffer[0] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_043: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).serialize shall fail and return a negative value. ]*/
+static void binary_serialize_with_NULL_property_value_fails(void)
+{
+    // arrange
+    uint8_t buffer[sizeof(uint16_t) + sizeof(test_bytes)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).serialize(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_044: [ If buffer is NULL and buffer_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).serialize shall fail and return a negative value. ]*/
+static void binary_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).serialize(value, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_050: [ If buffer_size bytes fit in dst_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize shall copy the length and the bytes from buffer to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_051: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize shall succeed and return buffer_size. ]*/
+static void binary_deserialize_of_a_serialized_value_gives_back_the_value(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+    uint8_t buffer[sizeof(uint16_t) + sizeof(test_bytes)];
+    uint8_t destination[sizeof(uint16_t) + sizeof(test_bytes) + 1];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).serialize(value, buffer, sizeof(buffer)) == (int)sizeof(buffer));
+    (void)memset(destination, 0xAA, sizeof(destination));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize(destination, sizeof(destination), buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(sizeof(uint16_t) + sizeof(test_bytes)));
+    POOR_MANS_ASSERT(memcmp(destination, value, sizeof(value)) == 0);
+    POOR_MANS_ASSERT(destination[sizeof(value)] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_051: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize shall succeed and return buffer_size. ]*/
+static void binary_deserialize_with_a_dst_size_too_small_only_returns_the_needed_size(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+    uint8_t destination[sizeof(uint16_t) + sizeof(test_bytes) - 1];
+    (void)memset(destination, 0xAA, sizeof(destination));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize(destination, sizeof(destination), value, sizeof(value));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(sizeof(uint16_t) + sizeof(test_bytes)));
+    POOR_MANS_ASSERT(destination[0] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_047: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize shall fail and return a negative value. ]*/
+static void binary_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize(NULL, 1, value, sizeof(value));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_048: [ If buffer is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize shall fail and return a negative value. ]*/
+static void binary_deserialize_with_NULL_buffer_fails(void)
+{
+    // arrange
+    uint8_t destination[sizeof(uint16_t) + sizeof(test_bytes)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize(destination, sizeof(destination), NULL, sizeof(destination));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_049: [ If buffer_size is smaller than sizeof(uint16_t) or is not sizeof(uint16_t) plus the length stored at the beginning of buffer, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize shall fail and return a negative value. ]*/
+static void binary_deserialize_with_a_buffer_size_smaller_than_the_length_fails(void)
+{
+    // arrange
+    uint8_t destination[sizeof(uint16_t) + sizeof(test_bytes)];
+    uint8_t buffer[1] = { 0 };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize(destination, sizeof(destination), buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_049: [ If buffer_size is smaller than sizeof(uint16_t) or is not sizeof(uint16_t) plus the length stored at the beginning of buffer, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize shall fail and return a negative value. ]*/
+static void binary_deserialize_with_a_buffer_size_that_does_not_match_the_length_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+    uint8_t destination[sizeof(uint16_t) + sizeof(test_bytes)];
+
+    // act
+    int result_1 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize(destination, sizeof(destination), value, sizeof(value) - 1);
+    int result_2 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary).deserialize(destination, sizeof(destination), value, sizeof(value) + 1);
+
+    // assert
+    POOR_MANS_ASSERT(result_1 < 0);
+    POOR_MANS_ASSERT(result_2 < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_INIT(binary) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_014: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(binary) shall store in the memory at dst_value the length as a uint16_t followed by the length bytes at data. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_015: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(binary) shall succeed and return 0. ]*/
+static void binary_init_succeeds(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    uint16_t length;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes));
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    (void)memcpy(&length, value, sizeof(uint16_t));
+    POOR_MANS_ASSERT(length == sizeof(test_bytes));
+    POOR_MANS_ASSERT(memcmp(value + sizeof(uint16_t), test_bytes, sizeof(test_bytes)) == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_011: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(binary) shall fail and return a non-zero value. ]*/
+static void binary_init_with_NULL_dst_value_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(NULL, test_bytes, sizeof(test_bytes));
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_012: [ If data is NULL and length is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_INIT(binary) shall fail and return a non-zero value. ]*/
+static void binary_init_with_NULL_data_and_non_zero_length_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_013: [ If length is greater than LOG_CONTEXT_BINARY_MAX_LENGTH, LOG_CONTEXT_PROPERTY_TYPE_INIT(binary) shall fail and return a non-zero value. ]*/
+static void binary_init_with_length_too_big_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, (size_t)LOG_CONTEXT_BINARY_MAX_LENGTH + 1);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(binary) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_017: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(binary) shall return sizeof(uint16_t) + length. ]*/
+static void binary_get_init_data_size_returns_the_size_of_the_length_and_the_bytes(void)
+{
+    // arrange
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(binary)(0) == (int)sizeof(uint16_t));
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(binary)(sizeof(test_bytes)) == (int)(sizeof(uint16_t) + sizeof(test_bytes)));
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(binary)(LOG_CONTEXT_BINARY_MAX_LENGTH) == (int)(sizeof(uint16_t) + LOG_CONTEXT_BINARY_MAX_LENGTH));
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_016: [ If length is greater than LOG_CONTEXT_BINARY_MAX_LENGTH, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(binary) shall return a negative value. ]*/
+static void binary_get_init_data_size_with_length_too_big_returns_a_negative_value(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(binary)((size_t)LOG_CONTEXT_BINARY_MAX_LENGTH + 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_FILL(binary) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_021: [ If sizeof(uint16_t) + length bytes fit in dst_size, LOG_CONTEXT_PROPERTY_TYPE_FILL(binary) shall store in the memory at dst_value the length as a uint16_t followed by the length bytes at data. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_FILL(binary) shall succeed and return sizeof(uint16_t) + length. ]*/
+static void binary_fill_succeeds(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    uint16_t length;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(binary)(value, sizeof(value), test_bytes, sizeof(test_bytes));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(value));
+    (void)memcpy(&length, value, sizeof(uint16_t));
+    POOR_MANS_ASSERT(length == sizeof(test_bytes));
+    POOR_MANS_ASSERT(memcmp(value + sizeof(uint16_t), test_bytes, sizeof(test_bytes)) == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_FILL(binary) shall succeed and return sizeof(uint16_t) + length. ]*/
+static void binary_fill_with_a_buffer_too_small_only_returns_the_needed_size(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    (void)memset(value, 0xAA, sizeof(value));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(binary)(value, sizeof(value) - 1, test_bytes, sizeof(test_bytes));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(value));
+    POOR_MANS_ASSERT(value[0] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_FILL(binary) shall succeed and return sizeof(uint16_t) + length. ]*/
+static void binary_fill_with_NULL_dst_value_and_0_dst_size_returns_the_needed_size(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(binary)(NULL, 0, test_bytes, sizeof(test_bytes));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(sizeof(uint16_t) + sizeof(test_bytes)));
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_018: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_FILL(binary) shall fail and return a negative value. ]*/
+static void binary_fill_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(binary)(NULL, 1, test_bytes, sizeof(test_bytes));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_019: [ If data is NULL and length is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_FILL(binary) shall fail and return a negative value. ]*/
+static void binary_fill_with_NULL_data_and_non_zero_length_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(binary)(value, sizeof(value), NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_020: [ If length is greater than LOG_CONTEXT_BINARY_MAX_LENGTH, LOG_CONTEXT_PROPERTY_TYPE_FILL(binary) shall fail and return a negative value. ]*/
+static void binary_fill_with_length_too_big_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(binary)(value, sizeof(value), test_bytes, (size_t)LOG_CONTEXT_BINARY_MAX_LENGTH + 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).to_string */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_026: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).to_string shall produce the hex representation of the borrowed bytes by calling binary_to_hex_string with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_027: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).to_string shall return the result of binary_to_hex_string. ]*/
+static void borrowed_binary_to_string_succeeds(void)
+{
+    // arrange
+    BORROWED_BINARY borrowed = { test_bytes, sizeof(test_bytes) };
+    char buffer[32];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).to_string(&borrowed, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 12);
+    POOR_MANS_ASSERT(strcmp(buffer, "deadbeef0042") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_026: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).to_string shall produce the hex representation of the borrowed bytes by calling binary_to_hex_string with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_027: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).to_string shall return the result of binary_to_hex_string. ]*/
+static void borrowed_binary_to_string_truncates_to_whole_bytes(void)
+{
+    // arrange
+    BORROWED_BINARY borrowed = { test_bytes, sizeof(test_bytes) };
+    char buffer[8];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).to_string(&borrowed, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 12);
+    POOR_MANS_ASSERT(strcmp(buffer, "deadbe") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_024: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).to_string shall fail and return a negative value. ]*/
+static void borrowed_binary_to_string_with_NULL_property_value_fails(void)
+{
+    // arrange
+    char buffer[16];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).to_string(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_025: [ If buffer is NULL and buffer_length is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).to_string shall fail and return a negative value. ]*/
+static void borrowed_binary_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails(void)
+{
+    // arrange
+    BORROWED_BINARY borrowed = { test_bytes, sizeof(test_bytes) };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).to_string(&borrowed, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).copy */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_030: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).copy shall copy the pointer and the length from src_value to dst_value (the bytes stay borrowed). ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_031: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).copy shall succeed and return 0. ]*/
+static void borrowed_binary_copy_keeps_borrowing_the_bytes(void)
+{
+    // arrange
+    BORROWED_BINARY source = { test_bytes, sizeof(test_bytes) };
+    BORROWED_BINARY destination = { NULL, 0 };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).copy(&destination, &source);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(destination.data == test_bytes);
+    POOR_MANS_ASSERT(destination.length == sizeof(test_bytes));
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_028: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).copy shall fail and return a non-zero value. ]*/
+static void borrowed_binary_copy_with_NULL_dst_value_fails(void)
+{
+    // arrange
+    BORROWED_BINARY source = { test_bytes, sizeof(test_bytes) };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).copy(NULL, &source);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_029: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).copy shall fail and return a non-zero value. ]*/
+static void borrowed_binary_copy_with_NULL_src_value_fails(void)
+{
+    // arrange
+    BORROWED_BINARY destination;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).copy(&destination, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).free */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_032: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).free shall return. ]*/
+static void borrowed_binary_free_returns(void)
+{
+    // arrange
+    BORROWED_BINARY borrowed = { test_bytes, sizeof(test_bytes) };
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).free(&borrowed);
+
+    // assert
+    POOR_MANS_ASSERT(borrowed.data == test_bytes);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).get_type */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_033: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).get_type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_040: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary. ]*/
+static void borrowed_binary_get_type_returns_borrowed_binary(void)
+{
+    // arrange
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).get_type();
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).type_tag == LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).get_size */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_053: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).get_size shall return sizeof(BORROWED_BINARY). ]*/
+static void borrowed_binary_get_size_returns_the_size_of_BORROWED_BINARY(void)
+{
+    // arrange
+    BORROWED_BINARY borrowed = { test_bytes, sizeof(test_bytes) };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).get_size(&borrowed);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(BORROWED_BINARY));
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_052: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).get_size shall fail and return a negative value. ]*/
+static void borrowed_binary_get_size_with_NULL_property_value_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).get_size(NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).serialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_056: [ If the length and the borrowed bytes fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).serialize shall write to buffer the length as a uint16_t followed by the borrowed bytes. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_057: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).serialize shall succeed and return sizeof(uint16_t) plus the length. ]*/
+static void borrowed_binary_serialize_inlines_the_borrowed_bytes(void)
+{
+    // arrange
+    BORROWED_BINARY borrowed = { test_bytes, sizeof(test_bytes) };
+    uint8_t expected[sizeof(uint16_t) + sizeof(test_bytes)];
+    uint8_t buffer[sizeof(uint16_t) + sizeof(test_bytes) + 1];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(expected, test_bytes, sizeof(test_bytes)) == 0);
+    (void)memset(buffer, 0xAA, sizeof(buffer));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).serialize(&borrowed, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(sizeof(uint16_t) + sizeof(test_bytes)));
+    POOR_MANS_ASSERT(memcmp(buffer, expected, sizeof(expected)) == 0);
+    POOR_MANS_ASSERT(buffer[sizeof(expected)] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_057: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).serialize shall succeed and return sizeof(uint16_t) plus the length. ]*/
+static void borrowed_binary_serialize_with_a_buffer_too_small_only_returns_the_needed_size(void)
+{
+    // arrange
+    BORROWED_BINARY borrowed = { test_bytes, sizeof(test_bytes) };
+    uint8_t buffer[sizeof(uint16_t) + sizeof(test_bytes) - 1];
+    (void)memset(buffer, 0xAA, sizeof(buffer));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).serialize(&borrowed, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(sizeof(uint16_t) + sizeof(test_bytes)));
+    POOR_MANS_ASSERT(buffer[0] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_054: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).serialize shall fail and return a negative value. ]*/
+static void borrowed_binary_serialize_with_NULL_property_value_fails(void)
+{
+    // arrange
+    uint8_t buffer[sizeof(uint16_t) + sizeof(test_bytes)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).serialize(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_055: [ If buffer is NULL and buffer_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).serialize shall fail and return a negative value. ]*/
+static void borrowed_binary_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails(void)
+{
+    // arrange
+    BORROWED_BINARY borrowed = { test_bytes, sizeof(test_bytes) };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).serialize(&borrowed, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_061: [ If sizeof(BORROWED_BINARY) fits in dst_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize shall store in dst_value a BORROWED_BINARY that borrows the bytes that follow the length in buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize shall succeed and return sizeof(BORROWED_BINARY). ]*/
+static void borrowed_binary_deserialize_borrows_the_bytes_from_the_buffer(void)
+{
+    // arrange
+    BORROWED_BINARY borrowed = { test_bytes, sizeof(test_bytes) };
+    uint8_t buffer[sizeof(uint16_t) + sizeof(test_bytes)];
+    BORROWED_BINARY destination = { NULL, 0 };
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).serialize(&borrowed, buffer, sizeof(buffer)) == (int)sizeof(buffer));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize(&destination, sizeof(destination), buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(BORROWED_BINARY));
+    POOR_MANS_ASSERT(destination.data == buffer + sizeof(uint16_t));
+    POOR_MANS_ASSERT(destination.length == sizeof(test_bytes));
+    POOR_MANS_ASSERT(memcmp(destination.data, test_bytes, sizeof(test_bytes)) == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_062: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize shall succeed and return sizeof(BORROWED_BINARY). ]*/
+static void borrowed_binary_deserialize_with_a_dst_size_too_small_only_returns_the_needed_size(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    BORROWED_BINARY destination = { NULL, 0 };
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize(&destination, sizeof(destination) - 1, value, sizeof(value));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(BORROWED_BINARY));
+    POOR_MANS_ASSERT(destination.data == NULL);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_058: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize shall fail and return a negative value. ]*/
+static void borrowed_binary_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize(NULL, 1, value, sizeof(value));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_059: [ If buffer is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize shall fail and return a negative value. ]*/
+static void borrowed_binary_deserialize_with_NULL_buffer_fails(void)
+{
+    // arrange
+    BORROWED_BINARY destination;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize(&destination, sizeof(destination), NULL, sizeof(uint16_t) + sizeof(test_bytes));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_060: [ If buffer_size is smaller than sizeof(uint16_t) or is not sizeof(uint16_t) plus the length stored at the beginning of buffer, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize shall fail and return a negative value. ]*/
+static void borrowed_binary_deserialize_with_a_buffer_size_that_does_not_match_the_length_fails(void)
+{
+    // arrange
+    uint8_t value[sizeof(uint16_t) + sizeof(test_bytes)];
+    BORROWED_BINARY destination;
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(binary)(value, test_bytes, sizeof(test_bytes)) == 0);
+
+    // act
+    int result_1 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize(&destination, sizeof(destination), value, 1);
+    int result_2 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize(&destination, sizeof(destination), value, sizeof(value) - 1);
+    int result_3 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_binary).deserialize(&destination, sizeof(destination), value, sizeof(value) + 1);
+
+    // assert
+    POOR_MANS_ASSERT(result_1 < 0);
+    POOR_MANS_ASSERT(result_2 < 0);
+    POOR_MANS_ASSERT(result_3 < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_037: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary) shall store in the memory at dst_value the pointer data and length, without copying the bytes. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_038: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary) shall succeed and return 0. ]*/
+static void borrowed_binary_init_does_not_copy_the_bytes(void)
+{
+    // arrange
+    BORROWED_BINARY borrowed = { NULL, 0 };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary)(&borrowed, test_bytes, sizeof(test_bytes));
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(borrowed.data == test_bytes);
+    POOR_MANS_ASSERT(borrowed.length == sizeof(test_bytes));
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_034: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary) shall fail and return a non-zero value. ]*/
+static void borrowed_binary_init_with_NULL_dst_value_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary)(NULL, test_bytes, sizeof(test_bytes));
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_035: [ If data is NULL and length is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary) shall fail and return a non-zero value. ]*/
+static void borrowed_binary_init_with_NULL_data_and_non_zero_length_fails(void)
+{
+    // arrange
+    BORROWED_BINARY borrowed;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary)(&borrowed, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_036: [ If length is greater than LOG_CONTEXT_BINARY_MAX_LENGTH, LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary) shall fail and return a non-zero value. ]*/
+static void borrowed_binary_init_with_length_too_big_fails(void)
+{
+    // arrange
+    BORROWED_BINARY borrowed;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary)(&borrowed, test_bytes, (size_t)LOG_CONTEXT_BINARY_MAX_LENGTH + 1);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(borrowed_binary) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BINARY_01_039: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(borrowed_binary) shall return sizeof(BORROWED_BINARY). ]*/
+static void borrowed_binary_get_init_data_size_returns_the_size_of_BORROWED_BINARY(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(borrowed_binary)();
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(BORROWED_BINARY));
+}
+
+int main(void)
+{
+    binary_to_string_succeeds();
+    binary_to_string_truncates_to_whole_bytes();
+    binary_to_string_with_0_bytes_produces_an_empty_string();
+    binary_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length();
+    binary_to_string_with_NULL_property_value_fails();
+    binary_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails();
+    binary_copy_succeeds();
+    binary_copy_with_NULL_dst_value_fails();
+    binary_copy_with_NULL_src_value_fails();
+    binary_free_returns();
+    binary_get_type_returns_binary();
+    binary_get_size_returns_the_size_of_the_length_and_the_bytes();
+    binary_get_size_with_NULL_property_value_fails();
+    binary_serialize_copies_the_length_and_the_bytes();
+    binary_serialize_with_a_buffer_too_small_only_returns_the_needed_size();
+    binary_serialize_with_NULL_property_value_fails();
+    binary_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails();
+    binary_deserialize_of_a_serialized_value_gives_back_the_value();
+    binary_deserialize_with_a_dst_size_too_small_only_returns_the_needed_size();
+    binary_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    binary_deserialize_with_NULL_buffer_fails();
+    binary_deserialize_with_a_buffer_size_smaller_than_the_length_fails();
+    binary_deserialize_with_a_buffer_size_that_does_not_match_the_length_fails();
+    binary_init_succeeds();
+    binary_init_with_NULL_dst_value_fails();
+    binary_init_with_NULL_data_and_non_zero_length_fails();
+    binary_init_with_length_too_big_fails();
+    binary_get_init_data_size_returns_the_size_of_the_length_and_the_bytes();
+    binary_get_init_data_size_with_length_too_big_returns_a_negative_value();
+    binary_fill_succeeds();
+    binary_fill_with_a_buffer_too_small_only_returns_the_needed_size();
+    binary_fill_with_NULL_dst_value_and_0_dst_size_returns_the_needed_size();
+    binary_fill_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    binary_fill_with_NULL_data_and_non_zero_length_fails();
+    binary_fill_with_length_too_big_fails();
+    borrowed_binary_to_string_succeeds();
+    borrowed_binary_to_string_truncates_to_whole_bytes();
+    borrowed_binary_to_string_with_NULL_property_value_fails();
+    borrowed_binary_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails();
+    borrowed_binary_copy_keeps_borrowing_the_bytes();
+    borrowed_binary_copy_with_NULL_dst_value_fails();
+    borrowed_binary_copy_with_NULL_src_value_fails();
+    borrowed_binary_free_returns();
+    borrowed_binary_get_type_returns_borrowed_binary();
+    borrowed_binary_get_size_returns_the_size_of_BORROWED_BINARY();
+    borrowed_binary_get_size_with_NULL_property_value_fails();
+    borrowed_binary_serialize_inlines_the_borrowed_bytes();
+    borrowed_binary_serialize_with_a_buffer_too_small_only_returns_the_needed_size();
+    borrowed_binary_serialize_with_NULL_property_value_fails();
+    borrowed_binary_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails();
+    borrowed_binary_deserialize_borrows_the_bytes_from_the_buffer();
+    borrowed_binary_deserialize_with_a_dst_size_too_small_only_returns_the_needed_size();
+    borrowed_binary_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    borrowed_binary_deserialize_with_NULL_buffer_fails();
+    borrowed_binary_deserialize_with_a_buffer_size_that_does_not_match_the_length_fails();
+    borrowed_binary_init_does_not_copy_the_bytes();
+    borrowed_binary_init_with_NULL_dst_value_fails();
+    borrowed_binary_init_with_NULL_data_and_non_zero_length_fails();
+    borrowed_binary_init_with_length_too_big_fails();
+    borrowed_binary_get_init_data_size_returns_the_size_of_BORROWED_BINARY();
+
+    return 0;
+}
@@ -0,0 +1,624 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <limits.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+
+#include "c_logging/log_context_property_type_borrowed_ascii_char_ptr.h"
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_004: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string shall copy from the borrowed string as many characters as fit in buffer (keeping one byte for the null terminator), without computing the length of the string again. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_005: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string shall succeed and return the length of the borrowed string. ]*/
+static void borrowed_ascii_char_ptr_to_string_succeeds(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed = { "gogu", 4 };
+    char buffer[16];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string(&borrowed, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 4);
+    POOR_MANS_ASSERT(strcmp(buffer, "gogu") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_004: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string shall copy from the borrowed string as many characters as fit in buffer (keeping one byte for the null terminator), without computing the length of the string again. ]*/
+static void borrowed_ascii_char_ptr_to_string_uses_the_stored_length(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed = { "gogu and more", 4 };
+    char buffer[16];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string(&borrowed, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 4);
+    POOR_MANS_ASSERT(strcmp(buffer, "gogu") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_004: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string shall copy from the borrowed string as many characters as fit in buffer (keeping one byte for the null terminator), without computing the length of the string again. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_005: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string shall succeed and return the length of the borrowed string. ]*/
+static void borrowed_ascii_char_ptr_to_string_matches_snprintf_for_all_buffer_sizes(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed = { "the answer is 42", sizeof("the answer is 42") - 1 };
+
+    for (size_t buffer_length = 1; buffer_length <= borrowed.length + 1; buffer_length++)
+    {
+        char expected[32];
+        char actual[32];
+        (void)memset(actual, 'x', sizeof(actual));
+        int expected_result = snprintf(expected, buffer_length, "%s", borrowed.value);
+
+        // act
+        int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string(&borrowed, actual, buffer_length);
+
+        // assert
+        POOR_MANS_ASSERT(result == expected_result);
+        POOR_MANS_ASSERT(strcmp(actual, expected) == 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_005: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string shall succeed and return the length of the borrowed string. ]*/
+static void borrowed_ascii_char_ptr_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed = { "gogu", 4 };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string(&borrowed, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == 4);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_001: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string shall fail and return a negative value. ]*/
+static void borrowed_ascii_char_ptr_to_string_with_NULL_property_value_fails(void)
+{
+    // arrange
+    char buffer[16];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_002: [ If buffer is NULL and buffer_length is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string shall fail and return a negative value. ]*/
+static void borrowed_ascii_char_ptr_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed = { "gogu", 4 };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string(&borrowed, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_003: [ If the length of the borrowed string does not fit in an int, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string shall fail and return a negative value. ]*/
+static void borrowed_ascii_char_ptr_to_string_with_a_length_that_does_not_fit_in_an_int_fails(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed = { "gogu", (size_t)INT_MAX + 1 };
+    char buffer[16];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string(&borrowed, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).copy */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_008: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).copy shall copy the pointer and the length from src_value to dst_value (the string itself stays borrowed). ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_009: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).copy shall succeed and return 0. ]*/
+static void borrowed_ascii_char_ptr_copy_keeps_the_string_borrowed(void)
+{
+    // arrange
+    static const char borrowed_string[] = "gogu";
+    BORROWED_ASCII_CHAR_PTR source = { borrowed_string, sizeof(borrowed_string) - 1 };
+    BORROWED_ASCII_CHAR_PTR destination = { NULL, 0 };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).copy(&destination, &source);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(destination.value == borrowed_string);
+    POOR_MANS_ASSERT(destination.length == 4);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_006: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).copy shall fail and return a non-zero value. ]*/
+static void borrowed_ascii_char_ptr_copy_with_NULL_dst_value_fails(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR source = { "gogu", 4 };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).copy(NULL, &source);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_007: [ If src_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).copy shall fail and return a non-zero value. ]*/
+static void borrowed_ascii_char_ptr_copy_with_NULL_src_value_fails(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR destination;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).copy(&destination, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).free */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_010: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).free shall return. ]*/
+static void borrowed_ascii_char_ptr_free_returns(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed = { "gogu", 4 };
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).free(&borrowed);
+
+    // assert
+    POOR_MANS_ASSERT(strcmp(borrowed.value, "gogu") == 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).get_type */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_011: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).get_type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr. ]*/
+static void borrowed_ascii_char_ptr_get_type_returns_borrowed_ascii_char_ptr(void)
+{
+    // arrange
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).get_type();
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).get_size */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_024: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).get_size shall return sizeof(BORROWED_ASCII_CHAR_PTR). ]*/
+static void borrowed_ascii_char_ptr_get_size_returns_the_size_of_BORROWED_ASCII_CHAR_PTR(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed = { "gogu", 4 };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).get_size(&borrowed);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(BORROWED_ASCII_CHAR_PTR));
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_023: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).get_size shall fail and return a negative value. ]*/
+static void borrowed_ascii_char_ptr_get_size_with_NULL_property_value_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).get_size(NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_028: [ If the borrowed string and a null terminator fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize shall copy the borrowed string to buffer, followed by a null terminator. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_029: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize shall succeed and return the length of the borrowed string plus 1. ]*/
+static void borrowed_ascii_char_ptr_serialize_inlines_the_borrowed_string(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed = { "gogu", 4 };
+    char buffer[16];
+    (void)memset(buffer, 'x', sizeof(buffer));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize(&borrowed, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(memcmp(buffer, "gogu\0", 5) == 0);
+    POOR_MANS_ASSERT(buffer[5] == 'x');
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_028: [ If the borrowed string and a null terminator fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize shall copy the borrowed string to buffer, followed by a null terminator. ]*/
+static void borrowed_ascii_char_ptr_serialize_uses_the_stored_length(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed = { "gogu", 2 };
+    char buffer[16];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize(&borrowed, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 3);
+    POOR_MANS_ASSERT(memcmp(buffer, "go\0", 3) == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_029: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize shall succeed and return the length of the borrowed string plus 1. ]*/
+static void borrowed_ascii_char_ptr_serialize_with_too_small_buffer_size_does_not_write_and_returns_the_needed_size(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed = { "gogu", 4 };
+    char buffer[4];
+    (void)memset(buffer, 'x', sizeof(buffer));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize(&borrowed, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(memcmp(buffer, "xxxx", 4) == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_025: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize shall fail and return a negative value. ]*/
+static void borrowed_ascii_char_ptr_serialize_with_NULL_property_value_fails(void)
+{
+    // arrange
+    char buffer[16];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_026: [ If buffer is NULL and buffer_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize shall fail and return a negative value. ]*/
+static void borrowed_ascii_char_ptr_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed = { "gogu", 4 };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize(&borrowed, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_027: [ If the length of the borrowed string plus 1 does not fit in an int, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize shall fail and return a negative value. ]*/
+static void borrowed_ascii_char_ptr_serialize_with_a_length_that_does_not_fit_in_an_int_fails(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed = { "gogu", (size_t)INT_MAX };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize(&borrowed, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_033: [ If sizeof(BORROWED_ASCII_CHAR_PTR) fits in dst_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize shall store in dst_value a BORROWED_ASCII_CHAR_PTR that borrows the string in buffer, with the length buffer_size - 1. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_034: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize shall succeed and return sizeof(BORROWED_ASCII_CHAR_PTR). ]*/
+static void borrowed_ascii_char_ptr_deserialize_borrows_the_string_from_the_buffer(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed = { "gogu", 4 };
+    char buffer[5];
+    BORROWED_ASCII_CHAR_PTR destination = { NULL, 0 };
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).serialize(&borrowed, buffer, sizeof(buffer)) == 5);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize(&destination, sizeof(destination), buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(BORROWED_ASCII_CHAR_PTR));
+    POOR_MANS_ASSERT(destination.value == buffer);
+    POOR_MANS_ASSERT(destination.length == 4);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_034: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize shall succeed and return sizeof(BORROWED_ASCII_CHAR_PTR). ]*/
+static void borrowed_ascii_char_ptr_deserialize_with_too_small_dst_size_does_not_write_and_returns_the_needed_size(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR destination = { NULL, 0 };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize(&destination, sizeof(destination) - 1, "gogu", 5);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(BORROWED_ASCII_CHAR_PTR));
+    POOR_MANS_ASSERT(destination.value == NULL);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_030: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize shall fail and return a negative value. ]*/
+static void borrowed_ascii_char_ptr_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize(NULL, 1, "gogu", 5);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_031: [ If buffer is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize shall fail and return a negative value. ]*/
+static void borrowed_ascii_char_ptr_deserialize_with_NULL_buffer_fails(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR destination;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize(&destination, sizeof(destination), NULL, 5);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_032: [ If the first null terminator in buffer is not the byte at buffer_size - 1, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize shall fail and return a negative value. ]*/
+static void borrowed_ascii_char_ptr_deserialize_without_a_null_terminator_at_the_end_fails(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR destination;
+
+    // act
+    int result_1 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize(&destination, sizeof(destination), "gogu", 0);
+    int result_2 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize(&destination, sizeof(destination), "gogu", 4);
+    int result_3 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).deserialize(&destination, sizeof(destination), "go\0gu", 6);
+
+    // assert
+    POOR_MANS_ASSERT(result_1 < 0);
+    POOR_MANS_ASSERT(result_2 < 0);
+    POOR_MANS_ASSERT(result_3 < 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr. ]*/
+static void borrowed_ascii_char_ptr_type_tag_is_borrowed_ascii_char_ptr(void)
+{
+    // arrange
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).type_tag;
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_014: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr) shall store in the memory at dst_value the pointer value and the length of the string pointed to by value, without copying the string. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_015: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr) shall succeed and return 0. ]*/
+static void borrowed_ascii_char_ptr_init_stores_the_pointer_and_the_length(void)
+{
+    // arrange
+    static const char borrowed_string[] = "gogu";
+    BORROWED_ASCII_CHAR_PTR borrowed = { NULL, 0 };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr)(&borrowed, borrowed_string);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(borrowed.value == borrowed_string);
+    POOR_MANS_ASSERT(borrowed.length == 4);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_014: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr) shall store in the memory at dst_value the pointer value and the length of the string pointed to by value, without copying the string. ]*/
+static void borrowed_ascii_char_ptr_init_with_empty_string_succeeds(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed = { NULL, 42 };
+    char buffer[4];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr)(&borrowed, "");
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(borrowed.length == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(borrowed_ascii_char_ptr).to_string(&borrowed, buffer, sizeof(buffer)) == 0);
+    POOR_MANS_ASSERT(buffer[0] == '\0');
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_012: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr) shall fail and return a non-zero value. ]*/
+static void borrowed_ascii_char_ptr_init_with_NULL_dst_value_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr)(NULL, "gogu");
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_013: [ If value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr) shall fail and return a non-zero value. ]*/
+static void borrowed_ascii_char_ptr_init_with_NULL_value_fails(void)
+{
+    // arrange
+    BORROWED_ASCII_CHAR_PTR borrowed;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr)(&borrowed, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(borrowed_ascii_char_ptr) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_016: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(borrowed_ascii_char_ptr) shall return sizeof(BORROWED_ASCII_CHAR_PTR). ]*/
+static void borrowed_ascii_char_ptr_get_init_data_size_returns_the_size_of_the_pointer_and_length(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(borrowed_ascii_char_ptr)();
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(BORROWED_ASCII_CHAR_PTR));
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_020: [ If the string (including the null terminator) fits in dst_size bytes, LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) shall copy it to dst_value, producing an ascii_char_ptr value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_021: [ LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) shall succeed and return the amount of memory needed to store the string, including the null terminator. ]*/
+static void borrowed_ascii_char_ptr_fill_copies_the_string(void)
+{
+    // arrange
+    char buffer[16];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr)(buffer, sizeof(buffer), "gogu");
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(strcmp(buffer, "gogu") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_020: [ If the string (including the null terminator) fits in dst_size bytes, LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) shall copy it to dst_value, producing an ascii_char_ptr value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_021: [ LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) shall succeed and return the amount of memory needed to store the string, including the null terminator. ]*/
+static void borrowed_ascii_char_ptr_fill_with_exact_size_copies_the_string(void)
+{
+    // arrange
+    char buffer[5];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr)(buffer, sizeof(buffer), "gogu");
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(strcmp(buffer, "gogu") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_021: [ LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) shall succeed and return the amount of memory needed to store the string, including the null terminator. ]*/
+static void borrowed_ascii_char_ptr_fill_with_too_small_dst_size_does_not_write_and_returns_the_needed_size(void)
+{
+    // arrange
+    char buffer[4] = { 'x', 'x', 'x', 'x' };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr)(buffer, sizeof(buffer), "gogu");
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(memcmp(buffer, "xxxx", 4) == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_021: [ LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) shall succeed and return the amount of memory needed to store the string, including the null terminator. ]*/
+static void borrowed_ascii_char_ptr_fill_with_NULL_dst_value_and_0_dst_size_returns_the_needed_size(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr)(NULL, 0, "gogu");
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_017: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) shall fail and return a negative value. ]*/
+static void borrowed_ascii_char_ptr_fill_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr)(NULL, 1, "gogu");
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_BORROWED_ASCII_CHAR_PTR_01_018: [ If value is NULL, LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) shall fail and return a negative value. ]*/
+static void borrowed_ascii_char_ptr_fill_with_NULL_value_fails(void)
+{
+    // arrange
+    char buffer[16];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr)(buffer, sizeof(buffer), NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+int main(void)
+{
+    borrowed_ascii_char_ptr_to_string_succeeds();
+    borrowed_ascii_char_ptr_to_string_uses_the_stored_length();
+    borrowed_ascii_char_ptr_to_string_matches_snprintf_for_all_buffer_sizes();
+    borrowed_ascii_char_ptr_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length();
+    borrowed_ascii_char_ptr_to_string_with_NULL_property_value_fails();
+    borrowed_ascii_char_ptr_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails();
+    borrowed_ascii_char_ptr_to_string_with_a_length_that_does_not_fit_in_an_int_fails();
+
+    borrowed_ascii_char_ptr_copy_keeps_the_string_borrowed();
+    borrowed_ascii_char_ptr_copy_with_NULL_dst_value_fails();
+    borrowed_ascii_char_ptr_copy_with_NULL_src_value_fails();
+
+    borrowed_ascii_char_ptr_free_returns();
+
+    borrowed_ascii_char_ptr_get_type_returns_borrowed_ascii_char_ptr();
+
+    borrowed_ascii_char_ptr_get_size_returns_the_size_of_BORROWED_ASCII_CHAR_PTR();
+    borrowed_ascii_char_ptr_get_size_with_NULL_property_value_fails();
+    borrowed_ascii_char_ptr_serialize_inlines_the_borrowed_string();
+    borrowed_ascii_char_ptr_serialize_uses_the_stored_length();
+    borrowed_ascii_char_ptr_serialize_with_too_small_buffer_size_does_not_write_and_returns_the_needed_size();
+    borrowed_ascii_char_ptr_serialize_with_NULL_property_value_fails();
+    borrowed_ascii_char_ptr_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails();
+    borrowed_ascii_char_ptr_serialize_with_a_length_that_does_not_fit_in_an_int_fails();
+    borrowed_ascii_char_ptr_deserialize_borrows_the_string_from_the_buffer();
+    borrowed_ascii_char_ptr_deserialize_with_too_small_dst_size_does_not_write_and_returns_the_needed_size();
+    borrowed_ascii_char_ptr_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    borrowed_ascii_char_ptr_deserialize_with_NULL_buffer_fails();
+    borrowed_ascii_char_ptr_deserialize_without_a_null_terminator_at_the_end_fails();
+
+    borrowed_ascii_char_ptr_type_tag_is_borrowed_ascii_char_ptr();
+
+    borrowed_ascii_char_ptr_init_stores_the_pointer_and_the_length();
+    borrowed_ascii_char_ptr_init_with_empty_string_succeeds();
+    borrowed_ascii_char_ptr_init_with_NULL_dst_value_fails();
+    borrowed_ascii_char_ptr_init_with_NULL_value_fails();
+
+    borrowed_ascii_char_ptr_get_init_data_size_returns_the_size_of_the_pointer_and_length();
+
+    borrowed_ascii_char_ptr_fill_copies_the_string();
+    borrowed_ascii_char_ptr_fill_with_exact_size_copies_the_string();
+    borrowed_ascii_char_ptr_fill_with_too_small_dst_size_does_not_write_and_returns_the_needed_size();
+    borrowed_ascii_char_ptr_fill_with_NULL_dst_value_and_0_dst_size_returns_the_needed_size();
+    borrowed_ascii_char_ptr_fill_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    borrowed_ascii_char_ptr_fill_with_NULL_value_fails();
+
+    return 0;
+}
@@ -0,0 +1,576 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+#include "c_logging/log_context.h"
+
+#include "c_logging/log_context_property_type_enum.h"
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+#define TEST_STATE_VALUES \
+    TEST_STATE_STOPPED, \
+    TEST_STATE_RUNNING
+
+MU_DEFINE_ENUM(TEST_STATE, TEST_STATE_VALUES)
+MU_DEFINE_ENUM_STRINGS(TEST_STATE, TEST_STATE_VALUES)
+LOG_CONTEXT_PROPERTY_ENUM_TYPE_DEFINE(TEST_STATE)
+
+#define TEST_COLOR_VALUES \
+    TEST_COLOR_RED, \
+    TEST_COLOR_GREEN, \
+    TEST_COLOR_BLUE
+
+MU_DEFINE_ENUM_WITHOUT_INVALID(TEST_COLOR, TEST_COLOR_VALUES);
+MU_DEFINE_ENUM_STRINGS_WITHOUT_INVALID(TEST_COLOR, TEST_COLOR_VALUES);
+LOG_CONTEXT_PROPERTY_ENUM_TYPE_DEFINE(TEST_COLOR)
+
+static const char* test_value_to_string_result;
+
+static const char* test_value_to_string(int32_t value)
+{
+    (void)value;
+    return test_value_to_string_result;
+}
+
+// builds the text that PRI_MU_ENUM/MU_ENUM_VALUE produce for the same value
+#define FORMAT_LIKE_PRI_MU_ENUM(buffer, enum_type, value) \
+    (void)snprintf(buffer, sizeof(buffer), "%" PRI_MU_ENUM, MU_ENUM_VALUE(enum_type, value))
+
+/* log_context_property_type_enum_to_string */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_008: [ If property_value is NULL, log_context_property_type_enum_to_string shall fail and return a negative value. ]*/
+static void log_context_property_type_enum_to_string_with_NULL_property_value_fails(void)
+{
+    // arrange
+    char buffer[64];
+
+    // act
+    int result = log_context_property_type_enum_to_string(NULL, test_value_to_string, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_009: [ If value_to_string is NULL, log_context_property_type_enum_to_string shall fail and return a negative value. ]*/
+static void log_context_property_type_enum_to_string_with_NULL_value_to_string_fails(void)
+{
+    // arrange
+    int32_t value = 1;
+    char buffer[64];
+
+    // act
+    int result = log_context_property_type_enum_to_string(&value, NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_010: [ If buffer is NULL and buffer_length is greater than 0, log_context_property_type_enum_to_string shall fail and return a negative value. ]*/
+static void log_context_property_type_enum_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails(void)
+{
+    // arrange
+    int32_t value = 1;
+    test_value_to_string_result = "GIGI";
+
+    // act
+    int result = log_context_property_type_enum_to_string(&value, test_value_to_string, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_011: [ log_context_property_type_enum_to_string shall obtain the string for the stored value by calling value_to_string. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_013: [ log_context_property_type_enum_to_string shall produce the string of the value, followed by a space, (, the decimal value and ). ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_015: [ log_context_property_type_enum_to_string shall succeed and return the length of the full representation. ]*/
+static void log_context_property_type_enum_to_string_succeeds(void)
+{
+    // arrange
+    int32_t value = -42;
+    test_value_to_string_result = "GIGI";
+    char buffer[64];
+
+    // act
+    int result = log_context_property_type_enum_to_string(&value, test_value_to_string, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 10);
+    POOR_MANS_ASSERT(strcmp(buffer, "GIGI (-42)") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_012: [ If value_to_string returns NULL, log_context_property_type_enum_to_string shall use an empty string. ]*/
+static void log_context_property_type_enum_to_string_when_value_to_string_returns_NULL_uses_an_empty_string(void)
+{
+    // arrange
+    int32_t value = 7;
+    test_value_to_string_result = NULL;
+    char buffer[64];
+
+    // act
+    int result = log_context_property_type_enum_to_string(&value, test_value_to_string, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 4);
+    POOR_MANS_ASSERT(strcmp(buffer, " (7)") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_014: [ log_context_property_type_enum_to_string shall write in buffer as many characters of the representation as fit (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_015: [ log_context_property_type_enum_to_string shall succeed and return the length of the full representation. ]*/
+static void log_context_property_type_enum_to_string_truncates_for_all_buffer_lengths(void)
+{
+    // arrange
+    static const char expected[] = "GIGI (123)";
+    int32_t value = 123;
+    test_value_to_string_result = "GIGI";
+    char buffer[sizeof(expected) + 1];
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(log_context_property_type_enum_to_string(&value, test_value_to_string, NULL, 0) == (int)sizeof(expected) - 1);
+    for (size_t buffer_length = 1; buffer_length <= sizeof(expected); buffer_length++)
+    {
+        (void)memset(buffer, 'x', sizeof(buffer));
+        POOR_MANS_ASSERT(log_context_property_type_enum_to_string(&value, test_value_to_string, buffer, buffer_length) == (int)sizeof(expected) - 1);
+        POOR_MANS_ASSERT(strlen(buffer) == buffer_length - 1);
+        POOR_MANS_ASSERT(strncmp(buffer, expected, buffer_length - 1) == 0);
+        POOR_MANS_ASSERT(buffer[buffer_length] == 'x');
+    }
+}
+
+/* log_context_property_type_enum_init */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_016: [ If dst_value is NULL, log_context_property_type_enum_init shall fail and return a non-zero value. ]*/
+static void log_context_property_type_enum_init_with_NULL_dst_value_fails(void)
+{
+    // arrange
+
+    // act
+    int result = log_context_property_type_enum_init(NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_017: [ log_context_property_type_enum_init shall store value in dst_value as an int32_t. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_018: [ log_context_property_type_enum_init shall succeed and return 0. ]*/
+static void log_context_property_type_enum_init_stores_the_value(void)
+{
+    // arrange
+    int32_t value = 0;
+
+    // act
+    int result = log_context_property_type_enum_init(&value, INT32_MIN);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(value == INT32_MIN);
+}
+
+/* log_context_property_type_enum_copy */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_019: [ If dst_value is NULL, log_context_property_type_enum_copy shall fail and return a non-zero value. ]*/
+static void log_context_property_type_enum_copy_with_NULL_dst_value_fails(void)
+{
+    // arrange
+    int32_t source = 1;
+
+    // act
+    int result = log_context_property_type_enum_copy(NULL, &source);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_020: [ If src_value is NULL, log_context_property_type_enum_copy shall fail and return a non-zero value. ]*/
+static void log_context_property_type_enum_copy_with_NULL_src_value_fails(void)
+{
+    // arrange
+    int32_t destination;
+
+    // act
+    int result = log_context_property_type_enum_copy(&destination, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_021: [ log_context_property_type_enum_copy shall copy the int32_t value from src_value to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_022: [ log_context_property_type_enum_copy shall succeed and return 0. ]*/
+static void log_context_property_type_enum_copy_succeeds(void)
+{
+    // arrange
+    int32_t source = 0x12345678;
+    int32_t destination[2] = { 0, 0 };
+
+    // act
+    int result = log_context_property_type_enum_copy(destination, &source);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(destination[0] == 0x12345678);
+    POOR_MANS_ASSERT(destination[1] == 0);
+}
+
+/* log_context_property_type_enum_free */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_023: [ log_context_property_type_enum_free shall return. ]*/
+static void log_context_property_type_enum_free_returns(void)
+{
+    // arrange
+    int32_t value = 1;
+
+    // act
+    log_context_property_type_enum_free(&value);
+
+    // assert
+    // no explicit assert
+}
+
+/* log_context_property_type_enum_get_type */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_024: [ log_context_property_type_enum_get_type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_enum. ]*/
+static void log_context_property_type_enum_get_type_returns_enum(void)
+{
+    // arrange
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = log_context_property_type_enum_get_type();
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_enum);
+}
+
+/* log_context_property_type_enum_get_size */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_025: [ If property_value is NULL, log_context_property_type_enum_get_size shall fail and return a negative value. ]*/
+static void log_context_property_type_enum_get_size_with_NULL_value_fails(void)
+{
+    // arrange
+
+    // act
+    int result = log_context_property_type_enum_get_size(NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_026: [ Otherwise log_context_property_type_enum_get_size shall return sizeof(int32_t). ]*/
+static void log_context_property_type_enum_get_size_returns_the_size_of_the_value(void)
+{
+    // arrange
+    int32_t value = 0x12345678;
+
+    // act
+    int result = log_context_property_type_enum_get_size(&value);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(int32_t));
+}
+
+/* log_context_property_type_enum_serialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_027: [ If property_value is NULL, log_context_property_type_enum_serialize shall fail and return a negative value. ]*/
+static void log_context_property_type_enum_serialize_with_NULL_value_fails(void)
+{
+    // arrange
+    unsigned char buffer[sizeof(int32_t)];
+
+    // act
+    int result = log_context_property_type_enum_serialize(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_028: [ If buffer is NULL and buffer_size is greater than 0, log_context_property_type_enum_serialize shall fail and return a negative value. ]*/
+static void log_context_property_type_enum_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails(void)
+{
+    // arrange
+    int32_t value = 0x12345678;
+
+    // act
+    int result = log_context_property_type_enum_serialize(&value, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_030: [ log_context_property_type_enum_serialize shall succeed and return sizeof(int32_t). ]*/
+static void log_context_property_type_enum_serialize_with_NULL_buffer_returns_the_size(void)
+{
+    // arrange
+    int32_t value = 0x12345678;
+
+    // act
+    int result = log_context_property_type_enum_serialize(&value, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(int32_t));
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_029: [ If sizeof(int32_t) bytes fit in buffer_size, log_context_property_type_enum_serialize shall copy the bytes of the int32_t value from property_value to buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_030: [ log_context_property_type_enum_serialize shall succeed and return sizeof(int32_t). ]*/
+static void log_context_property_type_enum_serialize_succeeds(void)
+{
+    // arrange
+    int32_t value = 0x12345678;
+    unsigned char buffer[sizeof(int32_t) + 1];
+    (void)memset(buffer, 0xAA, sizeof(buffer));
+
+    // act
+    int result = log_context_property_type_enum_serialize(&value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(int32_t));
+    POOR_MANS_ASSERT(memcmp(buffer, &value, sizeof(int32_t)) == 0);
+    POOR_MANS_ASSERT(buffer[sizeof(int32_t)] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_029: [ If sizeof(int32_t) bytes fit in buffer_size, log_context_property_type_enum_serialize shall copy the bytes of the int32_t value from property_value to buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_030: [ log_context_property_type_enum_serialize shall succeed and return sizeof(int32_t). ]*/
+static void log_context_property_type_enum_serialize_with_too_small_buffer_only_returns_the_size(void)
+{
+    // arrange
+    int32_t value = 0x12345678;
+    unsigned char buffer[sizeof(int32_t)];
+    (void)memset(buffer, 0xAA, sizeof(buffer));
+
+    // act
+    int result = log_context_property_type_enum_serialize(&value, buffer, sizeof(buffer) - 1);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(int32_t));
+    POOR_MANS_ASSERT(buffer[0] == 0xAA);
+}
+
+/* log_context_property_type_enum_deserialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_031: [ If dst_value is NULL and dst_size is greater than 0, log_context_property_type_enum_deserialize shall fail and return a negative value. ]*/
+static void log_context_property_type_enum_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    // arrange
+    int32_t value = 0x12345678;
+
+    // act
+    int result = log_context_property_type_enum_deserialize(NULL, sizeof(int32_t), &value, sizeof(int32_t));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_032: [ If buffer is NULL, log_context_property_type_enum_deserialize shall fail and return a negative value. ]*/
+static void log_context_property_type_enum_deserialize_with_NULL_buffer_fails(void)
+{
+    // arrange
+    int32_t deserialized;
+
+    // act
+    int result = log_context_property_type_enum_deserialize(&deserialized, sizeof(deserialized), NULL, sizeof(int32_t));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_033: [ If buffer_size is not sizeof(int32_t), log_context_property_type_enum_deserialize shall fail and return a negative value. ]*/
+static void log_context_property_type_enum_deserialize_with_wrong_buffer_size_fails(void)
+{
+    // arrange
+    unsigned char buffer[sizeof(int32_t) + 1] = { 0 };
+    int32_t deserialized;
+
+    // act
+    int result_1 = log_context_property_type_enum_deserialize(&deserialized, sizeof(deserialized), buffer, sizeof(int32_t) - 1);
+    int result_2 = log_context_property_type_enum_deserialize(&deserialized, sizeof(deserialized), buffer, sizeof(int32_t) + 1);
+
+    // assert
+    POOR_MANS_ASSERT(result_1 < 0);
+    POOR_MANS_ASSERT(result_2 < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_034: [ If sizeof(int32_t) bytes fit in dst_size, log_context_property_type_enum_deserialize shall copy the bytes of the int32_t value from buffer to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_035: [ log_context_property_type_enum_deserialize shall succeed and return sizeof(int32_t). ]*/
+static void log_context_property_type_enum_deserialize_of_serialized_value_succeeds(void)
+{
+    // arrange
+    int32_t value = 0x12345678;
+    int32_t deserialized;
+    unsigned char buffer[sizeof(int32_t)];
+    POOR_MANS_ASSERT(log_context_property_type_enum_serialize(&value, buffer, sizeof(buffer)) == (int)sizeof(int32_t));
+    (void)memset(&deserialized, 0, sizeof(deserialized));
+
+    // act
+    int result = log_context_property_type_enum_deserialize(&deserialized, sizeof(deserialized), buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(int32_t));
+    POOR_MANS_ASSERT(memcmp(&deserialized, &value, sizeof(int32_t)) == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_035: [ log_context_property_type_enum_deserialize shall succeed and return sizeof(int32_t). ]*/
+static void log_context_property_type_enum_deserialize_with_NULL_dst_value_returns_the_size(void)
+{
+    // arrange
+    int32_t value = 0x12345678;
+
+    // act
+    int result = log_context_property_type_enum_deserialize(NULL, 0, &value, sizeof(value));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(int32_t));
+}
+
+/* LOG_CONTEXT_PROPERTY_ENUM_TYPE_DEFINE */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_002: [ The enum strings shall be obtained by calling MU_ENUM_TO_STRING with enum_type and the stored value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(enum_type).to_string shall call log_context_property_type_enum_to_string with the enum strings of enum_type and return its result. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_004: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(enum_type) shall call log_context_property_type_enum_init with dst_value and value and return its result. ]*/
+static void enum_type_to_string_produces_the_same_text_as_PRI_MU_ENUM(void)
+{
+    // arrange
+    int32_t value;
+    char buffer[64];
+    char expected[64];
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(TEST_STATE)(&value, TEST_STATE_RUNNING) == 0);
+    FORMAT_LIKE_PRI_MU_ENUM(expected, TEST_STATE, TEST_STATE_RUNNING);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(TEST_STATE).to_string(&value, buffer, sizeof(buffer)) == (int)strlen(expected));
+    POOR_MANS_ASSERT(strcmp(buffer, expected) == 0);
+
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(TEST_COLOR)(&value, TEST_COLOR_BLUE) == 0);
+    POOR_MANS_ASSERT(value == 2);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(TEST_COLOR).to_string(&value, buffer, sizeof(buffer)) == 19);
+    POOR_MANS_ASSERT(strcmp(buffer, "TEST_COLOR_BLUE (2)") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_004: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(enum_type) shall call log_context_property_type_enum_init with dst_value and value and return its result. ]*/
+static void enum_type_init_with_NULL_dst_value_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(TEST_STATE)(NULL, TEST_STATE_RUNNING);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_005: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(enum_type) shall return sizeof(int32_t). ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_006: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(enum_type) shall use log_context_property_type_enum_copy, log_context_property_type_enum_free and log_context_property_type_enum_get_type as copy, free and get_type. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_007: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(enum_type).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_enum. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_036: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(enum_type) shall use log_context_property_type_enum_get_size, log_context_property_type_enum_serialize and log_context_property_type_enum_deserialize as get_size, serialize and deserialize. ]*/
+static void enum_type_interface_uses_the_common_enum_functions(void)
+{
+    // arrange
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(TEST_STATE)() == (int)sizeof(int32_t));
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(TEST_STATE).copy == log_context_property_type_enum_copy);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(TEST_STATE).free == log_context_property_type_enum_free);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(TEST_STATE).get_type == log_context_property_type_enum_get_type);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(TEST_STATE).get_size == log_context_property_type_enum_get_size);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(TEST_STATE).serialize == log_context_property_type_enum_serialize);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(TEST_STATE).deserialize == log_context_property_type_enum_deserialize);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(TEST_STATE).type_tag == LOG_CONTEXT_PROPERTY_TYPE_enum);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(TEST_COLOR).type_tag == LOG_CONTEXT_PROPERTY_TYPE_enum);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(enum_type).to_string shall call log_context_property_type_enum_to_string with the enum strings of enum_type and return its result. ]*/
+static void enum_property_in_a_context_stores_only_the_value(void)
+{
+    // arrange
+    char buffer[64];
+
+    // act
+    LOG_CONTEXT_LOCAL_DEFINE(local_context, NULL,
+        LOG_CONTEXT_PROPERTY(TEST_COLOR, color, TEST_COLOR_GREEN)
+    );
+
+    // assert
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(&local_context) == 2);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(&local_context);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "color") == 0);
+    POOR_MANS_ASSERT(pairs[1].type == &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(TEST_COLOR));
+    POOR_MANS_ASSERT(*(const int32_t*)pairs[1].value == (int32_t)TEST_COLOR_GREEN);
+    POOR_MANS_ASSERT(pairs[1].type->to_string(pairs[1].value, buffer, sizeof(buffer)) == 20);
+    POOR_MANS_ASSERT(strcmp(buffer, "TEST_COLOR_GREEN (1)") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_ENUM_01_037: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(enum_type).enum_value_to_string shall return the enum string of enum_type for a value. ]*/
+static void enum_value_to_string_of_the_interface_returns_the_enum_strings(void)
+{
+    // arrange
+    const LOG_CONTEXT_PROPERTY_TYPE_IF* property_type = &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(TEST_COLOR);
+    int32_t value;
+    unsigned char serialized[sizeof(int32_t)];
+    int32_t deserialized;
+
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(TEST_COLOR)(&value, TEST_COLOR_BLUE) == 0);
+    POOR_MANS_ASSERT(property_type->serialize(&value, serialized, sizeof(serialized)) == (int)sizeof(int32_t));
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(property_type->deserialize(&deserialized, sizeof(deserialized), serialized, sizeof(serialized)) == (int)sizeof(int32_t));
+    POOR_MANS_ASSERT(property_type->enum_value_to_string != NULL);
+    POOR_MANS_ASSERT(strcmp(property_type->enum_value_to_string(deserialized), "TEST_COLOR_BLUE") == 0);
+    POOR_MANS_ASSERT(strcmp(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(TEST_STATE).enum_value_to_string(TEST_STATE_RUNNING), MU_ENUM_TO_STRING(TEST_STATE, TEST_STATE_RUNNING)) == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(int32_t).enum_value_to_string == NULL);
+}
+
+int main(void)
+{
+    log_context_property_type_enum_to_string_with_NULL_property_value_fails();
+    log_context_property_type_enum_to_string_with_NULL_value_to_string_fails();
+    log_context_property_type_enum_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails();
+    log_context_property_type_enum_to_string_succeeds();
+    log_context_property_type_enum_to_string_when_value_to_string_returns_NULL_uses_an_empty_string();
+    log_context_property_type_enum_to_string_truncates_for_all_buffer_lengths();
+
+    log_context_property_type_enum_init_with_NULL_dst_value_fails();
+    log_context_property_type_enum_init_stores_the_value();
+
+    log_context_property_type_enum_copy_with_NULL_dst_value_fails();
+    log_context_property_type_enum_copy_with_NULL_src_value_fails();
+    log_context_property_type_enum_copy_succeeds();
+
+    log_context_property_type_enum_free_returns();
+
+    log_context_property_type_enum_get_type_returns_enum();
+
+    log_context_property_type_enum_get_size_with_NULL_value_fails();
+    log_context_property_type_enum_get_size_returns_the_size_of_the_value();
+    log_context_property_type_enum_serialize_with_NULL_value_fails();
+    log_context_property_type_enum_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails();
+    log_context_property_type_enum_serialize_with_NULL_buffer_returns_the_size();
+    log_context_property_type_enum_serialize_succeeds();
+    log_context_property_type_enum_serialize_with_too_small_buffer_only_returns_the_size();
+    log_context_property_type_enum_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    log_context_property_type_enum_deserialize_with_NULL_buffer_fails();
+    log_context_property_type_enum_deserialize_with_wrong_buffer_size_fails();
+    log_context_property_type_enum_deserialize_of_serialized_value_succeeds();
+    log_context_property_type_enum_deserialize_with_NULL_dst_value_returns_the_size();
+
+    enum_type_to_string_produces_the_same_text_as_PRI_MU_ENUM();
+    enum_type_init_with_NULL_dst_value_fails();
+    enum_type_interface_uses_the_common_enum_functions();
+    enum_property_in_a_context_stores_only_the_value();
+    enum_value_to_string_of_the_interface_returns_the_enum_strings();
+
+    return 0;
+}
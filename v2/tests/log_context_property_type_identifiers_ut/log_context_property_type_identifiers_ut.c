@@ -0,0 +1,931 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+
+#ifdef _WIN32
+#include "winsock2.h"
+#include "ws2ipdef.h"
+#else
+#include <sys/socket.h>
+#include <netinet/in.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+
+#include "c_logging/log_context_property_type_identifiers.h"
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+static const uint8_t test_uuid[16] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xFE, 0xDC, 0xBA, 0x98, 0x76, 0x54, 0x32, 0x10 };
+static const uint8_t test_uuid_as_guid[16] = { 0x67, 0x45, 0x23, 0x01, 0xAB, 0x89, 0xEF, 0xCD, 0xFE, 0xDC, 0xBA, 0x98, 0x76, 0x54, 0x32, 0x10 };
+static const uint8_t test_ipv4_address[4] = { 192, 168, 1, 42 };
+static const uint8_t test_ipv6_address[16] = { 0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+static const uint8_t test_link_local_ipv6_address[16] = { 0xFE, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+
+typedef struct IDENTIFIER_TYPE_TAG
+{
+    const LOG_CONTEXT_PROPERTY_TYPE_IF* type_if;
+    LOG_CONTEXT_PROPERTY_TYPE type;
+    size_t size;
+    int (*get_init_data_size)(void);
+} IDENTIFIER_TYPE;
+
+static const IDENTIFIER_TYPE identifier_types[] =
+{
+    { &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_uuid_t), LOG_CONTEXT_PROPERTY_TYPE_log_uuid_t, sizeof(log_uuid_t), LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(log_uuid_t) },
+    { &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv4_address_t), LOG_CONTEXT_PROPERTY_TYPE_log_ipv4_address_t, sizeof(log_ipv4_address_t), LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(log_ipv4_address_t) },
+    { &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv6_address_t), LOG_CONTEXT_PROPERTY_TYPE_log_ipv6_address_t, sizeof(log_ipv6_address_t), LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(log_ipv6_address_t) },
+    { &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t), LOG_CONTEXT_PROPERTY_TYPE_log_socket_address_t, sizeof(log_socket_address_t), LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(log_socket_address_t) },
+};
+
+#define IDENTIFIER_TYPE_COUNT (sizeof(identifier_types) / sizeof(identifier_types[0]))
+
+static void set_port(void* port_field, uint16_t port)
+{
+    uint8_t port_bytes[2] = { (uint8_t)(port >> 8), (uint8_t)port };
+    (void)memcpy(port_field, port_bytes, sizeof(port_bytes));
+}
+
+static void make_ipv4_socket_address(struct sockaddr_in* socket_address, uint16_t port)
+{
+    (void)memset(socket_address, 0, sizeof(*socket_address));
+    socket_address->sin_family = AF_INET;
+    set_port(&socket_address->sin_port, port);
+    (void)memcpy(&socket_address->sin_addr, test_ipv4_address, sizeof(test_ipv4_address));
+}
+
+static void make_ipv6_socket_address(struct sockaddr_in6* socket_address, const uint8_t* address, uint16_t port, uint32_t scope_id)
+{
+    (void)memset(socket_address, 0, sizeof(*socket_address));
+    socket_address->sin6_family = AF_INET6;
+    set_port(&socket_address->sin6_port, port);
+    (void)memcpy(&socket_address->sin6_addr, address, 16);
+    socket_address->sin6_scope_id = scope_id;
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_uuid_t).to_string */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_001: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_uuid_t).to_string shall fail and return a negative value. ]*/
+static void log_uuid_t_to_string_with_NULL_property_value_fails(void)
+{
+    // arrange
+    char buffer[64];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_uuid_t).to_string(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_002: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_uuid_t).to_string shall put the stored bytes back in RFC 4122 order and produce the UUID text form by calling uuid_to_string with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_uuid_t).to_string shall return the result of uuid_to_string. ]*/
+static void log_uuid_t_to_string_succeeds(void)
+{
+    // arrange
+    log_uuid_t value;
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t)(&value, test_uuid) == 0);
+    char buffer[64];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_uuid_t).to_string(&value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 36);
+    POOR_MANS_ASSERT(strcmp(buffer, "01234567-89ab-cdef-fedc-ba9876543210") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_003: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_uuid_t).to_string shall return the result of uuid_to_string. ]*/
+static void log_uuid_t_to_string_truncates(void)
+{
+    // arrange
+    log_uuid_t value;
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t)(&value, test_uuid) == 0);
+    char buffer[10];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_uuid_t).to_string(&value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 36);
+    POOR_MANS_ASSERT(strcmp(buffer, "01234567-") == 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_025: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t) shall fail and return a non-zero value. ]*/
+static void log_uuid_t_init_with_NULL_dst_value_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t)(NULL, test_uuid);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_026: [ If uuid is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t) shall store the nil UUID in dst_value and fail and return a non-zero value. ]*/
+static void log_uuid_t_init_with_NULL_uuid_stores_the_nil_uuid_and_fails(void)
+{
+    // arrange
+    log_uuid_t value;
+    (void)memset(&value, 0xAA, sizeof(value));
+    static const uint8_t nil_uuid[16] = { 0 };
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t)(&value, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(memcmp(value.bytes, nil_uuid, sizeof(nil_uuid)) == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_027: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t) shall store in dst_value the 16 bytes at uuid (RFC 4122 order) in the GUID memory layout. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_028: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t) shall succeed and return 0. ]*/
+static void log_uuid_t_init_stores_the_guid_layout(void)
+{
+    // arrange
+    log_uuid_t value;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(log_uuid_t)(&value, test_uuid);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(memcmp(value.bytes, test_uuid_as_guid, sizeof(test_uuid_as_guid)) == 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv4_address_t).to_string */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_004: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv4_address_t).to_string shall fail and return a negative value. ]*/
+static void log_ipv4_address_t_to_string_with_NULL_property_value_fails(void)
+{
+    // arrange
+    char buffer[64];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv4_address_t).to_string(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_005: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv4_address_t).to_string shall produce the dotted decimal form of the address by calling ipv4_address_to_string with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_006: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv4_address_t).to_string shall return the result of ipv4_address_to_string. ]*/
+static void log_ipv4_address_t_to_string_succeeds(void)
+{
+    // arrange
+    log_ipv4_address_t value;
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv4_address_t)(&value, test_ipv4_address) == 0);
+    char buffer[64];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv4_address_t).to_string(&value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 12);
+    POOR_MANS_ASSERT(strcmp(buffer, "192.168.1.42") == 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv4_address_t) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_029: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv4_address_t) shall fail and return a non-zero value. ]*/
+static void log_ipv4_address_t_init_with_NULL_dst_value_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv4_address_t)(NULL, test_ipv4_address);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_030: [ If address is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv4_address_t) shall store the address 0.0.0.0 in dst_value and fail and return a non-zero value. ]*/
+static void log_ipv4_address_t_init_with_NULL_address_stores_0_0_0_0_and_fails(void)
+{
+    // arrange
+    log_ipv4_address_t value;
+    (void)memset(&value, 0xAA, sizeof(value));
+    char buffer[64];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv4_address_t)(&value, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv4_address_t).to_string(&value, buffer, sizeof(buffer)) == 7);
+    POOR_MANS_ASSERT(strcmp(buffer, "0.0.0.0") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_031: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv4_address_t) shall copy the 4 bytes at address to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_032: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv4_address_t) shall succeed and return 0. ]*/
+static void log_ipv4_address_t_init_copies_the_address(void)
+{
+    // arrange
+    log_ipv4_address_t value;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv4_address_t)(&value, test_ipv4_address);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(memcmp(value.bytes, test_ipv4_address, sizeof(test_ipv4_address)) == 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv6_address_t).to_string */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_007: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv6_address_t).to_string shall fail and return a negative value. ]*/
+static void log_ipv6_address_t_to_string_with_NULL_property_value_fails(void)
+{
+    // arrange
+    char buffer[64];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv6_address_t).to_string(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_008: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv6_address_t).to_string shall produce the RFC 5952 text form of the address by calling ipv6_address_to_string with buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_009: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv6_address_t).to_string shall return the result of ipv6_address_to_string. ]*/
+static void log_ipv6_address_t_to_string_succeeds(void)
+{
+    // arrange
+    log_ipv6_address_t value;
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv6_address_t)(&value, test_ipv6_address) == 0);
+    char buffer[64];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv6_address_t).to_string(&value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 11);
+    POOR_MANS_ASSERT(strcmp(buffer, "2001:db8::1") == 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv6_address_t) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_033: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv6_address_t) shall fail and return a non-zero value. ]*/
+static void log_ipv6_address_t_init_with_NULL_dst_value_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv6_address_t)(NULL, test_ipv6_address);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_034: [ If address is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv6_address_t) shall store the address :: in dst_value and fail and return a non-zero value. ]*/
+static void log_ipv6_address_t_init_with_NULL_address_stores_the_unspecified_address_and_fails(void)
+{
+    // arrange
+    log_ipv6_address_t value;
+    (void)memset(&value, 0xAA, sizeof(value));
+    char buffer[64];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv6_address_t)(&value, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_ipv6_address_t).to_string(&value, buffer, sizeof(buffer)) == 2);
+    POOR_MANS_ASSERT(strcmp(buffer, "::") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_035: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv6_address_t) shall copy the 16 bytes at address to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_036: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv6_address_t) shall succeed and return 0. ]*/
+static void log_ipv6_address_t_init_copies_the_address(void)
+{
+    // arrange
+    log_ipv6_address_t value;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(log_ipv6_address_t)(&value, test_ipv6_address);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(memcmp(value.bytes, test_ipv6_address, sizeof(test_ipv6_address)) == 0);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_010: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall fail and return a negative value. ]*/
+static void log_socket_address_t_to_string_with_NULL_property_value_fails(void)
+{
+    // arrange
+    char buffer[64];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_014: [ If buffer is NULL and buffer_length is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall fail and return a negative value. ]*/
+static void log_socket_address_t_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails(void)
+{
+    // arrange
+    struct sockaddr_in socket_address;
+    make_ipv4_socket_address(&socket_address, 8080);
+    log_socket_address_t value;
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t)(&value, &socket_address) == 0);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string(&value, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_011: [ For an AF_INET address, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall produce the dotted decimal form of the address followed by : and the decimal port. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_015: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall write in buffer as many characters of the representation as fit (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_016: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall succeed and return the length of the full representation. ]*/
+static void log_socket_address_t_to_string_with_an_ipv4_address_succeeds(void)
+{
+    // arrange
+    struct sockaddr_in socket_address;
+    make_ipv4_socket_address(&socket_address, 8080);
+    log_socket_address_t value;
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t)(&value, &socket_address) == 0);
+    char buffer[LOG_SOCKET_ADDRESS_TO_STRING_MAX_LENGTH + 1];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string(&value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 17);
+    POOR_MANS_ASSERT(strcmp(buffer, "192.168.1.42:8080") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_012: [ For an AF_INET6 address, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall produce [, the RFC 5952 form of the address, % and the decimal scope id if the scope id is not 0, ]: and the decimal port. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_016: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall succeed and return the length of the full representation. ]*/
+static void log_socket_address_t_to_string_with_an_ipv6_address_succeeds(void)
+{
+    // arrange
+    struct sockaddr_in6 socket_address;
+    make_ipv6_socket_address(&socket_address, test_ipv6_address, 443, 0);
+    log_socket_address_t value;
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t)(&value, &socket_address) == 0);
+    char buffer[LOG_SOCKET_ADDRESS_TO_STRING_MAX_LENGTH + 1];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string(&value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 17);
+    POOR_MANS_ASSERT(strcmp(buffer, "[2001:db8::1]:443") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_012: [ For an AF_INET6 address, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall produce [, the RFC 5952 form of the address, % and the decimal scope id if the scope id is not 0, ]: and the decimal port. ]*/
+static void log_socket_address_t_to_string_with_an_ipv6_address_with_scope_id_succeeds(void)
+{
+    // arrange
+    struct sockaddr_in6 socket_address;
+    make_ipv6_socket_address(&socket_address, test_link_local_ipv6_address, 65535, 3);
+    log_socket_address_t value;
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t)(&value, &socket_address) == 0);
+    char buffer[LOG_SOCKET_ADDRESS_TO_STRING_MAX_LENGTH + 1];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string(&value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 17);
+    POOR_MANS_ASSERT(strcmp(buffer, "[fe80::1%3]:65535") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_012: [ For an AF_INET6 address, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall produce [, the RFC 5952 form of the address, % and the decimal scope id if the scope id is not 0, ]: and the decimal port. ]*/
+static void log_socket_address_t_to_string_with_the_longest_ipv6_address_succeeds(void)
+{
+    // arrange
+    static const uint8_t all_ones[16] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    struct sockaddr_in6 socket_address;
+    make_ipv6_socket_address(&socket_address, all_ones, 65535, UINT32_MAX);
+    log_socket_address_t value;
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t)(&value, &socket_address) == 0);
+    char buffer[LOG_SOCKET_ADDRESS_TO_STRING_MAX_LENGTH + 1];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string(&value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_SOCKET_ADDRESS_TO_STRING_MAX_LENGTH);
+    POOR_MANS_ASSERT(strcmp(buffer, "[ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff%4294967295]:65535") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_015: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall write in buffer as many characters of the representation as fit (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_016: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall succeed and return the length of the full representation. ]*/
+static void log_socket_address_t_to_string_truncates_for_all_buffer_lengths(void)
+{
+    // arrange
+    static const char expected[] = "[2001:db8::1]:443";
+    struct sockaddr_in6 socket_address;
+    make_ipv6_socket_address(&socket_address, test_ipv6_address, 443, 0);
+    log_socket_address_t value;
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t)(&value, &socket_address) == 0);
+    char buffer[sizeof(expected) + 1];
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string(&value, NULL, 0) == (int)sizeof(expected) - 1);
+    for (size_t buffer_length = 1; buffer_length < sizeof(expected); buffer_length++)
+    {
+        (void)memset(buffer, 'x', sizeof(buffer));
+        POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string(&value, buffer, buffer_length) == (int)sizeof(expected) - 1);
+        POOR_MANS_ASSERT(strlen(buffer) == buffer_length - 1);
+        POOR_MANS_ASSERT(strncmp(buffer, expected, buffer_length - 1) == 0);
+        POOR_MANS_ASSERT(buffer[buffer_length] == 'x');
+    }
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_037: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t) shall fail and return a non-zero value. ]*/
+static void log_socket_address_t_init_with_NULL_dst_value_fails(void)
+{
+    // arrange
+    struct sockaddr_in socket_address;
+    make_ipv4_socket_address(&socket_address, 8080);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t)(NULL, &socket_address);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_038: [ If socket_address is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t) shall store an empty socket address (length 0) in dst_value and fail and return a non-zero value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_013: [ If the stored socket address is empty, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string shall produce an empty string. ]*/
+static void log_socket_address_t_init_with_NULL_socket_address_stores_an_empty_socket_address_and_fails(void)
+{
+    // arrange
+    log_socket_address_t value;
+    (void)memset(&value, 0xAA, sizeof(value));
+    char buffer[8] = "xxxxxxx";
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t)(&value, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(value.length == 0);
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_socket_address_t).to_string(&value, buffer, sizeof(buffer)) == 0);
+    POOR_MANS_ASSERT(buffer[0] == '\0');
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_039: [ If the address family of socket_address is AF_INET, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t) shall store in dst_value sizeof(struct sockaddr_in) as length, followed by the bytes of the sockaddr_in at socket_address. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_041: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t) shall succeed and return 0. ]*/
+static void log_socket_address_t_init_with_an_ipv4_address_copies_the_sockaddr_in(void)
+{
+    // arrange
+    struct sockaddr_in socket_address;
+    make_ipv4_socket_address(&socket_address, 8080);
+    log_socket_address_t value;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t)(&value, &socket_address);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(value.length == sizeof(struct sockaddr_in));
+    POOR_MANS_ASSERT(memcmp(value.bytes, &socket_address, sizeof(struct sockaddr_in)) == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_040: [ If the address family of socket_address is AF_INET6, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t) shall store in dst_value sizeof(struct sockaddr_in6) as length, followed by the bytes of the sockaddr_in6 at socket_address. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_041: [ LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t) shall succeed and return 0. ]*/
+static void log_socket_address_t_init_with_an_ipv6_address_copies_the_sockaddr_in6(void)
+{
+    // arrange
+    struct sockaddr_in6 socket_address;
+    make_ipv6_socket_address(&socket_address, test_ipv6_address, 443, 0);
+    log_socket_address_t value;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t)(&value, &socket_address);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(value.length == sizeof(struct sockaddr_in6));
+    POOR_MANS_ASSERT(memcmp(value.bytes, &socket_address, sizeof(struct sockaddr_in6)) == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_042: [ If the address family of socket_address is any other value, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t) shall store an empty socket address (length 0) in dst_value and fail and return a non-zero value. ]*/
+static void log_socket_address_t_init_with_an_unsupported_address_family_stores_an_empty_socket_address_and_fails(void)
+{
+    // arrange
+    struct sockaddr_in socket_address;
+    make_ipv4_socket_address(&socket_address, 8080);
+    socket_address.sin_family = AF_UNSPEC;
+    log_socket_address_t value;
+    (void)memset(&value, 0xAA, sizeof(value));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_INIT(log_socket_address_t)(&value, &socket_address);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(value.length == 0);
+}
+
+/* copy, free, get_type, type_tag and LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_017: [ If dst_value is NULL, the copy function of each identifier type shall fail and return a non-zero value. ]*/
+static void copy_with_NULL_dst_value_fails(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+        log_socket_address_t source;
+        (void)memset(&source, 0, sizeof(source));
+
+        // act
+        int result = identifier_types[i].type_if->copy(NULL, &source);
+
+        // assert
+        POOR_MANS_ASSERT(result != 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_018: [ If src_value is NULL, the copy function of each identifier type shall fail and return a non-zero value. ]*/
+static void copy_with_NULL_src_value_fails(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+        log_socket_address_t destination;
+
+        // act
+        int result = identifier_types[i].type_if->copy(&destination, NULL);
+
+        // assert
+        POOR_MANS_ASSERT(result != 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_019: [ The copy function of each identifier type shall copy the sizeof(type) bytes of the value from src_value to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_020: [ The copy function of each identifier type shall succeed and return 0. ]*/
+static void copy_succeeds(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+        uint8_t source[sizeof(log_socket_address_t)];
+        uint8_t destination[sizeof(log_socket_address_t) + 1];
+        for (size_t j = 0; j < sizeof(source); j++)
+        {
+            source[j] = (uint8_t)(j + 1);
+        }
+        (void)memset(destination, 0xAA, sizeof(destination));
+
+        // act
+        int result = identifier_types[i].type_if->copy(destination, source);
+
+        // assert
+        POOR_MANS_ASSERT(result == 0);
+        POOR_MANS_ASSERT(memcmp(destination, source, identifier_types[i].size) == 0);
+        POOR_MANS_ASSERT(destination[identifier_types[i].size] == 0xAA);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_021: [ The free function of each identifier type shall return. ]*/
+static void free_returns(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+        log_socket_address_t value;
+
+        // act
+        identifier_types[i].type_if->free(&value);
+
+        // assert
+        // no explicit assert
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_022: [ The get_type function of each identifier type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_{type}. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_024: [ The type_tag of each identifier type shall be the property type LOG_CONTEXT_PROPERTY_TYPE_{type}. ]*/
+static void get_type_and_type_tag_return_the_type(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+
+        // act
+        LOG_CONTEXT_PROPERTY_TYPE result = identifier_types[i].type_if->get_type();
+
+        // assert
+        POOR_MANS_ASSERT(result == identifier_types[i].type);
+        POOR_MANS_ASSERT(identifier_types[i].type_if->type_tag == identifier_types[i].type);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_023: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE of each identifier type shall return sizeof(type). ]*/
+static void get_init_data_size_returns_the_size_of_the_type(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+
+        // act
+        int result = identifier_types[i].get_init_data_size();
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)identifier_types[i].size);
+    }
+}
+
+/* get_size, serialize and deserialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_043: [ If property_value is NULL, the get_size function of each identifier type shall fail and return a negative value. ]*/
+static void get_size_with_NULL_value_fails(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+
+        // act
+        int result = identifier_types[i].type_if->get_size(NULL);
+
+        // assert
+        POOR_MANS_ASSERT(result < 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_044: [ Otherwise the get_size function of each identifier type shall return sizeof(type). ]*/
+static void get_size_returns_the_size_of_the_value(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+        log_socket_address_t value;
+        (void)memset(&value, 0x5A, sizeof(value));
+
+        // act
+        int result = identifier_types[i].type_if->get_size(&value);
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)identifier_types[i].size);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_045: [ If property_value is NULL, the serialize function of each identifier type shall fail and return a negative value. ]*/
+static void serialize_with_NULL_value_fails(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+        unsigned char buffer[sizeof(log_socket_address_t)];
+
+        // act
+        int result = identifier_types[i].type_if->serialize(NULL, buffer, sizeof(buffer));
+
+        // assert
+        POOR_MANS_ASSERT(result < 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_046: [ If buffer is NULL and buffer_size is greater than 0, the serialize function of each identifier type shall fail and return a negative value. ]*/
+static void serialize_with_NULL_buffer_and_non_zero_buffer_size_fails(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+        log_socket_address_t value;
+        (void)memset(&value, 0x5A, sizeof(value));
+
+        // act
+        int result = identifier_types[i].type_if->serialize(&value, NULL, 1);
+
+        // assert
+        POOR_MANS_ASSERT(result < 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_048: [ The serialize function of each identifier type shall succeed and return sizeof(type). ]*/
+static void serialize_with_NULL_buffer_returns_the_size(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+        log_socket_address_t value;
+        (void)memset(&value, 0x5A, sizeof(value));
+
+        // act
+        int result = identifier_types[i].type_if->serialize(&value, NULL, 0);
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)identifier_types[i].size);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_047: [ If sizeof(type) bytes fit in buffer_size, the serialize function of each identifier type shall copy the bytes of the value from property_value to buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_048: [ The serialize function of each identifier type shall succeed and return sizeof(type). ]*/
+static void serialize_succeeds(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+        log_socket_address_t value;
+        (void)memset(&value, 0x5A, sizeof(value));
+        unsigned char buffer[sizeof(log_socket_address_t) + 1];
+        (void)memset(buffer, 0xAA, sizeof(buffer));
+
+        // act
+        int result = identifier_types[i].type_if->serialize(&value, buffer, sizeof(buffer));
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)identifier_types[i].size);
+        POOR_MANS_ASSERT(memcmp(buffer, &value, identifier_types[i].size) == 0);
+        POOR_MANS_ASSERT(buffer[identifier_types[i].size] == 0xAA);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_047: [ If sizeof(type) bytes fit in buffer_size, the serialize function of each identifier type shall copy the bytes of the value from property_value to buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_048: [ The serialize function of each identifier type shall succeed and return sizeof(type). ]*/
+static void serialize_with_too_small_buffer_only_returns_the_size(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+        log_socket_address_t value;
+        (void)memset(&value, 0x5A, sizeof(value));
+        unsigned char buffer[sizeof(log_socket_address_t)];
+        (void)memset(buffer, 0xAA, sizeof(buffer));
+
+        // act
+        int result = identifier_types[i].type_if->serialize(&value, buffer, identifier_types[i].size - 1);
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)identifier_types[i].size);
+        POOR_MANS_ASSERT(buffer[0] == 0xAA);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_049: [ If dst_value is NULL and dst_size is greater than 0, the deserialize function of each identifier type shall fail and return a negative value. ]*/
+static void deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+        log_socket_address_t value;
+        (void)memset(&value, 0x5A, sizeof(value));
+
+        // act
+        int result = identifier_types[i].type_if->deserialize(NULL, identifier_types[i].size, &value, identifier_types[i].size);
+
+        // assert
+        POOR_MANS_ASSERT(result < 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_050: [ If buffer is NULL, the deserialize function of each identifier type shall fail and return a negative value. ]*/
+static void deserialize_with_NULL_buffer_fails(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+        log_socket_address_t deserialized;
+
+        // act
+        int result = identifier_types[i].type_if->deserialize(&deserialized, sizeof(deserialized), NULL, identifier_types[i].size);
+
+        // assert
+        POOR_MANS_ASSERT(result < 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_051: [ If buffer_size is not sizeof(type), the deserialize function of each identifier type shall fail and return a negative value. ]*/
+static void deserialize_with_wrong_buffer_size_fails(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+        unsigned char buffer[sizeof(log_socket_address_t) + 1] = { 0 };
+        log_socket_address_t deserialized;
+
+        // act
+        int result_1 = identifier_types[i].type_if->deserialize(&deserialized, sizeof(deserialized), buffer, identifier_types[i].size - 1);
+        int result_2 = identifier_types[i].type_if->deserialize(&deserialized, sizeof(deserialized), buffer, identifier_types[i].size + 1);
+
+        // assert
+        POOR_MANS_ASSERT(result_1 < 0);
+        POOR_MANS_ASSERT(result_2 < 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_052: [ If sizeof(type) bytes fit in dst_size, the deserialize function of each identifier type shall copy the bytes of the value from buffer to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_053: [ The deserialize function of each identifier type shall succeed and return sizeof(type). ]*/
+static void deserialize_of_serialized_value_succeeds(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+        log_socket_address_t value;
+        (void)memset(&value, 0x5A, sizeof(value));
+        log_socket_address_t deserialized;
+        unsigned char buffer[sizeof(log_socket_address_t)];
+        POOR_MANS_ASSERT(identifier_types[i].type_if->serialize(&value, buffer, sizeof(buffer)) == (int)identifier_types[i].size);
+        (void)memset(&deserialized, 0, sizeof(deserialized));
+
+        // act
+        int result = identifier_types[i].type_if->deserialize(&deserialized, sizeof(deserialized), buffer, identifier_types[i].size);
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)identifier_types[i].size);
+        POOR_MANS_ASSERT(memcmp(&deserialized, &value, identifier_types[i].size) == 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IDENTIFIERS_01_053: [ The deserialize function of each identifier type shall succeed and return sizeof(type). ]*/
+static void deserialize_with_NULL_dst_value_returns_the_size(void)
+{
+    for (size_t i = 0; i < IDENTIFIER_TYPE_COUNT; i++)
+    {
+        // arrange
+        log_socket_address_t value;
+        (void)memset(&value, 0x5A, sizeof(value));
+
+        // act
+        int result = identifier_types[i].type_if->deserialize(NULL, 0, &value, identifier_types[i].size);
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)identifier_types[i].size);
+    }
+}
+
+int main(void)
+{
+    log_uuid_t_to_string_with_NULL_property_value_fails();
+    log_uuid_t_to_string_succeeds();
+    log_uuid_t_to_string_truncates();
+    log_uuid_t_init_with_NULL_dst_value_fails();
+    log_uuid_t_init_with_NULL_uuid_stores_the_nil_uuid_and_fails();
+    log_uuid_t_init_stores_the_guid_layout();
+
+    log_ipv4_address_t_to_string_with_NULL_property_value_fails();
+    log_ipv4_address_t_to_string_succeeds();
+    log_ipv4_address_t_init_with_NULL_dst_value_fails();
+    log_ipv4_address_t_init_with_NULL_address_stores_0_0_0_0_and_fails();
+    log_ipv4_address_t_init_copies_the_address();
+
+    log_ipv6_address_t_to_string_with_NULL_property_value_fails();
+    log_ipv6_address_t_to_string_succeeds();
+    log_ipv6_address_t_init_with_NULL_dst_value_fails();
+    log_ipv6_address_t_init_with_NULL_address_stores_the_unspecified_address_and_fails();
+    log_ipv6_address_t_init_copies_the_address();
+
+    log_socket_address_t_to_string_with_NULL_property_value_fails();
+    log_socket_address_t_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails();
+    log_socket_address_t_to_string_with_an_ipv4_address_succeeds();
+    log_socket_address_t_to_string_with_an_ipv6_address_succeeds();
+    log_socket_address_t_to_string_with_an_ipv6_address_with_scope_id_succeeds();
+    log_socket_address_t_to_string_with_the_longest_ipv6_address_succeeds();
+    log_socket_address_t_to_string_truncates_for_all_buffer_lengths();
+    log_socket_address_t_init_with_NULL_dst_value_fails();
+    log_socket_address_t_init_with_NULL_socket_address_stores_an_empty_socket_address_and_fails();
+    log_socket_address_t_init_with_an_ipv4_address_copies_the_sockaddr_in();
+    log_socket_address_t_init_with_an_ipv6_address_copies_the_sockaddr_in6();
+    log_socket_address_t_init_with_an_unsupported_address_family_stores_an_empty_socket_address_and_fails();
+
+    copy_with_NULL_dst_value_fails();
+    copy_with_NULL_src_value_fails();
+    copy_succeeds();
+    free_returns();
+    get_type_and_type_tag_return_the_type();
+    get_init_data_size_returns_the_size_of_the_type();
+
+    get_size_with_NULL_value_fails();
+    get_size_returns_the_size_of_the_value();
+    serialize_with_NULL_value_fails();
+    serialize_with_NULL_buffer_and_non_zero_buffer_size_fails();
+    serialize_with_NULL_buffer_returns_the_size();
+    serialize_succeeds();
+    serialize_with_too_small_buffer_only_returns_the_size();
+    deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    deserialize_with_NULL_buffer_fails();
+    deserialize_with_wrong_buffer_size_fails();
+    deserialize_of_serialized_value_succeeds();
+    deserialize_with_NULL_dst_value_returns_the_size();
+
+    return 0;
+}
@@ -66,12 +66,27 @@ static void LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_produces_the_correct_to
     POOR_MANS_ASSERT(strcmp(result, "gogu_log_context_property_type_get_init_data_size") == 0);
 }
 
+/* LOG_CONTEXT_PROPERTY_TYPE_FILL(type_name) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_IF_01_004: [ LOG_CONTEXT_PROPERTY_TYPE_FILL(type_name) shall produce the token {type_name}_log_context_property_type_fill. ]*/
+static void LOG_CONTEXT_PROPERTY_TYPE_FILL_produces_the_correct_token(void)
+{
+    // arrange
+
+    // act
+    const char* result = MU_TOSTRING(LOG_CONTEXT_PROPERTY_TYPE_FILL(gogu));
+
+    // assert
+    POOR_MANS_ASSERT(strcmp(result, "gogu_log_context_property_type_fill") == 0);
+}
+
 /* very "poor man's" way of testing, as no test harness and mocking framework are available */
 int main(void)
 {
     LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL_produces_the_correct_token();
     LOG_CONTEXT_PROPERTY_TYPE_INIT_produces_the_correct_token();
     LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_produces_the_correct_token();
+    LOG_CONTEXT_PROPERTY_TYPE_FILL_produces_the_correct_token();
 
     return 0;
 }
@@ -174,6 +174,20 @@ static void struct_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_struct(void)
     POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_struct);
 }
 
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_016: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_struct. ]*/
+static void struct_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_struct(void)
+{
+    // arrange
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).type_tag;
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_struct);
+}
+
 /* LOG_CONTEXT_PROPERTY_TYPE_INIT(struct) */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_011: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(struct) shall fail and return a non-zero value. ]*/
@@ -217,6 +231,185 @@ static void struct_get_init_data_size_returns_1(void)
     POOR_MANS_ASSERT(result == sizeof(uint8_t));
 }
 
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).get_size */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_017: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).get_size shall fail and return a negative value. ]*/
+static void struct_get_size_with_NULL_value_fails(void)
+{
+    // arrange
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).get_size(NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_018: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).get_size shall return sizeof(uint8_t). ]*/
+static void struct_get_size_returns_the_size_of_the_value(void)
+{
+    // arrange
+    uint8_t value = 3;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).get_size(&value);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(uint8_t));
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_019: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize shall fail and return a negative value. ]*/
+static void struct_serialize_with_NULL_value_fails(void)
+{
+    // arrange
+    unsigned char buffer[sizeof(uint8_t)];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_020: [ If buffer is NULL and buffer_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize shall fail and return a negative value. ]*/
+static void struct_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails(void)
+{
+    // arrange
+    uint8_t value = 3;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize(&value, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize shall succeed and return sizeof(uint8_t). ]*/
+static void struct_serialize_with_NULL_buffer_returns_the_size(void)
+{
+    // arrange
+    uint8_t value = 3;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize(&value, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(uint8_t));
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_021: [ If sizeof(uint8_t) bytes fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize shall copy the bytes of the field count from property_value to buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize shall succeed and return sizeof(uint8_t). ]*/
+static void struct_serialize_succeeds(void)
+{
+    // arrange
+    uint8_t value = 3;
+    unsigned char buffer[sizeof(uint8_t) + 1];
+    (void)memset(buffer, 0xAA, sizeof(buffer));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize(&value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(uint8_t));
+    POOR_MANS_ASSERT(memcmp(buffer, &value, sizeof(uint8_t)) == 0);
+    POOR_MANS_ASSERT(buffer[sizeof(uint8_t)] == 0xAA);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_021: [ If sizeof(uint8_t) bytes fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize shall copy the bytes of the field count from property_value to buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_022: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize shall succeed and return sizeof(uint8_t). ]*/
+static void struct_serialize_with_too_small_buffer_only_returns_the_size(void)
+{
+    // arrange
+    uint8_t value = 3;
+    unsigned char buffer[sizeof(uint8_t)];
+    (void)memset(buffer, 0xAA, sizeof(buffer));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize(&value, buffer, sizeof(buffer) - 1);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(uint8_t));
+    POOR_MANS_ASSERT(buffer[0] == 0xAA);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_023: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize shall fail and return a negative value. ]*/
+static void struct_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    // arrange
+    uint8_t value = 3;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize(NULL, sizeof(uint8_t), &value, sizeof(uint8_t));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_024: [ If buffer is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize shall fail and return a negative value. ]*/
+static void struct_deserialize_with_NULL_buffer_fails(void)
+{
+    // arrange
+    uint8_t deserialized;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize(&deserialized, sizeof(deserialized), NULL, sizeof(uint8_t));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_025: [ If buffer_size is not sizeof(uint8_t), LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize shall fail and return a negative value. ]*/
+static void struct_deserialize_with_wrong_buffer_size_fails(void)
+{
+    // arrange
+    unsigned char buffer[sizeof(uint8_t) + 1] = { 0 };
+    uint8_t deserialized;
+
+    // act
+    int result_1 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize(&deserialized, sizeof(deserialized), buffer, sizeof(uint8_t) - 1);
+    int result_2 = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize(&deserialized, sizeof(deserialized), buffer, sizeof(uint8_t) + 1);
+
+    // assert
+    POOR_MANS_ASSERT(result_1 < 0);
+    POOR_MANS_ASSERT(result_2 < 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_026: [ If sizeof(uint8_t) bytes fit in dst_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize shall copy the bytes of the field count from buffer to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_027: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize shall succeed and return sizeof(uint8_t). ]*/
+static void struct_deserialize_of_serialized_value_succeeds(void)
+{
+    // arrange
+    uint8_t value = 3;
+    uint8_t deserialized;
+    unsigned char buffer[sizeof(uint8_t)];
+    POOR_MANS_ASSERT(LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).serialize(&value, buffer, sizeof(buffer)) == (int)sizeof(uint8_t));
+    (void)memset(&deserialized, 0, sizeof(deserialized));
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize(&deserialized, sizeof(deserialized), buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(uint8_t));
+    POOR_MANS_ASSERT(memcmp(&deserialized, &value, sizeof(uint8_t)) == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_STRUCT_01_027: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize shall succeed and return sizeof(uint8_t). ]*/
+static void struct_deserialize_with_NULL_dst_value_returns_the_size(void)
+{
+    // arrange
+    uint8_t value = 3;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(struct).deserialize(NULL, 0, &value, sizeof(value));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(uint8_t));
+}
+
 /* very "poor man's" way of testing, as no test harness and mocking framework are available */
 int main(void)
 {
@@ -233,6 +426,20 @@ int main(void)
     struct_free_returns();
 
     struct_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_struct();
+    struct_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_struct();
+
+    struct_get_size_with_NULL_value_fails();
+    struct_get_size_returns_the_size_of_the_value();
+    struct_serialize_with_NULL_value_fails();
+    struct_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails();
+    struct_serialize_with_NULL_buffer_returns_the_size();
+    struct_serialize_succeeds();
+    struct_serialize_with_too_small_buffer_only_returns_the_size();
+    struct_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    struct_deserialize_with_NULL_buffer_fails();
+    struct_deserialize_with_wrong_buffer_size_fails();
+    struct_deserialize_of_serialized_value_succeeds();
+    struct_deserialize_with_NULL_dst_value_returns_the_size();
 
     struct_init_with_NULL_dst_value_fails();
     struct_init_succeeds();
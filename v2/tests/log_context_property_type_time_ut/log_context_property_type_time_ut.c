@@ -0,0 +1,530 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+
+#include "c_logging/log_context_property_type_time.h"
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+typedef struct TIME_TYPE_TAG
+{
+    const LOG_CONTEXT_PROPERTY_TYPE_IF* type_if;
+    LOG_CONTEXT_PROPERTY_TYPE type;
+    int (*init)(void* dst_value, int64_t value);
+    int (*get_init_data_size)(void);
+} TIME_TYPE;
+
+static const TIME_TYPE time_types[] =
+{
+    { &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_timestamp_t), LOG_CONTEXT_PROPERTY_TYPE_log_timestamp_t, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_timestamp_t), LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(log_timestamp_t) },
+    { &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_duration_t), LOG_CONTEXT_PROPERTY_TYPE_log_duration_t, LOG_CONTEXT_PROPERTY_TYPE_INIT(log_duration_t), LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(log_duration_t) },
+};
+
+#define TIME_TYPE_COUNT (sizeof(time_types) / sizeof(time_types[0]))
+
+/* log_timestamp_from_timespec */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_001: [ If ts is NULL, log_timestamp_from_timespec shall return 0. ]*/
+static void log_timestamp_from_timespec_with_NULL_ts_returns_0(void)
+{
+    // arrange
+
+    // act
+    log_timestamp_t result = log_timestamp_from_timespec(NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_002: [ log_timestamp_from_timespec shall return ts->tv_sec * 1000000000 + ts->tv_nsec. ]*/
+static void log_timestamp_from_timespec_returns_the_nanoseconds(void)
+{
+    // arrange
+    struct timespec ts;
+    ts.tv_sec = 1792353646;
+    ts.tv_nsec = 123456789;
+
+    // act
+    log_timestamp_t result = log_timestamp_from_timespec(&ts);
+
+    // assert
+    POOR_MANS_ASSERT(result == INT64_C(1792353646123456789));
+}
+
+/* to_string */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_003: [ If property_value is NULL, the to_string function of each time type shall fail and return a negative value. ]*/
+static void to_string_with_NULL_property_value_fails(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        char buffer[64];
+
+        // act
+        int result = time_types[i].type_if->to_string(NULL, buffer, sizeof(buffer));
+
+        // assert
+        POOR_MANS_ASSERT(result < 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_004: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_timestamp_t).to_string shall produce the ISO 8601 form of the value by calling timestamp_to_string with buffer and buffer_length and return its result. ]*/
+static void log_timestamp_t_to_string_succeeds(void)
+{
+    // arrange
+    log_timestamp_t value = INT64_C(1792353646123456789);
+    char buffer[64];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_timestamp_t).to_string(&value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 30);
+    POOR_MANS_ASSERT(strcmp(buffer, "2026-10-18T20:00:46.123456789Z") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_004: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_timestamp_t).to_string shall produce the ISO 8601 form of the value by calling timestamp_to_string with buffer and buffer_length and return its result. ]*/
+static void log_timestamp_t_to_string_truncates(void)
+{
+    // arrange
+    log_timestamp_t value = INT64_C(1792353646123456789);
+    char buffer[11];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_timestamp_t).to_string(&value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 30);
+    POOR_MANS_ASSERT(strcmp(buffer, "2026-10-18") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_005: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_duration_t).to_string shall produce the text form of the value by calling duration_to_string with buffer and buffer_length and return its result. ]*/
+static void log_duration_t_to_string_succeeds(void)
+{
+    // arrange
+    log_duration_t value = INT64_C(3723456789012);
+    char buffer[64];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_duration_t).to_string(&value, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 12);
+    POOR_MANS_ASSERT(strcmp(buffer, "1h02m03.456s") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_005: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_duration_t).to_string shall produce the text form of the value by calling duration_to_string with buffer and buffer_length and return its result. ]*/
+static void log_duration_t_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length(void)
+{
+    // arrange
+    log_duration_t value = 12345;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(log_duration_t).to_string(&value, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == 8); // 12.345us
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_INIT */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_006: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT of each time type shall fail and return a non-zero value. ]*/
+static void init_with_NULL_dst_value_fails(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+
+        // act
+        int result = time_types[i].init(NULL, 42);
+
+        // assert
+        POOR_MANS_ASSERT(result != 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_007: [ LOG_CONTEXT_PROPERTY_TYPE_INIT of each time type shall store the 64 bit value in dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_008: [ LOG_CONTEXT_PROPERTY_TYPE_INIT of each time type shall succeed and return 0. ]*/
+static void init_stores_the_value(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        int64_t destination[2] = { 0, 0 };
+
+        // act
+        int result = time_types[i].init(destination, INT64_MIN);
+
+        // assert
+        POOR_MANS_ASSERT(result == 0);
+        POOR_MANS_ASSERT(destination[0] == INT64_MIN);
+        POOR_MANS_ASSERT(destination[1] == 0);
+    }
+}
+
+/* copy, free, get_type, type_tag and LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_009: [ If dst_value is NULL, the copy function of each time type shall fail and return a non-zero value. ]*/
+static void copy_with_NULL_dst_value_fails(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        int64_t source = 42;
+
+        // act
+        int result = time_types[i].type_if->copy(NULL, &source);
+
+        // assert
+        POOR_MANS_ASSERT(result != 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_010: [ If src_value is NULL, the copy function of each time type shall fail and return a non-zero value. ]*/
+static void copy_with_NULL_src_value_fails(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        int64_t destination;
+
+        // act
+        int result = time_types[i].type_if->copy(&destination, NULL);
+
+        // assert
+        POOR_MANS_ASSERT(result != 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_011: [ The copy function of each time type shall copy the 64 bit value from src_value to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_012: [ The copy function of each time type shall succeed and return 0. ]*/
+static void copy_succeeds(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        int64_t source = INT64_C(0x0102030405060708);
+        int64_t destination[2] = { 0, 0 };
+
+        // act
+        int result = time_types[i].type_if->copy(destination, &source);
+
+        // assert
+        POOR_MANS_ASSERT(result == 0);
+        POOR_MANS_ASSERT(destination[0] == INT64_C(0x0102030405060708));
+        POOR_MANS_ASSERT(destination[1] == 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_013: [ The free function of each time type shall return. ]*/
+static void free_returns(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        int64_t value = 42;
+
+        // act
+        time_types[i].type_if->free(&value);
+
+        // assert
+        // no explicit assert
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_014: [ The get_type function of each time type shall return the property type LOG_CONTEXT_PROPERTY_TYPE_{type}. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_016: [ The type_tag of each time type shall be the property type LOG_CONTEXT_PROPERTY_TYPE_{type}. ]*/
+static void get_type_and_type_tag_return_the_type(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+
+        // act
+        LOG_CONTEXT_PROPERTY_TYPE result = time_types[i].type_if->get_type();
+
+        // assert
+        POOR_MANS_ASSERT(result == time_types[i].type);
+        POOR_MANS_ASSERT(time_types[i].type_if->type_tag == time_types[i].type);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_015: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE of each time type shall return sizeof(int64_t). ]*/
+static void get_init_data_size_returns_the_size_of_int64_t(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+
+        // act
+        int result = time_types[i].get_init_data_size();
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)sizeof(int64_t));
+    }
+}
+
+/* get_size, serialize and deserialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_017: [ If property_value is NULL, the get_size function of each time type shall fail and return a negative value. ]*/
+static void get_size_with_NULL_value_fails(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+
+        // act
+        int result = time_types[i].type_if->get_size(NULL);
+
+        // assert
+        POOR_MANS_ASSERT(result < 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_018: [ Otherwise the get_size function of each time type shall return sizeof(int64_t). ]*/
+static void get_size_returns_the_size_of_the_value(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        int64_t value = INT64_C(0x0102030405060708);
+
+        // act
+        int result = time_types[i].type_if->get_size(&value);
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)sizeof(int64_t));
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_019: [ If property_value is NULL, the serialize function of each time type shall fail and return a negative value. ]*/
+static void serialize_with_NULL_value_fails(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        unsigned char buffer[sizeof(int64_t)];
+
+        // act
+        int result = time_types[i].type_if->serialize(NULL, buffer, sizeof(buffer));
+
+        // assert
+        POOR_MANS_ASSERT(result < 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_020: [ If buffer is NULL and buffer_size is greater than 0, the serialize function of each time type shall fail and return a negative value. ]*/
+static void serialize_with_NULL_buffer_and_non_zero_buffer_size_fails(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        int64_t value = INT64_C(0x0102030405060708);
+
+        // act
+        int result = time_types[i].type_if->serialize(&value, NULL, 1);
+
+        // assert
+        POOR_MANS_ASSERT(result < 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_022: [ The serialize function of each time type shall succeed and return sizeof(int64_t). ]*/
+static void serialize_with_NULL_buffer_returns_the_size(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        int64_t value = INT64_C(0x0102030405060708);
+
+        // act
+        int result = time_types[i].type_if->serialize(&value, NULL, 0);
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)sizeof(int64_t));
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_021: [ If sizeof(int64_t) bytes fit in buffer_size, the serialize function of each time type shall copy the bytes of the 64 bit value from property_value to buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_022: [ The serialize function of each time type shall succeed and return sizeof(int64_t). ]*/
+static void serialize_succeeds(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        int64_t value = INT64_C(0x0102030405060708);
+        unsigned char buffer[sizeof(int64_t) + 1];
+        (void)memset(buffer, 0xAA, sizeof(buffer));
+
+        // act
+        int result = time_types[i].type_if->serialize(&value, buffer, sizeof(buffer));
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)sizeof(int64_t));
+        POOR_MANS_ASSERT(memcmp(buffer, &value, sizeof(int64_t)) == 0);
+        POOR_MANS_ASSERT(buffer[sizeof(int64_t)] == 0xAA);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_021: [ If sizeof(int64_t) bytes fit in buffer_size, the serialize function of each time type shall copy the bytes of the 64 bit value from property_value to buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_022: [ The serialize function of each time type shall succeed and return sizeof(int64_t). ]*/
+static void serialize_with_too_small_buffer_only_returns_the_size(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        int64_t value = INT64_C(0x0102030405060708);
+        unsigned char buffer[sizeof(int64_t)];
+        (void)memset(buffer, 0xAA, sizeof(buffer));
+
+        // act
+        int result = time_types[i].type_if->serialize(&value, buffer, sizeof(buffer) - 1);
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)sizeof(int64_t));
+        POOR_MANS_ASSERT(buffer[0] == 0xAA);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_023: [ If dst_value is NULL and dst_size is greater than 0, the deserialize function of each time type shall fail and return a negative value. ]*/
+static void deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        int64_t value = INT64_C(0x0102030405060708);
+
+        // act
+        int result = time_types[i].type_if->deserialize(NULL, sizeof(int64_t), &value, sizeof(int64_t));
+
+        // assert
+        POOR_MANS_ASSERT(result < 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_024: [ If buffer is NULL, the deserialize function of each time type shall fail and return a negative value. ]*/
+static void deserialize_with_NULL_buffer_fails(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        int64_t deserialized;
+
+        // act
+        int result = time_types[i].type_if->deserialize(&deserialized, sizeof(deserialized), NULL, sizeof(int64_t));
+
+        // assert
+        POOR_MANS_ASSERT(result < 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_025: [ If buffer_size is not sizeof(int64_t), the deserialize function of each time type shall fail and return a negative value. ]*/
+static void deserialize_with_wrong_buffer_size_fails(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        unsigned char buffer[sizeof(int64_t) + 1] = { 0 };
+        int64_t deserialized;
+
+        // act
+        int result_1 = time_types[i].type_if->deserialize(&deserialized, sizeof(deserialized), buffer, sizeof(int64_t) - 1);
+        int result_2 = time_types[i].type_if->deserialize(&deserialized, sizeof(deserialized), buffer, sizeof(int64_t) + 1);
+
+        // assert
+        POOR_MANS_ASSERT(result_1 < 0);
+        POOR_MANS_ASSERT(result_2 < 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_026: [ If sizeof(int64_t) bytes fit in dst_size, the deserialize function of each time type shall copy the bytes of the 64 bit value from buffer to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_027: [ The deserialize function of each time type shall succeed and return sizeof(int64_t). ]*/
+static void deserialize_of_serialized_value_succeeds(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        int64_t value = INT64_C(0x0102030405060708);
+        int64_t deserialized;
+        unsigned char buffer[sizeof(int64_t)];
+        POOR_MANS_ASSERT(time_types[i].type_if->serialize(&value, buffer, sizeof(buffer)) == (int)sizeof(int64_t));
+        (void)memset(&deserialized, 0, sizeof(deserialized));
+
+        // act
+        int result = time_types[i].type_if->deserialize(&deserialized, sizeof(deserialized), buffer, sizeof(buffer));
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)sizeof(int64_t));
+        POOR_MANS_ASSERT(memcmp(&deserialized, &value, sizeof(int64_t)) == 0);
+    }
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_TIME_01_027: [ The deserialize function of each time type shall succeed and return sizeof(int64_t). ]*/
+static void deserialize_with_NULL_dst_value_returns_the_size(void)
+{
+    for (size_t i = 0; i < TIME_TYPE_COUNT; i++)
+    {
+        // arrange
+        int64_t value = INT64_C(0x0102030405060708);
+
+        // act
+        int result = time_types[i].type_if->deserialize(NULL, 0, &value, sizeof(value));
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)sizeof(int64_t));
+    }
+}
+
+int main(void)
+{
+    log_timestamp_from_timespec_with_NULL_ts_returns_0();
+    log_timestamp_from_timespec_returns_the_nanoseconds();
+
+    to_string_with_NULL_property_value_fails();
+    log_timestamp_t_to_string_succeeds();
+    log_timestamp_t_to_string_truncates();
+    log_duration_t_to_string_succeeds();
+    log_duration_t_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length();
+
+    init_with_NULL_dst_value_fails();
+    init_stores_the_value();
+
+    copy_with_NULL_dst_value_fails();
+    copy_with_NULL_src_value_fails();
+    copy_succeeds();
+    free_returns();
+    get_type_and_type_tag_return_the_type();
+    get_init_data_size_returns_the_size_of_int64_t();
+
+    get_size_with_NULL_value_fails();
+    get_size_returns_the_size_of_the_value();
+    serialize_with_NULL_value_fails();
+    serialize_with_NULL_buffer_and_non_zero_buffer_size_fails();
+    serialize_with_NULL_buffer_returns_the_size();
+    serialize_succeeds();
+    serialize_with_too_small_buffer_only_returns_the_size();
+    deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    deserialize_with_NULL_buffer_fails();
+    deserialize_with_wrong_buffer_size_fails();
+    deserialize_of_serialized_value_succeeds();
+    deserialize_with_NULL_dst_value_returns_the_size();
+
+    return 0;
+}
@@ -76,8 +76,21 @@ static void to_string_with_truncation_succeeds(void)
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string(L"bau", buffer, sizeof(buffer));
 
     // assert
-    POOR_MANS_ASSERT(result == 2);
-    POOR_MANS_ASSERT(strncmp(buffer, "ba", 2) == 0);
+    POOR_MANS_ASSERT(result == 3);
+    POOR_MANS_ASSERT(strcmp(buffer, "b") == 0);
+}
+
+static void to_string_converts_non_ASCII_characters_to_UTF8(void)
+{
+    // arrange
+    char buffer[16];
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string(L"b\u00E4u \u20AC", buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 8);
+    POOR_MANS_ASSERT(strcmp(buffer, "b\xC3\xA4u \xE2\x82\xAC") == 0);
 }
 
 /* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).copy */
@@ -234,6 +247,7 @@ int main(void)
     wchar_t_ptr_to_string_with_NULL_buffer_and_zero_buffer_length_returns_string_length();
     wchar_t_ptr_to_string_copies_the_string();
     to_string_with_truncation_succeeds();
+    to_string_converts_non_ASCII_characters_to_UTF8();
 
     wchar_t_ptr_copy_with_NULL_src_value_fails();
     wchar_t_ptr_copy_with_NULL_dst_value_fails();
@@ -5,10 +5,14 @@
 #include <stdlib.h>// IWYU pragma: keep
 #include <wchar.h>
 
-#define wcstombs mock_wcstombs
+#define wchar_to_utf8 mock_wchar_to_utf8
 #define vswprintf mock_vswprintf
+#define malloc mock_malloc
+#define free mock_free
 
-extern size_t mock_wcstombs(char* dest, wchar_t const* src, size_t max);
+extern int mock_wchar_to_utf8(const wchar_t* source, char* buffer, size_t buffer_length);
 extern int mock_vswprintf(wchar_t* s, size_t n, const wchar_t* format, va_list arg_list);
+extern void* mock_malloc(size_t size);
+extern void mock_free(void* ptr);
 
 #include "log_context_property_type_wchar_t_ptr.c"
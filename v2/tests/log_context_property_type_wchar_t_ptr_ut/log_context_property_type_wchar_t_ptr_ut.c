@@ -12,6 +12,7 @@
 
 #include "c_logging/log_context_property_type.h"
 #include "c_logging/log_context_property_type_if.h"
+#include "c_logging/wchar_to_utf8.h"
 
 #include "c_logging/log_context_property_type_wchar_t_ptr.h"
 
@@ -19,33 +20,43 @@
 #define MAX_MOCK_CALL_COUNT (128)
 
 #define MOCK_CALL_TYPE_VALUES \
-    MOCK_CALL_TYPE_wcstombs, \
-    MOCK_CALL_TYPE_vswprintf \
+    MOCK_CALL_TYPE_wchar_to_utf8, \
+    MOCK_CALL_TYPE_vswprintf, \
+    MOCK_CALL_TYPE_malloc, \
+    MOCK_CALL_TYPE_free \
 
 MU_DEFINE_ENUM(MOCK_CALL_TYPE, MOCK_CALL_TYPE_VALUES)
 
 // very poor mans mocks :-(
-typedef struct wcstombs_CALL_TAG
+typedef struct wchar_to_utf8_CALL_TAG
 {
     bool override_result;
     int call_result;
-    const char* format_arg;
-} wcstombs_CALL;
+} wchar_to_utf8_CALL;
 
 typedef struct vswprintf_CALL_TAG
 {
     bool override_result;
     int call_result;
     const wchar_t* format_arg;
+    size_t n_arg;
 } vswprintf_CALL;
 
+typedef struct malloc_CALL_TAG
+{
+    bool override_result;
+    void* call_result;
+    size_t size_arg;
+} malloc_CALL;
+
 typedef struct MOCK_CALL_TAG
 {
     MOCK_CALL_TYPE mock_call_type;
     union
     {
-        wcstombs_CALL wcstombs_call;
+        wchar_to_utf8_CALL wchar_to_utf8_call;
         vswprintf_CALL vswprintf_call;
+        malloc_CALL malloc_call;
     };
 } MOCK_CALL;
 
@@ -54,27 +65,25 @@ static size_t expected_call_count;
 static size_t actual_call_count;
 static bool actual_and_expected_match;
 
-size_t mock_wcstombs(char* dest, const wchar_t* src, size_t max)
+int mock_wchar_to_utf8(const wchar_t* source, char* buffer, size_t buffer_length)
 {
-    size_t result;
+    int result;
 
     if ((actual_call_count == expected_call_count) ||
-        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_wcstombs))
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_wchar_to_utf8))
     {
         actual_and_expected_match = false;
-        return (size_t) - 1;
+        return -1;
     }
     else
     {
-        if (expected_calls[actual_call_count].wcstombs_call.override_result)
+        if (expected_calls[actual_call_count].wchar_to_utf8_call.override_result)
         {
-            result = expected_calls[actual_call_count].wcstombs_call.call_result;
+            result = expected_calls[actual_call_count].wchar_to_utf8_call.call_result;
         }
         else
         {
-
-            result = wcstombs(dest, src, max);
-
+            result = wchar_to_utf8(source, buffer, buffer_length);
         }
 
         actual_call_count++;
@@ -95,6 +104,8 @@ int mock_vswprintf(wchar_t* s, size_t n, const wchar_t* format, va_list arg_list
     }
     else
     {
+        expected_calls[actual_call_count].vswprintf_call.n_arg = n;
+
         if (expected_calls[actual_call_count].vswprintf_call.override_result)
         {
             result = expected_calls[actual_call_count].vswprintf_call.call_result;
@@ -112,6 +123,50 @@ int mock_vswprintf(wchar_t* s, size_t n, const wchar_t* format, va_list arg_list
     return result;
 }
 
+void* mock_malloc(size_t size)
+{
+    void* result;
+
+    if ((actual_call_count == expected_call_count) ||
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_malloc))
+    {
+        actual_and_expected_match = false;
+        return NULL;
+    }
+    else
+    {
+        expected_calls[actual_call_count].malloc_call.size_arg = size;
+
+        if (expected_calls[actual_call_count].malloc_call.override_result)
+        {
+            result = expected_calls[actual_call_count].malloc_call.call_result;
+        }
+        else
+        {
+            result = malloc(size);
+        }
+
+        actual_call_count++;
+    }
+
+    return result;
+}
+
+void mock_free(void* ptr)
+{
+    if ((actual_call_count == expected_call_count) ||
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_free))
+    {
+        actual_and_expected_match = false;
+    }
+    else
+    {
+        free(ptr);
+
+        actual_call_count++;
+    }
+}
+
 static void setup_mocks(void)
 {
     expected_call_count = 0;
@@ -119,10 +174,10 @@ static void setup_mocks(void)
     actual_and_expected_match = true;
 }
 
-static void setup_expected_wcstombs_call(void)
+static void setup_expected_wchar_to_utf8_call(void)
 {
-    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_wcstombs;
-    expected_calls[expected_call_count].wcstombs_call.override_result = false;
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_wchar_to_utf8;
+    expected_calls[expected_call_count].wchar_to_utf8_call.override_result = false;
     expected_call_count++;
 }
 
@@ -133,6 +188,27 @@ static void setup_expected_vswprintf_call(void)
     expected_call_count++;
 }
 
+static void setup_expected_failing_vswprintf_call(void)
+{
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_vswprintf;
+    expected_calls[expected_call_count].vswprintf_call.override_result = true;
+    expected_calls[expected_call_count].vswprintf_call.call_result = -1;
+    expected_call_count++;
+}
+
+static void setup_expected_malloc_call(void)
+{
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_malloc;
+    expected_calls[expected_call_count].malloc_call.override_result = false;
+    expected_call_count++;
+}
+
+static void setup_expected_free_call(void)
+{
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_free;
+    expected_call_count++;
+}
+
 #define POOR_MANS_ASSERT(cond) \
     if (!(cond)) \
     { \
@@ -173,12 +249,12 @@ static void wchar_t_ptr_to_string_with_NULL_buffer_and_non_zero_buffer_length_fa
     POOR_MANS_ASSERT(actual_call_count == expected_call_count);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_003: [ If buffer is NULL and buffer_length is 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall return the length of the wchar_t string pointed to by property_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_003: [ If buffer is NULL and buffer_length is 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall return the length of the UTF-8 representation of the wchar_t string pointed to by property_value. ]*/
 static void wchar_t_ptr_to_string_with_NULL_buffer_and_zero_buffer_length_returns_string_length(void)
 {
     // arrange
     setup_mocks();
-    setup_expected_wcstombs_call();
+    setup_expected_wchar_to_utf8_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string(L"cucu", NULL, 0);
@@ -189,14 +265,14 @@ static void wchar_t_ptr_to_string_with_NULL_buffer_and_zero_buffer_length_return
     POOR_MANS_ASSERT(actual_call_count == expected_call_count);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_004: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall copy the wchar_t string pointed to by property_value to buffer by using wcstombs with buffer, buffer_length and pass in the values list the const wchar_t* value pointed to by property_value. ]*/
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_005: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall succeed and return the result of snprintf. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_004: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall convert the wchar_t string pointed to by property_value to UTF-8 in buffer by calling wchar_to_utf8 with property_value, buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_005: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall succeed and return the result of wchar_to_utf8. ]*/
 static void wchar_t_ptr_to_string_copies_the_string(void)
 {
     // arrange
     char buffer[4];
     setup_mocks();
-    setup_expected_wcstombs_call();
+    setup_expected_wchar_to_utf8_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string(L"bau", buffer, sizeof(buffer));
@@ -209,14 +285,14 @@ static void wchar_t_ptr_to_string_copies_the_string(void)
 }
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_006: [ If any error is encountered (truncation is not an error), LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall fail and return a negative value. ]*/
-static void when_wcstombs_fails_wchar_t_ptr_to_string_also_fails(void)
+static void when_wchar_to_utf8_fails_wchar_t_ptr_to_string_also_fails(void)
 {
     // arrange
     char buffer[4];
     setup_mocks();
-    expected_calls[0].mock_call_type = MOCK_CALL_TYPE_wcstombs;
-    expected_calls[0].wcstombs_call.override_result = true;
-    expected_calls[0].wcstombs_call.call_result = -1;
+    expected_calls[0].mock_call_type = MOCK_CALL_TYPE_wchar_to_utf8;
+    expected_calls[0].wchar_to_utf8_call.override_result = true;
+    expected_calls[0].wchar_to_utf8_call.call_result = -1;
     expected_call_count = 1;
 
     // act
@@ -234,14 +310,52 @@ static void to_string_with_truncation_succeeds(void)
     // arrange
     char buffer[2];
     setup_mocks();
-    setup_expected_wcstombs_call();
+    setup_expected_wchar_to_utf8_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string(L"bau", buffer, sizeof(buffer));
 
     // assert
-    POOR_MANS_ASSERT(result == 2);
-    POOR_MANS_ASSERT(strncmp(buffer, "ba", 2) == 0);
+    POOR_MANS_ASSERT(result == 3);
+    POOR_MANS_ASSERT(strcmp(buffer, "b") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_004: [ Otherwise, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall convert the wchar_t string pointed to by property_value to UTF-8 in buffer by calling wchar_to_utf8 with property_value, buffer and buffer_length. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_005: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall succeed and return the result of wchar_to_utf8. ]*/
+static void wchar_t_ptr_to_string_converts_non_ASCII_characters_to_UTF8(void)
+{
+    // arrange
+    char buffer[16];
+    setup_mocks();
+    setup_expected_wchar_to_utf8_call();
+
+    // act
+    // no locale is set, which made wcstombs fail for any non-ASCII character
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string(L"b\u00E4u \u20AC", buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 8);
+    POOR_MANS_ASSERT(strcmp(buffer, "b\xC3\xA4u \xE2\x82\xAC") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_006: [ If any error is encountered (truncation is not an error), LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string shall fail and return a negative value. ]*/
+static void to_string_with_truncation_does_not_cut_a_character(void)
+{
+    // arrange
+    char buffer[4];
+    setup_mocks();
+    setup_expected_wchar_to_utf8_call();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).to_string(L"ba\u20AC", buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 5);
+    POOR_MANS_ASSERT(strcmp(buffer, "ba") == 0);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(actual_call_count == expected_call_count);
 }
@@ -342,6 +456,247 @@ static void wchar_t_ptr_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_wchar_t_ptr(v
     POOR_MANS_ASSERT(actual_call_count == expected_call_count);
 }
 
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).get_size */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_021: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).get_size shall fail and return a negative value. ]*/
+static void wchar_t_ptr_get_size_with_NULL_property_value_fails(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).get_size(NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_022: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).get_size shall return the size in bytes of the wchar_t string pointed to by property_value, including the null terminator. ]*/
+static void wchar_t_ptr_get_size_returns_the_size_of_the_string_including_the_null_terminator(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).get_size(L"cucu");
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(5 * sizeof(wchar_t)));
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).serialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_023: [ If property_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).serialize shall fail and return a negative value. ]*/
+static void wchar_t_ptr_serialize_with_NULL_property_value_fails(void)
+{
+    // arrange
+    wchar_t buffer[16];
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).serialize(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_024: [ If buffer is NULL and buffer_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).serialize shall fail and return a negative value. ]*/
+static void wchar_t_ptr_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).serialize(L"cucu", NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_025: [ If the wchar_t string and its null terminator fit in buffer_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).serialize shall copy the wchar_t string (including the null terminator) from property_value to buffer. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_026: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).serialize shall succeed and return the size in bytes of the wchar_t string, including the null terminator. ]*/
+static void wchar_t_ptr_serialize_copies_the_string_and_the_null_terminator(void)
+{
+    // arrange
+    wchar_t buffer[16];
+    (void)wmemset(buffer, L'x', 16);
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).serialize(L"cucu", buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(5 * sizeof(wchar_t)));
+    POOR_MANS_ASSERT(wmemcmp(buffer, L"cucu\0", 5) == 0);
+    POOR_MANS_ASSERT(buffer[5] == L'x');
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_026: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).serialize shall succeed and return the size in bytes of the wchar_t string, including the null terminator. ]*/
+static void wchar_t_ptr_serialize_with_a_too_small_buffer_does_not_write_and_returns_the_needed_size(void)
+{
+    // arrange
+    wchar_t buffer[4];
+    (void)wmemset(buffer, L'x', 4);
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).serialize(L"cucu", buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(5 * sizeof(wchar_t)));
+    POOR_MANS_ASSERT(wmemcmp(buffer, L"xxxx", 4) == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_027: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize shall fail and return a negative value. ]*/
+static void wchar_t_ptr_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize(NULL, 1, L"cucu", 5 * sizeof(wchar_t));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_028: [ If buffer is NULL, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize shall fail and return a negative value. ]*/
+static void wchar_t_ptr_deserialize_with_NULL_buffer_fails(void)
+{
+    // arrange
+    wchar_t destination[16];
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize(destination, sizeof(destination), NULL, 5 * sizeof(wchar_t));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_029: [ If buffer_size is not a multiple of sizeof(wchar_t) or the first null wchar_t in buffer is not the last wchar_t of buffer, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize shall fail and return a negative value. ]*/
+static void wchar_t_ptr_deserialize_with_a_buffer_size_that_is_not_a_multiple_of_sizeof_wchar_t_fails(void)
+{
+    // arrange
+    wchar_t destination[16];
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize(destination, sizeof(destination), L"cucu", 5 * sizeof(wchar_t) - 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_029: [ If buffer_size is not a multiple of sizeof(wchar_t) or the first null wchar_t in buffer is not the last wchar_t of buffer, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize shall fail and return a negative value. ]*/
+static void wchar_t_ptr_deserialize_with_zero_buffer_size_fails(void)
+{
+    // arrange
+    wchar_t destination[16];
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize(destination, sizeof(destination), L"cucu", 0);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_029: [ If buffer_size is not a multiple of sizeof(wchar_t) or the first null wchar_t in buffer is not the last wchar_t of buffer, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize shall fail and return a negative value. ]*/
+static void wchar_t_ptr_deserialize_without_null_terminator_at_the_end_fails(void)
+{
+    // arrange
+    wchar_t destination[16];
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize(destination, sizeof(destination), L"cucu", 4 * sizeof(wchar_t));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_029: [ If buffer_size is not a multiple of sizeof(wchar_t) or the first null wchar_t in buffer is not the last wchar_t of buffer, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize shall fail and return a negative value. ]*/
+static void wchar_t_ptr_deserialize_with_a_null_terminator_before_the_end_fails(void)
+{
+    // arrange
+    wchar_t destination[16];
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize(destination, sizeof(destination), L"cu\0cu", 6 * sizeof(wchar_t));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_030: [ If buffer_size bytes fit in dst_size, LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize shall copy the wchar_t string (including the null terminator) from buffer to dst_value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_031: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize shall succeed and return buffer_size. ]*/
+static void wchar_t_ptr_deserialize_of_a_serialized_value_gives_back_the_string(void)
+{
+    // arrange
+    unsigned char buffer[16 * sizeof(wchar_t) + 1];
+    wchar_t destination[16];
+    setup_mocks();
+    // serialize at an odd offset, the serialized string does not have to be aligned
+    int size = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).serialize(L"cucu", buffer + 1, sizeof(buffer) - 1);
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize(destination, sizeof(destination), buffer + 1, (size_t)size);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(5 * sizeof(wchar_t)));
+    POOR_MANS_ASSERT(wcscmp(destination, L"cucu") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_031: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize shall succeed and return buffer_size. ]*/
+static void wchar_t_ptr_deserialize_with_a_too_small_dst_size_does_not_write_and_returns_the_needed_size(void)
+{
+    // arrange
+    wchar_t destination[4];
+    (void)wmemset(destination, L'x', 4);
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).deserialize(destination, sizeof(destination), L"cucu", 5 * sizeof(wchar_t));
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)(5 * sizeof(wchar_t)));
+    POOR_MANS_ASSERT(wmemcmp(destination, L"xxxx", 4) == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).type_tag */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_020: [ LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).type_tag shall be the property type LOG_CONTEXT_PROPERTY_TYPE_wchar_t_ptr. ]*/
+static void wchar_t_ptr_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_wchar_t_ptr(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_PROPERTY_TYPE result = LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(wchar_t_ptr).type_tag;
+
+    // assert
+    POOR_MANS_ASSERT(result == LOG_CONTEXT_PROPERTY_TYPE_wchar_t_ptr);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
 /* LOG_CONTEXT_PROPERTY_TYPE_INIT(wchar_t_ptr) */
 
 /* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_013: [ If dst_value is NULL, LOG_CONTEXT_PROPERTY_TYPE_INIT(wchar_t_ptr) shall fail and return a non-zero value. ]*/
@@ -435,15 +790,36 @@ static void when_underlying_call_fails_wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_INI
 
 /* LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr)*/
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_018: [ If vswprintf fails, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall return a negative value. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_018: [ If vswprintf fails with a buffer of LOG_MAX_WCHAR_STRING_LENGTH wchar_t, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall return a negative value. ]*/
 static void when_underlying_call_fails_wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_also_fails(void)
 {
     // arrange
     setup_mocks();
-    expected_calls[0].mock_call_type = MOCK_CALL_TYPE_vswprintf;
-    expected_calls[0].vswprintf_call.override_result = true;
-    expected_calls[0].vswprintf_call.call_result = -1;
-    expected_call_count = 1;
+    for (size_t buffer_length = 256; buffer_length <= LOG_MAX_WCHAR_STRING_LENGTH; buffer_length *= 2)
+    {
+        setup_expected_malloc_call();
+        setup_expected_failing_vswprintf_call();
+        setup_expected_free_call();
+    }
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr)(L"cucu");
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(expected_calls[expected_call_count - 2].vswprintf_call.n_arg == LOG_MAX_WCHAR_STRING_LENGTH);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_033: [ If malloc fails, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall fail and return a negative value. ]*/
+static void when_malloc_fails_wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_also_fails(void)
+{
+    // arrange
+    setup_mocks();
+    setup_expected_malloc_call();
+    expected_calls[0].malloc_call.override_result = true;
+    expected_calls[0].malloc_call.call_result = NULL;
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr)(L"cucu");
@@ -454,28 +830,34 @@ static void when_underlying_call_fails_wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET
     POOR_MANS_ASSERT(actual_call_count == expected_call_count);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_019: [ Otherwise, on success, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall return the amount of memory needed in number of wide-chracters to store the wprintf style formatted wchar_t string given by format and the arguments in .... ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_032: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall format the string by calling vswprintf in a buffer of 256 wchar_t allocated with malloc, doubling the buffer length until the formatted string fits or the buffer has LOG_MAX_WCHAR_STRING_LENGTH wchar_t. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_019: [ Otherwise, on success, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall return the amount of memory in bytes needed to store the wprintf style formatted wchar_t string given by format and the arguments in ..., including the null terminator. ]*/
 static void wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_succeeds(void)
 {
     // arrange
     setup_mocks();
+    setup_expected_malloc_call();
     setup_expected_vswprintf_call();
+    setup_expected_free_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr)(L"cucu");
 
     // assert
     POOR_MANS_ASSERT(result == 5*sizeof(wchar_t));
+    POOR_MANS_ASSERT(expected_calls[0].malloc_call.size_arg == 256 * sizeof(wchar_t));
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(actual_call_count == expected_call_count);
 }
 
-/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_019: [ Otherwise, on success, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall return the amount of memory needed in number of wide-chracters to store the wprintf style formatted wchar_t string given by format and the arguments in .... ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_019: [ Otherwise, on success, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall return the amount of memory in bytes needed to store the wprintf style formatted wchar_t string given by format and the arguments in ..., including the null terminator. ]*/
 static void wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_with_multiple_args_succeeds(void)
 {
     // arrange
     setup_mocks();
+    setup_expected_malloc_call();
     setup_expected_vswprintf_call();
+    setup_expected_free_call();
 
     // act
     int result = LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr)(L"The answer is %d and let's say hello %ls", 43, L"world");
@@ -486,6 +868,168 @@ static void wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_with_multip
     POOR_MANS_ASSERT(actual_call_count == expected_call_count);
 }
 
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_032: [ LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall format the string by calling vswprintf in a buffer of 256 wchar_t allocated with malloc, doubling the buffer length until the formatted string fits or the buffer has LOG_MAX_WCHAR_STRING_LENGTH wchar_t. ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_019: [ Otherwise, on success, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall return the amount of memory in bytes needed to store the wprintf style formatted wchar_t string given by format and the arguments in ..., including the null terminator. ]*/
+static void wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_with_a_string_longer_than_the_first_buffer_returns_the_exact_size(void)
+{
+    // arrange
+    wchar_t long_string[300];
+    (void)wmemset(long_string, L'a', 299);
+    long_string[299] = L'\0';
+    setup_mocks();
+    setup_expected_malloc_call();
+    setup_expected_vswprintf_call();
+    setup_expected_free_call();
+    setup_expected_malloc_call();
+    setup_expected_vswprintf_call();
+    setup_expected_free_call();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr)(L"%ls!", long_string);
+
+    // assert
+    POOR_MANS_ASSERT(result == 301 * sizeof(wchar_t));
+    POOR_MANS_ASSERT(expected_calls[0].malloc_call.size_arg == 256 * sizeof(wchar_t));
+    POOR_MANS_ASSERT(expected_calls[3].malloc_call.size_arg == 512 * sizeof(wchar_t));
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_018: [ If vswprintf fails with a buffer of LOG_MAX_WCHAR_STRING_LENGTH wchar_t, LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) shall return a negative value. ]*/
+static void wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_with_a_string_longer_than_LOG_MAX_WCHAR_STRING_LENGTH_fails(void)
+{
+    // arrange
+    static wchar_t too_long_string[LOG_MAX_WCHAR_STRING_LENGTH + 1];
+    (void)wmemset(too_long_string, L'a', LOG_MAX_WCHAR_STRING_LENGTH);
+    too_long_string[LOG_MAX_WCHAR_STRING_LENGTH] = L'\0';
+    setup_mocks();
+    for (size_t buffer_length = 256; buffer_length <= LOG_MAX_WCHAR_STRING_LENGTH; buffer_length *= 2)
+    {
+        setup_expected_malloc_call();
+        setup_expected_vswprintf_call();
+        setup_expected_free_call();
+    }
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr)(L"%ls", too_long_string);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr) */
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_034: [ If dst_value is NULL and dst_size is greater than 0, LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr) shall fail and return a negative value. ]*/
+static void wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_NULL_dst_value_and_non_zero_dst_size_fails(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr)(NULL, 1, L"cucu");
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_035: [ If format is NULL, LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr) shall fail and return a negative value. ]*/
+static void wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_NULL_format_fails(void)
+{
+    // arrange
+    wchar_t buffer[5];
+    setup_mocks();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr)(buffer, sizeof(buffer), NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_036: [ If dst_size can hold at least one wchar_t, LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr) shall format in the memory at dst_value by calling vswprintf with dst_value, dst_size / sizeof(wchar_t), format and the arguments in .... ]*/
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_037: [ If the formatted string fits, LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr) shall succeed and return the amount of memory in bytes used by the formatted string, including the null terminator. ]*/
+static void wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_formats_the_string_once(void)
+{
+    // arrange
+    wchar_t buffer[64];
+    setup_mocks();
+    setup_expected_vswprintf_call();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr)(buffer, sizeof(buffer), L"The answer is %d and let's say hello %ls", 42, L"world");
+
+    // assert
+    POOR_MANS_ASSERT(result == 43 * sizeof(wchar_t));
+    POOR_MANS_ASSERT(wcscmp(buffer, L"The answer is 42 and let's say hello world") == 0);
+    POOR_MANS_ASSERT(expected_calls[0].vswprintf_call.n_arg == 64);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_038: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr) shall return the amount of memory in bytes needed to store the formatted string, as computed by LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) (a negative value if that fails). ]*/
+static void wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_a_too_small_buffer_returns_the_needed_size(void)
+{
+    // arrange
+    wchar_t buffer[4];
+    setup_mocks();
+    setup_expected_vswprintf_call();
+    setup_expected_malloc_call();
+    setup_expected_vswprintf_call();
+    setup_expected_free_call();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr)(buffer, sizeof(buffer), L"cucu%d", 42);
+
+    // assert
+    POOR_MANS_ASSERT(result == 7 * sizeof(wchar_t));
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_038: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr) shall return the amount of memory in bytes needed to store the formatted string, as computed by LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) (a negative value if that fails). ]*/
+static void wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_NULL_dst_value_and_0_dst_size_returns_the_needed_size(void)
+{
+    // arrange
+    setup_mocks();
+    setup_expected_malloc_call();
+    setup_expected_vswprintf_call();
+    setup_expected_free_call();
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr)(NULL, 0, L"cucu");
+
+    // assert
+    POOR_MANS_ASSERT(result == 5 * sizeof(wchar_t));
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
+/* Tests_SRS_LOG_CONTEXT_PROPERTY_TYPE_WCHAR_T_PTR_07_038: [ Otherwise LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr) shall return the amount of memory in bytes needed to store the formatted string, as computed by LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE(wchar_t_ptr) (a negative value if that fails). ]*/
+static void when_computing_the_needed_size_fails_wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_also_fails(void)
+{
+    // arrange
+    wchar_t buffer[4];
+    setup_mocks();
+    setup_expected_failing_vswprintf_call();
+    setup_expected_malloc_call();
+    expected_calls[1].malloc_call.override_result = true;
+    expected_calls[1].malloc_call.call_result = NULL;
+
+    // act
+    int result = LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr)(buffer, sizeof(buffer), L"cucu");
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(actual_call_count == expected_call_count);
+}
+
 /* very "poor man's" way of testing, as no test harness and mocking framework are available */
 int main(void)
 {
@@ -493,8 +1037,10 @@ int main(void)
     wchar_t_ptr_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails();
     wchar_t_ptr_to_string_with_NULL_buffer_and_zero_buffer_length_returns_string_length();
     wchar_t_ptr_to_string_copies_the_string();
-    when_wcstombs_fails_wchar_t_ptr_to_string_also_fails();
+    when_wchar_to_utf8_fails_wchar_t_ptr_to_string_also_fails();
     to_string_with_truncation_succeeds();
+    wchar_t_ptr_to_string_converts_non_ASCII_characters_to_UTF8();
+    to_string_with_truncation_does_not_cut_a_character();
 
     wchar_t_ptr_copy_with_NULL_src_value_fails();
     wchar_t_ptr_copy_with_NULL_dst_value_fails();
@@ -504,6 +1050,23 @@ int main(void)
 
     wchar_t_ptr_get_type_returns_LOG_CONTEXT_PROPERTY_TYPE_wchar_t_ptr();
 
+    wchar_t_ptr_get_size_with_NULL_property_value_fails();
+    wchar_t_ptr_get_size_returns_the_size_of_the_string_including_the_null_terminator();
+    wchar_t_ptr_serialize_with_NULL_property_value_fails();
+    wchar_t_ptr_serialize_with_NULL_buffer_and_non_zero_buffer_size_fails();
+    wchar_t_ptr_serialize_copies_the_string_and_the_null_terminator();
+    wchar_t_ptr_serialize_with_a_too_small_buffer_does_not_write_and_returns_the_needed_size();
+    wchar_t_ptr_deserialize_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    wchar_t_ptr_deserialize_with_NULL_buffer_fails();
+    wchar_t_ptr_deserialize_with_a_buffer_size_that_is_not_a_multiple_of_sizeof_wchar_t_fails();
+    wchar_t_ptr_deserialize_with_zero_buffer_size_fails();
+    wchar_t_ptr_deserialize_without_null_terminator_at_the_end_fails();
+    wchar_t_ptr_deserialize_with_a_null_terminator_before_the_end_fails();
+    wchar_t_ptr_deserialize_of_a_serialized_value_gives_back_the_string();
+    wchar_t_ptr_deserialize_with_a_too_small_dst_size_does_not_write_and_returns_the_needed_size();
+
+    wchar_t_ptr_type_tag_is_LOG_CONTEXT_PROPERTY_TYPE_wchar_t_ptr();
+
     wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_INIT_with_NULL_dst_value_fails();
     wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_INIT_with_NULL_format_fails();
     wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_INIT_succeeds();
@@ -511,8 +1074,18 @@ int main(void)
     when_underlying_call_fails_wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_INIT_also_fails();
 
     when_underlying_call_fails_wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_also_fails();
+    when_malloc_fails_wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_also_fails();
     wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_succeeds();
     wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_with_multiple_args_succeeds();
+    wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_with_a_string_longer_than_the_first_buffer_returns_the_exact_size();
+    wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_GET_INIT_DATA_SIZE_with_a_string_longer_than_LOG_MAX_WCHAR_STRING_LENGTH_fails();
+
+    wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_NULL_dst_value_and_non_zero_dst_size_fails();
+    wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_NULL_format_fails();
+    wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_formats_the_string_once();
+    wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_a_too_small_buffer_returns_the_needed_size();
+    wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_with_NULL_dst_value_and_0_dst_size_returns_the_needed_size();
+    when_computing_the_needed_size_fails_wchar_t_ptr_LOG_CONTEXT_PROPERTY_TYPE_FILL_also_fails();
 
     return 0;
 }
@@ -0,0 +1,15 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdlib.h> // IWYU pragma: keep
+
+extern void* mock_malloc(size_t size);
+extern void* mock_realloc(void* ptr, size_t size);
+extern void mock_free(void* ptr);
+
+#define malloc mock_malloc
+#define realloc mock_realloc
+#define free mock_free
+
+#include "log_context.c"
+#include "log_context_shape.c"
@@ -0,0 +1,433 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <inttypes.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context_property_basic_types.h"
+#include "c_logging/log_context_property_bool_type.h"
+#include "c_logging/log_context_property_type_ascii_char_ptr.h"
+#include "c_logging/log_context_property_value_pair.h"
+#include "c_logging/log_context_property_type.h"
+#include "c_logging/log_context_property_type_if.h"
+#include "c_logging/log_context.h"
+
+#include "c_logging/log_context_shape.h"
+
+// defines how many mock calls we can have
+#define MAX_MOCK_CALL_COUNT (128)
+
+#define MOCK_CALL_TYPE_VALUES \
+    MOCK_CALL_TYPE_malloc, \
+    MOCK_CALL_TYPE_realloc, \
+    MOCK_CALL_TYPE_free
+
+MU_DEFINE_ENUM(MOCK_CALL_TYPE, MOCK_CALL_TYPE_VALUES)
+
+// very poor mans mocks :-(
+typedef struct malloc_CALL_TAG
+{
+    bool override_result;
+    void* call_result;
+    size_t size;
+} malloc_CALL;
+
+typedef struct realloc_CALL_TAG
+{
+    bool override_result;
+    void* call_result;
+    void* ptr;
+    size_t size;
+} realloc_CALL;
+
+typedef struct free_CALL_TAG
+{
+    void* ptr;
+} free_CALL;
+
+typedef struct MOCK_CALL_TAG
+{
+    MOCK_CALL_TYPE mock_call_type;
+    union
+    {
+        malloc_CALL malloc_call;
+        realloc_CALL realloc_call;
+        free_CALL free_call;
+    };
+} MOCK_CALL;
+
+static MOCK_CALL expected_calls[MAX_MOCK_CALL_COUNT];
+static size_t expected_call_count;
+static size_t actual_call_count;
+static bool actual_and_expected_match;
+
+static void setup_mocks(void)
+{
+    expected_call_count = 0;
+    actual_call_count = 0;
+    actual_and_expected_match = true;
+}
+
+void* mock_malloc(size_t size)
+{
+    void* result;
+
+    if ((actual_call_count == expected_call_count) ||
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_malloc))
+    {
+        actual_and_expected_match = false;
+        result = NULL;
+    }
+    else
+    {
+        if (expected_calls[actual_call_count].malloc_call.override_result)
+        {
+            result = expected_calls[actual_call_count].malloc_call.call_result;
+        }
+        else
+        {
+            expected_calls[actual_call_count].malloc_call.size = size;
+
+            result = malloc(size);
+        }
+
+        actual_call_count++;
+    }
+
+    return result;
+}
+
+void* mock_realloc(void* ptr, size_t size)
+{
+    void* result;
+
+    if ((actual_call_count == expected_call_count) ||
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_realloc))
+    {
+        actual_and_expected_match = false;
+        result = NULL;
+    }
+    else
+    {
+        expected_calls[actual_call_count].realloc_call.ptr = ptr;
+        expected_calls[actual_call_count].realloc_call.size = size;
+
+        if (expected_calls[actual_call_count].realloc_call.override_result)
+        {
+            result = expected_calls[actual_call_count].realloc_call.call_result;
+        }
+        else
+        {
+            result = realloc(ptr, size);
+        }
+
+        actual_call_count++;
+    }
+
+    return result;
+}
+
+void mock_free(void* ptr)
+{
+    if ((actual_call_count == expected_call_count) ||
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_free))
+    {
+        actual_and_expected_match = false;
+    }
+    else
+    {
+        expected_calls[actual_call_count].free_call.ptr = ptr;
+        free(ptr);
+
+        actual_call_count++;
+    }
+}
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+static void setup_malloc_call(void)
+{
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_malloc;
+    expected_calls[expected_call_count].malloc_call.override_result = false;
+    expected_call_count++;
+}
+
+static void setup_free_call(void)
+{
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_free;
+    expected_call_count++;
+}
+
+
+LOG_CONTEXT_SHAPE_DEFINE(request_context,
+    LOG_CONTEXT_SHAPE_PROPERTY(uint64_t, request_id),
+    LOG_CONTEXT_SHAPE_PROPERTY(uint32_t, tenant),
+    LOG_CONTEXT_SHAPE_PROPERTY(bool, is_retry));
+
+LOG_CONTEXT_SHAPE_DEFINE(all_types,
+    LOG_CONTEXT_SHAPE_PROPERTY(int64_t, the_int64_t),
+    LOG_CONTEXT_SHAPE_PROPERTY(uint64_t, the_uint64_t),
+    LOG_CONTEXT_SHAPE_PROPERTY(int32_t, the_int32_t),
+    LOG_CONTEXT_SHAPE_PROPERTY(uint32_t, the_uint32_t),
+    LOG_CONTEXT_SHAPE_PROPERTY(int16_t, the_int16_t),
+    LOG_CONTEXT_SHAPE_PROPERTY(uint16_t, the_uint16_t),
+    LOG_CONTEXT_SHAPE_PROPERTY(int8_t, the_int8_t),
+    LOG_CONTEXT_SHAPE_PROPERTY(uint8_t, the_uint8_t),
+    LOG_CONTEXT_SHAPE_PROPERTY(bool, the_bool));
+
+static void assert_request_context(LOG_CONTEXT_HANDLE log_context, uint64_t request_id, uint32_t tenant, bool is_retry)
+{
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(log_context) == 4);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(log_context);
+    // context struct
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 3);
+    POOR_MANS_ASSERT(strcmp(pairs[0].name, "request_context") == 0);
+    POOR_MANS_ASSERT(pairs[0].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_struct);
+    POOR_MANS_ASSERT(*(uint64_t*)pairs[1].value == request_id);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "request_id") == 0);
+    POOR_MANS_ASSERT(pairs[1].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_uint64_t);
+    POOR_MANS_ASSERT(*(uint32_t*)pairs[2].value == tenant);
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "tenant") == 0);
+    POOR_MANS_ASSERT(pairs[2].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_uint32_t);
+    POOR_MANS_ASSERT(*(bool*)pairs[3].value == is_retry);
+    POOR_MANS_ASSERT(strcmp(pairs[3].name, "is_retry") == 0);
+    POOR_MANS_ASSERT(pairs[3].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_bool);
+}
+
+/* LOG_CONTEXT_SHAPE_LOCAL_DEFINE */
+
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_001: [ LOG_CONTEXT_SHAPE_DEFINE shall define a structure holding the struct field count followed by one field for each property specified with LOG_CONTEXT_SHAPE_PROPERTY. ]*/
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_003: [ LOG_CONTEXT_SHAPE_DEFINE shall define a constant template of property/value pairs: one struct property named shape_name followed by one pair with the name and type of each property. ]*/
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_004: [ LOG_CONTEXT_SHAPE_DEFINE shall define a constant array with the offset of each value in the values structure. ]*/
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_006: [ LOG_CONTEXT_SHAPE_LOCAL_DEFINE shall write the struct field count and the values in ... in a values structure on the stack. ]*/
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_007: [ LOG_CONTEXT_SHAPE_LOCAL_DEFINE shall initialize the context by calling internal_log_context_shape_init. ]*/
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_009: [ internal_log_context_shape_init shall copy the property/value pairs template of log_context_shape (names and types) in property_value_pairs. ]*/
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_010: [ internal_log_context_shape_init shall point the value of each property/value pair at its offset in values_data. ]*/
+static void LOG_CONTEXT_SHAPE_LOCAL_DEFINE_succeeds(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_SHAPE_LOCAL_DEFINE(result, request_context, 0x4242424242ULL, 42, true);
+
+    // assert
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    assert_request_context(&result, 0x4242424242ULL, 42, true);
+}
+
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_006: [ LOG_CONTEXT_SHAPE_LOCAL_DEFINE shall write the struct field count and the values in ... in a values structure on the stack. ]*/
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_010: [ internal_log_context_shape_init shall point the value of each property/value pair at its offset in values_data. ]*/
+static void LOG_CONTEXT_SHAPE_LOCAL_DEFINE_twice_with_the_same_shape_creates_independent_contexts(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_SHAPE_LOCAL_DEFINE(first, request_context, 1, 2, false);
+    LOG_CONTEXT_SHAPE_LOCAL_DEFINE(second, request_context, 3, 4, true);
+
+    // assert
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    assert_request_context(&first, 1, 2, false);
+    assert_request_context(&second, 3, 4, true);
+}
+
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_001: [ LOG_CONTEXT_SHAPE_DEFINE shall define a structure holding the struct field count followed by one field for each property specified with LOG_CONTEXT_SHAPE_PROPERTY. ]*/
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_006: [ LOG_CONTEXT_SHAPE_LOCAL_DEFINE shall write the struct field count and the values in ... in a values structure on the stack. ]*/
+static void LOG_CONTEXT_SHAPE_LOCAL_DEFINE_with_all_supported_types_succeeds(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_SHAPE_LOCAL_DEFINE(result, all_types, INT64_MIN, UINT64_MAX, INT32_MIN, UINT32_MAX, INT16_MIN, UINT16_MAX, INT8_MIN, UINT8_MAX, true);
+
+    // assert
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(&result) == 10);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(&result);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 9);
+    POOR_MANS_ASSERT(strcmp(pairs[0].name, "all_types") == 0);
+    POOR_MANS_ASSERT(*(int64_t*)pairs[1].value == INT64_MIN);
+    POOR_MANS_ASSERT(pairs[1].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_int64_t);
+    POOR_MANS_ASSERT(*(uint64_t*)pairs[2].value == UINT64_MAX);
+    POOR_MANS_ASSERT(pairs[2].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_uint64_t);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[3].value == INT32_MIN);
+    POOR_MANS_ASSERT(pairs[3].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_int32_t);
+    POOR_MANS_ASSERT(*(uint32_t*)pairs[4].value == UINT32_MAX);
+    POOR_MANS_ASSERT(pairs[4].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_uint32_t);
+    POOR_MANS_ASSERT(*(int16_t*)pairs[5].value == INT16_MIN);
+    POOR_MANS_ASSERT(pairs[5].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_int16_t);
+    POOR_MANS_ASSERT(*(uint16_t*)pairs[6].value == UINT16_MAX);
+    POOR_MANS_ASSERT(pairs[6].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_uint16_t);
+    POOR_MANS_ASSERT(*(int8_t*)pairs[7].value == INT8_MIN);
+    POOR_MANS_ASSERT(pairs[7].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_int8_t);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[8].value == UINT8_MAX);
+    POOR_MANS_ASSERT(pairs[8].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_uint8_t);
+    POOR_MANS_ASSERT(*(bool*)pairs[9].value == true);
+    POOR_MANS_ASSERT(strcmp(pairs[9].name, "the_bool") == 0);
+    POOR_MANS_ASSERT(pairs[9].type->type_tag == LOG_CONTEXT_PROPERTY_TYPE_bool);
+}
+
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_002: [ If 2 properties have the same property_name a compiler error shall be emitted. ]*/
+#if 0
+// If this code compiles we are not passing the test
+LOG_CONTEXT_SHAPE_DEFINE(duplicate_names,
+    LOG_CONTEXT_SHAPE_PROPERTY(int32_t, gigi),
+    LOG_CONTEXT_SHAPE_PROPERTY(int64_t, gigi));
+#endif
+
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_005: [ If the number of values is different than the number of properties of the shape a compiler error shall be emitted. ]*/
+#if 0
+// If this code compiles we are not passing the test
+static void LOG_CONTEXT_SHAPE_LOCAL_DEFINE_with_too_few_values_does_not_compile(void)
+{
+    // arrange
+
+    // act
+    LOG_CONTEXT_SHAPE_LOCAL_DEFINE(result, request_context, 1, 2);
+
+    // assert
+
+    // clean
+}
+#endif
+
+/* LOG_CONTEXT_SHAPE_CREATE */
+
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_008: [ LOG_CONTEXT_SHAPE_CREATE shall write the struct field count and the values in ... in a values structure and call log_context_shape_create. ]*/
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_013: [ log_context_shape_create shall allocate the context, its property/value pairs and its values with a single allocation. ]*/
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_014: [ log_context_shape_create shall copy values_data in the context. ]*/
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_015: [ log_context_shape_create shall initialize the context by calling internal_log_context_shape_init. ]*/
+static void LOG_CONTEXT_SHAPE_CREATE_succeeds(void)
+{
+    // arrange
+    setup_mocks();
+    setup_malloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_SHAPE_CREATE(result, request_context, 0x4242424242ULL, 42, true);
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    assert_request_context(result, 0x4242424242ULL, 42, true);
+
+    // cleanup
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(result);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_016: [ If any error occurs, log_context_shape_create shall fail and return NULL. ]*/
+static void when_malloc_fails_LOG_CONTEXT_SHAPE_CREATE_also_fails(void)
+{
+    // arrange
+    setup_mocks();
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_malloc;
+    expected_calls[expected_call_count].malloc_call.override_result = true;
+    expected_calls[expected_call_count].malloc_call.call_result = NULL;
+    expected_call_count++;
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_SHAPE_CREATE(result, request_context, 1, 2, false);
+
+    // assert
+    POOR_MANS_ASSERT(result == NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_014: [ If parent_context is non-NULL, the created context shall copy all the property/value pairs of parent_context. ]*/
+static void LOG_CONTEXT_CREATE_with_a_shape_context_parent_succeeds(void)
+{
+    // arrange
+    setup_mocks();
+    setup_malloc_call();
+    LOG_CONTEXT_SHAPE_LOCAL_DEFINE(parent_context, request_context, 7, 8, true);
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, &parent_context, LOG_CONTEXT_PROPERTY(int32_t, the_answer, 42));
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(result) == 6);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 2);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[1].value == 3);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "request_context") == 0);
+    POOR_MANS_ASSERT(*(uint64_t*)pairs[2].value == 7);
+    POOR_MANS_ASSERT(*(uint32_t*)pairs[3].value == 8);
+    POOR_MANS_ASSERT(*(bool*)pairs[4].value == true);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[5].value == 42);
+    POOR_MANS_ASSERT(strcmp(pairs[5].name, "the_answer") == 0);
+
+    // cleanup
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(result);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* log_context_shape_create */
+
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_011: [ If log_context_shape is NULL, log_context_shape_create shall fail and return NULL. ]*/
+static void log_context_shape_create_with_NULL_log_context_shape_fails(void)
+{
+    // arrange
+    LOG_CONTEXT_SHAPE_VALUES(request_context) values = { 3, 1, 2, true };
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_HANDLE result = log_context_shape_create(NULL, &values);
+
+    // assert
+    POOR_MANS_ASSERT(result == NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_SHAPE_01_012: [ If values_data is NULL, log_context_shape_create shall fail and return NULL. ]*/
+static void log_context_shape_create_with_NULL_values_data_fails(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_HANDLE result = log_context_shape_create(&LOG_CONTEXT_SHAPE(request_context), NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result == NULL);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+int main(void)
+{
+    LOG_CONTEXT_SHAPE_LOCAL_DEFINE_succeeds();
+    LOG_CONTEXT_SHAPE_LOCAL_DEFINE_twice_with_the_same_shape_creates_independent_contexts();
+    LOG_CONTEXT_SHAPE_LOCAL_DEFINE_with_all_supported_types_succeeds();
+
+    LOG_CONTEXT_SHAPE_CREATE_succeeds();
+    when_malloc_fails_LOG_CONTEXT_SHAPE_CREATE_also_fails();
+    LOG_CONTEXT_CREATE_with_a_shape_context_parent_succeeds();
+
+    log_context_shape_create_with_NULL_log_context_shape_fails();
+    log_context_shape_create_with_NULL_values_data_fails();
+
+    return 0;
+}
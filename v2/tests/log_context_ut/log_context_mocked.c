@@ -4,9 +4,11 @@
 #include <stdlib.h> // IWYU pragma: keep
 
 extern void* mock_malloc(size_t size);
+extern void* mock_realloc(void* ptr, size_t size);
 extern void mock_free(void* ptr);
 
 #define malloc mock_malloc
+#define realloc mock_realloc
 #define free mock_free
 #define log_internal_error_report mock_log_internal_error_report
 
@@ -7,6 +7,7 @@
 #include <string.h>
 #include <stdint.h>
 #include <wchar.h>
+#include <errno.h>
 
 #include "macro_utils/macro_utils.h"
 
@@ -14,6 +15,8 @@
 
 #include "c_logging/log_context_property_basic_types.h"
 #include "c_logging/log_context_property_type_ascii_char_ptr.h"
+#include "c_logging/log_context_property_type_borrowed_ascii_char_ptr.h"
+#include "c_logging/log_context_property_type_binary.h"
 #include "c_logging/log_context_property_type_wchar_t_ptr.h"
 #include "c_logging/log_context_property_value_pair.h"
 #include "c_logging/log_context_property_type.h"
@@ -25,6 +28,7 @@
 
 #define MOCK_CALL_TYPE_VALUES \
     MOCK_CALL_TYPE_malloc, \
+    MOCK_CALL_TYPE_realloc, \
     MOCK_CALL_TYPE_free, \
     MOCK_CALL_TYPE_log_internal_error_report, \
     MOCK_CALL_TYPE_call_this_function_to_get_value
@@ -39,6 +43,15 @@ typedef struct malloc_CALL_TAG
     size_t size;
 } malloc_CALL;
 
+typedef struct realloc_CALL_TAG
+{
+    bool override_result;
+    void* call_result;
+    void* ptr;
+    size_t size;
+    int set_errno;
+} realloc_CALL;
+
 typedef struct free_CALL_TAG
 {
     void* ptr;
@@ -47,6 +60,9 @@ typedef struct free_CALL_TAG
 typedef struct call_this_function_to_get_value_CALL_TAG
 {
     void* captured_buffer;
+    size_t captured_buffer_size;
+    int captured_errno;
+    int needed_size;
 } call_this_function_to_get_value_CALL;
 
 typedef struct MOCK_CALL_TAG
@@ -55,6 +71,7 @@ typedef struct MOCK_CALL_TAG
     union
     {
         malloc_CALL malloc_call;
+        realloc_CALL realloc_call;
         free_CALL free_call;
         call_this_function_to_get_value_CALL call_this_function_to_get_value_call;
     };
@@ -101,6 +118,41 @@ void* mock_malloc(size_t size)
     return result;
 }
 
+void* mock_realloc(void* ptr, size_t size)
+{
+    void* result;
+
+    if ((actual_call_count == expected_call_count) ||
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_realloc))
+    {
+        actual_and_expected_match = false;
+        result = NULL;
+    }
+    else
+    {
+        expected_calls[actual_call_count].realloc_call.ptr = ptr;
+        expected_calls[actual_call_count].realloc_call.size = size;
+
+        if (expected_calls[actual_call_count].realloc_call.override_result)
+        {
+            result = expected_calls[actual_call_count].realloc_call.call_result;
+        }
+        else
+        {
+            result = realloc(ptr, size);
+        }
+
+        if (expected_calls[actual_call_count].realloc_call.set_errno != 0)
+        {
+            errno = expected_calls[actual_call_count].realloc_call.set_errno;
+        }
+
+        actual_call_count++;
+    }
+
+    return result;
+}
+
 void mock_free(void* ptr)
 {
     if ((actual_call_count == expected_call_count) ||
@@ -144,6 +196,14 @@ static void setup_malloc_call(void)
     expected_call_count++;
 }
 
+static void setup_realloc_call(void)
+{
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_realloc;
+    expected_calls[expected_call_count].realloc_call.override_result = false;
+    expected_calls[expected_call_count].realloc_call.set_errno = 0;
+    expected_call_count++;
+}
+
 static void setup_free_call(void)
 {
     expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_free;
@@ -159,6 +219,7 @@ static void setup_log_internal_error_report(void)
 static void setup_call_this_function_to_get_value_call(void)
 {
     expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_call_this_function_to_get_value;
+    expected_calls[expected_call_count].call_this_function_to_get_value_call.needed_size = 0;
     expected_call_count++;
 }
 
@@ -387,7 +448,7 @@ static void LOG_CONTEXT_CREATE_with_all_int_property_types_succeeds(void)
 
 static const char TEST_STRING[] = "blargh";
 
-static int mock_call_this_function_to_get_value(void* buffer, ...)
+static int mock_call_this_function_to_get_value(void* buffer, size_t buffer_size, ...)
 {
     int result;
 
@@ -399,16 +460,27 @@ static int mock_call_this_function_to_get_value(void* buffer, ...)
     }
     else
     {
+        int needed_size = expected_calls[actual_call_count].call_this_function_to_get_value_call.needed_size;
+
         expected_calls[actual_call_count].call_this_function_to_get_value_call.captured_buffer = buffer;
+        expected_calls[actual_call_count].call_this_function_to_get_value_call.captured_buffer_size = buffer_size;
+        expected_calls[actual_call_count].call_this_function_to_get_value_call.captured_errno = errno;
+
+        if (needed_size == 0)
+        {
+            needed_size = sizeof(TEST_STRING);
+        }
 
-        if (buffer != NULL)
+        if (buffer_size >= (size_t)needed_size)
         {
-            (void)memcpy(buffer, TEST_STRING, sizeof(TEST_STRING));
+            (void)memset(buffer, 'x', needed_size - 1);
+            (void)memcpy(buffer, TEST_STRING, sizeof(TEST_STRING) - 1);
+            ((char*)buffer)[needed_size - 1] = '\0';
         }
 
         actual_call_count++;
 
-        result = sizeof(TEST_STRING);
+        result = needed_size;
     }
 
     return result;
@@ -417,13 +489,12 @@ static int mock_call_this_function_to_get_value(void* buffer, ...)
 /* Tests_SRS_LOG_CONTEXT_01_001: [ LOG_CONTEXT_CREATE shall allocate memory for the log context. ]*/
 /* Tests_SRS_LOG_CONTEXT_01_003: [ LOG_CONTEXT_CREATE shall store the property types and values specified by using LOG_CONTEXT_PROPERTY in the context. ]*/
 /* Tests_SRS_LOG_CONTEXT_01_027: [ LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code allocating a property/value pair entry with the type property_type and the name property_name. ]*/
-/* Tests_SRS_LOG_CONTEXT_01_028: [ LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code that calls value_function with NULL in order to determine how much memory shall be reserved for the property. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_028: [ LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code that calls value_function passing to it the space left in the context data area and its size, so that a value that fits is produced with a single call. ] */
 /* Tests_SRS_LOG_CONTEXT_01_029: [ LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code filling the property value by calling value_function. ]*/
 static void LOG_CONTEXT_CREATE_CUSTOM_FUNCTION_succeeds(void)
 {
     // arrange
     setup_mocks();
-    setup_call_this_function_to_get_value_call();
     setup_malloc_call();
     setup_call_this_function_to_get_value_call();
 
@@ -454,14 +525,12 @@ static void LOG_CONTEXT_CREATE_CUSTOM_FUNCTION_succeeds(void)
 /* Tests_SRS_LOG_CONTEXT_01_001: [ LOG_CONTEXT_CREATE shall allocate memory for the log context. ]*/
 /* Tests_SRS_LOG_CONTEXT_01_003: [ LOG_CONTEXT_CREATE shall store the property types and values specified by using LOG_CONTEXT_PROPERTY in the context. ]*/
 /* Tests_SRS_LOG_CONTEXT_01_027: [ LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code allocating a property/value pair entry with the type property_type and the name property_name. ]*/
-/* Tests_SRS_LOG_CONTEXT_01_028: [ LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code that calls value_function with NULL in order to determine how much memory shall be reserved for the property. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_028: [ LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code that calls value_function passing to it the space left in the context data area and its size, so that a value that fits is produced with a single call. ] */
 /* Tests_SRS_LOG_CONTEXT_01_029: [ LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code filling the property value by calling value_function. ]*/
 static void LOG_CONTEXT_CREATE_CUSTOM_FUNCTION_with_two_properties_succeeds(void)
 {
     // arrange
     setup_mocks();
-    setup_call_this_function_to_get_value_call();
-    setup_call_this_function_to_get_value_call();
     setup_malloc_call();
     setup_call_this_function_to_get_value_call();
     setup_call_this_function_to_get_value_call();
@@ -497,6 +566,167 @@ static void LOG_CONTEXT_CREATE_CUSTOM_FUNCTION_with_two_properties_succeeds(void
     LOG_CONTEXT_DESTROY(result);
 }
 
+/* Tests_SRS_LOG_CONTEXT_01_033: [ If value_function indicates that it needs more memory than the space left, LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code that calls internal_log_context_reserve to make room for the value and calls value_function again. ] */
+/* Tests_SRS_LOG_CONTEXT_01_040: [ Otherwise internal_log_context_reserve shall reallocate the context so that needed_size bytes and an extra LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE bytes are available after the values already stored. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_041: [ internal_log_context_reserve shall update the values of all the property/value pairs already stored that point into the data area to point into the reallocated data area. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_042: [ internal_log_context_reserve shall succeed and return 0. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_035: [ LOG_CONTEXT_CREATE shall set the values data length of the context to the number of bytes actually used by the property values. ]*/
+static void LOG_CONTEXT_CREATE_CUSTOM_FUNCTION_that_needs_more_than_the_slack_reallocates_the_context(void)
+{
+    // arrange
+    setup_mocks();
+    setup_malloc_call();
+    setup_call_this_function_to_get_value_call();
+    expected_calls[1].call_this_function_to_get_value_call.needed_size = LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE + 100;
+    setup_realloc_call();
+    setup_call_this_function_to_get_value_call();
+    expected_calls[3].call_this_function_to_get_value_call.needed_size = LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE + 100;
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, NULL,
+        LOG_CONTEXT_PROPERTY(int32_t, x, 42),
+        LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION(ascii_char_ptr, test_property, mock_call_this_function_to_get_value, 0),
+        LOG_CONTEXT_PROPERTY(int32_t, y, 43)
+        );
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].call_this_function_to_get_value_call.captured_buffer_size == LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE + sizeof(int32_t));
+    POOR_MANS_ASSERT(expected_calls[3].call_this_function_to_get_value_call.captured_buffer_size == LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE + 100 + LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(result) == 4);
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(result) == 1 + sizeof(int32_t) + LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE + 100 + sizeof(int32_t));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    // context struct
+    POOR_MANS_ASSERT(pairs[0].value == result->values_data);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 3);
+    POOR_MANS_ASSERT(pairs[0].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_struct);
+    // x
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "x") == 0);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[1].value == 42);
+    // custom property
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "test_property") == 0);
+    POOR_MANS_ASSERT(strlen(pairs[2].value) == LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE + 100 - 1);
+    POOR_MANS_ASSERT(strncmp(pairs[2].value, TEST_STRING, sizeof(TEST_STRING) - 1) == 0);
+    POOR_MANS_ASSERT(pairs[2].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_ascii_char_ptr);
+    // y
+    POOR_MANS_ASSERT(strcmp(pairs[3].name, "y") == 0);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[3].value == 43);
+
+    // clean
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(result);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_060: [ internal_log_context_reserve shall preserve errno (and on Windows the last error) so that a value produced again after the reserve sees the same error as the first call. ]*/
+static void LOG_CONTEXT_CREATE_CUSTOM_FUNCTION_that_reallocates_sees_the_same_errno_on_both_calls(void)
+{
+    // arrange
+    setup_mocks();
+    setup_malloc_call();
+    setup_call_this_function_to_get_value_call();
+    expected_calls[1].call_this_function_to_get_value_call.needed_size = LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE + 100;
+    setup_realloc_call();
+    expected_calls[2].realloc_call.set_errno = ENOMEM;
+    setup_call_this_function_to_get_value_call();
+    expected_calls[3].call_this_function_to_get_value_call.needed_size = LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE + 100;
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    errno = EACCES;
+    LOG_CONTEXT_CREATE(result, NULL,
+        LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION(ascii_char_ptr, test_property, mock_call_this_function_to_get_value, 0)
+        );
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].call_this_function_to_get_value_call.captured_errno == EACCES);
+    POOR_MANS_ASSERT(expected_calls[3].call_this_function_to_get_value_call.captured_errno == EACCES);
+    POOR_MANS_ASSERT(errno == EACCES);
+
+    // clean
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(result);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_039: [ If any error occurs, internal_log_context_reserve shall fail and return a non-zero value. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_002: [ If any error occurs, LOG_CONTEXT_CREATE shall fail and return NULL. ]*/
+static void when_realloc_fails_LOG_CONTEXT_CREATE_CUSTOM_FUNCTION_also_fails(void)
+{
+    // arrange
+    setup_mocks();
+    setup_malloc_call();
+    setup_call_this_function_to_get_value_call();
+    expected_calls[1].call_this_function_to_get_value_call.needed_size = LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE + 100;
+    setup_realloc_call();
+    expected_calls[2].realloc_call.override_result = true;
+    expected_calls[2].realloc_call.call_result = NULL;
+    setup_free_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, NULL,
+        LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION(ascii_char_ptr, test_property, mock_call_this_function_to_get_value, 0),
+        LOG_CONTEXT_PROPERTY(int32_t, y, 43)
+        );
+
+    // assert
+    POOR_MANS_ASSERT(result == NULL);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_028: [ LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION shall expand to code that calls value_function passing to it the space left in the context data area and its size, so that a value that fits is produced with a single call. ] */
+static void LOG_CONTEXT_LOCAL_DEFINE_CUSTOM_FUNCTION_calls_the_function_once(void)
+{
+    // arrange
+    setup_mocks();
+    setup_call_this_function_to_get_value_call();
+
+    // act
+    LOG_CONTEXT_LOCAL_DEFINE(result, NULL,
+        LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION(ascii_char_ptr, test_property, mock_call_this_function_to_get_value, 0)
+        );
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[0].call_this_function_to_get_value_call.captured_buffer_size == LOG_MAX_STACK_DATA_SIZE - 1);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(&result) == 2);
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(&result) == 1 + sizeof(TEST_STRING));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(&result);
+    POOR_MANS_ASSERT(strcmp(pairs[1].value, TEST_STRING) == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "test_property") == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_025: [ If the memory size needed for all properties to be stored in the context exceeds LOG_MAX_STACK_DATA_SIZE, an error shall be reported by calling log_internal_error_report and no properties shall be stored in the context. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_038: [ If the context cannot be reallocated (it was not created by LOG_CONTEXT_CREATE), internal_log_context_reserve shall fail and return a non-zero value. ]*/
+static void LOG_CONTEXT_LOCAL_DEFINE_CUSTOM_FUNCTION_that_needs_too_much_memory_reports_error(void)
+{
+    // arrange
+    setup_mocks();
+    setup_call_this_function_to_get_value_call();
+    expected_calls[0].call_this_function_to_get_value_call.needed_size = LOG_MAX_STACK_DATA_SIZE;
+    setup_log_internal_error_report();
+
+    // act
+    LOG_CONTEXT_LOCAL_DEFINE(result, NULL,
+        LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION(ascii_char_ptr, test_property, mock_call_this_function_to_get_value, 0),
+        LOG_CONTEXT_PROPERTY(int32_t, y, 43)
+        );
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(&result) == 0);
+}
+
 /* LOG_CONTEXT_STRING_PROPERTY */
 
 /* Tests_SRS_LOG_CONTEXT_01_007: [ LOG_CONTEXT_STRING_PROPERTY shall expand to code allocating a property/value pair of type ascii_char_ptr and the name property_name. ]*/
@@ -680,6 +910,483 @@ static void LOG_CONTEXT_CREATE_with_a_string_property_preceded_by_another_int_pr
     LOG_CONTEXT_DESTROY(result);
 }
 
+/* Tests_SRS_LOG_CONTEXT_01_031: [ LOG_CONTEXT_STRING_PROPERTY shall expand to code that formats the string directly in the space left in the context data area, by calling LOG_CONTEXT_PROPERTY_TYPE_FILL(ascii_char_ptr), so that a string that fits is formatted with a single call. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_034: [ LOG_CONTEXT_CREATE shall reserve LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE bytes for each property whose value size is only known once the value is produced. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_035: [ LOG_CONTEXT_CREATE shall set the values data length of the context to the number of bytes actually used by the property values. ]*/
+static void LOG_CONTEXT_CREATE_with_a_string_property_reserves_slack_and_uses_only_the_needed_bytes(void)
+{
+    // arrange
+    setup_mocks();
+    setup_malloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, NULL, LOG_CONTEXT_STRING_PROPERTY(test_string, "%s", "gogu"));
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[0].malloc_call.size == sizeof(LOG_CONTEXT) + 2 * sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) + 1 + LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE);
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(result) == 1 + sizeof("gogu"));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(strcmp(pairs[1].value, "gogu") == 0);
+
+    // clean
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(result);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_032: [ If the formatted string does not fit in the space left, LOG_CONTEXT_STRING_PROPERTY shall expand to code that calls internal_log_context_reserve to make room for the string and formats the string again. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_040: [ Otherwise internal_log_context_reserve shall reallocate the context so that needed_size bytes and an extra LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE bytes are available after the values already stored. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_041: [ internal_log_context_reserve shall update the values of all the property/value pairs already stored that point into the data area to point into the reallocated data area. ]*/
+static void LOG_CONTEXT_CREATE_with_a_string_property_longer_than_the_slack_reallocates_the_context(void)
+{
+    // arrange
+    char long_string[LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE * 3] = { 0 };
+    (void)memset(long_string, 'a', sizeof(long_string) - 1);
+
+    setup_mocks();
+    setup_malloc_call();
+    setup_realloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, NULL,
+        LOG_CONTEXT_STRING_PROPERTY(short_string, "gogu"),
+        LOG_CONTEXT_STRING_PROPERTY(long_string, "%s", long_string),
+        LOG_CONTEXT_PROPERTY(int32_t, x, 42)
+    );
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(result) == 1 + sizeof("gogu") + sizeof(long_string) + sizeof(int32_t));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 3);
+    POOR_MANS_ASSERT(strcmp(pairs[1].value, "gogu") == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "short_string") == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[2].value, long_string) == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "long_string") == 0);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[3].value == 42);
+    POOR_MANS_ASSERT(strcmp(pairs[3].name, "x") == 0);
+
+    // clean
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(result);
+}
+
+/* LOG_CONTEXT_BORROWED_STRING_PROPERTY */
+
+static const char borrowed_string[] = "blob_uploader";
+
+/* Tests_SRS_LOG_CONTEXT_01_045: [ LOG_CONTEXT_BORROWED_STRING_PROPERTY shall expand to code allocating a property/value pair with the name property_name. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_046: [ In a context defined by LOG_CONTEXT_LOCAL_DEFINE, LOG_CONTEXT_BORROWED_STRING_PROPERTY shall expand to code that stores a value of type borrowed_ascii_char_ptr holding only the pointer value and the length of the string, by calling LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_ascii_char_ptr), without copying the string. ]*/
+static void LOG_CONTEXT_LOCAL_DEFINE_with_a_borrowed_string_property_does_not_copy_the_string(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_LOCAL_DEFINE(local_context, NULL,
+        LOG_CONTEXT_BORROWED_STRING_PROPERTY(component, borrowed_string),
+        LOG_CONTEXT_PROPERTY(int32_t, x, 42)
+    );
+
+    // assert
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(&local_context) == 3);
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(&local_context) == 1 + sizeof(BORROWED_ASCII_CHAR_PTR) + sizeof(int32_t));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(&local_context);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 2);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "component") == 0);
+    POOR_MANS_ASSERT(pairs[1].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr);
+    POOR_MANS_ASSERT(((const BORROWED_ASCII_CHAR_PTR*)pairs[1].value)->value == borrowed_string);
+    POOR_MANS_ASSERT(((const BORROWED_ASCII_CHAR_PTR*)pairs[1].value)->length == sizeof(borrowed_string) - 1);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[2].value == 42);
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "x") == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_045: [ LOG_CONTEXT_BORROWED_STRING_PROPERTY shall expand to code allocating a property/value pair with the name property_name. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_047: [ In a context created by LOG_CONTEXT_CREATE, LOG_CONTEXT_BORROWED_STRING_PROPERTY shall expand to code that copies the string in the context data area by calling LOG_CONTEXT_PROPERTY_TYPE_FILL(borrowed_ascii_char_ptr) and stores a property/value pair of type ascii_char_ptr and the name property_name. ]*/
+static void LOG_CONTEXT_CREATE_with_a_borrowed_string_property_copies_the_string(void)
+{
+    // arrange
+    setup_mocks();
+    setup_malloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, NULL,
+        LOG_CONTEXT_BORROWED_STRING_PROPERTY(component, borrowed_string),
+        LOG_CONTEXT_PROPERTY(int32_t, x, 42)
+    );
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[0].malloc_call.size == sizeof(LOG_CONTEXT) + 3 * sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) + 1 + sizeof(BORROWED_ASCII_CHAR_PTR) + sizeof(int32_t) + LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE);
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(result) == 1 + sizeof(borrowed_string) + sizeof(int32_t));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 2);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "component") == 0);
+    POOR_MANS_ASSERT(pairs[1].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_ascii_char_ptr);
+    POOR_MANS_ASSERT(pairs[1].value != borrowed_string);
+    POOR_MANS_ASSERT(strcmp(pairs[1].value, borrowed_string) == 0);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[2].value == 42);
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "x") == 0);
+
+    // clean
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(result);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_048: [ If the string does not fit in the space left, LOG_CONTEXT_BORROWED_STRING_PROPERTY shall expand to code that calls internal_log_context_reserve to make room for the string and copies the string again. ]*/
+static void LOG_CONTEXT_CREATE_with_a_borrowed_string_property_longer_than_the_slack_reallocates_the_context(void)
+{
+    // arrange
+    char long_string[LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE * 3] = { 0 };
+    (void)memset(long_string, 'a', sizeof(long_string) - 1);
+
+    setup_mocks();
+    setup_malloc_call();
+    setup_realloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, NULL,
+        LOG_CONTEXT_PROPERTY(int32_t, x, 42),
+        LOG_CONTEXT_BORROWED_STRING_PROPERTY(long_string, long_string)
+    );
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(result) == 1 + sizeof(int32_t) + sizeof(long_string));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[1].value == 42);
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "long_string") == 0);
+    POOR_MANS_ASSERT(pairs[2].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_ascii_char_ptr);
+    POOR_MANS_ASSERT(strcmp(pairs[2].value, long_string) == 0);
+
+    // clean
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(result);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_018: [ If parent_context is non-NULL, the created context shall copy all the property/value pairs of parent_context. ]*/
+static void LOG_CONTEXT_LOCAL_DEFINE_with_a_parent_that_has_a_borrowed_string_property_keeps_it_borrowed(void)
+{
+    // arrange
+    setup_mocks();
+    LOG_CONTEXT_LOCAL_DEFINE(parent_context, NULL,
+        LOG_CONTEXT_BORROWED_STRING_PROPERTY(component, borrowed_string)
+    );
+
+    // act
+    LOG_CONTEXT_LOCAL_DEFINE(local_context, &parent_context,
+        LOG_CONTEXT_PROPERTY(int32_t, x, 42)
+    );
+
+    // assert
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(&local_context) == 4);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(&local_context);
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "component") == 0);
+    POOR_MANS_ASSERT(pairs[2].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr);
+    POOR_MANS_ASSERT(((const BORROWED_ASCII_CHAR_PTR*)pairs[2].value)->value == borrowed_string);
+    POOR_MANS_ASSERT(((const BORROWED_ASCII_CHAR_PTR*)pairs[2].value)->length == sizeof(borrowed_string) - 1);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[3].value == 42);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* LOG_CONTEXT_BINARY_PROPERTY */
+
+static const uint8_t test_binary_data[] = { 0xDE, 0xAD, 0xBE, 0xEF, 0x00, 0x42 };
+
+static void assert_binary_value(const void* value, const void* expected_data, size_t expected_length)
+{
+    uint16_t length;
+    (void)memcpy(&length, value, sizeof(uint16_t));
+    POOR_MANS_ASSERT(length == expected_length);
+    POOR_MANS_ASSERT(memcmp((const uint8_t*)value + sizeof(uint16_t), expected_data, expected_length) == 0);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_049: [ LOG_CONTEXT_BINARY_PROPERTY shall expand to code allocating a property/value pair of type binary and the name property_name. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_050: [ LOG_CONTEXT_BINARY_PROPERTY shall expand to code that copies the length bytes at data in the context data area by calling LOG_CONTEXT_PROPERTY_TYPE_FILL(binary). ]*/
+static void LOG_CONTEXT_LOCAL_DEFINE_with_a_binary_property_copies_the_bytes(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_LOCAL_DEFINE(local_context, NULL,
+        LOG_CONTEXT_BINARY_PROPERTY(header, test_binary_data, sizeof(test_binary_data)),
+        LOG_CONTEXT_PROPERTY(int32_t, x, 42)
+    );
+
+    // assert
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(&local_context) == 3);
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(&local_context) == 1 + sizeof(uint16_t) + sizeof(test_binary_data) + sizeof(int32_t));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(&local_context);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 2);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "header") == 0);
+    POOR_MANS_ASSERT(pairs[1].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_binary);
+    assert_binary_value(pairs[1].value, test_binary_data, sizeof(test_binary_data));
+    POOR_MANS_ASSERT(*(int32_t*)pairs[2].value == 42);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_049: [ LOG_CONTEXT_BINARY_PROPERTY shall expand to code allocating a property/value pair of type binary and the name property_name. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_050: [ LOG_CONTEXT_BINARY_PROPERTY shall expand to code that copies the length bytes at data in the context data area by calling LOG_CONTEXT_PROPERTY_TYPE_FILL(binary). ]*/
+static void LOG_CONTEXT_CREATE_with_a_binary_property_allocates_the_exact_size(void)
+{
+    // arrange
+    setup_mocks();
+    setup_malloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, NULL,
+        LOG_CONTEXT_BINARY_PROPERTY(header, test_binary_data, sizeof(test_binary_data))
+    );
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[0].malloc_call.size == sizeof(LOG_CONTEXT) + 2 * sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) + 1 + sizeof(uint16_t) + sizeof(test_binary_data));
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(result) == 1 + sizeof(uint16_t) + sizeof(test_binary_data));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "header") == 0);
+    POOR_MANS_ASSERT(pairs[1].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_binary);
+    assert_binary_value(pairs[1].value, test_binary_data, sizeof(test_binary_data));
+
+    // clean
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(result);
+}
+
+static LOG_CONTEXT_HANDLE create_child_of_a_local_context_with_borrowed_values(void)
+{
+    char borrowed_text[] = "borrowed text";
+    uint8_t borrowed_bytes[] = { 1, 2, 3 };
+    LOG_CONTEXT_LOCAL_DEFINE(parent_context, NULL,
+        LOG_CONTEXT_BORROWED_STRING_PROPERTY(component, borrowed_text),
+        LOG_CONTEXT_BORROWED_BINARY_PROPERTY(header, borrowed_bytes, sizeof(borrowed_bytes))
+    );
+
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, &parent_context,
+        LOG_CONTEXT_PROPERTY(int32_t, x, 42)
+    );
+
+    // the borrowed storage changes before going away
+    (void)memset(borrowed_text, 'z', sizeof(borrowed_text) - 1);
+    (void)memset(borrowed_bytes, 0, sizeof(borrowed_bytes));
+
+    return result;
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_059: [ If a property/value pair of parent_context has a borrowed type (borrowed_ascii_char_ptr or borrowed_binary), LOG_CONTEXT_CREATE shall copy what the value points to in the data area of the created context and store the pair with the owning type (ascii_char_ptr or binary). ]*/
+static void LOG_CONTEXT_CREATE_with_a_local_parent_that_has_borrowed_values_copies_them(void)
+{
+    // arrange
+    static const uint8_t expected_bytes[] = { 1, 2, 3 };
+    setup_mocks();
+    setup_malloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result = create_child_of_a_local_context_with_borrowed_values();
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[0].malloc_call.size == sizeof(LOG_CONTEXT) + 5 * sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) +
+        1 + (1 + sizeof(BORROWED_ASCII_CHAR_PTR) + sizeof(BORROWED_BINARY)) + sizeof("borrowed text") + sizeof(uint16_t) + sizeof(expected_bytes) + sizeof(int32_t));
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(result) == 5);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[1].value == 2);
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "component") == 0);
+    POOR_MANS_ASSERT(pairs[2].type == &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(ascii_char_ptr));
+    POOR_MANS_ASSERT(strcmp(pairs[2].value, "borrowed text") == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[3].name, "header") == 0);
+    POOR_MANS_ASSERT(pairs[3].type == &LOG_CONTEXT_PROPERTY_TYPE_IF_IMPL(binary));
+    assert_binary_value(pairs[3].value, expected_bytes, sizeof(expected_bytes));
+    POOR_MANS_ASSERT(*(int32_t*)pairs[4].value == 42);
+
+    // clean
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(result);
+}
+
+/* LOG_CONTEXT_BORROWED_BINARY_PROPERTY */
+
+/* Tests_SRS_LOG_CONTEXT_01_051: [ LOG_CONTEXT_BORROWED_BINARY_PROPERTY shall expand to code allocating a property/value pair with the name property_name. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_052: [ In a context defined by LOG_CONTEXT_LOCAL_DEFINE, LOG_CONTEXT_BORROWED_BINARY_PROPERTY shall expand to code that stores a value of type borrowed_binary holding only the pointer data and length, by calling LOG_CONTEXT_PROPERTY_TYPE_INIT(borrowed_binary), without copying the bytes. ]*/
+static void LOG_CONTEXT_LOCAL_DEFINE_with_a_borrowed_binary_property_does_not_copy_the_bytes(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_LOCAL_DEFINE(local_context, NULL,
+        LOG_CONTEXT_BORROWED_BINARY_PROPERTY(header, test_binary_data, sizeof(test_binary_data))
+    );
+
+    // assert
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(&local_context) == 2);
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(&local_context) == 1 + sizeof(BORROWED_BINARY));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(&local_context);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "header") == 0);
+    POOR_MANS_ASSERT(pairs[1].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary);
+    BORROWED_BINARY borrowed;
+    (void)memcpy(&borrowed, pairs[1].value, sizeof(BORROWED_BINARY));
+    POOR_MANS_ASSERT(borrowed.data == test_binary_data);
+    POOR_MANS_ASSERT(borrowed.length == sizeof(test_binary_data));
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_051: [ LOG_CONTEXT_BORROWED_BINARY_PROPERTY shall expand to code allocating a property/value pair with the name property_name. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_053: [ In a context created by LOG_CONTEXT_CREATE, LOG_CONTEXT_BORROWED_BINARY_PROPERTY shall expand to code that copies the bytes in the context data area by calling LOG_CONTEXT_PROPERTY_TYPE_FILL(binary) and stores a property/value pair of type binary and the name property_name. ]*/
+static void LOG_CONTEXT_CREATE_with_a_borrowed_binary_property_copies_the_bytes(void)
+{
+    // arrange
+    setup_mocks();
+    setup_malloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, NULL,
+        LOG_CONTEXT_BORROWED_BINARY_PROPERTY(header, test_binary_data, sizeof(test_binary_data))
+    );
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(result) == 1 + sizeof(uint16_t) + sizeof(test_binary_data));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "header") == 0);
+    POOR_MANS_ASSERT(pairs[1].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_binary);
+    assert_binary_value(pairs[1].value, test_binary_data, sizeof(test_binary_data));
+
+    // clean
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(result);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_054: [ If the bytes do not fit in the space left, LOG_CONTEXT_BORROWED_BINARY_PROPERTY shall expand to code that calls internal_log_context_reserve to make room for the bytes and copies the bytes again. ]*/
+static void LOG_CONTEXT_CREATE_with_a_borrowed_binary_property_longer_than_the_slack_reallocates_the_context(void)
+{
+    // arrange
+    uint8_t long_data[LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE * 3];
+    for (size_t i = 0; i < sizeof(long_data); i++)
+    {
+        long_data[i] = (uint8_t)i;
+    }
+
+    setup_mocks();
+    setup_malloc_call();
+    setup_realloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, NULL,
+        LOG_CONTEXT_BORROWED_BINARY_PROPERTY(long_data, long_data, sizeof(long_data))
+    );
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(result) == 1 + sizeof(uint16_t) + sizeof(long_data));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(pairs[1].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_binary);
+    assert_binary_value(pairs[1].value, long_data, sizeof(long_data));
+
+    // clean
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(result);
+}
+
+/* LOG_CONTEXT_ARRAY_PROPERTY */
+
+static const uint32_t test_shard_ids[] = { 3, 14, 15, 92, 65 };
+
+/* Tests_SRS_LOG_CONTEXT_01_055: [ LOG_CONTEXT_ARRAY_PROPERTY shall expand to code allocating a property/value pair of type {element_type}_array and the name property_name. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_056: [ LOG_CONTEXT_ARRAY_PROPERTY shall expand to code that copies the count and the count values at values in the context data area by calling LOG_CONTEXT_PROPERTY_TYPE_FILL({element_type}_array). ]*/
+static void LOG_CONTEXT_LOCAL_DEFINE_with_an_array_property_copies_the_values(void)
+{
+    // arrange
+    setup_mocks();
+
+    // act
+    LOG_CONTEXT_LOCAL_DEFINE(local_context, NULL,
+        LOG_CONTEXT_ARRAY_PROPERTY(uint32_t, shard_ids, test_shard_ids, sizeof(test_shard_ids) / sizeof(test_shard_ids[0])),
+        LOG_CONTEXT_PROPERTY(int32_t, x, 42)
+    );
+
+    // assert
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(&local_context) == 3);
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(&local_context) == 1 + sizeof(uint16_t) + sizeof(test_shard_ids) + sizeof(int32_t));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(&local_context);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 2);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "shard_ids") == 0);
+    POOR_MANS_ASSERT(pairs[1].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_uint32_t_array);
+    uint16_t count;
+    (void)memcpy(&count, pairs[1].value, sizeof(uint16_t));
+    POOR_MANS_ASSERT(count == sizeof(test_shard_ids) / sizeof(test_shard_ids[0]));
+    POOR_MANS_ASSERT(memcmp((const uint8_t*)pairs[1].value + sizeof(uint16_t), test_shard_ids, sizeof(test_shard_ids)) == 0);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[2].value == 42);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_CONTEXT_01_055: [ LOG_CONTEXT_ARRAY_PROPERTY shall expand to code allocating a property/value pair of type {element_type}_array and the name property_name. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_056: [ LOG_CONTEXT_ARRAY_PROPERTY shall expand to code that copies the count and the count values at values in the context data area by calling LOG_CONTEXT_PROPERTY_TYPE_FILL({element_type}_array). ]*/
+static void LOG_CONTEXT_CREATE_with_an_array_property_allocates_the_exact_size(void)
+{
+    // arrange
+    static const int64_t counters[] = { -1, 0, INT64_MAX };
+    setup_mocks();
+    setup_malloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, NULL,
+        LOG_CONTEXT_ARRAY_PROPERTY(int64_t, counters, counters, 3)
+    );
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[0].malloc_call.size == sizeof(LOG_CONTEXT) + 2 * sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) + 1 + sizeof(uint16_t) + sizeof(counters));
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(result) == 1 + sizeof(uint16_t) + sizeof(counters));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(strcmp(pairs[1].name, "counters") == 0);
+    POOR_MANS_ASSERT(pairs[1].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_int64_t_array);
+    char buffer[64];
+    POOR_MANS_ASSERT(pairs[1].type->to_string(pairs[1].value, buffer, sizeof(buffer)) == 26);
+    POOR_MANS_ASSERT(strcmp(buffer, "[-1,0,9223372036854775807]") == 0);
+
+    // clean
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(result);
+}
+
 /* LOG_CONTEXT_WSTRING_PROPERTY */
 
 /* Tests_SRS_LOG_CONTEXT_07_001: [ LOG_CONTEXT_WSTRING_PROPERTY shall expand to code allocating a property/value pair of type wchar_t_ptr and the name property_name. ]*/
@@ -863,6 +1570,71 @@ static void LOG_CONTEXT_CREATE_with_a_wstring_property_preceded_by_another_int_p
     LOG_CONTEXT_DESTROY(result);
 }
 
+/* Tests_SRS_LOG_CONTEXT_07_003: [ LOG_CONTEXT_WSTRING_PROPERTY shall expand to code that formats the string directly in the space left in the context data area, by calling LOG_CONTEXT_PROPERTY_TYPE_FILL(wchar_t_ptr). ]*/
+/* Tests_SRS_LOG_CONTEXT_07_005: [ LOG_CONTEXT_CREATE shall reserve LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE * sizeof(wchar_t) bytes for each LOG_CONTEXT_WSTRING_PROPERTY. ]*/
+/* Tests_SRS_LOG_CONTEXT_01_035: [ LOG_CONTEXT_CREATE shall set the values data length of the context to the number of bytes actually used by the property values. ]*/
+static void LOG_CONTEXT_CREATE_with_a_wstring_property_reserves_slack_and_uses_only_the_needed_bytes(void)
+{
+    // arrange
+    setup_mocks();
+    setup_malloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, NULL, LOG_CONTEXT_WSTRING_PROPERTY(test_string, L"%ls", L"gogu"));
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[0].malloc_call.size == sizeof(LOG_CONTEXT) + 2 * sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) + 1 + LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE * sizeof(wchar_t));
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(result) == 1 + sizeof(L"gogu"));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(wcscmp(pairs[1].value, L"gogu") == 0);
+
+    // clean
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(result);
+}
+
+/* Tests_SRS_LOG_CONTEXT_07_004: [ If the formatted string does not fit in the space left, LOG_CONTEXT_WSTRING_PROPERTY shall expand to code that calls internal_log_context_reserve to make room for the string and formats the string again. ]*/
+static void LOG_CONTEXT_CREATE_with_a_wstring_property_longer_than_the_slack_reallocates_the_context(void)
+{
+    // arrange
+    wchar_t long_string[LOG_CONTEXT_PROPERTY_DATA_SLACK_SIZE * 3] = { 0 };
+    (void)wmemset(long_string, L'a', MU_COUNT_ARRAY_ITEMS(long_string) - 1);
+
+    setup_mocks();
+    setup_malloc_call();
+    setup_realloc_call();
+
+    // act
+    LOG_CONTEXT_HANDLE result;
+    LOG_CONTEXT_CREATE(result, NULL,
+        LOG_CONTEXT_WSTRING_PROPERTY(short_string, L"gogu"),
+        LOG_CONTEXT_WSTRING_PROPERTY(long_string, L"%ls", long_string),
+        LOG_CONTEXT_PROPERTY(int32_t, x, 42)
+    );
+
+    // assert
+    POOR_MANS_ASSERT(result != NULL);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(internal_log_context_get_values_data_length_or_zero(result) == 1 + sizeof(L"gogu") + sizeof(long_string) + sizeof(int32_t));
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(result);
+    POOR_MANS_ASSERT(*(uint8_t*)pairs[0].value == 3);
+    POOR_MANS_ASSERT(wcscmp(pairs[1].value, L"gogu") == 0);
+    POOR_MANS_ASSERT(wcscmp(pairs[2].value, long_string) == 0);
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "long_string") == 0);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[3].value == 42);
+
+    // clean
+    setup_mocks();
+    setup_free_call();
+    LOG_CONTEXT_DESTROY(result);
+}
+
 /* LOG_CONTEXT_NAME */
 
 /* Tests_SRS_LOG_CONTEXT_01_013: [ LOG_CONTEXT_CREATE shall store one property/value pair that with a property type of struct with as many fields as the total number of properties passed to LOG_CONTEXT_CREATE. ]*/
@@ -2187,18 +2959,41 @@ int main(void)
 
     LOG_CONTEXT_CREATE_CUSTOM_FUNCTION_succeeds();
     LOG_CONTEXT_CREATE_CUSTOM_FUNCTION_with_two_properties_succeeds();
+    LOG_CONTEXT_CREATE_CUSTOM_FUNCTION_that_needs_more_than_the_slack_reallocates_the_context();
+    LOG_CONTEXT_CREATE_CUSTOM_FUNCTION_that_reallocates_sees_the_same_errno_on_both_calls();
+    when_realloc_fails_LOG_CONTEXT_CREATE_CUSTOM_FUNCTION_also_fails();
+    LOG_CONTEXT_LOCAL_DEFINE_CUSTOM_FUNCTION_calls_the_function_once();
+    LOG_CONTEXT_LOCAL_DEFINE_CUSTOM_FUNCTION_that_needs_too_much_memory_reports_error();
 
     LOG_CONTEXT_CREATE_with_one_string_property_with_only_format_passed_to_it_succeeds();
     LOG_CONTEXT_CREATE_with_2_string_properties_with_only_format_passed_to_it_succeeds();
     LOG_CONTEXT_CREATE_with_a_string_property_using_printf_formatting_succeeds();
     LOG_CONTEXT_CREATE_with_a_string_property_followed_by_another_int_property_succeeds();
     LOG_CONTEXT_CREATE_with_a_string_property_preceded_by_another_int_property_succeeds();
+    LOG_CONTEXT_CREATE_with_a_string_property_reserves_slack_and_uses_only_the_needed_bytes();
+    LOG_CONTEXT_CREATE_with_a_string_property_longer_than_the_slack_reallocates_the_context();
+
+    LOG_CONTEXT_LOCAL_DEFINE_with_a_borrowed_string_property_does_not_copy_the_string();
+    LOG_CONTEXT_CREATE_with_a_borrowed_string_property_copies_the_string();
+    LOG_CONTEXT_CREATE_with_a_borrowed_string_property_longer_than_the_slack_reallocates_the_context();
+    LOG_CONTEXT_LOCAL_DEFINE_with_a_parent_that_has_a_borrowed_string_property_keeps_it_borrowed();
+
+    LOG_CONTEXT_LOCAL_DEFINE_with_a_binary_property_copies_the_bytes();
+    LOG_CONTEXT_CREATE_with_a_binary_property_allocates_the_exact_size();
+    LOG_CONTEXT_LOCAL_DEFINE_with_a_borrowed_binary_property_does_not_copy_the_bytes();
+    LOG_CONTEXT_CREATE_with_a_borrowed_binary_property_copies_the_bytes();
+    LOG_CONTEXT_CREATE_with_a_local_parent_that_has_borrowed_values_copies_them();
+    LOG_CONTEXT_CREATE_with_a_borrowed_binary_property_longer_than_the_slack_reallocates_the_context();
+    LOG_CONTEXT_LOCAL_DEFINE_with_an_array_property_copies_the_values();
+    LOG_CONTEXT_CREATE_with_an_array_property_allocates_the_exact_size();
 
     LOG_CONTEXT_CREATE_with_one_wstring_property_with_only_format_passed_to_it_succeeds();
     LOG_CONTEXT_CREATE_with_2_wstring_properties_with_only_format_passed_to_it_succeeds();
     LOG_CONTEXT_CREATE_with_a_wstring_property_using_printf_formatting_succeeds();
     LOG_CONTEXT_CREATE_with_a_wstring_property_followed_by_another_int_property_succeeds();
     LOG_CONTEXT_CREATE_with_a_wstring_property_preceded_by_another_int_property_succeeds();
+    LOG_CONTEXT_CREATE_with_a_wstring_property_reserves_slack_and_uses_only_the_needed_bytes();
+    LOG_CONTEXT_CREATE_with_a_wstring_property_longer_than_the_slack_reallocates_the_context();
 
     LOG_CONTEXT_CREATE_with_LOG_CONTEXT_NAME_uses_the_context_name();
 
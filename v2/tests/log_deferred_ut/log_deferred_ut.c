@@ -0,0 +1,528 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#ifdef _WIN32
+#include "windows.h"
+#else
+#include <pthread.h>
+#endif
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context.h"
+#include "c_logging/log_level.h"
+#include "c_logging/log_sink_if.h"
+#include "c_logging/log_timestamp.h"
+#include "c_logging/logger.h"
+
+#include "c_logging/log_deferred.h"
+
+// The messages reach the sinks through logger_log, a test sink records what it gets so that it can be compared
+// with what snprintf makes of the same format and arguments.
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+#define MAX_CAPTURED_MESSAGES 16
+
+#define SHORT_LIVED_THREAD_COUNT 32
+
+typedef struct CAPTURED_MESSAGE_TAG
+{
+    LOG_LEVEL log_level;
+    const char* file;
+    const char* func;
+    int line;
+    int64_t time; // log_timestamp_now as seen by the sink
+    char message[LOG_MAX_MESSAGE_LENGTH];
+} CAPTURED_MESSAGE;
+
+static CAPTURED_MESSAGE captured_messages[MAX_CAPTURED_MESSAGES];
+static size_t captured_message_count;
+static CAPTURED_MESSAGE last_captured_message;
+
+static int test_sink_init(void)
+{
+    return 0;
+}
+
+static void test_sink_log(LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context, const char* file, const char* func, int line, const char* message_format, va_list args)
+{
+    (void)log_context;
+
+    // the first messages and the last one are kept, the others are just counted
+    last_captured_message.log_level = log_level;
+    last_captured_message.file = file;
+    last_captured_message.func = func;
+    last_captured_message.line = line;
+    last_captured_message.time = log_timestamp_now();
+    (void)vsnprintf(last_captured_message.message, sizeof(last_captured_message.message), message_format, args);
+
+    if (captured_message_count < MAX_CAPTURED_MESSAGES)
+    {
+        captured_messages[captured_message_count] = last_captured_message;
+    }
+    captured_message_count++;
+}
+
+static void test_sink_deinit(void)
+{
+}
+
+static const LOG_SINK_IF test_sink = { test_sink_init, test_sink_log, test_sink_deinit };
+static const LOG_SINK_IF* test_sinks[] = { &test_sink };
+
+static void setup(void)
+{
+    captured_message_count = 0;
+    (void)log_deferred_flush();
+    captured_message_count = 0;
+}
+
+static void assert_captured_message(size_t index, LOG_LEVEL log_level, const char* expected_format, ...)
+{
+    char expected[LOG_MAX_MESSAGE_LENGTH];
+    va_list args;
+
+    va_start(args, expected_format);
+    (void)vsnprintf(expected, sizeof(expected), expected_format, args);
+    va_end(args);
+
+    POOR_MANS_ASSERT(index < captured_message_count);
+    POOR_MANS_ASSERT(captured_messages[index].log_level == log_level);
+    if (strcmp(captured_messages[index].message, expected) != 0)
+    {
+        (void)printf("expected \"%s\", got \"%s\"\r\n", expected, captured_messages[index].message);
+        POOR_MANS_ASSERT(0);
+    }
+}
+
+/* log_deferred_site_is_deferred */
+
+/* Tests_SRS_LOG_DEFERRED_01_005: [ If site is NULL, log_deferred_site_is_deferred shall fail and return false. ]*/
+static void log_deferred_site_is_deferred_with_NULL_site_returns_false(void)
+{
+    // arrange
+
+    // act
+    bool result = log_deferred_site_is_deferred(NULL);
+
+    // assert
+    POOR_MANS_ASSERT(!result);
+}
+
+/* Tests_SRS_LOG_DEFERRED_01_006: [ On the first call for a site, log_deferred_site_is_deferred shall check the format of the site without taking a lock. ]*/
+/* Tests_SRS_LOG_DEFERRED_01_007: [ The site shall be deferred if the number of arguments is at most LOG_DEFERRED_MAX_ARG_COUNT, each argument is used by exactly one conversion and each conversion can be formatted from the captured value (integers, doubles, strings, pointers and %m; not %n, %lc, %ls, positional arguments or grouping). ]*/
+/* Tests_SRS_LOG_DEFERRED_01_008: [ log_deferred_site_is_deferred shall return true if the site is deferred and false otherwise (including while another thread checks the site). ]*/
+static void log_deferred_site_is_deferred_checks_the_format(void)
+{
+    // arrange
+    static const uint8_t int_string_types[] = { LOG_DEFERRED_ARG_TYPE_INT, LOG_DEFERRED_ARG_TYPE_STRING };
+    static const uint8_t int_types[] = { LOG_DEFERRED_ARG_TYPE_INT, LOG_DEFERRED_ARG_TYPE_INT };
+    static const uint8_t pointer_types[] = { LOG_DEFERRED_ARG_TYPE_POINTER };
+    static const uint8_t double_types[] = { LOG_DEFERRED_ARG_TYPE_DOUBLE };
+    LOG_DEFERRED_SITE deferred_sites[] =
+    {
+        { "%d %s", __FILE__, __FUNCTION__, __LINE__, 2, int_string_types },
+        { "%*d", __FILE__, __FUNCTION__, __LINE__, 2, int_types },
+        { "%-8.3s%%", __FILE__, __FUNCTION__, __LINE__, 1, &int_string_types[1] },
+        { "%p", __FILE__, __FUNCTION__, __LINE__, 1, &int_string_types[1] },
+        { "%p", __FILE__, __FUNCTION__, __LINE__, 1, pointer_types },
+        { "%.3f", __FILE__, __FUNCTION__, __LINE__, 1, double_types },
+        { "%m no arguments", __FILE__, __FUNCTION__, __LINE__, 0, &int_types[2] },
+    };
+    LOG_DEFERRED_SITE immediate_sites[] =
+    {
+        { "%d %n", __FILE__, __FUNCTION__, __LINE__, 2, int_types },
+        { "%2$d %1$d", __FILE__, __FUNCTION__, __LINE__, 2, int_types },
+        { "%'d", __FILE__, __FUNCTION__, __LINE__, 1, int_types },
+        { "%ls", __FILE__, __FUNCTION__, __LINE__, 1, pointer_types },
+        { "%d", __FILE__, __FUNCTION__, __LINE__, 2, int_types },
+        { "%d %d", __FILE__, __FUNCTION__, __LINE__, 1, int_types },
+        { "%s", __FILE__, __FUNCTION__, __LINE__, 1, int_types },
+        { "%d", __FILE__, __FUNCTION__, __LINE__, 1, double_types },
+        { "%f", __FILE__, __FUNCTION__, __LINE__, 1, int_types },
+        { "%*d", __FILE__, __FUNCTION__, __LINE__, 2, double_types },
+        { "%d", __FILE__, __FUNCTION__, __LINE__, LOG_DEFERRED_MAX_ARG_COUNT + 1, int_types },
+    };
+
+    for (size_t i = 0; i < MU_COUNT_ARRAY_ITEMS(deferred_sites); i++)
+    {
+        // act
+        bool result = log_deferred_site_is_deferred(&deferred_sites[i]);
+
+        // assert
+        POOR_MANS_ASSERT(result);
+        POOR_MANS_ASSERT(deferred_sites[i].state == LOG_DEFERRED_SITE_STATE_DEFERRED);
+        POOR_MANS_ASSERT(log_deferred_site_is_deferred(&deferred_sites[i]));
+    }
+
+    for (size_t i = 0; i < MU_COUNT_ARRAY_ITEMS(immediate_sites); i++)
+    {
+        // act
+        bool result = log_deferred_site_is_deferred(&immediate_sites[i]);
+
+        // assert
+        POOR_MANS_ASSERT(!result);
+        POOR_MANS_ASSERT(immediate_sites[i].state == LOG_DEFERRED_SITE_STATE_IMMEDIATE);
+    }
+}
+
+/* Tests_SRS_LOG_DEFERRED_01_008: [ log_deferred_site_is_deferred shall return true if the site is deferred and false otherwise (including while another thread checks the site). ]*/
+static void log_deferred_site_is_deferred_while_the_site_is_checked_returns_false(void)
+{
+    // arrange
+    static const uint8_t int_types[] = { LOG_DEFERRED_ARG_TYPE_INT };
+    LOG_DEFERRED_SITE site = { "%d", __FILE__, __FUNCTION__, __LINE__, 1, int_types };
+    site.state = LOG_DEFERRED_SITE_STATE_CHECKING;
+
+    // act
+    bool result = log_deferred_site_is_deferred(&site);
+
+    // assert
+    POOR_MANS_ASSERT(!result);
+    POOR_MANS_ASSERT(site.state == LOG_DEFERRED_SITE_STATE_CHECKING);
+}
+
+/* log_deferred_log */
+
+/* Tests_SRS_LOG_DEFERRED_01_009: [ If site is NULL, log_deferred_log shall return. ]*/
+static void log_deferred_log_with_NULL_site_returns(void)
+{
+    // arrange
+    setup();
+
+    // act
+    log_deferred_log(NULL, LOG_LEVEL_ERROR, 42);
+
+    // assert
+    POOR_MANS_ASSERT(log_deferred_flush() == 0);
+    POOR_MANS_ASSERT(captured_message_count == 0);
+}
+
+/* Tests_SRS_LOG_DEFERRED_01_010: [ If site is not deferred, log_deferred_log shall return. ]*/
+static void log_deferred_log_with_a_site_that_was_not_checked_returns(void)
+{
+    // arrange
+    static const uint8_t int_types[] = { LOG_DEFERRED_ARG_TYPE_INT };
+    LOG_DEFERRED_SITE site = { "%d", __FILE__, __FUNCTION__, __LINE__, 1, int_types };
+    setup();
+
+    // act
+    log_deferred_log(&site, LOG_LEVEL_ERROR, 42);
+
+    // assert
+    POOR_MANS_ASSERT(log_deferred_flush() == 0);
+    POOR_MANS_ASSERT(captured_message_count == 0);
+}
+
+/* LOGGER_LOG_DEFERRED */
+
+/* Tests_SRS_LOG_DEFERRED_01_001: [ LOGGER_LOG_DEFERRED shall generate code that verifies at compile time that format and ... are suitable to be passed as arguments to printf. ]*/
+/* Tests_SRS_LOG_DEFERRED_01_002: [ LOGGER_LOG_DEFERRED shall define a static call site with format, file, function, line, the number of arguments and the type of each argument obtained at compile time with _Generic. ]*/
+/* Tests_SRS_LOG_DEFERRED_01_003: [ If log_deferred_site_is_deferred returns true, LOGGER_LOG_DEFERRED shall call log_deferred_log with the call site, log_level and the arguments. ]*/
+/* Tests_SRS_LOG_DEFERRED_01_012: [ log_deferred_log shall build a record made of the site, log_level, the value of errno and the value of each argument as given by the argument kinds of the site. ]*/
+/* Tests_SRS_LOG_DEFERRED_01_020: [ log_deferred_flush shall format the message of each record by copying the text of the format and formatting each conversion with log_snprintf from the captured values. ]*/
+/* Tests_SRS_LOG_DEFERRED_01_021: [ log_deferred_flush shall pass the message to the sinks by calling logger_log with the level, file, function and line of the site and no context. ]*/
+/* Tests_SRS_LOG_DEFERRED_01_023: [ log_deferred_flush shall return the number of records formatted. ]*/
+static void LOGGER_LOG_DEFERRED_formats_the_captured_values_on_flush(void)
+{
+    // arrange
+    char text[] = "changed after the call";
+    short small = -7;
+    float ratio = 0.25f;
+    int line;
+    setup();
+
+    // act
+    LOGGER_LOG_DEFERRED(LOG_LEVEL_INFO, "no arguments"); line = __LINE__;
+    LOGGER_LOG_DEFERRED(LOG_LEVEL_ERROR, "%d %i %u %x %hd %c", -1, 2, 3u, 0xabcu, small, 'z');
+    LOGGER_LOG_DEFERRED(LOG_LEVEL_WARNING, "%ld %lu %lld %llu %zu", -4L, 5UL, -6LL, 18446744073709551615ULL, (size_t)7);
+    LOGGER_LOG_DEFERRED(LOG_LEVEL_VERBOSE, "%.3f %e %g %Lf %5.1f", 3.14159, 1e10, 0.5, 2.5L, ratio);
+    LOGGER_LOG_DEFERRED(LOG_LEVEL_CRITICAL, "[%s] [%10s] [%-4.2s] [%*d] [%.*s] 100%%", text, "right", "left", 6, 42, 3, "precision");
+    LOGGER_LOG_DEFERRED(LOG_LEVEL_INFO, "%p %p", (void*)text, (const char*)text);
+    (void)memcpy(text, "CHANGED", 7);
+
+    int result = log_deferred_flush();
+
+    // assert
+    POOR_MANS_ASSERT(result == 6);
+    POOR_MANS_ASSERT(captured_message_count == 6);
+    assert_captured_message(0, LOG_LEVEL_INFO, "no arguments");
+    POOR_MANS_ASSERT(strcmp(captured_messages[0].file, __FILE__) == 0);
+    POOR_MANS_ASSERT(strcmp(captured_messages[0].func, __FUNCTION__) == 0);
+    POOR_MANS_ASSERT(captured_messages[0].line == line);
+    assert_captured_message(1, LOG_LEVEL_ERROR, "%d %i %u %x %hd %c", -1, 2, 3u, 0xabcu, small, 'z');
+    assert_captured_message(2, LOG_LEVEL_WARNING, "%ld %lu %lld %llu %zu", -4L, 5UL, -6LL, 18446744073709551615ULL, (size_t)7);
+    assert_captured_message(3, LOG_LEVEL_VERBOSE, "%.3f %e %g %Lf %5.1f", 3.14159, 1e10, 0.5, 2.5L, ratio);
+    assert_captured_message(4, LOG_LEVEL_CRITICAL, "[%s] [%10s] [%-4.2s] [%*d] [%.*s] 100%%", "changed after the call", "right", "left", 6, 42, 3, "precision");
+    assert_captured_message(5, LOG_LEVEL_INFO, "%p %p", (void*)text, (void*)text);
+}
+
+/* Tests_SRS_LOG_DEFERRED_01_004: [ Otherwise LOGGER_LOG_DEFERRED shall log the message right away by calling logger_log. ]*/
+static void LOGGER_LOG_DEFERRED_with_a_format_that_cannot_be_deferred_logs_right_away(void)
+{
+    // arrange
+    int count = 0;
+    setup();
+
+    // act
+    LOGGER_LOG_DEFERRED(LOG_LEVEL_ERROR, "%d%n", 1234, &count);
+    LOGGER_LOG_DEFERRED(LOG_LEVEL_ERROR, "%2$s %1$s", "world", "hello");
+
+    // assert
+    POOR_MANS_ASSERT(captured_message_count == 2);
+    assert_captured_message(0, LOG_LEVEL_ERROR, "1234");
+    assert_captured_message(1, LOG_LEVEL_ERROR, "hello world");
+    POOR_MANS_ASSERT(log_deferred_flush() == 0);
+}
+
+/* Tests_SRS_LOG_DEFERRED_01_012: [ log_deferred_log shall build a record made of the site, log_level, the value of errno and the value of each argument as given by the argument kinds of the site. ]*/
+static void LOGGER_LOG_DEFERRED_formats_m_with_errno_as_it_was_at_the_call(void)
+{
+    // arrange
+    setup();
+
+    // act
+    errno = ENOENT;
+    LOGGER_LOG_DEFERRED(LOG_LEVEL_ERROR, "open failed: %m (%d)", 3);
+    errno = 0;
+    (void)log_deferred_flush();
+
+    // assert
+    POOR_MANS_ASSERT(captured_message_count == 1);
+    assert_captured_message(0, LOG_LEVEL_ERROR, "open failed: %s (3)", strerror(ENOENT));
+}
+
+/* Tests_SRS_LOG_DEFERRED_01_025: [ log_deferred_log shall store in the record the ticks obtained by calling log_timestamp_ticks. ]*/
+/* Tests_SRS_LOG_DEFERRED_01_026: [ log_deferred_flush shall refresh the mapping of ticks to wall clock time by calling log_timestamp_calibrate. ]*/
+/* Tests_SRS_LOG_DEFERRED_01_027: [ log_deferred_flush shall call log_timestamp_begin_record with the ticks of the record before calling logger_log and log_timestamp_end_record after. ]*/
+static void LOGGER_LOG_DEFERRED_sinks_see_the_time_of_the_call(void)
+{
+    // arrange
+    setup();
+    int64_t before_call = log_timestamp_now();
+    LOGGER_LOG_DEFERRED(LOG_LEVEL_INFO, "%d", 42);
+    int64_t after_call = log_timestamp_now();
+
+    // let 10 ms pass between the call and the flush
+    int64_t now;
+    do
+    {
+        now = log_timestamp_now();
+    } while (now - after_call < 10000000);
+
+    // act
+    (void)log_deferred_flush();
+
+    // assert
+    POOR_MANS_ASSERT(captured_message_count == 1);
+    assert_captured_message(0, LOG_LEVEL_INFO, "42");
+    // the flush may have moved the mapping of the counter to the wall clock a little
+    POOR_MANS_ASSERT(captured_messages[0].time >= before_call - 1000000);
+    POOR_MANS_ASSERT(captured_messages[0].time <= after_call + 1000000);
+    POOR_MANS_ASSERT(log_timestamp_now() >= now);
+}
+
+/* Tests_SRS_LOG_DEFERRED_01_013: [ log_deferred_log shall copy the strings in the record, truncated so that the record has at most LOG_DEFERRED_MAX_RECORD_SIZE bytes. ]*/
+static void LOGGER_LOG_DEFERRED_with_NULL_and_long_strings(void)
+{
+    // arrange
+    static char long_string[2 * LOG_DEFERRED_MAX_RECORD_SIZE];
+    const char* null_string = NULL;
+    (void)memset(long_string, 'a', sizeof(long_string) - 1);
+    setup();
+
+    // act
+    LOGGER_LOG_DEFERRED(LOG_LEVEL_ERROR, "%s|%d", null_string, 1);
+    LOGGER_LOG_DEFERRED(LOG_LEVEL_ERROR, "%s|%d", long_string, 2);
+    (void)log_deferred_flush();
+
+    // assert
+    POOR_MANS_ASSERT(captured_message_count == 2);
+    assert_captured_message(0, LOG_LEVEL_ERROR, "%s|%d", null_string, 1);
+
+    const char* separator = strchr(captured_messages[1].message, '|');
+    POOR_MANS_ASSERT(separator != NULL);
+    POOR_MANS_ASSERT(strcmp(separator, "|2") == 0);
+    size_t kept_length = (size_t)(separator - captured_messages[1].message);
+    POOR_MANS_ASSERT(kept_length > LOG_DEFERRED_MAX_RECORD_SIZE / 2);
+    POOR_MANS_ASSERT(kept_length < LOG_DEFERRED_MAX_RECORD_SIZE);
+    POOR_MANS_ASSERT(strncmp(captured_messages[1].message, long_string, kept_length) == 0);
+}
+
+/* Tests_SRS_LOG_DEFERRED_01_011: [ On the first call from a thread, log_deferred_log shall allocate a buffer of LOG_DEFERRED_THREAD_BUFFER_SIZE bytes for the thread and add it to the list of thread buffers without taking a lock. ]*/
+/* Tests_SRS_LOG_DEFERRED_01_016: [ log_deferred_log shall copy the record in the buffer of the calling thread without taking a lock. ]*/
+/* Tests_SRS_LOG_DEFERRED_01_019: [ log_deferred_flush shall consume the records of each buffer in the order they were made. ]*/
+static void LOGGER_LOG_DEFERRED_records_wrap_around_the_buffer(void)
+{
+    // arrange
+    uint32_t dropped_before = log_deferred_get_dropped_count();
+    setup();
+
+    // act
+    // records of different sizes, several times around the buffer
+    for (int i = 0; i < 2000; i++)
+    {
+        LOGGER_LOG_DEFERRED(LOG_LEVEL_INFO, "%d %s", i, ((i % 3) == 0) ? "some padding text to vary the size of the records" : "");
+        if ((i % 7) == 6)
+        {
+            POOR_MANS_ASSERT(log_deferred_flush() == 7);
+            POOR_MANS_ASSERT(captured_message_count == 7);
+            for (int j = 0; j < 7; j++)
+            {
+                int value = i - 6 + j;
+                assert_captured_message((size_t)j, LOG_LEVEL_INFO, "%d %s", value, ((value % 3) == 0) ? "some padding text to vary the size of the records" : "");
+            }
+            captured_message_count = 0;
+        }
+    }
+
+    // assert
+    POOR_MANS_ASSERT(log_deferred_flush() == 5);
+    POOR_MANS_ASSERT(log_deferred_get_dropped_count() == dropped_before);
+}
+
+/* Tests_SRS_LOG_DEFERRED_01_015: [ If the buffer of the thread does not have room for the record, log_deferred_log shall drop the record and count it as dropped. ]*/
+/* Tests_SRS_LOG_DEFERRED_01_024: [ log_deferred_get_dropped_count shall return the number of records dropped since the start of the process. ]*/
+static void LOGGER_LOG_DEFERRED_when_the_buffer_is_full_drops_records(void)
+{
+    // arrange
+    static char record_filler[LOG_DEFERRED_MAX_RECORD_SIZE];
+    uint32_t record_count = (LOG_DEFERRED_THREAD_BUFFER_SIZE / LOG_DEFERRED_MAX_RECORD_SIZE) + 5;
+    uint32_t dropped_before = log_deferred_get_dropped_count();
+    (void)memset(record_filler, 'b', sizeof(record_filler) - 1);
+    setup();
+
+    // act
+    // every record takes LOG_DEFERRED_MAX_RECORD_SIZE bytes, so at most LOG_DEFERRED_THREAD_BUFFER_SIZE / LOG_DEFERRED_MAX_RECORD_SIZE of them fit
+    // (one less when the end of the buffer has to be skipped)
+    for (uint32_t i = 0; i < record_count; i++)
+    {
+        LOGGER_LOG_DEFERRED(LOG_LEVEL_INFO, "%s", record_filler);
+    }
+    uint32_t dropped = log_deferred_get_dropped_count() - dropped_before;
+    int result = log_deferred_flush();
+
+    // assert
+    POOR_MANS_ASSERT(dropped >= 5);
+    POOR_MANS_ASSERT(dropped <= 6);
+    POOR_MANS_ASSERT((uint32_t)result + dropped == record_count);
+    POOR_MANS_ASSERT(captured_message_count == (size_t)result + 1);
+    // the string is truncated to fit in a record
+    POOR_MANS_ASSERT(strlen(captured_messages[MAX_CAPTURED_MESSAGES - 1].message) > LOG_DEFERRED_MAX_RECORD_SIZE / 2);
+    POOR_MANS_ASSERT(strncmp(captured_messages[MAX_CAPTURED_MESSAGES - 1].message, record_filler, strlen(captured_messages[MAX_CAPTURED_MESSAGES - 1].message)) == 0);
+}
+
+/* Tests_SRS_LOG_DEFERRED_01_022: [ If records were dropped since the previous call, log_deferred_flush shall log a warning with the number of dropped records. ]*/
+static void log_deferred_flush_logs_a_warning_with_the_number_of_dropped_records(void)
+{
+    // arrange
+    static char record_filler[LOG_DEFERRED_MAX_RECORD_SIZE];
+    char expected_warning[64];
+    uint32_t dropped_before = log_deferred_get_dropped_count();
+    (void)memset(record_filler, 'c', sizeof(record_filler) - 1);
+    setup();
+    for (uint32_t i = 0; i < (LOG_DEFERRED_THREAD_BUFFER_SIZE / LOG_DEFERRED_MAX_RECORD_SIZE) + 3; i++)
+    {
+        LOGGER_LOG_DEFERRED(LOG_LEVEL_INFO, "%s", record_filler);
+    }
+    (void)snprintf(expected_warning, sizeof(expected_warning), "%" PRIu32 " deferred log records were dropped", log_deferred_get_dropped_count() - dropped_before);
+
+    // act
+    int result = log_deferred_flush();
+
+    // assert
+    POOR_MANS_ASSERT(captured_message_count == (size_t)result + 1);
+    POOR_MANS_ASSERT(last_captured_message.log_level == LOG_LEVEL_WARNING);
+    POOR_MANS_ASSERT(strcmp(last_captured_message.message, expected_warning) == 0);
+
+    // nothing more was dropped, so the next flush has no warning
+    captured_message_count = 0;
+    POOR_MANS_ASSERT(log_deferred_flush() == 0);
+    POOR_MANS_ASSERT(captured_message_count == 0);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI log_one_deferred_record(LPVOID context)
+#else
+static void* log_one_deferred_record(void* context)
+#endif
+{
+    LOGGER_LOG_DEFERRED(LOG_LEVEL_INFO, "thread %d", *(int*)context);
+    return 0;
+}
+
+/* Tests_SRS_LOG_DEFERRED_01_011: [ If there is no such buffer, log_deferred_log shall allocate a buffer of LOG_DEFERRED_THREAD_BUFFER_SIZE bytes for the thread and add it to the list of thread buffers without taking a lock. ]*/
+/* Tests_SRS_LOG_DEFERRED_01_028: [ On the first call from a thread, log_deferred_log shall take a buffer whose thread exited and whose records were all consumed by log_deferred_flush, without taking a lock. ]*/
+/* Tests_SRS_LOG_DEFERRED_01_029: [ When a thread that has a buffer exits, the buffer shall be marked as no longer in use. ]*/
+/* Tests_SRS_LOG_DEFERRED_01_030: [ log_deferred_get_thread_buffer_count shall return the number of thread buffers allocated since the start of the process. ]*/
+static void LOGGER_LOG_DEFERRED_from_many_short_lived_threads_reuses_their_buffers(void)
+{
+    // arrange
+    uint32_t buffer_count_before = log_deferred_get_thread_buffer_count();
+    setup();
+
+    // act
+    for (int i = 0; i < SHORT_LIVED_THREAD_COUNT; i++)
+    {
+#ifdef _WIN32
+        HANDLE thread = CreateThread(NULL, 0, log_one_deferred_record, &i, 0, NULL);
+        POOR_MANS_ASSERT(thread != NULL);
+        POOR_MANS_ASSERT(WaitForSingleObject(thread, INFINITE) == WAIT_OBJECT_0);
+        (void)CloseHandle(thread);
+#else
+        pthread_t thread;
+        POOR_MANS_ASSERT(pthread_create(&thread, NULL, log_one_deferred_record, &i) == 0);
+        POOR_MANS_ASSERT(pthread_join(thread, NULL) == 0);
+#endif
+        POOR_MANS_ASSERT(log_deferred_flush() == 1);
+        assert_captured_message(0, LOG_LEVEL_INFO, "thread %d", i);
+        captured_message_count = 0;
+    }
+
+    // assert
+    // the first thread allocates a buffer, the others take it once it is flushed
+    POOR_MANS_ASSERT(log_deferred_get_thread_buffer_count() == buffer_count_before + 1);
+}
+
+int main(void)
+{
+    logger_set_config((LOGGER_CONFIG) { .log_sinks = test_sinks, .log_sink_count = MU_COUNT_ARRAY_ITEMS(test_sinks) });
+    POOR_MANS_ASSERT(logger_init() == 0);
+
+    log_deferred_site_is_deferred_with_NULL_site_returns_false();
+    log_deferred_site_is_deferred_checks_the_format();
+    log_deferred_site_is_deferred_while_the_site_is_checked_returns_false();
+
+    log_deferred_log_with_NULL_site_returns();
+    log_deferred_log_with_a_site_that_was_not_checked_returns();
+
+    LOGGER_LOG_DEFERRED_formats_the_captured_values_on_flush();
+    LOGGER_LOG_DEFERRED_with_a_format_that_cannot_be_deferred_logs_right_away();
+    LOGGER_LOG_DEFERRED_formats_m_with_errno_as_it_was_at_the_call();
+    LOGGER_LOG_DEFERRED_sinks_see_the_time_of_the_call();
+    LOGGER_LOG_DEFERRED_with_NULL_and_long_strings();
+    LOGGER_LOG_DEFERRED_records_wrap_around_the_buffer();
+    LOGGER_LOG_DEFERRED_when_the_buffer_is_full_drops_records();
+    log_deferred_flush_logs_a_warning_with_the_number_of_dropped_records();
+    LOGGER_LOG_DEFERRED_from_many_short_lived_threads_reuses_their_buffers();
+
+    logger_deinit();
+
+    return 0;
+}
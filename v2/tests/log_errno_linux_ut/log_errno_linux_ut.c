@@ -164,7 +164,7 @@ static void log_errno_fill_property_with_NULL_returns_needed_buffer_size(void)
     setup_mocks();
 
     // act
-    int result = log_errno_fill_property(NULL, 42);
+    int result = log_errno_fill_property(NULL, 0, 42);
 
     // assert
     POOR_MANS_ASSERT(result == 512);
@@ -173,8 +173,9 @@ static void log_errno_fill_property_with_NULL_returns_needed_buffer_size(void)
 }
 
 /* Tests_SRS_LOG_ERRNO_LINUX_01_003: [ Otherwise, log_errno_fill_property shall obtain the errno value. ] */
-/* Tests_SRS_LOG_ERRNO_LINUX_01_004: [ log_errno_fill_property shall call strerror_r with buffer, 512 and the errno value. ] */
-/* Tests_SRS_LOG_ERRNO_LINUX_01_007: [ log_errno_fill_property shall return 512. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_012: [ log_errno_fill_property shall call strerror_r with the errno value, a local buffer of 512 bytes and 512. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_014: [ If the string and its null terminator fit in buffer_size bytes, log_errno_fill_property shall copy them to buffer. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_015: [ log_errno_fill_property shall return the length of the string plus 1 for the null terminator. ] */
 static void log_errno_fill_property_with_non_NULL_formats_0(void)
 {
     // arrange
@@ -188,21 +189,22 @@ static void log_errno_fill_property_with_non_NULL_formats_0(void)
     expected_calls[1].strerror_r_call.buffer_payload = TEST_FORMATTED_errno_0;
 
     // act
-    int result = log_errno_fill_property(buffer, 42);
+    int result = log_errno_fill_property(buffer, sizeof(buffer), 42);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_errno_0));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_errnum == 0);
-    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buf == buffer);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buf != buffer);
     POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buflen == 512);
     POOR_MANS_ASSERT(strcmp(buffer, TEST_FORMATTED_errno_0) == 0);
 }
 
 /* Tests_SRS_LOG_ERRNO_LINUX_01_003: [ Otherwise, log_errno_fill_property shall obtain the errno value. ] */
-/* Tests_SRS_LOG_ERRNO_LINUX_01_004: [ log_errno_fill_property shall call strerror_r with buffer, 512 and the errno value. ] */
-/* Tests_SRS_LOG_ERRNO_LINUX_01_007: [ log_errno_fill_property shall return 512. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_012: [ log_errno_fill_property shall call strerror_r with the errno value, a local buffer of 512 bytes and 512. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_014: [ If the string and its null terminator fit in buffer_size bytes, log_errno_fill_property shall copy them to buffer. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_015: [ log_errno_fill_property shall return the length of the string plus 1 for the null terminator. ] */
 static void log_errno_fill_property_with_non_NULL_formats_42(void)
 {
     // arrange
@@ -218,19 +220,115 @@ static void log_errno_fill_property_with_non_NULL_formats_42(void)
     expected_calls[1].strerror_r_call.buffer_payload = TEST_FORMATTED_errno_42;
 
     // act
-    int result = log_errno_fill_property(buffer, 42);
+    int result = log_errno_fill_property(buffer, sizeof(buffer), 42);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_errno_42));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_errnum == 42);
-    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buf == buffer);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buf != buffer);
     POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buflen == 512);
     POOR_MANS_ASSERT(strcmp(buffer, TEST_FORMATTED_errno_42) == 0);
 }
 
-/* Tests_SRS_LOG_ERRNO_LINUX_01_005: [ If strerror_r fails, log_errno_fill_property shall copy in buffer the string failure in strerror_r and return 512. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_003: [ Otherwise, log_errno_fill_property shall obtain the errno value. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_012: [ log_errno_fill_property shall call strerror_r with the errno value, a local buffer of 512 bytes and 512. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_014: [ If the string and its null terminator fit in buffer_size bytes, log_errno_fill_property shall copy them to buffer. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_015: [ log_errno_fill_property shall return the length of the string plus 1 for the null terminator. ] */
+static void log_errno_fill_property_with_a_buffer_bigger_than_512_formats_in_512_bytes(void)
+{
+    // arrange
+    char buffer[1024];
+
+    setup_mocks();
+    setup_errno_call();
+    setup_strerror_r_call();
+    expected_calls[0].errno_call.override_result = true;
+    expected_calls[0].errno_call.call_result = 42;
+    expected_calls[1].strerror_r_call.override_result = true;
+    expected_calls[1].strerror_r_call.call_result = 0;
+    expected_calls[1].strerror_r_call.buffer_payload = TEST_FORMATTED_errno_42;
+
+    // act
+    int result = log_errno_fill_property(buffer, sizeof(buffer), 42);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_errno_42));
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_errnum == 42);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buf != buffer);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buflen == 512);
+    POOR_MANS_ASSERT(strcmp(buffer, TEST_FORMATTED_errno_42) == 0);
+}
+
+/* Tests_SRS_LOG_ERRNO_LINUX_01_003: [ Otherwise, log_errno_fill_property shall obtain the errno value. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_012: [ log_errno_fill_property shall call strerror_r with the errno value, a local buffer of 512 bytes and 512. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_014: [ If the string and its null terminator fit in buffer_size bytes, log_errno_fill_property shall copy them to buffer. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_015: [ log_errno_fill_property shall return the length of the string plus 1 for the null terminator. ] */
+static void log_errno_fill_property_with_a_small_buffer_that_fits_the_string_copies_it(void)
+{
+    // arrange
+    char buffer[19];
+
+    setup_mocks();
+    setup_errno_call();
+    setup_strerror_r_call();
+    expected_calls[0].errno_call.override_result = true;
+    expected_calls[0].errno_call.call_result = 42;
+    expected_calls[1].strerror_r_call.override_result = true;
+    expected_calls[1].strerror_r_call.call_result = 0;
+    expected_calls[1].strerror_r_call.buffer_payload = TEST_FORMATTED_errno_42;
+
+    // act
+    int result = log_errno_fill_property(buffer, sizeof(buffer), 42);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_errno_42));
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_errnum == 42);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buf != buffer);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buflen == 512);
+    POOR_MANS_ASSERT(strcmp(buffer, TEST_FORMATTED_errno_42) == 0);
+}
+
+/* Tests_SRS_LOG_ERRNO_LINUX_01_003: [ Otherwise, log_errno_fill_property shall obtain the errno value. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_012: [ log_errno_fill_property shall call strerror_r with the errno value, a local buffer of 512 bytes and 512. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_014: [ If the string and its null terminator fit in buffer_size bytes, log_errno_fill_property shall copy them to buffer. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_015: [ log_errno_fill_property shall return the length of the string plus 1 for the null terminator. ] */
+static void log_errno_fill_property_with_a_buffer_too_small_for_the_string_returns_the_needed_size(void)
+{
+    // arrange
+    char buffer[18];
+
+    setup_mocks();
+    setup_errno_call();
+    setup_strerror_r_call();
+    expected_calls[0].errno_call.override_result = true;
+    expected_calls[0].errno_call.call_result = 42;
+    expected_calls[1].strerror_r_call.override_result = true;
+    expected_calls[1].strerror_r_call.call_result = 0;
+    expected_calls[1].strerror_r_call.buffer_payload = TEST_FORMATTED_errno_42;
+    (void)memset(buffer, 'x', sizeof(buffer));
+
+    // act
+    int result = log_errno_fill_property(buffer, sizeof(buffer), 42);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_errno_42));
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_errnum == 42);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buf != buffer);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buflen == 512);
+    POOR_MANS_ASSERT(buffer[0] == 'x');
+}
+
+/* Tests_SRS_LOG_ERRNO_LINUX_01_013: [ If strerror_r fails, log_errno_fill_property shall use the string failure in strerror_r instead. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_014: [ If the string and its null terminator fit in buffer_size bytes, log_errno_fill_property shall copy them to buffer. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_015: [ log_errno_fill_property shall return the length of the string plus 1 for the null terminator. ] */
 static void when_strerror_r_fails_log_errno_fill_property_places_failure_string_in_buffer(void)
 {
     // arrange
@@ -239,25 +337,56 @@ static void when_strerror_r_fails_log_errno_fill_property_places_failure_string_
     setup_mocks();
     setup_errno_call();
     setup_strerror_r_call();
-    
     expected_calls[0].errno_call.override_result = true;
     expected_calls[0].errno_call.call_result = 42;
     expected_calls[1].strerror_r_call.override_result = true;
     expected_calls[1].strerror_r_call.call_result = 1;
+    expected_calls[1].strerror_r_call.buffer_payload = "";
 
     // act
-    int result = log_errno_fill_property(buffer, 1);
+    int result = log_errno_fill_property(buffer, sizeof(buffer), 42);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof("failure in strerror_r"));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_errnum == 42);
-    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buf == buffer);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buf != buffer);
     POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buflen == 512);
     POOR_MANS_ASSERT(strcmp(buffer, "failure in strerror_r") == 0);
 }
 
+/* Tests_SRS_LOG_ERRNO_LINUX_01_013: [ If strerror_r fails, log_errno_fill_property shall use the string failure in strerror_r instead. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_014: [ If the string and its null terminator fit in buffer_size bytes, log_errno_fill_property shall copy them to buffer. ] */
+/* Tests_SRS_LOG_ERRNO_LINUX_01_015: [ log_errno_fill_property shall return the length of the string plus 1 for the null terminator. ] */
+static void when_strerror_r_fails_with_a_buffer_too_small_for_the_failure_string_log_errno_fill_property_returns_the_needed_size(void)
+{
+    // arrange
+    char buffer[8];
+
+    setup_mocks();
+    setup_errno_call();
+    setup_strerror_r_call();
+    expected_calls[0].errno_call.override_result = true;
+    expected_calls[0].errno_call.call_result = 42;
+    expected_calls[1].strerror_r_call.override_result = true;
+    expected_calls[1].strerror_r_call.call_result = ERANGE;
+    expected_calls[1].strerror_r_call.buffer_payload = "";
+    (void)memset(buffer, 'x', sizeof(buffer));
+
+    // act
+    int result = log_errno_fill_property(buffer, sizeof(buffer), 42);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof("failure in strerror_r"));
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_errnum == 42);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buf != buffer);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_r_call.captured_buflen == 512);
+    POOR_MANS_ASSERT(buffer[0] == 'x');
+}
+
 /* LOG_ERRNO */
 
 /* Tests_SRS_LOG_ERRNO_LINUX_01_001: [ LOG_ERRNO shall expand to a LOG_CONTEXT_PROPERTY_CUSTOM_FUNCTION with name errno_value, type ascii_char_ptr and value function call being log_errno_fill_property. ] */
@@ -303,8 +432,12 @@ int main(void)
     log_errno_fill_property_with_NULL_returns_needed_buffer_size();
     log_errno_fill_property_with_non_NULL_formats_0();
     log_errno_fill_property_with_non_NULL_formats_42();
-    
+    log_errno_fill_property_with_a_buffer_bigger_than_512_formats_in_512_bytes();
+    log_errno_fill_property_with_a_small_buffer_that_fits_the_string_copies_it();
+    log_errno_fill_property_with_a_buffer_too_small_for_the_string_returns_the_needed_size();
+
     when_strerror_r_fails_log_errno_fill_property_places_failure_string_in_buffer();
+    when_strerror_r_fails_with_a_buffer_too_small_for_the_failure_string_log_errno_fill_property_returns_the_needed_size();
 
     LOG_ERRNO_emits_the_underlying_property();
 
@@ -155,7 +155,7 @@ static void log_errno_fill_property_with_NULL_returns_needed_buffer_size(void)
     setup_mocks();
 
     // act
-    int result = log_errno_fill_property(NULL, 42);
+    int result = log_errno_fill_property(NULL, 0, 42);
 
     // assert
     POOR_MANS_ASSERT(result == 512);
@@ -163,9 +163,64 @@ static void log_errno_fill_property_with_NULL_returns_needed_buffer_size(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
+/* Tests_SRS_LOG_ERRNO_WIN32_01_013: [ If the string and its null terminator fit in buffer_size bytes, log_errno_fill_property shall copy them to buffer. ] */
+/* Tests_SRS_LOG_ERRNO_WIN32_01_014: [ log_errno_fill_property shall return the length of the string plus 1 for the null terminator. ] */
+static void log_errno_fill_property_with_a_small_buffer_that_fits_the_string_copies_it(void)
+{
+    // arrange
+    char buffer[sizeof(TEST_FORMATTED_errno_42)];
+
+    setup_mocks();
+    setup_errno_call();
+    setup_strerror_s_call();
+    expected_calls[0].errno_call.override_result = true;
+    expected_calls[0].errno_call.call_result = 42;
+    expected_calls[1].strerror_s_call.override_result = true;
+    expected_calls[1].strerror_s_call.call_result = 0;
+    expected_calls[1].strerror_s_call.buffer_payload = TEST_FORMATTED_errno_42;
+
+    // act
+    int result = log_errno_fill_property(buffer, sizeof(buffer), 42);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_errno_42));
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_s_call.captured_maxsize == 512);
+    POOR_MANS_ASSERT(strcmp(buffer, TEST_FORMATTED_errno_42) == 0);
+}
+
+/* Tests_SRS_LOG_ERRNO_WIN32_01_014: [ log_errno_fill_property shall return the length of the string plus 1 for the null terminator. ] */
+static void log_errno_fill_property_with_a_buffer_too_small_for_the_string_returns_the_needed_size(void)
+{
+    // arrange
+    char buffer[sizeof(TEST_FORMATTED_errno_42) - 1];
+
+    setup_mocks();
+    setup_errno_call();
+    setup_strerror_s_call();
+    expected_calls[0].errno_call.override_result = true;
+    expected_calls[0].errno_call.call_result = 42;
+    expected_calls[1].strerror_s_call.override_result = true;
+    expected_calls[1].strerror_s_call.call_result = 0;
+    expected_calls[1].strerror_s_call.buffer_payload = TEST_FORMATTED_errno_42;
+    (void)memset(buffer, 'x', sizeof(buffer));
+
+    // act
+    int result = log_errno_fill_property(buffer, sizeof(buffer), 42);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_errno_42));
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_s_call.captured_s != buffer);
+    POOR_MANS_ASSERT(buffer[0] == 'x');
+}
+
 /* Tests_SRS_LOG_ERRNO_WIN32_01_003: [ Otherwise, log_errno_fill_property shall obtain the errno value. ] */
-/* Tests_SRS_LOG_ERRNO_WIN32_01_004: [ log_errno_fill_property shall call strerror_s with buffer, 512 and the errno value. ] */
-/* Tests_SRS_LOG_ERRNO_WIN32_01_007: [ log_errno_fill_property shall return 512. ] */
+/* Tests_SRS_LOG_ERRNO_WIN32_01_011: [ log_errno_fill_property shall call strerror_s with a local buffer of 512 bytes, 512 and the errno value. ] */
+/* Tests_SRS_LOG_ERRNO_WIN32_01_013: [ If the string and its null terminator fit in buffer_size bytes, log_errno_fill_property shall copy them to buffer. ] */
+/* Tests_SRS_LOG_ERRNO_WIN32_01_014: [ log_errno_fill_property shall return the length of the string plus 1 for the null terminator. ] */
 static void log_errno_fill_property_with_non_NULL_formats_0(void)
 {
     // arrange
@@ -179,21 +234,22 @@ static void log_errno_fill_property_with_non_NULL_formats_0(void)
     expected_calls[1].strerror_s_call.buffer_payload = TEST_FORMATTED_errno_0;
 
     // act
-    int result = log_errno_fill_property(buffer, 42);
+    int result = log_errno_fill_property(buffer, sizeof(buffer), 42);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_errno_0));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[1].strerror_s_call.captured_errnum == 0);
-    POOR_MANS_ASSERT(expected_calls[1].strerror_s_call.captured_s == buffer);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_s_call.captured_s != buffer);
     POOR_MANS_ASSERT(expected_calls[1].strerror_s_call.captured_maxsize == 512);
     POOR_MANS_ASSERT(strcmp(buffer, TEST_FORMATTED_errno_0) == 0);
 }
 
 /* Tests_SRS_LOG_ERRNO_WIN32_01_003: [ Otherwise, log_errno_fill_property shall obtain the errno value. ] */
-/* Tests_SRS_LOG_ERRNO_WIN32_01_004: [ log_errno_fill_property shall call strerror_s with buffer, 512 and the errno value. ] */
-/* Tests_SRS_LOG_ERRNO_WIN32_01_007: [ log_errno_fill_property shall return 512. ] */
+/* Tests_SRS_LOG_ERRNO_WIN32_01_011: [ log_errno_fill_property shall call strerror_s with a local buffer of 512 bytes, 512 and the errno value. ] */
+/* Tests_SRS_LOG_ERRNO_WIN32_01_013: [ If the string and its null terminator fit in buffer_size bytes, log_errno_fill_property shall copy them to buffer. ] */
+/* Tests_SRS_LOG_ERRNO_WIN32_01_014: [ log_errno_fill_property shall return the length of the string plus 1 for the null terminator. ] */
 static void log_errno_fill_property_with_non_NULL_formats_42(void)
 {
     // arrange
@@ -209,19 +265,19 @@ static void log_errno_fill_property_with_non_NULL_formats_42(void)
     expected_calls[1].strerror_s_call.buffer_payload = TEST_FORMATTED_errno_42;
 
     // act
-    int result = log_errno_fill_property(buffer, 42);
+    int result = log_errno_fill_property(buffer, sizeof(buffer), 42);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_errno_42));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[1].strerror_s_call.captured_errnum == 42);
-    POOR_MANS_ASSERT(expected_calls[1].strerror_s_call.captured_s == buffer);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_s_call.captured_s != buffer);
     POOR_MANS_ASSERT(expected_calls[1].strerror_s_call.captured_maxsize == 512);
     POOR_MANS_ASSERT(strcmp(buffer, TEST_FORMATTED_errno_42) == 0);
 }
 
-/* Tests_SRS_LOG_ERRNO_WIN32_01_005: [ If strerror_s fails, log_errno_fill_property shall copy in buffer the string failure in strerror_s and return 512. ] */
+/* Tests_SRS_LOG_ERRNO_WIN32_01_012: [ If strerror_s fails, log_errno_fill_property shall use the string failure in strerror_s instead. ] */
 static void when_strerror_s_fails_log_errno_fill_property_places_failure_string_in_buffer(void)
 {
     // arrange
@@ -237,14 +293,14 @@ static void when_strerror_s_fails_log_errno_fill_property_places_failure_string_
     expected_calls[1].strerror_s_call.call_result = 1;
 
     // act
-    int result = log_errno_fill_property(buffer, 1);
+    int result = log_errno_fill_property(buffer, sizeof(buffer), 1);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof("failure in strerror_s"));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[1].strerror_s_call.captured_errnum == 42);
-    POOR_MANS_ASSERT(expected_calls[1].strerror_s_call.captured_s == buffer);
+    POOR_MANS_ASSERT(expected_calls[1].strerror_s_call.captured_s != buffer);
     POOR_MANS_ASSERT(expected_calls[1].strerror_s_call.captured_maxsize == 512);
     POOR_MANS_ASSERT(strcmp(buffer, "failure in strerror_s") == 0);
 }
@@ -292,6 +348,8 @@ int main(void)
 #endif
 
     log_errno_fill_property_with_NULL_returns_needed_buffer_size();
+    log_errno_fill_property_with_a_small_buffer_that_fits_the_string_copies_it();
+    log_errno_fill_property_with_a_buffer_too_small_for_the_string_returns_the_needed_size();
     log_errno_fill_property_with_non_NULL_formats_0();
     log_errno_fill_property_with_non_NULL_formats_42();
     
@@ -315,7 +315,7 @@ static void log_hresult_fill_property_with_NULL_returns_needed_buffer_size(void)
     setup_mocks();
 
     // act
-    int result = log_hresult_fill_property(NULL, S_OK);
+    int result = log_hresult_fill_property(NULL, 0, S_OK);
 
     // assert
     POOR_MANS_ASSERT(result == 512);
@@ -323,8 +323,57 @@ static void log_hresult_fill_property_with_NULL_returns_needed_buffer_size(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_HRESULT_01_002: [ log_hresult_fill_property shall call FormatMessageA_no_newline with FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, hresult, 0 as language Id, buffer as buffer to place the output and 512 as buffer size. ] */
-/* Tests_SRS_LOG_HRESULT_01_003: [ log_lasterror_fill_property shall return 512. ] */
+/* Tests_SRS_LOG_HRESULT_01_017: [ log_hresult_fill_property shall return the length of the string placed in the local buffer plus 1 for the null terminator. ] */
+/* Tests_SRS_LOG_HRESULT_01_018: [ If the string and its null terminator fit in buffer_size bytes, log_hresult_fill_property shall copy them to buffer. ] */
+static void log_hresult_fill_property_with_a_small_buffer_that_fits_the_string_copies_it(void)
+{
+    // arrange
+    char buffer[sizeof(TEST_FORMATTED_HRESULT_E_FAIL)];
+
+    setup_mocks();
+    setup_FormatMessageA_no_newline_call();
+    expected_calls[0].FormatMessageA_no_newline_call.override_result = true;
+    expected_calls[0].FormatMessageA_no_newline_call.call_result = sizeof(TEST_FORMATTED_HRESULT_E_FAIL) - 1;
+    expected_calls[0].FormatMessageA_no_newline_call.buffer_payload = TEST_FORMATTED_HRESULT_E_FAIL;
+
+    // act
+    int result = log_hresult_fill_property(buffer, sizeof(buffer), E_FAIL);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_HRESULT_E_FAIL));
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_nSize == 512);
+    POOR_MANS_ASSERT(strcmp(buffer, TEST_FORMATTED_HRESULT_E_FAIL) == 0);
+}
+
+/* Tests_SRS_LOG_HRESULT_01_017: [ log_hresult_fill_property shall return the length of the string placed in the local buffer plus 1 for the null terminator. ] */
+static void log_hresult_fill_property_with_a_buffer_too_small_for_the_string_returns_the_needed_size(void)
+{
+    // arrange
+    char buffer[sizeof(TEST_FORMATTED_HRESULT_E_FAIL) - 1];
+
+    setup_mocks();
+    setup_FormatMessageA_no_newline_call();
+    expected_calls[0].FormatMessageA_no_newline_call.override_result = true;
+    expected_calls[0].FormatMessageA_no_newline_call.call_result = sizeof(TEST_FORMATTED_HRESULT_E_FAIL) - 1;
+    expected_calls[0].FormatMessageA_no_newline_call.buffer_payload = TEST_FORMATTED_HRESULT_E_FAIL;
+    (void)memset(buffer, 'x', sizeof(buffer));
+
+    // act
+    int result = log_hresult_fill_property(buffer, sizeof(buffer), E_FAIL);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_HRESULT_E_FAIL));
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
+    POOR_MANS_ASSERT(buffer[0] == 'x');
+}
+
+/* Tests_SRS_LOG_HRESULT_01_015: [ log_hresult_fill_property shall call FormatMessageA_no_newline with FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, hresult, 0 as language Id, a local buffer of 512 bytes as buffer to place the output and 512 as buffer size. ] */
+/* Tests_SRS_LOG_HRESULT_01_017: [ log_hresult_fill_property shall return the length of the string placed in the local buffer plus 1 for the null terminator. ] */
+/* Tests_SRS_LOG_HRESULT_01_018: [ If the string and its null terminator fit in buffer_size bytes, log_hresult_fill_property shall copy them to buffer. ] */
 static void log_hresult_fill_property_with_non_NULL_formats_S_OK(void)
 {
     // arrange
@@ -337,24 +386,25 @@ static void log_hresult_fill_property_with_non_NULL_formats_S_OK(void)
     expected_calls[0].FormatMessageA_no_newline_call.buffer_payload = TEST_FORMATTED_HRESULT_S_OK;
 
     // act
-    int result = log_hresult_fill_property(buffer, S_OK);
+    int result = log_hresult_fill_property(buffer, sizeof(buffer), S_OK);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_HRESULT_S_OK));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwFlags == (FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS));
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpSource == NULL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwMessageId == S_OK);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwLanguageId == 0);
-    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(strcmp(buffer, TEST_FORMATTED_HRESULT_S_OK) == 0);
 }
 
-/* Tests_SRS_LOG_HRESULT_01_002: [ log_hresult_fill_property shall call FormatMessageA_no_newline with FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, hresult, 0 as language Id, buffer as buffer to place the output and 512 as buffer size. ] */
-/* Tests_SRS_LOG_HRESULT_01_003: [ log_lasterror_fill_property shall return 512. ] */
+/* Tests_SRS_LOG_HRESULT_01_015: [ log_hresult_fill_property shall call FormatMessageA_no_newline with FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, hresult, 0 as language Id, a local buffer of 512 bytes as buffer to place the output and 512 as buffer size. ] */
+/* Tests_SRS_LOG_HRESULT_01_017: [ log_hresult_fill_property shall return the length of the string placed in the local buffer plus 1 for the null terminator. ] */
+/* Tests_SRS_LOG_HRESULT_01_018: [ If the string and its null terminator fit in buffer_size bytes, log_hresult_fill_property shall copy them to buffer. ] */
 static void log_hresult_fill_property_with_non_NULL_formats_E_FAIL(void)
 {
     // arrange
@@ -367,17 +417,17 @@ static void log_hresult_fill_property_with_non_NULL_formats_E_FAIL(void)
     expected_calls[0].FormatMessageA_no_newline_call.buffer_payload = TEST_FORMATTED_HRESULT_E_FAIL;
 
     // act
-    int result = log_hresult_fill_property(buffer, E_FAIL);
+    int result = log_hresult_fill_property(buffer, sizeof(buffer), E_FAIL);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_HRESULT_E_FAIL));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwFlags == (FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS));
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpSource == NULL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwMessageId == E_FAIL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwLanguageId == 0);
-    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(strcmp(buffer, TEST_FORMATTED_HRESULT_E_FAIL) == 0);
@@ -386,7 +436,7 @@ static void log_hresult_fill_property_with_non_NULL_formats_E_FAIL(void)
 /* Tests_SRS_LOG_HRESULT_01_004: [ If FormatMessageA_no_newline returns 0, log_hresult_fill_property attempt to look up the formatted string from the loaded modules: ] */
 /* Tests_SRS_LOG_HRESULT_01_005: [ log_hresult_fill_property shall get the current process handle by calling GetCurrentProcess. ] */
 /* Tests_SRS_LOG_HRESULT_01_006: [ log_hresult_fill_property shall call EnumProcessModules and obtain the information about 10 modules. ] */
-/* Tests_SRS_LOG_HRESULT_01_007: [ If no module has the formatted message, log_hresult_fill_property shall place in buffer the string unknown HRESULT 0x%x, where %x is the hresult value. ] */
+/* Tests_SRS_LOG_HRESULT_01_007: [ If no module has the formatted message, log_hresult_fill_property shall place in the local buffer the string unknown HRESULT 0x%x, where %x is the hresult value. ] */
 static void when_FormatMessageA_fails_and_no_modules_are_returned_log_hresult_fill_property_places_unknown_hresult_in_buffer(void)
 {
     // arrange
@@ -407,17 +457,17 @@ static void when_FormatMessageA_fails_and_no_modules_are_returned_log_hresult_fi
     expected_calls[2].EnumProcessModules_call.call_result = TRUE;
 
     // act
-    int result = log_hresult_fill_property(buffer, E_FAIL);
+    int result = log_hresult_fill_property(buffer, sizeof(buffer), E_FAIL);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof("unknown HRESULT 0x80004005"));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwFlags == (FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS));
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpSource == NULL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwMessageId == E_FAIL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwLanguageId == 0);
-    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(expected_calls[2].EnumProcessModules_call.captured_hProcess == (HANDLE)0x4242);
@@ -425,7 +475,7 @@ static void when_FormatMessageA_fails_and_no_modules_are_returned_log_hresult_fi
     POOR_MANS_ASSERT(strcmp(buffer, "unknown HRESULT 0x80004005") == 0);
 }
 
-/* Tests_SRS_LOG_HRESULT_01_008: [ If printing the unknown HRESULT 0x%x string fails, log_hresult_fill_property shall place in buffer the string snprintf failed. ] */
+/* Tests_SRS_LOG_HRESULT_01_008: [ If printing the unknown HRESULT 0x%x string fails, log_hresult_fill_property shall place in the local buffer the string snprintf failed. ] */
 static void when_snprintf_fails_log_hresult_fill_property_places_snprintf_failed_in_the_buffer(void)
 {
     // arrange
@@ -448,17 +498,17 @@ static void when_snprintf_fails_log_hresult_fill_property_places_snprintf_failed
     expected_calls[3].snprintf_call.call_result = -1;
 
     // act
-    int result = log_hresult_fill_property(buffer, E_FAIL);
+    int result = log_hresult_fill_property(buffer, sizeof(buffer), E_FAIL);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof("snprintf failed"));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwFlags == (FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS));
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpSource == NULL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwMessageId == E_FAIL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwLanguageId == 0);
-    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(expected_calls[2].EnumProcessModules_call.captured_hProcess == (HANDLE)0x4242);
@@ -466,7 +516,7 @@ static void when_snprintf_fails_log_hresult_fill_property_places_snprintf_failed
     POOR_MANS_ASSERT(strcmp(buffer, "snprintf failed") == 0);
 }
 
-/* Tests_SRS_LOG_HRESULT_01_009: [ If EnumProcessModules fails, log_hresult_fill_property shall place in buffer a string indicating what failed, the last error and unknown HRESULT 0x%x, where %x is the hresult value. ] */
+/* Tests_SRS_LOG_HRESULT_01_009: [ If EnumProcessModules fails, log_hresult_fill_property shall place in the local buffer a string indicating what failed, the last error and unknown HRESULT 0x%x, where %x is the hresult value. ] */
 static void when_EnumProcessModules_fails_log_hresult_fill_property_places_unknown_hresult_with_lasterror_in_buffer(void)
 {
     // arrange
@@ -489,17 +539,17 @@ static void when_EnumProcessModules_fails_log_hresult_fill_property_places_unkno
     expected_calls[3].GetLastError_call.call_result = 42;
 
     // act
-    int result = log_hresult_fill_property(buffer, E_FAIL);
+    int result = log_hresult_fill_property(buffer, sizeof(buffer), E_FAIL);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof("failure in EnumProcessModules, LE=42, unknown HRESULT 0x80004005"));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwFlags == (FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS));
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpSource == NULL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwMessageId == E_FAIL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwLanguageId == 0);
-    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(expected_calls[2].EnumProcessModules_call.captured_hProcess == (HANDLE)0x4242);
@@ -507,7 +557,7 @@ static void when_EnumProcessModules_fails_log_hresult_fill_property_places_unkno
     POOR_MANS_ASSERT(strcmp(buffer, "failure in EnumProcessModules, LE=42, unknown HRESULT 0x80004005") == 0);
 }
 
-/* Tests_SRS_LOG_HRESULT_01_008: [ If printing the unknown HRESULT 0x%x string fails, log_hresult_fill_property shall place in buffer the string snprintf failed. ] */
+/* Tests_SRS_LOG_HRESULT_01_008: [ If printing the unknown HRESULT 0x%x string fails, log_hresult_fill_property shall place in the local buffer the string snprintf failed. ] */
 static void when_snprintf_fails_after_EnumProcessModules_fails_log_hresult_fill_property_places_snprintf_failed_in_the_buffer(void)
 {
     // arrange
@@ -530,17 +580,17 @@ static void when_snprintf_fails_after_EnumProcessModules_fails_log_hresult_fill_
     expected_calls[4].snprintf_call.call_result = -1;
 
     // act
-    int result = log_hresult_fill_property(buffer, E_FAIL);
+    int result = log_hresult_fill_property(buffer, sizeof(buffer), E_FAIL);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof("snprintf failed"));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwFlags == (FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS));
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpSource == NULL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwMessageId == E_FAIL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwLanguageId == 0);
-    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(expected_calls[2].EnumProcessModules_call.captured_hProcess == (HANDLE)0x4242);
@@ -552,7 +602,7 @@ static void when_snprintf_fails_after_EnumProcessModules_fails_log_hresult_fill_
 #define TEST_MODULE_2 ((HANDLE)0x46)
 
 /* Tests_SRS_LOG_HRESULT_01_010: [ For each module: ] */
-/* Tests_SRS_LOG_HRESULT_01_011: [ log_hresult_fill_property shall call FormatMessageA with FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS, the module handle, the hresult value, 0 as language Id, buffer as buffer to place the output and 512 as buffer size. ] */
+/* Tests_SRS_LOG_HRESULT_01_016: [ log_hresult_fill_property shall call FormatMessageA with FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS, the module handle, the hresult value, 0 as language Id, the local buffer as buffer to place the output and 512 as buffer size. ] */
 static void when_first_module_out_of_2_FormatMessageA_no_newline_formats_log_hresult_fill_property_formats_success(void)
 {
     // arrange
@@ -578,17 +628,17 @@ static void when_first_module_out_of_2_FormatMessageA_no_newline_formats_log_hre
     expected_calls[3].FormatMessageA_no_newline_call.buffer_payload = TEST_FORMATTED_HRESULT_E_FAIL;
 
     // act
-    int result = log_hresult_fill_property(buffer, E_FAIL);
+    int result = log_hresult_fill_property(buffer, sizeof(buffer), E_FAIL);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_HRESULT_E_FAIL));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwFlags == (FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS));
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpSource == NULL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwMessageId == E_FAIL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwLanguageId == 0);
-    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(expected_calls[2].EnumProcessModules_call.captured_hProcess == (HANDLE)0x4242);
@@ -597,14 +647,14 @@ static void when_first_module_out_of_2_FormatMessageA_no_newline_formats_log_hre
     POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_lpSource == TEST_MODULE_1);
     POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_dwMessageId == E_FAIL);
     POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_dwLanguageId == 0);
-    POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(strcmp(buffer, TEST_FORMATTED_HRESULT_E_FAIL) == 0);
 }
 
 /* Tests_SRS_LOG_HRESULT_01_010: [ For each module: ] */
-/* Tests_SRS_LOG_HRESULT_01_011: [ log_hresult_fill_property shall call FormatMessageA with FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS, the module handle, the hresult value, 0 as language Id, buffer as buffer to place the output and 512 as buffer size. ] */
+/* Tests_SRS_LOG_HRESULT_01_016: [ log_hresult_fill_property shall call FormatMessageA with FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS, the module handle, the hresult value, 0 as language Id, the local buffer as buffer to place the output and 512 as buffer size. ] */
 static void when_2nd_module_out_of_2_FormatMessageA_no_newline_formats_log_hresult_fill_property_formats_success(void)
 {
     // arrange
@@ -633,17 +683,17 @@ static void when_2nd_module_out_of_2_FormatMessageA_no_newline_formats_log_hresu
     expected_calls[4].FormatMessageA_no_newline_call.buffer_payload = TEST_FORMATTED_HRESULT_E_FAIL_OTHER;
 
     // act
-    int result = log_hresult_fill_property(buffer, E_FAIL);
+    int result = log_hresult_fill_property(buffer, sizeof(buffer), E_FAIL);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_HRESULT_E_FAIL_OTHER));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwFlags == (FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS));
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpSource == NULL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwMessageId == E_FAIL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwLanguageId == 0);
-    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(expected_calls[2].EnumProcessModules_call.captured_hProcess == (HANDLE)0x4242);
@@ -652,20 +702,20 @@ static void when_2nd_module_out_of_2_FormatMessageA_no_newline_formats_log_hresu
     POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_lpSource == TEST_MODULE_1);
     POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_dwMessageId == E_FAIL);
     POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_dwLanguageId == 0);
-    POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_dwFlags == (FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS));
     POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_lpSource == TEST_MODULE_2);
     POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_dwMessageId == E_FAIL);
     POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_dwLanguageId == 0);
-    POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(strcmp(buffer, TEST_FORMATTED_HRESULT_E_FAIL_OTHER) == 0);
 }
 
-/* Tests_SRS_LOG_HRESULT_01_007: [ If no module has the formatted message, log_hresult_fill_property shall place in buffer the string unknown HRESULT 0x%x, where %x is the hresult value. ] */
+/* Tests_SRS_LOG_HRESULT_01_007: [ If no module has the formatted message, log_hresult_fill_property shall place in the local buffer the string unknown HRESULT 0x%x, where %x is the hresult value. ] */
 static void when_none_of_2_FormatMessageA_no_newline_formats_it_log_hresult_fill_property_formats_yields_unknown(void)
 {
     // arrange
@@ -694,17 +744,17 @@ static void when_none_of_2_FormatMessageA_no_newline_formats_it_log_hresult_fill
     expected_calls[4].FormatMessageA_no_newline_call.call_result = 0;
 
     // act
-    int result = log_hresult_fill_property(buffer, E_FAIL);
+    int result = log_hresult_fill_property(buffer, sizeof(buffer), E_FAIL);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof("unknown HRESULT 0x80004005"));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwFlags == (FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS));
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpSource == NULL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwMessageId == E_FAIL);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_dwLanguageId == 0);
-    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[0].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(expected_calls[2].EnumProcessModules_call.captured_hProcess == (HANDLE)0x4242);
@@ -713,14 +763,14 @@ static void when_none_of_2_FormatMessageA_no_newline_formats_it_log_hresult_fill
     POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_lpSource == TEST_MODULE_1);
     POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_dwMessageId == E_FAIL);
     POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_dwLanguageId == 0);
-    POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[3].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_dwFlags == (FORMAT_MESSAGE_FROM_HMODULE | FORMAT_MESSAGE_IGNORE_INSERTS));
     POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_lpSource == TEST_MODULE_2);
     POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_dwMessageId == E_FAIL);
     POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_dwLanguageId == 0);
-    POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[4].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(strcmp(buffer, "unknown HRESULT 0x80004005") == 0);
@@ -765,6 +815,8 @@ int main(void)
 #endif
 
     log_hresult_fill_property_with_NULL_returns_needed_buffer_size();
+    log_hresult_fill_property_with_a_small_buffer_that_fits_the_string_copies_it();
+    log_hresult_fill_property_with_a_buffer_too_small_for_the_string_returns_the_needed_size();
     log_hresult_fill_property_with_non_NULL_formats_S_OK();
     log_hresult_fill_property_with_non_NULL_formats_E_FAIL();
     
@@ -172,7 +172,7 @@ static void log_lasterror_fill_property_with_NULL_returns_needed_buffer_size(voi
     setup_mocks();
 
     // act
-    int result = log_lasterror_fill_property(NULL, 0);
+    int result = log_lasterror_fill_property(NULL, 0, 0);
 
     // assert
     POOR_MANS_ASSERT(result == 512);
@@ -180,9 +180,64 @@ static void log_lasterror_fill_property_with_NULL_returns_needed_buffer_size(voi
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
+/* Tests_SRS_LOG_LASTERROR_01_013: [ If the string and its null terminator fit in buffer_size bytes, log_lasterror_fill_property shall copy them to buffer. ] */
+/* Tests_SRS_LOG_LASTERROR_01_014: [ log_lasterror_fill_property shall return the length of the string plus 1 for the null terminator. ] */
+static void log_lasterror_fill_property_with_a_small_buffer_that_fits_the_string_copies_it(void)
+{
+    // arrange
+    char buffer[sizeof(TEST_FORMATTED_LASTERROR_995)];
+
+    setup_mocks();
+    setup_GetLastError_call();
+    setup_FormatMessageA_no_newline_call();
+    expected_calls[0].GetLastError_call.override_result = true;
+    expected_calls[0].GetLastError_call.call_result = 995;
+    expected_calls[1].FormatMessageA_no_newline_call.override_result = true;
+    expected_calls[1].FormatMessageA_no_newline_call.call_result = sizeof(TEST_FORMATTED_LASTERROR_995) - 1;
+    expected_calls[1].FormatMessageA_no_newline_call.buffer_payload = TEST_FORMATTED_LASTERROR_995;
+
+    // act
+    int result = log_lasterror_fill_property(buffer, sizeof(buffer), 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_LASTERROR_995));
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_nSize == 512);
+    POOR_MANS_ASSERT(strcmp(buffer, TEST_FORMATTED_LASTERROR_995) == 0);
+}
+
+/* Tests_SRS_LOG_LASTERROR_01_014: [ log_lasterror_fill_property shall return the length of the string plus 1 for the null terminator. ] */
+static void log_lasterror_fill_property_with_a_buffer_too_small_for_the_string_returns_the_needed_size(void)
+{
+    // arrange
+    char buffer[sizeof(TEST_FORMATTED_LASTERROR_995) - 1];
+
+    setup_mocks();
+    setup_GetLastError_call();
+    setup_FormatMessageA_no_newline_call();
+    expected_calls[0].GetLastError_call.override_result = true;
+    expected_calls[0].GetLastError_call.call_result = 995;
+    expected_calls[1].FormatMessageA_no_newline_call.override_result = true;
+    expected_calls[1].FormatMessageA_no_newline_call.call_result = sizeof(TEST_FORMATTED_LASTERROR_995) - 1;
+    expected_calls[1].FormatMessageA_no_newline_call.buffer_payload = TEST_FORMATTED_LASTERROR_995;
+    (void)memset(buffer, 'x', sizeof(buffer));
+
+    // act
+    int result = log_lasterror_fill_property(buffer, sizeof(buffer), 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_LASTERROR_995));
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
+    POOR_MANS_ASSERT(buffer[0] == 'x');
+}
+
 /* Tests_SRS_LOG_LASTERROR_01_003: [ Otherwise, log_lasterror_fill_property shall call GetLastError to obtain the last error information. ] */
-/* Tests_SRS_LOG_LASTERROR_01_004: [ log_lasterror_fill_property shall call FormatMessageA_no_newline with FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, the last error value, LANG_NEUTRAL as language Id, buffer as buffer to place the output and 512 as buffer size. ] */
-/* Tests_SRS_LOG_LASTERROR_01_007: [ log_lasterror_fill_property shall return 512. ] */
+/* Tests_SRS_LOG_LASTERROR_01_011: [ log_lasterror_fill_property shall call FormatMessageA_no_newline with FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, the last error value, LANG_NEUTRAL as language Id, a local buffer of 512 bytes as buffer to place the output and 512 as buffer size. ] */
+/* Tests_SRS_LOG_LASTERROR_01_013: [ If the string and its null terminator fit in buffer_size bytes, log_lasterror_fill_property shall copy them to buffer. ] */
+/* Tests_SRS_LOG_LASTERROR_01_014: [ log_lasterror_fill_property shall return the length of the string plus 1 for the null terminator. ] */
 static void log_lasterror_fill_property_with_non_NULL_formats_last_error_995(void)
 {
     // arrange
@@ -198,25 +253,26 @@ static void log_lasterror_fill_property_with_non_NULL_formats_last_error_995(voi
     expected_calls[1].FormatMessageA_no_newline_call.buffer_payload = TEST_FORMATTED_LASTERROR_995;
 
     // act
-    int result = log_lasterror_fill_property(buffer, 0);
+    int result = log_lasterror_fill_property(buffer, sizeof(buffer), 0);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_LASTERROR_995));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_dwFlags == (FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS));
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_lpSource == NULL);
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_dwMessageId == 995);
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_dwLanguageId == MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT));
-    POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(strcmp(buffer, TEST_FORMATTED_LASTERROR_995) == 0);
 }
 
 /* Tests_SRS_LOG_LASTERROR_01_003: [ Otherwise, log_lasterror_fill_property shall call GetLastError to obtain the last error information. ] */
-/* Tests_SRS_LOG_LASTERROR_01_004: [ log_lasterror_fill_property shall call FormatMessageA_no_newline with FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, the last error value, LANG_NEUTRAL as language Id, buffer as buffer to place the output and 512 as buffer size. ] */
-/* Tests_SRS_LOG_LASTERROR_01_007: [ log_lasterror_fill_property shall return 512. ] */
+/* Tests_SRS_LOG_LASTERROR_01_011: [ log_lasterror_fill_property shall call FormatMessageA_no_newline with FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS, the last error value, LANG_NEUTRAL as language Id, a local buffer of 512 bytes as buffer to place the output and 512 as buffer size. ] */
+/* Tests_SRS_LOG_LASTERROR_01_013: [ If the string and its null terminator fit in buffer_size bytes, log_lasterror_fill_property shall copy them to buffer. ] */
+/* Tests_SRS_LOG_LASTERROR_01_014: [ log_lasterror_fill_property shall return the length of the string plus 1 for the null terminator. ] */
 static void log_lasterror_fill_property_with_non_NULL_formats_last_error_42(void)
 {
     // arrange
@@ -232,23 +288,23 @@ static void log_lasterror_fill_property_with_non_NULL_formats_last_error_42(void
     expected_calls[1].FormatMessageA_no_newline_call.buffer_payload = TEST_FORMATTED_LASTERROR_42;
 
     // act
-    int result = log_lasterror_fill_property(buffer, 0);
+    int result = log_lasterror_fill_property(buffer, sizeof(buffer), 0);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FORMATTED_LASTERROR_42));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_dwFlags == (FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS));
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_lpSource == NULL);
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_dwMessageId == 995);
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_dwLanguageId == MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT));
-    POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(strcmp(buffer, TEST_FORMATTED_LASTERROR_42) == 0);
 }
 
-/* Tests_SRS_LOG_LASTERROR_01_005: [ If FormatMessageA returns 0, log_lasterror_fill_property shall copy in buffer the string failure in FormatMessageA and return 512. ] */
+/* Tests_SRS_LOG_LASTERROR_01_012: [ If FormatMessageA returns 0, log_lasterror_fill_property shall use the string failure in FormatMessageA instead. ] */
 static void when_FormatMessageA_fails_log_lasterror_fill_property_places_a_default_string_in_the_buffer(void)
 {
     // arrange
@@ -264,17 +320,17 @@ static void when_FormatMessageA_fails_log_lasterror_fill_property_places_a_defau
     expected_calls[1].FormatMessageA_no_newline_call.buffer_payload = TEST_FORMATTED_LASTERROR_995;
 
     // act
-    int result = log_lasterror_fill_property(buffer, 0);
+    int result = log_lasterror_fill_property(buffer, sizeof(buffer), 0);
 
     // assert
-    POOR_MANS_ASSERT(result == 512);
+    POOR_MANS_ASSERT(result == (int)sizeof(TEST_FAILURE_STRING));
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_dwFlags == (FORMAT_MESSAGE_FROM_SYSTEM | FORMAT_MESSAGE_IGNORE_INSERTS));
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_lpSource == NULL);
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_dwMessageId == 995);
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_dwLanguageId == MAKELANGID(LANG_NEUTRAL, SUBLANG_DEFAULT));
-    POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_lpBuffer == buffer);
+    POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_lpBuffer != buffer);
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_nSize == 512);
     POOR_MANS_ASSERT(expected_calls[1].FormatMessageA_no_newline_call.captured_Arguments == NULL);
     POOR_MANS_ASSERT(strcmp(buffer, TEST_FAILURE_STRING) == 0);
@@ -320,6 +376,8 @@ int main(void)
     _set_abort_behavior(_CALL_REPORTFAULT, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
 
     log_lasterror_fill_property_with_NULL_returns_needed_buffer_size();
+    log_lasterror_fill_property_with_a_small_buffer_that_fits_the_string_copies_it();
+    log_lasterror_fill_property_with_a_buffer_too_small_for_the_string_returns_the_needed_size();
     log_lasterror_fill_property_with_non_NULL_formats_last_error_995();
     log_lasterror_fill_property_with_non_NULL_formats_last_error_42();
 
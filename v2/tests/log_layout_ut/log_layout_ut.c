@@ -0,0 +1,342 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_context.h"
+#include "c_logging/log_context_property_type_ascii_char_ptr.h"
+#include "c_logging/log_context_property_type_wchar_t_ptr.h"
+#include "c_logging/log_level.h"
+#include "c_logging/logger.h"
+
+#include "c_logging/log_layout.h"
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+static int test_log_layout_format(const LOG_LAYOUT* layout, char* buffer, size_t buffer_size, LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context, const char* file, const char* func, int line, const char* message_format, ...)
+{
+    int result;
+    va_list args;
+    va_start(args, message_format);
+    result = log_layout_format(layout, buffer, buffer_size, log_level, log_context, file, func, line, message_format, args);
+    va_end(args);
+    return result;
+}
+
+static void assert_line(const char* pattern, LOG_LEVEL log_level, LOG_CONTEXT_HANDLE log_context, const char* file, const char* expected)
+{
+    LOG_LAYOUT layout;
+    char buffer[LOG_MAX_MESSAGE_LENGTH];
+
+    POOR_MANS_ASSERT(log_layout_compile(&layout, pattern) == 0);
+    int result = test_log_layout_format(&layout, buffer, sizeof(buffer), log_level, log_context, file, "some_func", 42, "hello %s %d", "world", 7);
+
+    if ((result != (int)strlen(expected)) || (strcmp(buffer, expected) != 0))
+    {
+        (void)printf("pattern \"%s\": expected %d \"%s\", got %d \"%s\"\r\n", pattern, (int)strlen(expected), expected, result, buffer);
+        POOR_MANS_ASSERT(0);
+    }
+}
+
+/* log_layout_compile */
+
+/* Tests_SRS_LOG_LAYOUT_01_001: [ If layout is NULL, log_layout_compile shall fail and return a non-zero value. ]*/
+static void log_layout_compile_with_NULL_layout_fails(void)
+{
+    // arrange
+
+    // act
+    int result = log_layout_compile(NULL, "%m");
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_LAYOUT_01_002: [ If pattern is NULL, log_layout_compile shall fail and return a non-zero value. ]*/
+static void log_layout_compile_with_NULL_pattern_fails(void)
+{
+    // arrange
+    LOG_LAYOUT layout;
+
+    // act
+    int result = log_layout_compile(&layout, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+}
+
+/* Tests_SRS_LOG_LAYOUT_01_003: [ log_layout_compile shall parse pattern into a list of ops stored in layout: one for each run of literal characters and one for each field. ]*/
+/* Tests_SRS_LOG_LAYOUT_01_004: [ %% shall be compiled as the literal character %. ]*/
+/* Tests_SRS_LOG_LAYOUT_01_008: [ log_layout_compile shall succeed and return 0. ]*/
+static void log_layout_compile_makes_one_op_per_literal_run_and_field(void)
+{
+    // arrange
+    LOG_LAYOUT layout;
+
+    // act
+    int result = log_layout_compile(&layout, "[%L] 100%% %m%c");
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(layout.op_count == 5);
+    POOR_MANS_ASSERT(layout.ops[0].type == LOG_LAYOUT_OP_TYPE_LITERAL);
+    POOR_MANS_ASSERT(layout.ops[0].literal_length == 1);
+    POOR_MANS_ASSERT(layout.ops[1].type == LOG_LAYOUT_OP_TYPE_LEVEL);
+    POOR_MANS_ASSERT(layout.ops[2].type == LOG_LAYOUT_OP_TYPE_LITERAL);
+    POOR_MANS_ASSERT(layout.ops[2].literal_length == 7);
+    POOR_MANS_ASSERT(memcmp(&layout.literals[layout.ops[2].literal_offset], "] 100% ", 7) == 0);
+    POOR_MANS_ASSERT(layout.ops[3].type == LOG_LAYOUT_OP_TYPE_MESSAGE);
+    POOR_MANS_ASSERT(layout.ops[4].type == LOG_LAYOUT_OP_TYPE_CONTEXT);
+}
+
+/* Tests_SRS_LOG_LAYOUT_01_008: [ log_layout_compile shall succeed and return 0. ]*/
+static void log_layout_compile_with_empty_pattern_succeeds(void)
+{
+    // arrange
+    LOG_LAYOUT layout;
+
+    // act
+    int result = log_layout_compile(&layout, "");
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(layout.op_count == 0);
+}
+
+/* Tests_SRS_LOG_LAYOUT_01_006: [ If pattern contains any other character after %, or ends with %, log_layout_compile shall fail and return a non-zero value. ]*/
+static void log_layout_compile_with_unknown_field_fails(void)
+{
+    // arrange
+    LOG_LAYOUT layout;
+    const char* patterns[] = { "%m %x", "%m %", "%", "%d" };
+
+    for (size_t i = 0; i < MU_COUNT_ARRAY_ITEMS(patterns); i++)
+    {
+        // act
+        int result = log_layout_compile(&layout, patterns[i]);
+
+        // assert
+        POOR_MANS_ASSERT(result != 0);
+    }
+}
+
+/* Tests_SRS_LOG_LAYOUT_01_007: [ If pattern needs more than LOG_LAYOUT_MAX_OP_COUNT ops or more than LOG_LAYOUT_MAX_LITERAL_LENGTH literal characters, log_layout_compile shall fail and return a non-zero value. ]*/
+static void log_layout_compile_with_too_many_ops_fails(void)
+{
+    // arrange
+    LOG_LAYOUT layout;
+    char pattern[(LOG_LAYOUT_MAX_OP_COUNT + 1) * 2 + 1];
+    for (size_t i = 0; i < LOG_LAYOUT_MAX_OP_COUNT + 1; i++)
+    {
+        pattern[i * 2] = '%';
+        pattern[(i * 2) + 1] = 'l';
+    }
+    pattern[sizeof(pattern) - 1] = '\0';
+
+    // act
+    int result = log_layout_compile(&layout, pattern);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+
+    // exactly LOG_LAYOUT_MAX_OP_COUNT is fine
+    pattern[sizeof(pattern) - 3] = '\0';
+    POOR_MANS_ASSERT(log_layout_compile(&layout, pattern) == 0);
+    POOR_MANS_ASSERT(layout.op_count == LOG_LAYOUT_MAX_OP_COUNT);
+}
+
+/* Tests_SRS_LOG_LAYOUT_01_007: [ If pattern needs more than LOG_LAYOUT_MAX_OP_COUNT ops or more than LOG_LAYOUT_MAX_LITERAL_LENGTH literal characters, log_layout_compile shall fail and return a non-zero value. ]*/
+static void log_layout_compile_with_too_long_literal_fails(void)
+{
+    // arrange
+    LOG_LAYOUT layout;
+    char pattern[LOG_LAYOUT_MAX_LITERAL_LENGTH + 2];
+    (void)memset(pattern, 'a', sizeof(pattern) - 1);
+    pattern[sizeof(pattern) - 1] = '\0';
+
+    // act
+    int result = log_layout_compile(&layout, pattern);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+
+    // exactly LOG_LAYOUT_MAX_LITERAL_LENGTH is fine
+    pattern[sizeof(pattern) - 2] = '\0';
+    POOR_MANS_ASSERT(log_layout_compile(&layout, pattern) == 0);
+}
+
+/* log_layout_format */
+
+/* Tests_SRS_LOG_LAYOUT_01_009: [ If layout is NULL, log_layout_format shall fail and return a negative value. ]*/
+/* Tests_SRS_LOG_LAYOUT_01_010: [ If buffer is NULL, log_layout_format shall fail and return a negative value. ]*/
+/* Tests_SRS_LOG_LAYOUT_01_011: [ If buffer_size is 0, log_layout_format shall fail and return a negative value. ]*/
+/* Tests_SRS_LOG_LAYOUT_01_012: [ If message_format is NULL, log_layout_format shall fail and return a negative value. ]*/
+static void log_layout_format_with_invalid_arguments_fails(void)
+{
+    // arrange
+    LOG_LAYOUT layout;
+    char buffer[16];
+    POOR_MANS_ASSERT(log_layout_compile(&layout, "%m") == 0);
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(test_log_layout_format(NULL, buffer, sizeof(buffer), LOG_LEVEL_ERROR, NULL, __FILE__, __FUNCTION__, __LINE__, "a") < 0);
+    POOR_MANS_ASSERT(test_log_layout_format(&layout, NULL, sizeof(buffer), LOG_LEVEL_ERROR, NULL, __FILE__, __FUNCTION__, __LINE__, "a") < 0);
+    POOR_MANS_ASSERT(test_log_layout_format(&layout, buffer, 0, LOG_LEVEL_ERROR, NULL, __FILE__, __FUNCTION__, __LINE__, "a") < 0);
+    POOR_MANS_ASSERT(test_log_layout_format(&layout, buffer, sizeof(buffer), LOG_LEVEL_ERROR, NULL, __FILE__, __FUNCTION__, __LINE__, NULL) < 0);
+}
+
+/* Tests_SRS_LOG_LAYOUT_01_031: [ %L, %v, %T, %t, %F, %f, %l, %M, %m and %c shall be compiled as the level name, the short level, the UTC time with microseconds, the UTC time with nanoseconds, the file, the file name, the line, the function, the message and the context. ]*/
+/* Tests_SRS_LOG_LAYOUT_01_013: [ log_layout_format shall run the ops of layout in order, so that only the fields in the pattern are computed: ]*/
+/* Tests_SRS_LOG_LAYOUT_01_014: [ For a literal op, log_layout_format shall copy the literal characters. ]*/
+/* Tests_SRS_LOG_LAYOUT_01_015: [ For a level op, log_layout_format shall write the name of log_level. ]*/
+/* Tests_SRS_LOG_LAYOUT_01_016: [ For a short level op, log_layout_format shall write C, E, W, I or V for log_level. ]*/
+/* Tests_SRS_LOG_LAYOUT_01_020: [ For a file op, log_layout_format shall write file (NULL if file is NULL). ]*/
+/* Tests_SRS_LOG_LAYOUT_01_021: [ For a file name op, log_layout_format shall write the part of file after the last / or \ (NULL if file is NULL). ]*/
+/* Tests_SRS_LOG_LAYOUT_01_022: [ For a line op, log_layout_format shall write line in decimal. ]*/
+/* Tests_SRS_LOG_LAYOUT_01_023: [ For a function op, log_layout_format shall write func (NULL if func is NULL). ]*/
+/* Tests_SRS_LOG_LAYOUT_01_024: [ For a message op, log_layout_format shall format the message by calling log_vsnprintf_cached with message_format and args. ]*/
+/* Tests_SRS_LOG_LAYOUT_01_026: [ log_layout_format shall write at most buffer_size characters including the null terminator and return the number of characters written without the null terminator. ]*/
+static void log_layout_format_writes_the_fields(void)
+{
+    // arrange
+    // act
+    // assert
+    assert_line("%L", LOG_LEVEL_WARNING, NULL, "dir/file.c", "LOG_LEVEL_WARNING");
+    assert_line("%v%v%v%v%v", LOG_LEVEL_CRITICAL, NULL, "dir/file.c", "CCCCC");
+    assert_line("%v", LOG_LEVEL_ERROR, NULL, "dir/file.c", "E");
+    assert_line("%v", LOG_LEVEL_WARNING, NULL, "dir/file.c", "W");
+    assert_line("%v", LOG_LEVEL_INFO, NULL, "dir/file.c", "I");
+    assert_line("%v", LOG_LEVEL_VERBOSE, NULL, "dir/file.c", "V");
+    assert_line("%F", LOG_LEVEL_INFO, NULL, "/src/dir/file.c", "/src/dir/file.c");
+    assert_line("%f", LOG_LEVEL_INFO, NULL, "/src/dir/file.c", "file.c");
+    assert_line("%f", LOG_LEVEL_INFO, NULL, "c:\\src\\dir\\file.c", "file.c");
+    assert_line("%f", LOG_LEVEL_INFO, NULL, "file.c", "file.c");
+    assert_line("%f|%F", LOG_LEVEL_INFO, NULL, NULL, "NULL|NULL");
+    assert_line("%l %M", LOG_LEVEL_INFO, NULL, "file.c", "42 some_func");
+    assert_line("%m", LOG_LEVEL_INFO, NULL, "file.c", "hello world 7");
+    assert_line("%m|%m", LOG_LEVEL_INFO, NULL, "file.c", "hello world 7|hello world 7");
+    assert_line("%v %f:%l %m%c", LOG_LEVEL_ERROR, NULL, "/src/dir/file.c", "E file.c:42 hello world 7");
+    assert_line("100%% [%M]", LOG_LEVEL_ERROR, NULL, "file.c", "100% [some_func]");
+    assert_line("", LOG_LEVEL_ERROR, NULL, "file.c", "");
+}
+
+/* Tests_SRS_LOG_LAYOUT_01_025: [ For a context op, if log_context is not NULL, log_layout_format shall write the properties of log_context by calling log_context_property_to_string. ]*/
+static void log_layout_format_writes_the_context(void)
+{
+    // arrange
+    LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42), LOG_CONTEXT_STRING_PROPERTY(name, "abc"));
+
+    // act
+    // assert
+    assert_line("%m%c", LOG_LEVEL_ERROR, &context_1, "file.c", "hello world 7 { x=42 name=abc }");
+    assert_line("%c|", LOG_LEVEL_ERROR, NULL, "file.c", "|");
+}
+
+/* Tests_SRS_LOG_LAYOUT_01_028: [ For a time op, log_layout_format shall obtain the time by calling log_timestamp_now and write it with timestamp_microseconds_to_string. ]*/
+/* Tests_SRS_LOG_LAYOUT_01_029: [ For a precise time op, log_layout_format shall obtain the time by calling log_timestamp_now and write it with timestamp_to_string. ]*/
+static void log_layout_format_writes_the_time(void)
+{
+    // arrange
+    LOG_LAYOUT layout;
+    char buffer[LOG_MAX_MESSAGE_LENGTH];
+    int year, month, day, hour, minute, second, microseconds, nanoseconds;
+    char end[2];
+    POOR_MANS_ASSERT(log_layout_compile(&layout, "[%T] [%t]") == 0);
+
+    // act
+    int result = test_log_layout_format(&layout, buffer, sizeof(buffer), LOG_LEVEL_INFO, NULL, __FILE__, __FUNCTION__, __LINE__, "");
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)strlen(buffer));
+    POOR_MANS_ASSERT(result == 62);
+    POOR_MANS_ASSERT(sscanf(buffer, "[%4d-%2d-%2dT%2d:%2d:%2d.%6dZ] [%*4d-%*2d-%*2dT%*2d:%*2d:%*2d.%9d%1[Z]]", &year, &month, &day, &hour, &minute, &second, &microseconds, &nanoseconds, end) == 9);
+    POOR_MANS_ASSERT(year >= 2024);
+    POOR_MANS_ASSERT(buffer[result - 1] == ']');
+}
+
+/* Tests_SRS_LOG_LAYOUT_01_026: [ log_layout_format shall write at most buffer_size characters including the null terminator and return the number of characters written without the null terminator. ]*/
+static void log_layout_format_truncates_the_line(void)
+{
+    // arrange
+    LOG_LAYOUT layout;
+    char buffer[12];
+    LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+    POOR_MANS_ASSERT(log_layout_compile(&layout, "%L %m%c") == 0);
+
+    for (size_t buffer_size = 1; buffer_size <= sizeof(buffer); buffer_size++)
+    {
+        // act
+        (void)memset(buffer, 'x', sizeof(buffer));
+        int result = test_log_layout_format(&layout, buffer, buffer_size, LOG_LEVEL_INFO, &context_1, __FILE__, __FUNCTION__, __LINE__, "message");
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)(buffer_size - 1));
+        POOR_MANS_ASSERT(buffer[buffer_size - 1] == '\0');
+        POOR_MANS_ASSERT(strncmp(buffer, "LOG_LEVEL_INFO message", buffer_size - 1) == 0);
+    }
+}
+
+/* Tests_SRS_LOG_LAYOUT_01_032: [ If the message or the context is truncated, log_layout_format shall end the line at the zero terminator written by log_vsnprintf_cached or log_context_property_to_string. ]*/
+static void log_layout_format_with_a_context_truncated_inside_a_multibyte_character_ends_the_line_before_it(void)
+{
+    // arrange
+    static const char expected_line[] = " { w=a\xE2\x82\xAC }|message";
+    LOG_LAYOUT layout;
+    char buffer[sizeof(expected_line)];
+    LOG_CONTEXT_HANDLE context_1;
+    LOG_CONTEXT_CREATE(context_1, NULL, LOG_CONTEXT_WSTRING_PROPERTY(w, L"a\u20AC"));
+    POOR_MANS_ASSERT(context_1 != NULL);
+    POOR_MANS_ASSERT(log_layout_compile(&layout, "%c|%m") == 0);
+
+    for (size_t buffer_size = 1; buffer_size <= sizeof(buffer); buffer_size++)
+    {
+        // act
+        (void)memset(buffer, 'x', sizeof(buffer));
+        int result = test_log_layout_format(&layout, buffer, buffer_size, LOG_LEVEL_INFO, context_1, __FILE__, __FUNCTION__, __LINE__, "message");
+
+        // assert
+        // the line is a prefix of the full line that does not cut the euro sign, and the result is its length
+        POOR_MANS_ASSERT(result == (int)strlen(buffer));
+        POOR_MANS_ASSERT(strncmp(buffer, expected_line, (size_t)result) == 0);
+        POOR_MANS_ASSERT((result <= 6) || (result >= 9));
+        POOR_MANS_ASSERT((buffer_size < 10) ? (result <= 6) : (result == (int)(buffer_size - 1)));
+    }
+
+    // cleanup
+    log_context_destroy(context_1);
+}
+
+int main(void)
+{
+    log_layout_compile_with_NULL_layout_fails();
+    log_layout_compile_with_NULL_pattern_fails();
+    log_layout_compile_makes_one_op_per_literal_run_and_field();
+    log_layout_compile_with_empty_pattern_succeeds();
+    log_layout_compile_with_unknown_field_fails();
+    log_layout_compile_with_too_many_ops_fails();
+    log_layout_compile_with_too_long_literal_fails();
+
+    log_layout_format_with_invalid_arguments_fails();
+    log_layout_format_writes_the_fields();
+    log_layout_format_writes_the_context();
+    log_layout_format_writes_the_time();
+    log_layout_format_truncates_the_line();
+    log_layout_format_with_a_context_truncated_inside_a_multibyte_character_ends_the_line_before_it();
+
+    return 0;
+}
@@ -0,0 +1,617 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <wchar.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_printf.h"
+
+// The in-house formatter is checked against the C library: every format is rendered by log_vsnprintf and by vsnprintf,
+// for several buffer sizes, and both the result and the buffer contents have to be the same.
+
+#define TEST_BUFFER_SIZE 512
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+static const size_t test_buffer_sizes[] = { 0, 1, 2, 3, 7, 16, 64, TEST_BUFFER_SIZE };
+
+static size_t compared_format_count;
+
+static void assert_matches_vsnprintf_v(int line, const char* format, va_list args)
+{
+    for (size_t i = 0; i < MU_COUNT_ARRAY_ITEMS(test_buffer_sizes); i++)
+    {
+        char expected[TEST_BUFFER_SIZE];
+        char actual[TEST_BUFFER_SIZE];
+        va_list expected_args;
+        va_list actual_args;
+
+        (void)memset(expected, 'x', sizeof(expected));
+        (void)memset(actual, 'x', sizeof(actual));
+
+        va_copy(expected_args, args);
+        int expected_result = vsnprintf(expected, test_buffer_sizes[i], format, expected_args);
+        va_end(expected_args);
+
+        va_copy(actual_args, args);
+        int actual_result = log_vsnprintf(actual, test_buffer_sizes[i], format, actual_args);
+        va_end(actual_args);
+
+        if ((actual_result != expected_result) || (memcmp(actual, expected, sizeof(actual)) != 0))
+        {
+            (void)printf("line %d, format \"%s\", buffer size %zu: expected %d \"%.*s\", got %d \"%.*s\"\r\n",
+                line, format, test_buffer_sizes[i],
+                expected_result, (int)strnlen(expected, sizeof(expected)), expected,
+                actual_result, (int)strnlen(actual, sizeof(actual)), actual);
+            POOR_MANS_ASSERT(false);
+        }
+    }
+
+    compared_format_count++;
+}
+
+static void assert_matches_vsnprintf(int line, const char* format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    assert_matches_vsnprintf_v(line, format, args);
+    va_end(args);
+}
+
+// formats built at run time are not checked by the compiler, the argument types are the ones of the conversion
+#define ASSERT_MATCHES_VSNPRINTF(format, ...) \
+    assert_matches_vsnprintf(__LINE__, format MU_IFCOMMALOGIC(MU_COUNT_ARG(__VA_ARGS__)) __VA_ARGS__)
+
+static void assert_cached_matches_vsnprintf(int line, const char* format, ...)
+{
+    // each buffer size is formatted twice, the first call for a format parses it, the following ones use the cached plan
+    for (size_t i = 0; i < 2 * MU_COUNT_ARRAY_ITEMS(test_buffer_sizes); i++)
+    {
+        size_t buffer_size = test_buffer_sizes[i / 2];
+        char expected[TEST_BUFFER_SIZE];
+        char actual[TEST_BUFFER_SIZE];
+        va_list args;
+
+        (void)memset(expected, 'x', sizeof(expected));
+        (void)memset(actual, 'x', sizeof(actual));
+
+        va_start(args, format);
+        int expected_result = vsnprintf(expected, buffer_size, format, args);
+        va_end(args);
+
+        va_start(args, format);
+        int actual_result = log_vsnprintf_cached(actual, buffer_size, format, args);
+        va_end(args);
+
+        if ((actual_result != expected_result) || (memcmp(actual, expected, sizeof(actual)) != 0))
+        {
+            (void)printf("line %d, format \"%s\", buffer size %zu: expected %d \"%.*s\", got %d \"%.*s\"\r\n",
+                line, format, buffer_size,
+                expected_result, (int)strnlen(expected, sizeof(expected)), expected,
+                actual_result, (int)strnlen(actual, sizeof(actual)), actual);
+            POOR_MANS_ASSERT(false);
+        }
+    }
+
+    compared_format_count++;
+}
+
+// the cache is keyed by the format pointer, so these have to be string literals (or formats that never change)
+#define ASSERT_CACHED_MATCHES_VSNPRINTF(format, ...) \
+    assert_cached_matches_vsnprintf(__LINE__, format MU_IFCOMMALOGIC(MU_COUNT_ARG(__VA_ARGS__)) __VA_ARGS__)
+
+static int test_log_snprintf_cached(char* buffer, size_t buffer_size, const char* format, ...)
+{
+    int result;
+    va_list args;
+    va_start(args, format);
+    result = log_vsnprintf_cached(buffer, buffer_size, format, args);
+    va_end(args);
+    return result;
+}
+
+static const char* flag_combinations[] = { "", "-", "+", " ", "#", "0", "-+", "- ", "-#", "-0", "+0", " 0", "#0", "+ ", "-+#0 ", "+#0" };
+static const char* widths[] = { "", "1", "5", "25" };
+static const char* precisions[] = { "", ".", ".0", ".1", ".5", ".30" };
+
+static const int64_t signed_test_values[] = { 0, 1, -1, 7, -8, 42, 127, -128, 255, 32767, -32768, 65535, INT32_MAX, INT32_MIN, (int64_t)UINT32_MAX, INT64_MAX, INT64_MIN };
+
+// builds "%{flags}{width}{precision}{length_modifier}{conversion}"
+static void build_format(char* format, size_t format_size, const char* flags, const char* width, const char* precision, const char* length_modifier, char conversion)
+{
+    int snprintf_result = snprintf(format, format_size, "%%%s%s%s%s%c", flags, width, precision, length_modifier, conversion);
+    POOR_MANS_ASSERT((snprintf_result > 0) && ((size_t)snprintf_result < format_size));
+}
+
+/* log_vsnprintf */
+
+/* Tests_SRS_LOG_PRINTF_01_001: [ If buffer is NULL and buffer_size is not 0, log_vsnprintf shall fail and return a negative value. ]*/
+static void log_snprintf_with_NULL_buffer_and_non_zero_size_fails(void)
+{
+    // arrange
+
+    // act
+    int result = log_snprintf(NULL, 1, "%d", 42);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_PRINTF_01_002: [ If format is NULL, log_vsnprintf shall fail and return a negative value. ]*/
+static void log_snprintf_with_NULL_format_fails(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+    const char* format = NULL;
+
+    // act
+    int result = log_snprintf(buffer, sizeof(buffer), format);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_PRINTF_01_017: [ log_vsnprintf shall succeed and return the length of the full output (without the null terminator). ]*/
+static void log_snprintf_with_NULL_buffer_and_zero_size_returns_the_length(void)
+{
+    // arrange
+
+    // act
+    int result = log_snprintf(NULL, 0, "abc %d %s", 42, "haga");
+
+    // assert
+    POOR_MANS_ASSERT(result == 11);
+}
+
+/* Tests_SRS_LOG_PRINTF_01_003: [ log_vsnprintf shall copy the characters between conversion specs to buffer as they are. ]*/
+/* Tests_SRS_LOG_PRINTF_01_009: [ log_vsnprintf shall format %% as %. ]*/
+/* Tests_SRS_LOG_PRINTF_01_016: [ log_vsnprintf shall store at most buffer_size characters including the null terminator in buffer (the rest of the output shall be truncated). ]*/
+static void log_snprintf_literals_match_vsnprintf(void)
+{
+    ASSERT_MATCHES_VSNPRINTF("");
+    ASSERT_MATCHES_VSNPRINTF("a");
+    ASSERT_MATCHES_VSNPRINTF("some text without conversions that is longer than some of the buffers");
+    ASSERT_MATCHES_VSNPRINTF("%%");
+    ASSERT_MATCHES_VSNPRINTF("100%% done, %%%% twice%%");
+}
+
+/* Tests_SRS_LOG_PRINTF_01_005: [ log_vsnprintf shall format d, i, u, o, x and X conversions for all length modifiers, flags, widths and precisions without calling the C library. ]*/
+static void log_snprintf_integers_match_vsnprintf(void)
+{
+    static const char conversions[] = { 'd', 'i', 'u', 'o', 'x', 'X' };
+    static const char* length_modifiers[] = { "hh", "h", "", "l", "ll", "j", "z", "t" };
+    char format[64];
+
+    for (size_t flags = 0; flags < MU_COUNT_ARRAY_ITEMS(flag_combinations); flags++)
+    {
+        for (size_t width = 0; width < MU_COUNT_ARRAY_ITEMS(widths); width++)
+        {
+            for (size_t precision = 0; precision < MU_COUNT_ARRAY_ITEMS(precisions); precision++)
+            {
+                for (size_t conversion = 0; conversion < MU_COUNT_ARRAY_ITEMS(conversions); conversion++)
+                {
+                    for (size_t length_modifier = 0; length_modifier < MU_COUNT_ARRAY_ITEMS(length_modifiers); length_modifier++)
+                    {
+                        build_format(format, sizeof(format), flag_combinations[flags], widths[width], precisions[precision], length_modifiers[length_modifier], conversions[conversion]);
+
+                        for (size_t i = 0; i < MU_COUNT_ARRAY_ITEMS(signed_test_values); i++)
+                        {
+                            int64_t value = signed_test_values[i];
+                            switch (length_modifier)
+                            {
+                            case 0:
+                            case 1:
+                            case 2:
+                                ASSERT_MATCHES_VSNPRINTF(format, (int)value);
+                                break;
+                            case 3:
+                                ASSERT_MATCHES_VSNPRINTF(format, (long)value);
+                                break;
+                            case 4:
+                                ASSERT_MATCHES_VSNPRINTF(format, (long long)value);
+                                break;
+                            case 5:
+                                ASSERT_MATCHES_VSNPRINTF(format, (intmax_t)value);
+                                break;
+                            case 6:
+                                ASSERT_MATCHES_VSNPRINTF(format, (size_t)value);
+                                break;
+                            default:
+                                ASSERT_MATCHES_VSNPRINTF(format, (ptrdiff_t)value);
+                                break;
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* Tests_SRS_LOG_PRINTF_01_005: [ log_vsnprintf shall format d, i, u, o, x and X conversions for all length modifiers, flags, widths and precisions without calling the C library. ]*/
+static void log_snprintf_inttypes_macros_match_vsnprintf(void)
+{
+    ASSERT_MATCHES_VSNPRINTF("%" PRIu64 " %" PRId64 " %" PRIx64 " %" PRIX64, UINT64_MAX, INT64_MIN, UINT64_MAX, (uint64_t)0xABCDEF);
+    ASSERT_MATCHES_VSNPRINTF("%" PRIu32 " %" PRId32 " %" PRIx32, UINT32_MAX, INT32_MIN, (uint32_t)0xDEADBEEF);
+    ASSERT_MATCHES_VSNPRINTF("%" PRIu16 " %" PRId16 " %" PRIu8 " %" PRId8, (uint16_t)65535, (int16_t)-32768, (uint8_t)255, (int8_t)-128);
+    ASSERT_MATCHES_VSNPRINTF("%zu %zx %td", (size_t)SIZE_MAX, (size_t)4096, (ptrdiff_t)-12);
+}
+
+/* Tests_SRS_LOG_PRINTF_01_004: [ log_vsnprintf shall take the width and precision given as * from the arguments (a negative width sets the - flag, a negative precision is ignored). ]*/
+static void log_snprintf_star_width_and_precision_match_vsnprintf(void)
+{
+    static const int star_values[] = { 0, 1, 3, 10, -1, -10, INT_MIN };
+
+    for (size_t width = 0; width < MU_COUNT_ARRAY_ITEMS(star_values); width++)
+    {
+        for (size_t precision = 0; precision < MU_COUNT_ARRAY_ITEMS(star_values); precision++)
+        {
+            if (star_values[width] != INT_MIN)
+            {
+                ASSERT_MATCHES_VSNPRINTF("[%*.*d]", star_values[width], star_values[precision], 42);
+                ASSERT_MATCHES_VSNPRINTF("[%*.*s]", star_values[width], star_values[precision], "haga");
+                ASSERT_MATCHES_VSNPRINTF("[%0*x]", star_values[width], 0x2A);
+            }
+            ASSERT_MATCHES_VSNPRINTF("[%.*s]", star_values[precision], "uaga");
+        }
+    }
+}
+
+/* Tests_SRS_LOG_PRINTF_01_006: [ log_vsnprintf shall format c and s conversions (with width and precision) without calling the C library. ]*/
+static void log_snprintf_chars_and_strings_match_vsnprintf(void)
+{
+    static const char* string_values[] = { "", "a", "haga", "a string that is longer than most widths and precisions" };
+    char format[64];
+
+    for (size_t flags = 0; flags < MU_COUNT_ARRAY_ITEMS(flag_combinations); flags++)
+    {
+        // only '-' applies to strings and characters
+        if (strpbrk(flag_combinations[flags], "+ #0") == NULL)
+        {
+            for (size_t width = 0; width < MU_COUNT_ARRAY_ITEMS(widths); width++)
+            {
+                for (size_t precision = 0; precision < MU_COUNT_ARRAY_ITEMS(precisions); precision++)
+                {
+                    build_format(format, sizeof(format), flag_combinations[flags], widths[width], precisions[precision], "", 's');
+                    for (size_t i = 0; i < MU_COUNT_ARRAY_ITEMS(string_values); i++)
+                    {
+                        ASSERT_MATCHES_VSNPRINTF(format, string_values[i]);
+                    }
+
+                    build_format(format, sizeof(format), flag_combinations[flags], widths[width], "", "", 'c');
+                    ASSERT_MATCHES_VSNPRINTF(format, 'x');
+                    ASSERT_MATCHES_VSNPRINTF(format, 0xE9);
+                }
+            }
+        }
+    }
+
+    ASSERT_MATCHES_VSNPRINTF("%c%c%c", 'a', 0, 'b');
+}
+
+/* Tests_SRS_LOG_PRINTF_01_006: [ log_vsnprintf shall format c and s conversions (with width and precision) without calling the C library. ]*/
+static void log_snprintf_with_precision_does_not_read_past_precision(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+    const char not_terminated[3] = { 'a', 'b', 'c' };
+
+    // act
+    int result = log_snprintf(buffer, sizeof(buffer), "%.3s", not_terminated);
+
+    // assert
+    POOR_MANS_ASSERT(result == 3);
+    POOR_MANS_ASSERT(strcmp(buffer, "abc") == 0);
+}
+
+/* Tests_SRS_LOG_PRINTF_01_011: [ log_vsnprintf shall format a NULL string as the C library does. ]*/
+static void log_snprintf_NULL_string_matches_vsnprintf(void)
+{
+    const char* null_string = NULL;
+    ASSERT_MATCHES_VSNPRINTF("[%s]", null_string);
+    ASSERT_MATCHES_VSNPRINTF("[%10s]", null_string);
+    ASSERT_MATCHES_VSNPRINTF("[%-10s]", null_string);
+    ASSERT_MATCHES_VSNPRINTF("[%.3s]", null_string);
+    ASSERT_MATCHES_VSNPRINTF("[%.6s]", null_string);
+}
+
+/* Tests_SRS_LOG_PRINTF_01_007: [ log_vsnprintf shall format non NULL p conversions without flags other than - and without precision the way the C library does, without calling it. ]*/
+static void log_snprintf_pointers_match_vsnprintf(void)
+{
+    int some_variable;
+    void* pointer_values[] = { NULL, &some_variable, (void*)(uintptr_t)1, (void*)(uintptr_t)0xABCDEF, (void*)UINTPTR_MAX };
+
+    for (size_t i = 0; i < MU_COUNT_ARRAY_ITEMS(pointer_values); i++)
+    {
+        ASSERT_MATCHES_VSNPRINTF("%p", pointer_values[i]);
+        ASSERT_MATCHES_VSNPRINTF("[%5p]", pointer_values[i]);
+        ASSERT_MATCHES_VSNPRINTF("[%-30p]", pointer_values[i]);
+        ASSERT_MATCHES_VSNPRINTF("[%30p]", pointer_values[i]);
+    }
+}
+
+/* Tests_SRS_LOG_PRINTF_01_008: [ log_vsnprintf shall store the number of characters produced so far for n conversions. ]*/
+static void log_snprintf_n_stores_the_count_so_far(void)
+{
+    // arrange
+    char buffer[4];
+    int count_1 = -1;
+    long long count_2 = -1;
+    signed char count_3 = -1;
+    size_t count_4 = 0;
+
+    // act
+    int result = log_snprintf(buffer, sizeof(buffer), "ab%ncdef%lln%d%hhn%s%zn", &count_1, &count_2, 12345, &count_3, "xyz", &count_4);
+
+    // assert
+    POOR_MANS_ASSERT(result == 14);
+    POOR_MANS_ASSERT(strcmp(buffer, "abc") == 0);
+    POOR_MANS_ASSERT(count_1 == 2);
+    POOR_MANS_ASSERT(count_2 == 6);
+    POOR_MANS_ASSERT(count_3 == 11);
+    POOR_MANS_ASSERT(count_4 == 14);
+}
+
+/* Tests_SRS_LOG_PRINTF_01_010: [ log_vsnprintf shall format floating point conversions, wide characters and wide strings by calling snprintf for the single conversion. ]*/
+static void log_snprintf_floating_point_and_wide_match_vsnprintf(void)
+{
+    ASSERT_MATCHES_VSNPRINTF("%f %e %g %a", 1.5, -2.25e-10, 1e100, 0.1);
+    ASSERT_MATCHES_VSNPRINTF("[%-+12.3f] [%#08.0E] [% G] [%A]", 3.14159, 42.0, -0.0, 1.0);
+    ASSERT_MATCHES_VSNPRINTF("[%*.*f] [%lf]", -15, 2, 2.71828, 0.5);
+    ASSERT_MATCHES_VSNPRINTF("[%Lf] [%Lg]", (long double)1.25, (long double)-3e300);
+    ASSERT_MATCHES_VSNPRINTF("%s=%.3f %s=%d", "ratio", 0.333333, "count", 7);
+    ASSERT_MATCHES_VSNPRINTF("[%ls] [%5lc] [%.2ls]", L"haga", (wint_t)L'x', L"uaga");
+}
+
+/* Tests_SRS_LOG_PRINTF_01_012: [ When a conversion spec is not one that log_vsnprintf formats itself (positional arguments, grouping, platform specific length modifiers, invalid specs), log_vsnprintf shall format the rest of format by calling vsnprintf with the remaining arguments. ]*/
+static void log_snprintf_specs_left_to_the_C_library_match_vsnprintf(void)
+{
+    char format[64];
+
+    // positional arguments
+    ASSERT_MATCHES_VSNPRINTF("%2$s %1$d", 42, "haga");
+    // grouping after in-house conversions
+    (void)strcpy(format, "%d %s %'d %d");
+    ASSERT_MATCHES_VSNPRINTF(format, 1, "two", 1234567, 4);
+    // flags on %%
+    (void)strcpy(format, "%d %5%|%s");
+    ASSERT_MATCHES_VSNPRINTF(format, 1, "x");
+}
+
+/* Tests_SRS_LOG_PRINTF_01_013: [ log_vsnprintf shall format m as the text for the errno value at the time of the call and #m as the name of that errno value. ]*/
+static void log_snprintf_errno_extensions_match_vsnprintf(void)
+{
+    char format[64];
+
+    errno = ENOENT;
+    ASSERT_MATCHES_VSNPRINTF("open failed: %m (%d)", 3);
+    errno = EINVAL;
+    ASSERT_MATCHES_VSNPRINTF("[%-30m]");
+
+    // %#m is not known to all compilers' format checks
+    (void)strcpy(format, "%#m");
+    errno = EAGAIN;
+    ASSERT_MATCHES_VSNPRINTF(format);
+}
+
+/* Tests_SRS_LOG_PRINTF_01_015: [ If the length of the output does not fit in an int, log_vsnprintf shall fail and return a negative value. ]*/
+static void log_snprintf_with_output_longer_than_INT_MAX_fails(void)
+{
+    // arrange
+    char buffer[16];
+
+    // act
+    int result = log_snprintf(buffer, sizeof(buffer), "%*d%*d", INT_MAX - 1, 1, 10, 2);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_PRINTF_01_018: [ log_snprintf shall call log_vsnprintf with buffer, buffer_size, format and the arguments in .... ]*/
+/* Tests_SRS_LOG_PRINTF_01_019: [ log_snprintf shall return the result of log_vsnprintf. ]*/
+static void log_snprintf_mixed_message_matches_vsnprintf(void)
+{
+    ASSERT_MATCHES_VSNPRINTF("Error %d creating %s (handle=%p, size=%" PRIu64 ", flags=0x%08" PRIx32 ")", -5, "queue", (void*)&compared_format_count, (uint64_t)123456789012, (uint32_t)0xC0FFEE);
+    ASSERT_MATCHES_VSNPRINTF("[%s] [%-8s] [%8.3s] [%c] [%5d] [%-5d] [%05d] [%+d] [% d] [%#o] [%#x] [%%]", "a", "bb", "cccc", 'd', 1, 2, 3, 4, 5, 8u, 255u);
+}
+
+/* log_vsnprintf_cached */
+
+/* Tests_SRS_LOG_PRINTF_01_020: [ If buffer is NULL and buffer_size is not 0, log_vsnprintf_cached shall fail and return a negative value. ]*/
+static void log_vsnprintf_cached_with_NULL_buffer_and_non_zero_size_fails(void)
+{
+    // arrange
+
+    // act
+    int result = test_log_snprintf_cached(NULL, 1, "%d", 42);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_PRINTF_01_021: [ If format is NULL, log_vsnprintf_cached shall fail and return a negative value. ]*/
+static void log_vsnprintf_cached_with_NULL_format_fails(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+    const char* format = NULL;
+
+    // act
+    int result = test_log_snprintf_cached(buffer, sizeof(buffer), format);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_LOG_PRINTF_01_022: [ log_vsnprintf_cached shall look up the plan for format (its literal text and parsed conversion specs) in a cache keyed by the format pointer. ]*/
+/* Tests_SRS_LOG_PRINTF_01_023: [ If the format is not in the cache, log_vsnprintf_cached shall parse it and add its plan to the cache without taking a lock. ]*/
+/* Tests_SRS_LOG_PRINTF_01_025: [ log_vsnprintf_cached shall produce the same output and return the same value as log_vsnprintf. ]*/
+static void log_vsnprintf_cached_matches_vsnprintf(void)
+{
+    ASSERT_CACHED_MATCHES_VSNPRINTF("");
+    ASSERT_CACHED_MATCHES_VSNPRINTF("no conversions at all");
+    ASSERT_CACHED_MATCHES_VSNPRINTF("%d", INT32_MIN);
+    ASSERT_CACHED_MATCHES_VSNPRINTF("%s%s", "a", "b");
+    ASSERT_CACHED_MATCHES_VSNPRINTF("Error %d creating %s (handle=%p, size=%" PRIu64 ", flags=0x%08" PRIx32 ") %%", -5, "queue", (void*)&compared_format_count, (uint64_t)123456789012, (uint32_t)0xC0FFEE);
+    ASSERT_CACHED_MATCHES_VSNPRINTF("[%-+12.3f] [%ls] [%5lc] [%-8.3s]", 3.14159, L"haga", (wint_t)L'x', "uaga");
+    ASSERT_CACHED_MATCHES_VSNPRINTF("%2$s %1$d", 42, "haga");
+    ASSERT_CACHED_MATCHES_VSNPRINTF("%d %s %'d %d", 1, "two", 1234567, 4);
+    errno = ENOENT;
+    ASSERT_CACHED_MATCHES_VSNPRINTF("open failed: %m (%d)", 3);
+}
+
+/* Tests_SRS_LOG_PRINTF_01_025: [ log_vsnprintf_cached shall produce the same output and return the same value as log_vsnprintf. ]*/
+static void log_vsnprintf_cached_star_width_does_not_change_the_cached_plan(void)
+{
+    // arrange
+    char buffer[TEST_BUFFER_SIZE];
+    const char* format = "[%*d]";
+
+    // act
+    int result_1 = test_log_snprintf_cached(buffer, sizeof(buffer), format, -5, 1);
+    POOR_MANS_ASSERT(strcmp(buffer, "[1    ]") == 0);
+    int result_2 = test_log_snprintf_cached(buffer, sizeof(buffer), format, 5, 2);
+
+    // assert
+    POOR_MANS_ASSERT(result_1 == 7);
+    POOR_MANS_ASSERT(result_2 == 7);
+    POOR_MANS_ASSERT(strcmp(buffer, "[    2]") == 0);
+}
+
+/* Tests_SRS_LOG_PRINTF_01_008: [ log_vsnprintf shall store the number of characters produced so far for n conversions. ]*/
+static void log_vsnprintf_cached_n_stores_the_count_so_far(void)
+{
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        // arrange
+        char buffer[4];
+        int count_1 = -1;
+        size_t count_2 = 0;
+
+        // act
+        int result = test_log_snprintf_cached(buffer, sizeof(buffer), "ab%ncdef%d%zn", &count_1, 12345, &count_2);
+
+        // assert
+        POOR_MANS_ASSERT(result == 11);
+        POOR_MANS_ASSERT(strcmp(buffer, "abc") == 0);
+        POOR_MANS_ASSERT(count_1 == 2);
+        POOR_MANS_ASSERT(count_2 == 11);
+    }
+}
+
+/* Tests_SRS_LOG_PRINTF_01_024: [ If the plan cannot be added to the cache (the cache is full, another thread is adding a plan in the same place or the format has more than 32 conversions), log_vsnprintf_cached shall format the message as log_vsnprintf does. ]*/
+static void log_vsnprintf_cached_with_more_than_32_conversions_matches_vsnprintf(void)
+{
+    ASSERT_CACHED_MATCHES_VSNPRINTF("%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d|%s",
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, "end");
+}
+
+/* Tests_SRS_LOG_PRINTF_01_026: [ log_vsnprintf_cached shall read the text at format only when it adds the plan to the cache, a cached plan shall be used without comparing the text at format with the text the plan was made of. ]*/
+static void log_vsnprintf_cached_runs_the_cached_plan_without_reading_the_format_again(void)
+{
+    // arrange
+    static char format[32];
+    char buffer[TEST_BUFFER_SIZE];
+    (void)strcpy(format, "first %d");
+    int result_1 = test_log_snprintf_cached(buffer, sizeof(buffer), format, 1);
+    POOR_MANS_ASSERT(result_1 == 7);
+    POOR_MANS_ASSERT(strcmp(buffer, "first 1") == 0);
+    // the plan was made of a copy of the text, it does not point into format
+    (void)memset(format, 'x', sizeof(format) - 1);
+    format[sizeof(format) - 1] = '\0';
+
+    // act
+    int result_2 = test_log_snprintf_cached(buffer, sizeof(buffer), format, 2);
+
+    // assert
+    POOR_MANS_ASSERT(result_2 == 7);
+    POOR_MANS_ASSERT(strcmp(buffer, "first 2") == 0);
+}
+
+#define MANY_FORMATS_COUNT 3000
+#define MANY_FORMATS_LENGTH 128
+
+// formats that stay valid (and unchanged) once built, as the cache requires
+static char many_formats[MANY_FORMATS_COUNT][MANY_FORMATS_LENGTH];
+
+/* Tests_SRS_LOG_PRINTF_01_024: [ If the plan cannot be added to the cache (the cache is full, another thread is adding a plan in the same place or the format has more than 32 conversions), log_vsnprintf_cached shall format the message as log_vsnprintf does. ]*/
+static void log_vsnprintf_cached_with_more_formats_than_the_cache_holds_matches_vsnprintf(void)
+{
+    // arrange
+    // 3000 formats with 31 conversions each fill both the cache slots and the steps kept for the plans
+    for (uint32_t i = 0; i < MANY_FORMATS_COUNT; i++)
+    {
+        int snprintf_result = snprintf(many_formats[i], MANY_FORMATS_LENGTH, "%" PRIu32 ":%s", i,
+            "%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%s");
+        POOR_MANS_ASSERT((snprintf_result > 0) && (snprintf_result < MANY_FORMATS_LENGTH));
+    }
+
+    // act
+    // assert
+    for (uint32_t pass = 0; pass < 2; pass++)
+    {
+        for (uint32_t i = 0; i < MANY_FORMATS_COUNT; i++)
+        {
+            char expected[TEST_BUFFER_SIZE];
+            char actual[TEST_BUFFER_SIZE];
+            int expected_result = snprintf(expected, sizeof(expected), "%" PRIu32 ":%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%d%s", i,
+                1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, "end");
+            int actual_result = test_log_snprintf_cached(actual, sizeof(actual), many_formats[i],
+                1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, "end");
+            POOR_MANS_ASSERT(actual_result == expected_result);
+            POOR_MANS_ASSERT(strcmp(actual, expected) == 0);
+        }
+    }
+}
+
+/* very "poor man's" way of testing, as no test harness and mocking framework are available */
+int main(void)
+{
+    log_snprintf_with_NULL_buffer_and_non_zero_size_fails();
+    log_snprintf_with_NULL_format_fails();
+    log_snprintf_with_NULL_buffer_and_zero_size_returns_the_length();
+
+    log_snprintf_literals_match_vsnprintf();
+    log_snprintf_integers_match_vsnprintf();
+    log_snprintf_inttypes_macros_match_vsnprintf();
+    log_snprintf_star_width_and_precision_match_vsnprintf();
+    log_snprintf_chars_and_strings_match_vsnprintf();
+    log_snprintf_with_precision_does_not_read_past_precision();
+    log_snprintf_NULL_string_matches_vsnprintf();
+    log_snprintf_pointers_match_vsnprintf();
+    log_snprintf_n_stores_the_count_so_far();
+    log_snprintf_floating_point_and_wide_match_vsnprintf();
+    log_snprintf_specs_left_to_the_C_library_match_vsnprintf();
+    log_snprintf_errno_extensions_match_vsnprintf();
+    log_snprintf_with_output_longer_than_INT_MAX_fails();
+    log_snprintf_mixed_message_matches_vsnprintf();
+
+    log_vsnprintf_cached_with_NULL_buffer_and_non_zero_size_fails();
+    log_vsnprintf_cached_with_NULL_format_fails();
+    log_vsnprintf_cached_matches_vsnprintf();
+    log_vsnprintf_cached_star_width_does_not_change_the_cached_plan();
+    log_vsnprintf_cached_n_stores_the_count_so_far();
+    log_vsnprintf_cached_with_more_than_32_conversions_matches_vsnprintf();
+    log_vsnprintf_cached_runs_the_cached_plan_without_reading_the_format_again();
+    log_vsnprintf_cached_with_more_formats_than_the_cache_holds_matches_vsnprintf();
+
+    (void)printf("%zu formats compared with vsnprintf\r\n", compared_format_count);
+
+    return 0;
+}
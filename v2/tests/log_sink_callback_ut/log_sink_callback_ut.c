@@ -7,7 +7,12 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
+
+#ifdef _WIN32
+#include "windows.h"
+#else
+#include <pthread.h>
+#endif
 
 #include "macro_utils/macro_utils.h"
 
@@ -17,8 +22,10 @@
 #include "c_logging/log_context_property_value_pair.h"
 #include "c_logging/log_level.h"
 #include "c_logging/log_sink_if.h"
+#include "c_logging/log_timestamp.h"
 #include "c_logging/log_context.h"
 #include "c_logging/logger.h"
+#include "c_logging/time_to_string.h"
 
 #include "c_logging/log_sink_callback.h"
 
@@ -27,14 +34,15 @@
 
 #define MOCK_CALL_TYPE_VALUES \
     MOCK_CALL_TYPE_printf, \
-    MOCK_CALL_TYPE_time, \
-    MOCK_CALL_TYPE_ctime, \
-    MOCK_CALL_TYPE_vsnprintf, \
+    MOCK_CALL_TYPE_log_timestamp_now, \
+    MOCK_CALL_TYPE_timestamp_microseconds_to_string, \
+    MOCK_CALL_TYPE_log_vsnprintf_cached, \
     MOCK_CALL_TYPE_snprintf, \
     MOCK_CALL_TYPE_log_context_get_property_value_pair_count, \
     MOCK_CALL_TYPE_log_context_get_property_value_pairs, \
     MOCK_CALL_TYPE_log_context_property_to_string, \
-    MOCK_CALL_TYPE_log_callback \
+    MOCK_CALL_TYPE_log_callback, \
+    MOCK_CALL_TYPE_log_record_callback \
 
 MU_DEFINE_ENUM(MOCK_CALL_TYPE, MOCK_CALL_TYPE_VALUES)
 
@@ -49,26 +57,26 @@ typedef struct printf_CALL_TAG
     char captured_output[MAX_PRINTF_CAPTURED_OUPUT_SIZE];
 } printf_CALL;
 
-typedef struct time_CALL_TAG
+typedef struct log_timestamp_now_CALL_TAG
 {
     bool override_result;
-    time_t call_result;
-    time_t* captured__time;
-} time_CALL;
+    int64_t call_result;
+    int64_t captured_result;
+} log_timestamp_now_CALL;
 
-typedef struct ctime_CALL_TAG
+typedef struct timestamp_microseconds_to_string_CALL_TAG
 {
     bool override_result;
-    char* call_result;
-    const time_t* captured_timer;
-} ctime_CALL;
+    int call_result;
+    int64_t captured_nanoseconds_since_epoch;
+} timestamp_microseconds_to_string_CALL;
 
-typedef struct vsnprintf_CALL_TAG
+typedef struct log_vsnprintf_cached_CALL_TAG
 {
     bool override_result;
     int call_result;
     const char* captured_format_arg;
-} vsnprintf_CALL;
+} log_vsnprintf_cached_CALL;
 
 typedef struct snprintf_CALL_TAG
 {
@@ -108,20 +116,37 @@ typedef struct log_callback_CALL_TAG
     char captured_output[MAX_PRINTF_CAPTURED_OUPUT_SIZE];
 } log_callback_CALL;
 
+typedef struct log_record_callback_CALL_TAG
+{
+    bool get_message;
+    void* captured_context;
+    LOG_LEVEL captured_log_level;
+    int64_t captured_time;
+    const char* captured_file;
+    const char* captured_func;
+    int captured_line;
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* captured_property_value_pairs;
+    size_t captured_property_value_pair_count;
+    bool captured_message_is_NULL;
+    bool captured_message_is_cached;
+    char captured_message[MAX_PRINTF_CAPTURED_OUPUT_SIZE];
+} log_record_callback_CALL;
+
 typedef struct MOCK_CALL_TAG
 {
     MOCK_CALL_TYPE mock_call_type;
     union
     {
         printf_CALL printf_call;
-        time_CALL time_call;
-        ctime_CALL ctime_call;
-        vsnprintf_CALL vsnprintf_call;
+        log_timestamp_now_CALL log_timestamp_now_call;
+        timestamp_microseconds_to_string_CALL timestamp_microseconds_to_string_call;
+        log_vsnprintf_cached_CALL log_vsnprintf_cached_call;
         snprintf_CALL snprintf_call;
         log_context_get_property_value_pair_count_CALL log_context_get_property_value_pair_count_call;
         log_context_get_property_value_pairs_CALL log_context_get_property_value_pairs_call;
         log_context_property_to_string_CALL log_context_property_to_string_call;
         log_callback_CALL log_callback_call;
+        log_record_callback_CALL log_record_callback_call;
     };
 } MOCK_CALL;
 
@@ -173,26 +198,26 @@ int mock_printf(const char* format, ...)
     return result;
 }
 
-time_t mock_time(time_t* const _time)
+int64_t mock_log_timestamp_now(void)
 {
-    time_t result;
+    int64_t result;
 
     if ((actual_call_count == expected_call_count) ||
-        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_time))
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_log_timestamp_now))
     {
         actual_and_expected_match = false;
-        result = (time_t)-1;
+        result = LOG_TIMESTAMP_INVALID;
     }
     else
     {
-        if (expected_calls[actual_call_count].time_call.override_result)
+        if (expected_calls[actual_call_count].log_timestamp_now_call.override_result)
         {
-            result = expected_calls[actual_call_count].time_call.call_result;
+            result = expected_calls[actual_call_count].log_timestamp_now_call.call_result;
         }
         else
         {
-            expected_calls[actual_call_count].time_call.captured__time = _time;
-            result = time(_time);
+            result = log_timestamp_now();
+            expected_calls[actual_call_count].log_timestamp_now_call.captured_result = result;
         }
 
         actual_call_count++;
@@ -201,26 +226,26 @@ time_t mock_time(time_t* const _time)
     return result;
 }
 
-char* mock_ctime(const time_t* timer)
+int mock_timestamp_microseconds_to_string(int64_t nanoseconds_since_epoch, char* buffer, size_t buffer_length)
 {
-    char* result;
+    int result;
 
     if ((actual_call_count == expected_call_count) ||
-        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_ctime))
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_timestamp_microseconds_to_string))
     {
         actual_and_expected_match = false;
-        result = NULL;
+        result = -1;
     }
     else
     {
-        if (expected_calls[actual_call_count].ctime_call.override_result)
+        if (expected_calls[actual_call_count].timestamp_microseconds_to_string_call.override_result)
         {
-            result = expected_calls[actual_call_count].ctime_call.call_result;
+            result = expected_calls[actual_call_count].timestamp_microseconds_to_string_call.call_result;
         }
         else
         {
-            expected_calls[actual_call_count].ctime_call.captured_timer = timer;
-            result = ctime(timer);
+            expected_calls[actual_call_count].timestamp_microseconds_to_string_call.captured_nanoseconds_since_epoch = nanoseconds_since_epoch;
+            result = timestamp_microseconds_to_string(nanoseconds_since_epoch, buffer, buffer_length);
         }
 
         actual_call_count++;
@@ -229,25 +254,25 @@ char* mock_ctime(const time_t* timer)
     return result;
 }
 
-int mock_vsnprintf(char* s, size_t n, const char* format, va_list args)
+int mock_log_vsnprintf_cached(char* s, size_t n, const char* format, va_list args)
 {
     int result;
 
     if ((actual_call_count == expected_call_count) ||
-        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_vsnprintf))
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_log_vsnprintf_cached))
     {
         actual_and_expected_match = false;
         result = -1;
     }
     else
     {
-        if (expected_calls[actual_call_count].vsnprintf_call.override_result)
+        if (expected_calls[actual_call_count].log_vsnprintf_cached_call.override_result)
         {
-            result = expected_calls[actual_call_count].vsnprintf_call.call_result;
+            result = expected_calls[actual_call_count].log_vsnprintf_cached_call.call_result;
         }
         else
         {
-            expected_calls[actual_call_count].vsnprintf_call.captured_format_arg = format;
+            expected_calls[actual_call_count].log_vsnprintf_cached_call.captured_format_arg = format;
 
             result = vsnprintf(s, n, format, args);
 
@@ -401,6 +426,42 @@ static void mock_log_callback(void* context, LOG_LEVEL log_level, const char* me
     }
 }
 
+static void mock_log_record_callback(void* context, const LOG_SINK_CALLBACK_RECORD* record)
+{
+    if ((actual_call_count == expected_call_count) ||
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_log_record_callback))
+    {
+        actual_and_expected_match = false;
+    }
+    else
+    {
+        log_record_callback_CALL* call = &expected_calls[actual_call_count].log_record_callback_call;
+
+        call->captured_context = context;
+        call->captured_log_level = record->log_level;
+        call->captured_time = record->time;
+        call->captured_file = record->file;
+        call->captured_func = record->func;
+        call->captured_line = record->line;
+        call->captured_property_value_pairs = record->property_value_pairs;
+        call->captured_property_value_pair_count = record->property_value_pair_count;
+
+        actual_call_count++;
+
+        if (call->get_message)
+        {
+            // the calls made by log_sink_callback_record_get_message are expected after this one
+            const char* message = log_sink_callback_record_get_message(record);
+            call->captured_message_is_NULL = (message == NULL);
+            if (message != NULL)
+            {
+                (void)snprintf(call->captured_message, sizeof(call->captured_message), "%s", message);
+                call->captured_message_is_cached = (log_sink_callback_record_get_message(record) == message);
+            }
+        }
+    }
+}
+
 #define POOR_MANS_ASSERT(cond) \
     if (!(cond)) \
     { \
@@ -423,24 +484,24 @@ static void setup_printf_call(void)
     expected_call_count++;
 }
 
-static void setup_time_call(void)
+static void setup_log_timestamp_now_call(void)
 {
-    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_time;
-    expected_calls[expected_call_count].time_call.override_result = false;
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_log_timestamp_now;
+    expected_calls[expected_call_count].log_timestamp_now_call.override_result = false;
     expected_call_count++;
 }
 
-static void setup_ctime_call(void)
+static void setup_timestamp_microseconds_to_string_call(void)
 {
-    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_ctime;
-    expected_calls[expected_call_count].ctime_call.override_result = false;
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_timestamp_microseconds_to_string;
+    expected_calls[expected_call_count].timestamp_microseconds_to_string_call.override_result = false;
     expected_call_count++;
 }
 
-static void setup_vsnprintf_call(void)
+static void setup_log_vsnprintf_cached_call(void)
 {
-    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_vsnprintf;
-    expected_calls[expected_call_count].vsnprintf_call.override_result = false;
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_log_vsnprintf_cached;
+    expected_calls[expected_call_count].log_vsnprintf_cached_call.override_result = false;
     expected_call_count++;
 }
 
@@ -478,20 +539,27 @@ static void setup_log_callback_call(void)
     expected_call_count++;
 }
 
+static void setup_log_record_callback_call(bool get_message)
+{
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_log_record_callback;
+    expected_calls[expected_call_count].log_record_callback_call.get_message = get_message;
+    expected_call_count++;
+}
+
 static void validate_log_line(const char* actual_string, const char* expected_format, const char* file, int line, const char* func, const char* expected_message)
 {
     char expected_string[LOG_MAX_MESSAGE_LENGTH * 2];
     int snprintf_result = snprintf(expected_string, sizeof(expected_string), expected_format, file, line, func);
     POOR_MANS_ASSERT(snprintf_result >= 0);
-    char day_of_week[4];
-    char month[4];
+    int year;
+    int month;
     int day;
     int hour;
     int minute;
     int second;
-    int year;
+    int microsecond;
     char message[LOG_MAX_MESSAGE_LENGTH];
-    int scanned_values = sscanf(actual_string, expected_string, day_of_week, month, &day, &hour, &minute, &second, &year, message);
+    int scanned_values = sscanf(actual_string, expected_string, &year, &month, &day, &hour, &minute, &second, &microsecond, message);
     POOR_MANS_ASSERT(scanned_values == 8);
     POOR_MANS_ASSERT(strcmp(message, expected_message) == 0);
 }
@@ -600,20 +668,21 @@ static void log_sink_callback_log_with_NULL_message_format_calls_callback_with_e
     POOR_MANS_ASSERT(strcmp(expected_calls[0].log_callback_call.captured_output, "Error logging: invalid arguments") == 0);
 }
 
-/* Tests_SRS_LOG_SINK_CALLBACK_42_007: [ log_sink_callback.log shall obtain the time by calling time. ]*/
-/* Tests_SRS_LOG_SINK_CALLBACK_42_008: [ log_sink_callback.log shall write the time to string by calling ctime. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_007: [ log_sink_callback.log shall obtain the time by calling log_timestamp_now. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_008: [ log_sink_callback.log shall write the time to string by calling timestamp_microseconds_to_string. ]*/
 /* Tests_SRS_LOG_SINK_CALLBACK_42_009: [ log_sink_callback.log shall create a line in the format: Time: {formatted time} File:{file}:{line} Func:{func} {optional context information} {formatted message}. ]*/
 /* Tests_SRS_LOG_SINK_CALLBACK_42_018: [ log_sink_callback.log shall call log_callback with its context, log_level, and the formatted message. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_001: [ log_sink_callback.log shall format the message by calling log_vsnprintf_cached. ]*/
 static void log_sink_callback_log_calls_callback_with_one_CRITICAL_log_line(void)
 {
     // arrange
     test_init();
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
 
     // act
@@ -622,15 +691,15 @@ static void log_sink_callback_log_calls_callback_with_one_CRITICAL_log_line(void
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_log_level == LOG_LEVEL_CRITICAL);
-    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "test");
+    POOR_MANS_ASSERT(expected_calls[1].timestamp_microseconds_to_string_call.captured_nanoseconds_since_epoch == expected_calls[0].log_timestamp_now_call.captured_result);
+    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "test");
 }
 
-/* Tests_SRS_LOG_SINK_CALLBACK_42_007: [ log_sink_callback.log shall obtain the time by calling time. ]*/
-/* Tests_SRS_LOG_SINK_CALLBACK_42_008: [ log_sink_callback.log shall write the time to string by calling ctime. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_007: [ log_sink_callback.log shall obtain the time by calling log_timestamp_now. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_008: [ log_sink_callback.log shall write the time to string by calling timestamp_microseconds_to_string. ]*/
 /* Tests_SRS_LOG_SINK_CALLBACK_42_009: [ log_sink_callback.log shall create a line in the format: Time: {formatted time} File:{file}:{line} Func:{func} {optional context information} {formatted message}. ]*/
 /* Tests_SRS_LOG_SINK_CALLBACK_42_018: [ log_sink_callback.log shall call log_callback with its context, log_level, and the formatted message. ]*/
 static void log_sink_callback_log_calls_callback_with_one_ERROR_log_line(void)
@@ -639,10 +708,10 @@ static void log_sink_callback_log_calls_callback_with_one_ERROR_log_line(void)
     test_init();
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
 
     // act
@@ -651,15 +720,14 @@ static void log_sink_callback_log_calls_callback_with_one_ERROR_log_line(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_log_level == LOG_LEVEL_ERROR);
-    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "other message");
+    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "other message");
 }
 
-/* Tests_SRS_LOG_SINK_CALLBACK_42_007: [ log_sink_callback.log shall obtain the time by calling time. ]*/
-/* Tests_SRS_LOG_SINK_CALLBACK_42_008: [ log_sink_callback.log shall write the time to string by calling ctime. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_007: [ log_sink_callback.log shall obtain the time by calling log_timestamp_now. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_008: [ log_sink_callback.log shall write the time to string by calling timestamp_microseconds_to_string. ]*/
 /* Tests_SRS_LOG_SINK_CALLBACK_42_009: [ log_sink_callback.log shall create a line in the format: Time: {formatted time} File:{file}:{line} Func:{func} {optional context information} {formatted message}. ]*/
 /* Tests_SRS_LOG_SINK_CALLBACK_42_018: [ log_sink_callback.log shall call log_callback with its context, log_level, and the formatted message. ]*/
 static void log_sink_callback_log_calls_callback_with_one_WARNING_log_line(void)
@@ -668,10 +736,10 @@ static void log_sink_callback_log_calls_callback_with_one_WARNING_log_line(void)
     test_init();
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
 
     // act
@@ -680,15 +748,14 @@ static void log_sink_callback_log_calls_callback_with_one_WARNING_log_line(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_log_level == LOG_LEVEL_WARNING);
-    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "test");
+    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "test");
 }
 
-/* Tests_SRS_LOG_SINK_CALLBACK_42_007: [ log_sink_callback.log shall obtain the time by calling time. ]*/
-/* Tests_SRS_LOG_SINK_CALLBACK_42_008: [ log_sink_callback.log shall write the time to string by calling ctime. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_007: [ log_sink_callback.log shall obtain the time by calling log_timestamp_now. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_008: [ log_sink_callback.log shall write the time to string by calling timestamp_microseconds_to_string. ]*/
 /* Tests_SRS_LOG_SINK_CALLBACK_42_009: [ log_sink_callback.log shall create a line in the format: Time: {formatted time} File:{file}:{line} Func:{func} {optional context information} {formatted message}. ]*/
 /* Tests_SRS_LOG_SINK_CALLBACK_42_018: [ log_sink_callback.log shall call log_callback with its context, log_level, and the formatted message. ]*/
 static void log_sink_callback_log_calls_callback_with_one_INFO_log_line(void)
@@ -697,10 +764,10 @@ static void log_sink_callback_log_calls_callback_with_one_INFO_log_line(void)
     test_init();
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
 
     // act
@@ -709,15 +776,14 @@ static void log_sink_callback_log_calls_callback_with_one_INFO_log_line(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_log_level == LOG_LEVEL_INFO);
-    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "test");
+    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "test");
 }
 
-/* Tests_SRS_LOG_SINK_CALLBACK_42_007: [ log_sink_callback.log shall obtain the time by calling time. ]*/
-/* Tests_SRS_LOG_SINK_CALLBACK_42_008: [ log_sink_callback.log shall write the time to string by calling ctime. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_007: [ log_sink_callback.log shall obtain the time by calling log_timestamp_now. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_008: [ log_sink_callback.log shall write the time to string by calling timestamp_microseconds_to_string. ]*/
 /* Tests_SRS_LOG_SINK_CALLBACK_42_009: [ log_sink_callback.log shall create a line in the format: Time: {formatted time} File:{file}:{line} Func:{func} {optional context information} {formatted message}. ]*/
 /* Tests_SRS_LOG_SINK_CALLBACK_42_018: [ log_sink_callback.log shall call log_callback with its context, log_level, and the formatted message. ]*/
 static void log_sink_callback_log_calls_callback_with_one_VERBOSE_log_line(void)
@@ -726,10 +792,10 @@ static void log_sink_callback_log_calls_callback_with_one_VERBOSE_log_line(void)
     test_init();
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
 
     // act
@@ -738,11 +804,10 @@ static void log_sink_callback_log_calls_callback_with_one_VERBOSE_log_line(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_log_level == LOG_LEVEL_VERBOSE);
-    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "a very long and verbose message here 42");
+    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "a very long and verbose message here 42");
 }
 
 /* Tests_SRS_LOG_SINK_CALLBACK_42_017: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_sink_callback.log shall call the log_callback with Error formatting log line and return. ]*/
@@ -752,8 +817,8 @@ static void when_snprintf_fails_log_sink_callback_log_prints_error_formatting(vo
     test_init();
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_log_callback_call();
     expected_calls[2].snprintf_call.override_result = true;
@@ -765,26 +830,25 @@ static void when_snprintf_fails_log_sink_callback_log_prints_error_formatting(vo
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(strcmp(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Error formatting log line") == 0);
 }
 
 /* Tests_SRS_LOG_SINK_CALLBACK_42_017: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_sink_callback.log shall call the log_callback with Error formatting log line and return. ]*/
-static void when_vsnprintf_fails_log_sink_callback_log_prints_error_formatting(void)
+static void when_log_vsnprintf_cached_fails_log_sink_callback_log_prints_error_formatting(void)
 {
     // arrange
     test_init();
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
-    expected_calls[3].vsnprintf_call.override_result = true;
-    expected_calls[3].vsnprintf_call.call_result = -1;
+    expected_calls[3].log_vsnprintf_cached_call.override_result = true;
+    expected_calls[3].log_vsnprintf_cached_call.call_result = -1;
 
     // act
     int line_no = __LINE__;
@@ -792,25 +856,24 @@ static void when_vsnprintf_fails_log_sink_callback_log_prints_error_formatting(v
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(strcmp(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Error formatting log line") == 0);
 }
 
-/* Tests_SRS_LOG_SINK_CALLBACK_42_010: [ If the call to time fails then log_sink_callback.log shall format the time as NULL. ]*/
-static void when_time_fails_log_sink_callback_log_prints_time_as_NULL(void)
+/* Tests_SRS_LOG_SINK_CALLBACK_01_009: [ If the call to log_timestamp_now fails then log_sink_callback.log shall format the time as NULL. ]*/
+static void when_log_timestamp_now_fails_log_sink_callback_log_prints_time_as_NULL(void)
 {
     // arrange
     test_init();
     setup_mocks();
 
-    setup_time_call();
+    setup_log_timestamp_now_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
-    expected_calls[0].time_call.override_result = true;
-    expected_calls[0].time_call.call_result = (time_t)-1;
+    expected_calls[0].log_timestamp_now_call.override_result = true;
+    expected_calls[0].log_timestamp_now_call.call_result = LOG_TIMESTAMP_INVALID;
 
     // act
     int line_no = __LINE__;
@@ -818,27 +881,26 @@ static void when_time_fails_log_sink_callback_log_prints_time_as_NULL(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_log_level == LOG_LEVEL_VERBOSE);
     validate_log_line_with_NULL_time(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:NULL File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "test");
 }
 
-/* Tests_SRS_LOG_SINK_CALLBACK_42_011: [ If the call to ctime fails then log_sink_callback.log shall format the time as NULL. ]*/
-static void when_ctime_returns_NULL_log_sink_callback_log_prints_time_as_NULL(void)
+/* Tests_SRS_LOG_SINK_CALLBACK_01_010: [ If the call to timestamp_microseconds_to_string fails then log_sink_callback.log shall format the time as NULL. ]*/
+static void when_timestamp_microseconds_to_string_fails_log_sink_callback_log_prints_time_as_NULL(void)
 {
     // arrange
     test_init();
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
-    expected_calls[1].ctime_call.override_result = true;
-    expected_calls[1].ctime_call.call_result = NULL;
+    expected_calls[1].timestamp_microseconds_to_string_call.override_result = true;
+    expected_calls[1].timestamp_microseconds_to_string_call.call_result = -1;
 
     // act
     int line_no = __LINE__;
@@ -846,7 +908,6 @@ static void when_ctime_returns_NULL_log_sink_callback_log_prints_time_as_NULL(vo
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_log_level == LOG_LEVEL_VERBOSE);
@@ -863,15 +924,15 @@ static void log_sink_callback_log_with_non_NULL_context_prints_one_property(void
     test_init();
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
 
     setup_log_context_property_to_string_call();
 
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
 
     LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
@@ -882,11 +943,10 @@ static void log_sink_callback_log_with_non_NULL_context_prints_one_property(void
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_log_level == LOG_LEVEL_VERBOSE);
-    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "{ x=42 } test");
+    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "{ x=42 } test");
 }
 
 /* Tests_SRS_LOG_SINK_CALLBACK_42_012: [ If log_context is non-NULL: ]*/
@@ -899,15 +959,15 @@ static void log_sink_callback_log_with_non_NULL_context_prints_2_properties(void
     test_init();
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
 
     setup_log_context_property_to_string_call();
 
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
 
     LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42), LOG_CONTEXT_PROPERTY(uint32_t, y, 1));
@@ -918,11 +978,10 @@ static void log_sink_callback_log_with_non_NULL_context_prints_2_properties(void
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_log_level == LOG_LEVEL_VERBOSE);
-    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "{ x=42 y=1 } test");
+    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "{ x=42 y=1 } test");
 }
 
 /* Tests_SRS_LOG_SINK_CALLBACK_42_012: [ If log_context is non-NULL: ]*/
@@ -935,15 +994,15 @@ static void log_sink_callback_log_with_non_NULL_context_with_2_levels_works(void
     test_init();
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
 
     setup_log_context_property_to_string_call();
 
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
 
     LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
@@ -955,11 +1014,10 @@ static void log_sink_callback_log_with_non_NULL_context_with_2_levels_works(void
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_log_level == LOG_LEVEL_VERBOSE);
-    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "{ { x=42 } y=1 } test");
+    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "{ { x=42 } y=1 } test");
 }
 
 /* Tests_SRS_LOG_SINK_CALLBACK_42_012: [ If log_context is non-NULL: ]*/
@@ -972,15 +1030,15 @@ static void log_sink_callback_log_with_non_NULL_named_contexts_with_2_levels_wor
     test_init();
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
 
     setup_log_context_property_to_string_call();
 
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
 
     LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_NAME(haga), LOG_CONTEXT_PROPERTY(int32_t, x, 42));
@@ -992,11 +1050,10 @@ static void log_sink_callback_log_with_non_NULL_named_contexts_with_2_levels_wor
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_log_level == LOG_LEVEL_VERBOSE);
-    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "uaga={ haga={ x=42 } y=1 } test");
+    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "uaga={ haga={ x=42 } y=1 } test");
 }
 
 /* Tests_SRS_LOG_SINK_CALLBACK_42_012: [ If log_context is non-NULL: ]*/
@@ -1009,15 +1066,15 @@ static void log_sink_callback_log_with_non_NULL_empty_context_works(void)
     test_init();
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
 
     setup_log_context_property_to_string_call();
 
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
 
     LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL);
@@ -1028,11 +1085,10 @@ static void log_sink_callback_log_with_non_NULL_empty_context_works(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_log_level == LOG_LEVEL_VERBOSE);
-    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "{ } test");
+    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "{ } test");
 }
 
 /* Tests_SRS_LOG_SINK_CALLBACK_42_012: [ If log_context is non-NULL: ]*/
@@ -1045,15 +1101,15 @@ static void log_sink_callback_log_with_non_NULL_dynamically_allocated_context(vo
     test_init();
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
 
     setup_log_context_property_to_string_call();
 
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
 
     LOG_CONTEXT_HANDLE context_1;
@@ -1067,11 +1123,10 @@ static void log_sink_callback_log_with_non_NULL_dynamically_allocated_context(vo
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_log_level == LOG_LEVEL_VERBOSE);
-    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "{ { x=42 } y=1 } test");
+    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "{ { x=42 } y=1 } test");
 
     // cleanup
     LOG_CONTEXT_DESTROY(context_1);
@@ -1085,8 +1140,8 @@ static void when_snprintf_fails_for_context_open_brace_log_sink_callback_log_pri
     test_init();
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
@@ -1106,7 +1161,6 @@ static void when_snprintf_fails_for_context_open_brace_log_sink_callback_log_pri
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(strcmp(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Error formatting log line") == 0);
@@ -1119,13 +1173,13 @@ static void when_printing_the_message_exceeds_log_line_size_it_is_truncated(void
     test_init();
     setup_mocks();
 
-    setup_time_call();
+    setup_log_timestamp_now_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
 
-    expected_calls[0].time_call.override_result = true;
-    expected_calls[0].time_call.call_result = (time_t)-1;
+    expected_calls[0].log_timestamp_now_call.override_result = true;
+    expected_calls[0].log_timestamp_now_call.call_result = LOG_TIMESTAMP_INVALID;
 
     char* message_string_too_big = malloc(LOG_MAX_MESSAGE_LENGTH);
     POOR_MANS_ASSERT(message_string_too_big != NULL);
@@ -1139,7 +1193,6 @@ static void when_printing_the_message_exceeds_log_line_size_it_is_truncated(void
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
 
     char expected_string[LOG_MAX_MESSAGE_LENGTH];
@@ -1160,12 +1213,12 @@ static void when_printing_the_file_exceeds_log_line_size_it_is_truncated(void)
     test_init();
     setup_mocks();
 
-    setup_time_call();
+    setup_log_timestamp_now_call();
     setup_snprintf_call();
     setup_log_callback_call();
 
-    expected_calls[0].time_call.override_result = true;
-    expected_calls[0].time_call.call_result = (time_t)-1;
+    expected_calls[0].log_timestamp_now_call.override_result = true;
+    expected_calls[0].log_timestamp_now_call.call_result = LOG_TIMESTAMP_INVALID;
 
     char* file_too_big = malloc(LOG_MAX_MESSAGE_LENGTH);
     POOR_MANS_ASSERT(file_too_big != NULL);
@@ -1179,7 +1232,6 @@ static void when_printing_the_file_exceeds_log_line_size_it_is_truncated(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
 
     char expected_string[LOG_MAX_MESSAGE_LENGTH];
@@ -1200,15 +1252,15 @@ static void when_printing_a_property_value_exceeds_log_line_size_it_is_truncated
     test_init();
     setup_mocks();
 
-    setup_time_call();
+    setup_log_timestamp_now_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
     setup_log_context_property_to_string_call();
     setup_log_callback_call();
 
-    expected_calls[0].time_call.override_result = true;
-    expected_calls[0].time_call.call_result = (time_t)-1;
+    expected_calls[0].log_timestamp_now_call.override_result = true;
+    expected_calls[0].log_timestamp_now_call.call_result = LOG_TIMESTAMP_INVALID;
 
     char* string_property_value_too_big = malloc(LOG_MAX_MESSAGE_LENGTH);
     POOR_MANS_ASSERT(string_property_value_too_big != NULL);
@@ -1225,7 +1277,6 @@ static void when_printing_a_property_value_exceeds_log_line_size_it_is_truncated
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
 
     char expected_string[LOG_MAX_MESSAGE_LENGTH];
@@ -1247,15 +1298,15 @@ static void when_printing_a_property_name_exceeds_log_line_size_it_is_truncated(
     test_init();
     setup_mocks();
 
-    setup_time_call();
+    setup_log_timestamp_now_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
     setup_log_context_property_to_string_call();
     setup_log_callback_call();
 
-    expected_calls[0].time_call.override_result = true;
-    expected_calls[0].time_call.call_result = (time_t)-1;
+    expected_calls[0].log_timestamp_now_call.override_result = true;
+    expected_calls[0].log_timestamp_now_call.call_result = LOG_TIMESTAMP_INVALID;
 
     char* dummy_file_name = malloc(LOG_MAX_MESSAGE_LENGTH);
     POOR_MANS_ASSERT(dummy_file_name != NULL);
@@ -1280,7 +1331,6 @@ static void when_printing_a_property_name_exceeds_log_line_size_it_is_truncated(
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
 
     char expected_string[LOG_MAX_MESSAGE_LENGTH];
@@ -1302,10 +1352,10 @@ static void test_case_log_sink_callback_log_with_max_level_does_call_callback(LO
     log_sink_callback_set_max_level(max_log_level);
     setup_mocks();
 
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_log_callback_call();
 
     // act
@@ -1314,11 +1364,10 @@ static void test_case_log_sink_callback_log_with_max_level_does_call_callback(LO
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_context == (void*)0x42);
     POOR_MANS_ASSERT(expected_calls[actual_call_count - 1].log_callback_call.captured_log_level == log_level);
-    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "test");
+    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "test");
 }
 
 static void test_case_log_sink_callback_log_with_max_level_does_not_call_callback(LOG_LEVEL log_level, LOG_LEVEL max_log_level)
@@ -1414,6 +1463,746 @@ static void log_sink_callback_log_calls_callback_for_log_level_CRITICAL_when_max
     }
 }
 
+/* log_sink_callback_set_layout */
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_003: [ Otherwise log_sink_callback_set_layout shall compile pattern by calling log_layout_compile. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_004: [ If log_layout_compile fails, log_sink_callback_set_layout shall fail and return a non-zero value (the layout in use is not changed). ]*/
+static void log_sink_callback_set_layout_with_invalid_pattern_fails(void)
+{
+    // arrange
+    setup_mocks();
+    setup_printf_call();
+
+    // act
+    int result = log_sink_callback_set_layout("%m %x");
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_002: [ If pattern is NULL, log_sink_callback_set_layout shall go back to the built-in line format and return 0. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_005: [ log_sink_callback_set_layout shall store the compiled layout so that it is used by all future calls to log_sink_callback.log and return 0. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_006: [ If a layout was set, log_sink_callback.log shall format the line by calling log_layout_format with the layout instead of using the built-in line format. ]*/
+static void log_sink_callback_log_with_layout_calls_callback_with_the_layout_line(void)
+{
+    // arrange
+    char expected_line[LOG_MAX_MESSAGE_LENGTH];
+    const char* file_name = strrchr(__FILE__, '/');
+    if (file_name == NULL)
+    {
+        file_name = strrchr(__FILE__, '\\');
+    }
+    file_name = (file_name == NULL) ? __FILE__ : file_name + 1;
+
+    test_init();
+    POOR_MANS_ASSERT(log_sink_callback_set_layout("%v %f:%l %m") == 0);
+    setup_mocks();
+    setup_log_callback_call();
+
+    // act
+    int line_no = __LINE__;
+    test_log_sink_callback_log(LOG_LEVEL_WARNING, NULL, __FILE__, __FUNCTION__, line_no, "test %d", 42);
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[0].log_callback_call.captured_log_level == LOG_LEVEL_WARNING);
+    (void)snprintf(expected_line, sizeof(expected_line), "W %s:%d test 42", file_name, line_no);
+    POOR_MANS_ASSERT(strcmp(expected_calls[0].log_callback_call.captured_output, expected_line) == 0);
+
+    // back to the built-in line
+    POOR_MANS_ASSERT(log_sink_callback_set_layout(NULL) == 0);
+    setup_mocks();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
+    setup_snprintf_call();
+    setup_log_vsnprintf_cached_call();
+    setup_log_callback_call();
+    test_log_sink_callback_log(LOG_LEVEL_WARNING, NULL, __FILE__, __FUNCTION__, line_no, "test");
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* log_sink_callback_set_record_callback */
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_011: [ log_sink_callback_set_record_callback shall store log_record_callback and context so that they are used by all future calls to log_sink_callback.log (NULL removes the record callback). ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_012: [ If a record callback is set, log_sink_callback.log shall call it before the log_callback. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_013: [ log_sink_callback.log shall obtain the time of the record by calling log_timestamp_now. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_015: [ log_sink_callback.log shall not format the message before calling the record callback, it shall keep a copy of the arguments for log_sink_callback_record_get_message. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_016: [ log_sink_callback.log shall call the record callback with its context and the record. ]*/
+static void log_sink_callback_log_calls_the_record_callback_and_then_the_log_callback(void)
+{
+    // arrange
+    test_init();
+    log_sink_callback_set_record_callback(mock_log_record_callback, (void*)0x43);
+    setup_mocks();
+
+    setup_log_timestamp_now_call();
+    setup_log_record_callback_call(false);
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
+    setup_snprintf_call();
+    setup_log_vsnprintf_cached_call();
+    setup_log_callback_call();
+
+    // act
+    int line_no = __LINE__;
+    test_log_sink_callback_log(LOG_LEVEL_WARNING, NULL, __FILE__, __FUNCTION__, line_no, "test %d", 42);
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].log_record_callback_call.captured_context == (void*)0x43);
+    POOR_MANS_ASSERT(expected_calls[1].log_record_callback_call.captured_log_level == LOG_LEVEL_WARNING);
+    POOR_MANS_ASSERT(expected_calls[1].log_record_callback_call.captured_time == expected_calls[0].log_timestamp_now_call.captured_result);
+    POOR_MANS_ASSERT(strcmp(expected_calls[1].log_record_callback_call.captured_file, __FILE__) == 0);
+    POOR_MANS_ASSERT(strcmp(expected_calls[1].log_record_callback_call.captured_func, __FUNCTION__) == 0);
+    POOR_MANS_ASSERT(expected_calls[1].log_record_callback_call.captured_line == line_no);
+    POOR_MANS_ASSERT(expected_calls[1].log_record_callback_call.captured_property_value_pairs == NULL);
+    POOR_MANS_ASSERT(expected_calls[1].log_record_callback_call.captured_property_value_pair_count == 0);
+    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "test 42");
+
+    // cleanup
+    log_sink_callback_set_record_callback(NULL, NULL);
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_014: [ If log_context is not NULL, log_sink_callback.log shall obtain the properties of the record by calling log_context_get_property_value_pair_count and log_context_get_property_value_pairs. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_022: [ If the log_callback is log_sink_callback_noop_callback, log_sink_callback.log shall not build the line. ]*/
+static void log_sink_callback_log_with_only_the_record_callback_does_not_build_the_line(void)
+{
+    // arrange
+    test_init();
+    POOR_MANS_ASSERT(log_sink_callback_set_callback(log_sink_callback_noop_callback, NULL) == 0);
+    log_sink_callback_set_record_callback(mock_log_record_callback, (void*)0x43);
+    setup_mocks();
+
+    setup_log_timestamp_now_call();
+    setup_log_context_get_property_value_pair_count_call();
+    setup_log_context_get_property_value_pairs_call();
+    setup_log_record_callback_call(false);
+
+    LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+
+    // act
+    test_log_sink_callback_log(LOG_LEVEL_INFO, &context_1, __FILE__, __FUNCTION__, __LINE__, "test");
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[3].log_record_callback_call.captured_log_level == LOG_LEVEL_INFO);
+    POOR_MANS_ASSERT(expected_calls[3].log_record_callback_call.captured_property_value_pairs == log_context_get_property_value_pairs(&context_1));
+    POOR_MANS_ASSERT(expected_calls[3].log_record_callback_call.captured_property_value_pair_count == log_context_get_property_value_pair_count(&context_1));
+
+    // cleanup
+    log_sink_callback_set_record_callback(NULL, NULL);
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_011: [ log_sink_callback_set_record_callback shall store log_record_callback and context so that they are used by all future calls to log_sink_callback.log (NULL removes the record callback). ]*/
+static void log_sink_callback_set_record_callback_with_NULL_removes_the_record_callback(void)
+{
+    // arrange
+    test_init();
+    log_sink_callback_set_record_callback(mock_log_record_callback, (void*)0x43);
+    log_sink_callback_set_record_callback(NULL, NULL);
+    setup_mocks();
+
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
+    setup_snprintf_call();
+    setup_log_vsnprintf_cached_call();
+    setup_log_callback_call();
+
+    // act
+    test_log_sink_callback_log(LOG_LEVEL_ERROR, NULL, __FILE__, __FUNCTION__, __LINE__, "test");
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_023: [ If log_level is greater than the maximum level set by log_sink_callback_set_max_level, then log_sink_callback.log shall not call the record callback. ]*/
+static void log_sink_callback_log_with_level_above_max_level_does_not_call_the_record_callback(void)
+{
+    // arrange
+    test_init();
+    log_sink_callback_set_max_level(LOG_LEVEL_ERROR);
+    log_sink_callback_set_record_callback(mock_log_record_callback, (void*)0x43);
+    setup_mocks();
+
+    // act
+    test_log_sink_callback_log(LOG_LEVEL_WARNING, NULL, __FILE__, __FUNCTION__, __LINE__, "test");
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    log_sink_callback_set_record_callback(NULL, NULL);
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_017: [ If message_format is NULL and a record callback is set, log_sink_callback.log shall call the record callback with a LOG_LEVEL_CRITICAL record whose message is the error message. ]*/
+static void log_sink_callback_log_with_NULL_message_format_calls_the_record_callback_with_error(void)
+{
+    // arrange
+    test_init();
+    log_sink_callback_set_record_callback(mock_log_record_callback, (void*)0x43);
+    setup_mocks();
+
+    setup_log_timestamp_now_call();
+    setup_log_record_callback_call(true);
+    setup_log_callback_call();
+
+    // act
+    test_log_sink_callback_log(LOG_LEVEL_VERBOSE, NULL, __FILE__, __FUNCTION__, __LINE__, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].log_record_callback_call.captured_log_level == LOG_LEVEL_CRITICAL);
+    POOR_MANS_ASSERT(strcmp(expected_calls[1].log_record_callback_call.captured_message, "Error logging: invalid arguments") == 0);
+    POOR_MANS_ASSERT(strcmp(expected_calls[2].log_callback_call.captured_output, "Error logging: invalid arguments") == 0);
+
+    // cleanup
+    log_sink_callback_set_record_callback(NULL, NULL);
+}
+
+/* log_sink_callback_record_get_message */
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_018: [ If record is NULL, log_sink_callback_record_get_message shall fail and return NULL. ]*/
+static void log_sink_callback_record_get_message_with_NULL_record_fails(void)
+{
+    // arrange
+    setup_mocks();
+    setup_printf_call();
+
+    // act
+    const char* result = log_sink_callback_record_get_message(NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result == NULL);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_019: [ On the first call for record, log_sink_callback_record_get_message shall format the message by calling log_vsnprintf_cached with the message format and arguments of the event. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_020: [ log_sink_callback_record_get_message shall return the formatted message (later calls for the same record return it without formatting again). ]*/
+static void log_sink_callback_record_get_message_formats_the_message_once(void)
+{
+    // arrange
+    test_init();
+    POOR_MANS_ASSERT(log_sink_callback_set_callback(log_sink_callback_noop_callback, NULL) == 0);
+    log_sink_callback_set_record_callback(mock_log_record_callback, (void*)0x43);
+    setup_mocks();
+
+    setup_log_timestamp_now_call();
+    setup_log_record_callback_call(true);
+    setup_log_vsnprintf_cached_call();
+
+    // act
+    test_log_sink_callback_log(LOG_LEVEL_INFO, NULL, __FILE__, __FUNCTION__, __LINE__, "test %d %s", 42, "abc");
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(strcmp(expected_calls[2].log_vsnprintf_cached_call.captured_format_arg, "test %d %s") == 0);
+    POOR_MANS_ASSERT(!expected_calls[1].log_record_callback_call.captured_message_is_NULL);
+    POOR_MANS_ASSERT(expected_calls[1].log_record_callback_call.captured_message_is_cached);
+    POOR_MANS_ASSERT(strcmp(expected_calls[1].log_record_callback_call.captured_message, "test 42 abc") == 0);
+
+    // cleanup
+    log_sink_callback_set_record_callback(NULL, NULL);
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_039: [ If a record callback already formatted the message, log_sink_callback.log shall build the line with that message instead of formatting message_format again. ]*/
+static void log_sink_callback_log_builds_the_line_with_the_message_formatted_by_the_record_callback(void)
+{
+    // arrange
+    test_init();
+    log_sink_callback_set_record_callback(mock_log_record_callback, (void*)0x43);
+    setup_mocks();
+
+    setup_log_timestamp_now_call();
+    setup_log_record_callback_call(true);
+    setup_log_vsnprintf_cached_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
+    setup_snprintf_call();
+    setup_log_vsnprintf_cached_call();
+    setup_log_callback_call();
+
+    // act
+    int line_no = __LINE__;
+    test_log_sink_callback_log(LOG_LEVEL_INFO, NULL, __FILE__, __FUNCTION__, line_no, "test %d %s", 42, "abc");
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(strcmp(expected_calls[2].log_vsnprintf_cached_call.captured_format_arg, "test %d %s") == 0);
+    POOR_MANS_ASSERT(strcmp(expected_calls[6].log_vsnprintf_cached_call.captured_format_arg, "%s") == 0);
+    POOR_MANS_ASSERT(strcmp(expected_calls[1].log_record_callback_call.captured_message, "test 42 abc") == 0);
+    validate_log_line(expected_calls[actual_call_count - 1].log_callback_call.captured_output, "Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "test 42 abc");
+
+    // cleanup
+    log_sink_callback_set_record_callback(NULL, NULL);
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_021: [ If formatting the message fails, log_sink_callback_record_get_message shall return NULL. ]*/
+static void when_log_vsnprintf_cached_fails_log_sink_callback_record_get_message_returns_NULL(void)
+{
+    // arrange
+    test_init();
+    POOR_MANS_ASSERT(log_sink_callback_set_callback(log_sink_callback_noop_callback, NULL) == 0);
+    log_sink_callback_set_record_callback(mock_log_record_callback, (void*)0x43);
+    setup_mocks();
+
+    setup_log_timestamp_now_call();
+    setup_log_record_callback_call(true);
+    setup_log_vsnprintf_cached_call();
+    expected_calls[2].log_vsnprintf_cached_call.override_result = true;
+    expected_calls[2].log_vsnprintf_cached_call.call_result = -1;
+
+    // act
+    test_log_sink_callback_log(LOG_LEVEL_INFO, NULL, __FILE__, __FUNCTION__, __LINE__, "test");
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].log_record_callback_call.captured_message_is_NULL);
+
+    // cleanup
+    log_sink_callback_set_record_callback(NULL, NULL);
+}
+
+/* log_sink_callback_subscribe */
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_024: [ If both log_callback and log_record_callback are NULL, log_sink_callback_subscribe shall fail and return a non-zero value. ]*/
+static void log_sink_callback_subscribe_with_NULL_callbacks_fails(void)
+{
+    // arrange
+    uint32_t subscription_id;
+    setup_mocks();
+    setup_printf_call();
+
+    // act
+    int result = log_sink_callback_subscribe(NULL, NULL, (void*)0x44, LOG_SINK_CALLBACK_LEVEL_MASK_ALL, &subscription_id);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_025: [ If subscription_id is NULL, log_sink_callback_subscribe shall fail and return a non-zero value. ]*/
+static void log_sink_callback_subscribe_with_NULL_subscription_id_fails(void)
+{
+    // arrange
+    setup_mocks();
+    setup_printf_call();
+
+    // act
+    int result = log_sink_callback_subscribe(mock_log_callback, NULL, (void*)0x44, LOG_SINK_CALLBACK_LEVEL_MASK_ALL, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_026: [ log_sink_callback_subscribe shall claim a free subscriber slot without taking a lock. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_027: [ If LOG_SINK_CALLBACK_MAX_SUBSCRIBERS subscribers are already subscribed, log_sink_callback_subscribe shall fail and return a non-zero value. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_032: [ log_sink_callback_unsubscribe shall free the slot and return 0. ]*/
+static void log_sink_callback_subscribe_fails_when_all_the_slots_are_used(void)
+{
+    // arrange
+    uint32_t subscription_ids[LOG_SINK_CALLBACK_MAX_SUBSCRIBERS];
+    uint32_t subscription_id;
+    setup_mocks();
+    for (uint32_t i = 0; i < LOG_SINK_CALLBACK_MAX_SUBSCRIBERS; i++)
+    {
+        POOR_MANS_ASSERT(log_sink_callback_subscribe(mock_log_callback, NULL, (void*)0x44, LOG_SINK_CALLBACK_LEVEL_MASK_ALL, &subscription_ids[i]) == 0);
+    }
+    setup_printf_call();
+
+    // act
+    int result = log_sink_callback_subscribe(mock_log_callback, NULL, (void*)0x44, LOG_SINK_CALLBACK_LEVEL_MASK_ALL, &subscription_id);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // a slot can be used again once it is freed
+    POOR_MANS_ASSERT(log_sink_callback_unsubscribe(subscription_ids[3]) == 0);
+    POOR_MANS_ASSERT(log_sink_callback_subscribe(mock_log_callback, NULL, (void*)0x44, LOG_SINK_CALLBACK_LEVEL_MASK_ALL, &subscription_id) == 0);
+    POOR_MANS_ASSERT(subscription_id != subscription_ids[3]);
+    subscription_ids[3] = subscription_id;
+
+    // cleanup
+    for (uint32_t i = 0; i < LOG_SINK_CALLBACK_MAX_SUBSCRIBERS; i++)
+    {
+        POOR_MANS_ASSERT(log_sink_callback_unsubscribe(subscription_ids[i]) == 0);
+    }
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_028: [ log_sink_callback_subscribe shall store log_callback, log_record_callback, context and level_mask in the slot, and make the subscriber visible to log_sink_callback.log only once they are stored. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_029: [ log_sink_callback_subscribe shall write the id of the subscription in subscription_id and return 0. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_035: [ log_sink_callback.log shall call the log_callback of each subscriber whose level_mask has the bit of log_level with the same line (the line is built at most once for all of them). ]*/
+static void log_sink_callback_log_builds_the_line_once_for_the_subscribers_that_want_the_level(void)
+{
+    // arrange
+    uint32_t subscription_id_1;
+    uint32_t subscription_id_2;
+    uint32_t subscription_id_3;
+    test_init();
+    POOR_MANS_ASSERT(log_sink_callback_set_callback(log_sink_callback_noop_callback, NULL) == 0);
+    POOR_MANS_ASSERT(log_sink_callback_subscribe(mock_log_callback, NULL, (void*)0x44, LOG_SINK_CALLBACK_LEVEL_MASK(LOG_LEVEL_WARNING), &subscription_id_1) == 0);
+    POOR_MANS_ASSERT(log_sink_callback_subscribe(mock_log_callback, NULL, (void*)0x45, LOG_SINK_CALLBACK_LEVEL_MASK(LOG_LEVEL_ERROR), &subscription_id_2) == 0);
+    POOR_MANS_ASSERT(log_sink_callback_subscribe(mock_log_callback, NULL, (void*)0x46, LOG_SINK_CALLBACK_LEVEL_MASK_ALL, &subscription_id_3) == 0);
+    POOR_MANS_ASSERT((subscription_id_1 != subscription_id_2) && (subscription_id_2 != subscription_id_3) && (subscription_id_1 != subscription_id_3));
+    setup_mocks();
+
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
+    setup_snprintf_call();
+    setup_log_vsnprintf_cached_call();
+    setup_log_callback_call();
+    setup_log_callback_call();
+
+    // act
+    int line_no = __LINE__;
+    test_log_sink_callback_log(LOG_LEVEL_WARNING, NULL, __FILE__, __FUNCTION__, line_no, "test");
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[4].log_callback_call.captured_context == (void*)0x44);
+    POOR_MANS_ASSERT(expected_calls[4].log_callback_call.captured_log_level == LOG_LEVEL_WARNING);
+    POOR_MANS_ASSERT(expected_calls[5].log_callback_call.captured_context == (void*)0x46);
+    POOR_MANS_ASSERT(expected_calls[5].log_callback_call.captured_log_level == LOG_LEVEL_WARNING);
+    validate_log_line(expected_calls[4].log_callback_call.captured_output, "Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %%[^\r\n]", __FILE__, line_no, __FUNCTION__, "test");
+    POOR_MANS_ASSERT(strcmp(expected_calls[4].log_callback_call.captured_output, expected_calls[5].log_callback_call.captured_output) == 0);
+
+    // cleanup
+    POOR_MANS_ASSERT(log_sink_callback_unsubscribe(subscription_id_1) == 0);
+    POOR_MANS_ASSERT(log_sink_callback_unsubscribe(subscription_id_2) == 0);
+    POOR_MANS_ASSERT(log_sink_callback_unsubscribe(subscription_id_3) == 0);
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_034: [ log_sink_callback.log shall call the log_record_callback of each subscriber whose level_mask has the bit of log_level with the same record (the message is formatted at most once for all of them). ]*/
+static void log_sink_callback_log_formats_the_message_once_for_the_record_subscribers(void)
+{
+    // arrange
+    uint32_t subscription_id_1;
+    uint32_t subscription_id_2;
+    test_init();
+    POOR_MANS_ASSERT(log_sink_callback_set_callback(log_sink_callback_noop_callback, NULL) == 0);
+    POOR_MANS_ASSERT(log_sink_callback_subscribe(NULL, mock_log_record_callback, (void*)0x44, LOG_SINK_CALLBACK_LEVEL_MASK_ALL, &subscription_id_1) == 0);
+    POOR_MANS_ASSERT(log_sink_callback_subscribe(NULL, mock_log_record_callback, (void*)0x45, LOG_SINK_CALLBACK_LEVEL_MASK(LOG_LEVEL_INFO), &subscription_id_2) == 0);
+    setup_mocks();
+
+    setup_log_timestamp_now_call();
+    setup_log_record_callback_call(true);
+    setup_log_vsnprintf_cached_call();
+    setup_log_record_callback_call(true);
+
+    // act
+    test_log_sink_callback_log(LOG_LEVEL_INFO, NULL, __FILE__, __FUNCTION__, __LINE__, "test %d", 42);
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].log_record_callback_call.captured_context == (void*)0x44);
+    POOR_MANS_ASSERT(expected_calls[3].log_record_callback_call.captured_context == (void*)0x45);
+    POOR_MANS_ASSERT(expected_calls[1].log_record_callback_call.captured_time == expected_calls[3].log_record_callback_call.captured_time);
+    POOR_MANS_ASSERT(strcmp(expected_calls[1].log_record_callback_call.captured_message, "test 42") == 0);
+    POOR_MANS_ASSERT(strcmp(expected_calls[3].log_record_callback_call.captured_message, "test 42") == 0);
+
+    // cleanup
+    POOR_MANS_ASSERT(log_sink_callback_unsubscribe(subscription_id_1) == 0);
+    POOR_MANS_ASSERT(log_sink_callback_unsubscribe(subscription_id_2) == 0);
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_037: [ The maximum level set by log_sink_callback_set_max_level shall not apply to the subscribers. ]*/
+static void log_sink_callback_log_calls_the_subscribers_above_the_max_level(void)
+{
+    // arrange
+    uint32_t subscription_id;
+    test_init();
+    log_sink_callback_set_max_level(LOG_LEVEL_ERROR);
+    POOR_MANS_ASSERT(log_sink_callback_subscribe(mock_log_callback, NULL, (void*)0x44, LOG_SINK_CALLBACK_LEVEL_MASK(LOG_LEVEL_VERBOSE), &subscription_id) == 0);
+    setup_mocks();
+
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
+    setup_snprintf_call();
+    setup_log_vsnprintf_cached_call();
+    setup_log_callback_call();
+
+    // act
+    test_log_sink_callback_log(LOG_LEVEL_VERBOSE, NULL, __FILE__, __FUNCTION__, __LINE__, "test");
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[4].log_callback_call.captured_context == (void*)0x44);
+
+    // cleanup
+    POOR_MANS_ASSERT(log_sink_callback_unsubscribe(subscription_id) == 0);
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_036: [ If message_format is NULL, log_sink_callback.log shall give the error to all the subscribers regardless of their level_mask. ]*/
+static void log_sink_callback_log_with_NULL_message_format_calls_all_the_subscribers_with_error(void)
+{
+    // arrange
+    uint32_t subscription_id;
+    test_init();
+    POOR_MANS_ASSERT(log_sink_callback_subscribe(mock_log_callback, mock_log_record_callback, (void*)0x44, LOG_SINK_CALLBACK_LEVEL_MASK(LOG_LEVEL_VERBOSE), &subscription_id) == 0);
+    setup_mocks();
+
+    setup_log_timestamp_now_call();
+    setup_log_record_callback_call(true);
+    setup_log_callback_call();
+    setup_log_callback_call();
+
+    // act
+    test_log_sink_callback_log(LOG_LEVEL_VERBOSE, NULL, __FILE__, __FUNCTION__, __LINE__, NULL);
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].log_record_callback_call.captured_log_level == LOG_LEVEL_CRITICAL);
+    POOR_MANS_ASSERT(strcmp(expected_calls[1].log_record_callback_call.captured_message, "Error logging: invalid arguments") == 0);
+    POOR_MANS_ASSERT(expected_calls[2].log_callback_call.captured_context == (void*)0x42);
+    POOR_MANS_ASSERT(expected_calls[3].log_callback_call.captured_context == (void*)0x44);
+    POOR_MANS_ASSERT(expected_calls[3].log_callback_call.captured_log_level == LOG_LEVEL_CRITICAL);
+    POOR_MANS_ASSERT(strcmp(expected_calls[3].log_callback_call.captured_output, "Error logging: invalid arguments") == 0);
+
+    // cleanup
+    POOR_MANS_ASSERT(log_sink_callback_unsubscribe(subscription_id) == 0);
+}
+
+/* log_sink_callback_unsubscribe */
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_031: [ log_sink_callback_unsubscribe shall stop log_sink_callback.log from calling the callbacks of the subscription and wait (sleeping, not spinning) for the calls already in progress to return. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_032: [ log_sink_callback_unsubscribe shall free the slot and return 0. ]*/
+static void log_sink_callback_unsubscribe_stops_the_calls_to_the_subscriber(void)
+{
+    // arrange
+    uint32_t subscription_id;
+    test_init();
+    POOR_MANS_ASSERT(log_sink_callback_set_callback(log_sink_callback_noop_callback, NULL) == 0);
+    POOR_MANS_ASSERT(log_sink_callback_subscribe(mock_log_callback, mock_log_record_callback, (void*)0x44, LOG_SINK_CALLBACK_LEVEL_MASK_ALL, &subscription_id) == 0);
+    setup_mocks();
+
+    // act
+    int result = log_sink_callback_unsubscribe(subscription_id);
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    test_log_sink_callback_log(LOG_LEVEL_ERROR, NULL, __FILE__, __FUNCTION__, __LINE__, "test");
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_030: [ If subscription_id is not the id of an active subscription, log_sink_callback_unsubscribe shall fail and return a non-zero value. ]*/
+static void log_sink_callback_unsubscribe_twice_fails(void)
+{
+    // arrange
+    uint32_t subscription_id;
+    uint32_t later_subscription_id;
+    POOR_MANS_ASSERT(log_sink_callback_subscribe(mock_log_callback, NULL, (void*)0x44, LOG_SINK_CALLBACK_LEVEL_MASK_ALL, &subscription_id) == 0);
+    POOR_MANS_ASSERT(log_sink_callback_unsubscribe(subscription_id) == 0);
+    // reuses the slot
+    POOR_MANS_ASSERT(log_sink_callback_subscribe(mock_log_callback, NULL, (void*)0x45, LOG_SINK_CALLBACK_LEVEL_MASK_ALL, &later_subscription_id) == 0);
+    setup_mocks();
+    setup_printf_call();
+
+    // act
+    int result = log_sink_callback_unsubscribe(subscription_id);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(log_sink_callback_unsubscribe(later_subscription_id) == 0);
+}
+
+/* log_sink_callback_set_subscriber_level_mask */
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_038: [ log_sink_callback_set_subscriber_level_mask shall store level_mask so that it is used by all future calls to log_sink_callback.log and return 0. ]*/
+static void log_sink_callback_set_subscriber_level_mask_changes_the_levels_of_the_subscriber(void)
+{
+    // arrange
+    uint32_t subscription_id;
+    test_init();
+    POOR_MANS_ASSERT(log_sink_callback_set_callback(log_sink_callback_noop_callback, NULL) == 0);
+    POOR_MANS_ASSERT(log_sink_callback_subscribe(mock_log_callback, NULL, (void*)0x44, LOG_SINK_CALLBACK_LEVEL_MASK_ALL, &subscription_id) == 0);
+    setup_mocks();
+
+    // act
+    int result = log_sink_callback_set_subscriber_level_mask(subscription_id, LOG_SINK_CALLBACK_LEVEL_MASK(LOG_LEVEL_CRITICAL) | LOG_SINK_CALLBACK_LEVEL_MASK(LOG_LEVEL_ERROR));
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    test_log_sink_callback_log(LOG_LEVEL_WARNING, NULL, __FILE__, __FUNCTION__, __LINE__, "test");
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
+    setup_snprintf_call();
+    setup_log_vsnprintf_cached_call();
+    setup_log_callback_call();
+    test_log_sink_callback_log(LOG_LEVEL_ERROR, NULL, __FILE__, __FUNCTION__, __LINE__, "test");
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // cleanup
+    POOR_MANS_ASSERT(log_sink_callback_unsubscribe(subscription_id) == 0);
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_033: [ If subscription_id is not the id of an active subscription, log_sink_callback_set_subscriber_level_mask shall fail and return a non-zero value. ]*/
+static void log_sink_callback_set_subscriber_level_mask_with_unsubscribed_id_fails(void)
+{
+    // arrange
+    uint32_t subscription_id;
+    POOR_MANS_ASSERT(log_sink_callback_subscribe(mock_log_callback, NULL, (void*)0x44, LOG_SINK_CALLBACK_LEVEL_MASK_ALL, &subscription_id) == 0);
+    POOR_MANS_ASSERT(log_sink_callback_unsubscribe(subscription_id) == 0);
+    setup_mocks();
+    setup_printf_call();
+
+    // act
+    int result = log_sink_callback_set_subscriber_level_mask(subscription_id, LOG_SINK_CALLBACK_LEVEL_MASK_ALL);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+#define CONCURRENT_SUBSCRIBER_THREAD_COUNT LOG_SINK_CALLBACK_MAX_SUBSCRIBERS
+#define CONCURRENT_SUBSCRIBE_ITERATIONS 10000
+
+typedef struct CONCURRENT_SUBSCRIBER_TAG
+{
+    volatile long subscribed;
+    volatile long called_while_not_subscribed;
+} CONCURRENT_SUBSCRIBER;
+
+static volatile long concurrent_logging_done;
+
+static void concurrent_record_callback(void* context, const LOG_SINK_CALLBACK_RECORD* record)
+{
+    CONCURRENT_SUBSCRIBER* subscriber = context;
+    (void)record;
+
+    if (!subscriber->subscribed)
+    {
+        subscriber->called_while_not_subscribed = 1;
+    }
+}
+
+#ifdef _WIN32
+static DWORD WINAPI subscribe_and_unsubscribe(LPVOID context)
+#else
+static void* subscribe_and_unsubscribe(void* context)
+#endif
+{
+    CONCURRENT_SUBSCRIBER* subscriber = context;
+
+    for (uint32_t i = 0; i < CONCURRENT_SUBSCRIBE_ITERATIONS; i++)
+    {
+        uint32_t subscription_id;
+
+        subscriber->subscribed = 1;
+        POOR_MANS_ASSERT(log_sink_callback_subscribe(NULL, concurrent_record_callback, subscriber, LOG_SINK_CALLBACK_LEVEL_MASK_ALL, &subscription_id) == 0);
+        POOR_MANS_ASSERT(log_sink_callback_set_subscriber_level_mask(subscription_id, LOG_SINK_CALLBACK_LEVEL_MASK_ALL) == 0);
+        POOR_MANS_ASSERT(log_sink_callback_unsubscribe(subscription_id) == 0);
+        subscriber->subscribed = 0;
+
+        // the slot may belong to the subscription of another thread by now, which the stale id must not disturb
+        POOR_MANS_ASSERT(log_sink_callback_unsubscribe(subscription_id) != 0);
+        POOR_MANS_ASSERT(log_sink_callback_set_subscriber_level_mask(subscription_id, LOG_SINK_CALLBACK_LEVEL_MASK_ALL) != 0);
+    }
+
+    return 0;
+}
+
+#ifdef _WIN32
+static DWORD WINAPI log_until_done(LPVOID context)
+#else
+static void* log_until_done(void* context)
+#endif
+{
+    (void)context;
+
+    while (!concurrent_logging_done)
+    {
+        test_log_sink_callback_log(LOG_LEVEL_ERROR, NULL, __FILE__, __FUNCTION__, __LINE__, "test");
+    }
+
+    return 0;
+}
+
+/* Tests_SRS_LOG_SINK_CALLBACK_01_030: [ If subscription_id is not the id of an active subscription, log_sink_callback_unsubscribe shall fail and return a non-zero value. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_031: [ log_sink_callback_unsubscribe shall stop log_sink_callback.log from calling the callbacks of the subscription and wait (sleeping, not spinning) for the calls already in progress to return. ]*/
+/* Tests_SRS_LOG_SINK_CALLBACK_01_033: [ If subscription_id is not the id of an active subscription, log_sink_callback_set_subscriber_level_mask shall fail and return a non-zero value. ]*/
+static void log_sink_callback_subscribe_and_unsubscribe_from_many_threads_while_logging_works(void)
+{
+    // arrange
+    CONCURRENT_SUBSCRIBER subscribers[CONCURRENT_SUBSCRIBER_THREAD_COUNT] = { 0 };
+    test_init();
+    POOR_MANS_ASSERT(log_sink_callback_set_callback(log_sink_callback_noop_callback, NULL) == 0);
+    concurrent_logging_done = 0;
+    // the mocks called while logging are not expected, their failures are ignored
+    setup_mocks();
+
+    // act
+#ifdef _WIN32
+    HANDLE threads[CONCURRENT_SUBSCRIBER_THREAD_COUNT];
+    HANDLE log_thread = CreateThread(NULL, 0, log_until_done, NULL, 0, NULL);
+    POOR_MANS_ASSERT(log_thread != NULL);
+    for (uint32_t i = 0; i < CONCURRENT_SUBSCRIBER_THREAD_COUNT; i++)
+    {
+        threads[i] = CreateThread(NULL, 0, subscribe_and_unsubscribe, &subscribers[i], 0, NULL);
+        POOR_MANS_ASSERT(threads[i] != NULL);
+    }
+    for (uint32_t i = 0; i < CONCURRENT_SUBSCRIBER_THREAD_COUNT; i++)
+    {
+        POOR_MANS_ASSERT(WaitForSingleObject(threads[i], INFINITE) == WAIT_OBJECT_0);
+        (void)CloseHandle(threads[i]);
+    }
+    concurrent_logging_done = 1;
+    POOR_MANS_ASSERT(WaitForSingleObject(log_thread, INFINITE) == WAIT_OBJECT_0);
+    (void)CloseHandle(log_thread);
+#else
+    pthread_t threads[CONCURRENT_SUBSCRIBER_THREAD_COUNT];
+    pthread_t log_thread;
+    POOR_MANS_ASSERT(pthread_create(&log_thread, NULL, log_until_done, NULL) == 0);
+    for (uint32_t i = 0; i < CONCURRENT_SUBSCRIBER_THREAD_COUNT; i++)
+    {
+        POOR_MANS_ASSERT(pthread_create(&threads[i], NULL, subscribe_and_unsubscribe, &subscribers[i]) == 0);
+    }
+    for (uint32_t i = 0; i < CONCURRENT_SUBSCRIBER_THREAD_COUNT; i++)
+    {
+        POOR_MANS_ASSERT(pthread_join(threads[i], NULL) == 0);
+    }
+    concurrent_logging_done = 1;
+    POOR_MANS_ASSERT(pthread_join(log_thread, NULL) == 0);
+#endif
+
+    // assert
+    for (uint32_t i = 0; i < CONCURRENT_SUBSCRIBER_THREAD_COUNT; i++)
+    {
+        POOR_MANS_ASSERT(!subscribers[i].called_while_not_subscribed);
+    }
+
+    // cleanup
+    setup_mocks();
+}
+
 /* very "poor man's" way of testing, as no test harness and mocking framework are available */
 int main(void)
 {
@@ -1425,9 +2214,9 @@ int main(void)
     log_sink_callback_log_calls_callback_with_one_VERBOSE_log_line();
 
     when_snprintf_fails_log_sink_callback_log_prints_error_formatting();
-    when_vsnprintf_fails_log_sink_callback_log_prints_error_formatting();
-    when_time_fails_log_sink_callback_log_prints_time_as_NULL();
-    when_ctime_returns_NULL_log_sink_callback_log_prints_time_as_NULL();
+    when_log_vsnprintf_cached_fails_log_sink_callback_log_prints_error_formatting();
+    when_log_timestamp_now_fails_log_sink_callback_log_prints_time_as_NULL();
+    when_timestamp_microseconds_to_string_fails_log_sink_callback_log_prints_time_as_NULL();
 
     log_sink_callback_log_with_non_NULL_context_prints_one_property();
     log_sink_callback_log_with_non_NULL_context_prints_2_properties();
@@ -1452,5 +2241,35 @@ int main(void)
     log_sink_callback_log_calls_callback_for_all_log_levels_ERROR_and_lower_when_max_level_is_ERROR();
     log_sink_callback_log_calls_callback_for_log_level_CRITICAL_when_max_level_is_CRITICAL();
 
+    log_sink_callback_set_layout_with_invalid_pattern_fails();
+    log_sink_callback_log_with_layout_calls_callback_with_the_layout_line();
+
+    log_sink_callback_log_calls_the_record_callback_and_then_the_log_callback();
+    log_sink_callback_log_with_only_the_record_callback_does_not_build_the_line();
+    log_sink_callback_set_record_callback_with_NULL_removes_the_record_callback();
+    log_sink_callback_log_with_level_above_max_level_does_not_call_the_record_callback();
+    log_sink_callback_log_with_NULL_message_format_calls_the_record_callback_with_error();
+
+    log_sink_callback_record_get_message_with_NULL_record_fails();
+    log_sink_callback_record_get_message_formats_the_message_once();
+    log_sink_callback_log_builds_the_line_with_the_message_formatted_by_the_record_callback();
+    when_log_vsnprintf_cached_fails_log_sink_callback_record_get_message_returns_NULL();
+
+    log_sink_callback_subscribe_with_NULL_callbacks_fails();
+    log_sink_callback_subscribe_with_NULL_subscription_id_fails();
+    log_sink_callback_subscribe_fails_when_all_the_slots_are_used();
+    log_sink_callback_log_builds_the_line_once_for_the_subscribers_that_want_the_level();
+    log_sink_callback_log_formats_the_message_once_for_the_record_subscribers();
+    log_sink_callback_log_calls_the_subscribers_above_the_max_level();
+    log_sink_callback_log_with_NULL_message_format_calls_all_the_subscribers_with_error();
+
+    log_sink_callback_unsubscribe_stops_the_calls_to_the_subscriber();
+    log_sink_callback_unsubscribe_twice_fails();
+
+    log_sink_callback_set_subscriber_level_mask_changes_the_levels_of_the_subscriber();
+    log_sink_callback_set_subscriber_level_mask_with_unsubscribed_id_fails();
+
+    log_sink_callback_subscribe_and_unsubscribe_from_many_threads_while_logging_works();
+
     return 0;
 }
@@ -3,27 +3,47 @@
 
 #include <stdarg.h>
 #include <stdint.h>
-#include <time.h>
 
 #include "c_logging/log_context.h"
 #include "c_logging/log_context_property_value_pair.h"
+#include "c_logging/log_timestamp.h"
+#include "c_logging/time_to_string.h"
+
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/uio.h>
+#endif
 
 #define printf mock_printf
-#define time mock_time
-#define ctime mock_ctime
-#define vsnprintf mock_vsnprintf
+#define log_timestamp_now mock_log_timestamp_now
+#define timestamp_microseconds_to_string mock_timestamp_microseconds_to_string
+#define log_vsnprintf_cached mock_log_vsnprintf_cached
 #define snprintf mock_snprintf
 #define log_context_get_property_value_pair_count mock_log_context_get_property_value_pair_count
 #define log_context_get_property_value_pairs mock_log_context_get_property_value_pairs
 #define log_context_property_to_string mock_log_context_property_to_string
+#define atexit mock_atexit
+
+#ifndef _WIN32
+#define isatty mock_isatty
+#define write mock_write
+#define writev mock_writev
+#endif
 
 int mock_printf(const char* format, ...);
-time_t mock_time(time_t* const _time);
-char* mock_ctime(const time_t* timer);
-int mock_vsnprintf(char* s, size_t n, const char* format, va_list arg);
+int64_t mock_log_timestamp_now(void);
+int mock_timestamp_microseconds_to_string(int64_t nanoseconds_since_epoch, char* buffer, size_t buffer_length);
+int mock_log_vsnprintf_cached(char* s, size_t n, const char* format, va_list arg);
 int mock_snprintf(char* s, size_t n, const char* format, ...);
 uint32_t mock_log_context_get_property_value_pair_count(LOG_CONTEXT_HANDLE log_context);
 const LOG_CONTEXT_PROPERTY_VALUE_PAIR* mock_log_context_get_property_value_pairs(LOG_CONTEXT_HANDLE log_context);
 int mock_log_context_property_to_string(char* buffer, size_t buffer_size, const LOG_CONTEXT_PROPERTY_VALUE_PAIR* property_value_pairs, size_t property_value_pair_count);
+int mock_atexit(void (*function)(void));
+
+#ifndef _WIN32
+int mock_isatty(int fd);
+ssize_t mock_write(int fd, const void* buf, size_t count);
+ssize_t mock_writev(int fd, const struct iovec* iov, int iovcnt);
+#endif
 
 #include "log_sink_console.c"
@@ -9,6 +9,12 @@
 #include <string.h>
 #include <time.h>
 
+#ifndef _WIN32
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <unistd.h>
+#endif
+
 #include "macro_utils/macro_utils.h"
 
 #include "c_logging/log_context_property_basic_types.h"
@@ -17,8 +23,10 @@
 #include "c_logging/log_context_property_value_pair.h"
 #include "c_logging/log_level.h"
 #include "c_logging/log_sink_if.h"
+#include "c_logging/log_timestamp.h"
 #include "c_logging/log_context.h"
 #include "c_logging/logger.h"
+#include "c_logging/time_to_string.h"
 
 #include "c_logging/log_sink_console.h"
 
@@ -27,13 +35,17 @@
 
 #define MOCK_CALL_TYPE_VALUES \
     MOCK_CALL_TYPE_printf, \
-    MOCK_CALL_TYPE_time, \
-    MOCK_CALL_TYPE_ctime, \
-    MOCK_CALL_TYPE_vsnprintf, \
+    MOCK_CALL_TYPE_log_timestamp_now, \
+    MOCK_CALL_TYPE_timestamp_microseconds_to_string, \
+    MOCK_CALL_TYPE_log_vsnprintf_cached, \
     MOCK_CALL_TYPE_snprintf, \
     MOCK_CALL_TYPE_log_context_get_property_value_pair_count, \
     MOCK_CALL_TYPE_log_context_get_property_value_pairs, \
-    MOCK_CALL_TYPE_log_context_property_to_string \
+    MOCK_CALL_TYPE_log_context_property_to_string, \
+    MOCK_CALL_TYPE_isatty, \
+    MOCK_CALL_TYPE_atexit, \
+    MOCK_CALL_TYPE_write, \
+    MOCK_CALL_TYPE_writev \
 
 MU_DEFINE_ENUM(MOCK_CALL_TYPE, MOCK_CALL_TYPE_VALUES)
 
@@ -48,26 +60,26 @@ typedef struct printf_CALL_TAG
     char captured_output[MAX_PRINTF_CAPTURED_OUPUT_SIZE];
 } printf_CALL;
 
-typedef struct time_CALL_TAG
+typedef struct log_timestamp_now_CALL_TAG
 {
     bool override_result;
-    time_t call_result;
-    time_t* captured__time;
-} time_CALL;
+    int64_t call_result;
+    int64_t captured_result;
+} log_timestamp_now_CALL;
 
-typedef struct ctime_CALL_TAG
+typedef struct timestamp_microseconds_to_string_CALL_TAG
 {
     bool override_result;
-    char* call_result;
-    const time_t* captured_timer;
-} ctime_CALL;
+    int call_result;
+    int64_t captured_nanoseconds_since_epoch;
+} timestamp_microseconds_to_string_CALL;
 
-typedef struct vsnprintf_CALL_TAG
+typedef struct log_vsnprintf_cached_CALL_TAG
 {
     bool override_result;
     int call_result;
     const char* captured_format_arg;
-} vsnprintf_CALL;
+} log_vsnprintf_cached_CALL;
 
 typedef struct snprintf_CALL_TAG
 {
@@ -100,19 +112,49 @@ typedef struct log_context_property_to_string_CALL_TAG
     size_t captured_property_value_pair_count;
 } log_context_property_to_string_CALL;
 
+typedef struct isatty_CALL_TAG
+{
+    bool override_result;
+    int call_result;
+    int captured_fd;
+} isatty_CALL;
+
+typedef struct atexit_CALL_TAG
+{
+    void (*captured_function)(void);
+} atexit_CALL;
+
+typedef struct write_CALL_TAG
+{
+    int captured_fd;
+    size_t captured_count;
+    char captured_output[MAX_PRINTF_CAPTURED_OUPUT_SIZE];
+} write_CALL;
+
+typedef struct writev_CALL_TAG
+{
+    int captured_fd;
+    int captured_iovcnt;
+    size_t captured_lengths[2];
+} writev_CALL;
+
 typedef struct MOCK_CALL_TAG
 {
     MOCK_CALL_TYPE mock_call_type;
     union
     {
         printf_CALL printf_call;
-        time_CALL time_call;
-        ctime_CALL ctime_call;
-        vsnprintf_CALL vsnprintf_call;
+        log_timestamp_now_CALL log_timestamp_now_call;
+        timestamp_microseconds_to_string_CALL timestamp_microseconds_to_string_call;
+        log_vsnprintf_cached_CALL log_vsnprintf_cached_call;
         snprintf_CALL snprintf_call;
         log_context_get_property_value_pair_count_CALL log_context_get_property_value_pair_count_call;
         log_context_get_property_value_pairs_CALL log_context_get_property_value_pairs_call;
         log_context_property_to_string_CALL log_context_property_to_string_call;
+        isatty_CALL isatty_call;
+        atexit_CALL atexit_call;
+        write_CALL write_call;
+        writev_CALL writev_call;
     };
 } MOCK_CALL;
 
@@ -164,26 +206,26 @@ int mock_printf(const char* format, ...)
     return result;
 }
 
-time_t mock_time(time_t* const _time)
+int64_t mock_log_timestamp_now(void)
 {
-    time_t result;
+    int64_t result;
 
     if ((actual_call_count == expected_call_count) ||
-        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_time))
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_log_timestamp_now))
     {
         actual_and_expected_match = false;
-        result = (time_t)-1;
+        result = LOG_TIMESTAMP_INVALID;
     }
     else
     {
-        if (expected_calls[actual_call_count].time_call.override_result)
+        if (expected_calls[actual_call_count].log_timestamp_now_call.override_result)
         {
-            result = expected_calls[actual_call_count].time_call.call_result;
+            result = expected_calls[actual_call_count].log_timestamp_now_call.call_result;
         }
         else
         {
-            expected_calls[actual_call_count].time_call.captured__time = _time;
-            result = time(_time);
+            result = log_timestamp_now();
+            expected_calls[actual_call_count].log_timestamp_now_call.captured_result = result;
         }
 
         actual_call_count++;
@@ -192,26 +234,26 @@ time_t mock_time(time_t* const _time)
     return result;
 }
 
-char* mock_ctime(const time_t* timer)
+int mock_timestamp_microseconds_to_string(int64_t nanoseconds_since_epoch, char* buffer, size_t buffer_length)
 {
-    char* result;
+    int result;
 
     if ((actual_call_count == expected_call_count) ||
-        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_ctime))
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_timestamp_microseconds_to_string))
     {
         actual_and_expected_match = false;
-        result = NULL;
+        result = -1;
     }
     else
     {
-        if (expected_calls[actual_call_count].ctime_call.override_result)
+        if (expected_calls[actual_call_count].timestamp_microseconds_to_string_call.override_result)
         {
-            result = expected_calls[actual_call_count].ctime_call.call_result;
+            result = expected_calls[actual_call_count].timestamp_microseconds_to_string_call.call_result;
         }
         else
         {
-            expected_calls[actual_call_count].ctime_call.captured_timer = timer;
-            result = ctime(timer);
+            expected_calls[actual_call_count].timestamp_microseconds_to_string_call.captured_nanoseconds_since_epoch = nanoseconds_since_epoch;
+            result = timestamp_microseconds_to_string(nanoseconds_since_epoch, buffer, buffer_length);
         }
 
         actual_call_count++;
@@ -220,25 +262,25 @@ char* mock_ctime(const time_t* timer)
     return result;
 }
 
-int mock_vsnprintf(char* s, size_t n, const char* format, va_list args)
+int mock_log_vsnprintf_cached(char* s, size_t n, const char* format, va_list args)
 {
     int result;
 
     if ((actual_call_count == expected_call_count) ||
-        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_vsnprintf))
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_log_vsnprintf_cached))
     {
         actual_and_expected_match = false;
         result = -1;
     }
     else
     {
-        if (expected_calls[actual_call_count].vsnprintf_call.override_result)
+        if (expected_calls[actual_call_count].log_vsnprintf_cached_call.override_result)
         {
-            result = expected_calls[actual_call_count].vsnprintf_call.call_result;
+            result = expected_calls[actual_call_count].log_vsnprintf_cached_call.call_result;
         }
         else
         {
-            expected_calls[actual_call_count].vsnprintf_call.captured_format_arg = format;
+            expected_calls[actual_call_count].log_vsnprintf_cached_call.captured_format_arg = format;
 
             result = vsnprintf(s, n, format, args);
 
@@ -375,6 +417,116 @@ int mock_log_context_property_to_string(char* buffer, size_t buffer_size, const
     return result;
 }
 
+#ifndef _WIN32
+int mock_isatty(int fd)
+{
+    int result;
+
+    if ((actual_call_count == expected_call_count) ||
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_isatty))
+    {
+        actual_and_expected_match = false;
+        result = 0;
+    }
+    else
+    {
+        expected_calls[actual_call_count].isatty_call.captured_fd = fd;
+
+        if (expected_calls[actual_call_count].isatty_call.override_result)
+        {
+            result = expected_calls[actual_call_count].isatty_call.call_result;
+        }
+        else
+        {
+            result = isatty(fd);
+        }
+
+        actual_call_count++;
+    }
+
+    return result;
+}
+
+// the function is only captured, the batched lines of the tests are not written at exit
+int mock_atexit(void (*function)(void))
+{
+    int result;
+
+    if ((actual_call_count == expected_call_count) ||
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_atexit))
+    {
+        actual_and_expected_match = false;
+        result = -1;
+    }
+    else
+    {
+        expected_calls[actual_call_count].atexit_call.captured_function = function;
+        result = 0;
+
+        actual_call_count++;
+    }
+
+    return result;
+}
+
+// the written bytes are only captured, so that the test output stays readable
+ssize_t mock_write(int fd, const void* buf, size_t count)
+{
+    ssize_t result;
+
+    if ((actual_call_count == expected_call_count) ||
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_write))
+    {
+        actual_and_expected_match = false;
+        result = -1;
+    }
+    else
+    {
+        size_t captured_count = (count < sizeof(expected_calls[actual_call_count].write_call.captured_output) - 1) ? count : sizeof(expected_calls[actual_call_count].write_call.captured_output) - 1;
+
+        expected_calls[actual_call_count].write_call.captured_fd = fd;
+        expected_calls[actual_call_count].write_call.captured_count = count;
+        (void)memcpy(expected_calls[actual_call_count].write_call.captured_output, buf, captured_count);
+        expected_calls[actual_call_count].write_call.captured_output[captured_count] = '\0';
+        result = (ssize_t)count;
+
+        actual_call_count++;
+    }
+
+    return result;
+}
+
+ssize_t mock_writev(int fd, const struct iovec* iov, int iovcnt)
+{
+    ssize_t result;
+
+    if ((actual_call_count == expected_call_count) ||
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_writev))
+    {
+        actual_and_expected_match = false;
+        result = -1;
+    }
+    else
+    {
+        expected_calls[actual_call_count].writev_call.captured_fd = fd;
+        expected_calls[actual_call_count].writev_call.captured_iovcnt = iovcnt;
+        result = 0;
+        for (int i = 0; i < iovcnt; i++)
+        {
+            if (i < 2)
+            {
+                expected_calls[actual_call_count].writev_call.captured_lengths[i] = iov[i].iov_len;
+            }
+            result += (ssize_t)iov[i].iov_len;
+        }
+
+        actual_call_count++;
+    }
+
+    return result;
+}
+#endif
+
 #define POOR_MANS_ASSERT(cond) \
     if (!(cond)) \
     { \
@@ -389,24 +541,24 @@ static void setup_printf_call(void)
     expected_call_count++;
 }
 
-static void setup_time_call(void)
+static void setup_log_timestamp_now_call(void)
 {
-    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_time;
-    expected_calls[expected_call_count].time_call.override_result = false;
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_log_timestamp_now;
+    expected_calls[expected_call_count].log_timestamp_now_call.override_result = false;
     expected_call_count++;
 }
 
-static void setup_ctime_call(void)
+static void setup_timestamp_microseconds_to_string_call(void)
 {
-    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_ctime;
-    expected_calls[expected_call_count].ctime_call.override_result = false;
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_timestamp_microseconds_to_string;
+    expected_calls[expected_call_count].timestamp_microseconds_to_string_call.override_result = false;
     expected_call_count++;
 }
 
-static void setup_vsnprintf_call(void)
+static void setup_log_vsnprintf_cached_call(void)
 {
-    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_vsnprintf;
-    expected_calls[expected_call_count].vsnprintf_call.override_result = false;
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_log_vsnprintf_cached;
+    expected_calls[expected_call_count].log_vsnprintf_cached_call.override_result = false;
     expected_call_count++;
 }
 
@@ -438,21 +590,47 @@ static void setup_log_context_property_to_string_call(void)
     expected_call_count++;
 }
 
+static void setup_isatty_call(int call_result)
+{
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_isatty;
+    expected_calls[expected_call_count].isatty_call.override_result = true;
+    expected_calls[expected_call_count].isatty_call.call_result = call_result;
+    expected_call_count++;
+}
+
+static void setup_atexit_call(void)
+{
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_atexit;
+    expected_call_count++;
+}
+
+static void setup_write_call(void)
+{
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_write;
+    expected_call_count++;
+}
+
+static void setup_writev_call(void)
+{
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_writev;
+    expected_call_count++;
+}
+
 static void validate_log_line(const char* actual_string, const char* expected_format, const char* expected_log_level_string, const char* file, int line, const char* func, const char* expected_message)
 {
     char expected_string[LOG_MAX_MESSAGE_LENGTH * 2];
     int snprintf_result = snprintf(expected_string, sizeof(expected_string), expected_format, expected_log_level_string, file, line, func, expected_message);
     POOR_MANS_ASSERT(snprintf_result >= 0);
-    char day_of_week[4];
-    char month[4];
+    int year;
+    int month;
     int day;
     int hour;
     int minute;
     int second;
-    int year;
+    int microsecond;
     char reset_color_code[10];
     char anything_else[200];
-    int scanned_values = sscanf(actual_string, expected_string, day_of_week, month, &day, &hour, &minute, &second, &year, reset_color_code, anything_else);
+    int scanned_values = sscanf(actual_string, expected_string, &year, &month, &day, &hour, &minute, &second, &microsecond, reset_color_code, anything_else);
     POOR_MANS_ASSERT(scanned_values == 8); // the last one should not get scanned as there should be nothing past \r\n
     size_t actual_string_length = strlen(actual_string);
     POOR_MANS_ASSERT(actual_string[actual_string_length - 2] == '\r');
@@ -501,7 +679,7 @@ static void log_sink_console_init_returns(void)
 
 /* log_sink_console.deinit */
 
-/* Tests_SRS_LOG_SINK_CONSOLE_01_028: [ log_sink_console.deinit shall return. ] */
+/* Tests_SRS_LOG_SINK_CONSOLE_01_028: [ log_sink_console.deinit shall write the batched lines by calling log_sink_console_flush. ] */
 static void log_sink_console_deinit_returns(void)
 {
     // arrange
@@ -532,21 +710,22 @@ static void log_sink_console_log_with_NULL_message_format_returns(void)
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
-/* Tests_SRS_LOG_SINK_CONSOLE_01_002: [ log_sink_console.log shall obtain the time by calling time. ]*/
-/* Tests_SRS_LOG_SINK_CONSOLE_01_003: [ log_sink_console.log shall convert the time to string by calling ctime. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_035: [ log_sink_console.log shall obtain the time by calling log_timestamp_now. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_036: [ log_sink_console.log shall convert the time to string by calling timestamp_microseconds_to_string. ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_004: [ log_sink_console.log shall print a line in the format: {log_level} Time: {formatted time} File:{file}:{line} Func:{func} {optional context information} {formatted message} ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_005: [ In order to not break the line in multiple parts when displayed on the console, log_sink_console.log shall print the line in such a way that only one printf call is made. ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_006: [ log_sink_console.log shall color the lines using ANSI color codes (https://en.wikipedia.org/wiki/ANSI_escape_code#Colors), as follows: ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_007: [ LOG_LEVEL_CRITICAL shall be displayed with bright red x1b[31;1m. ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_012: [ At the end of each line that is printed, the color shall be reset by using the x1b[0m code. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_029: [ log_sink_console.log shall format the message by calling log_vsnprintf_cached. ]*/
 static void log_sink_console_log_prints_one_CRITICAL_log_line(void)
 {
     // arrange
     setup_mocks();
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_printf_call();
 
     // act
@@ -555,13 +734,13 @@ static void log_sink_console_log_prints_one_CRITICAL_log_line(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
-    validate_log_line(expected_calls[4].printf_call.captured_output, "\x1b[31;1m%s Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_CRITICAL), __FILE__, line_no, __FUNCTION__, "test");
+    POOR_MANS_ASSERT(expected_calls[1].timestamp_microseconds_to_string_call.captured_nanoseconds_since_epoch == expected_calls[0].log_timestamp_now_call.captured_result);
+    validate_log_line(expected_calls[4].printf_call.captured_output, "\x1b[31;1m%s Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_CRITICAL), __FILE__, line_no, __FUNCTION__, "test");
 }
 
-/* Tests_SRS_LOG_SINK_CONSOLE_01_002: [ log_sink_console.log shall obtain the time by calling time. ]*/
-/* Tests_SRS_LOG_SINK_CONSOLE_01_003: [ log_sink_console.log shall convert the time to string by calling ctime. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_035: [ log_sink_console.log shall obtain the time by calling log_timestamp_now. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_036: [ log_sink_console.log shall convert the time to string by calling timestamp_microseconds_to_string. ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_004: [ log_sink_console.log shall print a line in the format: {log_level} Time: {formatted time} File:{file}:{line} Func:{func} {optional context information} {formatted message} ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_005: [ In order to not break the line in multiple parts when displayed on the console, log_sink_console.log shall print the line in such a way that only one printf call is made. ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_006: [ log_sink_console.log shall color the lines using ANSI color codes (https://en.wikipedia.org/wiki/ANSI_escape_code#Colors), as follows: ]*/
@@ -571,10 +750,10 @@ static void log_sink_console_log_prints_one_ERROR_log_line(void)
 {
     // arrange
     setup_mocks();
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_printf_call();
 
     // act
@@ -583,13 +762,12 @@ static void log_sink_console_log_prints_one_ERROR_log_line(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
-    validate_log_line(expected_calls[4].printf_call.captured_output, "\x1b[31m%s Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_ERROR), __FILE__, line_no, __FUNCTION__, "test");
+    validate_log_line(expected_calls[4].printf_call.captured_output, "\x1b[31m%s Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_ERROR), __FILE__, line_no, __FUNCTION__, "test");
 }
 
-/* Tests_SRS_LOG_SINK_CONSOLE_01_002: [ log_sink_console.log shall obtain the time by calling time. ]*/
-/* Tests_SRS_LOG_SINK_CONSOLE_01_003: [ log_sink_console.log shall convert the time to string by calling ctime. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_035: [ log_sink_console.log shall obtain the time by calling log_timestamp_now. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_036: [ log_sink_console.log shall convert the time to string by calling timestamp_microseconds_to_string. ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_004: [ log_sink_console.log shall print a line in the format: {log_level} Time: {formatted time} File:{file}:{line} Func:{func} {optional context information} {formatted message} ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_005: [ In order to not break the line in multiple parts when displayed on the console, log_sink_console.log shall print the line in such a way that only one printf call is made. ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_006: [ log_sink_console.log shall color the lines using ANSI color codes (https://en.wikipedia.org/wiki/ANSI_escape_code#Colors), as follows: ]*/
@@ -599,10 +777,10 @@ static void log_sink_console_log_prints_one_WARNING_log_line(void)
 {
     // arrange
     setup_mocks();
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_printf_call();
 
     // act
@@ -611,13 +789,12 @@ static void log_sink_console_log_prints_one_WARNING_log_line(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
-    validate_log_line(expected_calls[4].printf_call.captured_output, "\x1b[33m%s Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_WARNING), __FILE__, line_no, __FUNCTION__, "test");
+    validate_log_line(expected_calls[4].printf_call.captured_output, "\x1b[33m%s Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_WARNING), __FILE__, line_no, __FUNCTION__, "test");
 }
 
-/* Tests_SRS_LOG_SINK_CONSOLE_01_002: [ log_sink_console.log shall obtain the time by calling time. ]*/
-/* Tests_SRS_LOG_SINK_CONSOLE_01_003: [ log_sink_console.log shall convert the time to string by calling ctime. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_035: [ log_sink_console.log shall obtain the time by calling log_timestamp_now. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_036: [ log_sink_console.log shall convert the time to string by calling timestamp_microseconds_to_string. ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_004: [ log_sink_console.log shall print a line in the format: {log_level} Time: {formatted time} File:{file}:{line} Func:{func} {optional context information} {formatted message} ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_005: [ In order to not break the line in multiple parts when displayed on the console, log_sink_console.log shall print the line in such a way that only one printf call is made. ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_006: [ log_sink_console.log shall color the lines using ANSI color codes (https://en.wikipedia.org/wiki/ANSI_escape_code#Colors), as follows: ]*/
@@ -627,10 +804,10 @@ static void log_sink_console_log_prints_one_INFO_log_line(void)
 {
     // arrange
     setup_mocks();
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_printf_call();
 
     // act
@@ -639,13 +816,12 @@ static void log_sink_console_log_prints_one_INFO_log_line(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
-    validate_log_line(expected_calls[4].printf_call.captured_output, "\x1b[37m%s Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_INFO), __FILE__, line_no, __FUNCTION__, "test");
+    validate_log_line(expected_calls[4].printf_call.captured_output, "\x1b[37m%s Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_INFO), __FILE__, line_no, __FUNCTION__, "test");
 }
 
-/* Tests_SRS_LOG_SINK_CONSOLE_01_002: [ log_sink_console.log shall obtain the time by calling time. ]*/
-/* Tests_SRS_LOG_SINK_CONSOLE_01_003: [ log_sink_console.log shall convert the time to string by calling ctime. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_035: [ log_sink_console.log shall obtain the time by calling log_timestamp_now. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_036: [ log_sink_console.log shall convert the time to string by calling timestamp_microseconds_to_string. ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_004: [ log_sink_console.log shall print a line in the format: {log_level} Time: {formatted time} File:{file}:{line} Func:{func} {optional context information} {formatted message} ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_005: [ In order to not break the line in multiple parts when displayed on the console, log_sink_console.log shall print the line in such a way that only one printf call is made. ]*/
 /* Tests_SRS_LOG_SINK_CONSOLE_01_006: [ log_sink_console.log shall color the lines using ANSI color codes (https://en.wikipedia.org/wiki/ANSI_escape_code#Colors), as follows: ]*/
@@ -655,10 +831,10 @@ static void log_sink_console_log_prints_one_VERBOSE_log_line(void)
 {
     // arrange
     setup_mocks();
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_printf_call();
 
     // act
@@ -667,9 +843,8 @@ static void log_sink_console_log_prints_one_VERBOSE_log_line(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
-    validate_log_line(expected_calls[4].printf_call.captured_output, "\x1b[90m%s Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
+    validate_log_line(expected_calls[4].printf_call.captured_output, "\x1b[90m%s Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
 }
 
 /* Tests_SRS_LOG_SINK_CONSOLE_01_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_sink_console.log shall print Error formatting log line and return. ]*/
@@ -677,8 +852,8 @@ static void when_snprintf_fails_log_sink_console_log_prints_error_formatting(voi
 {
     // arrange
     setup_mocks();
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_printf_call();
     expected_calls[2].snprintf_call.override_result = true;
@@ -690,23 +865,22 @@ static void when_snprintf_fails_log_sink_console_log_prints_error_formatting(voi
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
-    POOR_MANS_ASSERT(strcmp(expected_calls[3].printf_call.captured_output, "Error formatting log line\r\n") == 0);
+    POOR_MANS_ASSERT(strcmp(expected_calls[3].printf_call.captured_output, "Error formatting log line\x1b[0m\r\n") == 0);
 }
 
 /* Tests_SRS_LOG_SINK_CONSOLE_01_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_sink_console.log shall print Error formatting log line and return. ]*/
-static void when_vsnprintf_fails_log_sink_console_log_prints_error_formatting(void)
+static void when_log_vsnprintf_cached_fails_log_sink_console_log_prints_error_formatting(void)
 {
     // arrange
     setup_mocks();
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_printf_call();
-    expected_calls[3].vsnprintf_call.override_result = true;
-    expected_calls[3].vsnprintf_call.call_result = -1;
+    expected_calls[3].log_vsnprintf_cached_call.override_result = true;
+    expected_calls[3].log_vsnprintf_cached_call.call_result = -1;
 
     // act
     int line_no = __LINE__;
@@ -714,22 +888,21 @@ static void when_vsnprintf_fails_log_sink_console_log_prints_error_formatting(vo
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
-    POOR_MANS_ASSERT(strcmp(expected_calls[4].printf_call.captured_output, "Error formatting log line\r\n") == 0);
+    POOR_MANS_ASSERT(strcmp(expected_calls[4].printf_call.captured_output, "Error formatting log line\x1b[0m\r\n") == 0);
 }
 
-/* Tests_SRS_LOG_SINK_CONSOLE_01_023: [ If the call to time fails then log_sink_console.log shall print the time as NULL. ]*/
-static void when_time_fails_log_sink_console_log_prints_time_as_NULL(void)
+/* Tests_SRS_LOG_SINK_CONSOLE_01_037: [ If the call to log_timestamp_now fails then log_sink_console.log shall print the time as NULL. ]*/
+static void when_log_timestamp_now_fails_log_sink_console_log_prints_time_as_NULL(void)
 {
     // arrange
     setup_mocks();
-    setup_time_call();
+    setup_log_timestamp_now_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_printf_call();
-    expected_calls[0].time_call.override_result = true;
-    expected_calls[0].time_call.call_result = (time_t)-1;
+    expected_calls[0].log_timestamp_now_call.override_result = true;
+    expected_calls[0].log_timestamp_now_call.call_result = LOG_TIMESTAMP_INVALID;
 
     // act
     int line_no = __LINE__;
@@ -737,23 +910,22 @@ static void when_time_fails_log_sink_console_log_prints_time_as_NULL(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     validate_log_line_with_NULL_time(expected_calls[3].printf_call.captured_output, "\x1b[90m%s Time:NULL File:%s:%d Func:%s %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
 }
 
-/* Tests_SRS_LOG_SINK_CONSOLE_01_024: [ If the call to ctime fails then log_sink_console.log shall print the time as NULL. ]*/
-static void when_ctime_returns_NULL_log_sink_console_log_prints_time_as_NULL(void)
+/* Tests_SRS_LOG_SINK_CONSOLE_01_038: [ If the call to timestamp_microseconds_to_string fails then log_sink_console.log shall print the time as NULL. ]*/
+static void when_timestamp_microseconds_to_string_fails_log_sink_console_log_prints_time_as_NULL(void)
 {
     // arrange
     setup_mocks();
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_printf_call();
-    expected_calls[1].ctime_call.override_result = true;
-    expected_calls[1].ctime_call.call_result = NULL;
+    expected_calls[1].timestamp_microseconds_to_string_call.override_result = true;
+    expected_calls[1].timestamp_microseconds_to_string_call.call_result = -1;
 
     // act
     int line_no = __LINE__;
@@ -761,7 +933,6 @@ static void when_ctime_returns_NULL_log_sink_console_log_prints_time_as_NULL(voi
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
     validate_log_line_with_NULL_time(expected_calls[4].printf_call.captured_output, "\x1b[90m%s Time:NULL File:%s:%d Func:%s %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
 }
@@ -774,15 +945,15 @@ static void log_sink_console_log_with_non_NULL_context_prints_one_property(void)
 {
     // arrange
     setup_mocks();
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
 
     setup_log_context_property_to_string_call();
 
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_printf_call();
 
     LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
@@ -793,9 +964,8 @@ static void log_sink_console_log_with_non_NULL_context_prints_one_property(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
-    validate_log_line(expected_calls[actual_call_count - 1].printf_call.captured_output, "\x1b[90m%s Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s { x = 42 } %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
+    validate_log_line(expected_calls[actual_call_count - 1].printf_call.captured_output, "\x1b[90m%s Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s { x = 42 } %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
 }
 
 /* Tests_SRS_LOG_SINK_CONSOLE_01_013: [ If log_context is non-NULL: ]*/
@@ -806,15 +976,15 @@ static void log_sink_console_log_with_non_NULL_context_prints_2_properties(void)
 {
     // arrange
     setup_mocks();
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
 
     setup_log_context_property_to_string_call();
 
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_printf_call();
 
     LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42), LOG_CONTEXT_PROPERTY(uint32_t, y, 1));
@@ -825,9 +995,8 @@ static void log_sink_console_log_with_non_NULL_context_prints_2_properties(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
-    validate_log_line(expected_calls[actual_call_count - 1].printf_call.captured_output, "\x1b[90m%s Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s { x=42 y=1 } %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
+    validate_log_line(expected_calls[actual_call_count - 1].printf_call.captured_output, "\x1b[90m%s Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s { x=42 y=1 } %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
 }
 
 /* Tests_SRS_LOG_SINK_CONSOLE_01_013: [ If log_context is non-NULL: ]*/
@@ -838,15 +1007,15 @@ static void log_sink_console_log_with_non_NULL_context_with_2_levels_works(void)
 {
     // arrange
     setup_mocks();
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
 
     setup_log_context_property_to_string_call();
 
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_printf_call();
 
     LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
@@ -858,9 +1027,8 @@ static void log_sink_console_log_with_non_NULL_context_with_2_levels_works(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
-    validate_log_line(expected_calls[actual_call_count - 1].printf_call.captured_output, "\x1b[90m%s Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s { { x=42 } y=1 } %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
+    validate_log_line(expected_calls[actual_call_count - 1].printf_call.captured_output, "\x1b[90m%s Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s { { x=42 } y=1 } %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
 }
 
 /* Tests_SRS_LOG_SINK_CONSOLE_01_013: [ If log_context is non-NULL: ]*/
@@ -871,15 +1039,15 @@ static void log_sink_console_log_with_non_NULL_named_contexts_with_2_levels_work
 {
     // arrange
     setup_mocks();
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
 
     setup_log_context_property_to_string_call();
 
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_printf_call();
 
     LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL, LOG_CONTEXT_NAME(haga), LOG_CONTEXT_PROPERTY(int32_t, x, 42));
@@ -891,9 +1059,8 @@ static void log_sink_console_log_with_non_NULL_named_contexts_with_2_levels_work
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
-    validate_log_line(expected_calls[actual_call_count - 1].printf_call.captured_output, "\x1b[90m%s Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s uaga = { haga = { x=42 } y=1 } %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
+    validate_log_line(expected_calls[actual_call_count - 1].printf_call.captured_output, "\x1b[90m%s Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s uaga = { haga = { x=42 } y=1 } %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
 }
 
 /* Tests_SRS_LOG_SINK_CONSOLE_01_013: [ If log_context is non-NULL: ]*/
@@ -904,15 +1071,15 @@ static void log_sink_console_log_with_non_NULL_empty_context_works(void)
 {
     // arrange
     setup_mocks();
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
 
     setup_log_context_property_to_string_call();
 
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_printf_call();
 
     LOG_CONTEXT_LOCAL_DEFINE(context_1, NULL);
@@ -923,9 +1090,8 @@ static void log_sink_console_log_with_non_NULL_empty_context_works(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
-    validate_log_line(expected_calls[actual_call_count - 1].printf_call.captured_output, "\x1b[90m%s Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s { } %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
+    validate_log_line(expected_calls[actual_call_count - 1].printf_call.captured_output, "\x1b[90m%s Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s { } %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
 }
 
 /* Tests_SRS_LOG_SINK_CONSOLE_01_013: [ If log_context is non-NULL: ]*/
@@ -936,15 +1102,15 @@ static void log_sink_console_log_with_non_NULL_dynamically_allocated_context(voi
 {
     // arrange
     setup_mocks();
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
 
     setup_log_context_property_to_string_call();
 
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_printf_call();
 
     LOG_CONTEXT_HANDLE context_1;
@@ -958,9 +1124,8 @@ static void log_sink_console_log_with_non_NULL_dynamically_allocated_context(voi
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
-    validate_log_line(expected_calls[actual_call_count - 1].printf_call.captured_output, "\x1b[90m%s Time:%%s %%s %%d %%d:%%d:%%d %%d File:%s:%d Func:%s { { x=42 } y=1 } %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
+    validate_log_line(expected_calls[actual_call_count - 1].printf_call.captured_output, "\x1b[90m%s Time:%%d-%%d-%%dT%%d:%%d:%%d.%%dZ File:%s:%d Func:%s { { x=42 } y=1 } %s%%s\r\n%%s", MU_ENUM_TO_STRING(LOG_LEVEL, LOG_LEVEL_VERBOSE), __FILE__, line_no, __FUNCTION__, "test");
 
     // cleanup
     LOG_CONTEXT_DESTROY(context_1);
@@ -972,8 +1137,8 @@ static void when_snprintf_fails_for_context_open_brace_log_sink_console_log_prin
 {
     // arrange
     setup_mocks();
-    setup_time_call();
-    setup_ctime_call();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
@@ -993,9 +1158,8 @@ static void when_snprintf_fails_for_context_open_brace_log_sink_console_log_prin
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
-    POOR_MANS_ASSERT(strcmp(expected_calls[actual_call_count - 1].printf_call.captured_output, "Error formatting log line\r\n") == 0);
+    POOR_MANS_ASSERT(strcmp(expected_calls[actual_call_count - 1].printf_call.captured_output, "Error formatting log line\x1b[0m\r\n") == 0);
 }
 
 /* Tests_SRS_LOG_SINK_CONSOLE_01_021: [ log_sink_console.log shall print at most LOG_MAX_MESSAGE_LENGTH characters including the null terminator (the rest of the context shall be truncated). ]*/
@@ -1003,13 +1167,13 @@ static void when_printing_the_message_exceeds_log_line_size_it_is_truncated(void
 {
     // arrange
     setup_mocks();
-    setup_time_call();
+    setup_log_timestamp_now_call();
     setup_snprintf_call();
-    setup_vsnprintf_call();
+    setup_log_vsnprintf_cached_call();
     setup_printf_call();
 
-    expected_calls[0].time_call.override_result = true;
-    expected_calls[0].time_call.call_result = (time_t)-1;
+    expected_calls[0].log_timestamp_now_call.override_result = true;
+    expected_calls[0].log_timestamp_now_call.call_result = LOG_TIMESTAMP_INVALID;
 
     char* message_string_too_big = malloc(LOG_MAX_MESSAGE_LENGTH);
     POOR_MANS_ASSERT(message_string_too_big != NULL);
@@ -1023,7 +1187,6 @@ static void when_printing_the_message_exceeds_log_line_size_it_is_truncated(void
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
 
     char expected_string[LOG_MAX_MESSAGE_LENGTH];
@@ -1042,12 +1205,12 @@ static void when_printing_the_file_exceeds_log_line_size_it_is_truncated(void)
 {
     // arrange
     setup_mocks();
-    setup_time_call();
+    setup_log_timestamp_now_call();
     setup_snprintf_call();
     setup_printf_call();
 
-    expected_calls[0].time_call.override_result = true;
-    expected_calls[0].time_call.call_result = (time_t)-1;
+    expected_calls[0].log_timestamp_now_call.override_result = true;
+    expected_calls[0].log_timestamp_now_call.call_result = LOG_TIMESTAMP_INVALID;
 
     char* file_too_big = malloc(LOG_MAX_MESSAGE_LENGTH);
     POOR_MANS_ASSERT(file_too_big != NULL);
@@ -1061,7 +1224,6 @@ static void when_printing_the_file_exceeds_log_line_size_it_is_truncated(void)
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
 
     char expected_string[LOG_MAX_MESSAGE_LENGTH];
@@ -1080,7 +1242,7 @@ static void when_printing_a_property_value_exceeds_log_line_size_it_is_truncated
 {
     // arrange
     setup_mocks();
-    setup_time_call();
+    setup_log_timestamp_now_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
@@ -1088,8 +1250,8 @@ static void when_printing_a_property_value_exceeds_log_line_size_it_is_truncated
     setup_log_context_property_to_string_call();
     setup_printf_call();
 
-    expected_calls[0].time_call.override_result = true;
-    expected_calls[0].time_call.call_result = (time_t)-1;
+    expected_calls[0].log_timestamp_now_call.override_result = true;
+    expected_calls[0].log_timestamp_now_call.call_result = LOG_TIMESTAMP_INVALID;
 
     char* string_property_value_too_big = malloc(LOG_MAX_MESSAGE_LENGTH);
     POOR_MANS_ASSERT(string_property_value_too_big != NULL);
@@ -1106,7 +1268,6 @@ static void when_printing_a_property_value_exceeds_log_line_size_it_is_truncated
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
 
     char expected_string[LOG_MAX_MESSAGE_LENGTH];
@@ -1126,7 +1287,7 @@ static void when_printing_a_property_name_exceeds_log_line_size_it_is_truncated(
 {
     // arrange
     setup_mocks();
-    setup_time_call();
+    setup_log_timestamp_now_call();
     setup_snprintf_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_log_context_get_property_value_pairs_call();
@@ -1134,8 +1295,8 @@ static void when_printing_a_property_name_exceeds_log_line_size_it_is_truncated(
     setup_log_context_property_to_string_call();
     setup_printf_call();
 
-    expected_calls[0].time_call.override_result = true;
-    expected_calls[0].time_call.call_result = (time_t)-1;
+    expected_calls[0].log_timestamp_now_call.override_result = true;
+    expected_calls[0].log_timestamp_now_call.call_result = LOG_TIMESTAMP_INVALID;
 
     char* dummy_file_name = malloc(LOG_MAX_MESSAGE_LENGTH);
     POOR_MANS_ASSERT(dummy_file_name != NULL);
@@ -1160,7 +1321,6 @@ static void when_printing_a_property_name_exceeds_log_line_size_it_is_truncated(
 
     // assert
     POOR_MANS_ASSERT(expected_call_count == actual_call_count);
-    POOR_MANS_ASSERT(expected_calls[0].time_call.captured__time == NULL);
     POOR_MANS_ASSERT(actual_and_expected_match);
 
     char expected_string[LOG_MAX_MESSAGE_LENGTH];
@@ -1175,6 +1335,311 @@ static void when_printing_a_property_name_exceeds_log_line_size_it_is_truncated(
     LOG_CONTEXT_DESTROY(context_1);
 }
 
+/* log_sink_console_set_layout */
+
+/* Tests_SRS_LOG_SINK_CONSOLE_01_031: [ Otherwise log_sink_console_set_layout shall compile pattern by calling log_layout_compile. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_032: [ If log_layout_compile fails, log_sink_console_set_layout shall fail and return a non-zero value (the layout in use is not changed). ]*/
+static void log_sink_console_set_layout_with_invalid_pattern_fails(void)
+{
+    // arrange
+    setup_mocks();
+    setup_printf_call();
+
+    // act
+    int result = log_sink_console_set_layout("%m %x");
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_SINK_CONSOLE_01_030: [ If pattern is NULL, log_sink_console_set_layout shall go back to the built-in line format and return 0. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_033: [ log_sink_console_set_layout shall store the compiled layout so that it is used by all future calls to log_sink_console.log and return 0. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_034: [ If a layout was set, log_sink_console.log shall format the line by calling log_layout_format with the layout instead of using the built-in line format. ]*/
+static void log_sink_console_log_with_layout_prints_the_layout_line(void)
+{
+    // arrange
+    char expected_line[LOG_MAX_MESSAGE_LENGTH];
+    const char* file_name = strrchr(__FILE__, '/');
+    if (file_name == NULL)
+    {
+        file_name = strrchr(__FILE__, '\\');
+    }
+    file_name = (file_name == NULL) ? __FILE__ : file_name + 1;
+
+    POOR_MANS_ASSERT(log_sink_console_set_layout("%v %f:%l %m") == 0);
+    setup_mocks();
+    setup_printf_call();
+
+    // act
+    int line_no = __LINE__;
+    test_log_sink_console_log(LOG_LEVEL_ERROR, NULL, __FILE__, __FUNCTION__, line_no, "test %d", 42);
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    (void)snprintf(expected_line, sizeof(expected_line), "\x1b[31mE %s:%d test 42\x1b[0m\r\n", file_name, line_no);
+    POOR_MANS_ASSERT(strcmp(expected_calls[0].printf_call.captured_output, expected_line) == 0);
+
+    // back to the built-in line
+    POOR_MANS_ASSERT(log_sink_console_set_layout(NULL) == 0);
+    setup_mocks();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
+    setup_snprintf_call();
+    setup_log_vsnprintf_cached_call();
+    setup_printf_call();
+    test_log_sink_console_log(LOG_LEVEL_ERROR, NULL, __FILE__, __FUNCTION__, line_no, "test");
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* log_sink_console_set_output */
+
+/* Tests_SRS_LOG_SINK_CONSOLE_01_039: [ If output is not LOG_SINK_CONSOLE_OUTPUT_PRINTF or LOG_SINK_CONSOLE_OUTPUT_DIRECT, log_sink_console_set_output shall fail and return a non-zero value. ]*/
+static void log_sink_console_set_output_with_invalid_output_fails(void)
+{
+    // arrange
+    setup_mocks();
+    setup_printf_call();
+
+    // act
+    int result = log_sink_console_set_output((LOG_SINK_CONSOLE_OUTPUT)42);
+
+    // assert
+    POOR_MANS_ASSERT(result != 0);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+#ifndef _WIN32
+static void set_direct_output(int isatty_result)
+{
+    POOR_MANS_ASSERT(log_sink_console_set_layout("%v %m") == 0);
+    setup_mocks();
+    setup_isatty_call(isatty_result);
+    POOR_MANS_ASSERT(log_sink_console_set_output(LOG_SINK_CONSOLE_OUTPUT_DIRECT) == 0);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+static void set_printf_output(void)
+{
+    setup_mocks();
+    POOR_MANS_ASSERT(log_sink_console_set_output(LOG_SINK_CONSOLE_OUTPUT_PRINTF) == 0);
+    POOR_MANS_ASSERT(log_sink_console_set_layout(NULL) == 0);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+}
+
+/* Tests_SRS_LOG_SINK_CONSOLE_01_049: [ The first time output is LOG_SINK_CONSOLE_OUTPUT_DIRECT, log_sink_console_set_output shall register log_sink_console_flush with atexit, so that the batched lines are written when the process exits. ]*/
+static void log_sink_console_set_output_with_direct_output_registers_the_flush_at_exit_once(void)
+{
+    // arrange
+    setup_mocks();
+    setup_isatty_call(0);
+    setup_atexit_call();
+    setup_isatty_call(0);
+
+    // act
+    int result_1 = log_sink_console_set_output(LOG_SINK_CONSOLE_OUTPUT_DIRECT);
+    int result_2 = log_sink_console_set_output(LOG_SINK_CONSOLE_OUTPUT_DIRECT);
+
+    // assert
+    POOR_MANS_ASSERT(result_1 == 0);
+    POOR_MANS_ASSERT(result_2 == 0);
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[1].atexit_call.captured_function == log_sink_console_flush);
+
+    // cleanup
+    set_printf_output();
+}
+
+/* Tests_SRS_LOG_SINK_CONSOLE_01_022: [ If any encoding error occurs during formatting of the line (i.e. if any printf class functions fails), log_sink_console.log shall print Error formatting log line and return. ]*/
+static void when_formatting_fails_with_direct_output_log_sink_console_log_batches_the_error_line(void)
+{
+    // arrange
+    set_direct_output(0);
+    POOR_MANS_ASSERT(log_sink_console_set_layout(NULL) == 0);
+    setup_mocks();
+    setup_log_timestamp_now_call();
+    setup_timestamp_microseconds_to_string_call();
+    setup_snprintf_call();
+    expected_calls[2].snprintf_call.override_result = true;
+    expected_calls[2].snprintf_call.call_result = -1;
+
+    // act
+    test_log_sink_console_log(LOG_LEVEL_INFO, NULL, __FILE__, __FUNCTION__, __LINE__, "a");
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    setup_write_call();
+    log_sink_console_flush();
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(strcmp(expected_calls[3].write_call.captured_output, "Error formatting log line\r\n") == 0);
+
+    // cleanup
+    set_printf_output();
+}
+
+/* Tests_SRS_LOG_SINK_CONSOLE_01_040: [ log_sink_console_set_output shall write the batched lines by calling log_sink_console_flush and flush stdout. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_041: [ If output is LOG_SINK_CONSOLE_OUTPUT_DIRECT, log_sink_console_set_output shall call isatty for stdout to determine whether the lines are colored. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_042: [ log_sink_console_set_output shall store output so that it is used by all future calls to log_sink_console.log and return 0. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_043: [ If stdout is a terminal, log_sink_console.log shall write the line with its colors with one call to write. ]*/
+static void log_sink_console_log_with_direct_output_to_a_terminal_writes_the_line(void)
+{
+    // arrange
+    set_direct_output(1);
+    setup_mocks();
+    setup_write_call();
+
+    // act
+    test_log_sink_console_log(LOG_LEVEL_WARNING, NULL, __FILE__, __FUNCTION__, __LINE__, "test %d", 42);
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[0].write_call.captured_fd == STDOUT_FILENO);
+    POOR_MANS_ASSERT(strcmp(expected_calls[0].write_call.captured_output, "\x1b[33mW test 42\x1b[0m\r\n") == 0);
+    POOR_MANS_ASSERT(expected_calls[0].write_call.captured_count == strlen("\x1b[33mW test 42\x1b[0m\r\n"));
+
+    // cleanup
+    set_printf_output();
+}
+
+/* Tests_SRS_LOG_SINK_CONSOLE_01_044: [ Otherwise log_sink_console.log shall add the line to a batch of LOG_SINK_CONSOLE_BATCH_SIZE bytes. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_047: [ If there are batched lines, log_sink_console_flush shall write them with one call to write. ]*/
+/* Tests_SRS_LOG_SINK_CONSOLE_01_048: [ If the output is LOG_SINK_CONSOLE_OUTPUT_DIRECT and stdout is not a terminal, log_sink_console.log shall not write the color codes. ]*/
+static void log_sink_console_log_with_direct_output_not_to_a_terminal_batches_the_lines(void)
+{
+    // arrange
+    set_direct_output(0);
+    setup_mocks();
+
+    // act
+    test_log_sink_console_log(LOG_LEVEL_INFO, NULL, __FILE__, __FUNCTION__, __LINE__, "a");
+    test_log_sink_console_log(LOG_LEVEL_WARNING, NULL, __FILE__, __FUNCTION__, __LINE__, "b");
+
+    // assert
+    POOR_MANS_ASSERT(actual_call_count == 0);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    setup_write_call();
+    log_sink_console_flush();
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(strcmp(expected_calls[0].write_call.captured_output, "I a\r\nW b\r\n") == 0);
+
+    // cleanup
+    set_printf_output();
+}
+
+/* Tests_SRS_LOG_SINK_CONSOLE_01_046: [ If log_level is LOG_LEVEL_ERROR or LOG_LEVEL_CRITICAL, or the first line of the batch was added at least LOG_SINK_CONSOLE_BATCH_TIME_NS ago, log_sink_console.log shall write the batch with one call to write. ]*/
+static void log_sink_console_log_with_direct_output_writes_the_batch_with_an_error_line(void)
+{
+    // arrange
+    set_direct_output(0);
+    setup_mocks();
+    test_log_sink_console_log(LOG_LEVEL_INFO, NULL, __FILE__, __FUNCTION__, __LINE__, "a");
+    setup_write_call();
+
+    // act
+    test_log_sink_console_log(LOG_LEVEL_ERROR, NULL, __FILE__, __FUNCTION__, __LINE__, "b");
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(strcmp(expected_calls[0].write_call.captured_output, "I a\r\nE b\r\n") == 0);
+
+    // cleanup
+    set_printf_output();
+}
+
+/* Tests_SRS_LOG_SINK_CONSOLE_01_046: [ If log_level is LOG_LEVEL_ERROR or LOG_LEVEL_CRITICAL, or the first line of the batch was added at least LOG_SINK_CONSOLE_BATCH_TIME_NS ago, log_sink_console.log shall write the batch with one call to write. ]*/
+static void log_sink_console_log_with_direct_output_writes_the_batch_after_the_batch_time(void)
+{
+    // arrange
+    struct timespec start;
+    struct timespec now;
+    set_direct_output(0);
+    setup_mocks();
+    test_log_sink_console_log(LOG_LEVEL_INFO, NULL, __FILE__, __FUNCTION__, __LINE__, "a");
+    POOR_MANS_ASSERT(timespec_get(&start, TIME_UTC) == TIME_UTC);
+    do
+    {
+        POOR_MANS_ASSERT(timespec_get(&now, TIME_UTC) == TIME_UTC);
+    } while (((int64_t)(now.tv_sec - start.tv_sec) * 1000000000 + (now.tv_nsec - start.tv_nsec)) < LOG_SINK_CONSOLE_BATCH_TIME_NS * 2);
+    setup_write_call();
+
+    // act
+    test_log_sink_console_log(LOG_LEVEL_INFO, NULL, __FILE__, __FUNCTION__, __LINE__, "b");
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(strcmp(expected_calls[0].write_call.captured_output, "I a\r\nI b\r\n") == 0);
+
+    // cleanup
+    set_printf_output();
+}
+
+/* Tests_SRS_LOG_SINK_CONSOLE_01_045: [ If the line does not fit in the batch, log_sink_console.log shall write the batched lines and the line with one call to writev. ]*/
+static void log_sink_console_log_with_direct_output_writes_a_line_that_does_not_fit_with_the_batch(void)
+{
+    // arrange
+    char message[4001];
+    (void)memset(message, 'x', sizeof(message) - 1);
+    message[sizeof(message) - 1] = '\0';
+    size_t line_length = strlen("I ") + strlen(message) + strlen("\r\n");
+    size_t line_count = LOG_SINK_CONSOLE_BATCH_SIZE / line_length;
+    set_direct_output(0);
+    setup_mocks();
+    for (size_t i = 0; i < line_count; i++)
+    {
+        test_log_sink_console_log(LOG_LEVEL_INFO, NULL, __FILE__, __FUNCTION__, __LINE__, "%s", message);
+    }
+    POOR_MANS_ASSERT(actual_call_count == 0);
+    setup_writev_call();
+
+    // act
+    test_log_sink_console_log(LOG_LEVEL_INFO, NULL, __FILE__, __FUNCTION__, __LINE__, "%s", message);
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(expected_calls[0].writev_call.captured_iovcnt == 2);
+    POOR_MANS_ASSERT(expected_calls[0].writev_call.captured_lengths[0] == line_count * line_length);
+    POOR_MANS_ASSERT(expected_calls[0].writev_call.captured_lengths[1] == line_length);
+
+    // cleanup
+    set_printf_output();
+}
+
+/* Tests_SRS_LOG_SINK_CONSOLE_01_028: [ log_sink_console.deinit shall write the batched lines by calling log_sink_console_flush. ] */
+static void log_sink_console_deinit_writes_the_batched_lines(void)
+{
+    // arrange
+    set_direct_output(0);
+    setup_mocks();
+    test_log_sink_console_log(LOG_LEVEL_VERBOSE, NULL, __FILE__, __FUNCTION__, __LINE__, "a");
+    setup_write_call();
+
+    // act
+    log_sink_console.deinit();
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+    POOR_MANS_ASSERT(strcmp(expected_calls[0].write_call.captured_output, "V a\r\n") == 0);
+
+    // cleanup
+    set_printf_output();
+}
+#endif
+
 /* very "poor man's" way of testing, as no test harness and mocking framework are available */
 int main(void)
 {
@@ -1186,9 +1651,9 @@ int main(void)
     log_sink_console_log_prints_one_VERBOSE_log_line();
 
     when_snprintf_fails_log_sink_console_log_prints_error_formatting();
-    when_vsnprintf_fails_log_sink_console_log_prints_error_formatting();
-    when_time_fails_log_sink_console_log_prints_time_as_NULL();
-    when_ctime_returns_NULL_log_sink_console_log_prints_time_as_NULL();
+    when_log_vsnprintf_cached_fails_log_sink_console_log_prints_error_formatting();
+    when_log_timestamp_now_fails_log_sink_console_log_prints_time_as_NULL();
+    when_timestamp_microseconds_to_string_fails_log_sink_console_log_prints_time_as_NULL();
 
     log_sink_console_log_with_non_NULL_context_prints_one_property();
     log_sink_console_log_with_non_NULL_context_prints_2_properties();
@@ -1207,5 +1672,20 @@ int main(void)
     when_printing_a_property_value_exceeds_log_line_size_it_is_truncated();
     when_printing_a_property_name_exceeds_log_line_size_it_is_truncated();
 
+    log_sink_console_set_layout_with_invalid_pattern_fails();
+    log_sink_console_log_with_layout_prints_the_layout_line();
+
+    log_sink_console_set_output_with_invalid_output_fails();
+#ifndef _WIN32
+    log_sink_console_set_output_with_direct_output_registers_the_flush_at_exit_once();
+    log_sink_console_log_with_direct_output_to_a_terminal_writes_the_line();
+    log_sink_console_log_with_direct_output_not_to_a_terminal_batches_the_lines();
+    log_sink_console_log_with_direct_output_writes_the_batch_with_an_error_line();
+    log_sink_console_log_with_direct_output_writes_the_batch_after_the_batch_time();
+    log_sink_console_log_with_direct_output_writes_a_line_that_does_not_fit_with_the_batch();
+    log_sink_console_deinit_writes_the_batched_lines();
+    when_formatting_fails_with_direct_output_log_sink_console_log_batches_the_error_line();
+#endif
+
     return 0;
 }
@@ -38,7 +38,7 @@
     MOCK_CALL_TYPE_EventDataDescCreate, \
     MOCK_CALL_TYPE__tlgWriteTransfer_EventWriteTransfer, \
     MOCK_CALL_TYPE_log_context_property_if_get_type, \
-    MOCK_CALL_TYPE_vsnprintf, \
+    MOCK_CALL_TYPE_log_vsnprintf_cached, \
     MOCK_CALL_TYPE_TraceLoggingUnregister
 
 MU_DEFINE_ENUM(MOCK_CALL_TYPE, MOCK_CALL_TYPE_VALUES)
@@ -118,12 +118,12 @@ typedef struct log_context_property_if_get_type_CALL_TAG
     LOG_CONTEXT_PROPERTY_TYPE call_result;
 } log_context_property_if_get_type_CALL;
 
-typedef struct vsnprintf_CALL_TAG
+typedef struct log_vsnprintf_cached_CALL_TAG
 {
     bool override_result;
     int call_result;
     char captured_output[MAX_PRINTF_CAPTURED_OUPUT_SIZE];
-} vsnprintf_CALL;
+} log_vsnprintf_cached_CALL;
 
 typedef struct TraceLoggingUnregister_CALL_TAG
 {
@@ -142,7 +142,7 @@ typedef struct MOCK_CALL_TAG
         GetModuleFileNameA_CALL GetModuleFileNameA_call;
         _tlgWriteTransfer_EventWriteTransfer_CALL _tlgWriteTransfer_EventWriteTransfer_call;
         log_context_property_if_get_type_CALL log_context_property_if_get_type_call;
-        vsnprintf_CALL vsnprintf_call;
+        log_vsnprintf_cached_CALL log_vsnprintf_cached_call;
         TraceLoggingUnregister_CALL TraceLoggingUnregister_call;
     };
 } MOCK_CALL;
@@ -525,12 +525,12 @@ LOG_CONTEXT_PROPERTY_TYPE mock_log_context_property_if_get_type(void)
     return result;
 }
 
-int mock_vsnprintf(char* restrict s, size_t n, const char* restrict format, va_list args)
+int mock_log_vsnprintf_cached(char* restrict s, size_t n, const char* restrict format, va_list args)
 {
     int result;
 
     if ((actual_call_count == expected_call_count) ||
-        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_vsnprintf))
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_log_vsnprintf_cached))
     {
         actual_and_expected_match = false;
         result = -1;
@@ -25,7 +25,7 @@
 #define _tlgCreate1Sz_wchar_t mock__tlgCreate1Sz_wchar_t
 #define EventDataDescCreate mock_EventDataDescCreate
 #define _tlgWriteTransfer_EventWriteTransfer mock__tlgWriteTransfer_EventWriteTransfer
-#define vsnprintf mock_vsnprintf
+#define log_vsnprintf_cached mock_log_vsnprintf_cached
 #undef TraceLoggingUnregister
 #define TraceLoggingUnregister mock_TraceLoggingUnregister
 
@@ -38,7 +38,7 @@ void mock__tlgCreate1Sz_char(PEVENT_DATA_DESCRIPTOR pDesc, char const* psz);
 void mock__tlgCreate1Sz_wchar_t(PEVENT_DATA_DESCRIPTOR pDesc, wchar_t const* psz);
 void mock_EventDataDescCreate(PEVENT_DATA_DESCRIPTOR EventDataDescriptor, const VOID* DataPtr, ULONG DataSize);
 TLG_STATUS mock__tlgWriteTransfer_EventWriteTransfer(TraceLoggingHProvider hProvider, void const* pEventMetadata, LPCGUID pActivityId, LPCGUID pRelatedActivityId, UINT32 cData, EVENT_DATA_DESCRIPTOR* pData);
-int mock_vsnprintf(char* s, size_t n, const char* format, va_list arg);
+int mock_log_vsnprintf_cached(char* s, size_t n, const char* format, va_list arg);
 void mock_TraceLoggingUnregister(TraceLoggingHProvider hProvider);
 
 #include "log_sink_etw.c"
@@ -3,6 +3,7 @@
 
 #include <stdio.h>
 #include <stdint.h>
+#include <stddef.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdlib.h>
@@ -19,6 +20,8 @@
 #include "c_logging/log_context_property_basic_types.h"
 #include "c_logging/log_context_property_bool_type.h"
 #include "c_logging/log_context_property_type_ascii_char_ptr.h"
+#include "c_logging/log_context_property_type_borrowed_ascii_char_ptr.h"
+#include "c_logging/log_context_property_type_binary.h"
 #include "c_logging/log_context_property_type_wchar_t_ptr.h"
 #include "c_logging/log_context_property_value_pair.h"
 #include "c_logging/log_level.h"
@@ -46,13 +49,21 @@
     MOCK_CALL_TYPE_EventDataDescCreate, \
     MOCK_CALL_TYPE__tlgWriteTransfer_EventWriteTransfer, \
     MOCK_CALL_TYPE_log_context_property_if_get_type, \
-    MOCK_CALL_TYPE_vsnprintf, \
+    MOCK_CALL_TYPE_log_vsnprintf_cached, \
     MOCK_CALL_TYPE_TraceLoggingUnregister
 
 MU_DEFINE_ENUM(MOCK_CALL_TYPE, MOCK_CALL_TYPE_VALUES)
 
 MU_DEFINE_ENUM_STRINGS(LOG_CONTEXT_PROPERTY_TYPE, LOG_CONTEXT_PROPERTY_TYPE_VALUES)
 
+#define TEST_STATE_VALUES \
+    TEST_STATE_STOPPED, \
+    TEST_STATE_RUNNING
+
+MU_DEFINE_ENUM(TEST_STATE, TEST_STATE_VALUES)
+MU_DEFINE_ENUM_STRINGS(TEST_STATE, TEST_STATE_VALUES)
+LOG_CONTEXT_PROPERTY_ENUM_TYPE_DEFINE(TEST_STATE)
+
 // very poor mans mocks :-(
 
 #define MAX_PRINTF_CAPTURED_OUPUT_SIZE (LOG_MAX_MESSAGE_LENGTH * 2)
@@ -123,12 +134,12 @@ typedef struct log_context_property_if_get_type_CALL_TAG
     LOG_CONTEXT_PROPERTY_TYPE call_result;
 } log_context_property_if_get_type_CALL;
 
-typedef struct vsnprintf_CALL_TAG
+typedef struct log_vsnprintf_cached_CALL_TAG
 {
     bool override_result;
     int call_result;
     char captured_output[MAX_PRINTF_CAPTURED_OUPUT_SIZE];
-} vsnprintf_CALL;
+} log_vsnprintf_cached_CALL;
 
 typedef struct TraceLoggingUnregister_CALL_TAG
 {
@@ -147,7 +158,7 @@ typedef struct MOCK_CALL_TAG
         GetModuleFileNameA_CALL GetModuleFileNameA_call;
         _tlgWriteTransfer_EventWriteTransfer_CALL _tlgWriteTransfer_EventWriteTransfer_call;
         log_context_property_if_get_type_CALL log_context_property_if_get_type_call;
-        vsnprintf_CALL vsnprintf_call;
+        log_vsnprintf_cached_CALL log_vsnprintf_cached_call;
         TraceLoggingUnregister_CALL TraceLoggingUnregister_call;
     };
 } MOCK_CALL;
@@ -561,12 +572,12 @@ LOG_CONTEXT_PROPERTY_TYPE mock_log_context_property_if_get_type(void)
     return result;
 }
 
-int mock_vsnprintf(char* restrict s, size_t n, const char* restrict format, va_list args)
+int mock_log_vsnprintf_cached(char* restrict s, size_t n, const char* restrict format, va_list args)
 {
     int result;
 
     if ((actual_call_count == expected_call_count) ||
-        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_vsnprintf))
+        (expected_calls[actual_call_count].mock_call_type != MOCK_CALL_TYPE_log_vsnprintf_cached))
     {
         actual_and_expected_match = false;
         result = -1;
@@ -707,10 +718,10 @@ static void setup_log_context_property_if_get_type(void)
     expected_call_count++;
 }
 
-static void setup_vsnprintf_call(void)
+static void setup_log_vsnprintf_cached_call(void)
 {
-    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_vsnprintf;
-    expected_calls[expected_call_count].vsnprintf_call.override_result = false;
+    expected_calls[expected_call_count].mock_call_type = MOCK_CALL_TYPE_log_vsnprintf_cached;
+    expected_calls[expected_call_count].log_vsnprintf_cached_call.override_result = false;
     expected_call_count++;
 }
 
@@ -763,7 +774,7 @@ static void log_sink_etw_init_works(void)
     // self test event
     setup_GetModuleFileNameA_call();
 
-    setup_vsnprintf_call(); // formatting message
+    setup_log_vsnprintf_cached_call(); // formatting message
     setup__tlgCreate1Sz_char(); // message
     setup__tlgCreate1Sz_char(); // file
     setup__tlgCreate1Sz_char(); // func
@@ -893,7 +904,7 @@ static void test_message_with_level(LOG_LEVEL log_level, uint8_t expected_tlg_le
     setup_enabled_provider(TRACE_LEVEL_VERBOSE);
 
     setup_mocks();
-    setup_vsnprintf_call(); // formatting message
+    setup_log_vsnprintf_cached_call(); // formatting message
     setup__tlgCreate1Sz_char(); // message
     setup__tlgCreate1Sz_char(); // file
     setup__tlgCreate1Sz_char(); // func
@@ -955,6 +966,7 @@ static void test_message_with_level(LOG_LEVEL log_level, uint8_t expected_tlg_le
     POOR_MANS_ASSERT(actual_and_expected_match);
 }
 
+/* Tests_SRS_LOG_SINK_ETW_01_120: [ log_sink_etw.log shall format the message by calling log_vsnprintf_cached. ]*/
 /* Tests_SRS_LOG_SINK_ETW_01_012: [ If log_level is LOG_LEVEL_CRITICAL the event name shall be LogCritical. ]*/
 /* Tests_SRS_LOG_SINK_ETW_01_018: [ Logging level: ]*/
 /* Tests_SRS_LOG_SINK_ETW_01_019: [ If log_level is LOG_LEVEL_CRITICAL the ETW logging level shall be TRACE_LEVEL_CRITICAL. ]*/
@@ -1008,7 +1020,7 @@ static void log_sink_etw_log_with_unknown_LOG_LEVEL_succeeds(void)
     setup_enabled_provider(TRACE_LEVEL_VERBOSE);                                                                                     \
                                                                                                                                      \
     setup_mocks();                                                                                                                   \
-    setup_vsnprintf_call(); /* formatting message */                                                                                 \
+    setup_log_vsnprintf_cached_call(); /* formatting message */                                                                                 \
     setup__tlgCreate1Sz_char(); /* message */                                                                                        \
     setup__tlgCreate1Sz_char(); /* file */                                                                                           \
     setup__tlgCreate1Sz_char(); /* func */                                                                                           \
@@ -1090,7 +1102,7 @@ static void test_message_with_context(LOG_LEVEL log_level, uint8_t expected_tlg_
     setup_mocks();
     setup_log_context_get_property_value_pairs_call();
     setup_log_context_get_property_value_pair_count_call();
-    setup_vsnprintf_call(); // formatting message
+    setup_log_vsnprintf_cached_call(); // formatting message
     setup__tlgCreate1Sz_char(); // message
     setup__tlgCreate1Sz_char(); // file
     setup__tlgCreate1Sz_char(); // func
@@ -1192,7 +1204,7 @@ static void test_message_with_context_with_one_property(LOG_LEVEL log_level, uin
     setup_mocks();
     setup_log_context_get_property_value_pairs_call();
     setup_log_context_get_property_value_pair_count_call();
-    setup_vsnprintf_call(); // formatting message
+    setup_log_vsnprintf_cached_call(); // formatting message
     setup__tlgCreate1Sz_char(); // message
     setup__tlgCreate1Sz_char(); // file
     setup__tlgCreate1Sz_char(); // func
@@ -1312,6 +1324,93 @@ static void test_message_with_context_with_one_property(LOG_LEVEL log_level, uin
             *pos = TlgInUINT8;
             break;
         }
+        case LOG_CONTEXT_PROPERTY_TYPE_float:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInFLOAT;
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_double:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInDOUBLE;
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInANSISTRING;
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_binary:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInBINARY;
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary:
+        {
+            setup_EventDataDescCreate(); // byte count
+            setup_EventDataDescCreate(); // bytes
+            *pos = TlgInBINARY;
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_log_uuid_t:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInGUID;
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_log_ipv4_address_t:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInUINT32 | _TlgInChain;
+            pos++;
+            *pos = TlgOutIPV4;
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_log_ipv6_address_t:
+        {
+            setup_EventDataDescCreate(); // byte count
+            setup_EventDataDescCreate(); // bytes
+            *pos = TlgInBINARY | _TlgInChain;
+            pos++;
+            *pos = TlgOutIPV6;
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_log_socket_address_t:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInBINARY | _TlgInChain;
+            pos++;
+            *pos = TlgOutSOCKETADDRESS;
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_enum:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInINT32;
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_log_timestamp_t:
+        case LOG_CONTEXT_PROPERTY_TYPE_log_duration_t:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInINT64;
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_int32_t_array:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInINT32 | TlgInVcount;
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_uint8_t_array:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInUINT8 | TlgInVcount;
+            break;
+        }
     }
     pos++;
 
@@ -1319,8 +1418,13 @@ static void test_message_with_context_with_one_property(LOG_LEVEL log_level, uin
 
     int captured_line = __LINE__;
 
+    // borrowed strings are passed to ETW straight from the memory they are borrowed from
+    const void* expected_property_ptr = (log_context_property_value_pairs[1].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr) ?
+        (const void*)((const BORROWED_ASCII_CHAR_PTR*)log_context_property_value_pairs[1].value)->value :
+        log_context_property_value_pairs[1].value;
+
     // construct event data descriptor array
-    EVENT_DATA_DESCRIPTOR expected_event_data_descriptors[7] =
+    EVENT_DATA_DESCRIPTOR expected_event_data_descriptors[8] =
     {
         { 0 },
         { 0 },
@@ -1328,10 +1432,35 @@ static void test_message_with_context_with_one_property(LOG_LEVEL log_level, uin
         {.Size = (ULONG)strlen(__FILE__) + 1, .Ptr = (ULONGLONG)__FILE__ },
         {.Size = (ULONG)strlen(__FUNCTION__) + 1, .Ptr = (ULONGLONG)__FUNCTION__ },
         {.Size = sizeof(int32_t), .Ptr = (ULONGLONG)&captured_line},
-        {.Size = expected_property_size, .Ptr = (ULONGLONG)log_context_property_value_pairs[1].value}
+        {.Size = expected_property_size, .Ptr = (ULONGLONG)expected_property_ptr},
+        { 0 }
     };
+    uint32_t expected_event_data_descriptor_count = 7;
+
+    // borrowed binary values are passed as the byte count stored in the context followed by the borrowed bytes
+    if (log_context_property_value_pairs[1].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary)
+    {
+        BORROWED_BINARY borrowed;
+        (void)memcpy(&borrowed, log_context_property_value_pairs[1].value, sizeof(BORROWED_BINARY));
+        expected_event_data_descriptors[6].Size = sizeof(uint16_t);
+        expected_event_data_descriptors[6].Ptr = (ULONGLONG)((const uint8_t*)log_context_property_value_pairs[1].value + offsetof(BORROWED_BINARY, length));
+        expected_event_data_descriptors[7].Size = expected_property_size;
+        expected_event_data_descriptors[7].Ptr = (ULONGLONG)borrowed.data;
+        expected_event_data_descriptor_count = 8;
+    }
+
+    // IPv6 addresses are passed as a byte count of 16 followed by the address bytes
+    uint16_t ipv6_address_length = 16;
+    if (log_context_property_value_pairs[1].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_log_ipv6_address_t)
+    {
+        expected_event_data_descriptors[6].Size = sizeof(uint16_t);
+        expected_event_data_descriptors[6].Ptr = (ULONGLONG)&ipv6_address_length;
+        expected_event_data_descriptors[7].Size = expected_property_size;
+        expected_event_data_descriptors[7].Ptr = (ULONGLONG)log_context_property_value_pairs[1].value;
+        expected_event_data_descriptor_count = 8;
+    }
 
-    setup__tlgWriteTransfer_EventWriteTransfer(expected_event_metadata, 7, expected_event_data_descriptors);
+    setup__tlgWriteTransfer_EventWriteTransfer(expected_event_metadata, expected_event_data_descriptor_count, expected_event_data_descriptors);
 
     // act
     test_log_sink_etw_log(log_level, log_context, __FILE__, __FUNCTION__, captured_line, "test");
@@ -1511,6 +1640,253 @@ static void log_sink_etw_log_with_context_with_one_uint8_t_property_succeeds(voi
     LOG_CONTEXT_DESTROY(log_context);
 }
 
+/* Tests_SRS_LOG_SINK_ETW_01_095: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_float, a byte with the value TlgInFLOAT shall be added in the metadata. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_096: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_float, the event data descriptor shall be filled with the value of the property by calling EventDataDescCreate. ]*/
+static void log_sink_etw_log_with_context_with_one_float_property_succeeds(void)
+{
+    LOG_CONTEXT_HANDLE log_context;
+
+    LOG_CONTEXT_CREATE(log_context, NULL,
+        LOG_CONTEXT_PROPERTY(float, gigi, 4.2f)
+    );
+
+    test_message_with_context_with_one_property(LOG_LEVEL_VERBOSE, TRACE_LEVEL_VERBOSE, "LogVerbose", log_context, "",
+        sizeof(float) // expected property value size
+    );
+
+    LOG_CONTEXT_DESTROY(log_context);
+}
+
+/* Tests_SRS_LOG_SINK_ETW_01_097: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_double, a byte with the value TlgInDOUBLE shall be added in the metadata. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_098: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_double, the event data descriptor shall be filled with the value of the property by calling EventDataDescCreate. ]*/
+static void log_sink_etw_log_with_context_with_one_double_property_succeeds(void)
+{
+    LOG_CONTEXT_HANDLE log_context;
+
+    LOG_CONTEXT_CREATE(log_context, NULL,
+        LOG_CONTEXT_PROPERTY(double, gigi, 4.2)
+    );
+
+    test_message_with_context_with_one_property(LOG_LEVEL_VERBOSE, TRACE_LEVEL_VERBOSE, "LogVerbose", log_context, "",
+        sizeof(double) // expected property value size
+    );
+
+    LOG_CONTEXT_DESTROY(log_context);
+}
+
+/* Tests_SRS_LOG_SINK_ETW_01_099: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr, a byte with the value TlgInANSISTRING shall be added in the metadata. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_100: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_borrowed_ascii_char_ptr, the event data descriptor shall be filled by calling EventDataDescCreate with the borrowed string and its stored length plus the null terminator. ]*/
+static void log_sink_etw_log_with_context_with_one_borrowed_string_property_succeeds(void)
+{
+    LOG_CONTEXT_LOCAL_DEFINE(log_context, NULL,
+        LOG_CONTEXT_BORROWED_STRING_PROPERTY(gigi, "duru")
+    );
+
+    test_message_with_context_with_one_property(LOG_LEVEL_VERBOSE, TRACE_LEVEL_VERBOSE, "LogVerbose", &log_context, "",
+        5 // expected property value size
+    );
+}
+
+/* Tests_SRS_LOG_SINK_ETW_01_101: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_binary, a byte with the value TlgInBINARY shall be added in the metadata. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_103: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_binary, the event data descriptor shall be filled by calling EventDataDescCreate with the value of the property (the byte count followed by the bytes). ]*/
+static void log_sink_etw_log_with_context_with_one_binary_property_succeeds(void)
+{
+    LOG_CONTEXT_HANDLE log_context;
+    const uint8_t test_bytes[] = { 0x00, 0x42, 0xFF };
+
+    LOG_CONTEXT_CREATE(log_context, NULL,
+        LOG_CONTEXT_BINARY_PROPERTY(gigi, test_bytes, sizeof(test_bytes))
+    );
+
+    test_message_with_context_with_one_property(LOG_LEVEL_VERBOSE, TRACE_LEVEL_VERBOSE, "LogVerbose", log_context, "",
+        sizeof(uint16_t) + sizeof(test_bytes) // expected property value size
+    );
+
+    LOG_CONTEXT_DESTROY(log_context);
+}
+
+/* Tests_SRS_LOG_SINK_ETW_01_039: [ log_sink_etw.log shall fill an EVENT_DATA_DESCRIPTOR array of size 2 + 1 + 1 + 1 + 1 + 2 * property count. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_102: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary, a byte with the value TlgInBINARY shall be added in the metadata. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_104: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_borrowed_binary, 2 event data descriptors shall be filled by calling EventDataDescCreate: one with the byte count and one with the borrowed bytes. ]*/
+static void log_sink_etw_log_with_context_with_one_borrowed_binary_property_succeeds(void)
+{
+    const uint8_t test_bytes[] = { 0x00, 0x42, 0xFF };
+
+    LOG_CONTEXT_LOCAL_DEFINE(log_context, NULL,
+        LOG_CONTEXT_BORROWED_BINARY_PROPERTY(gigi, test_bytes, sizeof(test_bytes))
+    );
+
+    test_message_with_context_with_one_property(LOG_LEVEL_VERBOSE, TRACE_LEVEL_VERBOSE, "LogVerbose", &log_context, "",
+        sizeof(test_bytes) // expected size of the bytes
+    );
+}
+
+/* Tests_SRS_LOG_SINK_ETW_01_105: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_uuid_t, a byte with the value TlgInGUID shall be added in the metadata. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_110: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_uuid_t, the event data descriptor shall be filled with the 16 bytes of the property (GUID layout) by calling EventDataDescCreate. ]*/
+static void log_sink_etw_log_with_context_with_one_uuid_property_succeeds(void)
+{
+    LOG_CONTEXT_HANDLE log_context;
+    const uint8_t test_uuid[16] = { 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF, 0xFE, 0xDC, 0xBA, 0x98, 0x76, 0x54, 0x32, 0x10 };
+
+    LOG_CONTEXT_CREATE(log_context, NULL,
+        LOG_CONTEXT_PROPERTY(log_uuid_t, gigi, test_uuid)
+    );
+
+    test_message_with_context_with_one_property(LOG_LEVEL_VERBOSE, TRACE_LEVEL_VERBOSE, "LogVerbose", log_context, "",
+        sizeof(log_uuid_t) // expected property value size
+    );
+
+    LOG_CONTEXT_DESTROY(log_context);
+}
+
+/* Tests_SRS_LOG_SINK_ETW_01_106: [ For IP address and socket address properties one extra byte shall be added for the out type. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_107: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_ipv4_address_t, a byte with the value TlgInUINT32 | _TlgInChain followed by a byte with the value TlgOutIPV4 shall be added in the metadata. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_111: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_ipv4_address_t, the event data descriptor shall be filled with the 4 bytes of the address by calling EventDataDescCreate. ]*/
+static void log_sink_etw_log_with_context_with_one_ipv4_address_property_succeeds(void)
+{
+    LOG_CONTEXT_HANDLE log_context;
+    const uint8_t test_address[4] = { 192, 168, 1, 42 };
+
+    LOG_CONTEXT_CREATE(log_context, NULL,
+        LOG_CONTEXT_PROPERTY(log_ipv4_address_t, gigi, test_address)
+    );
+
+    test_message_with_context_with_one_property(LOG_LEVEL_VERBOSE, TRACE_LEVEL_VERBOSE, "LogVerbose", log_context, "",
+        sizeof(log_ipv4_address_t) // expected property value size
+    );
+
+    LOG_CONTEXT_DESTROY(log_context);
+}
+
+/* Tests_SRS_LOG_SINK_ETW_01_039: [ log_sink_etw.log shall fill an EVENT_DATA_DESCRIPTOR array of size 2 + 1 + 1 + 1 + 1 + 2 * property count. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_106: [ For IP address and socket address properties one extra byte shall be added for the out type. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_108: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_ipv6_address_t, a byte with the value TlgInBINARY | _TlgInChain followed by a byte with the value TlgOutIPV6 shall be added in the metadata. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_112: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_ipv6_address_t, 2 event data descriptors shall be filled by calling EventDataDescCreate: one with the byte count (16) and one with the 16 bytes of the address. ]*/
+static void log_sink_etw_log_with_context_with_one_ipv6_address_property_succeeds(void)
+{
+    LOG_CONTEXT_HANDLE log_context;
+    const uint8_t test_address[16] = { 0x20, 0x01, 0x0D, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1 };
+
+    LOG_CONTEXT_CREATE(log_context, NULL,
+        LOG_CONTEXT_PROPERTY(log_ipv6_address_t, gigi, test_address)
+    );
+
+    test_message_with_context_with_one_property(LOG_LEVEL_VERBOSE, TRACE_LEVEL_VERBOSE, "LogVerbose", log_context, "",
+        sizeof(log_ipv6_address_t) // expected size of the address bytes
+    );
+
+    LOG_CONTEXT_DESTROY(log_context);
+}
+
+/* Tests_SRS_LOG_SINK_ETW_01_106: [ For IP address and socket address properties one extra byte shall be added for the out type. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_109: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_socket_address_t, a byte with the value TlgInBINARY | _TlgInChain followed by a byte with the value TlgOutSOCKETADDRESS shall be added in the metadata. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_113: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_socket_address_t, the event data descriptor shall be filled by calling EventDataDescCreate with the value of the property (the byte count followed by the bytes of the socket address). ]*/
+static void log_sink_etw_log_with_context_with_one_socket_address_property_succeeds(void)
+{
+    LOG_CONTEXT_HANDLE log_context;
+    struct sockaddr_in test_socket_address;
+    (void)memset(&test_socket_address, 0, sizeof(test_socket_address));
+    test_socket_address.sin_family = AF_INET;
+    test_socket_address.sin_port = 0x901F; // 8080 in network byte order
+    test_socket_address.sin_addr.s_addr = 0x2A01A8C0; // 192.168.1.42 in network byte order
+
+    LOG_CONTEXT_CREATE(log_context, NULL,
+        LOG_CONTEXT_PROPERTY(log_socket_address_t, gigi, &test_socket_address)
+    );
+
+    test_message_with_context_with_one_property(LOG_LEVEL_VERBOSE, TRACE_LEVEL_VERBOSE, "LogVerbose", log_context, "",
+        sizeof(uint16_t) + sizeof(struct sockaddr_in) // expected property value size
+    );
+
+    LOG_CONTEXT_DESTROY(log_context);
+}
+
+/* Tests_SRS_LOG_SINK_ETW_01_114: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_enum, a byte with the value TlgInINT32 shall be added in the metadata. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_115: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_enum, the event data descriptor shall be filled with the int32_t value of the property by calling EventDataDescCreate. ]*/
+static void log_sink_etw_log_with_context_with_one_enum_property_succeeds(void)
+{
+    LOG_CONTEXT_HANDLE log_context;
+
+    LOG_CONTEXT_CREATE(log_context, NULL,
+        LOG_CONTEXT_PROPERTY(TEST_STATE, gigi, TEST_STATE_RUNNING)
+    );
+
+    test_message_with_context_with_one_property(LOG_LEVEL_VERBOSE, TRACE_LEVEL_VERBOSE, "LogVerbose", log_context, "",
+        sizeof(int32_t) // expected property value size
+    );
+
+    LOG_CONTEXT_DESTROY(log_context);
+}
+
+/* Tests_SRS_LOG_SINK_ETW_01_116: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_timestamp_t or LOG_CONTEXT_PROPERTY_TYPE_log_duration_t, a byte with the value TlgInINT64 shall be added in the metadata. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_117: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_timestamp_t or LOG_CONTEXT_PROPERTY_TYPE_log_duration_t, the event data descriptor shall be filled with the 64 bit value of the property (nanoseconds) by calling EventDataDescCreate. ]*/
+static void log_sink_etw_log_with_context_with_one_timestamp_property_succeeds(void)
+{
+    LOG_CONTEXT_HANDLE log_context;
+
+    LOG_CONTEXT_CREATE(log_context, NULL,
+        LOG_CONTEXT_PROPERTY(log_timestamp_t, gigi, INT64_C(1792353646123456789))
+    );
+
+    test_message_with_context_with_one_property(LOG_LEVEL_VERBOSE, TRACE_LEVEL_VERBOSE, "LogVerbose", log_context, "",
+        sizeof(int64_t) // expected property value size
+    );
+
+    LOG_CONTEXT_DESTROY(log_context);
+}
+
+/* Tests_SRS_LOG_SINK_ETW_01_116: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_timestamp_t or LOG_CONTEXT_PROPERTY_TYPE_log_duration_t, a byte with the value TlgInINT64 shall be added in the metadata. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_117: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_log_timestamp_t or LOG_CONTEXT_PROPERTY_TYPE_log_duration_t, the event data descriptor shall be filled with the 64 bit value of the property (nanoseconds) by calling EventDataDescCreate. ]*/
+static void log_sink_etw_log_with_context_with_one_duration_property_succeeds(void)
+{
+    LOG_CONTEXT_HANDLE log_context;
+
+    LOG_CONTEXT_CREATE(log_context, NULL,
+        LOG_CONTEXT_PROPERTY(log_duration_t, gigi, 12345678)
+    );
+
+    test_message_with_context_with_one_property(LOG_LEVEL_VERBOSE, TRACE_LEVEL_VERBOSE, "LogVerbose", log_context, "",
+        sizeof(int64_t) // expected property value size
+    );
+
+    LOG_CONTEXT_DESTROY(log_context);
+}
+
+/* Tests_SRS_LOG_SINK_ETW_01_118: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_{element_type}_array, a byte with the in type of element_type (TlgInINT64, TlgInUINT64, TlgInINT32, TlgInUINT32, TlgInINT16, TlgInUINT16, TlgInINT8 or TlgInUINT8) combined with TlgInVcount shall be added in the metadata. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_119: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_{element_type}_array, the event data descriptor shall be filled by calling EventDataDescCreate with the value of the property (the count followed by the values). ]*/
+static void log_sink_etw_log_with_context_with_one_int32_t_array_property_succeeds(void)
+{
+    LOG_CONTEXT_HANDLE log_context;
+    static const int32_t values[] = { 1, -2, 3 };
+
+    LOG_CONTEXT_CREATE(log_context, NULL,
+        LOG_CONTEXT_ARRAY_PROPERTY(int32_t, gigi, values, 3)
+    );
+
+    test_message_with_context_with_one_property(LOG_LEVEL_VERBOSE, TRACE_LEVEL_VERBOSE, "LogVerbose", log_context, "",
+        sizeof(uint16_t) + sizeof(values) // expected property value size
+    );
+
+    LOG_CONTEXT_DESTROY(log_context);
+}
+
+/* Tests_SRS_LOG_SINK_ETW_01_118: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_{element_type}_array, a byte with the in type of element_type (TlgInINT64, TlgInUINT64, TlgInINT32, TlgInUINT32, TlgInINT16, TlgInUINT16, TlgInINT8 or TlgInUINT8) combined with TlgInVcount shall be added in the metadata. ]*/
+/* Tests_SRS_LOG_SINK_ETW_01_119: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_{element_type}_array, the event data descriptor shall be filled by calling EventDataDescCreate with the value of the property (the count followed by the values). ]*/
+static void log_sink_etw_log_with_context_with_one_empty_uint8_t_array_property_succeeds(void)
+{
+    LOG_CONTEXT_HANDLE log_context;
+
+    LOG_CONTEXT_CREATE(log_context, NULL,
+        LOG_CONTEXT_ARRAY_PROPERTY(uint8_t, gigi, NULL, 0)
+    );
+
+    test_message_with_context_with_one_property(LOG_LEVEL_VERBOSE, TRACE_LEVEL_VERBOSE, "LogVerbose", log_context, "",
+        sizeof(uint16_t) // expected property value size
+    );
+
+    LOG_CONTEXT_DESTROY(log_context);
+}
+
 /* Tests_SRS_LOG_SINK_ETW_07_001: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_bool, a byte with the value TlgInBOOL32 shall be added in the metadata. ]*/
 /* Tests_SRS_LOG_SINK_ETW_07_002: [ If the property type is LOG_CONTEXT_PROPERTY_TYPE_bool, the event data descriptor shall be filled with the value of the property by calling EventDataDescCreate. ]*/
 static void log_sink_etw_log_with_context_with_one_bool_property_succeeds(void)
@@ -1536,7 +1912,7 @@ static void test_message_with_context_with_multiple_properties(LOG_LEVEL log_lev
     setup_mocks();
     setup_log_context_get_property_value_pairs_call();
     setup_log_context_get_property_value_pair_count_call();
-    setup_vsnprintf_call(); // formatting message
+    setup_log_vsnprintf_cached_call(); // formatting message
     setup__tlgCreate1Sz_char(); // message
     setup__tlgCreate1Sz_char(); // file
     setup__tlgCreate1Sz_char(); // func
@@ -1652,6 +2028,18 @@ static void test_message_with_context_with_multiple_properties(LOG_LEVEL log_lev
             *pos = TlgInUINT8;
             break;
         }
+        case LOG_CONTEXT_PROPERTY_TYPE_float:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInFLOAT;
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_double:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInDOUBLE;
+            break;
+        }
         }
         pos++;
     }
@@ -1732,6 +2120,16 @@ static void test_message_with_context_with_multiple_properties(LOG_LEVEL log_lev
             expected_property_size = sizeof(uint8_t);
             break;
         }
+        case LOG_CONTEXT_PROPERTY_TYPE_float:
+        {
+            expected_property_size = sizeof(float);
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_double:
+        {
+            expected_property_size = sizeof(double);
+            break;
+        }
         }
         expected_event_data_descriptors[6 + i].Size = expected_property_size;
         expected_event_data_descriptors[6 + i].Ptr = (ULONGLONG)log_context_property_value_pairs[i + 1].value;
@@ -1806,9 +2204,8 @@ static void when_unknown_property_type_is_encountered_log_sink_etw_log_with_cont
     setup_mocks();
     setup_log_context_get_property_value_pairs_call();
     setup_log_context_get_property_value_pair_count_call();
-    setup_log_context_property_if_get_type(); // one mocked call to get_type
     setup_printf_call(); // printf error
-    setup_vsnprintf_call(); // formatting message
+    setup_log_vsnprintf_cached_call(); // formatting message
     setup__tlgCreate1Sz_char(); // message
     setup__tlgCreate1Sz_char(); // file
     setup__tlgCreate1Sz_char(); // func
@@ -1852,6 +2249,8 @@ static void when_unknown_property_type_is_encountered_log_sink_etw_log_with_cont
 
     LOG_CONTEXT_PROPERTY_TYPE_IF mocked_property_type_if;
     mocked_property_type_if.get_type = mock_log_context_property_if_get_type;
+    // the sink switches on type_tag, so an unknown tag is what triggers the error path
+    mocked_property_type_if.type_tag = (LOG_CONTEXT_PROPERTY_TYPE)0xFF;
 
     (void)memcpy(mocked_property_value_pairs, log_context_property_value_pairs, sizeof(LOG_CONTEXT_PROPERTY_VALUE_PAIR) * 2);
 
@@ -1968,7 +2367,7 @@ static void when_more_than_64_properties_are_passed_in_context_log_sink_etw_log_
     setup_mocks();
     setup_log_context_get_property_value_pairs_call();
     setup_log_context_get_property_value_pair_count_call();
-    setup_vsnprintf_call(); // formatting message
+    setup_log_vsnprintf_cached_call(); // formatting message
     setup__tlgCreate1Sz_char(); // message
     setup__tlgCreate1Sz_char(); // file
     setup__tlgCreate1Sz_char(); // func
@@ -2110,7 +2509,7 @@ static void when_exactly_64_properties_are_passed_in_context_log_sink_etw_log_wi
     setup_mocks();
     setup_log_context_get_property_value_pairs_call();
     setup_log_context_get_property_value_pair_count_call();
-    setup_vsnprintf_call(); // formatting message
+    setup_log_vsnprintf_cached_call(); // formatting message
     setup__tlgCreate1Sz_char(); // message
     setup__tlgCreate1Sz_char(); // file
     setup__tlgCreate1Sz_char(); // func
@@ -2221,6 +2620,18 @@ static void when_exactly_64_properties_are_passed_in_context_log_sink_etw_log_wi
             *pos = TlgInUINT8;
             break;
         }
+        case LOG_CONTEXT_PROPERTY_TYPE_float:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInFLOAT;
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_double:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInDOUBLE;
+            break;
+        }
         }
         pos++;
     }
@@ -2296,6 +2707,16 @@ static void when_exactly_64_properties_are_passed_in_context_log_sink_etw_log_wi
             expected_property_size = sizeof(uint8_t);
             break;
         }
+        case LOG_CONTEXT_PROPERTY_TYPE_float:
+        {
+            expected_property_size = sizeof(float);
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_double:
+        {
+            expected_property_size = sizeof(double);
+            break;
+        }
         }
         expected_event_data_descriptors[6 + i].Size = expected_property_size;
         expected_event_data_descriptors[6 + i].Ptr = (ULONGLONG)log_context_property_value_pairs[i + 1].value;
@@ -2367,7 +2788,7 @@ static void when_size_of_metadata_exceeds_4096_log_sink_etw_log_with_context_doe
     setup_log_context_get_property_value_pairs_call();
     setup_log_context_get_property_value_pair_count_call();
     setup_printf_call(); // printf error
-    setup_vsnprintf_call(); // formatting message
+    setup_log_vsnprintf_cached_call(); // formatting message
     setup__tlgCreate1Sz_char(); // message
     setup__tlgCreate1Sz_char(); // file
     setup__tlgCreate1Sz_char(); // func
@@ -2484,8 +2905,8 @@ static void when_size_of_metadata_and_formatted_messages_exceeds_4096_log_sink_e
     setup_mocks();
     setup_log_context_get_property_value_pairs_call();
     setup_log_context_get_property_value_pair_count_call();
-    setup_vsnprintf_call(); // formatting message
-    setup_vsnprintf_call(); // formatting message
+    setup_log_vsnprintf_cached_call(); // formatting message
+    setup_log_vsnprintf_cached_call(); // formatting message
     setup__tlgCreate1Sz_char(); // message
     setup__tlgCreate1Sz_char(); // file
     setup__tlgCreate1Sz_char(); // func
@@ -2602,7 +3023,7 @@ static void when_size_of_metadata_of_exactly_4096_log_sink_etw_log_with_context_
     setup_mocks();
     setup_log_context_get_property_value_pairs_call();
     setup_log_context_get_property_value_pair_count_call();
-    setup_vsnprintf_call(); // formatting message
+    setup_log_vsnprintf_cached_call(); // formatting message
     setup__tlgCreate1Sz_char(); // message
     setup__tlgCreate1Sz_char(); // file
     setup__tlgCreate1Sz_char(); // func
@@ -2713,6 +3134,18 @@ static void when_size_of_metadata_of_exactly_4096_log_sink_etw_log_with_context_
             *pos = TlgInUINT8;
             break;
         }
+        case LOG_CONTEXT_PROPERTY_TYPE_float:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInFLOAT;
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_double:
+        {
+            setup_EventDataDescCreate();
+            *pos = TlgInDOUBLE;
+            break;
+        }
         }
         pos++;
     }
@@ -2788,6 +3221,16 @@ static void when_size_of_metadata_of_exactly_4096_log_sink_etw_log_with_context_
             expected_property_size = sizeof(uint8_t);
             break;
         }
+        case LOG_CONTEXT_PROPERTY_TYPE_float:
+        {
+            expected_property_size = sizeof(float);
+            break;
+        }
+        case LOG_CONTEXT_PROPERTY_TYPE_double:
+        {
+            expected_property_size = sizeof(double);
+            break;
+        }
         }
         expected_event_data_descriptors[6 + i].Size = expected_property_size;
         expected_event_data_descriptors[6 + i].Ptr = (ULONGLONG)log_context_property_value_pairs[i + 1].value;
@@ -2808,7 +3251,7 @@ static void when_size_of_metadata_of_exactly_4096_log_sink_etw_log_with_context_
 }
 
 /* Tests_SRS_LOG_SINK_ETW_01_086: [ If any error occurs log_sink_etw.log shall print Error emitting ETW event and return. ]*/
-static void when_vsnprintf_fails_an_error_is_printed(void)
+static void when_log_vsnprintf_cached_fails_an_error_is_printed(void)
 {
     // arrange
     LOG_CONTEXT_HANDLE log_context;
@@ -2822,9 +3265,9 @@ static void when_vsnprintf_fails_an_error_is_printed(void)
     setup_mocks();
     setup_log_context_get_property_value_pairs_call();
     setup_log_context_get_property_value_pair_count_call();
-    setup_vsnprintf_call(); // formatting message
-    expected_calls[2].vsnprintf_call.override_result = true;
-    expected_calls[2].vsnprintf_call.call_result = -1;
+    setup_log_vsnprintf_cached_call(); // formatting message
+    expected_calls[2].log_vsnprintf_cached_call.override_result = true;
+    expected_calls[2].log_vsnprintf_cached_call.call_result = -1;
     setup_printf_call(); // spew error
 
     // act
@@ -2889,10 +3332,10 @@ static void when_size_of_metadata_and_formatted_messages_exceeds_4096_and_2nd_vs
     setup_mocks();
     setup_log_context_get_property_value_pairs_call();
     setup_log_context_get_property_value_pair_count_call();
-    setup_vsnprintf_call(); // formatting message
-    setup_vsnprintf_call(); // formatting message 2nd attempt
-    expected_calls[3].vsnprintf_call.override_result = true;
-    expected_calls[3].vsnprintf_call.call_result = -1;
+    setup_log_vsnprintf_cached_call(); // formatting message
+    setup_log_vsnprintf_cached_call(); // formatting message 2nd attempt
+    expected_calls[3].log_vsnprintf_cached_call.override_result = true;
+    expected_calls[3].log_vsnprintf_cached_call.call_result = -1;
     setup_printf_call();
 
     // act
@@ -2926,7 +3369,7 @@ static void when_a_parent_context_is_used_all_properties_are_emitted(void)
     setup_mocks();
     setup_log_context_get_property_value_pairs_call();
     setup_log_context_get_property_value_pair_count_call();
-    setup_vsnprintf_call(); // formatting message
+    setup_log_vsnprintf_cached_call(); // formatting message
     setup__tlgCreate1Sz_char(); // message
     setup__tlgCreate1Sz_char(); // file
     setup__tlgCreate1Sz_char(); // func
@@ -3098,6 +3541,20 @@ int main(void)
     log_sink_etw_log_with_context_with_one_uint16_t_property_succeeds();
     log_sink_etw_log_with_context_with_one_int8_t_property_succeeds();
     log_sink_etw_log_with_context_with_one_uint8_t_property_succeeds();
+    log_sink_etw_log_with_context_with_one_float_property_succeeds();
+    log_sink_etw_log_with_context_with_one_double_property_succeeds();
+    log_sink_etw_log_with_context_with_one_borrowed_string_property_succeeds();
+    log_sink_etw_log_with_context_with_one_binary_property_succeeds();
+    log_sink_etw_log_with_context_with_one_borrowed_binary_property_succeeds();
+    log_sink_etw_log_with_context_with_one_uuid_property_succeeds();
+    log_sink_etw_log_with_context_with_one_ipv4_address_property_succeeds();
+    log_sink_etw_log_with_context_with_one_ipv6_address_property_succeeds();
+    log_sink_etw_log_with_context_with_one_socket_address_property_succeeds();
+    log_sink_etw_log_with_context_with_one_enum_property_succeeds();
+    log_sink_etw_log_with_context_with_one_timestamp_property_succeeds();
+    log_sink_etw_log_with_context_with_one_duration_property_succeeds();
+    log_sink_etw_log_with_context_with_one_int32_t_array_property_succeeds();
+    log_sink_etw_log_with_context_with_one_empty_uint8_t_array_property_succeeds();
     log_sink_etw_log_with_context_with_one_bool_property_succeeds();
     log_sink_etw_log_with_context_with_all_property_types_succeeds();
     when_unknown_property_type_is_encountered_log_sink_etw_log_with_context_does_not_place_any_properties_in_the_event();
@@ -3106,7 +3563,7 @@ int main(void)
     when_size_of_metadata_exceeds_4096_log_sink_etw_log_with_context_does_not_place_any_properties_in_the_event();
     when_size_of_metadata_and_formatted_messages_exceeds_4096_log_sink_etw_log_with_context_does_not_place_any_properties_in_the_event();
     when_size_of_metadata_of_exactly_4096_log_sink_etw_log_with_context_places_properties_in_the_event();
-    when_vsnprintf_fails_an_error_is_printed();
+    when_log_vsnprintf_cached_fails_an_error_is_printed();
     when_size_of_metadata_and_formatted_messages_exceeds_4096_and_2nd_vsnprintf_fails_an_error_is_printed();
     when_a_parent_context_is_used_all_properties_are_emitted();
 
@@ -0,0 +1,100 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/log_timestamp.h"
+
+#include "timer.h"
+
+// Measures the cost of taking the time of a record with log_timestamp_ticks (the CPU counter when built with
+// log_timestamp_counter ON and the counter is invariant), of converting it to wall clock time and of log_timestamp_now,
+// compared with reading the wall clock (clock_gettime, timespec_get on Windows)
+
+#define TEST_TIME 1000 // ms per measurement
+#define ITERATION_COUNT 100000
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+// sink for the times, so that the calls cannot be optimized away
+static volatile uint64_t last_time;
+
+static uint64_t read_wall_clock(void)
+{
+    struct timespec now;
+#ifdef _WIN32
+    POOR_MANS_ASSERT(timespec_get(&now, TIME_UTC) == TIME_UTC);
+#else
+    POOR_MANS_ASSERT(clock_gettime(CLOCK_REALTIME, &now) == 0);
+#endif
+    return (uint64_t)now.tv_sec * 1000000000 + (uint64_t)now.tv_nsec;
+}
+
+static uint64_t read_ticks(void)
+{
+    return log_timestamp_ticks();
+}
+
+static uint64_t read_and_convert_ticks(void)
+{
+    return (uint64_t)log_timestamp_ticks_to_ns(log_timestamp_ticks());
+}
+
+static uint64_t read_now(void)
+{
+    return (uint64_t)log_timestamp_now();
+}
+
+#define DEFINE_TIME_PERF_TEST(read_function) \
+    static double MU_C2(measure_, read_function)(void) \
+    { \
+        double start_time; \
+        double current_time; \
+        uint64_t call_count = 0; \
+        start_time = timer_global_get_elapsed_us(); \
+        while ((current_time = timer_global_get_elapsed_us()) - start_time < TEST_TIME * 1000) \
+        { \
+            for (uint32_t i = 0; i < ITERATION_COUNT; i++) \
+            { \
+                last_time = read_function(); \
+            } \
+            call_count += ITERATION_COUNT; \
+        } \
+        return (current_time - start_time) * 1000.0 / (double)call_count; \
+    } \
+
+DEFINE_TIME_PERF_TEST(read_wall_clock)
+DEFINE_TIME_PERF_TEST(read_ticks)
+DEFINE_TIME_PERF_TEST(read_and_convert_ticks)
+DEFINE_TIME_PERF_TEST(read_now)
+
+static void print_results(const char* name, double ns, double wall_clock_ns)
+{
+    (void)printf("%-28s %6.2lf ns/call, %.2lfx the wall clock\r\n", name, ns, wall_clock_ns / ns);
+}
+
+int main(void)
+{
+    (void)printf("ticks from the %s\r\n", log_timestamp_uses_counter() ? "CPU counter" : "wall clock");
+
+    // the first conversion calibrates the counter
+    POOR_MANS_ASSERT(log_timestamp_now() != LOG_TIMESTAMP_INVALID);
+
+    double wall_clock_ns = measure_read_wall_clock();
+    (void)printf("%-28s %6.2lf ns/call\r\n", "wall clock", wall_clock_ns);
+    print_results("log_timestamp_ticks", measure_read_ticks(), wall_clock_ns);
+    print_results("ticks and conversion", measure_read_and_convert_ticks(), wall_clock_ns);
+    print_results("log_timestamp_now", measure_read_now(), wall_clock_ns);
+
+    return 0;
+}
@@ -0,0 +1,270 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifdef _WIN32
+#include "windows.h"
+#else
+#include <pthread.h>
+#endif
+
+#include "c_logging/log_timestamp.h"
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+#define NANOSECONDS_PER_SECOND INT64_C(1000000000)
+
+#define FIRST_USE_THREAD_COUNT 8
+
+/* log_timestamp_now */
+
+#ifdef _WIN32
+static DWORD WINAPI read_first_timestamp(LPVOID context)
+#else
+static void* read_first_timestamp(void* context)
+#endif
+{
+    *(int64_t*)context = log_timestamp_now();
+    return 0;
+}
+
+/* Tests_SRS_LOG_TIMESTAMP_01_016: [ If the counter is used and no calibration can be made, log_timestamp_now shall return LOG_TIMESTAMP_INVALID. ]*/
+/* Tests_SRS_LOG_TIMESTAMP_01_021: [ If the counter is used and another thread is making the first calibration, log_timestamp_now shall read the wall clock instead of waiting for the calibration. ]*/
+/* Tests_SRS_LOG_TIMESTAMP_01_017: [ If the counter is used, log_timestamp_now shall read the counter and convert it with the published calibration. ]*/
+static void log_timestamp_now_on_first_use_from_many_threads_returns_the_time_on_all_threads(void)
+{
+    // arrange
+    int64_t results[FIRST_USE_THREAD_COUNT];
+    struct timespec before;
+    POOR_MANS_ASSERT(timespec_get(&before, TIME_UTC) == TIME_UTC);
+
+    // act
+    // this runs first, so that the threads race for the first calibration
+#ifdef _WIN32
+    HANDLE threads[FIRST_USE_THREAD_COUNT];
+    for (uint32_t i = 0; i < FIRST_USE_THREAD_COUNT; i++)
+    {
+        threads[i] = CreateThread(NULL, 0, read_first_timestamp, &results[i], 0, NULL);
+        POOR_MANS_ASSERT(threads[i] != NULL);
+    }
+    for (uint32_t i = 0; i < FIRST_USE_THREAD_COUNT; i++)
+    {
+        POOR_MANS_ASSERT(WaitForSingleObject(threads[i], INFINITE) == WAIT_OBJECT_0);
+        (void)CloseHandle(threads[i]);
+    }
+#else
+    pthread_t threads[FIRST_USE_THREAD_COUNT];
+    for (uint32_t i = 0; i < FIRST_USE_THREAD_COUNT; i++)
+    {
+        POOR_MANS_ASSERT(pthread_create(&threads[i], NULL, read_first_timestamp, &results[i]) == 0);
+    }
+    for (uint32_t i = 0; i < FIRST_USE_THREAD_COUNT; i++)
+    {
+        POOR_MANS_ASSERT(pthread_join(threads[i], NULL) == 0);
+    }
+#endif
+
+    // assert
+    for (uint32_t i = 0; i < FIRST_USE_THREAD_COUNT; i++)
+    {
+        POOR_MANS_ASSERT(results[i] != LOG_TIMESTAMP_INVALID);
+        POOR_MANS_ASSERT(results[i] >= ((int64_t)before.tv_sec - 1) * NANOSECONDS_PER_SECOND);
+    }
+}
+
+
+/* Tests_SRS_LOG_TIMESTAMP_01_001: [ If the counter is not used, log_timestamp_now shall read the wall clock once: clock_gettime with CLOCK_REALTIME on Linux (CLOCK_REALTIME_COARSE if LOG_TIMESTAMP_USE_COARSE_CLOCK is defined) and timespec_get with TIME_UTC on Windows. ]*/
+/* Tests_SRS_LOG_TIMESTAMP_01_003: [ log_timestamp_now shall return the number of nanoseconds since 1970-01-01T00:00:00Z. ]*/
+static void log_timestamp_now_returns_the_wall_clock_time(void)
+{
+    // arrange
+    struct timespec before;
+    struct timespec after;
+    POOR_MANS_ASSERT(timespec_get(&before, TIME_UTC) == TIME_UTC);
+
+    // act
+    int64_t result = log_timestamp_now();
+
+    // assert
+    POOR_MANS_ASSERT(timespec_get(&after, TIME_UTC) == TIME_UTC);
+    POOR_MANS_ASSERT(result != LOG_TIMESTAMP_INVALID);
+    // allow for the resolution of the coarse clock
+    POOR_MANS_ASSERT(result >= ((int64_t)before.tv_sec - 1) * NANOSECONDS_PER_SECOND);
+    POOR_MANS_ASSERT(result <= ((int64_t)after.tv_sec + 1) * NANOSECONDS_PER_SECOND);
+}
+
+/* Tests_SRS_LOG_TIMESTAMP_01_003: [ log_timestamp_now shall return the number of nanoseconds since 1970-01-01T00:00:00Z. ]*/
+static void log_timestamp_now_has_sub_second_resolution(void)
+{
+    // arrange
+    int64_t first = log_timestamp_now();
+    int64_t last = first;
+
+    // act
+    // wait for the clock to move
+    for (uint32_t i = 0; (i < 100000000) && (last == first); i++)
+    {
+        last = log_timestamp_now();
+    }
+
+    // assert
+    POOR_MANS_ASSERT(last != first);
+    POOR_MANS_ASSERT(last - first < NANOSECONDS_PER_SECOND);
+}
+
+/* Tests_SRS_LOG_TIMESTAMP_01_017: [ If the counter is used, log_timestamp_now shall read the counter and convert it with the published calibration. ]*/
+static void log_timestamp_now_is_monotonic_across_calibrations(void)
+{
+    // arrange
+    int64_t previous = log_timestamp_now();
+
+    // act
+    // assert
+    for (uint32_t i = 0; i < 1000; i++)
+    {
+        if ((i % 100) == 0)
+        {
+            POOR_MANS_ASSERT(log_timestamp_calibrate() == 0);
+        }
+        int64_t now = log_timestamp_now();
+        POOR_MANS_ASSERT(now != LOG_TIMESTAMP_INVALID);
+        // a calibration can move the time back by what the counter drifted from the wall clock
+        POOR_MANS_ASSERT(now >= previous - 1000000);
+        previous = now;
+    }
+}
+
+/* log_timestamp_ticks */
+
+/* Tests_SRS_LOG_TIMESTAMP_01_005: [ If the counter is used, log_timestamp_ticks shall return the value of the counter (rdtsc on x86/x64, CNTVCT_EL0 on ARM64). ]*/
+/* Tests_SRS_LOG_TIMESTAMP_01_006: [ Otherwise log_timestamp_ticks shall return the wall clock time in nanoseconds since 1970-01-01T00:00:00Z. ]*/
+static void log_timestamp_ticks_grow(void)
+{
+    // arrange
+    uint64_t first = log_timestamp_ticks();
+    uint64_t last = first;
+
+    // act
+    for (uint32_t i = 0; (i < 100000000) && (last == first); i++)
+    {
+        last = log_timestamp_ticks();
+    }
+
+    // assert
+    POOR_MANS_ASSERT(last > first);
+}
+
+/* log_timestamp_ticks_to_ns */
+
+/* Tests_SRS_LOG_TIMESTAMP_01_009: [ Otherwise log_timestamp_ticks_to_ns shall convert ticks to nanoseconds since 1970-01-01T00:00:00Z with the published calibration (calibrating first if no calibration was published yet, or yielding the processor while another thread makes the first calibration). ]*/
+static void log_timestamp_ticks_to_ns_returns_the_wall_clock_time_of_the_ticks(void)
+{
+    // arrange
+    struct timespec before;
+    struct timespec after;
+    POOR_MANS_ASSERT(timespec_get(&before, TIME_UTC) == TIME_UTC);
+    uint64_t ticks = log_timestamp_ticks();
+    POOR_MANS_ASSERT(timespec_get(&after, TIME_UTC) == TIME_UTC);
+
+    // act
+    int64_t result = log_timestamp_ticks_to_ns(ticks);
+
+    // assert
+    POOR_MANS_ASSERT(result != LOG_TIMESTAMP_INVALID);
+    POOR_MANS_ASSERT(result >= ((int64_t)before.tv_sec - 1) * NANOSECONDS_PER_SECOND);
+    POOR_MANS_ASSERT(result <= ((int64_t)after.tv_sec + 1) * NANOSECONDS_PER_SECOND);
+}
+
+/* Tests_SRS_LOG_TIMESTAMP_01_007: [ If the counter is not used, log_timestamp_ticks_to_ns shall return ticks. ]*/
+/* Tests_SRS_LOG_TIMESTAMP_01_010: [ log_timestamp_uses_counter shall return true if the ticks come from the counter and false otherwise. ]*/
+static void log_timestamp_ticks_to_ns_without_the_counter_returns_the_ticks(void)
+{
+    // arrange
+    bool uses_counter = log_timestamp_uses_counter();
+
+    // act
+    int64_t result = log_timestamp_ticks_to_ns(UINT64_C(1234567890));
+
+    // assert
+#ifndef LOG_TIMESTAMP_USE_COUNTER
+    POOR_MANS_ASSERT(!uses_counter);
+#endif
+    POOR_MANS_ASSERT(uses_counter || (result == 1234567890));
+}
+
+/* log_timestamp_calibrate */
+
+/* Tests_SRS_LOG_TIMESTAMP_01_011: [ If the counter is not used or another thread is calibrating, log_timestamp_calibrate shall return 0. ]*/
+/* Tests_SRS_LOG_TIMESTAMP_01_012: [ log_timestamp_calibrate shall read the counter and the wall clock together. ]*/
+/* Tests_SRS_LOG_TIMESTAMP_01_013: [ log_timestamp_calibrate shall publish the new mapping from ticks to wall clock time so that readers never see a partially written one. On the first calibration the frequency of the counter is measured over 2 ms, afterwards it is measured since the previous calibration if that is at least half of LOG_TIMESTAMP_CALIBRATION_PERIOD_NS away and the result is within 1% of the previous frequency. ]*/
+static void log_timestamp_calibrate_keeps_the_ticks_on_the_wall_clock(void)
+{
+    // arrange
+    uint64_t ticks = log_timestamp_ticks();
+    int64_t before = log_timestamp_ticks_to_ns(ticks);
+
+    // act
+    int result = log_timestamp_calibrate();
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    int64_t after = log_timestamp_ticks_to_ns(ticks);
+    POOR_MANS_ASSERT((after - before < 1000000) && (before - after < 1000000));
+}
+
+/* log_timestamp_begin_record */
+
+/* Tests_SRS_LOG_TIMESTAMP_01_015: [ If log_timestamp_begin_record was called on the calling thread without a matching log_timestamp_end_record, log_timestamp_now shall return the result of log_timestamp_ticks_to_ns for the ticks of the record. ]*/
+/* Tests_SRS_LOG_TIMESTAMP_01_019: [ log_timestamp_begin_record shall store ticks as the ticks of the record being rendered on the calling thread. ]*/
+/* Tests_SRS_LOG_TIMESTAMP_01_020: [ log_timestamp_end_record shall make log_timestamp_now read the wall clock again on the calling thread. ]*/
+static void log_timestamp_now_during_a_record_returns_the_time_of_the_record(void)
+{
+    // arrange
+    uint64_t ticks = log_timestamp_ticks();
+    int64_t record_time = log_timestamp_ticks_to_ns(ticks);
+    int64_t now;
+    do
+    {
+        now = log_timestamp_now();
+    } while (now - record_time < 1000000);
+
+    // act
+    log_timestamp_begin_record(ticks);
+    int64_t during_record = log_timestamp_now();
+    log_timestamp_end_record();
+    int64_t after_record = log_timestamp_now();
+
+    // assert
+    POOR_MANS_ASSERT(during_record == record_time);
+    POOR_MANS_ASSERT(after_record >= now);
+}
+
+int main(void)
+{
+    log_timestamp_now_on_first_use_from_many_threads_returns_the_time_on_all_threads();
+
+    log_timestamp_now_returns_the_wall_clock_time();
+    log_timestamp_now_has_sub_second_resolution();
+    log_timestamp_now_is_monotonic_across_calibrations();
+
+    log_timestamp_ticks_grow();
+
+    log_timestamp_ticks_to_ns_returns_the_wall_clock_time_of_the_ticks();
+    log_timestamp_ticks_to_ns_without_the_counter_returns_the_ticks();
+
+    log_timestamp_calibrate_keeps_the_ticks_on_the_wall_clock();
+
+    log_timestamp_now_during_a_record_returns_the_time_of_the_record();
+
+    return 0;
+}
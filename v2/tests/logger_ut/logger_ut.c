@@ -22,6 +22,8 @@
 #include "c_logging/log_level.h"
 #include "c_logging/log_sink_if.h"
 #include "c_logging/log_context.h"
+#include "c_logging/log_context_ambient.h"
+#include "c_logging/log_context_builder.h"
 
 #include "c_logging/logger.h"
 
@@ -689,6 +691,127 @@ static void LOGGER_LOG_with_non_NULL_context(void)
     cleanup_calls();
 }
 
+/* Tests_SRS_LOGGER_01_025: [ LOGGER_LOG shall pass to the sinks the context obtained by merging the ambient context of the calling thread with log_context by calling internal_log_context_ambient_merge. ]*/
+static void LOGGER_LOG_with_NULL_context_passes_the_ambient_context(void)
+{
+    // arrange
+    LOG_CONTEXT_LOCAL_DEFINE(ambient, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+    POOR_MANS_ASSERT(log_context_ambient_push(&ambient) == 0);
+
+    test_logger_init();
+    setup_mocks();
+    setup_log_sink1_log_call();
+    setup_log_sink2_log_call();
+
+    // act
+    LOGGER_LOG(LOG_LEVEL_ERROR, NULL, "u lala %d", 42);
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    // the sinks copy the context they get as the parent of a context with no properties
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        LOG_CONTEXT_HANDLE captured_log_context = (i == 0) ? expected_calls[0].log_sink1_log_call.captured_log_context : expected_calls[1].log_sink2_log_call.captured_log_context;
+        POOR_MANS_ASSERT(captured_log_context != NULL);
+        POOR_MANS_ASSERT(log_context_get_property_value_pair_count(captured_log_context) == 3);
+        const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(captured_log_context);
+        POOR_MANS_ASSERT(strcmp(pairs[2].name, "x") == 0);
+        POOR_MANS_ASSERT(*(int32_t*)pairs[2].value == 42);
+    }
+
+    //cleanup
+    log_context_ambient_pop(&ambient);
+    logger_deinit();
+    cleanup_calls();
+}
+
+/* Tests_SRS_LOGGER_01_025: [ LOGGER_LOG shall pass to the sinks the context obtained by merging the ambient context of the calling thread with log_context by calling internal_log_context_ambient_merge. ]*/
+static void LOGGER_LOG_with_non_NULL_context_merges_the_ambient_context(void)
+{
+    // arrange
+    LOG_CONTEXT_LOCAL_DEFINE(ambient, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+    LOG_CONTEXT_LOCAL_DEFINE(log_context, NULL, LOG_CONTEXT_PROPERTY(int32_t, y, 43));
+    POOR_MANS_ASSERT(log_context_ambient_push(&ambient) == 0);
+
+    test_logger_init();
+    setup_mocks();
+    setup_log_sink1_log_call();
+    setup_log_sink2_log_call();
+
+    // act
+    LOGGER_LOG(LOG_LEVEL_ERROR, &log_context, "u lala %d", 42);
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        LOG_CONTEXT_HANDLE captured_log_context = (i == 0) ? expected_calls[0].log_sink1_log_call.captured_log_context : expected_calls[1].log_sink2_log_call.captured_log_context;
+        POOR_MANS_ASSERT(captured_log_context != NULL);
+        POOR_MANS_ASSERT(log_context_get_property_value_pair_count(captured_log_context) == 6);
+        const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(captured_log_context);
+        POOR_MANS_ASSERT(*(uint8_t*)pairs[1].value == 2);
+        POOR_MANS_ASSERT(strcmp(pairs[3].name, "x") == 0);
+        POOR_MANS_ASSERT(*(int32_t*)pairs[3].value == 42);
+        POOR_MANS_ASSERT(strcmp(pairs[5].name, "y") == 0);
+        POOR_MANS_ASSERT(*(int32_t*)pairs[5].value == 43);
+    }
+
+    //cleanup
+    log_context_ambient_pop(&ambient);
+    logger_deinit();
+    cleanup_calls();
+}
+
+/* Tests_SRS_LOGGER_01_028: [ Otherwise the property/value pairs of the merged view shall be stored in memory allocated for the logging call. ]*/
+static void LOGGER_LOG_with_a_merged_view_that_does_not_fit_on_the_stack_merges_the_ambient_context(void)
+{
+    // arrange
+    LOG_CONTEXT_BUILDER_HANDLE log_context_builder = log_context_builder_create();
+    POOR_MANS_ASSERT(log_context_builder != NULL);
+    for (int32_t i = 0; i < LOGGER_STACK_MERGED_PAIR_COUNT; i++)
+    {
+        POOR_MANS_ASSERT(LOG_CONTEXT_BUILDER_ADD_PROPERTY(int32_t)(log_context_builder, "x", i) == 0);
+    }
+    LOG_CONTEXT_HANDLE ambient = log_context_builder_freeze(log_context_builder, NULL);
+    POOR_MANS_ASSERT(ambient != NULL);
+    LOG_CONTEXT_LOCAL_DEFINE(log_context, NULL, LOG_CONTEXT_PROPERTY(int32_t, y, 43));
+    POOR_MANS_ASSERT(log_context_ambient_push(ambient) == 0);
+
+    test_logger_init();
+    setup_mocks();
+    setup_log_sink1_log_call();
+    setup_log_sink2_log_call();
+
+    // act
+    LOGGER_LOG(LOG_LEVEL_ERROR, &log_context, "u lala %d", 42);
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    for (uint32_t i = 0; i < 2; i++)
+    {
+        LOG_CONTEXT_HANDLE captured_log_context = (i == 0) ? expected_calls[0].log_sink1_log_call.captured_log_context : expected_calls[1].log_sink2_log_call.captured_log_context;
+        POOR_MANS_ASSERT(captured_log_context != NULL);
+        POOR_MANS_ASSERT(log_context_get_property_value_pair_count(captured_log_context) == 1 + 1 + (LOGGER_STACK_MERGED_PAIR_COUNT + 1) + 2);
+        const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(captured_log_context);
+        POOR_MANS_ASSERT(*(int32_t*)pairs[2 + LOGGER_STACK_MERGED_PAIR_COUNT].value == LOGGER_STACK_MERGED_PAIR_COUNT - 1);
+        POOR_MANS_ASSERT(strcmp(pairs[4 + LOGGER_STACK_MERGED_PAIR_COUNT].name, "y") == 0);
+        POOR_MANS_ASSERT(*(int32_t*)pairs[4 + LOGGER_STACK_MERGED_PAIR_COUNT].value == 43);
+    }
+
+    //cleanup
+    log_context_ambient_pop(ambient);
+    LOG_CONTEXT_DESTROY(ambient);
+    log_context_builder_destroy(log_context_builder);
+    logger_deinit();
+    cleanup_calls();
+}
+
 /* LOGGER_LOG_EX */
 
 /* Tests_SRS_LOGGER_01_008: [ LOGGER_LOG_EX shall call the log function of every sink that is configured to be used. ]*/
@@ -1004,6 +1127,54 @@ static void LOGGER_LOG_EX_with_string_property_works(void)
     cleanup_calls();
 }
 
+/* Tests_SRS_LOGGER_01_008: [ LOGGER_LOG_EX shall call the log function of every sink that is configured to be used. ]*/
+/* Tests_SRS_LOGGER_01_010: [ Otherwise, LOGGER_LOG_EX shall construct a log context with all the properties specified in .... ] */
+static void LOGGER_LOG_EX_with_array_property_works(void)
+{
+    // arrange
+    uint32_t shard_ids[] = { 3, 1, 4 };
+    uint16_t captured_count;
+    uint32_t captured_shard_ids[3];
+    test_logger_init();
+
+    setup_mocks();
+    setup_log_sink1_log_call();
+    setup_log_sink2_log_call();
+
+    // act
+    int expected_line = __LINE__; LOGGER_LOG_EX(LOG_LEVEL_INFO, LOG_CONTEXT_ARRAY_PROPERTY(uint32_t, shards, shard_ids, 3), LOG_MESSAGE("%d shards", 3));
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    POOR_MANS_ASSERT(expected_calls[0].log_sink1_log_call.captured_log_level == LOG_LEVEL_INFO);
+    POOR_MANS_ASSERT(expected_calls[0].log_sink1_log_call.captured_log_context != NULL);
+    POOR_MANS_ASSERT(expected_calls[0].log_sink1_log_call.captured_line == expected_line);
+    POOR_MANS_ASSERT(strcmp(expected_calls[0].log_sink1_log_call.captured_message, "3 shards") == 0);
+    POOR_MANS_ASSERT(expected_calls[1].log_sink2_log_call.captured_log_context != NULL);
+    POOR_MANS_ASSERT(strcmp(expected_calls[1].log_sink2_log_call.captured_message, "3 shards") == 0);
+
+    // check properties
+    uint32_t captured_context_property_count = log_context_get_property_value_pair_count(expected_calls[0].log_sink1_log_call.captured_log_context);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* captured_context_properties = log_context_get_property_value_pairs(expected_calls[0].log_sink1_log_call.captured_log_context);
+    // we expect one extra property as we're "copying" the context by creating a parent one
+    POOR_MANS_ASSERT(captured_context_property_count == 3);
+    POOR_MANS_ASSERT(captured_context_properties[1].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_struct);
+    POOR_MANS_ASSERT(*(uint8_t*)captured_context_properties[1].value == 1);
+    POOR_MANS_ASSERT(strcmp(captured_context_properties[2].name, "shards") == 0);
+    POOR_MANS_ASSERT(captured_context_properties[2].type->get_type() == LOG_CONTEXT_PROPERTY_TYPE_uint32_t_array);
+    // the value is the count as a uint16_t followed by the values, not aligned
+    (void)memcpy(&captured_count, captured_context_properties[2].value, sizeof(captured_count));
+    (void)memcpy(captured_shard_ids, (const uint8_t*)captured_context_properties[2].value + sizeof(captured_count), sizeof(captured_shard_ids));
+    POOR_MANS_ASSERT(captured_count == 3);
+    POOR_MANS_ASSERT(memcmp(captured_shard_ids, shard_ids, sizeof(shard_ids)) == 0);
+
+    //cleanup
+    logger_deinit();
+    cleanup_calls();
+}
+
 /* Tests_SRS_LOGGER_01_009: [ If no properties are specified in ..., LOGGER_LOG_EX shall call log with log_context being NULL. ] */
 static void LOGGER_LOG_EX_with_no_properties_works(void)
 {
@@ -1256,6 +1427,48 @@ static void test_logger_log_with_config_on_sink_with_log_level(LOG_LEVEL log_lev
     cleanup_calls();
 }
 
+/* Tests_SRS_LOGGER_01_026: [ LOGGER_LOG_WITH_CONFIG shall pass to the sinks the context obtained by merging the ambient context of the calling thread with log_context by calling internal_log_context_ambient_merge. ]*/
+static void LOGGER_LOG_WITH_CONFIG_with_NULL_context_passes_the_ambient_context(void)
+{
+    // arrange
+    LOG_CONTEXT_LOCAL_DEFINE(ambient, NULL, LOG_CONTEXT_PROPERTY(int32_t, x, 42));
+    POOR_MANS_ASSERT(log_context_ambient_push(&ambient) == 0);
+
+    test_logger_init();
+    setup_mocks();
+    setup_log_sink2_log_call();
+
+    const LOG_SINK_IF* only_one_sink[] =
+    {
+        &log_sink2
+    };
+
+    const LOGGER_CONFIG custom_config =
+    {
+        .log_sinks = only_one_sink,
+        .log_sink_count = 1
+    };
+
+    // act
+    LOGGER_LOG_WITH_CONFIG(custom_config, LOG_LEVEL_ERROR, NULL, "gigi duru");
+
+    // assert
+    POOR_MANS_ASSERT(expected_call_count == actual_call_count);
+    POOR_MANS_ASSERT(actual_and_expected_match);
+
+    LOG_CONTEXT_HANDLE captured_log_context = expected_calls[0].log_sink2_log_call.captured_log_context;
+    POOR_MANS_ASSERT(captured_log_context != NULL);
+    POOR_MANS_ASSERT(log_context_get_property_value_pair_count(captured_log_context) == 3);
+    const LOG_CONTEXT_PROPERTY_VALUE_PAIR* pairs = log_context_get_property_value_pairs(captured_log_context);
+    POOR_MANS_ASSERT(strcmp(pairs[2].name, "x") == 0);
+    POOR_MANS_ASSERT(*(int32_t*)pairs[2].value == 42);
+
+    // cleanup
+    log_context_ambient_pop(&ambient);
+    logger_deinit();
+    cleanup_calls();
+}
+
 /* Tests_SRS_LOGGER_01_016: [ Otherwise, LOGGER_LOG_WITH_CONFIG shall call the log function of every sink specified in logger_config. ] */
 static void LOGGER_LOG_WITH_CONFIG_with_CRITICAL_works(void)
 {
@@ -1415,12 +1628,16 @@ int main(void)
     LOGGER_LOG_with_WARNING_works();
     LOGGER_LOG_with_VERBOSE_works();
     LOGGER_LOG_with_non_NULL_context();
+    LOGGER_LOG_with_NULL_context_passes_the_ambient_context();
+    LOGGER_LOG_with_non_NULL_context_merges_the_ambient_context();
+    LOGGER_LOG_with_a_merged_view_that_does_not_fit_on_the_stack_merges_the_ambient_context();
 
     LOGGER_LOG_EX_works();
     LOGGER_LOG_EX_works_with_2_properties();
     LOGGER_LOG_EX_twice_works();
     LOGGER_LOG_EX_with_no_properties_works();
     LOGGER_LOG_EX_with_string_property_works();
+    LOGGER_LOG_EX_with_array_property_works();
 
     LOGGER_LOG_EX_with_message_works();
 
@@ -1429,6 +1646,7 @@ int main(void)
     LOGGER_LOG_WITH_CONFIG_with_INFO_works();
     LOGGER_LOG_WITH_CONFIG_with_WARNING_works();
     LOGGER_LOG_WITH_CONFIG_with_VERBOSE_works();
+    LOGGER_LOG_WITH_CONFIG_with_NULL_context_passes_the_ambient_context();
 
     LOGGER_LOG_WITH_CONFIG_with_NULL_sinks_and_1_count_returns();
     LOGGER_LOG_WITH_CONFIG_with_1_sink_when_no_sinks_in_default_config();
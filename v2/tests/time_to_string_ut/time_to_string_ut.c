@@ -0,0 +1,318 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/time_to_string.h"
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+typedef struct TIME_TEST_CASE_TAG
+{
+    int64_t value;
+    const char* expected;
+} TIME_TEST_CASE;
+
+static const TIME_TEST_CASE timestamp_test_cases[] =
+{
+    { 0, "1970-01-01T00:00:00.000000000Z" },
+    // before the epoch the date goes back while the fraction stays positive
+    { -1, "1969-12-31T23:59:59.999999999Z" },
+    // leap day
+    { INT64_C(951782400123456789), "2000-02-29T00:00:00.123456789Z" },
+    // 2100 is not a leap year
+    { INT64_C(4107542400000000000), "2100-03-01T00:00:00.000000000Z" },
+    { INT64_C(1792353646000000005), "2026-10-18T20:00:46.000000005Z" },
+    { INT64_MIN, "1677-09-21T00:12:43.145224192Z" },
+    { INT64_MAX, "2262-04-11T23:47:16.854775807Z" },
+};
+
+static const TIME_TEST_CASE duration_test_cases[] =
+{
+    { 0, "0ns" },
+    { 850, "850ns" },
+    { 999, "999ns" },
+    { 1000, "1.000us" },
+    { 12345, "12.345us" },
+    { 999999, "999.999us" },
+    { 1000000, "1.000ms" },
+    // decimals are truncated
+    { 12345678, "12.345ms" },
+    { INT64_C(1000000000), "1.000s" },
+    { INT64_C(12345678901), "12.345s" },
+    { INT64_C(59999999999), "59.999s" },
+    { INT64_C(60000000000), "1m00.000s" },
+    { INT64_C(123456000000), "2m03.456s" },
+    { INT64_C(3723456000000), "1h02m03.456s" },
+    { INT64_C(262923456000000), "3d01h02m03.456s" },
+    { -850, "-850ns" },
+    { INT64_C(-12345678), "-12.345ms" },
+    { INT64_MIN, "-106751d23h47m16.854s" },
+    { INT64_MAX, "106751d23h47m16.854s" },
+};
+
+/* timestamp_to_string */
+
+/* Tests_SRS_TIME_TO_STRING_01_001: [ If buffer is NULL and buffer_length is greater than 0, timestamp_to_string shall fail and return a negative value. ]*/
+static void timestamp_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails(void)
+{
+    // arrange
+
+    // act
+    int result = timestamp_to_string(0, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_TIME_TO_STRING_01_002: [ timestamp_to_string shall produce the UTC date and time of nanoseconds_since_epoch in the ISO 8601 form YYYY-MM-DDTHH:MM:SS.nnnnnnnnnZ, using the proleptic Gregorian calendar. ]*/
+/* Tests_SRS_TIME_TO_STRING_01_003: [ timestamp_to_string shall compute the date and time of day without calling gmtime, gmtime_r or strftime. ]*/
+/* Tests_SRS_TIME_TO_STRING_01_011: [ If the representation fits in buffer, timestamp_to_string, timestamp_microseconds_to_string and duration_to_string shall write it in buffer followed by a zero terminator. ]*/
+/* Tests_SRS_TIME_TO_STRING_01_013: [ timestamp_to_string, timestamp_microseconds_to_string and duration_to_string shall return the number of characters of the representation, excluding the zero terminator. ]*/
+static void timestamp_to_string_succeeds(void)
+{
+    for (size_t i = 0; i < MU_COUNT_ARRAY_ITEMS(timestamp_test_cases); i++)
+    {
+        // arrange
+        char buffer[TIMESTAMP_TO_STRING_LENGTH + 1];
+
+        // act
+        int result = timestamp_to_string(timestamp_test_cases[i].value, buffer, sizeof(buffer));
+
+        // assert
+        POOR_MANS_ASSERT(result == TIMESTAMP_TO_STRING_LENGTH);
+        POOR_MANS_ASSERT(strcmp(buffer, timestamp_test_cases[i].expected) == 0);
+    }
+}
+
+/* Tests_SRS_TIME_TO_STRING_01_002: [ timestamp_to_string shall produce the UTC date and time of nanoseconds_since_epoch in the ISO 8601 form YYYY-MM-DDTHH:MM:SS.nnnnnnnnnZ, using the proleptic Gregorian calendar. ]*/
+static void timestamp_to_string_produces_every_day_of_a_leap_year(void)
+{
+    // arrange
+    static const uint32_t days_in_month[12] = { 31, 29, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    int64_t value = INT64_C(946684800) * 1000000000; // 2000-01-01T00:00:00Z
+    char buffer[TIMESTAMP_TO_STRING_LENGTH + 1];
+    char expected[64];
+
+    // act
+    // assert
+    for (uint32_t month = 1; month <= 12; month++)
+    {
+        for (uint32_t day = 1; day <= days_in_month[month - 1]; day++)
+        {
+            (void)snprintf(expected, sizeof(expected), "2000-%02u-%02uT23:59:59.999999999Z", month, day);
+            POOR_MANS_ASSERT(timestamp_to_string(value + INT64_C(86399999999999), buffer, sizeof(buffer)) == TIMESTAMP_TO_STRING_LENGTH);
+            POOR_MANS_ASSERT(strcmp(buffer, expected) == 0);
+            value += INT64_C(86400000000000);
+        }
+    }
+}
+
+/* Tests_SRS_TIME_TO_STRING_01_004: [ timestamp_to_string shall keep, per thread, the YYYY-MM-DDTHH:MM:SS text of the last second it rendered and reuse it when rendering a timestamp in the same second. ]*/
+static void timestamp_to_string_in_the_same_second_and_in_other_seconds_succeeds(void)
+{
+    // arrange
+    int64_t second = INT64_C(1792353646) * 1000000000;
+    char buffer[TIMESTAMP_TO_STRING_LENGTH + 1];
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(timestamp_to_string(second, buffer, sizeof(buffer)) == TIMESTAMP_TO_STRING_LENGTH);
+    POOR_MANS_ASSERT(strcmp(buffer, "2026-10-18T20:00:46.000000000Z") == 0);
+    POOR_MANS_ASSERT(timestamp_to_string(second + 999999999, buffer, sizeof(buffer)) == TIMESTAMP_TO_STRING_LENGTH);
+    POOR_MANS_ASSERT(strcmp(buffer, "2026-10-18T20:00:46.999999999Z") == 0);
+    POOR_MANS_ASSERT(timestamp_to_string(second + 1000000000, buffer, sizeof(buffer)) == TIMESTAMP_TO_STRING_LENGTH);
+    POOR_MANS_ASSERT(strcmp(buffer, "2026-10-18T20:00:47.000000000Z") == 0);
+    POOR_MANS_ASSERT(timestamp_to_string(second - 1, buffer, sizeof(buffer)) == TIMESTAMP_TO_STRING_LENGTH);
+    POOR_MANS_ASSERT(strcmp(buffer, "2026-10-18T20:00:45.999999999Z") == 0);
+    POOR_MANS_ASSERT(timestamp_to_string(second + 5, buffer, sizeof(buffer)) == TIMESTAMP_TO_STRING_LENGTH);
+    POOR_MANS_ASSERT(strcmp(buffer, "2026-10-18T20:00:46.000000005Z") == 0);
+}
+
+/* Tests_SRS_TIME_TO_STRING_01_010: [ If buffer_length is 0, timestamp_to_string, timestamp_microseconds_to_string and duration_to_string shall only return the length of the representation. ]*/
+static void timestamp_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length(void)
+{
+    // arrange
+
+    // act
+    int result = timestamp_to_string(0, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == TIMESTAMP_TO_STRING_LENGTH);
+}
+
+/* Tests_SRS_TIME_TO_STRING_01_012: [ Otherwise timestamp_to_string, timestamp_microseconds_to_string and duration_to_string shall write the first buffer_length - 1 characters of the representation in buffer, followed by a zero terminator. ]*/
+/* Tests_SRS_TIME_TO_STRING_01_013: [ timestamp_to_string, timestamp_microseconds_to_string and duration_to_string shall return the number of characters of the representation, excluding the zero terminator. ]*/
+static void timestamp_to_string_truncates_for_all_buffer_lengths(void)
+{
+    // arrange
+    char buffer[TIMESTAMP_TO_STRING_LENGTH + 2];
+
+    // act
+    // assert
+    for (size_t buffer_length = 1; buffer_length <= TIMESTAMP_TO_STRING_LENGTH; buffer_length++)
+    {
+        (void)memset(buffer, 'x', sizeof(buffer));
+        POOR_MANS_ASSERT(timestamp_to_string(timestamp_test_cases[2].value, buffer, buffer_length) == TIMESTAMP_TO_STRING_LENGTH);
+        POOR_MANS_ASSERT(strlen(buffer) == buffer_length - 1);
+        POOR_MANS_ASSERT(strncmp(buffer, timestamp_test_cases[2].expected, buffer_length - 1) == 0);
+        POOR_MANS_ASSERT(buffer[buffer_length] == 'x');
+    }
+}
+
+/* timestamp_microseconds_to_string */
+
+/* Tests_SRS_TIME_TO_STRING_01_014: [ If buffer is NULL and buffer_length is greater than 0, timestamp_microseconds_to_string shall fail and return a negative value. ]*/
+static void timestamp_microseconds_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails(void)
+{
+    // arrange
+
+    // act
+    int result = timestamp_microseconds_to_string(0, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_TIME_TO_STRING_01_015: [ timestamp_microseconds_to_string shall produce the UTC date and time of nanoseconds_since_epoch in the ISO 8601 form YYYY-MM-DDTHH:MM:SS.uuuuuuZ, with the microseconds truncated. ]*/
+/* Tests_SRS_TIME_TO_STRING_01_016: [ timestamp_microseconds_to_string shall share with timestamp_to_string the per thread YYYY-MM-DDTHH:MM:SS text of the last second rendered. ]*/
+static void timestamp_microseconds_to_string_succeeds(void)
+{
+    // arrange
+    int64_t second = INT64_C(1792353646) * 1000000000;
+    char buffer[TIMESTAMP_MICROSECONDS_TO_STRING_LENGTH + 1];
+    char nanoseconds_buffer[TIMESTAMP_TO_STRING_LENGTH + 1];
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(timestamp_microseconds_to_string(second + 123456789, buffer, sizeof(buffer)) == TIMESTAMP_MICROSECONDS_TO_STRING_LENGTH);
+    POOR_MANS_ASSERT(strcmp(buffer, "2026-10-18T20:00:46.123456Z") == 0);
+    POOR_MANS_ASSERT(timestamp_to_string(second + 999999999, nanoseconds_buffer, sizeof(nanoseconds_buffer)) == TIMESTAMP_TO_STRING_LENGTH);
+    POOR_MANS_ASSERT(strcmp(nanoseconds_buffer, "2026-10-18T20:00:46.999999999Z") == 0);
+    POOR_MANS_ASSERT(timestamp_microseconds_to_string(second + 999999999, buffer, sizeof(buffer)) == TIMESTAMP_MICROSECONDS_TO_STRING_LENGTH);
+    POOR_MANS_ASSERT(strcmp(buffer, "2026-10-18T20:00:46.999999Z") == 0);
+    POOR_MANS_ASSERT(timestamp_microseconds_to_string(second - 1, buffer, sizeof(buffer)) == TIMESTAMP_MICROSECONDS_TO_STRING_LENGTH);
+    POOR_MANS_ASSERT(strcmp(buffer, "2026-10-18T20:00:45.999999Z") == 0);
+    POOR_MANS_ASSERT(timestamp_microseconds_to_string(0, buffer, sizeof(buffer)) == TIMESTAMP_MICROSECONDS_TO_STRING_LENGTH);
+    POOR_MANS_ASSERT(strcmp(buffer, "1970-01-01T00:00:00.000000Z") == 0);
+}
+
+/* Tests_SRS_TIME_TO_STRING_01_012: [ Otherwise timestamp_to_string, timestamp_microseconds_to_string and duration_to_string shall write the first buffer_length - 1 characters of the representation in buffer, followed by a zero terminator. ]*/
+static void timestamp_microseconds_to_string_truncates_for_all_buffer_lengths(void)
+{
+    // arrange
+    char buffer[TIMESTAMP_MICROSECONDS_TO_STRING_LENGTH + 2];
+    static const char expected[] = "2026-10-18T20:00:46.123456Z";
+
+    // act
+    // assert
+    POOR_MANS_ASSERT(timestamp_microseconds_to_string(0, NULL, 0) == TIMESTAMP_MICROSECONDS_TO_STRING_LENGTH);
+    for (size_t buffer_length = 1; buffer_length <= TIMESTAMP_MICROSECONDS_TO_STRING_LENGTH; buffer_length++)
+    {
+        (void)memset(buffer, 'x', sizeof(buffer));
+        POOR_MANS_ASSERT(timestamp_microseconds_to_string(INT64_C(1792353646123456789), buffer, buffer_length) == TIMESTAMP_MICROSECONDS_TO_STRING_LENGTH);
+        POOR_MANS_ASSERT(strlen(buffer) == buffer_length - 1);
+        POOR_MANS_ASSERT(strncmp(buffer, expected, buffer_length - 1) == 0);
+        POOR_MANS_ASSERT(buffer[buffer_length] == 'x');
+    }
+}
+
+/* duration_to_string */
+
+/* Tests_SRS_TIME_TO_STRING_01_005: [ If buffer is NULL and buffer_length is greater than 0, duration_to_string shall fail and return a negative value. ]*/
+static void duration_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails(void)
+{
+    // arrange
+
+    // act
+    int result = duration_to_string(0, NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_TIME_TO_STRING_01_006: [ If nanoseconds is negative, duration_to_string shall produce - followed by the representation of its magnitude. ]*/
+/* Tests_SRS_TIME_TO_STRING_01_007: [ If the magnitude is less than 1 microsecond, duration_to_string shall produce the number of nanoseconds followed by ns. ]*/
+/* Tests_SRS_TIME_TO_STRING_01_008: [ If the magnitude is less than 1 second, duration_to_string shall produce the number of microseconds (respectively milliseconds) with 3 decimals, truncated, followed by us (respectively ms). ]*/
+/* Tests_SRS_TIME_TO_STRING_01_009: [ Otherwise duration_to_string shall produce the number of days followed by d, hours followed by h and minutes followed by m, omitting the leading units that are 0 and using 2 digits for all but the first unit, followed by the seconds with 3 decimals, truncated, and s. ]*/
+/* Tests_SRS_TIME_TO_STRING_01_011: [ If the representation fits in buffer, timestamp_to_string, timestamp_microseconds_to_string and duration_to_string shall write it in buffer followed by a zero terminator. ]*/
+/* Tests_SRS_TIME_TO_STRING_01_013: [ timestamp_to_string, timestamp_microseconds_to_string and duration_to_string shall return the number of characters of the representation, excluding the zero terminator. ]*/
+static void duration_to_string_succeeds(void)
+{
+    for (size_t i = 0; i < MU_COUNT_ARRAY_ITEMS(duration_test_cases); i++)
+    {
+        // arrange
+        char buffer[DURATION_TO_STRING_MAX_LENGTH + 1];
+
+        // act
+        int result = duration_to_string(duration_test_cases[i].value, buffer, sizeof(buffer));
+
+        // assert
+        POOR_MANS_ASSERT(result == (int)strlen(duration_test_cases[i].expected));
+        POOR_MANS_ASSERT(strcmp(buffer, duration_test_cases[i].expected) == 0);
+    }
+}
+
+/* Tests_SRS_TIME_TO_STRING_01_010: [ If buffer_length is 0, timestamp_to_string, timestamp_microseconds_to_string and duration_to_string shall only return the length of the representation. ]*/
+static void duration_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length(void)
+{
+    // arrange
+
+    // act
+    int result = duration_to_string(INT64_MIN, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == DURATION_TO_STRING_MAX_LENGTH);
+}
+
+/* Tests_SRS_TIME_TO_STRING_01_012: [ Otherwise timestamp_to_string, timestamp_microseconds_to_string and duration_to_string shall write the first buffer_length - 1 characters of the representation in buffer, followed by a zero terminator. ]*/
+/* Tests_SRS_TIME_TO_STRING_01_013: [ timestamp_to_string, timestamp_microseconds_to_string and duration_to_string shall return the number of characters of the representation, excluding the zero terminator. ]*/
+static void duration_to_string_truncates_for_all_buffer_lengths(void)
+{
+    // arrange
+    static const char expected[] = "-106751d23h47m16.854s";
+    char buffer[DURATION_TO_STRING_MAX_LENGTH + 2];
+
+    // act
+    // assert
+    for (size_t buffer_length = 1; buffer_length <= DURATION_TO_STRING_MAX_LENGTH; buffer_length++)
+    {
+        (void)memset(buffer, 'x', sizeof(buffer));
+        POOR_MANS_ASSERT(duration_to_string(INT64_MIN, buffer, buffer_length) == DURATION_TO_STRING_MAX_LENGTH);
+        POOR_MANS_ASSERT(strlen(buffer) == buffer_length - 1);
+        POOR_MANS_ASSERT(strncmp(buffer, expected, buffer_length - 1) == 0);
+        POOR_MANS_ASSERT(buffer[buffer_length] == 'x');
+    }
+}
+
+int main(void)
+{
+    timestamp_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails();
+    timestamp_to_string_succeeds();
+    timestamp_to_string_produces_every_day_of_a_leap_year();
+    timestamp_to_string_in_the_same_second_and_in_other_seconds_succeeds();
+    timestamp_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length();
+    timestamp_to_string_truncates_for_all_buffer_lengths();
+
+    timestamp_microseconds_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails();
+    timestamp_microseconds_to_string_succeeds();
+    timestamp_microseconds_to_string_truncates_for_all_buffer_lengths();
+
+    duration_to_string_with_NULL_buffer_and_non_zero_buffer_length_fails();
+    duration_to_string_succeeds();
+    duration_to_string_with_NULL_buffer_and_0_buffer_length_returns_the_length();
+    duration_to_string_truncates_for_all_buffer_lengths();
+
+    return 0;
+}
@@ -0,0 +1,287 @@
+// Copyright (c) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE file in the project root for full license information.
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <wchar.h>
+
+#include "macro_utils/macro_utils.h"
+
+#include "c_logging/wchar_to_utf8.h"
+
+#define TEST_STRING_LENGTH 100
+
+#define POOR_MANS_ASSERT(cond) \
+    if (!(cond)) \
+    { \
+        (void)printf("%s:%d test failed\r\n", __FUNCTION__, __LINE__); \
+        abort(); \
+    } \
+
+typedef struct TEST_CHARACTER_TAG
+{
+    wchar_t value;
+    const char* utf8;
+} TEST_CHARACTER;
+
+// mostly ASCII, with a 2 byte and a 3 byte character every now and then so that some 16 character blocks are not ASCII
+static const TEST_CHARACTER test_characters[] =
+{
+    { L'a', "a" }, { L'b', "b" }, { L'c', "c" }, { L'd', "d" }, { L'e', "e" }, { L'f', "f" }, { L'g', "g" }, { L'h', "h" },
+    { L'i', "i" }, { L'j', "j" }, { L'k', "k" }, { L'l', "l" }, { L'm', "m" }, { L'n', "n" }, { L'o', "o" }, { L'p', "p" },
+    { L'q', "q" }, { L'r', "r" }, { L's', "s" }, { L't', "t" }, { L'u', "u" }, { L'v', "v" }, { L'w', "w" }, { L'x', "x" },
+    { L'y', "y" }, { L'z', "z" }, { L'0', "0" }, { L'1', "1" }, { L'2', "2" }, { L'3', "3" }, { L' ', " " }, { L'\x7F', "\x7F" },
+    { (wchar_t)0x00E9, "\xC3\xA9" },
+    { L'A', "A" }, { L'B', "B" }, { L'C', "C" }, { L'D', "D" }, { L'E', "E" }, { L'F', "F" }, { L'G', "G" }, { L'H', "H" },
+    { (wchar_t)0x20AC, "\xE2\x82\xAC" },
+};
+
+// builds a string of test characters starting at index first, together with its UTF-8 representation
+// and the UTF-8 length of each prefix (the places where the UTF-8 string can be cut)
+static void build_test_string(size_t first, size_t length, wchar_t* source, char* expected, size_t* prefix_lengths)
+{
+    size_t expected_length = 0;
+    for (size_t i = 0; i < length; i++)
+    {
+        const TEST_CHARACTER* test_character = &test_characters[(first + i) % MU_COUNT_ARRAY_ITEMS(test_characters)];
+        prefix_lengths[i] = expected_length;
+        source[i] = test_character->value;
+        (void)memcpy(expected + expected_length, test_character->utf8, strlen(test_character->utf8));
+        expected_length += strlen(test_character->utf8);
+    }
+    prefix_lengths[length] = expected_length;
+    source[length] = L'\0';
+    expected[expected_length] = '\0';
+}
+
+/* wchar_to_utf8 */
+
+/* Tests_SRS_WCHAR_TO_UTF8_01_001: [ If source is NULL, wchar_to_utf8 shall fail and return a negative value. ]*/
+static void wchar_to_utf8_with_NULL_source_fails(void)
+{
+    // arrange
+    char buffer[8];
+
+    // act
+    int result = wchar_to_utf8(NULL, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_WCHAR_TO_UTF8_01_002: [ If buffer is NULL and buffer_length is greater than 0, wchar_to_utf8 shall fail and return a negative value. ]*/
+static void wchar_to_utf8_with_NULL_buffer_and_non_zero_buffer_length_fails(void)
+{
+    // arrange
+
+    // act
+    int result = wchar_to_utf8(L"bau", NULL, 1);
+
+    // assert
+    POOR_MANS_ASSERT(result < 0);
+}
+
+/* Tests_SRS_WCHAR_TO_UTF8_01_004: [ wchar_to_utf8 shall write in buffer the UTF-8 encoding of the code points in source, for as many code points as fit entirely in buffer (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+/* Tests_SRS_WCHAR_TO_UTF8_01_008: [ wchar_to_utf8 shall succeed and return the length in bytes of the full UTF-8 string (without the zero terminator). ]*/
+static void wchar_to_utf8_with_an_ASCII_string_succeeds(void)
+{
+    // arrange
+    char buffer[32];
+
+    // act
+    int result = wchar_to_utf8(L"bau", buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 3);
+    POOR_MANS_ASSERT(strcmp(buffer, "bau") == 0);
+}
+
+/* Tests_SRS_WCHAR_TO_UTF8_01_004: [ wchar_to_utf8 shall write in buffer the UTF-8 encoding of the code points in source, for as many code points as fit entirely in buffer (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+/* Tests_SRS_WCHAR_TO_UTF8_01_005: [ wchar_to_utf8 shall decode source as UTF-32 when wchar_t is 32 bits wide and as UTF-16 (combining surrogate pairs) when wchar_t is 16 bits wide. ]*/
+/* Tests_SRS_WCHAR_TO_UTF8_01_008: [ wchar_to_utf8 shall succeed and return the length in bytes of the full UTF-8 string (without the zero terminator). ]*/
+static void wchar_to_utf8_encodes_2_3_and_4_byte_characters(void)
+{
+    // arrange
+    char buffer[32];
+
+    // act
+    // U+00E9, U+20AC and U+1F600 (a surrogate pair when wchar_t is 16 bits wide)
+    int result = wchar_to_utf8(L"\u00E9\u20AC\U0001F600", buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 9);
+    POOR_MANS_ASSERT(strcmp(buffer, "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80") == 0);
+}
+
+/* Tests_SRS_WCHAR_TO_UTF8_01_006: [ wchar_to_utf8 shall replace each code unit that does not encode a valid code point (an unpaired surrogate or a value above 0x10FFFF) with U+FFFD. ]*/
+static void wchar_to_utf8_replaces_an_unpaired_high_surrogate(void)
+{
+    // arrange
+    const wchar_t source[] = { L'a', (wchar_t)0xD800, L'b', (wchar_t)0xDBFF, L'\0' };
+    char buffer[32];
+
+    // act
+    int result = wchar_to_utf8(source, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 8);
+    POOR_MANS_ASSERT(strcmp(buffer, "a\xEF\xBF\xBD" "b\xEF\xBF\xBD") == 0);
+}
+
+/* Tests_SRS_WCHAR_TO_UTF8_01_006: [ wchar_to_utf8 shall replace each code unit that does not encode a valid code point (an unpaired surrogate or a value above 0x10FFFF) with U+FFFD. ]*/
+static void wchar_to_utf8_replaces_an_unpaired_low_surrogate(void)
+{
+    // arrange
+    const wchar_t source[] = { (wchar_t)0xDC00, L'a', L'\0' };
+    char buffer[32];
+
+    // act
+    int result = wchar_to_utf8(source, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 4);
+    POOR_MANS_ASSERT(strcmp(buffer, "\xEF\xBF\xBD" "a") == 0);
+}
+
+#if WCHAR_MAX > 0xFFFF
+/* Tests_SRS_WCHAR_TO_UTF8_01_006: [ wchar_to_utf8 shall replace each code unit that does not encode a valid code point (an unpaired surrogate or a value above 0x10FFFF) with U+FFFD. ]*/
+static void wchar_to_utf8_replaces_a_value_above_0x10FFFF(void)
+{
+    // arrange
+    const wchar_t source[] = { (wchar_t)0x10FFFF, (wchar_t)0x110000, L'\0' };
+    char buffer[32];
+
+    // act
+    int result = wchar_to_utf8(source, buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 7);
+    POOR_MANS_ASSERT(strcmp(buffer, "\xF4\x8F\xBF\xBF\xEF\xBF\xBD") == 0);
+}
+#endif
+
+/* Tests_SRS_WCHAR_TO_UTF8_01_004: [ wchar_to_utf8 shall write in buffer the UTF-8 encoding of the code points in source, for as many code points as fit entirely in buffer (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+/* Tests_SRS_WCHAR_TO_UTF8_01_007: [ When SSE2 instructions are available, wchar_to_utf8 shall check and convert runs of ASCII characters 16 at a time. ]*/
+/* Tests_SRS_WCHAR_TO_UTF8_01_008: [ wchar_to_utf8 shall succeed and return the length in bytes of the full UTF-8 string (without the zero terminator). ]*/
+static void wchar_to_utf8_succeeds_for_all_string_lengths(void)
+{
+    // arrange
+    wchar_t source[TEST_STRING_LENGTH + 1];
+    char expected[TEST_STRING_LENGTH * 3 + 1];
+    char actual[TEST_STRING_LENGTH * 3 + 2];
+    size_t prefix_lengths[TEST_STRING_LENGTH + 1];
+
+    // act
+    // assert
+    // covers the 16 character blocks, the blocks that are not all ASCII and the characters left after them
+    for (size_t first = 0; first < MU_COUNT_ARRAY_ITEMS(test_characters); first++)
+    {
+        for (size_t length = 0; length <= TEST_STRING_LENGTH; length++)
+        {
+            build_test_string(first, length, source, expected, prefix_lengths);
+            (void)memset(actual, 'x', sizeof(actual));
+            POOR_MANS_ASSERT(wchar_to_utf8(source, actual, sizeof(actual)) == (int)prefix_lengths[length]);
+            POOR_MANS_ASSERT(strcmp(actual, expected) == 0);
+            POOR_MANS_ASSERT(actual[prefix_lengths[length] + 1] == 'x');
+        }
+    }
+}
+
+/* Tests_SRS_WCHAR_TO_UTF8_01_004: [ wchar_to_utf8 shall write in buffer the UTF-8 encoding of the code points in source, for as many code points as fit entirely in buffer (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+/* Tests_SRS_WCHAR_TO_UTF8_01_008: [ wchar_to_utf8 shall succeed and return the length in bytes of the full UTF-8 string (without the zero terminator). ]*/
+static void wchar_to_utf8_truncates_to_whole_characters_for_all_buffer_lengths(void)
+{
+    // arrange
+    wchar_t source[TEST_STRING_LENGTH + 1];
+    char expected[TEST_STRING_LENGTH * 3 + 1];
+    char actual[TEST_STRING_LENGTH * 3 + 2];
+    size_t prefix_lengths[TEST_STRING_LENGTH + 1];
+    build_test_string(7, TEST_STRING_LENGTH, source, expected, prefix_lengths);
+
+    // act
+    // assert
+    for (size_t buffer_length = 1; buffer_length <= prefix_lengths[TEST_STRING_LENGTH] + 1; buffer_length++)
+    {
+        // the longest prefix made of whole characters that fits
+        size_t expected_length = 0;
+        for (size_t i = 0; (i <= TEST_STRING_LENGTH) && (prefix_lengths[i] < buffer_length); i++)
+        {
+            expected_length = prefix_lengths[i];
+        }
+
+        (void)memset(actual, 'x', sizeof(actual));
+        POOR_MANS_ASSERT(wchar_to_utf8(source, actual, buffer_length) == (int)prefix_lengths[TEST_STRING_LENGTH]);
+        POOR_MANS_ASSERT(strlen(actual) == expected_length);
+        POOR_MANS_ASSERT(strncmp(actual, expected, expected_length) == 0);
+        POOR_MANS_ASSERT(actual[buffer_length] == 'x');
+    }
+}
+
+/* Tests_SRS_WCHAR_TO_UTF8_01_009: [ If not all the code points fit, wchar_to_utf8 shall fill the rest of buffer up to buffer_length - 1 with zero terminators. ]*/
+static void wchar_to_utf8_truncated_inside_a_multibyte_character_fills_the_rest_of_the_buffer_with_zeros(void)
+{
+    // arrange
+    char buffer[5];
+    (void)memset(buffer, 'x', sizeof(buffer));
+
+    // act
+    // the euro sign takes 3 bytes, only 2 are left after the 'a'
+    int result = wchar_to_utf8(L"a\u20AC", buffer, 4);
+
+    // assert
+    POOR_MANS_ASSERT(result == 4);
+    POOR_MANS_ASSERT(memcmp(buffer, "a\0\0\0x", sizeof(buffer)) == 0);
+}
+
+/* Tests_SRS_WCHAR_TO_UTF8_01_008: [ wchar_to_utf8 shall succeed and return the length in bytes of the full UTF-8 string (without the zero terminator). ]*/
+static void wchar_to_utf8_with_NULL_buffer_and_0_buffer_length_returns_the_length(void)
+{
+    // arrange
+    wchar_t source[TEST_STRING_LENGTH + 1];
+    char expected[TEST_STRING_LENGTH * 3 + 1];
+    size_t prefix_lengths[TEST_STRING_LENGTH + 1];
+    build_test_string(0, TEST_STRING_LENGTH, source, expected, prefix_lengths);
+
+    // act
+    int result = wchar_to_utf8(source, NULL, 0);
+
+    // assert
+    POOR_MANS_ASSERT(result == (int)strlen(expected));
+}
+
+/* Tests_SRS_WCHAR_TO_UTF8_01_004: [ wchar_to_utf8 shall write in buffer the UTF-8 encoding of the code points in source, for as many code points as fit entirely in buffer (keeping one byte for the zero terminator), followed by a zero terminator. ]*/
+static void wchar_to_utf8_with_an_empty_string_produces_an_empty_string(void)
+{
+    // arrange
+    char buffer[4] = "xxx";
+
+    // act
+    int result = wchar_to_utf8(L"", buffer, sizeof(buffer));
+
+    // assert
+    POOR_MANS_ASSERT(result == 0);
+    POOR_MANS_ASSERT(buffer[0] == '\0');
+}
+
+int main(void)
+{
+    wchar_to_utf8_with_NULL_source_fails();
+    wchar_to_utf8_with_NULL_buffer_and_non_zero_buffer_length_fails();
+    wchar_to_utf8_with_an_ASCII_string_succeeds();
+    wchar_to_utf8_encodes_2_3_and_4_byte_characters();
+    wchar_to_utf8_replaces_an_unpaired_high_surrogate();
+    wchar_to_utf8_replaces_an_unpaired_low_surrogate();
+#if WCHAR_MAX > 0xFFFF
+    wchar_to_utf8_replaces_a_value_above_0x10FFFF();
+#endif
+    wchar_to_utf8_succeeds_for_all_string_lengths();
+    wchar_to_utf8_truncates_to_whole_characters_for_all_buffer_lengths();
+    wchar_to_utf8_truncated_inside_a_multibyte_character_fills_the_rest_of_the_buffer_with_zeros();
+    wchar_to_utf8_with_NULL_buffer_and_0_buffer_length_returns_the_length();
+    wchar_to_utf8_with_an_empty_string_produces_an_empty_string();
+
+    return 0;
+}